@@ -0,0 +1,352 @@
+//
+// Copyright (c) 2024 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#pragma once
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#include "parse_args.h"
+#include "zenoh.h"
+
+#if defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API)
+#define BENCH_SHM 1
+#endif
+
+#define BENCH_DEFAULT_ENDPOINT "tcp/127.0.0.1:7450"
+#define BENCH_DEFAULT_SIZES "8,64,1024,8192,65536,1048576"
+#define BENCH_DEFAULT_PRIORITIES "5"
+#define BENCH_MAX_VALUES 32
+
+#define BENCH_HELP \
+    "\
+        -s, --sizes <SIZES> (optional, comma-separated ints, default='" BENCH_DEFAULT_SIZES "'): The payload sizes in bytes\n\
+        -p, --priorities <PRIORITIES> (optional, comma-separated ints [1-7], default='" BENCH_DEFAULT_PRIORITIES "'): The publisher priorities\n\
+        --express <EXPRESS> (optional, string, default='both'): Express mode of the publishers. [possible values: on, off, both]\n\
+        --delivery <DELIVERY> (optional, string, default='both'): How the samples are received. [possible values: closure, channel, both]\n\
+        --shm <SHM> (optional, string, default='both' if shared memory is enabled, else 'off'): Whether payloads are allocated in shared memory. [possible values: on, off, both]\n\
+        -e, --endpoint <ENDPOINT> (optional, string, default='" BENCH_DEFAULT_ENDPOINT "'): The endpoint connecting the two sessions of the benchmark\n\
+        -o, --output <FILE> (optional, string): Write the JSON report to FILE instead of stdout\n\
+        -h, --help: Print help\n\
+"
+
+/**
+ * A log-linear histogram à la HdrHistogram, with 2 significant decimal digits: values below 128 are recorded exactly,
+ * larger ones in buckets of 1/64th of their power of 2.
+ */
+#define BENCH_HIST_SUB_BITS 7
+#define BENCH_HIST_SUB_COUNT (1 << BENCH_HIST_SUB_BITS)
+#define BENCH_HIST_HALF_COUNT (BENCH_HIST_SUB_COUNT / 2)
+#define BENCH_HIST_MAGNITUDES 48
+#define BENCH_HIST_BUCKETS (BENCH_HIST_SUB_COUNT + BENCH_HIST_MAGNITUDES * BENCH_HIST_HALF_COUNT)
+
+typedef struct bench_histogram_t {
+    uint64_t counts[BENCH_HIST_BUCKETS];
+    uint64_t total;
+    uint64_t min;
+    uint64_t max;
+    double sum;
+} bench_histogram_t;
+
+static void bench_histogram_reset(bench_histogram_t* h) {
+    memset(h, 0, sizeof(*h));
+    h->min = UINT64_MAX;
+}
+
+static size_t bench_histogram_index(uint64_t v) {
+    if (v < BENCH_HIST_SUB_COUNT) {
+        return (size_t)v;
+    }
+    unsigned msb = 0;
+    for (uint64_t x = v; x > 1; x >>= 1) {
+        msb++;
+    }
+    unsigned shift = msb - (BENCH_HIST_SUB_BITS - 1);
+    if (shift > BENCH_HIST_MAGNITUDES) {
+        return BENCH_HIST_BUCKETS - 1;
+    }
+    return BENCH_HIST_SUB_COUNT + (shift - 1) * BENCH_HIST_HALF_COUNT + (size_t)((v >> shift) - BENCH_HIST_HALF_COUNT);
+}
+
+/// Returns the highest value recorded in the same bucket as the values at `index`.
+static uint64_t bench_histogram_bucket_max(size_t index) {
+    if (index < BENCH_HIST_SUB_COUNT) {
+        return index;
+    }
+    unsigned shift = (unsigned)((index - BENCH_HIST_SUB_COUNT) / BENCH_HIST_HALF_COUNT) + 1;
+    uint64_t sub = (index - BENCH_HIST_SUB_COUNT) % BENCH_HIST_HALF_COUNT + BENCH_HIST_HALF_COUNT;
+    return ((sub + 1) << shift) - 1;
+}
+
+static void bench_histogram_record(bench_histogram_t* h, uint64_t v) {
+    h->counts[bench_histogram_index(v)]++;
+    h->total++;
+    h->sum += (double)v;
+    if (v < h->min) h->min = v;
+    if (v > h->max) h->max = v;
+}
+
+/// Returns the value below which `percentile` percents of the recorded values fall.
+static uint64_t bench_histogram_percentile(const bench_histogram_t* h, double percentile) {
+    if (h->total == 0) {
+        return 0;
+    }
+    uint64_t rank = (uint64_t)(percentile / 100.0 * (double)h->total + 0.5);
+    if (rank < 1) rank = 1;
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BENCH_HIST_BUCKETS; i++) {
+        seen += h->counts[i];
+        if (seen >= rank) {
+            uint64_t v = bench_histogram_bucket_max(i);
+            return v < h->max ? v : h->max;
+        }
+    }
+    return h->max;
+}
+
+static uint64_t bench_now_ns(void) {
+#if defined(_WIN32)
+    LARGE_INTEGER freq, now;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (uint64_t)((double)now.QuadPart * 1e9 / (double)freq.QuadPart);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+/// The parameters of one benchmark run.
+typedef struct bench_case_t {
+    size_t payload_size;
+    z_priority_t priority;
+    bool express;
+    bool channel;
+    bool shm;
+} bench_case_t;
+
+/// The parameter matrix swept by a benchmark, the cases are the cartesian product of all the values.
+typedef struct bench_matrix_t {
+    size_t sizes[BENCH_MAX_VALUES];
+    size_t sizes_nb;
+    z_priority_t priorities[BENCH_MAX_VALUES];
+    size_t priorities_nb;
+    bool express[2];
+    size_t express_nb;
+    bool channel[2];
+    size_t channel_nb;
+    bool shm[2];
+    size_t shm_nb;
+    const char* endpoint;
+    FILE* out;
+} bench_matrix_t;
+
+static size_t bench_parse_list(const char* arg, size_t* values) {
+    size_t nb = 0;
+    const char* p = arg;
+    while (*p && nb < BENCH_MAX_VALUES) {
+        char* end;
+        values[nb++] = (size_t)strtoull(p, &end, 10);
+        if (end == p) {
+            printf("Invalid list value [%s]\n", arg);
+            exit(-1);
+        }
+        p = *end == ',' ? end + 1 : end;
+    }
+    return nb;
+}
+
+static size_t bench_parse_bools(const char* arg, const char* on, const char* off, bool* values) {
+    if (strcmp(arg, on) == 0) {
+        values[0] = true;
+        return 1;
+    } else if (strcmp(arg, off) == 0) {
+        values[0] = false;
+        return 1;
+    } else if (strcmp(arg, "both") == 0) {
+        values[0] = false;
+        values[1] = true;
+        return 2;
+    }
+    printf("Unsupported value [%s], expected '%s', '%s' or 'both'\n", arg, on, off);
+    exit(-1);
+}
+
+/// Parses the benchmark options common to all benchmarks from `argv`, they are replaced by NULL.
+static void bench_parse_matrix(int argc, char** argv, bench_matrix_t* m) {
+    const char* arg;
+    _Z_PARSE_ARG(arg, "s", "sizes", (const char*), BENCH_DEFAULT_SIZES);
+    m->sizes_nb = bench_parse_list(arg, m->sizes);
+    size_t priorities[BENCH_MAX_VALUES];
+    _Z_PARSE_ARG(arg, "p", "priorities", (const char*), BENCH_DEFAULT_PRIORITIES);
+    m->priorities_nb = bench_parse_list(arg, priorities);
+    for (size_t i = 0; i < m->priorities_nb; i++) {
+        char buf[8];
+        snprintf(buf, sizeof(buf), "%zu", priorities[i]);
+        m->priorities[i] = parse_priority(buf);
+    }
+    _Z_PARSE_ARG_SINGLE_OPT(arg, "express", (const char*), "both");
+    m->express_nb = bench_parse_bools(arg, "on", "off", m->express);
+    _Z_PARSE_ARG_SINGLE_OPT(arg, "delivery", (const char*), "both");
+    m->channel_nb = bench_parse_bools(arg, "channel", "closure", m->channel);
+#if defined(BENCH_SHM)
+    _Z_PARSE_ARG_SINGLE_OPT(arg, "shm", (const char*), "both");
+#else
+    _Z_PARSE_ARG_SINGLE_OPT(arg, "shm", (const char*), "off");
+#endif
+    m->shm_nb = bench_parse_bools(arg, "on", "off", m->shm);
+#if !defined(BENCH_SHM)
+    if (m->shm_nb != 1 || m->shm[0]) {
+        printf("Shared memory benchmarks require zenoh-c to be built with shared memory and unstable API\n");
+        exit(-1);
+    }
+#endif
+    _Z_PARSE_ARG(m->endpoint, "e", "endpoint", (const char*), BENCH_DEFAULT_ENDPOINT);
+    _Z_PARSE_ARG(arg, "o", "output", (const char*), NULL);
+    m->out = stdout;
+    if (arg != NULL && (m->out = fopen(arg, "w")) == NULL) {
+        printf("Unable to open %s\n", arg);
+        exit(-1);
+    }
+}
+
+static size_t bench_max_size(const bench_matrix_t* m) {
+    size_t max = 0;
+    for (size_t i = 0; i < m->sizes_nb; i++) {
+        if (m->sizes[i] > max) max = m->sizes[i];
+    }
+    return max;
+}
+
+/**
+ * Opens two peer sessions connected to each other through `endpoint` only, so that the results do not depend on the
+ * network environment. Shared memory transport is enabled on both if `shm` is true.
+ */
+static void bench_open_sessions(const char* endpoint, bool shm, z_owned_session_t* listener,
+                                z_owned_session_t* connector) {
+    char endpoints[256];
+    snprintf(endpoints, sizeof(endpoints), "[\"%s\"]", endpoint);
+    for (int i = 0; i < 2; i++) {
+        z_owned_config_t config;
+        z_config_default(&config);
+        zc_config_insert_json5(z_loan_mut(config), Z_CONFIG_MODE_KEY, "\"peer\"");
+        zc_config_insert_json5(z_loan_mut(config), Z_CONFIG_MULTICAST_SCOUTING_KEY, "false");
+        zc_config_insert_json5(z_loan_mut(config), Z_CONFIG_SHARED_MEMORY_KEY, shm ? "true" : "false");
+        zc_config_insert_json5(z_loan_mut(config), i == 0 ? Z_CONFIG_LISTEN_KEY : Z_CONFIG_CONNECT_KEY, endpoints);
+        if (z_open(i == 0 ? listener : connector, z_move(config), NULL) != Z_OK) {
+            printf("Unable to open session on %s!\n", endpoint);
+            exit(-1);
+        }
+    }
+}
+
+/// Payloads sent by the benchmarks, either copied from a heap buffer or allocated in shared memory.
+typedef struct bench_payload_t {
+    uint8_t* data;
+    size_t size;
+#if defined(BENCH_SHM)
+    bool shm;
+    z_owned_shm_provider_t provider;
+#endif
+} bench_payload_t;
+
+static void bench_payload_init(bench_payload_t* p, size_t size, bool shm) {
+    p->size = size;
+    p->data = (uint8_t*)z_malloc(size > 0 ? size : 1);
+    for (size_t i = 0; i < size; i++) {
+        p->data[i] = (uint8_t)(i % 10);
+    }
+#if defined(BENCH_SHM)
+    p->shm = shm;
+    if (shm) {
+        z_alloc_alignment_t alignment = {0};
+        z_owned_memory_layout_t layout;
+        // room for the payloads in flight, they are garbage collected when the provider runs out of memory
+        z_memory_layout_new(&layout, size * 64 + 4096, alignment);
+        if (z_posix_shm_provider_new(&p->provider, z_loan(layout)) != Z_OK) {
+            printf("Unable to create SHM provider!\n");
+            exit(-1);
+        }
+        z_drop(z_move(layout));
+    }
+#else
+    (void)shm;
+#endif
+}
+
+static void bench_payload_make(bench_payload_t* p, z_owned_bytes_t* payload) {
+#if defined(BENCH_SHM)
+    if (p->shm) {
+        z_alloc_alignment_t alignment = {0};
+        z_buf_layout_alloc_result_t alloc;
+        z_shm_provider_alloc_gc_defrag_blocking(&alloc, z_loan(p->provider), p->size, alignment);
+        if (alloc.status != ZC_BUF_LAYOUT_ALLOC_STATUS_OK) {
+            printf("Unable to allocate SHM buffer!\n");
+            exit(-1);
+        }
+        memcpy(z_shm_mut_data_mut(z_loan_mut(alloc.buf)), p->data, p->size);
+        z_bytes_from_shm_mut(payload, z_move(alloc.buf));
+        return;
+    }
+#endif
+    z_bytes_copy_from_buf(payload, p->data, p->size);
+}
+
+static void bench_payload_drop(bench_payload_t* p) {
+#if defined(BENCH_SHM)
+    if (p->shm) {
+        z_drop(z_move(p->provider));
+    }
+#endif
+    z_free(p->data);
+}
+
+static void bench_json_begin(FILE* out, const char* benchmark) {
+    fprintf(out, "{\n  \"benchmark\": \"%s\",\n  \"zenoh_c_version\": \"%s\",\n  \"results\": [", benchmark,
+            ZENOH_C);
+}
+
+static void bench_json_case_begin(FILE* out, const bench_case_t* c, bool first) {
+    fprintf(out,
+            "%s\n    {\"payload_size\": %zu, \"priority\": %d, \"express\": %s, \"delivery\": \"%s\", \"shm\": %s",
+            first ? "" : ",", c->payload_size, (int)c->priority, c->express ? "true" : "false",
+            c->channel ? "channel" : "closure", c->shm ? "true" : "false");
+}
+
+static void bench_json_histogram(FILE* out, const char* name, const bench_histogram_t* h) {
+    fprintf(out,
+            ", \"%s\": {\"count\": %" PRIu64 ", \"min\": %" PRIu64 ", \"mean\": %.0f, \"p50\": %" PRIu64
+            ", \"p90\": %" PRIu64 ", \"p99\": %" PRIu64 ", \"p99.9\": %" PRIu64 ", \"max\": %" PRIu64 "}",
+            name, h->total, h->total ? h->min : 0, h->total ? h->sum / (double)h->total : 0.0,
+            bench_histogram_percentile(h, 50.0), bench_histogram_percentile(h, 90.0),
+            bench_histogram_percentile(h, 99.0), bench_histogram_percentile(h, 99.9), h->max);
+}
+
+static void bench_json_case_end(FILE* out) { fprintf(out, "}"); }
+
+static void bench_json_end(FILE* out) {
+    fprintf(out, "\n  ]\n}\n");
+    fflush(out);
+}
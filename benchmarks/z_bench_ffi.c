@@ -0,0 +1,253 @@
+//
+// Copyright (c) 2024 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include "bench_common.h"
+
+#define DEFAULT_BATCHES_NB 10000
+#define DEFAULT_BATCH_SIZE 1000
+#define PAYLOAD_SIZE 64
+
+struct args_t {
+    unsigned int number_of_batches;  // -n, --batches
+    unsigned int batch_size;         // -b, --batch-size
+    FILE* out;                       // -o, --output
+};
+struct args_t parse_args(int argc, char** argv);
+
+// The sample the accessors are called on, received once from a local publication.
+static z_owned_sample_t sample;
+static uint8_t payload_data[PAYLOAD_SIZE];
+// Results are accumulated here, so that the calls can not be considered as dead code.
+static volatile uintptr_t sink;
+
+void callback(z_loaned_sample_t* s, void* context) {
+    if (!z_internal_check(sample)) {
+        z_sample_clone(&sample, s);
+    }
+}
+
+#define SAMPLE() z_loan(sample)
+
+static void op_baseline(void) { sink += (uintptr_t)SAMPLE(); }
+static void op_sample_payload(void) { sink += (uintptr_t)z_sample_payload(SAMPLE()); }
+static void op_sample_keyexpr(void) { sink += (uintptr_t)z_sample_keyexpr(SAMPLE()); }
+static void op_sample_encoding(void) { sink += (uintptr_t)z_sample_encoding(SAMPLE()); }
+static void op_sample_timestamp(void) { sink += (uintptr_t)z_sample_timestamp(SAMPLE()); }
+static void op_sample_attachment(void) { sink += (uintptr_t)z_sample_attachment(SAMPLE()); }
+static void op_sample_kind(void) { sink += (uintptr_t)z_sample_kind(SAMPLE()); }
+static void op_sample_priority(void) { sink += (uintptr_t)z_sample_priority(SAMPLE()); }
+static void op_sample_express(void) { sink += (uintptr_t)z_sample_express(SAMPLE()); }
+#if defined(Z_FEATURE_UNSTABLE_API)
+static void op_sample_get_fields(void) {
+    zc_sample_fields_t fields;
+    zc_sample_get_fields(SAMPLE(), &fields);
+    sink += (uintptr_t)fields.payload + (uintptr_t)fields.kind + (uintptr_t)fields.priority + (uintptr_t)fields.express;
+}
+#endif
+static void op_bytes_len(void) { sink += z_bytes_len(z_sample_payload(SAMPLE())); }
+static void op_keyexpr_as_view_string(void) {
+    z_view_string_t s;
+    z_keyexpr_as_view_string(z_sample_keyexpr(SAMPLE()), &s);
+    sink += z_string_len(z_loan(s));
+}
+static void op_bytes_clone_drop(void) {
+    z_owned_bytes_t b;
+    z_bytes_clone(&b, z_sample_payload(SAMPLE()));
+    z_drop(z_move(b));
+}
+static void op_encoding_clone_drop(void) {
+    z_owned_encoding_t e;
+    z_encoding_clone(&e, z_sample_encoding(SAMPLE()));
+    z_drop(z_move(e));
+}
+static void op_sample_clone_drop(void) {
+    z_owned_sample_t s;
+    z_sample_clone(&s, SAMPLE());
+    z_drop(z_move(s));
+}
+static void op_bytes_from_static_drop(void) {
+    z_owned_bytes_t b;
+    z_bytes_from_static_buf(&b, payload_data, PAYLOAD_SIZE);
+    z_drop(z_move(b));
+}
+static void op_bytes_copy_from_buf_drop(void) {
+    z_owned_bytes_t b;
+    z_bytes_copy_from_buf(&b, payload_data, PAYLOAD_SIZE);
+    z_drop(z_move(b));
+}
+static void op_bytes_move_take(void) {
+    z_owned_bytes_t b, taken;
+    z_bytes_from_static_buf(&b, payload_data, PAYLOAD_SIZE);
+    z_bytes_take(&taken, z_move(b));
+    z_drop(z_move(taken));
+}
+// Key expressions of the same length are canonized: a plain one, which is validated by the fast path,
+// and ones with wildcards, whether already canon or not.
+#define KEYEXPR_PLAIN "bench/ffi/keyexpr/plain/sample/0123"
+#define KEYEXPR_WILD "bench/ffi/*/plain/**/sample/0123456"
+#define KEYEXPR_WILD_NON_CANON "bench/ffi/**/*/plain/**/sample/0123"
+static char keyexpr_buf[64];
+static void canonize(const char* expr, size_t len) {
+    // canonization is done in place, so the key expression is copied first
+    memcpy(keyexpr_buf, expr, len);
+    size_t l = len;
+    sink += (uintptr_t)z_keyexpr_canonize(keyexpr_buf, &l) + l;
+}
+static void op_keyexpr_canonize_plain(void) { canonize(KEYEXPR_PLAIN, sizeof(KEYEXPR_PLAIN) - 1); }
+static void op_keyexpr_canonize_wild(void) { canonize(KEYEXPR_WILD, sizeof(KEYEXPR_WILD) - 1); }
+static void op_keyexpr_canonize_wild_non_canon(void) {
+    canonize(KEYEXPR_WILD_NON_CANON, sizeof(KEYEXPR_WILD_NON_CANON) - 1);
+}
+
+typedef struct op_t {
+    const char* name;
+    void (*run)(void);
+} op_t;
+
+static const op_t ops[] = {
+    {"baseline", op_baseline},
+    {"z_sample_payload", op_sample_payload},
+    {"z_sample_keyexpr", op_sample_keyexpr},
+    {"z_sample_encoding", op_sample_encoding},
+    {"z_sample_timestamp", op_sample_timestamp},
+    {"z_sample_attachment", op_sample_attachment},
+    {"z_sample_kind", op_sample_kind},
+    {"z_sample_priority", op_sample_priority},
+    {"z_sample_express", op_sample_express},
+#if defined(Z_FEATURE_UNSTABLE_API)
+    {"zc_sample_get_fields", op_sample_get_fields},
+#endif
+    {"z_bytes_len", op_bytes_len},
+    {"z_keyexpr_as_view_string", op_keyexpr_as_view_string},
+    {"z_bytes_clone+z_bytes_drop", op_bytes_clone_drop},
+    {"z_encoding_clone+z_encoding_drop", op_encoding_clone_drop},
+    {"z_sample_clone+z_sample_drop", op_sample_clone_drop},
+    {"z_bytes_from_static_buf+z_bytes_drop", op_bytes_from_static_drop},
+    {"z_bytes_copy_from_buf+z_bytes_drop", op_bytes_copy_from_buf_drop},
+    {"z_bytes_from_static_buf+z_bytes_take+z_bytes_drop", op_bytes_move_take},
+    {"z_keyexpr_canonize(plain)", op_keyexpr_canonize_plain},
+    {"z_keyexpr_canonize(wildcard)", op_keyexpr_canonize_wild},
+    {"z_keyexpr_canonize(wildcard, non canon)", op_keyexpr_canonize_wild_non_canon},
+};
+
+int main(int argc, char** argv) {
+    zc_init_log_from_env_or("error");
+
+    struct args_t args = parse_args(argc, argv);
+
+    // a session without any transport, the sample is delivered locally
+    z_owned_config_t config;
+    z_config_default(&config);
+    zc_config_insert_json5(z_loan_mut(config), Z_CONFIG_MULTICAST_SCOUTING_KEY, "false");
+    zc_config_insert_json5(z_loan_mut(config), Z_CONFIG_LISTEN_KEY, "[]");
+    zc_config_insert_json5(z_loan_mut(config), Z_CONFIG_ADD_TIMESTAMP_KEY, "true");
+    z_owned_session_t session;
+    if (z_open(&session, z_move(config), NULL) != Z_OK) {
+        printf("Unable to open session!\n");
+        exit(-1);
+    }
+    z_internal_null(&sample);
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str_unchecked(&ke, "bench/ffi/sample");
+    z_owned_closure_sample_t closure;
+    z_closure(&closure, callback, NULL, NULL);
+    z_owned_subscriber_t sub;
+    z_declare_subscriber(z_loan(session), &sub, z_loan(ke), z_move(closure), NULL);
+    z_owned_bytes_t payload, attachment;
+    z_bytes_copy_from_buf(&payload, payload_data, PAYLOAD_SIZE);
+    z_bytes_copy_from_str(&attachment, "attachment");
+    z_put_options_t opts;
+    z_put_options_default(&opts);
+    opts.attachment = z_move(attachment);
+    z_put(z_loan(session), z_loan(ke), z_move(payload), &opts);
+    z_drop(z_move(sub));
+    if (!z_internal_check(sample)) {
+        printf("Sample was not delivered!\n");
+        exit(-1);
+    }
+
+    bench_histogram_t* batches = (bench_histogram_t*)z_malloc(sizeof(bench_histogram_t));
+    fprintf(args.out, "{\n  \"benchmark\": \"ffi\",\n  \"zenoh_c_version\": \"%s\",\n  \"calls_per_batch\": %u,\n",
+            ZENOH_C, args.batch_size);
+    fprintf(args.out, "  \"results\": [");
+    for (size_t i = 0; i < sizeof(ops) / sizeof(ops[0]); i++) {
+        for (unsigned int j = 0; j < args.batch_size; j++) {
+            ops[i].run();
+        }
+        bench_histogram_reset(batches);
+        for (unsigned int b = 0; b < args.number_of_batches; b++) {
+            uint64_t start = bench_now_ns();
+            for (unsigned int j = 0; j < args.batch_size; j++) {
+                ops[i].run();
+            }
+            bench_histogram_record(batches, bench_now_ns() - start);
+        }
+        fprintf(args.out, "%s\n    {\"call\": \"%s\", \"ns_per_call_p50\": %.2f", i == 0 ? "" : ",", ops[i].name,
+                (double)bench_histogram_percentile(batches, 50.0) / (double)args.batch_size);
+        bench_json_histogram(args.out, "batch_ns", batches);
+        fprintf(args.out, "}");
+    }
+    bench_json_end(args.out);
+
+    z_free(batches);
+    z_drop(z_move(sample));
+    z_drop(z_move(session));
+    if (args.out != stdout) {
+        fclose(args.out);
+    }
+    return 0;
+}
+
+void print_help() {
+    printf(
+        "\
+    Usage: z_bench_ffi [OPTIONS]\n\n\
+    Measures the cost of the most frequent calls through the C API, e.g. sample accessors, clones, drops\n\
+    and key expression canonization, and writes the percentiles of the duration of each batch of calls as JSON.\n\n\
+    Options:\n\
+        -n, --batches <BATCHES> (optional, int, default=%d): The number of measured batches per call\n\
+        -b, --batch-size <BATCH_SIZE> (optional, int, default=%d): The number of calls per batch\n\
+        -o, --output <FILE> (optional, string): Write the JSON report to FILE instead of stdout\n\
+        -h, --help: Print help\n",
+        DEFAULT_BATCHES_NB, DEFAULT_BATCH_SIZE);
+}
+
+struct args_t parse_args(int argc, char** argv) {
+    _Z_CHECK_HELP;
+    struct args_t args;
+    _Z_PARSE_ARG(args.number_of_batches, "n", "batches", atoi, DEFAULT_BATCHES_NB);
+    _Z_PARSE_ARG(args.batch_size, "b", "batch-size", atoi, DEFAULT_BATCH_SIZE);
+    const char* output;
+    _Z_PARSE_ARG(output, "o", "output", (const char*), NULL);
+    args.out = stdout;
+    if (output != NULL && (args.out = fopen(output, "w")) == NULL) {
+        printf("Unable to open %s\n", output);
+        exit(-1);
+    }
+    if (args.batch_size == 0) {
+        args.batch_size = 1;
+    }
+    const char* arg = check_unknown_opts(argc, argv);
+    if (arg) {
+        printf("Unknown option %s\n", arg);
+        exit(-1);
+    }
+    for (int i = 1; i < argc; i++) {
+        if (argv[i]) {
+            printf("Unexpected positional argument %s\n", argv[i]);
+            exit(-1);
+        }
+    }
+    return args;
+}
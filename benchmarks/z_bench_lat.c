@@ -0,0 +1,258 @@
+//
+// Copyright (c) 2024 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include "bench_common.h"
+
+#define DEFAULT_PING_NB 10000
+#define DEFAULT_WARMUP_MS 1000
+#define WARMUP_RETRY_MS 100
+
+struct args_t {
+    unsigned int number_of_pings;  // -n, --samples
+    unsigned int warmup_ms;        // -w, --warmup
+    bench_matrix_t matrix;
+};
+struct args_t parse_args(int argc, char** argv);
+
+// The pong side echoes every ping from its subscriber callback.
+void pong_callback(z_loaned_sample_t* sample, void* context) {
+    const z_loaned_publisher_t* pub = (const z_loaned_publisher_t*)context;
+    z_owned_bytes_t payload;
+    z_bytes_clone(&payload, z_sample_payload(sample));
+    z_publisher_put(pub, z_move(payload), NULL);
+}
+
+// Pongs received through a closure are signaled to the measuring thread.
+typedef struct pong_waiter_t {
+    z_owned_mutex_t mutex;
+    z_owned_condvar_t cond;
+    uint64_t received;
+} pong_waiter_t;
+
+void ping_callback(z_loaned_sample_t* sample, void* context) {
+    pong_waiter_t* waiter = (pong_waiter_t*)context;
+    z_mutex_lock(z_loan_mut(waiter->mutex));
+    waiter->received++;
+    z_condvar_signal(z_loan(waiter->cond));
+    z_mutex_unlock(z_loan_mut(waiter->mutex));
+}
+
+typedef struct ping_t {
+    const bench_case_t* c;
+    pong_waiter_t waiter;
+    z_owned_fifo_handler_sample_t handler;
+    uint64_t expected;
+} ping_t;
+
+// Discards the pongs received so far, so that the next pong answers the next ping.
+void sync_pongs(ping_t* ping) {
+    if (ping->c->channel) {
+        z_owned_sample_t sample;
+        while (z_try_recv(z_loan(ping->handler), &sample) == Z_OK) {
+            z_drop(z_move(sample));
+            ping->waiter.received++;
+        }
+        ping->expected = ping->waiter.received;
+        return;
+    }
+    z_mutex_lock(z_loan_mut(ping->waiter.mutex));
+    ping->expected = ping->waiter.received;
+    z_mutex_unlock(z_loan_mut(ping->waiter.mutex));
+}
+
+// Waits until `expected` pongs are received, blocking if `retry_ms` is 0, else polling for at most `retry_ms`.
+bool wait_pong(ping_t* ping, unsigned int retry_ms) {
+    uint64_t deadline = bench_now_ns() + (uint64_t)retry_ms * 1000000;
+    if (ping->c->channel) {
+        z_owned_sample_t sample;
+        while (true) {
+            z_result_t res = retry_ms == 0 ? z_recv(z_loan(ping->handler), &sample)
+                                           : z_try_recv(z_loan(ping->handler), &sample);
+            if (res == Z_OK) {
+                z_drop(z_move(sample));
+                if (++ping->waiter.received >= ping->expected) {
+                    return true;
+                }
+            } else if (res != Z_CHANNEL_NODATA || bench_now_ns() > deadline) {
+                return false;
+            } else {
+                z_sleep_us(10);
+            }
+        }
+    }
+    z_mutex_lock(z_loan_mut(ping->waiter.mutex));
+    while (ping->waiter.received < ping->expected) {
+        if (retry_ms == 0) {
+            z_condvar_wait(z_loan(ping->waiter.cond), z_loan_mut(ping->waiter.mutex));
+            continue;
+        }
+        z_mutex_unlock(z_loan_mut(ping->waiter.mutex));
+        if (bench_now_ns() > deadline) {
+            return false;
+        }
+        z_sleep_us(10);
+        z_mutex_lock(z_loan_mut(ping->waiter.mutex));
+    }
+    z_mutex_unlock(z_loan_mut(ping->waiter.mutex));
+    return true;
+}
+
+void run_case(const struct args_t* args, const bench_case_t* c, const z_loaned_session_t* ping_session,
+              const z_loaned_session_t* pong_session, bench_histogram_t* rtt, bool first) {
+    z_view_keyexpr_t ping_ke, pong_ke;
+    z_view_keyexpr_from_str_unchecked(&ping_ke, "bench/lat/ping");
+    z_view_keyexpr_from_str_unchecked(&pong_ke, "bench/lat/pong");
+    z_publisher_options_t opts;
+    z_publisher_options_default(&opts);
+    opts.priority = c->priority;
+    opts.is_express = c->express;
+    opts.congestion_control = Z_CONGESTION_CONTROL_BLOCK;
+
+    z_owned_publisher_t pong_pub;
+    z_declare_publisher(pong_session, &pong_pub, z_loan(pong_ke), &opts);
+    z_owned_closure_sample_t echo;
+    z_closure(&echo, pong_callback, NULL, (void*)z_loan(pong_pub));
+    z_owned_subscriber_t pong_sub;
+    z_declare_subscriber(pong_session, &pong_sub, z_loan(ping_ke), z_move(echo), NULL);
+
+    ping_t ping = {.c = c, .expected = 0};
+    ping.waiter.received = 0;
+    z_mutex_init(&ping.waiter.mutex);
+    z_condvar_init(&ping.waiter.cond);
+    z_owned_closure_sample_t on_pong;
+    if (c->channel) {
+        z_fifo_channel_sample_new(&on_pong, &ping.handler, 16);
+    } else {
+        z_closure(&on_pong, ping_callback, NULL, (void*)&ping.waiter);
+    }
+    z_owned_subscriber_t ping_sub;
+    z_declare_subscriber(ping_session, &ping_sub, z_loan(pong_ke), z_move(on_pong), NULL);
+    z_owned_publisher_t ping_pub;
+    z_declare_publisher(ping_session, &ping_pub, z_loan(ping_ke), &opts);
+
+    bench_payload_t data;
+    bench_payload_init(&data, c->payload_size, c->shm);
+    z_owned_bytes_t payload;
+
+    // pings are resent until the declarations are propagated, then the warmup goes on for `warmup_ms`
+    bench_histogram_reset(rtt);
+    uint64_t warmup_end = 0;
+    while (warmup_end == 0 || bench_now_ns() < warmup_end) {
+        ping.expected++;
+        bench_payload_make(&data, &payload);
+        z_publisher_put(z_loan(ping_pub), z_move(payload), NULL);
+        if (wait_pong(&ping, WARMUP_RETRY_MS) && warmup_end == 0) {
+            warmup_end = bench_now_ns() + (uint64_t)args->warmup_ms * 1000000;
+        }
+    }
+    // late pongs of the resent pings are discarded
+    z_sleep_ms(WARMUP_RETRY_MS);
+    sync_pongs(&ping);
+    for (unsigned int i = 0; i < args->number_of_pings; i++) {
+        ping.expected++;
+        bench_payload_make(&data, &payload);
+        uint64_t start = bench_now_ns();
+        z_publisher_put(z_loan(ping_pub), z_move(payload), NULL);
+        wait_pong(&ping, 0);
+        bench_histogram_record(rtt, bench_now_ns() - start);
+    }
+
+    bench_json_case_begin(args->matrix.out, c, first);
+    bench_json_histogram(args->matrix.out, "rtt_ns", rtt);
+    bench_json_case_end(args->matrix.out);
+    fflush(args->matrix.out);
+
+    z_drop(z_move(ping_pub));
+    z_drop(z_move(ping_sub));
+    z_drop(z_move(pong_sub));
+    z_drop(z_move(pong_pub));
+    if (c->channel) {
+        z_drop(z_move(ping.handler));
+    }
+    z_drop(z_move(ping.waiter.cond));
+    z_drop(z_move(ping.waiter.mutex));
+    bench_payload_drop(&data);
+}
+
+int main(int argc, char** argv) {
+    zc_init_log_from_env_or("error");
+
+    struct args_t args = parse_args(argc, argv);
+    const bench_matrix_t* m = &args.matrix;
+    bench_histogram_t* rtt = (bench_histogram_t*)z_malloc(sizeof(bench_histogram_t));
+    bool first = true;
+
+    bench_json_begin(m->out, "latency");
+    for (size_t shm = 0; shm < m->shm_nb; shm++) {
+        z_owned_session_t ping_session, pong_session;
+        bench_open_sessions(m->endpoint, m->shm[shm], &ping_session, &pong_session);
+        for (size_t s = 0; s < m->sizes_nb; s++) {
+            for (size_t p = 0; p < m->priorities_nb; p++) {
+                for (size_t e = 0; e < m->express_nb; e++) {
+                    for (size_t d = 0; d < m->channel_nb; d++) {
+                        bench_case_t c = {.payload_size = m->sizes[s],
+                                          .priority = m->priorities[p],
+                                          .express = m->express[e],
+                                          .channel = m->channel[d],
+                                          .shm = m->shm[shm]};
+                        run_case(&args, &c, z_loan(ping_session), z_loan(pong_session), rtt, first);
+                        first = false;
+                    }
+                }
+            }
+        }
+        z_drop(z_move(pong_session));
+        z_drop(z_move(ping_session));
+    }
+    bench_json_end(m->out);
+
+    z_free(rtt);
+    if (m->out != stdout) {
+        fclose(m->out);
+    }
+    return 0;
+}
+
+void print_help() {
+    printf(
+        "\
+    Usage: z_bench_lat [OPTIONS]\n\n\
+    Measures the round trip time between two sessions of the same process, for each combination of the parameters,\n\
+    and writes the percentiles of each combination as JSON.\n\n\
+    Options:\n\
+        -n, --samples <SAMPLES> (optional, int, default=%d): The number of measured pings per combination\n\
+        -w, --warmup <WARMUP> (optional, int, default=%d): The warmup time in ms during which pings are not measured\n",
+        DEFAULT_PING_NB, DEFAULT_WARMUP_MS);
+    printf(BENCH_HELP);
+}
+
+struct args_t parse_args(int argc, char** argv) {
+    _Z_CHECK_HELP;
+    struct args_t args;
+    _Z_PARSE_ARG(args.number_of_pings, "n", "samples", atoi, DEFAULT_PING_NB);
+    _Z_PARSE_ARG(args.warmup_ms, "w", "warmup", atoi, DEFAULT_WARMUP_MS);
+    bench_parse_matrix(argc, argv, &args.matrix);
+    const char* arg = check_unknown_opts(argc, argv);
+    if (arg) {
+        printf("Unknown option %s\n", arg);
+        exit(-1);
+    }
+    for (int i = 1; i < argc; i++) {
+        if (argv[i]) {
+            printf("Unexpected positional argument %s\n", argv[i]);
+            exit(-1);
+        }
+    }
+    return args;
+}
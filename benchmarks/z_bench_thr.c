@@ -0,0 +1,230 @@
+//
+// Copyright (c) 2024 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include "bench_common.h"
+
+#define DEFAULT_MESSAGES_NB 100000
+#define DEFAULT_MAX_BYTES_MB 512
+#define DEFAULT_ROUNDS 10
+#define ROUTING_DELAY_MS 500
+
+struct args_t {
+    unsigned int number_of_messages;  // -n, --number
+    unsigned int max_bytes_mb;        // -b, --max-bytes
+    unsigned int rounds;              // -r, --rounds
+    bench_matrix_t matrix;
+};
+struct args_t parse_args(int argc, char** argv);
+
+// Counts the samples and timestamps the end of each round. The count is only touched by the subscriber thread, the
+// round ends are protected by the mutex.
+typedef struct counter_t {
+    z_owned_mutex_t mutex;
+    z_owned_condvar_t cond;
+    uint64_t messages_per_round;
+    uint64_t received;
+    uint64_t* round_ends;
+    unsigned int rounds;
+    unsigned int completed_rounds;
+} counter_t;
+
+static void counter_on_sample(counter_t* counter) {
+    if (++counter->received % counter->messages_per_round != 0) {
+        return;
+    }
+    uint64_t now = bench_now_ns();
+    z_mutex_lock(z_loan_mut(counter->mutex));
+    if (counter->completed_rounds < counter->rounds) {
+        counter->round_ends[counter->completed_rounds++] = now;
+    }
+    z_condvar_signal(z_loan(counter->cond));
+    z_mutex_unlock(z_loan_mut(counter->mutex));
+}
+
+void callback(z_loaned_sample_t* sample, void* context) { counter_on_sample((counter_t*)context); }
+
+typedef struct drain_t {
+    counter_t* counter;
+    const z_loaned_fifo_handler_sample_t* handler;
+} drain_t;
+
+// Receives from the channel until it is closed by the subscriber undeclaration.
+void* drain_channel(void* context) {
+    drain_t* drain = (drain_t*)context;
+    z_owned_sample_t sample;
+    while (z_recv(drain->handler, &sample) == Z_OK) {
+        z_drop(z_move(sample));
+        counter_on_sample(drain->counter);
+    }
+    return NULL;
+}
+
+void run_case(const struct args_t* args, const bench_case_t* c, const z_loaned_session_t* pub_session,
+              const z_loaned_session_t* sub_session, bench_histogram_t* rates, bool first) {
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str_unchecked(&ke, "bench/thr");
+    uint64_t messages = args->number_of_messages;
+    uint64_t max_messages = (uint64_t)args->max_bytes_mb * 1024 * 1024 / (c->payload_size > 0 ? c->payload_size : 1);
+    if (messages > max_messages) {
+        messages = max_messages > 0 ? max_messages : 1;
+    }
+
+    // the first round is a warmup, which also gives the start of the first measured round
+    counter_t counter = {.messages_per_round = messages, .received = 0, .rounds = args->rounds + 1};
+    counter.round_ends = (uint64_t*)z_malloc(sizeof(uint64_t) * counter.rounds);
+    counter.completed_rounds = 0;
+    z_mutex_init(&counter.mutex);
+    z_condvar_init(&counter.cond);
+    z_owned_fifo_handler_sample_t handler;
+    z_owned_task_t task;
+    drain_t drain = {.counter = &counter};
+    z_owned_closure_sample_t on_sample;
+    if (c->channel) {
+        z_fifo_channel_sample_new(&on_sample, &handler, 1024);
+    } else {
+        z_closure(&on_sample, callback, NULL, (void*)&counter);
+    }
+    z_owned_subscriber_t sub;
+    z_declare_subscriber(sub_session, &sub, z_loan(ke), z_move(on_sample), NULL);
+    if (c->channel) {
+        drain.handler = z_loan(handler);
+        z_task_init(&task, NULL, drain_channel, &drain);
+    }
+
+    z_publisher_options_t opts;
+    z_publisher_options_default(&opts);
+    opts.priority = c->priority;
+    opts.is_express = c->express;
+    opts.congestion_control = Z_CONGESTION_CONTROL_BLOCK;
+    z_owned_publisher_t pub;
+    z_declare_publisher(pub_session, &pub, z_loan(ke), &opts);
+    z_sleep_ms(ROUTING_DELAY_MS);
+
+    bench_payload_t data;
+    bench_payload_init(&data, c->payload_size, c->shm);
+    z_owned_bytes_t payload;
+
+    // the throughput of each measured round is recorded in msg/s
+    bench_histogram_reset(rates);
+    for (unsigned int round = 0; round < counter.rounds; round++) {
+        for (uint64_t i = 0; i < messages; i++) {
+            bench_payload_make(&data, &payload);
+            z_publisher_put(z_loan(pub), z_move(payload), NULL);
+        }
+    }
+    z_mutex_lock(z_loan_mut(counter.mutex));
+    while (counter.completed_rounds < counter.rounds) {
+        z_condvar_wait(z_loan(counter.cond), z_loan_mut(counter.mutex));
+    }
+    z_mutex_unlock(z_loan_mut(counter.mutex));
+    for (unsigned int round = 1; round < counter.rounds; round++) {
+        uint64_t elapsed_ns = counter.round_ends[round] - counter.round_ends[round - 1];
+        if (elapsed_ns > 0) {
+            bench_histogram_record(rates, (uint64_t)((double)messages * 1e9 / (double)elapsed_ns));
+        }
+    }
+
+    bench_json_case_begin(args->matrix.out, c, first);
+    fprintf(args->matrix.out, ", \"messages_per_round\": %" PRIu64, messages);
+    bench_json_histogram(args->matrix.out, "msgs_per_sec", rates);
+    fprintf(args->matrix.out, ", \"mbytes_per_sec_p50\": %.3f",
+            (double)bench_histogram_percentile(rates, 50.0) * (double)c->payload_size / 1e6);
+    bench_json_case_end(args->matrix.out);
+    fflush(args->matrix.out);
+
+    z_drop(z_move(pub));
+    z_drop(z_move(sub));
+    if (c->channel) {
+        z_task_join(z_move(task));
+        z_drop(z_move(handler));
+    }
+    z_drop(z_move(counter.cond));
+    z_drop(z_move(counter.mutex));
+    z_free(counter.round_ends);
+    bench_payload_drop(&data);
+}
+
+int main(int argc, char** argv) {
+    zc_init_log_from_env_or("error");
+
+    struct args_t args = parse_args(argc, argv);
+    const bench_matrix_t* m = &args.matrix;
+    bench_histogram_t* rates = (bench_histogram_t*)z_malloc(sizeof(bench_histogram_t));
+    bool first = true;
+
+    bench_json_begin(m->out, "throughput");
+    for (size_t shm = 0; shm < m->shm_nb; shm++) {
+        z_owned_session_t pub_session, sub_session;
+        bench_open_sessions(m->endpoint, m->shm[shm], &pub_session, &sub_session);
+        for (size_t s = 0; s < m->sizes_nb; s++) {
+            for (size_t p = 0; p < m->priorities_nb; p++) {
+                for (size_t e = 0; e < m->express_nb; e++) {
+                    for (size_t d = 0; d < m->channel_nb; d++) {
+                        bench_case_t c = {.payload_size = m->sizes[s],
+                                          .priority = m->priorities[p],
+                                          .express = m->express[e],
+                                          .channel = m->channel[d],
+                                          .shm = m->shm[shm]};
+                        run_case(&args, &c, z_loan(pub_session), z_loan(sub_session), rates, first);
+                        first = false;
+                    }
+                }
+            }
+        }
+        z_drop(z_move(sub_session));
+        z_drop(z_move(pub_session));
+    }
+    bench_json_end(m->out);
+
+    z_free(rates);
+    if (m->out != stdout) {
+        fclose(m->out);
+    }
+    return 0;
+}
+
+void print_help() {
+    printf(
+        "\
+    Usage: z_bench_thr [OPTIONS]\n\n\
+    Measures the throughput between two sessions of the same process, for each combination of the parameters,\n\
+    and writes the percentiles of the throughput of each round as JSON.\n\n\
+    Options:\n\
+        -n, --number <NUMBER> (optional, int, default=%d): The number of messages per round\n\
+        -b, --max-bytes <MAX_BYTES> (optional, int, default=%d): The maximum size of a round in MiB, large payloads are sent in fewer messages\n\
+        -r, --rounds <ROUNDS> (optional, int, default=%d): The number of measured rounds, after a warmup round\n",
+        DEFAULT_MESSAGES_NB, DEFAULT_MAX_BYTES_MB, DEFAULT_ROUNDS);
+    printf(BENCH_HELP);
+}
+
+struct args_t parse_args(int argc, char** argv) {
+    _Z_CHECK_HELP;
+    struct args_t args;
+    _Z_PARSE_ARG(args.number_of_messages, "n", "number", atoi, DEFAULT_MESSAGES_NB);
+    _Z_PARSE_ARG(args.max_bytes_mb, "b", "max-bytes", atoi, DEFAULT_MAX_BYTES_MB);
+    _Z_PARSE_ARG(args.rounds, "r", "rounds", atoi, DEFAULT_ROUNDS);
+    bench_parse_matrix(argc, argv, &args.matrix);
+    const char* arg = check_unknown_opts(argc, argv);
+    if (arg) {
+        printf("Unknown option %s\n", arg);
+        exit(-1);
+    }
+    for (int i = 1; i < argc; i++) {
+        if (argv[i]) {
+            printf("Unexpected positional argument %s\n", argv[i]);
+            exit(-1);
+        }
+    }
+    return args;
+}
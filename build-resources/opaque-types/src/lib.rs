@@ -2,10 +2,14 @@
 #![allow(dead_code)]
 #![allow(deprecated)]
 use core::ffi::c_void;
-#[cfg(all(feature = "shared-memory", feature = "unstable"))]
-use std::sync::Arc;
+#[cfg(feature = "unstable")]
+use std::{
+    collections::{hash_map::DefaultHasher, HashMap},
+    hash::BuildHasherDefault,
+    sync::{RwLock, Weak},
+};
 use std::{
-    sync::{Condvar, Mutex, MutexGuard},
+    sync::{Arc, Condvar, Mutex, MutexGuard},
     thread::JoinHandle,
 };
 
@@ -83,6 +87,21 @@ get_opaque_type_data!(Vec<CSlice>, z_owned_string_array_t);
 /// A loaned string array.
 get_opaque_type_data!(Vec<CSlice>, z_loaned_string_array_t);
 
+#[cfg(feature = "unstable")]
+pub struct StringArena {
+    _data: Vec<u8>,
+    _ends: Vec<usize>,
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief An array of null-terminated strings, packed one after the other in a single owned buffer.
+get_opaque_type_data!(StringArena, zc_owned_string_arena_t);
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief A loaned string arena.
+get_opaque_type_data!(StringArena, zc_loaned_string_arena_t);
+
 /// An owned Zenoh sample.
 ///
 /// This is a read only type that can only be constructed by cloning a `z_loaned_sample_t`.
@@ -94,10 +113,49 @@ get_opaque_type_data!(Sample, z_loaned_sample_t);
 /// A reader for payload.
 get_opaque_type_data!(ZBytesReader<'static>, z_bytes_reader_t);
 
+#[cfg(feature = "unstable")]
+pub struct PooledBuf {
+    _buf: Option<Box<[u8]>>,
+    _len: usize,
+    _pool: Arc<()>,
+}
+
+pub enum WriterChunk {
+    _Heap(Vec<u8>),
+    #[cfg(feature = "unstable")]
+    _Pooled(PooledBuf),
+    #[cfg(all(feature = "shared-memory", feature = "unstable"))]
+    _Shm(ZShmMut, usize),
+}
+
+pub struct CBytesWriter {
+    _writer: ZBytesWriter,
+    _chunk: Option<WriterChunk>,
+    _next_capacity: usize,
+    #[cfg(feature = "unstable")]
+    _pool: Option<BytesPool>,
+    #[cfg(all(feature = "shared-memory", feature = "unstable"))]
+    _shm: Option<(&'static (), usize)>,
+}
+
 /// An owned writer for payload.
-get_opaque_type_data!(Option<ZBytesWriter>, z_owned_bytes_writer_t);
+get_opaque_type_data!(Option<CBytesWriter>, z_owned_bytes_writer_t);
 /// An loaned writer for payload.
-get_opaque_type_data!(ZBytesWriter, z_loaned_bytes_writer_t);
+get_opaque_type_data!(CBytesWriter, z_loaned_bytes_writer_t);
+
+#[cfg(feature = "unstable")]
+pub struct BytesPool {
+    _inner: Arc<()>,
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief An owned pool of reusable payload buffers.
+get_opaque_type_data!(Option<BytesPool>, zc_owned_bytes_pool_t);
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief A loaned pool of reusable payload buffers.
+get_opaque_type_data!(BytesPool, zc_loaned_bytes_pool_t);
 
 /// An iterator over slices of serialized data.
 get_opaque_type_data!(ZBytesSliceIterator<'static>, z_bytes_slice_iterator_t);
@@ -140,6 +198,13 @@ get_opaque_type_data!(Option<Querier>, z_owned_querier_t);
 /// A loaned Zenoh queryable.
 get_opaque_type_data!(Querier, z_loaned_querier_t);
 
+#[cfg(feature = "unstable")]
+#[allow(dead_code)]
+pub enum QueryingSubscriber {
+    Fetching(zenoh_ext::FetchingSubscriber<()>),
+    Streaming(Box<()>),
+}
+
 #[cfg(feature = "unstable")]
 /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
 /// @brief An owned Zenoh querying subscriber.
@@ -147,14 +212,14 @@ get_opaque_type_data!(Querier, z_loaned_querier_t);
 /// In addition to receiving the data it is subscribed to,
 /// it also will fetch data from a Queryable at startup and peridodically (using  `ze_querying_subscriber_get()`).
 get_opaque_type_data!(
-    Option<(zenoh_ext::FetchingSubscriber<()>, &'static Session)>,
+    Option<(QueryingSubscriber, &'static Session)>,
     ze_owned_querying_subscriber_t
 );
 #[cfg(feature = "unstable")]
 /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
 /// @brief A loaned Zenoh querying subscriber.
 get_opaque_type_data!(
-    (zenoh_ext::FetchingSubscriber<()>, &'static Session),
+    (QueryingSubscriber, &'static Session),
     ze_loaned_querying_subscriber_t
 );
 
@@ -186,23 +251,23 @@ get_opaque_type_data!(
     ze_owned_sample_miss_listener_t
 );
 
+#[cfg(feature = "unstable")]
+pub struct CAdvancedPublisher {
+    _delta: Option<DeltaEncoder>,
+    _publisher: zenoh_ext::AdvancedPublisher<'static>,
+}
+
 #[cfg(feature = "unstable")]
 /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
 /// @brief An owned Zenoh advanced publisher.
 ///
 /// In addition to publishing the data,
 /// it also maintains the storage, allowing matching subscribers to retrive missed samples.
-get_opaque_type_data!(
-    Option<zenoh_ext::AdvancedPublisher<'static>>,
-    ze_owned_advanced_publisher_t
-);
+get_opaque_type_data!(Option<CAdvancedPublisher>, ze_owned_advanced_publisher_t);
 #[cfg(feature = "unstable")]
 /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
 /// @brief A loaned Zenoh advanced publisher.
-get_opaque_type_data!(
-    zenoh_ext::AdvancedPublisher<'static>,
-    ze_loaned_advanced_publisher_t
-);
+get_opaque_type_data!(CAdvancedPublisher, ze_loaned_advanced_publisher_t);
 /// A Zenoh-allocated <a href="https://zenoh.io/docs/manual/abstractions/#key-expression"> key expression </a>.
 ///
 /// Key expressions can identify a single key or a set of keys.
@@ -234,6 +299,37 @@ get_opaque_type_data!(Option<KeyExpr<'static>>, z_view_keyexpr_t);
 /// both for local processing and network-wise.
 get_opaque_type_data!(KeyExpr<'static>, z_loaned_keyexpr_t);
 
+#[cfg(feature = "unstable")]
+pub struct KeyExprMatcher {
+    _inner: Box<()>,
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief An owned set of key expressions, precompiled for fast matching.
+get_opaque_type_data!(Option<KeyExprMatcher>, zc_owned_keyexpr_matcher_t);
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief A loaned set of key expressions, precompiled for fast matching.
+get_opaque_type_data!(KeyExprMatcher, zc_loaned_keyexpr_matcher_t);
+
+#[cfg(feature = "unstable")]
+pub struct KeyExprInterner {
+    _state: RwLock<(
+        HashMap<Box<str>, u32, BuildHasherDefault<DefaultHasher>>,
+        Vec<KeyExpr<'static>>,
+    )>,
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief An owned table assigning integer ids to key expressions.
+get_opaque_type_data!(Option<KeyExprInterner>, zc_owned_keyexpr_interner_t);
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief A loaned table assigning integer ids to key expressions.
+get_opaque_type_data!(KeyExprInterner, zc_loaned_keyexpr_interner_t);
+
 /// An owned Zenoh session.
 get_opaque_type_data!(Option<Session>, z_owned_session_t);
 /// A loaned Zenoh session.
@@ -242,7 +338,7 @@ get_opaque_type_data!(Session, z_loaned_session_t);
 #[cfg(feature = "unstable")]
 /// An owned Close handle
 get_opaque_type_data!(
-    Option<tokio::task::JoinHandle<zenoh::Result<()>>>,
+    Option<(tokio::task::JoinHandle<zenoh::Result<()>>, Arc<()>)>,
     zc_owned_concurrent_close_handle_t
 );
 
@@ -261,10 +357,55 @@ get_opaque_type_data!(ZenohId, z_id_t);
 /// It consists of a time generated by a Hybrid Logical Clock (HLC) in NPT64 format and a unique zenoh identifier.
 get_opaque_type_data!(Timestamp, z_timestamp_t);
 
+#[cfg(feature = "unstable")]
+pub struct PublisherCoalescer {
+    _shared: Arc<()>,
+    _publisher: Weak<()>,
+    _timer: Option<JoinHandle<()>>,
+}
+
+#[cfg(feature = "unstable")]
+#[repr(C)]
+pub enum CompressionAlgorithm {
+    _None,
+    _Lz4,
+}
+
+#[cfg(feature = "unstable")]
+#[repr(C)]
+pub struct PublisherCompression {
+    _algorithm: CompressionAlgorithm,
+    _min_size: usize,
+}
+
+#[cfg(feature = "unstable")]
+pub struct DeltaEncoder {
+    _stream: u64,
+    _keyframe_interval: usize,
+    _encoding: Encoding,
+    _state: Mutex<(Vec<u8>, u32, usize)>,
+}
+
+pub struct CPublisher {
+    #[cfg(feature = "unstable")]
+    _coalescer: Option<PublisherCoalescer>,
+    #[cfg(feature = "unstable")]
+    _stats: Arc<()>,
+    #[cfg(feature = "unstable")]
+    _blocking: bool,
+    #[cfg(feature = "unstable")]
+    _compression: Option<PublisherCompression>,
+    #[cfg(feature = "unstable")]
+    _delta: Option<DeltaEncoder>,
+    #[cfg(feature = "unstable")]
+    _matching: std::sync::OnceLock<Arc<()>>,
+    _publisher: Arc<Publisher<'static>>,
+}
+
 /// An owned Zenoh <a href="https://zenoh.io/docs/manual/abstractions/#publisher"> publisher </a>.
-get_opaque_type_data!(Option<Publisher<'static>>, z_owned_publisher_t);
+get_opaque_type_data!(Option<CPublisher>, z_owned_publisher_t);
 /// A loaned Zenoh publisher.
-get_opaque_type_data!(Publisher<'static>, z_loaned_publisher_t);
+get_opaque_type_data!(CPublisher, z_loaned_publisher_t);
 
 #[cfg(feature = "unstable")]
 /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
@@ -290,20 +431,33 @@ get_opaque_type_data!(Subscriber<()>, z_loaned_subscriber_t);
 get_opaque_type_data!(Option<LivelinessToken>, z_owned_liveliness_token_t);
 get_opaque_type_data!(LivelinessToken, z_loaned_liveliness_token_t);
 
+#[cfg(feature = "unstable")]
+#[allow(dead_code)]
+pub enum PublicationCache {
+    Ext(zenoh_ext::PublicationCache),
+    Local(Box<()>),
+}
+
 #[cfg(feature = "unstable")]
 /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
 /// @brief An owned Zenoh publication cache.
 ///
 /// Used to store publications on intersecting key expressions. Can be queried later via `z_get()` to retrieve this data
 /// (for example by `ze_owned_querying_subscriber_t`).
-get_opaque_type_data!(
-    Option<zenoh_ext::PublicationCache>,
-    ze_owned_publication_cache_t
-);
+get_opaque_type_data!(Option<PublicationCache>, ze_owned_publication_cache_t);
 #[cfg(feature = "unstable")]
 /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
 /// @brief A loaned Zenoh publication cache.
-get_opaque_type_data!(zenoh_ext::PublicationCache, ze_loaned_publication_cache_t);
+get_opaque_type_data!(PublicationCache, ze_loaned_publication_cache_t);
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief An owned memory budget shared by publication caches.
+get_opaque_type_data!(Option<Arc<()>>, ze_owned_cache_budget_t);
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief A loaned memory budget shared by publication caches.
+get_opaque_type_data!(Arc<()>, ze_loaned_cache_budget_t);
 
 /// An owned mutex.
 get_opaque_type_data!(
@@ -323,8 +477,79 @@ get_opaque_type_data!(Option<Condvar>, z_owned_condvar_t);
 /// A loaned conditional variable.
 get_opaque_type_data!(Condvar, z_loaned_condvar_t);
 
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief An owned reader-writer lock.
+get_opaque_type_data!(Option<parking_lot::RawRwLock>, z_owned_rwlock_t);
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief A loaned reader-writer lock.
+get_opaque_type_data!(parking_lot::RawRwLock, z_loaned_rwlock_t);
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief An owned mutex spinning for a short while before parking the waiting threads.
+get_opaque_type_data!(Option<parking_lot::RawMutex>, z_owned_adaptive_mutex_t);
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief A loaned mutex spinning for a short while before parking the waiting threads.
+get_opaque_type_data!(parking_lot::RawMutex, z_loaned_adaptive_mutex_t);
+
+#[cfg(feature = "unstable")]
+pub struct Semaphore {
+    _permits: std::sync::atomic::AtomicUsize,
+    _waiters: std::sync::atomic::AtomicUsize,
+    _lock: Mutex<()>,
+    _available: Condvar,
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief An owned counting semaphore.
+get_opaque_type_data!(Option<Semaphore>, z_owned_semaphore_t);
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief A loaned counting semaphore.
+get_opaque_type_data!(Semaphore, z_loaned_semaphore_t);
+
+pub enum Task {
+    _Thread(JoinHandle<()>),
+    #[cfg(feature = "unstable")]
+    _Executor(Arc<()>),
+}
+
 /// An owned Zenoh task.
-get_opaque_type_data!(Option<JoinHandle<()>>, z_owned_task_t);
+get_opaque_type_data!(Option<Task>, z_owned_task_t);
+
+#[cfg(feature = "unstable")]
+pub struct Executor {
+    _state: Arc<()>,
+    _threads: Vec<JoinHandle<()>>,
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief An owned executor, a pool of worker threads running short tasks.
+get_opaque_type_data!(Option<Arc<Executor>>, z_owned_executor_t);
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief A loaned executor.
+get_opaque_type_data!(Arc<Executor>, z_loaned_executor_t);
+
+#[cfg(feature = "unstable")]
+pub struct CancellationToken {
+    _cancelled: bool,
+    _callbacks: Mutex<Vec<()>>,
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief An owned cancellation token, cancelling the queries it is passed to.
+get_opaque_type_data!(Option<Arc<CancellationToken>>, z_owned_cancellation_token_t);
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief A loaned cancellation token.
+get_opaque_type_data!(Arc<CancellationToken>, z_loaned_cancellation_token_t);
 
 /// An owned Zenoh-allocated hello message returned by a Zenoh entity to a scout message sent with `z_scout()`.
 get_opaque_type_data!(Option<Hello>, z_owned_hello_t);
@@ -336,6 +561,19 @@ get_opaque_type_data!(Hello, z_loaned_hello_t);
 /// @brief An owned SHM Client.
 get_opaque_type_data!(Option<Arc<dyn ShmClient>>, z_owned_shm_client_t);
 #[cfg(all(feature = "shared-memory", feature = "unstable"))]
+pub struct ShmSegmentCache {
+    _client: Arc<dyn ShmClient>,
+    _state: Mutex<()>,
+}
+#[cfg(all(feature = "shared-memory", feature = "unstable"))]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief An owned cache of the segments attached by an SHM Client.
+get_opaque_type_data!(Option<Arc<ShmSegmentCache>>, zc_owned_shm_client_cache_t);
+#[cfg(all(feature = "shared-memory", feature = "unstable"))]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief A loaned cache of the segments attached by an SHM Client.
+get_opaque_type_data!(Arc<ShmSegmentCache>, zc_loaned_shm_client_cache_t);
+#[cfg(all(feature = "shared-memory", feature = "unstable"))]
 /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
 /// @brief An owned list of SHM Clients.
 get_opaque_type_data!(
@@ -442,6 +680,38 @@ impl ShmProviderBackend for DummySHMProviderBackend {
 #[cfg(all(feature = "shared-memory", feature = "unstable"))]
 type DummySHMProvider = ShmProvider<DynamicProtocolID, DummySHMProviderBackend>;
 
+#[cfg(all(feature = "shared-memory", feature = "unstable"))]
+#[derive(Debug)]
+struct DummyBoxedSHMProviderBackend {
+    _inner: Box<dyn core::fmt::Debug + Send + Sync>,
+}
+
+#[cfg(all(feature = "shared-memory", feature = "unstable"))]
+impl ShmProviderBackend for DummyBoxedSHMProviderBackend {
+    fn alloc(&self, _layout: &MemoryLayout) -> ChunkAllocResult {
+        todo!()
+    }
+
+    fn free(&self, _chunk: &ChunkDescriptor) {
+        todo!()
+    }
+
+    fn defragment(&self) -> usize {
+        todo!()
+    }
+
+    fn available(&self) -> usize {
+        todo!()
+    }
+
+    fn layout_for(&self, _layout: MemoryLayout) -> Result<MemoryLayout, ZLayoutError> {
+        todo!()
+    }
+}
+
+#[cfg(all(feature = "shared-memory", feature = "unstable"))]
+type DummyBoxedSHMProvider = ShmProvider<DynamicProtocolID, DummyBoxedSHMProviderBackend>;
+
 #[cfg(all(feature = "shared-memory", feature = "unstable"))]
 type PosixSHMProvider = ShmProvider<StaticProtocolID<POSIX_PROTOCOL_ID>, PosixShmProviderBackend>;
 
@@ -449,6 +719,8 @@ type PosixSHMProvider = ShmProvider<StaticProtocolID<POSIX_PROTOCOL_ID>, PosixSh
 enum CDummySHMProvider {
     Posix(PosixSHMProvider),
     Dynamic(DummySHMProvider),
+    Boxed(DummyBoxedSHMProvider),
+    Stats(DummyBoxedSHMProvider, Arc<()>),
 }
 
 #[cfg(all(feature = "shared-memory", feature = "unstable"))]
@@ -467,10 +739,15 @@ type PosixAllocLayout =
 #[cfg(all(feature = "shared-memory", feature = "unstable"))]
 type DummyDynamicAllocLayout = AllocLayout<'static, DynamicProtocolID, DummySHMProviderBackend>;
 
+#[cfg(all(feature = "shared-memory", feature = "unstable"))]
+type DummyBoxedAllocLayout = AllocLayout<'static, DynamicProtocolID, DummyBoxedSHMProviderBackend>;
+
 #[cfg(all(feature = "shared-memory", feature = "unstable"))]
 enum CSHMLayout {
     Posix(PosixAllocLayout),
     Dynamic(DummyDynamicAllocLayout),
+    Boxed(DummyBoxedAllocLayout),
+    Stats(DummyBoxedAllocLayout, Arc<()>),
 }
 
 #[cfg(all(feature = "shared-memory", feature = "unstable"))]
@@ -482,6 +759,20 @@ get_opaque_type_data!(Option<CSHMLayout>, z_owned_alloc_layout_t);
 /// @brief A loaned ShmProvider's AllocLayout.
 get_opaque_type_data!(CSHMLayout, z_loaned_alloc_layout_t);
 
+#[cfg(all(feature = "shared-memory", feature = "unstable"))]
+pub struct ShmCompletionQueue {
+    _inner: Arc<()>,
+}
+
+#[cfg(all(feature = "shared-memory", feature = "unstable"))]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief An owned queue of completed SHM allocations.
+get_opaque_type_data!(Option<ShmCompletionQueue>, zc_owned_shm_completion_queue_t);
+#[cfg(all(feature = "shared-memory", feature = "unstable"))]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief A loaned queue of completed SHM allocations.
+get_opaque_type_data!(ShmCompletionQueue, zc_loaned_shm_completion_queue_t);
+
 /// An owned Zenoh fifo sample handler.
 get_opaque_type_data!(
     Option<FifoChannelHandler<Sample>>,
@@ -498,6 +789,71 @@ get_opaque_type_data!(
 /// An loaned Zenoh ring sample handler.
 get_opaque_type_data!(RingChannelHandler<Sample>, z_loaned_ring_handler_sample_t);
 
+#[cfg(feature = "unstable")]
+pub struct SpscChannelHandler {
+    _ring: Arc<()>,
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief An owned Zenoh single-producer/single-consumer sample handler.
+get_opaque_type_data!(Option<SpscChannelHandler>, z_owned_spsc_handler_sample_t);
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief An loaned Zenoh single-producer/single-consumer sample handler.
+get_opaque_type_data!(SpscChannelHandler, z_loaned_spsc_handler_sample_t);
+
+#[cfg(feature = "unstable")]
+pub struct CreditChannelHandler {
+    _queue: Arc<()>,
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief An owned Zenoh flow-controlled reply handler.
+get_opaque_type_data!(Option<CreditChannelHandler>, z_owned_credit_handler_reply_t);
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief An loaned Zenoh flow-controlled reply handler.
+get_opaque_type_data!(CreditChannelHandler, z_loaned_credit_handler_reply_t);
+
+#[cfg(feature = "unstable")]
+pub struct ConflatingChannelHandler {
+    _queue: Arc<()>,
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief An owned Zenoh sample handler keeping the latest sample of each key expression.
+get_opaque_type_data!(
+    Option<ConflatingChannelHandler>,
+    z_owned_conflating_handler_sample_t
+);
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief A loaned Zenoh sample handler keeping the latest sample of each key expression.
+get_opaque_type_data!(
+    ConflatingChannelHandler,
+    z_loaned_conflating_handler_sample_t
+);
+
+#[cfg(feature = "unstable")]
+pub struct PriorityChannelHandler {
+    _queue: Arc<()>,
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief An owned Zenoh sample handler with a queue per sample priority.
+get_opaque_type_data!(
+    Option<PriorityChannelHandler>,
+    z_owned_priority_handler_sample_t
+);
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief A loaned Zenoh sample handler with a queue per sample priority.
+get_opaque_type_data!(PriorityChannelHandler, z_loaned_priority_handler_sample_t);
+
 /// An owned Zenoh fifo query handler.
 get_opaque_type_data!(
     Option<FifoChannelHandler<Query>>,
@@ -40,6 +40,7 @@ const HEADER: &str = r"//
 static RUST_TO_C_FEATURES: phf::Map<&'static str, &'static str> = phf_map! {
     "unstable" => "Z_FEATURE_UNSTABLE_API",
     "shared-memory" => "Z_FEATURE_SHARED_MEMORY",
+    "alloc-stats" => "Z_FEATURE_ALLOC_STATS",
     "auth_pubkey" => "Z_FEATURE_AUTH_PUBKEY",
     "auth_usrpwd" => "Z_FEATURE_AUTH_USRPWD",
     "transport_multilink" => "Z_FEATURE_TRANSPORT_MULTILINK",
@@ -1787,6 +1788,8 @@ fn test_feature(feature: &str) -> bool {
         "shared-memory" => true,
         #[cfg(feature = "unstable")]
         "unstable" => true,
+        #[cfg(feature = "alloc-stats")]
+        "alloc-stats" => true,
         #[cfg(feature = "auth_pubkey")]
         "auth_pubkey" => true,
         #[cfg(feature = "auth_usrpwd")]
@@ -41,8 +41,8 @@ void miss_handler(const ze_miss_t* miss, void* arg) {
     z_id_t id = z_entity_global_id_zid(&miss->source);
     z_owned_string_t id_string;
     z_id_to_string(&id, &id_string);
-    printf(">> [Subscriber] Missed %d samples from '%.*s' !!!", miss->nb, (int)z_string_len(z_loan(id_string)),
-           z_string_data(z_loan(id_string)));
+    printf(">> [Subscriber] Missed %d samples from '%.*s' (%llu in total) !!!", miss->nb,
+           (int)z_string_len(z_loan(id_string)), z_string_data(z_loan(id_string)), (unsigned long long)miss->total_nb);
     z_drop(z_move(id_string));
 }
 
@@ -35,4 +35,5 @@ extern "C" {
 #endif
 #include "zenoh_macros.h"
 #include "zenoh_memory.h"
+#include "zenoh_clock.h"
 #endif
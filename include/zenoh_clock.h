@@ -0,0 +1,42 @@
+#pragma once
+#include <stdint.h>
+
+#if defined(Z_FEATURE_UNSTABLE_API)
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+#include <intrin.h>
+#elif defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+/*------------------ CPU counter ------------------*/
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Reads the CPU counter calibrated by `zc_clock_tsc_calibrate()`, without calling into the library.
+ *
+ * @return The ticks of the counter, or 0 if the platform has no such counter.
+ */
+static inline uint64_t zc_clock_tsc_read(void) {
+#if defined(_MSC_VER) && defined(_M_X64)
+    return __rdtsc();
+#elif defined(_MSC_VER) && defined(_M_ARM64)
+    return (uint64_t)_ReadStatusReg(ARM64_CNTVCT);
+#elif defined(__x86_64__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t ticks;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(ticks));
+    return ticks;
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns the number of nanoseconds between two reads of `zc_clock_tsc_read()`.
+ */
+static inline uint64_t zc_clock_tsc_elapsed_ns(const zc_clock_tsc_calibration_t *calibration, uint64_t start,
+                                               uint64_t end) {
+    return end > start ? (uint64_t)((double)(end - start) * calibration->ns_per_tick) : 0;
+}
+#endif
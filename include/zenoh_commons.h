@@ -169,6 +169,65 @@ typedef enum z_whatami_t {
   Z_WHATAMI_PEER = 2,
   Z_WHATAMI_CLIENT = 4,
 } z_whatami_t;
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief A snapshot of the heap allocation counters of the process, see `zc_alloc_stats_get()`.
+ *
+ * Counters are cumulative since the library was loaded, a reallocation counting as an allocation of its new size.
+ */
+#if defined(Z_FEATURE_ALLOC_STATS)
+typedef struct zc_alloc_stats_t {
+  /**
+   * Number of heap allocations.
+   */
+  uint64_t allocations;
+  /**
+   * Number of heap deallocations.
+   */
+  uint64_t deallocations;
+  /**
+   * Number of bytes allocated.
+   */
+  uint64_t allocated_bytes;
+} zc_alloc_stats_t;
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief The calibration of the CPU counter read by `zc_clock_tsc_read()`, i.e. the TSC on x86_64 and the virtual
+ * counter `CNTVCT_EL0` on aarch64.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct zc_clock_tsc_calibration_t {
+  /**
+   * The duration of a tick of the counter, in nanoseconds.
+   */
+  double ns_per_tick;
+  /**
+   * The value of the counter at the end of the calibration.
+   */
+  uint64_t ticks_base;
+  /**
+   * The system time at the end of the calibration, in nanoseconds since the UNIX epoch.
+   */
+  uint64_t unix_ns_base;
+} zc_clock_tsc_calibration_t;
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief The compression algorithm of a payload.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef enum zc_compression_t {
+  /**
+   * The payload is not compressed.
+   */
+  ZC_COMPRESSION_NONE = 0,
+  /**
+   * The payload is compressed with LZ4, prefixed with its uncompressed length as a 32-bit little-endian integer.
+   */
+  ZC_COMPRESSION_LZ4 = 1,
+} zc_compression_t;
+#endif
 /**
  * The locality of samples to be received by subscribers or targeted by publishers.
  */
@@ -221,6 +280,67 @@ typedef enum zc_log_severity_t {
    */
   ZC_LOG_SEVERITY_ERROR = 4,
 } zc_log_severity_t;
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief What a priority channel does with a sample received for a level whose queue is full.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef enum zc_priority_overflow_t {
+  /**
+   * Drops the oldest sample of the level to queue the new one, as a ring channel does.
+   */
+  ZC_PRIORITY_OVERFLOW_DROP_OLDEST = 0,
+  /**
+   * Drops the new sample.
+   */
+  ZC_PRIORITY_OVERFLOW_DROP_NEWEST = 1,
+  /**
+   * Blocks the callback until a sample of the level is received, as a FIFO channel does. This also delays
+   * the samples of all the other levels delivered by the same thread, so it is meant for levels whose samples
+   * may not be lost.
+   */
+  ZC_PRIORITY_OVERFLOW_BLOCK = 2,
+} zc_priority_overflow_t;
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief The settings of one priority level of a priority channel.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct zc_priority_level_options_t {
+  /**
+   * The maximum number of pending samples of the level, 0 to drop all samples of the level.
+   */
+  size_t capacity;
+  /**
+   * What to do with a sample received while the queue of the level is full.
+   */
+  enum zc_priority_overflow_t overflow;
+  /**
+   * The number of consecutive samples of the level received in its turn when `weighted` is set, 0 is treated as 1.
+   */
+  uint32_t weight;
+} zc_priority_level_options_t;
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Options passed to `z_priority_channel_sample_new()`.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct zc_priority_channel_options_t {
+  /**
+   * The settings of each priority level, `levels[0]` for `Z_PRIORITY_REAL_TIME` up to `levels[6]` for
+   * `Z_PRIORITY_BACKGROUND`.
+   */
+  struct zc_priority_level_options_t levels[7];
+  /**
+   * If ``false``, a sample is only received once all the samples of the higher levels are received. If ``true``,
+   * the levels with pending samples are served in turn, each receiving up to `weight` samples per turn, so that
+   * the lower levels are never starved.
+   */
+  bool weighted;
+} zc_priority_channel_options_t;
+#endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
  * @brief Key expressions types to which Queryable should reply to.
@@ -237,6 +357,53 @@ typedef enum zc_reply_keyexpr_t {
   ZC_REPLY_KEYEXPR_MATCHING_QUERY = 1,
 } zc_reply_keyexpr_t;
 #endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief The operation timed by a span.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef enum zc_span_kind_t {
+  /**
+   * A put or delete through a publisher, from the call until the message is enqueued for transmission.
+   */
+  ZC_SPAN_KIND_PUT = 0,
+  /**
+   * A sample received by a subscriber, from the entry to the exit of its callback.
+   */
+  ZC_SPAN_KIND_SAMPLE_CALLBACK = 1,
+  /**
+   * A query received by a queryable, from the entry to the exit of its callback. For queryables with worker
+   * threads, the time to dispatch the query to a worker.
+   */
+  ZC_SPAN_KIND_QUERY_CALLBACK = 2,
+} zc_span_kind_t;
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief The type of a field of a fixed-layout struct, see `ze_field_t`.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef enum ze_field_type_t {
+  ZE_FIELD_TYPE_UINT8 = 0,
+  ZE_FIELD_TYPE_UINT16 = 1,
+  ZE_FIELD_TYPE_UINT32 = 2,
+  ZE_FIELD_TYPE_UINT64 = 3,
+  ZE_FIELD_TYPE_INT8 = 4,
+  ZE_FIELD_TYPE_INT16 = 5,
+  ZE_FIELD_TYPE_INT32 = 6,
+  ZE_FIELD_TYPE_INT64 = 7,
+  ZE_FIELD_TYPE_FLOAT = 8,
+  ZE_FIELD_TYPE_DOUBLE = 9,
+  ZE_FIELD_TYPE_BOOL = 10,
+  /**
+   * An array of `len` bytes, serialized as a slice.
+   */
+  ZE_FIELD_TYPE_BYTES = 11,
+} ze_field_type_t;
+#endif
+typedef struct z_moved_adaptive_mutex_t {
+  struct z_owned_adaptive_mutex_t _this;
+} z_moved_adaptive_mutex_t;
 typedef struct z_moved_alloc_layout_t {
   struct z_owned_alloc_layout_t _this;
 } z_moved_alloc_layout_t;
@@ -265,6 +432,9 @@ typedef struct ALIGN(8) z_bytes_slice_iterator_t {
 typedef struct z_moved_bytes_writer_t {
   struct z_owned_bytes_writer_t _this;
 } z_moved_bytes_writer_t;
+typedef struct z_moved_cancellation_token_t {
+  struct z_owned_cancellation_token_t _this;
+} z_moved_cancellation_token_t;
 typedef struct z_moved_chunk_alloc_result_t {
   struct z_owned_chunk_alloc_result_t _this;
 } z_moved_chunk_alloc_result_t;
@@ -383,6 +553,12 @@ typedef struct z_moved_condvar_t {
 typedef struct z_moved_config_t {
   struct z_owned_config_t _this;
 } z_moved_config_t;
+typedef struct z_moved_conflating_handler_sample_t {
+  struct z_owned_conflating_handler_sample_t _this;
+} z_moved_conflating_handler_sample_t;
+typedef struct z_moved_credit_handler_reply_t {
+  struct z_owned_credit_handler_reply_t _this;
+} z_moved_credit_handler_reply_t;
 /**
  * Options passed to the `z_declare_queryable()` function.
  */
@@ -391,6 +567,33 @@ typedef struct z_queryable_options_t {
    * The completeness of the Queryable.
    */
   bool complete;
+#if defined(Z_FEATURE_UNSTABLE_API)
+  /**
+   * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+   * @brief The number of dedicated worker threads running the queryable callback. If 0 (default), the callback is
+   * run inline on the zenoh runtime thread which received the query.
+   *
+   * Queries on the same key expression are always dispatched to the same worker, so that they are processed in order.
+   */
+  size_t worker_threads;
+#endif
+#if defined(Z_FEATURE_UNSTABLE_API)
+  /**
+   * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+   * @brief The maximal number of queries waiting for each worker thread, ignored if `worker_threads` is 0.
+   * A query received while the queue of its worker is full is rejected with an error reply.
+   */
+  size_t worker_queue_size;
+#endif
+#if defined(Z_FEATURE_UNSTABLE_API)
+  /**
+   * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+   * @brief The executor running the workers, ignored if `worker_threads` is 0. If NULL (default), each worker is a
+   * dedicated thread. Otherwise `worker_threads` is the number of workers run by the executor, each of them
+   * processing its queries in order, and the executor is kept until the queryable is dropped.
+   */
+  const struct z_loaned_executor_t *worker_executor;
+#endif
 } z_queryable_options_t;
 /**
  * Options passed to the `z_declare_subscriber()` function.
@@ -409,10 +612,222 @@ typedef struct z_subscriber_options_t {
    */
   enum zc_locality_t allowed_origin;
 #endif
+#if defined(Z_FEATURE_UNSTABLE_API)
+  /**
+   * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+   * @brief The number of dedicated worker threads running the subscriber callback. If 0 (default), the callback is
+   * run inline on the zenoh runtime thread which received the sample.
+   *
+   * Samples on the same key expression are always dispatched to the same worker, so that they are delivered in
+   * order, while samples on different key expressions are delivered in parallel. The callback must therefore
+   * support being called concurrently. It is dropped by the last worker, once the samples queued before the
+   * undeclaration of the subscriber are delivered.
+   *
+   * The workers replace the delivery through `zc_session_poll()` of sessions with deferred callbacks.
+   */
+  size_t worker_threads;
+#endif
+#if defined(Z_FEATURE_UNSTABLE_API)
+  /**
+   * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+   * @brief The maximal number of samples waiting for each worker thread, ignored if `worker_threads` is 0.
+   * A sample received while the queue of its worker is full is dropped, and counted as rejected in the statistics
+   * of the subscriber.
+   */
+  size_t worker_queue_size;
+#endif
+#if defined(Z_FEATURE_UNSTABLE_API)
+  /**
+   * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+   * @brief If ``true``, samples are dispatched to the workers by source id (see `z_source_info_id()`) rather than by
+   * key expression, so that the samples of each publisher are delivered in order. Samples without a source id are
+   * still dispatched by key expression.
+   */
+  bool worker_shard_by_source;
+#endif
+#if defined(Z_FEATURE_UNSTABLE_API)
+  /**
+   * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+   * @brief The executor running the workers, ignored if `worker_threads` is 0. If NULL (default), each worker is a
+   * dedicated thread. Otherwise `worker_threads` is the number of workers run by the executor, each of them
+   * delivering its samples in order, and the executor is kept until the subscriber is dropped.
+   */
+  const struct z_loaned_executor_t *worker_executor;
+#endif
+#if defined(Z_FEATURE_UNSTABLE_API)
+  /**
+   * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+   * @brief If ``true``, the payloads of the publishers in delta mode (see `zc_publisher_delta_options_t`) are rebuilt
+   * before the callback runs, the samples being delivered with their full payload and original encoding. The last
+   * keyframe of each publisher is kept until the subscriber is dropped, and the deltas of a missed keyframe are
+   * dropped. Other samples are delivered as they are.
+   */
+  bool delta_decoding;
+#endif
 } z_subscriber_options_t;
 typedef struct z_moved_encoding_t {
   struct z_owned_encoding_t _this;
 } z_moved_encoding_t;
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief The distribution of the durations of the callbacks of a subscriber or a queryable.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct zc_callback_histogram_t {
+  /**
+   * The number of callbacks per duration: `buckets[0]` counts the callbacks which took less than 1024 ns,
+   * `buckets[i]` the ones which took between `2^(9+i)` and `2^(10+i)` ns, and the last bucket all longer ones.
+   */
+  uint64_t buckets[32];
+} zc_callback_histogram_t;
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Counters of the messages handled by an entity since its declaration.
+ *
+ * The counters are updated with relaxed atomic operations, so a snapshot is not guaranteed to be consistent
+ * across fields while messages are in flight.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct zc_entity_stats_t {
+  /**
+   * The number of messages sent by a publisher, or of samples and queries received by a subscriber or a queryable.
+   */
+  uint64_t messages;
+  /**
+   * The total size of the payloads of the messages.
+   */
+  uint64_t bytes;
+  /**
+   * The number of messages which were not delivered: puts that failed for a publisher, queries rejected
+   * by a full worker queue for a queryable.
+   */
+  uint64_t dropped;
+  /**
+   * The time spent in the puts and deletes of a publisher with `Z_CONGESTION_CONTROL_BLOCK`, which includes the time
+   * they were blocked by congestion. Always 0 for other entities.
+   */
+  uint64_t blocked_time_ns;
+} zc_entity_stats_t;
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief An interned encoding, obtained with `zc_encoding_intern()`.
+ *
+ * Interned encodings are never freed: a pointer to an interned encoding stays valid until the end of the process,
+ * and can be shared between threads without being cloned or dropped.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct zc_interned_encoding_t {
+  /**
+   * The id of the encoding in the process, starting from 0 and incremented by one for each new encoding.
+   */
+  uint32_t id;
+  /**
+   * The 64-bit FNV-1a hash of the schema of the encoding, 0 if it has no schema. It is the same across processes,
+   * so that it can be used to identify a schema in a message.
+   */
+  uint64_t schema_hash;
+  /**
+   * The encoding.
+   */
+  const struct z_loaned_encoding_t *encoding;
+} zc_interned_encoding_t;
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief The options for `zc_liveliness_declare_snapshot_subscriber()`.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct zc_liveliness_snapshot_subscriber_options_t {
+  /**
+   * The timeout of the liveliness query building the snapshot in milliseconds, 0 for the default query timeout
+   * from the zenoh configuration.
+   */
+  uint64_t timeout_ms;
+} zc_liveliness_snapshot_subscriber_options_t;
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Settings of the publisher coalescing mode.
+ *
+ * In coalescing mode, messages put by the publisher are kept pending, and sent back to back once one of the limits
+ * below is reached, whichever comes first, or when `z_publisher_flush()` is called. This allows the transport to pack
+ * them into fewer frames, at the cost of an increased latency.
+ * If all limits are set to 0, pending messages are only sent by `z_publisher_flush()`, when a delete is issued, or when
+ * the publisher is undeclared.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct zc_publisher_coalesce_options_t {
+  /**
+   * Must be set to ``true``, to enable the coalescing mode.
+   */
+  bool is_enabled;
+  /**
+   * Send pending messages once their total payload size reaches this number of bytes, 0 means no limit.
+   */
+  size_t max_bytes;
+  /**
+   * Send pending messages once their number reaches this value, 0 means no limit.
+   */
+  size_t max_messages;
+  /**
+   * Send pending messages at most this number of microseconds after the oldest of them was put, 0 means no deadline.
+   */
+  uint64_t deadline_us;
+} zc_publisher_coalesce_options_t;
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Settings of the payload compression of a publisher.
+ *
+ * A compressed payload is marked by prepending `zc-lz4` to the schema of its encoding, e.g. `application/json`
+ * becomes `application/json;zc-lz4` and `application/protobuf;my.Message` becomes
+ * `application/protobuf;zc-lz4:my.Message`, so that subscribers can tell compressed payloads apart with
+ * `zc_sample_compression()` and decompress them with `zc_sample_payload_decompressed()`.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct zc_publisher_compression_options_t {
+  /**
+   * The compression algorithm, `NONE` to send payloads as they are.
+   */
+  enum zc_compression_t algorithm;
+  /**
+   * The minimal size of the payloads to compress, smaller ones being sent as they are. A payload is also sent
+   * as it is if it does not get smaller once compressed.
+   */
+  size_t min_size;
+} zc_publisher_compression_options_t;
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Settings of the delta mode of a publisher.
+ *
+ * In delta mode, the publisher periodically sends its payload in full as a keyframe, and sends the payloads put in
+ * between as the bytes differing from the last keyframe. A delta is sent as a keyframe if it would not be smaller than
+ * the payload. Since each delta only depends on the last keyframe, a subscriber which misses deltas rebuilds the
+ * following ones, and one which misses a keyframe drops the deltas up to the next one.
+ *
+ * The payloads are marked by prepending `zc-delta` to the schema of their encoding, like the compressed ones, and
+ * rebuilt by the subscribers declared with `z_subscriber_options_t::delta_decoding` before their callback runs.
+ * Payload compression is not applied in delta mode. With an advanced publisher, the cache should hold at least
+ * `keyframe_interval` samples, so that the history retrieved by late joiners starts with a keyframe.
+ *
+ * Concurrent puts on a publisher in delta mode are sent one at a time, so that no delta is sent before its keyframe.
+ * Hence the callbacks of subscribers of the same session receiving them must not put on this publisher.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct zc_publisher_delta_options_t {
+  /**
+   * Must be set to ``true``, to enable the delta mode.
+   */
+  bool is_enabled;
+  /**
+   * The number of payloads put from a keyframe to the next one, 0 or 1 to only send keyframes.
+   */
+  size_t keyframe_interval;
+} zc_publisher_delta_options_t;
+#endif
 /**
  * Options passed to the `z_declare_publisher()` function.
  */
@@ -449,6 +864,30 @@ typedef struct z_publisher_options_t {
    */
   enum zc_locality_t allowed_destination;
 #endif
+#if defined(Z_FEATURE_UNSTABLE_API)
+  /**
+   * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+   *
+   * Settings of the coalescing mode of this publisher. Ignored by `ze_declare_advanced_publisher()`.
+   */
+  struct zc_publisher_coalesce_options_t coalesce;
+#endif
+#if defined(Z_FEATURE_UNSTABLE_API)
+  /**
+   * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+   *
+   * Settings of the payload compression of this publisher. Ignored by `ze_declare_advanced_publisher()`.
+   */
+  struct zc_publisher_compression_options_t compression;
+#endif
+#if defined(Z_FEATURE_UNSTABLE_API)
+  /**
+   * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+   *
+   * Settings of the delta mode of this publisher.
+   */
+  struct zc_publisher_delta_options_t delta;
+#endif
 } z_publisher_options_t;
 /**
  * The replies consolidation strategy to apply on replies to a `z_get()`.
@@ -541,6 +980,26 @@ typedef struct z_delete_options_t {
   enum zc_locality_t allowed_destination;
 #endif
 } z_delete_options_t;
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Options passed to `z_executor_new()`.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct z_executor_options_t {
+  /**
+   * The number of worker threads, 0 for the number of CPUs available to the process.
+   */
+  size_t worker_threads;
+  /**
+   * If not 0, worker `i` is pinned to the `i`-th CPU set in the mask, bit `j` standing for CPU `j`, wrapping around
+   * when there are more workers than CPUs in the mask. Only supported on Linux.
+   */
+  uint64_t cpu_affinity_mask;
+} z_executor_options_t;
+#endif
+typedef struct z_moved_executor_t {
+  struct z_owned_executor_t _this;
+} z_moved_executor_t;
 typedef struct z_moved_fifo_handler_query_t {
   struct z_owned_fifo_handler_query_t _this;
 } z_moved_fifo_handler_query_t;
@@ -553,6 +1012,30 @@ typedef struct z_moved_fifo_handler_sample_t {
 typedef struct z_moved_source_info_t {
   struct z_owned_source_info_t _this;
 } z_moved_source_info_t;
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Statistics of the local consolidation of the replies to a query, see `z_get_options_t::consolidation_stats`.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct zc_reply_consolidation_stats_t {
+  /**
+   * Number of replies received.
+   */
+  uint64_t replies_received;
+  /**
+   * Number of replies dropped because a more recent reply (or one as recent) was received for the same key expression.
+   */
+  uint64_t replies_dropped;
+  /**
+   * Number of distinct key expressions among the replies.
+   */
+  uint64_t keys;
+  /**
+   * Total time spent consolidating the replies, in nanoseconds.
+   */
+  uint64_t consolidation_ns;
+} zc_reply_consolidation_stats_t;
+#endif
 /**
  * Options passed to the `z_get()` function.
  */
@@ -617,20 +1100,68 @@ typedef struct z_get_options_t {
    * The timeout for the query in milliseconds. 0 means default query timeout from zenoh configuration.
    */
   uint64_t timeout_ms;
-} z_get_options_t;
-typedef struct z_moved_hello_t {
-  struct z_owned_hello_t _this;
-} z_moved_hello_t;
-typedef struct z_moved_keyexpr_t {
-  struct z_owned_keyexpr_t _this;
-} z_moved_keyexpr_t;
-/**
- * @brief The options for `z_liveliness_declare_subscriber()`
- */
-typedef struct z_liveliness_subscriber_options_t {
+#if defined(Z_FEATURE_UNSTABLE_API)
   /**
-   * If true, subscriber will receive the state change notifications for liveliness tokens that were declared before its declaration.
-   */
+   * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+   *
+   * The expected number of distinct key expressions among the replies. If non-zero, and the consolidation mode is
+   * `Z_CONSOLIDATION_MODE_LATEST` or `Z_CONSOLIDATION_MODE_MONOTONIC`, the replies are consolidated locally in a table
+   * pre-sized for this number of keys, instead of by the zenoh runtime. Note that the replies are then not
+   * consolidated by the routers on their way.
+   */
+  size_t consolidation_capacity;
+#endif
+#if defined(Z_FEATURE_UNSTABLE_API)
+  /**
+   * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+   *
+   * An optional location where the consolidation statistics of the query will be written, once all replies
+   * are processed, right before the reply callback is dropped. It must stay valid until then. Setting it enables
+   * local consolidation, as for `consolidation_capacity`, for `Z_CONSOLIDATION_MODE_LATEST`,
+   * `Z_CONSOLIDATION_MODE_MONOTONIC` and `Z_CONSOLIDATION_MODE_NONE`; it is ignored with other modes.
+   * Only used by `z_get()`.
+   */
+  struct zc_reply_consolidation_stats_t *consolidation_stats;
+#endif
+#if defined(Z_FEATURE_UNSTABLE_API)
+  /**
+   * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+   *
+   * An optional cancellation token, see `z_cancellation_token_new()`. Once it is cancelled, the reply callback is
+   * dropped without waiting for the query to be finalized.
+   */
+  struct z_moved_cancellation_token_t *cancellation_token;
+#endif
+} z_get_options_t;
+typedef struct z_moved_hello_t {
+  struct z_owned_hello_t _this;
+} z_moved_hello_t;
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief A view on a contiguous region of memory.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct z_iovec_t {
+  /**
+   * A pointer to the start of the region.
+   */
+  const uint8_t *data;
+  /**
+   * Length of the region in bytes.
+   */
+  size_t len;
+} z_iovec_t;
+#endif
+typedef struct z_moved_keyexpr_t {
+  struct z_owned_keyexpr_t _this;
+} z_moved_keyexpr_t;
+/**
+ * @brief The options for `z_liveliness_declare_subscriber()`
+ */
+typedef struct z_liveliness_subscriber_options_t {
+  /**
+   * If true, subscriber will receive the state change notifications for liveliness tokens that were declared before its declaration.
+   */
   bool history;
 } z_liveliness_subscriber_options_t;
 /**
@@ -662,6 +1193,14 @@ typedef struct z_moved_mutex_t {
  */
 typedef struct z_open_options_t {
   uint8_t _dummy;
+#if defined(Z_FEATURE_UNSTABLE_API)
+  /**
+   * If `true`, the callbacks of the subscribers and queryables declared through the session are not run by the
+   * zenoh runtime threads, but queued until the application runs them with `zc_session_poll()`.
+   * Queryables with worker threads are not affected.
+   */
+  bool deferred_callbacks;
+#endif
 } z_open_options_t;
 /**
  * Represents the set of options that can be applied to the delete operation by a previously declared publisher,
@@ -673,6 +1212,9 @@ typedef struct z_publisher_delete_options_t {
    */
   const struct z_timestamp_t *timestamp;
 } z_publisher_delete_options_t;
+typedef struct z_moved_priority_handler_sample_t {
+  struct z_owned_priority_handler_sample_t _this;
+} z_moved_priority_handler_sample_t;
 typedef struct z_moved_publisher_t {
   struct z_owned_publisher_t _this;
 } z_moved_publisher_t;
@@ -700,6 +1242,15 @@ typedef struct z_publisher_put_options_t {
    * The attachment to attach to the publication.
    */
   struct z_moved_bytes_t *attachment;
+#if defined(Z_FEATURE_UNSTABLE_API)
+  /**
+   * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+   *
+   * The interned encoding of the data to publish, see `zc_encoding_intern()`. Ignored if `encoding` is set.
+   * Unlike `encoding`, it is not consumed, so that the same interned encoding can be passed to every put.
+   */
+  const struct zc_interned_encoding_t *interned_encoding;
+#endif
 } z_publisher_put_options_t;
 /**
  * Options passed to the `z_put()` function.
@@ -783,6 +1334,15 @@ typedef struct z_querier_get_options_t {
    * An optional attachment to attach to the query.
    */
   struct z_moved_bytes_t *attachment;
+#if defined(Z_FEATURE_UNSTABLE_API)
+  /**
+   * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+   *
+   * An optional cancellation token, see `z_cancellation_token_new()`. Once it is cancelled, the reply callback is
+   * dropped without waiting for the query to be finalized.
+   */
+  struct z_moved_cancellation_token_t *cancellation_token;
+#endif
 } z_querier_get_options_t;
 #endif
 typedef struct z_moved_query_t {
@@ -888,6 +1448,9 @@ typedef struct z_moved_ring_handler_reply_t {
 typedef struct z_moved_ring_handler_sample_t {
   struct z_owned_ring_handler_sample_t _this;
 } z_moved_ring_handler_sample_t;
+typedef struct z_moved_rwlock_t {
+  struct z_owned_rwlock_t _this;
+} z_moved_rwlock_t;
 typedef struct z_moved_sample_t {
   struct z_owned_sample_t _this;
 } z_moved_sample_t;
@@ -903,7 +1466,37 @@ typedef struct z_scout_options_t {
    * Type of entities to scout for.
    */
   enum z_what_t what;
+#if defined(Z_FEATURE_UNSTABLE_API)
+  /**
+   * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+   *
+   * The number of hello messages after which scouting stops before `timeout_ms`, 0 to scout for `timeout_ms`.
+   * The callback is called at most `max_hellos` times.
+   */
+  size_t max_hellos;
+#endif
+#if defined(Z_FEATURE_UNSTABLE_API)
+  /**
+   * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+   *
+   * The duration in ms after the first hello message after which scouting stops before `timeout_ms`, 0 to scout
+   * for `timeout_ms`.
+   */
+  uint64_t grace_ms;
+#endif
+#if defined(Z_FEATURE_UNSTABLE_API)
+  /**
+   * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+   *
+   * The path of a file where the locators of the routers found by scouting are saved, one per line, NULL to not save
+   * them. The file is only replaced if a router was found. See `zc_config_insert_cached_locators()`.
+   */
+  const char *locator_cache_path;
+#endif
 } z_scout_options_t;
+typedef struct z_moved_semaphore_t {
+  struct z_owned_semaphore_t _this;
+} z_moved_semaphore_t;
 typedef struct z_moved_session_t {
   struct z_owned_session_t _this;
 } z_moved_session_t;
@@ -925,6 +1518,16 @@ typedef struct z_moved_shm_provider_t {
 #if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 typedef uint32_t z_protocol_id_t;
 #endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Unique segment identifier.
+ */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+typedef uint32_t z_segment_id_t;
+#endif
+typedef struct z_moved_spsc_handler_sample_t {
+  struct z_owned_spsc_handler_sample_t _this;
+} z_moved_spsc_handler_sample_t;
 typedef struct z_moved_string_array_t {
   struct z_owned_string_array_t _this;
 } z_moved_string_array_t;
@@ -943,4532 +1546,8149 @@ typedef struct z_task_attr_t {
 typedef struct z_time_t {
   uint64_t t;
 } z_time_t;
-/**
- * @brief A log-processing closure.
- *
- * A closure is a structure that contains all the elements for stateful, memory-leak-free callbacks.
- */
-typedef struct zc_owned_closure_log_t {
-  void *_context;
-  void (*_call)(enum zc_log_severity_t severity, const struct z_loaned_string_t *msg, void *context);
-  void (*_drop)(void *context);
-} zc_owned_closure_log_t;
-/**
- * Moved closure.
- */
-typedef struct zc_moved_closure_log_t {
-  struct zc_owned_closure_log_t _this;
-} zc_moved_closure_log_t;
-/**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief A struct that indicates if there exist Subscribers matching the Publisher's key expression or Queryables matching Querier's key expression and target.
- */
-#if defined(Z_FEATURE_UNSTABLE_API)
-typedef struct zc_matching_status_t {
-  /**
-   * True if there exist matching Zenoh entities, false otherwise.
-   */
-  bool matching;
-} zc_matching_status_t;
-#endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief A matching status-processing closure.
+ * @brief A closure processing the replies to several queries, each reply being tagged with the index of its query.
  *
  * A closure is a structure that contains all the elements for stateful, memory-leak-free callbacks.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
-typedef struct zc_owned_closure_matching_status_t {
+typedef struct zc_owned_closure_indexed_reply_t {
   void *_context;
-  void (*_call)(const struct zc_matching_status_t *matching_status, void *context);
+  void (*_call)(size_t index, struct z_loaned_reply_t *reply, void *context);
   void (*_drop)(void *context);
-} zc_owned_closure_matching_status_t;
+} zc_owned_closure_indexed_reply_t;
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
  * @brief Moved closure.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
-typedef struct zc_moved_closure_matching_status_t {
-  struct zc_owned_closure_matching_status_t _this;
-} zc_moved_closure_matching_status_t;
+typedef struct zc_moved_closure_indexed_reply_t {
+  struct zc_owned_closure_indexed_reply_t _this;
+} zc_moved_closure_indexed_reply_t;
 #endif
-typedef struct zc_moved_concurrent_close_handle_t {
-  struct zc_owned_concurrent_close_handle_t _this;
-} zc_moved_concurrent_close_handle_t;
-typedef struct zc_moved_matching_listener_t {
-  struct zc_owned_matching_listener_t _this;
-} zc_moved_matching_listener_t;
-typedef struct zc_moved_shm_client_list_t {
-  struct zc_owned_shm_client_list_t _this;
-} zc_moved_shm_client_list_t;
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Setting for advanced publisher's cache. The cache allows advanced subscribers to recover history and/or lost samples.
+ * @brief The settings of one of the thread pools of the zenoh runtime.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
-typedef struct ze_advanced_publisher_cache_options_t {
-  /**
-   * Must be set to ``true``, to enable the cache.
-   */
-  bool is_enabled;
+typedef struct zc_runtime_pool_options_t {
   /**
-   * Number of samples to keep for each resource.
-   */
-  size_t max_samples;
-  /**
-   * The congestion control to apply to replies.
+   * The number of worker threads of the pool, 0 for the zenoh default.
    */
-  enum z_congestion_control_t congestion_control;
+  size_t worker_threads;
   /**
-   * The priority of replies.
+   * The maximum number of threads running blocking operations of the pool, 0 for the zenoh default.
    */
-  enum z_priority_t priority;
+  size_t max_blocking_threads;
   /**
-   * If set to ``true``, this cache replies will not be batched. This usually has a positive impact on latency but negative impact on throughput.
+   * The CPUs the threads of the pool may run on, bit `i` standing for CPU `i`, 0 to keep the affinity
+   * of the thread calling `zc_init_runtime()`. Only supported on Linux.
    */
-  bool is_express;
-} ze_advanced_publisher_cache_options_t;
-#endif
-/**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * Represents the set of options that can be applied to the delete operation by a previously declared advanced publisher,
- * whenever issued via `ze_advanced_publisher_delete()`.
- */
-#if defined(Z_FEATURE_UNSTABLE_API)
-typedef struct ze_advanced_publisher_delete_options_t {
+  uint64_t cpu_affinity_mask;
   /**
-   * Base delete options.
+   * The nice value of the threads of the pool, 0 to keep the one of the thread calling `zc_init_runtime()`.
+   * Only supported on Linux.
    */
-  struct z_publisher_delete_options_t delete_options;
-} ze_advanced_publisher_delete_options_t;
+  int32_t nice;
+} zc_runtime_pool_options_t;
 #endif
-typedef struct ze_moved_advanced_publisher_t {
-  struct ze_owned_advanced_publisher_t _this;
-} ze_moved_advanced_publisher_t;
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * Options passed to the `ze_declare_advanced_publisher()` function.
+ * @brief Options passed to the `zc_init_runtime()` function, one per thread pool of the zenoh runtime.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
-typedef struct ze_advanced_publisher_options_t {
+typedef struct zc_runtime_options_t {
   /**
-   * Base publisher options.
+   * The pool running the application tasks, e.g. the callbacks of subscribers and queryables.
    */
-  struct z_publisher_options_t publisher_options;
+  struct zc_runtime_pool_options_t app;
   /**
-   * Publisher cache settings.
+   * The pool accepting incoming connections.
    */
-  struct ze_advanced_publisher_cache_options_t cache;
+  struct zc_runtime_pool_options_t acc;
   /**
-   * Allow matching Subscribers to detect lost samples and optionally ask for retransimission.
-   *
-   * Retransmission can only be done if history is enabled on subscriber side.
+   * The pool transmitting messages.
    */
-  bool sample_miss_detection;
+  struct zc_runtime_pool_options_t tx;
   /**
-   * Allow this publisher to be detected through liveliness.
+   * The pool receiving messages.
    */
-  bool publisher_detection;
+  struct zc_runtime_pool_options_t rx;
   /**
-   * An optional key expression to be added to the liveliness token key expression.
-   * It can be used to convey meta data.
+   * The pool running the other network tasks.
    */
-  const struct z_loaned_keyexpr_t *publisher_detection_metadata;
-} ze_advanced_publisher_options_t;
+  struct zc_runtime_pool_options_t net;
+} zc_runtime_options_t;
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * Options passed to the `ze_advanced_publisher_put()` function.
+ * @brief The timing of a sampled message.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
-typedef struct ze_advanced_publisher_put_options_t {
+typedef struct zc_span_t {
   /**
-   * Base put options.
+   * The timed operation.
    */
-  struct z_publisher_put_options_t put_options;
-} ze_advanced_publisher_put_options_t;
-#endif
-/**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief A struct that represents missed samples.
- */
-#if defined(Z_FEATURE_UNSTABLE_API)
-typedef struct ze_miss_t {
+  enum zc_span_kind_t kind;
   /**
-   * The source of missed samples.
+   * The id of the publisher, subscriber or queryable in its session, see `z_entity_global_id_eid()`.
    */
-  struct z_entity_global_id_t source;
+  uint32_t entity_id;
   /**
-   * The number of missed samples.
+   * The time the operation started, in nanoseconds since the UNIX epoch.
    */
-  uint32_t nb;
-} ze_miss_t;
+  uint64_t start_ns;
+  /**
+   * The duration of the operation in nanoseconds.
+   */
+  uint64_t duration_ns;
+  /**
+   * The size of the payload of the message.
+   */
+  uint64_t payload_len;
+  /**
+   * The timestamp of a received sample, in nanoseconds since the UNIX epoch, 0 if it has none.
+   * `start_ns - source_timestamp_ns` is the transit time of the sample when the clocks of both ends are synchronized.
+   */
+  uint64_t source_timestamp_ns;
+} zc_span_t;
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief A sample miss-processing closure.
+ * @brief A closure receiving the timing spans of sampled messages.
  *
  * A closure is a structure that contains all the elements for stateful, memory-leak-free callbacks.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
-typedef struct ze_owned_closure_miss_t {
+typedef struct zc_owned_closure_span_t {
   void *_context;
-  void (*_call)(const struct ze_miss_t *matching_status, void *context);
+  void (*_call)(const struct zc_span_t *span, void *context);
   void (*_drop)(void *context);
-} ze_owned_closure_miss_t;
+} zc_owned_closure_span_t;
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
  * @brief Moved closure.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
-typedef struct ze_moved_closure_miss_t {
-  struct ze_owned_closure_miss_t _this;
-} ze_moved_closure_miss_t;
+typedef struct zc_moved_closure_span_t {
+  struct zc_owned_closure_span_t _this;
+} zc_moved_closure_span_t;
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief An owned Zenoh sample miss listener. Missed samples can only be detected from advanced publishers, enabling sample miss detection.
+ * @brief A batch of liveliness token key expressions, packed one after the other in a single buffer.
  *
- * A listener that sends notification when the advanced subscriber misses a sample .
- * Dropping the corresponding subscriber, also drops the listener.
- */
-typedef struct ALIGN(8) ze_owned_sample_miss_listener_t {
-  uint8_t _0[16];
-} ze_owned_sample_miss_listener_t;
-typedef struct ze_moved_advanced_subscriber_t {
-  struct ze_owned_advanced_subscriber_t _this;
-} ze_moved_advanced_subscriber_t;
-/**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Settings for retrievieng historical data for Advanced Subscriber.
+ * The key expression `i` is the string of `offsets[i + 1] - offsets[i]` bytes starting at `data + offsets[i]`, it is not
+ * null-terminated. It can be obtained as a `z_view_keyexpr_t` with `zc_liveliness_tokens_get()`. The batch is only
+ * valid during the call to the closure it is passed to.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
-typedef struct ze_advanced_subscriber_history_options_t {
-  /**
-   * Must be set to ``true``, to enable the history data recovery.
-   */
-  bool is_enabled;
+typedef struct zc_liveliness_tokens_t {
   /**
-   * Enable detection of late joiner publishers and query for their historical data.
-   * Late joiner detection can only be achieved for Publishers that enable publisher_detection.
-   * History can only be retransmitted by Publishers that enable caching.
+   * The key expressions.
    */
-  bool detect_late_publishers;
+  const char *data;
   /**
-   * Number of samples to query for each resource. ``0`` corresponds to no limit on number of samples.
+   * The `len + 1` offsets of the key expressions in `data`.
    */
-  size_t max_samples;
+  const size_t *offsets;
   /**
-   * Maximum age of samples to query. ``0`` corresponds to no limit on samples' age.
+   * The number of key expressions.
    */
-  uint64_t max_age_ms;
-} ze_advanced_subscriber_history_options_t;
+  size_t len;
+} zc_liveliness_tokens_t;
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Settings for recovering lost messages for Advanced Subscriber.
+ * @brief The changes of the liveliness tokens watched by a subscriber declared with
+ * `zc_liveliness_declare_snapshot_subscriber()`.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
-typedef struct ze_advanced_subscriber_recovery_options_t {
+typedef struct zc_liveliness_changes_t {
   /**
-   * Must be set to ``true``, to enable the lost sample recovery.
+   * `true` for the first batch, in which `joined` holds all alive tokens and `left` is empty.
    */
-  bool is_enabled;
+  bool is_snapshot;
   /**
-   * Period for queries for not yet received Samples.
-   *
-   * These queries allow to retrieve the last Sample(s) if the last Sample(s) is/are lost.
-   * So it is useful for sporadic publications but useless for periodic publications
-   * with a period smaller or equal to this period.
-   * Retransmission can only be achieved by Publishers that also activate retransmission.
+   * The tokens which are alive.
    */
-  uint64_t periodic_queries_period_ms;
-} ze_advanced_subscriber_recovery_options_t;
+  struct zc_liveliness_tokens_t joined;
+  /**
+   * The tokens which are no longer alive.
+   */
+  struct zc_liveliness_tokens_t left;
+} zc_liveliness_changes_t;
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Options passed to the `ze_declare_advanced_subscriber()` function.
+ * @brief A closure receiving the changes of the liveliness tokens watched by a snapshot subscriber.
+ *
+ * A closure is a structure that contains all the elements for stateful, memory-leak-free callbacks.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
-typedef struct ze_advanced_subscriber_options_t {
-  /**
-   * Base subscriber options.
-   */
-  struct z_subscriber_options_t subscriber_options;
-  /**
-   * Settings for querying historical data. History can only be retransmitted by Publishers that enable caching.
-   */
-  struct ze_advanced_subscriber_history_options_t history;
-  /**
-   * Settings for retransmission of detected lost Samples. Retransmission of lost samples can only be done by Publishers that enable
-   * caching and sample_miss_detection.
-   */
-  struct ze_advanced_subscriber_recovery_options_t recovery;
+typedef struct zc_owned_closure_liveliness_changes_t {
+  void *_context;
+  void (*_call)(const struct zc_liveliness_changes_t *changes, void *context);
+  void (*_drop)(void *context);
+} zc_owned_closure_liveliness_changes_t;
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Moved closure.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct zc_moved_closure_liveliness_changes_t {
+  struct zc_owned_closure_liveliness_changes_t _this;
+} zc_moved_closure_liveliness_changes_t;
+#endif
+/**
+ * @brief A log-processing closure.
+ *
+ * A closure is a structure that contains all the elements for stateful, memory-leak-free callbacks.
+ */
+typedef struct zc_owned_closure_log_t {
+  void *_context;
+  void (*_call)(enum zc_log_severity_t severity, const struct z_loaned_string_t *msg, void *context);
+  void (*_drop)(void *context);
+} zc_owned_closure_log_t;
+typedef struct zc_moved_bytes_pool_t {
+  struct zc_owned_bytes_pool_t _this;
+} zc_moved_bytes_pool_t;
+/**
+ * Moved closure.
+ */
+typedef struct zc_moved_closure_log_t {
+  struct zc_owned_closure_log_t _this;
+} zc_moved_closure_log_t;
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief A struct that indicates if there exist Subscribers matching the Publisher's key expression or Queryables matching Querier's key expression and target.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct zc_matching_status_t {
   /**
-   * Timeout to be used for history and recovery queries.
-   * Default value will be used if set to ``0``.
+   * True if there exist matching Zenoh entities, false otherwise.
    */
-  uint64_t query_timeout_ms;
+  bool matching;
+} zc_matching_status_t;
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief A matching status-processing closure.
+ *
+ * A closure is a structure that contains all the elements for stateful, memory-leak-free callbacks.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct zc_owned_closure_matching_status_t {
+  void *_context;
+  void (*_call)(const struct zc_matching_status_t *matching_status, void *context);
+  void (*_drop)(void *context);
+} zc_owned_closure_matching_status_t;
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Moved closure.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct zc_moved_closure_matching_status_t {
+  struct zc_owned_closure_matching_status_t _this;
+} zc_moved_closure_matching_status_t;
+#endif
+typedef struct zc_moved_concurrent_close_handle_t {
+  struct zc_owned_concurrent_close_handle_t _this;
+} zc_moved_concurrent_close_handle_t;
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct zc_moved_keyexpr_interner_t {
+  struct zc_owned_keyexpr_interner_t _this;
+} zc_moved_keyexpr_interner_t;
+#endif
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct zc_moved_keyexpr_matcher_t {
+  struct zc_owned_keyexpr_matcher_t _this;
+} zc_moved_keyexpr_matcher_t;
+#endif
+typedef struct zc_moved_matching_listener_t {
+  struct zc_owned_matching_listener_t _this;
+} zc_moved_matching_listener_t;
+typedef struct zc_moved_shm_client_cache_t {
+  struct zc_owned_shm_client_cache_t _this;
+} zc_moved_shm_client_cache_t;
+typedef struct zc_moved_shm_client_list_t {
+  struct zc_owned_shm_client_list_t _this;
+} zc_moved_shm_client_list_t;
+typedef struct zc_moved_shm_completion_queue_t {
+  struct zc_owned_shm_completion_queue_t _this;
+} zc_moved_shm_completion_queue_t;
+typedef struct zc_moved_string_arena_t {
+  struct zc_owned_string_arena_t _this;
+} zc_moved_string_arena_t;
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Options passed to the `*_recv_spin()` functions of the channel handlers.
+ *
+ * The receiving thread busy-polls the channel before falling back to a blocking wait, trading CPU time for
+ * a lower wake-up latency.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct zc_recv_spin_options_t {
   /**
-   * Allow this subscriber to be detected through liveliness.
+   * Maximum number of polling iterations before parking, 0 means no iteration limit.
    */
-  bool subscriber_detection;
+  size_t spin_count;
   /**
-   * An optional key expression to be added to the liveliness token key expression.
-   * It can be used to convey meta data.
+   * Maximum time in nanoseconds spent polling before parking, 0 means no time limit.
+   * If both `spin_count` and `spin_duration_ns` are 0, the channel is not polled at all.
    */
-  const struct z_loaned_keyexpr_t *subscriber_detection_metadata;
-} ze_advanced_subscriber_options_t;
+  uint64_t spin_duration_ns;
+  /**
+   * If ``true``, the thread yields its time slice to the OS scheduler before parking.
+   */
+  bool yield_before_park;
+} zc_recv_spin_options_t;
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Loaned closure.
+ * @brief The most frequently read fields of a sample, filled at once by `zc_sample_get_fields()`.
+ *
+ * The pointers borrow from the sample and are valid as long as it is.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
-typedef struct ze_loaned_closure_miss_t {
-  size_t _0[3];
-} ze_loaned_closure_miss_t;
+typedef struct zc_sample_fields_t {
+  /**
+   * The key expression of the sample.
+   */
+  const struct z_loaned_keyexpr_t *keyexpr;
+  /**
+   * The payload of the sample.
+   */
+  const struct z_loaned_bytes_t *payload;
+  /**
+   * The encoding of the payload.
+   */
+  const struct z_loaned_encoding_t *encoding;
+  /**
+   * The timestamp of the sample, `NULL` if it has none.
+   */
+  const struct z_timestamp_t *timestamp;
+  /**
+   * The attachment of the sample, `NULL` if it has none.
+   */
+  const struct z_loaned_bytes_t *attachment;
+  /**
+   * The sample kind.
+   */
+  enum z_sample_kind_t kind;
+  /**
+   * The qos priority of the sample.
+   */
+  enum z_priority_t priority;
+  /**
+   * The qos congestion control of the sample.
+   */
+  enum z_congestion_control_t congestion_control;
+  /**
+   * Whether the qos express flag of the sample was set.
+   */
+  bool express;
+  /**
+   * The reliability the sample was delivered with.
+   */
+  enum z_reliability_t reliability;
+} zc_sample_fields_t;
 #endif
 /**
- * @warning This API is deprecated. Please use ze_advanced_publisher.
- * @brief Options passed to the `ze_declare_publication_cache()` function.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Counters aggregated over all entities declared through a session, including the undeclared ones.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
-typedef struct ze_publication_cache_options_t {
+typedef struct zc_session_stats_t {
   /**
-   * The prefix used for queryable.
+   * The counters of the publishers.
    */
-  const struct z_loaned_keyexpr_t *queryable_prefix;
-#if defined(Z_FEATURE_UNSTABLE_API)
+  struct zc_entity_stats_t publishers;
   /**
-   * The restriction for the matching queries that will be receive by this publication cache.
+   * The counters of the subscribers.
    */
-  enum zc_locality_t queryable_origin;
+  struct zc_entity_stats_t subscribers;
+  /**
+   * The counters of the queryables.
+   */
+  struct zc_entity_stats_t queryables;
+} zc_session_stats_t;
 #endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief A snapshot of the statistics of an SHM Client cache, see `zc_shm_client_cache_get_stats()`.
+ *
+ * Counters are cumulative since the creation of the cache.
+ */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+typedef struct zc_shm_client_cache_stats_t {
   /**
-   * The `complete` option for the queryable.
+   * Number of segments attached by zenoh which were already mapped, e.g. by `zc_shm_client_cache_prefetch()`.
    */
-  bool queryable_complete;
+  uint64_t hits;
   /**
-   * The the history size (i.e. maximum number of messages to store).
+   * Number of segments attached by zenoh which had to be mapped by the client.
    */
-  size_t history;
+  uint64_t misses;
   /**
-   * The limit number of cached resources.
+   * Number of segments mapped ahead of time by `zc_shm_client_cache_prefetch()`.
    */
-  size_t resources_limit;
-} ze_publication_cache_options_t;
+  uint64_t prefetches;
+  /**
+   * Number of segments released by the cache because it was full.
+   */
+  uint64_t evictions;
+  /**
+   * Number of segments currently held by the cache.
+   */
+  size_t segments;
+} zc_shm_client_cache_stats_t;
 #endif
 /**
- * @warning This API is deprecated. Please use ze_advanced_subscriber.
- * @brief A set of options that can be applied to a querying subscriber,
- * upon its declaration via `ze_declare_querying_subscriber()`.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief A snapshot of the statistics of an SHM Provider, see `zc_shm_provider_stats()`.
  *
+ * Counters are cumulative since the creation of the provider, durations are in nanoseconds.
  */
-#if defined(Z_FEATURE_UNSTABLE_API)
-typedef struct ze_querying_subscriber_options_t {
-#if defined(Z_FEATURE_UNSTABLE_API)
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+typedef struct zc_shm_provider_stats_t {
   /**
-   * The restriction for the matching publications that will be receive by this subscriber.
+   * Number of bytes of the chunks currently allocated, including those waiting for garbage collection.
    */
-  enum zc_locality_t allowed_origin;
+  size_t bytes_in_use;
+  /**
+   * Number of bytes available for allocation, as reported by `z_shm_provider_available()`.
+   */
+  size_t bytes_available;
+  /**
+   * Number of chunks currently allocated, by size class: class 0 counts chunks of 1 byte, and class `i > 0`
+   * counts chunks of `2^(i-1) + 1` to `2^i` bytes. The last class also counts all bigger chunks.
+   */
+  size_t chunks_by_size_class[ZC_SHM_STATS_SIZE_CLASSES];
+  /**
+   * Number of chunks allocated from the backend.
+   */
+  uint64_t alloc_count;
+  /**
+   * Number of chunk allocations refused by the backend because it is out of memory.
+   */
+  uint64_t alloc_out_of_memory;
+  /**
+   * Number of chunk allocations refused by the backend because its free memory is too fragmented.
+   * A high value compared to `alloc_out_of_memory` means the provider's layout should be revised.
+   */
+  uint64_t alloc_need_defragment;
+  /**
+   * Number of chunk allocations refused by the backend for other reasons.
+   */
+  uint64_t alloc_other_errors;
+  /**
+   * Number of explicit garbage collections, with `z_shm_provider_garbage_collect()`.
+   */
+  uint64_t gc_count;
+  /**
+   * Total duration of the explicit garbage collections.
+   */
+  uint64_t gc_ns;
+  /**
+   * Number of defragmentations of the backend, either explicit or performed by allocation policies.
+   */
+  uint64_t defrag_count;
+  /**
+   * Total duration of the defragmentations of the backend.
+   */
+  uint64_t defrag_ns;
+  /**
+   * Number of blocking allocations, such as `z_shm_provider_alloc_gc_defrag_blocking()`.
+   */
+  uint64_t blocking_alloc_count;
+  /**
+   * Total duration of the blocking allocations, including their garbage collections, defragmentations
+   * and waits for free memory.
+   */
+  uint64_t blocking_alloc_ns;
+} zc_shm_provider_stats_t;
 #endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Setting for advanced publisher's cache. The cache allows advanced subscribers to recover history and/or lost samples.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct ze_advanced_publisher_cache_options_t {
   /**
-   * The selector to be used for queries.
+   * Must be set to ``true``, to enable the cache.
    */
-  const struct z_loaned_keyexpr_t *query_selector;
+  bool is_enabled;
   /**
-   * The target to be used for queries.
+   * Number of samples to keep for each resource.
    */
-  enum z_query_target_t query_target;
+  size_t max_samples;
   /**
-   * The consolidation mode to be used for queries.
+   * The congestion control to apply to replies.
    */
-  struct z_query_consolidation_t query_consolidation;
+  enum z_congestion_control_t congestion_control;
+  /**
+   * The priority of replies.
+   */
+  enum z_priority_t priority;
+  /**
+   * If set to ``true``, this cache replies will not be batched. This usually has a positive impact on latency but negative impact on throughput.
+   */
+  bool is_express;
+} ze_advanced_publisher_cache_options_t;
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * Represents the set of options that can be applied to the delete operation by a previously declared advanced publisher,
+ * whenever issued via `ze_advanced_publisher_delete()`.
+ */
 #if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct ze_advanced_publisher_delete_options_t {
   /**
-   * The accepted replies for queries.
+   * Base delete options.
    */
-  enum zc_reply_keyexpr_t query_accept_replies;
+  struct z_publisher_delete_options_t delete_options;
+} ze_advanced_publisher_delete_options_t;
 #endif
+typedef struct ze_moved_advanced_publisher_t {
+  struct ze_owned_advanced_publisher_t _this;
+} ze_moved_advanced_publisher_t;
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * Options passed to the `ze_declare_advanced_publisher()` function.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct ze_advanced_publisher_options_t {
   /**
-   * The timeout to be used for queries.
+   * Base publisher options.
    */
-  uint64_t query_timeout_ms;
-} ze_querying_subscriber_options_t;
+  struct z_publisher_options_t publisher_options;
+  /**
+   * Publisher cache settings.
+   */
+  struct ze_advanced_publisher_cache_options_t cache;
+  /**
+   * Allow matching Subscribers to detect lost samples and optionally ask for retransimission.
+   *
+   * Retransmission can only be done if history is enabled on subscriber side.
+   */
+  bool sample_miss_detection;
+  /**
+   * Allow this publisher to be detected through liveliness.
+   */
+  bool publisher_detection;
+  /**
+   * An optional key expression to be added to the liveliness token key expression.
+   * It can be used to convey meta data.
+   */
+  const struct z_loaned_keyexpr_t *publisher_detection_metadata;
+} ze_advanced_publisher_options_t;
 #endif
-typedef struct ze_moved_publication_cache_t {
-  struct ze_owned_publication_cache_t _this;
-} ze_moved_publication_cache_t;
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief A loaned Zenoh publication cache.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * Options passed to the `ze_advanced_publisher_put()` function.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct ze_advanced_publisher_put_options_t {
+  /**
+   * Base put options.
+   */
+  struct z_publisher_put_options_t put_options;
+} ze_advanced_publisher_put_options_t;
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief A struct that represents missed samples.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct ze_miss_t {
+  /**
+   * The source of missed samples.
+   */
+  struct z_entity_global_id_t source;
+  /**
+   * The number of missed samples.
+   */
+  uint32_t nb;
+  /**
+   * The total number of samples missed from this source since the listener was declared, including these ones.
+   *
+   * Only the samples which are permanently missed are counted. Lost samples which are recovered from the publisher's
+   * cache are delivered to the subscriber's callback like any other sample: they are neither reported to the listener
+   * nor counted, and no count of recovered samples is available.
+   */
+  uint64_t total_nb;
+} ze_miss_t;
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief A sample miss-processing closure.
+ *
+ * A closure is a structure that contains all the elements for stateful, memory-leak-free callbacks.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct ze_owned_closure_miss_t {
+  void *_context;
+  void (*_call)(const struct ze_miss_t *matching_status, void *context);
+  void (*_drop)(void *context);
+} ze_owned_closure_miss_t;
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Moved closure.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct ze_moved_closure_miss_t {
+  struct ze_owned_closure_miss_t _this;
+} ze_moved_closure_miss_t;
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief An owned Zenoh sample miss listener. Missed samples can only be detected from advanced publishers, enabling sample miss detection.
+ *
+ * A listener that sends notification when the advanced subscriber misses a sample .
+ * Dropping the corresponding subscriber, also drops the listener.
+ */
+typedef struct ALIGN(8) ze_owned_sample_miss_listener_t {
+  uint8_t _0[16];
+} ze_owned_sample_miss_listener_t;
+typedef struct ze_moved_advanced_subscriber_t {
+  struct ze_owned_advanced_subscriber_t _this;
+} ze_moved_advanced_subscriber_t;
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Settings for retrievieng historical data for Advanced Subscriber.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct ze_advanced_subscriber_history_options_t {
+  /**
+   * Must be set to ``true``, to enable the history data recovery.
+   */
+  bool is_enabled;
+  /**
+   * Enable detection of late joiner publishers and query for their historical data.
+   * Late joiner detection can only be achieved for Publishers that enable publisher_detection.
+   * History can only be retransmitted by Publishers that enable caching.
+   */
+  bool detect_late_publishers;
+  /**
+   * Number of samples to query for each resource. ``0`` corresponds to no limit on number of samples.
+   */
+  size_t max_samples;
+  /**
+   * Maximum age of samples to query. ``0`` corresponds to no limit on samples' age.
+   */
+  uint64_t max_age_ms;
+} ze_advanced_subscriber_history_options_t;
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Settings for recovering lost messages for Advanced Subscriber.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct ze_advanced_subscriber_recovery_options_t {
+  /**
+   * Must be set to ``true``, to enable the lost sample recovery.
+   */
+  bool is_enabled;
+  /**
+   * Period for queries for not yet received Samples.
+   *
+   * These queries allow to retrieve the last Sample(s) if the last Sample(s) is/are lost.
+   * So it is useful for sporadic publications but useless for periodic publications
+   * with a period smaller or equal to this period.
+   * Retransmission can only be achieved by Publishers that also activate retransmission.
+   */
+  uint64_t periodic_queries_period_ms;
+} ze_advanced_subscriber_recovery_options_t;
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Options passed to the `ze_declare_advanced_subscriber()` function.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct ze_advanced_subscriber_options_t {
+  /**
+   * Base subscriber options.
+   */
+  struct z_subscriber_options_t subscriber_options;
+  /**
+   * Settings for querying historical data. History can only be retransmitted by Publishers that enable caching.
+   */
+  struct ze_advanced_subscriber_history_options_t history;
+  /**
+   * Settings for retransmission of detected lost Samples. Retransmission of lost samples can only be done by Publishers that enable
+   * caching and sample_miss_detection.
+   */
+  struct ze_advanced_subscriber_recovery_options_t recovery;
+  /**
+   * Timeout to be used for history and recovery queries.
+   * Default value will be used if set to ``0``.
+   */
+  uint64_t query_timeout_ms;
+  /**
+   * Allow this subscriber to be detected through liveliness.
+   */
+  bool subscriber_detection;
+  /**
+   * An optional key expression to be added to the liveliness token key expression.
+   * It can be used to convey meta data.
+   */
+  const struct z_loaned_keyexpr_t *subscriber_detection_metadata;
+} ze_advanced_subscriber_options_t;
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Loaned closure.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct zc_loaned_closure_indexed_reply_t {
+  size_t _0[3];
+} zc_loaned_closure_indexed_reply_t;
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Loaned closure.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct zc_loaned_closure_liveliness_changes_t {
+  size_t _0[3];
+} zc_loaned_closure_liveliness_changes_t;
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Loaned closure.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct zc_loaned_closure_span_t {
+  size_t _0[3];
+} zc_loaned_closure_span_t;
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief The description of a field of a fixed-layout struct, for `ze_serialize_struct()` and `ze_deserialize_struct()`.
+ *
+ * A struct is described by a constant array of fields, typically built once with `offsetof()`:
+ * @code{.c}
+ * typedef struct { uint8_t trace_id[16]; uint64_t seq; int32_t tenant; } metadata_t;
+ * static const ze_field_t METADATA[] = {
+ *     {ZE_FIELD_TYPE_BYTES, offsetof(metadata_t, trace_id), 16},
+ *     {ZE_FIELD_TYPE_UINT64, offsetof(metadata_t, seq), 0},
+ *     {ZE_FIELD_TYPE_INT32, offsetof(metadata_t, tenant), 0},
+ * };
+ * @endcode
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct ze_field_t {
+  /**
+   * The type of the field.
+   */
+  ze_field_type_t kind;
+  /**
+   * The offset of the field in the struct.
+   */
+  size_t offset;
+  /**
+   * The number of bytes of a `ZE_FIELD_TYPE_BYTES` field, ignored for the other types.
+   */
+  size_t len;
+} ze_field_t;
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Options passed to the `ze_get_history_paged()` function.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct ze_history_pages_options_t {
+  /**
+   * Maximum age of the samples to retrieve, must be non-zero.
+   */
+  uint64_t max_age_ms;
+  /**
+   * The time span covered by each page, i.e. by each query to the publishers' caches.
+   */
+  uint64_t page_ms;
+  /**
+   * The maximum number of pages queried at once. Completed pages are buffered until all the older ones are delivered,
+   * so this also bounds the number of pages held in memory.
+   */
+  size_t max_inflight_pages;
+  /**
+   * The timeout of each page query. Default query timeout from zenoh configuration will be used if set to ``0``.
+   */
+  uint64_t query_timeout_ms;
+} ze_history_pages_options_t;
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Loaned closure.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct ze_loaned_closure_miss_t {
+  size_t _0[3];
+} ze_loaned_closure_miss_t;
+#endif
+/**
+ * @warning This API is deprecated. Please use ze_advanced_publisher.
+ * @brief Options passed to the `ze_declare_publication_cache()` function.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct ze_publication_cache_options_t {
+  /**
+   * The prefix used for queryable.
+   */
+  const struct z_loaned_keyexpr_t *queryable_prefix;
+#if defined(Z_FEATURE_UNSTABLE_API)
+  /**
+   * The restriction for the matching queries that will be receive by this publication cache.
+   */
+  enum zc_locality_t queryable_origin;
+#endif
+  /**
+   * The `complete` option for the queryable.
+   */
+  bool queryable_complete;
+  /**
+   * The the history size (i.e. maximum number of messages to store).
+   */
+  size_t history;
+  /**
+   * The limit number of cached resources.
+   */
+  size_t resources_limit;
+#if defined(Z_FEATURE_UNSTABLE_API)
+  /**
+   * The maximum number of bytes held by the cache, ``0`` to bound the cache by the number of samples only.
+   * When non-zero, the cache evicts the oldest samples of its least recently used key expressions to stay within
+   * this budget, and ``history`` becomes the maximum number of samples per key expression, ``0`` meaning no limit.
+   * Ignored if ``budget`` is set.
+   */
+  size_t max_bytes;
+#endif
+#if defined(Z_FEATURE_UNSTABLE_API)
+  /**
+   * A memory budget shared with other publication caches, whose least recently used key expressions are evicted
+   * across all of them, see `ze_cache_budget_new()`. The cache is byte-budgeted if set, as with ``max_bytes``.
+   */
+  const struct ze_loaned_cache_budget_t *budget;
+#endif
+#if defined(Z_FEATURE_UNSTABLE_API)
+  /**
+   * The maximum age of the samples held by a byte-budgeted or log-backed cache, in milliseconds, ``0`` for no limit.
+   */
+  uint64_t max_age_ms;
+#endif
+#if defined(Z_FEATURE_UNSTABLE_API)
+  /**
+   * The directory where a log-backed cache writes its log files, ``NULL`` to keep the cache in memory.
+   * When set, the samples are appended to memory-mapped log segments, and only an index by key expression is held
+   * in memory, so that a long history does not increase the resident memory. Queries are replied with payloads
+   * referring to the mapped segments, without copying them. ``max_bytes`` and ``budget`` are ignored, and
+   * ``history`` is the maximum number of samples per key expression, ``0`` meaning no limit. The log files are removed
+   * once rotated out or when the cache is dropped. Only supported on unix platforms.
+   */
+  const char *log_directory;
+#endif
+#if defined(Z_FEATURE_UNSTABLE_API)
+  /**
+   * The size of the segments of a log-backed cache, a segment being bigger if a single sample does not fit.
+   */
+  size_t log_segment_size;
+#endif
+#if defined(Z_FEATURE_UNSTABLE_API)
+  /**
+   * The maximum number of segments of a log-backed cache, the oldest one being removed when a new one is started.
+   * ``0`` for no limit.
+   */
+  size_t log_max_segments;
+#endif
+} ze_publication_cache_options_t;
+#endif
+/**
+ * @warning This API is deprecated. Please use ze_advanced_subscriber.
+ * @brief A set of options that can be applied to a querying subscriber,
+ * upon its declaration via `ze_declare_querying_subscriber()`.
+ *
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct ze_querying_subscriber_options_t {
+#if defined(Z_FEATURE_UNSTABLE_API)
+  /**
+   * The restriction for the matching publications that will be receive by this subscriber.
+   */
+  enum zc_locality_t allowed_origin;
+#endif
+  /**
+   * The selector to be used for queries.
+   */
+  const struct z_loaned_keyexpr_t *query_selector;
+  /**
+   * The target to be used for queries.
+   */
+  enum z_query_target_t query_target;
+  /**
+   * The consolidation mode to be used for queries.
+   */
+  struct z_query_consolidation_t query_consolidation;
+#if defined(Z_FEATURE_UNSTABLE_API)
+  /**
+   * The accepted replies for queries.
+   */
+  enum zc_reply_keyexpr_t query_accept_replies;
+#endif
+  /**
+   * The timeout to be used for queries.
+   */
+  uint64_t query_timeout_ms;
+#if defined(Z_FEATURE_UNSTABLE_API)
+  /**
+   * If ``true``, query replies are delivered as they arrive, instead of being merged with the publications
+   * buffered until the query completes. A sample is only delivered if its timestamp is newer than the last delivered
+   * one for its key expression, so that superseded samples are dropped and the memory used only depends on the number
+   * of key expressions. Samples without timestamp are always delivered.
+   */
+  bool streaming_merge;
+#endif
+} ze_querying_subscriber_options_t;
+#endif
+typedef struct ze_moved_cache_budget_t {
+  struct ze_owned_cache_budget_t _this;
+} ze_moved_cache_budget_t;
+typedef struct ze_moved_publication_cache_t {
+  struct ze_owned_publication_cache_t _this;
+} ze_moved_publication_cache_t;
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief A loaned Zenoh publication cache.
+ */
+typedef struct ALIGN(8) ze_loaned_publication_cache_t {
+  uint8_t _0[96];
+} ze_loaned_publication_cache_t;
+typedef struct ze_moved_querying_subscriber_t {
+  struct ze_owned_querying_subscriber_t _this;
+} ze_moved_querying_subscriber_t;
+typedef struct ze_moved_sample_miss_listener_t {
+  struct ze_owned_sample_miss_listener_t _this;
+} ze_moved_sample_miss_listener_t;
+typedef struct ze_moved_serializer_t {
+  struct ze_owned_serializer_t _this;
+} ze_moved_serializer_t;
+ZENOHC_API extern const unsigned int Z_ROUTER;
+ZENOHC_API extern const unsigned int Z_PEER;
+ZENOHC_API extern const unsigned int Z_CLIENT;
+ZENOHC_API extern const char *Z_CONFIG_MODE_KEY;
+ZENOHC_API extern const char *Z_CONFIG_CONNECT_KEY;
+ZENOHC_API extern const char *Z_CONFIG_LISTEN_KEY;
+ZENOHC_API extern const char *Z_CONFIG_USER_KEY;
+ZENOHC_API extern const char *Z_CONFIG_PASSWORD_KEY;
+ZENOHC_API extern const char *Z_CONFIG_MULTICAST_SCOUTING_KEY;
+ZENOHC_API extern const char *Z_CONFIG_MULTICAST_INTERFACE_KEY;
+ZENOHC_API extern const char *Z_CONFIG_MULTICAST_IPV4_ADDRESS_KEY;
+ZENOHC_API extern const char *Z_CONFIG_SCOUTING_TIMEOUT_KEY;
+ZENOHC_API extern const char *Z_CONFIG_SCOUTING_DELAY_KEY;
+ZENOHC_API extern const char *Z_CONFIG_ADD_TIMESTAMP_KEY;
+ZENOHC_API extern const char *Z_CONFIG_SHARED_MEMORY_KEY;
+ZENOHC_API extern const unsigned int Z_SHM_POSIX_PROTOCOL_ID;
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Drops adaptive mutex and resets it to its gravestone state. The mutex must not be locked.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+void z_adaptive_mutex_drop(struct z_moved_adaptive_mutex_t *this_);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs an adaptive mutex.
+ *
+ * Unlike `z_owned_mutex_t`, the mutex holds no guard and is a single byte: when it is not contended, locking and
+ * unlocking it are a single atomic operation. A thread waiting for the mutex spins for a short while, which avoids a
+ * context switch when the mutex is only held for short sections, and is then parked in the kernel, e.g. on a futex on
+ * Linux, until the mutex is released. The mutex can not be used with `z_owned_condvar_t`.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_adaptive_mutex_init(struct z_owned_adaptive_mutex_t *this_);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Borrows adaptive mutex, so that it can be shared by the threads using it.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+const struct z_loaned_adaptive_mutex_t *z_adaptive_mutex_loan(const struct z_owned_adaptive_mutex_t *this_);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Locks adaptive mutex. If it is already locked, blocks the thread until it aquires the lock.
+ * @return 0 in case of success, negative error code in case of failure.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_adaptive_mutex_lock(const struct z_loaned_adaptive_mutex_t *this_);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Tries to lock adaptive mutex. If it is already locked, return immediately.
+ * @return 0 in case of success, `Z_EBUSY_MUTEX` if failed to aquire the lock.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_adaptive_mutex_try_lock(const struct z_loaned_adaptive_mutex_t *this_);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Unlocks adaptive mutex previously locked by the current thread. Otherwise the behaviour is undefined.
+ * @return 0 in case of success, `Z_EINVAL_MUTEX` if the mutex is not locked.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_adaptive_mutex_unlock(const struct z_loaned_adaptive_mutex_t *this_);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Make allocation without any additional actions.
+ */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+void z_alloc_layout_alloc(struct z_buf_alloc_result_t *out_result,
+                          const struct z_loaned_alloc_layout_t *layout);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Make allocation performing garbage collection if needed.
+ */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+void z_alloc_layout_alloc_gc(struct z_buf_alloc_result_t *out_result,
+                             const struct z_loaned_alloc_layout_t *layout);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Make allocation performing garbage collection and/or defragmentation if needed.
+ */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+void z_alloc_layout_alloc_gc_defrag(struct z_buf_alloc_result_t *out_result,
+                                    const struct z_loaned_alloc_layout_t *layout);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Make allocation performing garbage collection and/or defragmentation and/or blocking if needed.
+ */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+void z_alloc_layout_alloc_gc_defrag_blocking(struct z_buf_alloc_result_t *out_result,
+                                             const struct z_loaned_alloc_layout_t *layout);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Make allocation performing garbage collection and/or defragmentation and/or forced deallocation if needed.
+ */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+void z_alloc_layout_alloc_gc_defrag_dealloc(struct z_buf_alloc_result_t *out_result,
+                                            const struct z_loaned_alloc_layout_t *layout);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Deletes Alloc Layout.
+ */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+void z_alloc_layout_drop(struct z_moved_alloc_layout_t *this_);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Borrows Alloc Layout.
+ */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+const struct z_loaned_alloc_layout_t *z_alloc_layout_loan(const struct z_owned_alloc_layout_t *this_);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Creates a new Alloc Layout for SHM Provider.
+ */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+z_result_t z_alloc_layout_new(struct z_owned_alloc_layout_t *this_,
+                              const struct z_loaned_shm_provider_t *provider,
+                              size_t size,
+                              struct z_alloc_alignment_t alignment);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Make allocation performing garbage collection and/or defragmentation in async manner. Will return Z_EINVAL
+ * if used with non-threadsafe SHM Provider.
+ */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+z_result_t z_alloc_layout_threadsafe_alloc_gc_defrag_async(struct z_buf_alloc_result_t *out_result,
+                                                           const struct z_loaned_alloc_layout_t *layout,
+                                                           struct zc_threadsafe_context_t result_context,
+                                                           void (*result_callback)(void*,
+                                                                                   struct z_buf_alloc_result_t*));
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Converts data into a loaned SHM buffer.
+ *
+ * @param this_: Data to convert.
+ * @param dst: An uninitialized memory location where to construct an SHM buffer.
+ */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+z_result_t z_bytes_as_loaned_shm(const struct z_loaned_bytes_t *this_,
+                                 const struct z_loaned_shm_t **dst);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Converts data into a mutably loaned SHM buffer.
+ *
+ * @param this_: Data to convert.
+ * @param dst: An uninitialized memory location where to construct an SHM buffer.
+ */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+z_result_t z_bytes_as_mut_loaned_shm(struct z_loaned_bytes_t *this_,
+                                     struct z_loaned_shm_t **dst);
+#endif
+/**
+ * Constructs an owned shallow copy of data in provided uninitialized memory location.
+ */
+ZENOHC_API void z_bytes_clone(struct z_owned_bytes_t *dst, const struct z_loaned_bytes_t *this_);
+/**
+ * Converts a data from buffer into `z_owned_bytes_t` by copying.
+ * @param this_: An uninitialized location in memory where `z_owned_bytes_t` is to be constructed.
+ * @param data: A pointer to the buffer containing data.
+ * @param len: Length of the buffer.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+ZENOHC_API
+z_result_t z_bytes_copy_from_buf(struct z_owned_bytes_t *this_,
+                                 const uint8_t *data,
+                                 size_t len);
+/**
+ * Converts a slice into `z_owned_bytes_t` by copying.
+ */
+ZENOHC_API
+void z_bytes_copy_from_slice(struct z_owned_bytes_t *this_,
+                             const struct z_loaned_slice_t *slice);
+/**
+ * Converts a null-terminated string into `z_owned_bytes_t` by copying.
+ * @param this_: An uninitialized location in memory where `z_owned_bytes_t` is to be constructed.
+ * @param str: a pointer to the null-terminated string.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+ZENOHC_API z_result_t z_bytes_copy_from_str(struct z_owned_bytes_t *this_, const char *str);
+/**
+ * Converts a string into `z_owned_bytes_t` by copying.
+ */
+ZENOHC_API
+void z_bytes_copy_from_string(struct z_owned_bytes_t *this_,
+                              const struct z_loaned_string_t *str);
+/**
+ * Drops `this_`, resetting it to gravestone value. If there are any shallow copies
+ * created by `z_bytes_clone()`, they would still stay valid.
+ */
+ZENOHC_API void z_bytes_drop(struct z_moved_bytes_t *this_);
+/**
+ * Constructs an empty instance of `z_owned_bytes_t`.
+ */
+ZENOHC_API void z_bytes_empty(struct z_owned_bytes_t *this_);
+/**
+ * Converts buffer into `z_owned_bytes_t`.
+ * @param this_: An uninitialized location in memory where `z_owned_bytes_t` is to be constructed.
+ * @param data: A pointer to the buffer containing data. `this_` will take ownership of the buffer.
+ * @param len: Length of the buffer.
+ * @param deleter: A thread-safe function, that will be called on `data` when `this_` is dropped. Can be `NULL` if `data` is located in static memory and does not require a drop.
+ * @param context: An optional context to be passed to `deleter`.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+ZENOHC_API
+z_result_t z_bytes_from_buf(struct z_owned_bytes_t *this_,
+                            uint8_t *data,
+                            size_t len,
+                            void (*deleter)(void *data, void *context),
+                            void *context);
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs data from a region of a file, mapped in memory rather than read.
+ *
+ * The region is mapped read-only, so that it is paged in by the OS as the data is sent instead of being held in
+ * heap memory, and unmapped once the data and all its clones are dropped. The data is made of slices of up to
+ * 65535 bytes, the default batch size of the transport, which `z_bytes_get_slice_iterator()` returns in order.
+ *
+ * The file must not be truncated while the data is alive: accessing a page beyond its end raises `SIGBUS`.
+ * Changes to the file may or may not be visible in the data, which should be treated as a snapshot of a file
+ * that is not written anymore.
+ *
+ * @param this_: An uninitialized location in memory where `z_owned_bytes_t` is to be constructed.
+ * @param path: The null-terminated path of the file.
+ * @param offset: The offset of the region in the file.
+ * @param len: The length of the region, 0 for the rest of the file.
+ * @return 0 in case of success, `Z_EINVAL` if the region is not within the file, `Z_EIO` if the file can not be
+ * opened or mapped, `Z_EUNAVAILABLE` if mapping files is not supported on this platform. In case of failure,
+ * `this_` is constructed as empty data.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_bytes_from_file(struct z_owned_bytes_t *this_,
+                             const char *path,
+                             uint64_t offset,
+                             size_t len);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Converts a set of buffers into `z_owned_bytes_t` without copy.
+ *
+ * Each buffer becomes a separate slice of the resulting data, so that `z_bytes_get_slice_iterator()` returns
+ * the same fragments, in the same order.
+ * @param this_: An uninitialized location in memory where `z_owned_bytes_t` is to be constructed.
+ * @param iov: A pointer to an array of buffers. `this_` will take ownership of each buffer.
+ * @param n: Number of buffers in `iov`.
+ * @param deleter: A thread-safe function, that will be called on the data of each buffer when `this_` is dropped. Can be `NULL` if buffers are located in static memory and do not require a drop.
+ * @param context: An optional context to be passed to each `deleter` invocation.
+ * @return 0 in case of success, negative error code otherwise. In case of failure, none of the buffers is owned by `this_`.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_bytes_from_iovec(struct z_owned_bytes_t *this_,
+                              const struct z_iovec_t *iov,
+                              size_t n,
+                              void (*deleter)(void *data, void *context),
+                              void *context);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Converts from an immutable SHM buffer consuming it.
+ */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+z_result_t z_bytes_from_shm(struct z_owned_bytes_t *this_,
+                            struct z_moved_shm_t *shm);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Converts a mutable SHM buffer consuming it.
+ */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+z_result_t z_bytes_from_shm_mut(struct z_owned_bytes_t *this_,
+                                struct z_moved_shm_mut_t *shm);
+#endif
+/**
+ * Converts a slice into `z_owned_bytes_t`.
+ * The slice is consumed upon function return.
+ */
+ZENOHC_API void z_bytes_from_slice(struct z_owned_bytes_t *this_, struct z_moved_slice_t *slice);
+/**
+ * Converts a statically allocated constant buffer into `z_owned_bytes_t`.
+ * @param this_: An uninitialized location in memory where `z_owned_bytes_t` is to be constructed.
+ * @param data: A pointer to the statically allocated constant data.
+ * @param len: A length of the buffer.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+ZENOHC_API
+z_result_t z_bytes_from_static_buf(struct z_owned_bytes_t *this_,
+                                   uint8_t *data,
+                                   size_t len);
+/**
+ * Converts a statically allocated constant null-terminated string into `z_owned_bytes_t` by aliasing.
+ * @param this_: An uninitialized location in memory where `z_owned_bytes_t` is to be constructed.
+ * @param str: a pointer to the statically allocated constant string.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+ZENOHC_API
+z_result_t z_bytes_from_static_str(struct z_owned_bytes_t *this_,
+                                   const char *str);
+/**
+ * Converts a null-terminated string into `z_owned_bytes_t`.
+ * @param this_: An uninitialized location in memory where `z_owned_bytes_t` is to be constructed.
+ * @param str: a pointer to the string. `this_` will take ownership of the string.
+ * @param deleter: A thread-safe function, that will be called on `str` when `this_` is dropped. Can be `NULL` if `str` is located in static memory and does not require a drop.
+ * @param context: An optional context to be passed to `deleter`.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+ZENOHC_API
+z_result_t z_bytes_from_str(struct z_owned_bytes_t *this_,
+                            char *str,
+                            void (*deleter)(void *data, void *context),
+                            void *context);
+/**
+ * Converts a string into `z_owned_bytes_t`.
+ * The string is consumed upon function return.
+ */
+ZENOHC_API void z_bytes_from_string(struct z_owned_bytes_t *this_, struct z_moved_string_t *s);
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * Attempts to get a contiguous view to the underlying bytes.
+ * This is only possible if data is not fragmented, otherwise the function will fail.
+ * In case of fragmented data, consider using `z_bytes_get_slice_iterator()`.
+ *
+ * @param this_: An instance of Zenoh data.
+ * @param view: An uninitialized memory location where a contiguous view on data will be constructed.
+ * @return  ​0​ upon success, negative error code otherwise.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_bytes_get_contiguous_view(const struct z_loaned_bytes_t *this_,
+                                       struct z_view_slice_t *view);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Gets views on all slices of the data in a single call.
+ *
+ * Slices are written in the order in which they appear in the data, exactly as they would be returned by
+ * `z_bytes_get_slice_iterator()`. Views remain valid as long as `this_` is not modified or dropped.
+ *
+ * @param this_: An instance of Zenoh data.
+ * @param out: A pointer to an array of `cap` elements, where the views will be written.
+ * @param cap: Number of elements of `out`.
+ * @param n: A memory location where the total number of slices of the data will be written.
+ * @return 0 upon success, `Z_EINVAL` if the data consists of more than `cap` slices. In the latter case the first `cap` views are
+ * still written into `out`, and the total number of slices is still written into `n`, so that the call can be repeated with a
+ * large enough array.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_bytes_get_iovec(const struct z_loaned_bytes_t *this_,
+                             struct z_iovec_t *out,
+                             size_t cap,
+                             size_t *n);
+#endif
+/**
+ * Returns a reader for the data.
+ *
+ * The `data` should outlive the reader.
+ */
+ZENOHC_API struct z_bytes_reader_t z_bytes_get_reader(const struct z_loaned_bytes_t *data);
+/**
+ * Returns an iterator on raw bytes slices contained in the `z_loaned_bytes_t`.
+ *
+ * Zenoh may store data in non-contiguous regions of memory, this iterator
+ * then allows to access raw data directly without any attempt of deserializing it.
+ * Please note that no guarantee is provided on the internal memory layout.
+ * The only provided guarantee is on the bytes order that is preserved.
+ */
+ZENOHC_API
+struct z_bytes_slice_iterator_t z_bytes_get_slice_iterator(const struct z_loaned_bytes_t *this_);
+/**
+ * Returns ``true`` if `this_` is empty, ``false`` otherwise.
+ */
+ZENOHC_API bool z_bytes_is_empty(const struct z_loaned_bytes_t *this_);
+/**
+ * Returns total number of bytes in the payload.
+ */
+ZENOHC_API size_t z_bytes_len(const struct z_loaned_bytes_t *this_);
+/**
+ * Borrows data.
+ */
+ZENOHC_API const struct z_loaned_bytes_t *z_bytes_loan(const struct z_owned_bytes_t *this_);
+/**
+ * Muatably borrows data.
+ */
+ZENOHC_API struct z_loaned_bytes_t *z_bytes_loan_mut(struct z_owned_bytes_t *this_);
+/**
+ * Reads data into specified destination.
+ *
+ * @param this_: Data reader to read from.
+ * @param dst: Buffer where the read data is written.
+ * @param len: Maximum number of bytes to read.
+ * @return number of bytes read. If return value is smaller than `len`, it means that  theend of the data was reached.
+ */
+ZENOHC_API
+size_t z_bytes_reader_read(struct z_bytes_reader_t *this_,
+                           uint8_t *dst,
+                           size_t len);
+/**
+ * Gets the number of bytes that can still be read.
+ */
+ZENOHC_API size_t z_bytes_reader_remaining(const struct z_bytes_reader_t *this_);
+/**
+ * Sets the `reader` position indicator for the payload to the value pointed to by offset.
+ * The new position is exactly `offset` bytes measured from the beginning of the payload if origin is `SEEK_SET`,
+ * from the current reader position if origin is `SEEK_CUR`, and from the end of the payload if origin is `SEEK_END`.
+ * @return ​0​ upon success, negative error code otherwise.
+ */
+ZENOHC_API
+z_result_t z_bytes_reader_seek(struct z_bytes_reader_t *this_,
+                               int64_t offset,
+                               int origin);
+/**
+ * Gets the read position indicator.
+ * @return read position indicator on success or -1L if failure occurs.
+ */
+ZENOHC_API int64_t z_bytes_reader_tell(struct z_bytes_reader_t *this_);
+/**
+ * Gets next slice.
+ * @param this_: Slice iterator.
+ * @param slice: An unitialized memory location where the view for the next slice will be constructed.
+ * @return `false` if there are no more slices (in this case slice will stay unchanged), `true` otherwise.
+ */
+ZENOHC_API
+bool z_bytes_slice_iterator_next(struct z_bytes_slice_iterator_t *this_,
+                                 struct z_view_slice_t *slice);
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Converts data into an owned SHM buffer by copying it's shared reference.
+ *
+ * @param this_: Data to convert.
+ * @param dst: An uninitialized memory location where to construct an SHM buffer.
+ */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+z_result_t z_bytes_to_owned_shm(const struct z_loaned_bytes_t *this_,
+                                struct z_owned_shm_t *dst);
+#endif
+/**
+ * Converts data into an owned slice.
+ *
+ * @param this_: Data to convert.
+ * @param dst: An uninitialized memory location where to construct a slice.
+ */
+ZENOHC_API
+z_result_t z_bytes_to_slice(const struct z_loaned_bytes_t *this_,
+                            struct z_owned_slice_t *dst);
+/**
+ * Converts data into an owned non-null-terminated string.
+ *
+ * @param this_: Data to convert.
+ * @param dst: An uninitialized memory location where to construct a string.
+ */
+ZENOHC_API
+z_result_t z_bytes_to_string(const struct z_loaned_bytes_t *this_,
+                             struct z_owned_string_t *dst);
+/**
+ * Appends bytes.
+ * This allows to compose a serialized data out of multiple `z_owned_bytes_t` that may point to different memory regions.
+ * Said in other terms, it allows to create a linear view on different memory regions without copy.
+ *
+ * @return 0 in case of success, negative error code otherwise.
+ */
+ZENOHC_API
+z_result_t z_bytes_writer_append(struct z_loaned_bytes_writer_t *this_,
+                                 struct z_moved_bytes_t *bytes);
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Appends the first `written` bytes of the buffer returned by the last call to `z_bytes_writer_reserve()` to
+ * the data.
+ *
+ * Several commits may follow a single reservation, as long as their total does not exceed the reserved size.
+ *
+ * @param this_: The writer.
+ * @param written: The number of bytes written into the reserved buffer.
+ * @return 0 in case of success, `Z_EINVAL` if `written` exceeds the remaining size of the reserved buffer.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_bytes_writer_commit(struct z_loaned_bytes_writer_t *this_,
+                                 size_t written);
+#endif
+/**
+ * Drops `this_`, resetting it to gravestone value.
+ */
+ZENOHC_API void z_bytes_writer_drop(struct z_moved_bytes_writer_t *this_);
+/**
+ * @brief Constructs a data writer with empty payload.
+ * @param this_: An uninitialized memory location where writer is to be constructed.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+ZENOHC_API z_result_t z_bytes_writer_empty(struct z_owned_bytes_writer_t *this_);
+/**
+ * @brief Drop writer and extract underlying `bytes` object it was writing to.
+ * @param this_: A writer instance.
+ * @param bytes: An uninitialized memory location where `bytes` object` will be written to.
+ */
+ZENOHC_API
+void z_bytes_writer_finish(struct z_moved_bytes_writer_t *this_,
+                           struct z_owned_bytes_t *bytes);
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs a data writer with empty payload, whose buffers are allocated from an SHM provider.
+ *
+ * Data written with `z_bytes_writer_reserve()` or `z_bytes_writer_write_all()` goes into SHM buffers of at least
+ * `chunk_size` bytes, a new buffer being allocated whenever the current one is full, so that the payload returned
+ * by `z_bytes_writer_finish()` is delivered without copy to the subscribers sharing the SHM segments. SHM buffers can
+ * not be shrunk: the data of a buffer which is not filled when the payload is finished, or when data is appended with
+ * `z_bytes_writer_append()`, is copied into a new SHM buffer of the exact size. Passing the expected size of the
+ * payload as `chunk_size` and reserving it at once thus avoids any copy if the reservation is filled.
+ *
+ * Buffers are allocated with the garbage collection policy. If the provider has no memory left, the writer falls back
+ * to heap buffers, so that writing never fails.
+ *
+ * @param this_: An uninitialized memory location where writer is to be constructed.
+ * @param provider: The SHM provider, which should outlive the writer.
+ * @param chunk_size: The minimum size of the allocated SHM buffers, ideally the expected size of the payload.
+ * @return 0 in case of success, `Z_EINVAL` if `chunk_size` is 0.
+ */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+z_result_t z_bytes_writer_from_shm_provider(struct z_owned_bytes_writer_t *this_,
+                                            const struct z_loaned_shm_provider_t *provider,
+                                            size_t chunk_size);
+#endif
+/**
+ * Borrows writer.
+ */
+ZENOHC_API
+const struct z_loaned_bytes_writer_t *z_bytes_writer_loan(const struct z_owned_bytes_writer_t *this_);
+/**
+ * Muatably borrows writer.
+ */
+ZENOHC_API
+struct z_loaned_bytes_writer_t *z_bytes_writer_loan_mut(struct z_owned_bytes_writer_t *this_);
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Reserves a buffer of at least `len` bytes at the end of the data, to be written in place.
+ *
+ * This allows serializers to write directly into the memory of the payload:
+ * @code{.c}
+ * uint8_t *buf;
+ * z_bytes_writer_reserve(z_loan_mut(writer), max_len, &buf);
+ * size_t written = encode_message(msg, buf, max_len);
+ * z_bytes_writer_commit(z_loan_mut(writer), written);
+ * @endcode
+ * The reserved bytes are uninitialized, and are not part of the data until they are committed. The buffer stays valid
+ * until the next call of any function on the writer. If the current buffer can not hold `len` more bytes, the committed
+ * bytes are kept and a new buffer is started, so that payloads built with several reservations may consist of several
+ * slices.
+ *
+ * @param this_: The writer.
+ * @param len: The number of bytes to reserve.
+ * @param buf: A memory location where the pointer to the reserved buffer will be written.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_bytes_writer_reserve(struct z_loaned_bytes_writer_t *this_,
+                                  size_t len,
+                                  uint8_t **buf);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs a data writer with empty payload, whose first buffer for in-place writes will hold at least
+ * `capacity` bytes.
+ *
+ * Passing the expected size of the payload allows `z_bytes_writer_reserve()` to serialize it into a single buffer.
+ * Further buffers, if needed, are allocated with a doubling capacity.
+ *
+ * @param this_: An uninitialized memory location where writer is to be constructed.
+ * @param capacity: The size hint, 0 for the default.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_bytes_writer_with_capacity(struct z_owned_bytes_writer_t *this_,
+                                        size_t capacity);
+#endif
+/**
+ * Writes `len` bytes from `src` into underlying data.
+ *
+ * @return 0 in case of success, negative error code otherwise.
+ */
+ZENOHC_API
+z_result_t z_bytes_writer_write_all(struct z_loaned_bytes_writer_t *this_,
+                                    const void *src,
+                                    size_t len);
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Cancels the queries of a cancellation token.
+ *
+ * The reply callbacks of the queries are dropped right away, or once they return if they are running, e.g. when a
+ * callback cancels its own query. No reply is delivered to them afterwards, so that a FIFO or ring channel is closed
+ * once its pending replies are received. The replies retained by a local consolidation, see
+ * `z_get_options_t::consolidation_capacity`, are still delivered as the callback is dropped. Queries passed the token
+ * later on are not sent, their callback being dropped immediately.
+ *
+ * The queryables, which are not notified, keep replying, the replies being discarded once they are received. The
+ * routing state of the queries is released once they are finalized or time out.
+ *
+ * @return 0.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_cancellation_token_cancel(const struct z_loaned_cancellation_token_t *this_);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs a shallow copy of a cancellation token, cancelling the same queries.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+void z_cancellation_token_clone(struct z_owned_cancellation_token_t *dst,
+                                const struct z_loaned_cancellation_token_t *this_);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Drops cancellation token, resetting it to its gravestone state. The queries are not cancelled.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+void z_cancellation_token_drop(struct z_moved_cancellation_token_t *this_);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns ``true`` if the cancellation token was cancelled, ``false`` otherwise.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+bool z_cancellation_token_is_cancelled(const struct z_loaned_cancellation_token_t *this_);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Borrows cancellation token.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+const struct z_loaned_cancellation_token_t *z_cancellation_token_loan(const struct z_owned_cancellation_token_t *this_);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs a cancellation token, which cancels the queries it is passed to with `z_get_options_t` or
+ * `z_querier_get_options_t`.
+ *
+ * The token is moved into the options, so that a clone of it, obtained with `z_cancellation_token_clone()`, is
+ * kept to cancel the queries with `z_cancellation_token_cancel()`, e.g. once the first good reply is received.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+void z_cancellation_token_new(struct z_owned_cancellation_token_t *this_);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Deletes Chunk Alloc Result.
+ */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+void z_chunk_alloc_result_drop(struct z_moved_chunk_alloc_result_t *this_);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Creates a new Chunk Alloc Result with Error value.
+ */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+void z_chunk_alloc_result_new_error(struct z_owned_chunk_alloc_result_t *this_,
+                                    enum z_alloc_error_t alloc_error);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Creates a new Chunk Alloc Result with Ok value.
+ */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+z_result_t z_chunk_alloc_result_new_ok(struct z_owned_chunk_alloc_result_t *this_,
+                                       struct z_allocated_chunk_t allocated_chunk);
+#endif
+/**
+ * Offsets `time` by `duration` milliseconds.
+ */
+ZENOHC_API void z_clock_advance_ms(struct z_clock_t *time, uint64_t duration);
+/**
+ * Offsets `time` by `duration` nanoseconds.
+ */
+ZENOHC_API void z_clock_advance_ns(struct z_clock_t *time, uint64_t duration);
+/**
+ * Offsets `time` by `duration` seconds.
+ */
+ZENOHC_API void z_clock_advance_s(struct z_clock_t *time, uint64_t duration);
+/**
+ * Offsets `time` by `duration` microseconds.
+ */
+ZENOHC_API void z_clock_advance_us(struct z_clock_t *time, uint64_t duration);
+/**
+ * Get number of milliseconds passed since creation of `time`.
+ */
+ZENOHC_API uint64_t z_clock_elapsed_ms(const struct z_clock_t *time);
+/**
+ * Get number of nanoseconds passed since creation of `time`.
+ */
+ZENOHC_API uint64_t z_clock_elapsed_ns(const struct z_clock_t *time);
+/**
+ * Get number of seconds passed since creation of `time`.
+ */
+ZENOHC_API uint64_t z_clock_elapsed_s(const struct z_clock_t *time);
+/**
+ * Get number of microseconds passed since creation of `time`.
+ */
+ZENOHC_API uint64_t z_clock_elapsed_us(const struct z_clock_t *time);
+/**
+ * Returns monotonic clock time point corresponding to the current time instant.
+ */
+ZENOHC_API struct z_clock_t z_clock_now(void);
+/**
+ * Closes zenoh session. This also drops all the closure callbacks remaining from dropped, but not undeclared subscribers.
+ *
+ * @return `0` in case of success, a negative value if an error occured while closing the session.
+ */
+ZENOHC_API
+z_result_t z_close(struct z_loaned_session_t *session,
+                   struct z_close_options_t *options);
+/**
+ * Constructs the default value for `z_close_options_t`.
+ */
+ZENOHC_API void z_close_options_default(struct z_close_options_t *this_);
+/**
+ * @brief Constructs closure.
+ * A closure is a structure that contains all the elements for stateful, memory-leak-free callbacks:
+ *
+ * Closures are not guaranteed not to be called concurrently.
+ *
+ * It is guaranteed that:
+ *
+ *   - `call` will never be called once `drop` has started.
+ *   - `drop` will only be called **once**, and **after every** `call` has ended.
+ *   - The two previous guarantees imply that `call` and `drop` are never called concurrently.
+ * @param this_: uninitialized memory location where new closure will be constructed.
+ * @param call: a closure body.
+ * @param drop: an optional function to be called once on closure drop.
+ * @param context: closure context.
+ */
+ZENOHC_API
+void z_closure_hello(struct z_owned_closure_hello_t *this_,
+                     void (*call)(struct z_loaned_hello_t *hello, void *context),
+                     void (*drop)(void *context),
+                     void *context);
+/**
+ * Calls the closure. Calling an uninitialized closure is a no-op.
+ */
+ZENOHC_API
+void z_closure_hello_call(const struct z_loaned_closure_hello_t *closure,
+                          struct z_loaned_hello_t *hello);
+/**
+ * Drops the closure. Droping an uninitialized closure is a no-op.
+ */
+ZENOHC_API void z_closure_hello_drop(struct z_moved_closure_hello_t *this_);
+/**
+ * Borrows closure.
+ */
+ZENOHC_API
+const struct z_loaned_closure_hello_t *z_closure_hello_loan(const struct z_owned_closure_hello_t *closure);
+/**
+ * Mutably norrows closure.
+ */
+ZENOHC_API
+struct z_loaned_closure_hello_t *z_closure_hello_loan_mut(struct z_owned_closure_hello_t *closure);
+/**
+ * @brief Constructs closure.
+ *
+ * Closures are not guaranteed not to be called concurrently.
+ *
+ * It is guaranteed that:
+ *   - `call` will never be called once `drop` has started.
+ *   - `drop` will only be called **once**, and **after every** `call` has ended.
+ *   - The two previous guarantees imply that `call` and `drop` are never called concurrently.
+ * @param this_: uninitialized memory location where new closure will be constructed.
+ * @param call: a closure body.
+ * @param drop: an optional function to be called once on closure drop.
+ * @param context: closure context.
+ */
+ZENOHC_API
+void z_closure_query(struct z_owned_closure_query_t *this_,
+                     void (*call)(struct z_loaned_query_t *query, void *context),
+                     void (*drop)(void *context),
+                     void *context);
+/**
+ * Calls the closure. Calling an uninitialized closure is a no-op.
+ */
+ZENOHC_API
+void z_closure_query_call(const struct z_loaned_closure_query_t *closure,
+                          struct z_loaned_query_t *query);
+/**
+ * Drops the closure, resetting it to its gravestone state.
+ */
+ZENOHC_API void z_closure_query_drop(struct z_moved_closure_query_t *closure_);
+/**
+ * Borrows closure.
+ */
+ZENOHC_API
+const struct z_loaned_closure_query_t *z_closure_query_loan(const struct z_owned_closure_query_t *closure);
+/**
+ * Mutably borrows closure.
+ */
+ZENOHC_API
+struct z_loaned_closure_query_t *z_closure_query_loan_mut(struct z_owned_closure_query_t *closure);
+/**
+ * @brief Constructs closure.
+ *
+ * Closures are not guaranteed not to be called concurrently.
+ *
+ * It is guaranteed that:
+ *   - `call` will never be called once `drop` has started.
+ *   - `drop` will only be called **once**, and **after every** `call` has ended.
+ *   - The two previous guarantees imply that `call` and `drop` are never called concurrently.
+ * @param this_: uninitialized memory location where new closure will be constructed.
+ * @param call: a closure body.
+ * @param drop: an optional function to be called once on closure drop.
+ * @param context: closure context.
+ */
+ZENOHC_API
+void z_closure_reply(struct z_owned_closure_reply_t *this_,
+                     void (*call)(struct z_loaned_reply_t *reply, void *context),
+                     void (*drop)(void *context),
+                     void *context);
+/**
+ * Calls the closure. Calling an uninitialized closure is a no-op.
+ */
+ZENOHC_API
+void z_closure_reply_call(const struct z_loaned_closure_reply_t *closure,
+                          struct z_loaned_reply_t *reply);
+/**
+ * Drops the closure, resetting it to its gravestone state. Droping an uninitialized closure is a no-op.
+ */
+ZENOHC_API
+void z_closure_reply_drop(struct z_moved_closure_reply_t *closure_);
+/**
+ * Borrows closure.
+ */
+ZENOHC_API
+const struct z_loaned_closure_reply_t *z_closure_reply_loan(const struct z_owned_closure_reply_t *closure);
+/**
+ * Mutably borrows closure.
+ */
+ZENOHC_API
+struct z_loaned_closure_reply_t *z_closure_reply_loan_mut(struct z_owned_closure_reply_t *closure);
+/**
+ * @brief Constructs closure.
+ *
+ * Closures are not guaranteed not to be called concurrently.
+ *
+ * It is guaranteed that:
+ *   - `call` will never be called once `drop` has started.
+ *   - `drop` will only be called **once**, and **after every** `call` has ended.
+ *   - The two previous guarantees imply that `call` and `drop` are never called concurrently.
+ * @param this_: uninitialized memory location where new closure will be constructed.
+ * @param call: a closure body.
+ * @param drop: an optional function to be called once on closure drop.
+ * @param context: closure context.
+ */
+ZENOHC_API
+void z_closure_sample(struct z_owned_closure_sample_t *this_,
+                      void (*call)(struct z_loaned_sample_t *sample, void *context),
+                      void (*drop)(void *context),
+                      void *context);
+/**
+ * Calls the closure. Calling an uninitialized closure is a no-op.
+ */
+ZENOHC_API
+void z_closure_sample_call(const struct z_loaned_closure_sample_t *closure,
+                           struct z_loaned_sample_t *sample);
+/**
+ * Drops the closure. Droping an uninitialized closure is a no-op.
+ */
+ZENOHC_API void z_closure_sample_drop(struct z_moved_closure_sample_t *closure_);
+/**
+ * Borrows closure.
+ */
+ZENOHC_API
+const struct z_loaned_closure_sample_t *z_closure_sample_loan(const struct z_owned_closure_sample_t *closure);
+/**
+ * Mutably borrows closure.
+ */
+ZENOHC_API
+struct z_loaned_closure_sample_t *z_closure_sample_loan_mut(struct z_owned_closure_sample_t *closure);
+/**
+ * @brief Constructs closure.
+ *
+ * Closures are not guaranteed not to be called concurrently.
+ *
+ * It is guaranteed that:
+ *   - `call` will never be called once `drop` has started.
+ *   - `drop` will only be called **once**, and **after every** `call` has ended.
+ *   - The two previous guarantees imply that `call` and `drop` are never called concurrently.
+ * @param this_: uninitialized memory location where new closure will be constructed.
+ * @param call: a closure body.
+ * @param drop: an optional function to be called once on closure drop.
+ * @param context: closure context.
+ */
+ZENOHC_API
+void z_closure_zid(struct z_owned_closure_zid_t *this_,
+                   void (*call)(const struct z_id_t *z_id, void *context),
+                   void (*drop)(void *context),
+                   void *context);
+/**
+ * @brief Calls the closure. Calling an uninitialized closure is a no-op.
+ */
+ZENOHC_API
+void z_closure_zid_call(const struct z_loaned_closure_zid_t *closure,
+                        const struct z_id_t *z_id);
+/**
+ * @brief Drops the closure, resetting it to its gravestone state. Droping an uninitialized (null) closure is a no-op.
+ */
+ZENOHC_API
+void z_closure_zid_drop(struct z_moved_closure_zid_t *closure_);
+/**
+ * @brief Borrows closure.
+ */
+ZENOHC_API
+const struct z_loaned_closure_zid_t *z_closure_zid_loan(const struct z_owned_closure_zid_t *closure);
+/**
+ * @brief Mutably borrows closure.
+ */
+ZENOHC_API
+const struct z_loaned_closure_zid_t *z_closure_zid_loan_mut(const struct z_owned_closure_zid_t *closure);
+/**
+ * Drops conditional variable.
+ */
+ZENOHC_API void z_condvar_drop(struct z_moved_condvar_t *this_);
+/**
+ * Constructs conditional variable.
+ */
+ZENOHC_API void z_condvar_init(struct z_owned_condvar_t *this_);
+/**
+ * Borrows conditional variable.
+ */
+ZENOHC_API const struct z_loaned_condvar_t *z_condvar_loan(const struct z_owned_condvar_t *this_);
+/**
+ * Mutably borrows conditional variable.
+ */
+ZENOHC_API struct z_loaned_condvar_t *z_condvar_loan_mut(struct z_owned_condvar_t *this_);
+/**
+ * Wakes up one blocked thread waiting on this condiitonal variable.
+ * @return 0 in case of success, negative error code in case of failure.
+ */
+ZENOHC_API z_result_t z_condvar_signal(const struct z_loaned_condvar_t *this_);
+/**
+ * Blocks the current thread until the conditional variable receives a notification.
+ *
+ * The function atomically unlocks the guard mutex `m` and blocks the current thread.
+ * When the function returns the lock will have been re-aquired again.
+ * Note: The function may be subject to spurious wakeups.
+ */
+ZENOHC_API
+z_result_t z_condvar_wait(const struct z_loaned_condvar_t *this_,
+                          struct z_loaned_mutex_t *m);
+/**
+ * Blocks the current thread until the conditional variable receives a notification, or until `deadline`.
+ *
+ * The function atomically unlocks the guard mutex `m` and blocks the current thread.
+ * When the function returns the lock will have been re-aquired again, also if the wait timed out.
+ * Note: The function may be subject to spurious wakeups.
+ *
+ * @param this_: The conditional variable.
+ * @param m: The locked guard mutex.
+ * @param deadline: The time point at which to stop waiting, e.g. `z_clock_now()` advanced with `z_clock_advance_ms()`.
+ * @return 0 if the conditional variable was notified, `Z_ETIMEDOUT` if `deadline` was reached, negative error code
+ * otherwise.
+ */
+ZENOHC_API
+z_result_t z_condvar_wait_until(const struct z_loaned_condvar_t *this_,
+                                struct z_loaned_mutex_t *m,
+                                const struct z_clock_t *deadline);
+/**
+ * Clones the config into provided uninitialized memory location.
+ */
+ZENOHC_API void z_config_clone(struct z_owned_config_t *dst, const struct z_loaned_config_t *this_);
+/**
+ * Constructs a new empty configuration.
+ */
+ZENOHC_API z_result_t z_config_default(struct z_owned_config_t *this_);
+/**
+ * Frees `config`, and resets it to its gravestone state.
+ */
+ZENOHC_API void z_config_drop(struct z_moved_config_t *this_);
+/**
+ * Borrows config.
+ */
+ZENOHC_API const struct z_loaned_config_t *z_config_loan(const struct z_owned_config_t *this_);
+/**
+ * Mutably borrows config.
+ */
+ZENOHC_API struct z_loaned_config_t *z_config_loan_mut(struct z_owned_config_t *this_);
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs send and recieve ends of a conflating channel, keeping only the latest sample of each key expression.
+ *
+ * A sample received while a sample with the same key expression is pending replaces it in place, so a consumer falling
+ * behind reads the current value of each key instead of a backlog of stale samples, and a burst on a single key does not
+ * push out the samples of the other keys, as it would with a ring channel under a wildcard subscription. Samples are
+ * received in the order in which their key became pending. The memory is bounded by the number of distinct keys.
+ *
+ * @param callback: An uninitialized memory location where the callback will be constructed.
+ * @param handler: An uninitialized memory location where the handler will be constructed.
+ * @param per_source: If ``true``, samples only replace the pending sample with the same key expression and the same
+ * source id (see `z_source_info_id()`), so that the latest sample of each publisher of a key is kept.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+void z_conflating_channel_sample_new(struct z_owned_closure_sample_t *callback,
+                                     struct z_owned_conflating_handler_sample_t *handler,
+                                     bool per_source);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Drops the handler and resets it to a gravestone state.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+void z_conflating_handler_sample_drop(struct z_moved_conflating_handler_sample_t *this_);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Borrows handler.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+const struct z_loaned_conflating_handler_sample_t *z_conflating_handler_sample_loan(const struct z_owned_conflating_handler_sample_t *this_);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns the oldest pending sample. If there are no pending samples will block until next sample is received, or until
+ * the channel is dropped (normally when there are no more samples to receive).
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the sample will be in the gravestone state).
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_conflating_handler_sample_recv(const struct z_loaned_conflating_handler_sample_t *this_,
+                                            struct z_owned_sample_t *sample);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns the oldest pending sample. If there are no pending samples will return immediately (with sample set to its gravestone state).
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the sample will be in the gravestone state),
+ * `Z_CHANNEL_NODATA` if the channel is still alive, but no sample is pending (the sample will be in the gravestone state).
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_conflating_handler_sample_try_recv(const struct z_loaned_conflating_handler_sample_t *this_,
+                                                struct z_owned_sample_t *sample);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs send and recieve ends of a flow-controlled reply channel.
+ *
+ * Each received reply consumes one unit of the credit granted by the consumer, starting with `credit`, and further
+ * credit is only granted explicitly with `z_credit_handler_reply_grant()`. Once the credit is exhausted, the reply
+ * callback blocks, applying back-pressure to the transport: remote queryables replying with
+ * `Z_CONGESTION_CONTROL_BLOCK` (the default) then block in `z_query_reply()` once their transmission queue is full.
+ * This way a query returning a large number of replies is streamed with bounded memory on both ends.
+ *
+ * Note that while the callback is blocked, the other messages received on the same link are delayed as well, so the
+ * consumer should keep granting credit while it processes replies.
+ *
+ * The callback blocks the thread delivering the reply. For a queryable declared on the same session, this is the
+ * thread calling `z_query_reply()`, which is the thread calling `z_get()` when the query is answered from the
+ * queryable callback itself. Credit must therefore be granted from a thread other than the one issuing the query,
+ * and a local queryable must not wait for the consumer while replying, otherwise both ends deadlock once the credit is
+ * exhausted.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+void z_credit_channel_reply_new(struct z_owned_closure_reply_t *callback,
+                                struct z_owned_credit_handler_reply_t *handler,
+                                size_t credit);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns the number of replies that can still be received before the reply callback blocks.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+size_t z_credit_handler_reply_credit(const struct z_loaned_credit_handler_reply_t *this_);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Drops the handler and resets it to a gravestone state.
+ *
+ * The pending replies are dropped, as well as all the replies received afterwards.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+void z_credit_handler_reply_drop(struct z_moved_credit_handler_reply_t *this_);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Grants the reception of `n` more replies, unblocking the reply callback if it was waiting for credit.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+void z_credit_handler_reply_grant(const struct z_loaned_credit_handler_reply_t *this_,
+                                  size_t n);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Borrows handler.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+const struct z_loaned_credit_handler_reply_t *z_credit_handler_reply_loan(const struct z_owned_credit_handler_reply_t *this_);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns reply from the credit buffer. If there are no more pending replies will block until next reply is received, or until
+ * the channel is dropped (normally when all replies are received). Receiving a reply does not grant any new credit.
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the reply will be in the gravestone state).
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_credit_handler_reply_recv(const struct z_loaned_credit_handler_reply_t *this_,
+                                       struct z_owned_reply_t *reply);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns reply from the credit buffer. If there are no more pending replies will return immediately (with reply set to its gravestone state).
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the reply will be in the gravestone state),
+ * `Z_CHANNEL_NODATA` if the channel is still alive, but its buffer is empty (the reply will be in the gravestone state).
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_credit_handler_reply_try_recv(const struct z_loaned_credit_handler_reply_t *this_,
+                                           struct z_owned_reply_t *reply);
+#endif
+/**
+ * Declares a background queryable for a given keyexpr. The queryable callback will be be called
+ * to proccess incoming queries until the corresponding session is closed or dropped.
+ *
+ * @param session: The zenoh session.
+ * @param key_expr: The key expression the Queryable will reply to.
+ * @param callback: The callback function that will be called each time a matching query is received. Its ownership is passed to queryable.
+ * @param options: Options for the queryable.
+ *
+ * @return 0 in case of success, negative error code otherwise (in this case )
+ */
+ZENOHC_API
+z_result_t z_declare_background_queryable(const struct z_loaned_session_t *session,
+                                          const struct z_loaned_keyexpr_t *key_expr,
+                                          struct z_moved_closure_query_t *callback,
+                                          struct z_queryable_options_t *options);
+/**
+ * Constructs and declares a background subscriber. Subscriber callback will be called to process the messages,
+ * until the corresponding session is closed or dropped.
+ *
+ * @param session: The zenoh session.
+ * @param key_expr: The key expression to subscribe.
+ * @param callback: The callback function that will be called each time a data matching the subscribed expression is received.
+ * @param options: The options to be passed to the subscriber declaration.
+ *
+ * @return 0 in case of success, negative error code otherwise.
+ */
+ZENOHC_API
+z_result_t z_declare_background_subscriber(const struct z_loaned_session_t *session,
+                                           const struct z_loaned_keyexpr_t *key_expr,
+                                           struct z_moved_closure_sample_t *callback,
+                                           struct z_subscriber_options_t *options);
+/**
+ * Constructs and declares a key expression on the network. This reduces key key expression to a numerical id,
+ * which allows to save the bandwitdth, when passing key expression between Zenoh entities.
+ *
+ * @param session: Session on which to declare key expression.
+ * @param declared_key_expr: An uninitialized location in memory where key expression will be constructed.
+ * @param key_expr: Key expression to declare on network.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+ZENOHC_API
+z_result_t z_declare_keyexpr(const struct z_loaned_session_t *session,
+                             struct z_owned_keyexpr_t *declared_key_expr,
+                             const struct z_loaned_keyexpr_t *key_expr);
+/**
+ * Constructs and declares a publisher for the given key expression.
+ *
+ * Data can be put and deleted with this publisher with the help of the
+ * `z_publisher_put()` and `z_publisher_delete()` functions.
+ *
+ * @param session: The Zenoh session.
+ * @param publisher: An uninitialized location in memory where publisher will be constructed.
+ * @param key_expr: The key expression to publish.
+ * @param options: Additional options for the publisher.
+ *
+ * @return 0 in case of success, negative error code otherwise.
+ */
+ZENOHC_API
+z_result_t z_declare_publisher(const struct z_loaned_session_t *session,
+                               struct z_owned_publisher_t *publisher,
+                               const struct z_loaned_keyexpr_t *key_expr,
+                               struct z_publisher_options_t *options);
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs and declares a querier on the given key expression.
+ *
+ * The queries can be send with the help of the `z_querier_get()` function.
+ *
+ * @param session: The Zenoh session.
+ * @param querier: An uninitialized location in memory where querier will be constructed.
+ * @param key_expr: The key expression to send queries on.
+ * @param options: Additional options for the querier.
+ *
+ * @return 0 in case of success, negative error code otherwise.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_declare_querier(const struct z_loaned_session_t *session,
+                             struct z_owned_querier_t *querier,
+                             const struct z_loaned_keyexpr_t *key_expr,
+                             struct z_querier_options_t *options);
+#endif
+/**
+ * Constructs a Queryable for the given key expression.
+ *
+ * @param session: A Zenoh session.
+ * @param queryable: An uninitialized memory location where queryable will be constructed.
+ * @param key_expr: The key expression the Queryable will reply to.
+ * @param callback: The callback function that will be called each time a matching query is received. Its ownership is passed to queryable.
+ * @param options: Options for the queryable.
+ *
+ * @return 0 in case of success, negative error code otherwise (in this case )
+ */
+ZENOHC_API
+z_result_t z_declare_queryable(const struct z_loaned_session_t *session,
+                               struct z_owned_queryable_t *queryable,
+                               const struct z_loaned_keyexpr_t *key_expr,
+                               struct z_moved_closure_query_t *callback,
+                               struct z_queryable_options_t *options);
+/**
+ * Constructs and declares a subscriber for a given key expression. Dropping subscriber undeclares its callback.
+ *
+ * @param session: The zenoh session.
+ * @param subscriber: An uninitialized location in memory, where subscriber will be constructed.
+ * @param key_expr: The key expression to subscribe.
+ * @param callback: The callback function that will be called each time a data matching the subscribed expression is received.
+ * @param options: The options to be passed to the subscriber declaration.
+ *
+ * @return 0 in case of success, negative error code otherwise (in this case subscriber will be in its gravestone state).
+ */
+ZENOHC_API
+z_result_t z_declare_subscriber(const struct z_loaned_session_t *session,
+                                struct z_owned_subscriber_t *subscriber,
+                                const struct z_loaned_keyexpr_t *key_expr,
+                                struct z_moved_closure_sample_t *callback,
+                                struct z_subscriber_options_t *options);
+/**
+ * Sends request to delete data on specified key expression (used when working with <a href="https://zenoh.io/docs/manual/abstractions/#storage"> Zenoh storages </a>).
+ *
+ * @param session: The zenoh session.
+ * @param key_expr: The key expression to delete.
+ * @param options: The delete options.
+ *
+ * @return 0 in case of success, negative values in case of failure.
+ */
+ZENOHC_API
+z_result_t z_delete(const struct z_loaned_session_t *session,
+                    const struct z_loaned_keyexpr_t *key_expr,
+                    struct z_delete_options_t *options);
+/**
+ * Constructs the default value for `z_delete_options_t`.
+ */
+ZENOHC_API void z_delete_options_default(struct z_delete_options_t *this_);
+/**
+ * A Concise Binary Object Representation (CBOR)-encoded data.
+ *
+ * Constant alias for string: `"application/cbor"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_cbor(void);
+/**
+ * A Common Data Representation (CDR)-encoded data.
+ *
+ * Constant alias for string: `"application/cdr"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_cdr(void);
+/**
+ * Constrained Application Protocol (CoAP) data intended for CoAP-to-HTTP and HTTP-to-CoAP proxies.
+ *
+ * Constant alias for string: `"application/coap-payload"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_coap_payload(void);
+/**
+ * A Java serialized object.
+ *
+ * Constant alias for string: `"application/java-serialized-object"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_java_serialized_object(void);
+/**
+ * JSON data intended to be consumed by an application.
+ *
+ * Constant alias for string: `"application/json"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_json(void);
+/**
+ * Defines a JSON document structure for expressing a sequence of operations to apply to a JSON document.
+ *
+ * Constant alias for string: `"application/json-patch+json"`.
+ */
+ZENOHC_API
+const struct z_loaned_encoding_t *z_encoding_application_json_patch_json(void);
+/**
+ * A JSON text sequence consists of any number of JSON texts, all encoded in UTF-8.
+ *
+ * Constant alias for string: `"application/json-seq"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_json_seq(void);
+/**
+ * A JSONPath defines a string syntax for selecting and extracting JSON values from within a given JSON value.
+ *
+ * Constant alias for string: `"application/jsonpath"`.
+ */
+ZENOHC_API
+const struct z_loaned_encoding_t *z_encoding_application_jsonpath(void);
+/**
+ * A JSON Web Token (JWT).
+ *
+ * Constant alias for string: `"application/jwt"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_jwt(void);
+/**
+ * An application-specific MPEG-4 encoded data, either audio or video.
+ *
+ * Constant alias for string: `"application/mp4"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_mp4(void);
+/**
+ * An application-specific stream of bytes.
+ *
+ * Constant alias for string: `"application/octet-stream"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_octet_stream(void);
+/**
+ * An [openmetrics](https://github.com/OpenObservability/OpenMetrics) data, common used by [Prometheus](https://prometheus.io/).
+ *
+ * Constant alias for string: `"application/openmetrics-text"`.
+ */
+ZENOHC_API
+const struct z_loaned_encoding_t *z_encoding_application_openmetrics_text(void);
+/**
+ * An application-specific protobuf-encoded data.
+ *
+ * Constant alias for string: `"application/protobuf"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_protobuf(void);
+/**
+ * A Python object serialized using [pickle](https://docs.python.org/3/library/pickle.html).
+ *
+ * Constant alias for string: `"application/python-serialized-object"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_python_serialized_object(void);
+/**
+ * A SOAP 1.2 message serialized as XML 1.0.
+ *
+ * Constant alias for string: `"application/soap+xml"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_soap_xml(void);
+/**
+ * An application-specific SQL query.
+ *
+ * Constant alias for string: `"application/sql"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_sql(void);
+/**
+ * An encoded a list of tuples, each consisting of a name and a value.
+ *
+ * Constant alias for string: `"application/x-www-form-urlencoded"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_x_www_form_urlencoded(void);
+/**
+ * An XML file intended to be consumed by an application..
+ *
+ * Constant alias for string: `"application/xml"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_xml(void);
+/**
+ * YAML data intended to be consumed by an application.
+ *
+ * Constant alias for string: `"application/yaml"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_yaml(void);
+/**
+ * A YANG-encoded data commonly used by the Network Configuration Protocol (NETCONF).
+ *
+ * Constant alias for string: `"application/yang"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_yang(void);
+/**
+ * A MPEG-4 Advanced Audio Coding (AAC) media.
+ *
+ * Constant alias for string: `"audio/aac"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_audio_aac(void);
+/**
+ * A Free Lossless Audio Codec (FLAC) media.
+ *
+ * Constant alias for string: `"audio/flac"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_audio_flac(void);
+/**
+ * An audio codec defined in MPEG-1, MPEG-2, MPEG-4, or registered at the MP4 registration authority.
+ *
+ * Constant alias for string: `"audio/mp4"`.
+ */
+ZENOHC_API
+const struct z_loaned_encoding_t *z_encoding_audio_mp4(void);
+/**
+ * An Ogg-encapsulated audio stream.
+ *
+ * Constant alias for string: `"audio/ogg"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_audio_ogg(void);
+/**
+ * A Vorbis-encoded audio stream.
+ *
+ * Constant alias for string: `"audio/vorbis"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_audio_vorbis(void);
+/**
+ * Constructs an owned copy of the encoding in provided uninitilized memory location.
+ */
+ZENOHC_API
+void z_encoding_clone(struct z_owned_encoding_t *dst,
+                      const struct z_loaned_encoding_t *this_);
+/**
+ * Frees the memory and resets the encoding it to its default value.
+ */
+ZENOHC_API void z_encoding_drop(struct z_moved_encoding_t *this_);
+/**
+ * Returns ``true`` if `this_` equals to `other`, ``false`` otherwise.
+ */
+ZENOHC_API
+bool z_encoding_equals(const struct z_loaned_encoding_t *this_,
+                       const struct z_loaned_encoding_t *other);
+/**
+ * Constructs a `z_owned_encoding_t` from a specified string.
+ */
+ZENOHC_API z_result_t z_encoding_from_str(struct z_owned_encoding_t *this_, const char *s);
+/**
+ * Constructs a `z_owned_encoding_t` from a specified substring.
+ */
+ZENOHC_API
+z_result_t z_encoding_from_substr(struct z_owned_encoding_t *this_,
+                                  const char *s,
+                                  size_t len);
+/**
+ * A BitMap (BMP) image.
+ *
+ * Constant alias for string: `"image/bmp"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_image_bmp(void);
+/**
+ * A Graphics Interchange Format (GIF) image.
+ *
+ * Constant alias for string: `"image/gif"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_image_gif(void);
+/**
+ * A Joint Photographic Experts Group (JPEG) image.
+ *
+ * Constant alias for string: `"image/jpeg"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_image_jpeg(void);
+/**
+ * A Portable Network Graphics (PNG) image.
+ *
+ * Constant alias for string: `"image/png"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_image_png(void);
+/**
+ * A Web Portable (WebP) image.
+ *
+ *  Constant alias for string: `"image/webp"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_image_webp(void);
+/**
+ * Borrows encoding.
+ */
+ZENOHC_API
+const struct z_loaned_encoding_t *z_encoding_loan(const struct z_owned_encoding_t *this_);
+/**
+ * Returns a loaned default `z_loaned_encoding_t`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_loan_default(void);
+/**
+ * Mutably borrows encoding.
+ */
+ZENOHC_API struct z_loaned_encoding_t *z_encoding_loan_mut(struct z_owned_encoding_t *this_);
+/**
+ * Set a schema to this encoding from a c string. Zenoh does not define what a schema is and its semantichs is left to the implementer.
+ * E.g. a common schema for `text/plain` encoding is `utf-8`.
+ */
+ZENOHC_API
+z_result_t z_encoding_set_schema_from_str(struct z_loaned_encoding_t *this_,
+                                          const char *s);
+/**
+ * Set a schema to this encoding from a c substring. Zenoh does not define what a schema is and its semantichs is left to the implementer.
+ * E.g. a common schema for `text/plain` encoding is `utf-8`.
+ */
+ZENOHC_API
+z_result_t z_encoding_set_schema_from_substr(struct z_loaned_encoding_t *this_,
+                                             const char *s,
+                                             size_t len);
+/**
+ * A CSS file.
+ *
+ * Constant alias for string: `"text/css"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_text_css(void);
+/**
+ * A CSV file.
+ *
+ * Constant alias for string: `"text/csv"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_text_csv(void);
+/**
+ * An HTML file.
+ *
+ * Constant alias for string: `"text/html"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_text_html(void);
+/**
+ * A JavaScript file.
+ *
+ * Constant alias for string: `"text/javascript"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_text_javascript(void);
+/**
+ * JSON data intended to be human readable.
+ *
+ * Constant alias for string: `"text/json"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_text_json(void);
+/**
+ * JSON5 encoded data that are human readable.
+ *
+ * Constant alias for string: `"text/json5"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_text_json5(void);
+/**
+ * A MarkDown file.
+ *
+ * Constant alias for string: `"text/markdown"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_text_markdown(void);
+/**
+ * A textual file.
+ *
+ * Constant alias for string: `"text/plain"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_text_plain(void);
+/**
+ * An XML file that is human readable.
+ *
+ * Constant alias for string: `"text/xml"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_text_xml(void);
+/**
+ * YAML data intended to be human readable.
+ *
+ * Constant alias for string: `"text/yaml"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_text_yaml(void);
+/**
+ * Constructs an owned non-null-terminated string from encoding
+ *
+ * @param this_: Encoding.
+ * @param out_str: Uninitialized memory location where a string to be constructed.
+ */
+ZENOHC_API
+void z_encoding_to_string(const struct z_loaned_encoding_t *this_,
+                          struct z_owned_string_t *out_str);
+/**
+ * A h261-encoded video stream.
+ *
+ * Constant alias for string: `"video/h261"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_video_h261(void);
+/**
+ * A h263-encoded video stream.
+ *
+ * Constant alias for string: `"video/h263"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_video_h263(void);
+/**
+ * A h264-encoded video stream.
+ *
+ * Constant alias for string: `"video/h264"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_video_h264(void);
+/**
+ * A h265-encoded video stream.
+ *
+ * Constant alias for string: `"video/h265"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_video_h265(void);
+/**
+ * A h266-encoded video stream.
+ *
+ * Constant alias for string: `"video/h266"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_video_h266(void);
+/**
+ * A video codec defined in MPEG-1, MPEG-2, MPEG-4, or registered at the MP4 registration authority.
+ *
+ * Constant alias for string: `"video/mp4"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_video_mp4(void);
+/**
+ * An Ogg-encapsulated video stream.
+ *
+ * Constant alias for string: `"video/ogg"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_video_ogg(void);
+/**
+ * An uncompressed, studio-quality video stream.
+ *
+ * Constant alias for string: `"video/raw"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_video_raw(void);
+/**
+ * A VP8-encoded video stream.
+ *
+ * Constant alias for string: `"video/vp8"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_video_vp8(void);
+/**
+ * A VP9-encoded video stream.
+ *
+ * Constant alias for string: `"video/vp9"`.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_video_vp9(void);
+/**
+ * Just some bytes.
+ *
+ * Constant alias for string: `"zenoh/bytes"`.
+ *
+ * This encoding supposes that the payload was created with `z_bytes_from_buf()`, `z_bytes_from_slice()` or
+ * similar functions and its data can be accessed via `z_bytes_to_slice()`.
+ */
+ZENOHC_API
+const struct z_loaned_encoding_t *z_encoding_zenoh_bytes(void);
+/**
+ * Zenoh serialized data.
+ *
+ * Constant alias for string: `"zenoh/serialized"`.
+ *
+ * This encoding supposes that the payload was created with serialization functions.
+ * The `schema` field may contain the details of serialziation format.
+ */
+ZENOHC_API const struct z_loaned_encoding_t *z_encoding_zenoh_serialized(void);
+/**
+ * A UTF-8 string.
+ *
+ * Constant alias for string: `"zenoh/string"`.
+ *
+ * This encoding supposes that the payload was created with `z_bytes_from_str()`, `z_bytes_from_string()` or
+ * similar functions and its data can be accessed via `z_bytes_to_string()`.
+ */
+ZENOHC_API
+const struct z_loaned_encoding_t *z_encoding_zenoh_string(void);
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns the entity id of the entity global id.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+uint32_t z_entity_global_id_eid(const struct z_entity_global_id_t *this_);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns the zenoh id of entity global id.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+struct z_id_t z_entity_global_id_zid(const struct z_entity_global_id_t *this_);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Drops the executor and resets it to its gravestone state.
+ *
+ * The executor is stopped once it is not used anymore by subscribers nor queryables, after running all the tasks
+ * spawned on it. This function then waits for these tasks, unless it is called from one of them.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+void z_executor_drop(struct z_moved_executor_t *this_);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Borrows executor.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+const struct z_loaned_executor_t *z_executor_loan(const struct z_owned_executor_t *this_);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs an executor, a pool of worker threads running short tasks.
+ *
+ * Spawning a task on an executor is much cheaper than starting a thread with `z_task_init()`. Each worker runs the
+ * tasks in the order in which it took them, and idle workers steal the tasks waiting for busy ones. The executor can
+ * also run the workers of subscribers and queryables (see `z_subscriber_options_t::worker_executor`), so that an
+ * application tunes a single set of threads.
+ *
+ * @param this_: An uninitialized memory location where the executor will be constructed.
+ * @param options: The options of the executor, pass NULL to use the default ones.
+ * @return 0 in case of success, `Z_EUNAVAILABLE` if `cpu_affinity_mask` is set and not supported on this platform,
+ * `Z_EINVAL` if the workers could not be pinned, `Z_EAGAIN_MUTEX` if the threads could not be started.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_executor_new(struct z_owned_executor_t *this_,
+                          const struct z_executor_options_t *options);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs the default value for `z_executor_options_t`, with a worker per CPU and no pinning.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+void z_executor_options_default(struct z_executor_options_t *this_);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Spawns a task on the executor.
+ *
+ * The task should not block for long, as it holds a worker while it runs. It must not join another task of the
+ * same executor, which may be waiting for the worker it holds.
+ *
+ * @param this_: The executor.
+ * @param task: An uninitialized memory location where the handle of the task will be constructed, pass NULL to
+ * detach the task. Joining the handle with `z_task_join()` waits for the completion of the task.
+ * @param fun: Function to be executed by the task.
+ * @param arg: Argument that will be passed to the function `fun`.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_executor_spawn(const struct z_loaned_executor_t *this_,
+                            struct z_owned_task_t *task,
+                            void *(*fun)(void *arg),
+                            void *arg);
+#endif
+/**
+ * Constructs send and recieve ends of the fifo channel
+ */
+ZENOHC_API
+void z_fifo_channel_query_new(struct z_owned_closure_query_t *callback,
+                              struct z_owned_fifo_handler_query_t *handler,
+                              size_t capacity);
+/**
+ * Constructs send and recieve ends of the fifo channel
+ */
+ZENOHC_API
+void z_fifo_channel_reply_new(struct z_owned_closure_reply_t *callback,
+                              struct z_owned_fifo_handler_reply_t *handler,
+                              size_t capacity);
+/**
+ * Constructs send and recieve ends of the fifo channel
+ */
+ZENOHC_API
+void z_fifo_channel_sample_new(struct z_owned_closure_sample_t *callback,
+                               struct z_owned_fifo_handler_sample_t *handler,
+                               size_t capacity);
+/**
+ * Drops the handler and resets it to a gravestone state.
+ */
+ZENOHC_API void z_fifo_handler_query_drop(struct z_moved_fifo_handler_query_t *this_);
+/**
+ * Borrows handler.
+ */
+ZENOHC_API
+const struct z_loaned_fifo_handler_query_t *z_fifo_handler_query_loan(const struct z_owned_fifo_handler_query_t *this_);
+/**
+ * Returns query from the fifo buffer. If there are no more pending queries will block until next query is received, or until
+ * the channel is dropped (normally when Queryable is dropped).
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the query will be in the gravestone state),
+ * `Z_CHANNEL_NODATA` if the channel is still alive, but its buffer is empty (the query will be in the gravestone state).
+ */
+ZENOHC_API
+z_result_t z_fifo_handler_query_recv(const struct z_loaned_fifo_handler_query_t *this_,
+                                     struct z_owned_query_t *query);
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Receives up to `capacity` queries from the fifo buffer at once. If there are no pending queries will block until next query is received,
+ * or until the channel is dropped (normally when Queryable is dropped). Once at least one query is received, all the queries that are already
+ * pending are returned without blocking.
+ *
+ * @param this_: The handler.
+ * @param queries: A pointer to an array of at least `capacity` uninitialized queries. Only the first `n` elements are initialized upon return.
+ * @param capacity: The maximum number of queries to receive.
+ * @param n: Will be set to the number of received queries.
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped, `Z_EINVAL` if `capacity` is 0.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_fifo_handler_query_recv_many(const struct z_loaned_fifo_handler_query_t *this_,
+                                          struct z_owned_query_t *queries,
+                                          size_t capacity,
+                                          size_t *n);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns query from the fifo buffer, busy-polling the channel according to `options` before blocking until next query is received,
+ * or until the channel is dropped (normally when Queryable is dropped).
+ *
+ * @param this_: The handler.
+ * @param query: An uninitialized memory location where the query will be constructed.
+ * @param options: The polling options, if `NULL` the default ones are used.
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the query will be in the gravestone state).
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_fifo_handler_query_recv_spin(const struct z_loaned_fifo_handler_query_t *this_,
+                                          struct z_owned_query_t *query,
+                                          const struct zc_recv_spin_options_t *options);
+#endif
+/**
+ * Returns query from the fifo buffer. If there are no more pending queries will return immediately (with query set to its gravestone state).
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the query will be in the gravestone state),
+ * `Z_CHANNEL_NODATA` if the channel is still alive, but its buffer is empty (the query will be in the gravestone state).
+ */
+ZENOHC_API
+z_result_t z_fifo_handler_query_try_recv(const struct z_loaned_fifo_handler_query_t *this_,
+                                         struct z_owned_query_t *query);
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Receives up to `capacity` queries from the fifo buffer at once. If there are no pending queries will return immediately.
+ *
+ * @param this_: The handler.
+ * @param queries: A pointer to an array of at least `capacity` uninitialized queries. Only the first `n` elements are initialized upon return.
+ * @param capacity: The maximum number of queries to receive.
+ * @param n: Will be set to the number of received queries.
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped,
+ * `Z_CHANNEL_NODATA` if the channel is still alive, but its buffer is empty, `Z_EINVAL` if `capacity` is 0.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_fifo_handler_query_try_recv_many(const struct z_loaned_fifo_handler_query_t *this_,
+                                              struct z_owned_query_t *queries,
+                                              size_t capacity,
+                                              size_t *n);
+#endif
+/**
+ * Drops the handler and resets it to a gravestone state.
+ */
+ZENOHC_API void z_fifo_handler_reply_drop(struct z_moved_fifo_handler_reply_t *this_);
+/**
+ * Borrows handler.
+ */
+ZENOHC_API
+const struct z_loaned_fifo_handler_reply_t *z_fifo_handler_reply_loan(const struct z_owned_fifo_handler_reply_t *this_);
+/**
+ * Returns reply from the fifo buffer. If there are no more pending replies will block until next reply is received, or until
+ * the channel is dropped (normally when all replies are received).
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the reply will be in the gravestone state).
+ */
+ZENOHC_API
+z_result_t z_fifo_handler_reply_recv(const struct z_loaned_fifo_handler_reply_t *this_,
+                                     struct z_owned_reply_t *reply);
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Receives up to `capacity` replies from the fifo buffer at once. If there are no pending replies will block until next reply is received,
+ * or until the channel is dropped (normally when all replies are received). Once at least one reply is received, all the replies that are already
+ * pending are returned without blocking.
+ *
+ * @param this_: The handler.
+ * @param replies: A pointer to an array of at least `capacity` uninitialized replies. Only the first `n` elements are initialized upon return.
+ * @param capacity: The maximum number of replies to receive.
+ * @param n: Will be set to the number of received replies.
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped, `Z_EINVAL` if `capacity` is 0.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_fifo_handler_reply_recv_many(const struct z_loaned_fifo_handler_reply_t *this_,
+                                          struct z_owned_reply_t *replies,
+                                          size_t capacity,
+                                          size_t *n);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns reply from the fifo buffer, busy-polling the channel according to `options` before blocking until next reply is received,
+ * or until the channel is dropped (normally when all replies are received).
+ *
+ * @param this_: The handler.
+ * @param reply: An uninitialized memory location where the reply will be constructed.
+ * @param options: The polling options, if `NULL` the default ones are used.
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the reply will be in the gravestone state).
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_fifo_handler_reply_recv_spin(const struct z_loaned_fifo_handler_reply_t *this_,
+                                          struct z_owned_reply_t *reply,
+                                          const struct zc_recv_spin_options_t *options);
+#endif
+/**
+ * Returns reply from the fifo buffer. If there are no more pending replies will return immediately (with reply set to its gravestone state).
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the reply will be in the gravestone state),
+ * `Z_CHANNEL_NODATA` if the channel is still alive, but its buffer is empty (the reply will be in the gravestone state).
+ */
+ZENOHC_API
+z_result_t z_fifo_handler_reply_try_recv(const struct z_loaned_fifo_handler_reply_t *this_,
+                                         struct z_owned_reply_t *reply);
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Receives up to `capacity` replies from the fifo buffer at once. If there are no pending replies will return immediately.
+ *
+ * @param this_: The handler.
+ * @param replies: A pointer to an array of at least `capacity` uninitialized replies. Only the first `n` elements are initialized upon return.
+ * @param capacity: The maximum number of replies to receive.
+ * @param n: Will be set to the number of received replies.
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped,
+ * `Z_CHANNEL_NODATA` if the channel is still alive, but its buffer is empty, `Z_EINVAL` if `capacity` is 0.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_fifo_handler_reply_try_recv_many(const struct z_loaned_fifo_handler_reply_t *this_,
+                                              struct z_owned_reply_t *replies,
+                                              size_t capacity,
+                                              size_t *n);
+#endif
+/**
+ * Drops the handler and resets it to a gravestone state.
+ */
+ZENOHC_API void z_fifo_handler_sample_drop(struct z_moved_fifo_handler_sample_t *this_);
+/**
+ * Borrows handler.
+ */
+ZENOHC_API
+const struct z_loaned_fifo_handler_sample_t *z_fifo_handler_sample_loan(const struct z_owned_fifo_handler_sample_t *this_);
+/**
+ * Returns sample from the fifo buffer. If there are no more pending replies will block until next sample is received, or until
+ * the channel is dropped (normally when there are no more samples to receive).
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the sample will be in the gravestone state).
+ */
+ZENOHC_API
+z_result_t z_fifo_handler_sample_recv(const struct z_loaned_fifo_handler_sample_t *this_,
+                                      struct z_owned_sample_t *sample);
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Receives up to `capacity` samples from the fifo buffer at once. If there are no pending samples will block until next sample is received,
+ * or until the channel is dropped (normally when there are no more samples to receive). Once at least one sample is received, all the samples that are already
+ * pending are returned without blocking.
+ *
+ * @param this_: The handler.
+ * @param samples: A pointer to an array of at least `capacity` uninitialized samples. Only the first `n` elements are initialized upon return.
+ * @param capacity: The maximum number of samples to receive.
+ * @param n: Will be set to the number of received samples.
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped, `Z_EINVAL` if `capacity` is 0.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_fifo_handler_sample_recv_many(const struct z_loaned_fifo_handler_sample_t *this_,
+                                           struct z_owned_sample_t *samples,
+                                           size_t capacity,
+                                           size_t *n);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns sample from the fifo buffer, busy-polling the channel according to `options` before blocking until next sample is received,
+ * or until the channel is dropped (normally when there are no more samples to receive).
+ *
+ * @param this_: The handler.
+ * @param sample: An uninitialized memory location where the sample will be constructed.
+ * @param options: The polling options, if `NULL` the default ones are used.
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the sample will be in the gravestone state).
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_fifo_handler_sample_recv_spin(const struct z_loaned_fifo_handler_sample_t *this_,
+                                           struct z_owned_sample_t *sample,
+                                           const struct zc_recv_spin_options_t *options);
+#endif
+/**
+ * Returns sample from the fifo buffer.
+ * If there are no more pending replies will return immediately (with sample set to its gravestone state).
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the sample will be in the gravestone state),
+ * `Z_CHANNEL_NODATA` if the channel is still alive, but its buffer is empty (the sample will be in the gravestone state).
+ */
+ZENOHC_API
+z_result_t z_fifo_handler_sample_try_recv(const struct z_loaned_fifo_handler_sample_t *this_,
+                                          struct z_owned_sample_t *sample);
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Receives up to `capacity` samples from the fifo buffer at once. If there are no pending samples will return immediately.
+ *
+ * @param this_: The handler.
+ * @param samples: A pointer to an array of at least `capacity` uninitialized samples. Only the first `n` elements are initialized upon return.
+ * @param capacity: The maximum number of samples to receive.
+ * @param n: Will be set to the number of received samples.
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped,
+ * `Z_CHANNEL_NODATA` if the channel is still alive, but its buffer is empty, `Z_EINVAL` if `capacity` is 0.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_fifo_handler_sample_try_recv_many(const struct z_loaned_fifo_handler_sample_t *this_,
+                                               struct z_owned_sample_t *samples,
+                                               size_t capacity,
+                                               size_t *n);
+#endif
+/**
+ * Query data from the matching queryables in the system.
+ * Replies are provided through a callback function.
+ *
+ * @param session: The zenoh session.
+ * @param key_expr: The key expression matching resources to query.
+ * @param parameters: The query's parameters, similar to a url's query segment.
+ * @param callback: The callback function that will be called on reception of replies for this query. It will be automatically dropped once all replies are processed.
+ * @param options: Additional options for the get. All owned fields will be consumed.
+ *
+ * @return 0 in case of success, a negative error value upon failure.
+ */
+ZENOHC_API
+z_result_t z_get(const struct z_loaned_session_t *session,
+                 const struct z_loaned_keyexpr_t *key_expr,
+                 const char *parameters,
+                 struct z_moved_closure_reply_t *callback,
+                 struct z_get_options_t *options);
+/**
+ * Constructs default `z_get_options_t`
+ */
+ZENOHC_API void z_get_options_default(struct z_get_options_t *this_);
+/**
+ * Constructs an owned copy of hello message.
+ */
+ZENOHC_API void z_hello_clone(struct z_owned_hello_t *dst, const struct z_loaned_hello_t *this_);
+/**
+ * Frees memory and resets hello message to its gravestone state.
+ */
+ZENOHC_API void z_hello_drop(struct z_moved_hello_t *this_);
+/**
+ * Borrows hello message.
+ */
+ZENOHC_API const struct z_loaned_hello_t *z_hello_loan(const struct z_owned_hello_t *this_);
+/**
+ * Constructs an array of non-owned locators (in the form non-null-terminated strings) of Zenoh entity that sent hello message.
+ *
+ * The lifetime of locator strings is bound to `this_`.
+ */
+ZENOHC_API
+void z_hello_locators(const struct z_loaned_hello_t *this_,
+                      struct z_owned_string_array_t *locators_out);
+/**
+ * Returns type of Zenoh entity that transmitted hello message.
+ */
+ZENOHC_API enum z_whatami_t z_hello_whatami(const struct z_loaned_hello_t *this_);
+/**
+ * @brief Returns id of Zenoh entity that transmitted hello message.
+ */
+ZENOHC_API struct z_id_t z_hello_zid(const struct z_loaned_hello_t *this_);
+/**
+ * @brief Formats the `z_id_t` into 16-digit hex string (LSB-first order)
  */
-typedef struct ALIGN(8) ze_loaned_publication_cache_t {
-  uint8_t _0[96];
-} ze_loaned_publication_cache_t;
-typedef struct ze_moved_querying_subscriber_t {
-  struct ze_owned_querying_subscriber_t _this;
-} ze_moved_querying_subscriber_t;
-typedef struct ze_moved_sample_miss_listener_t {
-  struct ze_owned_sample_miss_listener_t _this;
-} ze_moved_sample_miss_listener_t;
-typedef struct ze_moved_serializer_t {
-  struct ze_owned_serializer_t _this;
-} ze_moved_serializer_t;
-ZENOHC_API extern const unsigned int Z_ROUTER;
-ZENOHC_API extern const unsigned int Z_PEER;
-ZENOHC_API extern const unsigned int Z_CLIENT;
-ZENOHC_API extern const char *Z_CONFIG_MODE_KEY;
-ZENOHC_API extern const char *Z_CONFIG_CONNECT_KEY;
-ZENOHC_API extern const char *Z_CONFIG_LISTEN_KEY;
-ZENOHC_API extern const char *Z_CONFIG_USER_KEY;
-ZENOHC_API extern const char *Z_CONFIG_PASSWORD_KEY;
-ZENOHC_API extern const char *Z_CONFIG_MULTICAST_SCOUTING_KEY;
-ZENOHC_API extern const char *Z_CONFIG_MULTICAST_INTERFACE_KEY;
-ZENOHC_API extern const char *Z_CONFIG_MULTICAST_IPV4_ADDRESS_KEY;
-ZENOHC_API extern const char *Z_CONFIG_SCOUTING_TIMEOUT_KEY;
-ZENOHC_API extern const char *Z_CONFIG_SCOUTING_DELAY_KEY;
-ZENOHC_API extern const char *Z_CONFIG_ADD_TIMESTAMP_KEY;
-ZENOHC_API extern const char *Z_CONFIG_SHARED_MEMORY_KEY;
-ZENOHC_API extern const unsigned int Z_SHM_POSIX_PROTOCOL_ID;
+ZENOHC_API void z_id_to_string(const struct z_id_t *zid, struct z_owned_string_t *dst);
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Make allocation without any additional actions.
+ * @brief Fetches the Zenoh IDs of all connected peers.
+ *
+ * `callback` will be called once for each ID, is guaranteed to never be called concurrently,
+ * and is guaranteed to be dropped before this function exits.
+ *
+ * Retuns 0 on success, negative values on failure
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-void z_alloc_layout_alloc(struct z_buf_alloc_result_t *out_result,
-                          const struct z_loaned_alloc_layout_t *layout);
-#endif
+z_result_t z_info_peers_zid(const struct z_loaned_session_t *session,
+                            struct z_moved_closure_zid_t *callback);
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Make allocation performing garbage collection if needed.
+ * @brief Fetches the Zenoh IDs of all connected routers.
+ *
+ * `callback` will be called once for each ID, is guaranteed to never be called concurrently,
+ * and is guaranteed to be dropped before this function exits.
+ *
+ * Retuns 0 on success, negative values on failure.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-void z_alloc_layout_alloc_gc(struct z_buf_alloc_result_t *out_result,
-                             const struct z_loaned_alloc_layout_t *layout);
-#endif
+z_result_t z_info_routers_zid(const struct z_loaned_session_t *session,
+                              struct z_moved_closure_zid_t *callback);
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Make allocation performing garbage collection and/or defragmentation if needed.
+ * @brief Returns the session's Zenoh ID.
+ *
+ * Unless the `session` is invalid, that ID is guaranteed to be non-zero.
+ * In other words, this function returning an array of 16 zeros means you failed
+ * to pass it a valid session.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
-ZENOHC_API
-void z_alloc_layout_alloc_gc_defrag(struct z_buf_alloc_result_t *out_result,
-                                    const struct z_loaned_alloc_layout_t *layout);
-#endif
+ZENOHC_API struct z_id_t z_info_zid(const struct z_loaned_session_t *session);
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Make allocation performing garbage collection and/or defragmentation and/or blocking if needed.
+ * @brief Returns ``true`` if adaptive mutex is valid, ``false`` otherwise.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_alloc_layout_alloc_gc_defrag_blocking(struct z_buf_alloc_result_t *out_result,
-                                             const struct z_loaned_alloc_layout_t *layout);
+bool z_internal_adaptive_mutex_check(const struct z_owned_adaptive_mutex_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Make allocation performing garbage collection and/or defragmentation and/or forced deallocation if needed.
+ * @brief Constructs adaptive mutex in a gravestone state.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_alloc_layout_alloc_gc_defrag_dealloc(struct z_buf_alloc_result_t *out_result,
-                                            const struct z_loaned_alloc_layout_t *layout);
+void z_internal_adaptive_mutex_null(struct z_owned_adaptive_mutex_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Deletes Alloc Layout.
+ * @brief Returns ``true`` if `this` is valid.
  */
 #if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-void z_alloc_layout_drop(struct z_moved_alloc_layout_t *this_);
+bool z_internal_alloc_layout_check(const struct z_owned_alloc_layout_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Borrows Alloc Layout.
+ * @brief Constructs Alloc Layout in its gravestone value.
  */
 #if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-const struct z_loaned_alloc_layout_t *z_alloc_layout_loan(const struct z_owned_alloc_layout_t *this_);
+void z_internal_alloc_layout_null(struct z_owned_alloc_layout_t *this_);
 #endif
+/**
+ * Returns ``true`` if `this_` is in a valid state, ``false`` if it is in a gravestone state.
+ */
+ZENOHC_API bool z_internal_bytes_check(const struct z_owned_bytes_t *this_);
+/**
+ * The gravestone value for `z_owned_bytes_t`.
+ */
+ZENOHC_API void z_internal_bytes_null(struct z_owned_bytes_t *this_);
+/**
+ * Returns ``true`` if `this_` is in a valid state, ``false`` if it is in a gravestone state.
+ */
+ZENOHC_API bool z_internal_bytes_writer_check(const struct z_owned_bytes_writer_t *this_);
+/**
+ * Constructs a writer in a gravestone state.
+ */
+ZENOHC_API void z_internal_bytes_writer_null(struct z_owned_bytes_writer_t *this_);
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Creates a new Alloc Layout for SHM Provider.
+ * @brief Returns ``true`` if cancellation token is valid, ``false`` if it is in its gravestone state.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t z_alloc_layout_new(struct z_owned_alloc_layout_t *this_,
-                              const struct z_loaned_shm_provider_t *provider,
-                              size_t size,
-                              struct z_alloc_alignment_t alignment);
+bool z_internal_cancellation_token_check(const struct z_owned_cancellation_token_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Make allocation performing garbage collection and/or defragmentation in async manner. Will return Z_EINVAL
- * if used with non-threadsafe SHM Provider.
+ * @brief Constructs cancellation token in its gravestone state.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t z_alloc_layout_threadsafe_alloc_gc_defrag_async(struct z_buf_alloc_result_t *out_result,
-                                                           const struct z_loaned_alloc_layout_t *layout,
-                                                           struct zc_threadsafe_context_t result_context,
-                                                           void (*result_callback)(void*,
-                                                                                   struct z_buf_alloc_result_t*));
+void z_internal_cancellation_token_null(struct z_owned_cancellation_token_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Converts data into a loaned SHM buffer.
- *
- * @param this_: Data to convert.
- * @param dst: An uninitialized memory location where to construct an SHM buffer.
+ * @return ``true`` if `this` is valid.
  */
 #if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-z_result_t z_bytes_as_loaned_shm(const struct z_loaned_bytes_t *this_,
-                                 const struct z_loaned_shm_t **dst);
+bool z_internal_chunk_alloc_result_check(const struct z_owned_chunk_alloc_result_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Converts data into a mutably loaned SHM buffer.
- *
- * @param this_: Data to convert.
- * @param dst: An uninitialized memory location where to construct an SHM buffer.
+ * @brief Constructs Chunk Alloc Result in its gravestone value.
  */
 #if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-z_result_t z_bytes_as_mut_loaned_shm(struct z_loaned_bytes_t *this_,
-                                     struct z_loaned_shm_t **dst);
+void z_internal_chunk_alloc_result_null(struct z_owned_chunk_alloc_result_t *this_);
 #endif
 /**
- * Constructs an owned shallow copy of data in provided uninitialized memory location.
+ * Returns ``true`` if closure is valid, ``false`` if it is in gravestone state.
  */
-ZENOHC_API void z_bytes_clone(struct z_owned_bytes_t *dst, const struct z_loaned_bytes_t *this_);
+ZENOHC_API bool z_internal_closure_hello_check(const struct z_owned_closure_hello_t *this_);
 /**
- * Converts a data from buffer into `z_owned_bytes_t` by copying.
- * @param this_: An uninitialized location in memory where `z_owned_bytes_t` is to be constructed.
- * @param data: A pointer to the buffer containing data.
- * @param len: Length of the buffer.
- * @return 0 in case of success, negative error code otherwise.
+ * Constructs a closure in a gravestone state.
  */
-ZENOHC_API
-z_result_t z_bytes_copy_from_buf(struct z_owned_bytes_t *this_,
-                                 const uint8_t *data,
-                                 size_t len);
+ZENOHC_API void z_internal_closure_hello_null(struct z_owned_closure_hello_t *this_);
 /**
- * Converts a slice into `z_owned_bytes_t` by copying.
+ * Returns ``true`` if closure is valid, ``false`` if it is in gravestone state.
  */
-ZENOHC_API
-void z_bytes_copy_from_slice(struct z_owned_bytes_t *this_,
-                             const struct z_loaned_slice_t *slice);
+ZENOHC_API bool z_internal_closure_query_check(const struct z_owned_closure_query_t *this_);
 /**
- * Converts a null-terminated string into `z_owned_bytes_t` by copying.
- * @param this_: An uninitialized location in memory where `z_owned_bytes_t` is to be constructed.
- * @param str: a pointer to the null-terminated string.
- * @return 0 in case of success, negative error code otherwise.
+ * Constructs a closure in its gravestone state.
  */
-ZENOHC_API z_result_t z_bytes_copy_from_str(struct z_owned_bytes_t *this_, const char *str);
+ZENOHC_API void z_internal_closure_query_null(struct z_owned_closure_query_t *this_);
 /**
- * Converts a string into `z_owned_bytes_t` by copying.
+ * Returns ``true`` if closure is valid, ``false`` if it is in gravestone state.
  */
-ZENOHC_API
-void z_bytes_copy_from_string(struct z_owned_bytes_t *this_,
-                              const struct z_loaned_string_t *str);
+ZENOHC_API bool z_internal_closure_reply_check(const struct z_owned_closure_reply_t *this_);
 /**
- * Drops `this_`, resetting it to gravestone value. If there are any shallow copies
- * created by `z_bytes_clone()`, they would still stay valid.
+ * Constructs a closure int its gravestone state.
  */
-ZENOHC_API void z_bytes_drop(struct z_moved_bytes_t *this_);
+ZENOHC_API void z_internal_closure_reply_null(struct z_owned_closure_reply_t *this_);
 /**
- * Constructs an empty instance of `z_owned_bytes_t`.
+ * Returns ``true`` if closure is valid, ``false`` if it is in gravestone state.
  */
-ZENOHC_API void z_bytes_empty(struct z_owned_bytes_t *this_);
+ZENOHC_API bool z_internal_closure_sample_check(const struct z_owned_closure_sample_t *this_);
 /**
- * Converts buffer into `z_owned_bytes_t`.
- * @param this_: An uninitialized location in memory where `z_owned_bytes_t` is to be constructed.
- * @param data: A pointer to the buffer containing data. `this_` will take ownership of the buffer.
- * @param len: Length of the buffer.
- * @param deleter: A thread-safe function, that will be called on `data` when `this_` is dropped. Can be `NULL` if `data` is located in static memory and does not require a drop.
- * @param context: An optional context to be passed to `deleter`.
- * @return 0 in case of success, negative error code otherwise.
+ * Constructs a closure in its gravestone state.
  */
-ZENOHC_API
-z_result_t z_bytes_from_buf(struct z_owned_bytes_t *this_,
-                            uint8_t *data,
-                            size_t len,
-                            void (*deleter)(void *data, void *context),
-                            void *context);
+ZENOHC_API void z_internal_closure_sample_null(struct z_owned_closure_sample_t *this_);
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Converts from an immutable SHM buffer consuming it.
+ * @brief Returns ``true`` if closure is valid, ``false`` if it is in gravestone state.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
-ZENOHC_API
-z_result_t z_bytes_from_shm(struct z_owned_bytes_t *this_,
-                            struct z_moved_shm_t *shm);
-#endif
+ZENOHC_API bool z_internal_closure_zid_check(const struct z_owned_closure_zid_t *this_);
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Converts a mutable SHM buffer consuming it.
+ * @brief Constructs a null closure.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
-ZENOHC_API
-z_result_t z_bytes_from_shm_mut(struct z_owned_bytes_t *this_,
-                                struct z_moved_shm_mut_t *shm);
-#endif
+ZENOHC_API void z_internal_closure_zid_null(struct z_owned_closure_zid_t *this_);
 /**
- * Converts a slice into `z_owned_bytes_t`.
- * The slice is consumed upon function return.
+ * Returns ``true`` if conditional variable is valid, ``false`` otherwise.
  */
-ZENOHC_API void z_bytes_from_slice(struct z_owned_bytes_t *this_, struct z_moved_slice_t *slice);
+ZENOHC_API bool z_internal_condvar_check(const struct z_owned_condvar_t *this_);
 /**
- * Converts a statically allocated constant buffer into `z_owned_bytes_t`.
- * @param this_: An uninitialized location in memory where `z_owned_bytes_t` is to be constructed.
- * @param data: A pointer to the statically allocated constant data.
- * @param len: A length of the buffer.
- * @return 0 in case of success, negative error code otherwise.
+ * Constructs conditional variable in a gravestone state.
  */
-ZENOHC_API
-z_result_t z_bytes_from_static_buf(struct z_owned_bytes_t *this_,
-                                   uint8_t *data,
-                                   size_t len);
+ZENOHC_API void z_internal_condvar_null(struct z_owned_condvar_t *this_);
 /**
- * Converts a statically allocated constant null-terminated string into `z_owned_bytes_t` by aliasing.
- * @param this_: An uninitialized location in memory where `z_owned_bytes_t` is to be constructed.
- * @param str: a pointer to the statically allocated constant string.
- * @return 0 in case of success, negative error code otherwise.
+ * Returns ``true`` if config is valid, ``false`` if it is in a gravestone state.
  */
-ZENOHC_API
-z_result_t z_bytes_from_static_str(struct z_owned_bytes_t *this_,
-                                   const char *str);
+ZENOHC_API bool z_internal_config_check(const struct z_owned_config_t *this_);
 /**
- * Converts a null-terminated string into `z_owned_bytes_t`.
- * @param this_: An uninitialized location in memory where `z_owned_bytes_t` is to be constructed.
- * @param str: a pointer to the string. `this_` will take ownership of the string.
- * @param deleter: A thread-safe function, that will be called on `str` when `this_` is dropped. Can be `NULL` if `str` is located in static memory and does not require a drop.
- * @param context: An optional context to be passed to `deleter`.
- * @return 0 in case of success, negative error code otherwise.
+ * Constructs config in its gravestone state.
  */
-ZENOHC_API
-z_result_t z_bytes_from_str(struct z_owned_bytes_t *this_,
-                            char *str,
-                            void (*deleter)(void *data, void *context),
-                            void *context);
+ZENOHC_API void z_internal_config_null(struct z_owned_config_t *this_);
 /**
- * Converts a string into `z_owned_bytes_t`.
- * The string is consumed upon function return.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns ``true`` if handler is valid, ``false`` if it is in gravestone state.
  */
-ZENOHC_API void z_bytes_from_string(struct z_owned_bytes_t *this_, struct z_moved_string_t *s);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+bool z_internal_conflating_handler_sample_check(const struct z_owned_conflating_handler_sample_t *this_);
+#endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * Attempts to get a contiguous view to the underlying bytes.
- * This is only possible if data is not fragmented, otherwise the function will fail.
- * In case of fragmented data, consider using `z_bytes_get_slice_iterator()`.
- *
- * @param this_: An instance of Zenoh data.
- * @param view: An uninitialized memory location where a contiguous view on data will be constructed.
- * @return  ​0​ upon success, negative error code otherwise.
+ * @brief Constructs a handler in gravestone state.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t z_bytes_get_contiguous_view(const struct z_loaned_bytes_t *this_,
-                                       struct z_view_slice_t *view);
+void z_internal_conflating_handler_sample_null(struct z_owned_conflating_handler_sample_t *this_);
 #endif
 /**
- * Returns a reader for the data.
- *
- * The `data` should outlive the reader.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns ``true`` if handler is valid, ``false`` if it is in gravestone state.
  */
-ZENOHC_API struct z_bytes_reader_t z_bytes_get_reader(const struct z_loaned_bytes_t *data);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+bool z_internal_credit_handler_reply_check(const struct z_owned_credit_handler_reply_t *this_);
+#endif
 /**
- * Returns an iterator on raw bytes slices contained in the `z_loaned_bytes_t`.
- *
- * Zenoh may store data in non-contiguous regions of memory, this iterator
- * then allows to access raw data directly without any attempt of deserializing it.
- * Please note that no guarantee is provided on the internal memory layout.
- * The only provided guarantee is on the bytes order that is preserved.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs a handler in gravestone state.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-struct z_bytes_slice_iterator_t z_bytes_get_slice_iterator(const struct z_loaned_bytes_t *this_);
+void z_internal_credit_handler_reply_null(struct z_owned_credit_handler_reply_t *this_);
+#endif
 /**
- * Returns ``true`` if `this_` is empty, ``false`` otherwise.
+ * Returns ``true`` if encoding is in non-default state, ``false`` otherwise.
  */
-ZENOHC_API bool z_bytes_is_empty(const struct z_loaned_bytes_t *this_);
+ZENOHC_API bool z_internal_encoding_check(const struct z_owned_encoding_t *this_);
 /**
- * Returns total number of bytes in the payload.
+ * Constructs a default `z_owned_encoding_t`.
  */
-ZENOHC_API size_t z_bytes_len(const struct z_loaned_bytes_t *this_);
+ZENOHC_API void z_internal_encoding_null(struct z_owned_encoding_t *this_);
 /**
- * Borrows data.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns ``true`` if executor is valid, ``false`` if it is in gravestone state.
  */
-ZENOHC_API const struct z_loaned_bytes_t *z_bytes_loan(const struct z_owned_bytes_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+bool z_internal_executor_check(const struct z_owned_executor_t *this_);
+#endif
 /**
- * Muatably borrows data.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs executor in its gravestone state.
  */
-ZENOHC_API struct z_loaned_bytes_t *z_bytes_loan_mut(struct z_owned_bytes_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+void z_internal_executor_null(struct z_owned_executor_t *this_);
+#endif
 /**
- * Reads data into specified destination.
- *
- * @param this_: Data reader to read from.
- * @param dst: Buffer where the read data is written.
- * @param len: Maximum number of bytes to read.
- * @return number of bytes read. If return value is smaller than `len`, it means that  theend of the data was reached.
+ * Returns ``true`` if handler is valid, ``false`` if it is in gravestone state.
  */
 ZENOHC_API
-size_t z_bytes_reader_read(struct z_bytes_reader_t *this_,
-                           uint8_t *dst,
-                           size_t len);
+bool z_internal_fifo_handler_query_check(const struct z_owned_fifo_handler_query_t *this_);
 /**
- * Gets the number of bytes that can still be read.
+ * Constructs a handler in gravestone state.
  */
-ZENOHC_API size_t z_bytes_reader_remaining(const struct z_bytes_reader_t *this_);
+ZENOHC_API void z_internal_fifo_handler_query_null(struct z_owned_fifo_handler_query_t *this_);
 /**
- * Sets the `reader` position indicator for the payload to the value pointed to by offset.
- * The new position is exactly `offset` bytes measured from the beginning of the payload if origin is `SEEK_SET`,
- * from the current reader position if origin is `SEEK_CUR`, and from the end of the payload if origin is `SEEK_END`.
- * @return ​0​ upon success, negative error code otherwise.
+ * Returns ``true`` if handler is valid, ``false`` if it is in gravestone state.
  */
 ZENOHC_API
-z_result_t z_bytes_reader_seek(struct z_bytes_reader_t *this_,
-                               int64_t offset,
-                               int origin);
+bool z_internal_fifo_handler_reply_check(const struct z_owned_fifo_handler_reply_t *this_);
 /**
- * Gets the read position indicator.
- * @return read position indicator on success or -1L if failure occurs.
+ * Constructs a handler in gravestone state.
  */
-ZENOHC_API int64_t z_bytes_reader_tell(struct z_bytes_reader_t *this_);
+ZENOHC_API void z_internal_fifo_handler_reply_null(struct z_owned_fifo_handler_reply_t *this_);
 /**
- * Gets next slice.
- * @param this_: Slice iterator.
- * @param slice: An unitialized memory location where the view for the next slice will be constructed.
- * @return `false` if there are no more slices (in this case slice will stay unchanged), `true` otherwise.
+ * Returns ``true`` if handler is valid, ``false`` if it is in gravestone state.
  */
 ZENOHC_API
-bool z_bytes_slice_iterator_next(struct z_bytes_slice_iterator_t *this_,
-                                 struct z_view_slice_t *slice);
+bool z_internal_fifo_handler_sample_check(const struct z_owned_fifo_handler_sample_t *this_);
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Converts data into an owned SHM buffer by copying it's shared reference.
- *
- * @param this_: Data to convert.
- * @param dst: An uninitialized memory location where to construct an SHM buffer.
+ * Constructs a handler in gravestone state.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
-ZENOHC_API
-z_result_t z_bytes_to_owned_shm(const struct z_loaned_bytes_t *this_,
-                                struct z_owned_shm_t *dst);
-#endif
+ZENOHC_API void z_internal_fifo_handler_sample_null(struct z_owned_fifo_handler_sample_t *this_);
 /**
- * Converts data into an owned slice.
- *
- * @param this_: Data to convert.
- * @param dst: An uninitialized memory location where to construct a slice.
+ * Returns ``true`` if `hello message` is valid, ``false`` if it is in a gravestone state.
  */
-ZENOHC_API
-z_result_t z_bytes_to_slice(const struct z_loaned_bytes_t *this_,
-                            struct z_owned_slice_t *dst);
+ZENOHC_API bool z_internal_hello_check(const struct z_owned_hello_t *this_);
 /**
- * Converts data into an owned non-null-terminated string.
- *
- * @param this_: Data to convert.
- * @param dst: An uninitialized memory location where to construct a string.
+ * Constructs hello message in a gravestone state.
  */
-ZENOHC_API
-z_result_t z_bytes_to_string(const struct z_loaned_bytes_t *this_,
-                             struct z_owned_string_t *dst);
+ZENOHC_API void z_internal_hello_null(struct z_owned_hello_t *this_);
 /**
- * Appends bytes.
- * This allows to compose a serialized data out of multiple `z_owned_bytes_t` that may point to different memory regions.
- * Said in other terms, it allows to create a linear view on different memory regions without copy.
- *
- * @return 0 in case of success, negative error code otherwise.
+ * Returns ``true`` if `keyexpr` is valid, ``false`` if it is in gravestone state.
  */
-ZENOHC_API
-z_result_t z_bytes_writer_append(struct z_loaned_bytes_writer_t *this_,
-                                 struct z_moved_bytes_t *bytes);
+ZENOHC_API bool z_internal_keyexpr_check(const struct z_owned_keyexpr_t *this_);
 /**
- * Drops `this_`, resetting it to gravestone value.
+ * Constructs an owned key expression in a gravestone state.
  */
-ZENOHC_API void z_bytes_writer_drop(struct z_moved_bytes_writer_t *this_);
+ZENOHC_API void z_internal_keyexpr_null(struct z_owned_keyexpr_t *this_);
 /**
- * @brief Constructs a data writer with empty payload.
- * @param this_: An uninitialized memory location where writer is to be constructed.
- * @return 0 in case of success, negative error code otherwise.
+ * @brief Returns ``true`` if liveliness token is valid, ``false`` otherwise.
  */
-ZENOHC_API z_result_t z_bytes_writer_empty(struct z_owned_bytes_writer_t *this_);
+ZENOHC_API bool z_internal_liveliness_token_check(const struct z_owned_liveliness_token_t *this_);
 /**
- * @brief Drop writer and extract underlying `bytes` object it was writing to.
- * @param this_: A writer instance.
- * @param bytes: An uninitialized memory location where `bytes` object` will be written to.
+ * @brief Constructs liveliness token in its gravestone state.
  */
-ZENOHC_API
-void z_bytes_writer_finish(struct z_moved_bytes_writer_t *this_,
-                           struct z_owned_bytes_t *bytes);
+ZENOHC_API void z_internal_liveliness_token_null(struct z_owned_liveliness_token_t *this_);
 /**
- * Borrows writer.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns ``true`` if `this` is valid.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-const struct z_loaned_bytes_writer_t *z_bytes_writer_loan(const struct z_owned_bytes_writer_t *this_);
+bool z_internal_memory_layout_check(const struct z_owned_memory_layout_t *this_);
+#endif
 /**
- * Muatably borrows writer.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs Memory Layout in its gravestone value.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-struct z_loaned_bytes_writer_t *z_bytes_writer_loan_mut(struct z_owned_bytes_writer_t *this_);
+void z_internal_memory_layout_null(struct z_owned_memory_layout_t *this_);
+#endif
 /**
- * Writes `len` bytes from `src` into underlying data.
- *
- * @return 0 in case of success, negative error code otherwise.
+ * Returns ``true`` if mutex is valid, ``false`` otherwise.
+ */
+ZENOHC_API bool z_internal_mutex_check(const struct z_owned_mutex_t *this_);
+/**
+ * Constructs mutex in a gravestone state.
+ */
+ZENOHC_API void z_internal_mutex_null(struct z_owned_mutex_t *this_);
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns ``true`` if handler is valid, ``false`` if it is in gravestone state.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t z_bytes_writer_write_all(struct z_loaned_bytes_writer_t *this_,
-                                    const uint8_t *src,
-                                    size_t len);
+bool z_internal_priority_handler_sample_check(const struct z_owned_priority_handler_sample_t *this_);
+#endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Deletes Chunk Alloc Result.
+ * @brief Constructs a handler in gravestone state.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_chunk_alloc_result_drop(struct z_moved_chunk_alloc_result_t *this_);
+void z_internal_priority_handler_sample_null(struct z_owned_priority_handler_sample_t *this_);
 #endif
+/**
+ * Returns ``true`` if publisher is valid, ``false`` otherwise.
+ */
+ZENOHC_API bool z_internal_publisher_check(const struct z_owned_publisher_t *this_);
+/**
+ * Constructs a publisher in a gravestone state.
+ */
+ZENOHC_API void z_internal_publisher_null(struct z_owned_publisher_t *this_);
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Creates a new Chunk Alloc Result with Error value.
+ * @brief Returns ``true`` if querier is valid, ``false`` otherwise.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_chunk_alloc_result_new_error(struct z_owned_chunk_alloc_result_t *this_,
-                                    enum z_alloc_error_t alloc_error);
+bool z_internal_querier_check(const struct z_owned_querier_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Creates a new Chunk Alloc Result with Ok value.
+ * @brief Constructs a querier in a gravestone state.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t z_chunk_alloc_result_new_ok(struct z_owned_chunk_alloc_result_t *this_,
-                                       struct z_allocated_chunk_t allocated_chunk);
+void z_internal_querier_null(struct z_owned_querier_t *this_);
 #endif
 /**
- * Get number of milliseconds passed since creation of `time`.
+ * Returns `false` if `this` is in a gravestone state, `true` otherwise.
  */
-ZENOHC_API uint64_t z_clock_elapsed_ms(const struct z_clock_t *time);
+ZENOHC_API bool z_internal_query_check(const struct z_owned_query_t *query);
 /**
- * Get number of seconds passed since creation of `time`.
+ * Constructs query in its gravestone value.
  */
-ZENOHC_API uint64_t z_clock_elapsed_s(const struct z_clock_t *time);
+ZENOHC_API void z_internal_query_null(struct z_owned_query_t *this_);
 /**
- * Get number of microseconds passed since creation of `time`.
+ * Returns ``true`` if queryable is valid, ``false`` otherwise.
  */
-ZENOHC_API uint64_t z_clock_elapsed_us(const struct z_clock_t *time);
+ZENOHC_API bool z_internal_queryable_check(const struct z_owned_queryable_t *this_);
 /**
- * Returns monotonic clock time point corresponding to the current time instant.
+ * Constructs a queryable in its gravestone value.
  */
-ZENOHC_API struct z_clock_t z_clock_now(void);
+ZENOHC_API void z_internal_queryable_null(struct z_owned_queryable_t *this_);
 /**
- * Closes zenoh session. This also drops all the closure callbacks remaining from dropped, but not undeclared subscribers.
- *
- * @return `0` in case of success, a negative value if an error occured while closing the session.
+ * Returns ``true`` if `reply` is valid, ``false`` otherwise.
+ */
+ZENOHC_API bool z_internal_reply_check(const struct z_owned_reply_t *this_);
+/**
+ * Returns ``true`` if reply error is in non-default state, ``false`` otherwise.
+ */
+ZENOHC_API bool z_internal_reply_err_check(const struct z_owned_reply_err_t *this_);
+/**
+ * Constructs an empty `z_owned_reply_err_t`.
+ */
+ZENOHC_API void z_internal_reply_err_null(struct z_owned_reply_err_t *this_);
+/**
+ * Constructs the reply in its gravestone state.
+ */
+ZENOHC_API void z_internal_reply_null(struct z_owned_reply_t *this_);
+/**
+ * Returns ``true`` if handler is valid, ``false`` if it is in gravestone state.
+ */
+ZENOHC_API
+bool z_internal_ring_handler_query_check(const struct z_owned_ring_handler_query_t *this_);
+/**
+ * Constructs a handler in gravestone state.
+ */
+ZENOHC_API void z_internal_ring_handler_query_null(struct z_owned_ring_handler_query_t *this_);
+/**
+ * Returns ``true`` if handler is valid, ``false`` if it is in gravestone state.
+ */
+ZENOHC_API
+bool z_internal_ring_handler_reply_check(const struct z_owned_ring_handler_reply_t *this_);
+/**
+ * Constructs a handler in gravestone state.
+ */
+ZENOHC_API void z_internal_ring_handler_reply_null(struct z_owned_ring_handler_reply_t *this_);
+/**
+ * Returns ``true`` if handler is valid, ``false`` if it is in gravestone state.
  */
 ZENOHC_API
-z_result_t z_close(struct z_loaned_session_t *session,
-                   struct z_close_options_t *options);
+bool z_internal_ring_handler_sample_check(const struct z_owned_ring_handler_sample_t *this_);
 /**
- * Constructs the default value for `z_close_options_t`.
+ * Constructs a handler in gravestone state.
  */
-ZENOHC_API void z_close_options_default(struct z_close_options_t *this_);
+ZENOHC_API void z_internal_ring_handler_sample_null(struct z_owned_ring_handler_sample_t *this_);
 /**
- * @brief Constructs closure.
- * A closure is a structure that contains all the elements for stateful, memory-leak-free callbacks:
- *
- * Closures are not guaranteed not to be called concurrently.
- *
- * It is guaranteed that:
- *
- *   - `call` will never be called once `drop` has started.
- *   - `drop` will only be called **once**, and **after every** `call` has ended.
- *   - The two previous guarantees imply that `call` and `drop` are never called concurrently.
- * @param this_: uninitialized memory location where new closure will be constructed.
- * @param call: a closure body.
- * @param drop: an optional function to be called once on closure drop.
- * @param context: closure context.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns ``true`` if reader-writer lock is valid, ``false`` otherwise.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_closure_hello(struct z_owned_closure_hello_t *this_,
-                     void (*call)(struct z_loaned_hello_t *hello, void *context),
-                     void (*drop)(void *context),
-                     void *context);
+bool z_internal_rwlock_check(const struct z_owned_rwlock_t *this_);
+#endif
 /**
- * Calls the closure. Calling an uninitialized closure is a no-op.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs reader-writer lock in a gravestone state.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_closure_hello_call(const struct z_loaned_closure_hello_t *closure,
-                          struct z_loaned_hello_t *hello);
+void z_internal_rwlock_null(struct z_owned_rwlock_t *this_);
+#endif
 /**
- * Drops the closure. Droping an uninitialized closure is a no-op.
+ * Returns ``true`` if sample is valid, ``false`` if it is in gravestone state.
  */
-ZENOHC_API void z_closure_hello_drop(struct z_moved_closure_hello_t *this_);
+ZENOHC_API bool z_internal_sample_check(const struct z_owned_sample_t *this_);
 /**
- * Borrows closure.
+ * Constructs sample in its gravestone state.
  */
-ZENOHC_API
-const struct z_loaned_closure_hello_t *z_closure_hello_loan(const struct z_owned_closure_hello_t *closure);
+ZENOHC_API void z_internal_sample_null(struct z_owned_sample_t *this_);
 /**
- * Mutably norrows closure.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns ``true`` if semaphore is valid, ``false`` otherwise.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-struct z_loaned_closure_hello_t *z_closure_hello_loan_mut(struct z_owned_closure_hello_t *closure);
+bool z_internal_semaphore_check(const struct z_owned_semaphore_t *this_);
+#endif
 /**
- * @brief Constructs closure.
- *
- * Closures are not guaranteed not to be called concurrently.
- *
- * It is guaranteed that:
- *   - `call` will never be called once `drop` has started.
- *   - `drop` will only be called **once**, and **after every** `call` has ended.
- *   - The two previous guarantees imply that `call` and `drop` are never called concurrently.
- * @param this_: uninitialized memory location where new closure will be constructed.
- * @param call: a closure body.
- * @param drop: an optional function to be called once on closure drop.
- * @param context: closure context.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs semaphore in a gravestone state.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_closure_query(struct z_owned_closure_query_t *this_,
-                     void (*call)(struct z_loaned_query_t *query, void *context),
-                     void (*drop)(void *context),
-                     void *context);
+void z_internal_semaphore_null(struct z_owned_semaphore_t *this_);
+#endif
 /**
- * Calls the closure. Calling an uninitialized closure is a no-op.
+ * Returns ``true`` if `session` is valid, ``false`` otherwise.
  */
-ZENOHC_API
-void z_closure_query_call(const struct z_loaned_closure_query_t *closure,
-                          struct z_loaned_query_t *query);
+ZENOHC_API bool z_internal_session_check(const struct z_owned_session_t *this_);
 /**
- * Drops the closure, resetting it to its gravestone state.
+ * Constructs a Zenoh session in its gravestone state.
  */
-ZENOHC_API void z_closure_query_drop(struct z_moved_closure_query_t *closure_);
+ZENOHC_API void z_internal_session_null(struct z_owned_session_t *this_);
 /**
- * Borrows closure.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @return ``true`` if `this` is valid.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-const struct z_loaned_closure_query_t *z_closure_query_loan(const struct z_owned_closure_query_t *closure);
+bool z_internal_shm_check(const struct z_owned_shm_t *this_);
+#endif
 /**
- * Mutably borrows closure.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @return Returns ``true`` if `this` is valid.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-struct z_loaned_closure_query_t *z_closure_query_loan_mut(struct z_owned_closure_query_t *closure);
+bool z_internal_shm_client_check(const struct z_owned_shm_client_t *this_);
+#endif
 /**
- * @brief Constructs closure.
- *
- * Closures are not guaranteed not to be called concurrently.
- *
- * It is guaranteed that:
- *   - `call` will never be called once `drop` has started.
- *   - `drop` will only be called **once**, and **after every** `call` has ended.
- *   - The two previous guarantees imply that `call` and `drop` are never called concurrently.
- * @param this_: uninitialized memory location where new closure will be constructed.
- * @param call: a closure body.
- * @param drop: an optional function to be called once on closure drop.
- * @param context: closure context.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs SHM client in its gravestone value.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-void z_closure_reply(struct z_owned_closure_reply_t *this_,
-                     void (*call)(struct z_loaned_reply_t *reply, void *context),
-                     void (*drop)(void *context),
-                     void *context);
+void z_internal_shm_client_null(struct z_owned_shm_client_t *this_);
+#endif
 /**
- * Calls the closure. Calling an uninitialized closure is a no-op.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @return ``true`` if `this` is valid.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-void z_closure_reply_call(const struct z_loaned_closure_reply_t *closure,
-                          struct z_loaned_reply_t *reply);
+bool z_internal_shm_client_storage_check(const struct z_owned_shm_client_storage_t *this_);
+#endif
 /**
- * Drops the closure, resetting it to its gravestone state. Droping an uninitialized closure is a no-op.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * Constructs SHM Client Storage in its gravestone value.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-void z_closure_reply_drop(struct z_moved_closure_reply_t *closure_);
+void z_internal_shm_client_storage_null(struct z_owned_shm_client_storage_t *this_);
+#endif
 /**
- * Borrows closure.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @return ``true`` if `this` is valid.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-const struct z_loaned_closure_reply_t *z_closure_reply_loan(const struct z_owned_closure_reply_t *closure);
+bool z_internal_shm_mut_check(const struct z_owned_shm_mut_t *this_);
+#endif
 /**
- * Mutably borrows closure.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs ZShmMut slice in its gravestone value.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-struct z_loaned_closure_reply_t *z_closure_reply_loan_mut(struct z_owned_closure_reply_t *closure);
+void z_internal_shm_mut_null(struct z_owned_shm_mut_t *this_);
+#endif
 /**
- * @brief Constructs closure.
- *
- * Closures are not guaranteed not to be called concurrently.
- *
- * It is guaranteed that:
- *   - `call` will never be called once `drop` has started.
- *   - `drop` will only be called **once**, and **after every** `call` has ended.
- *   - The two previous guarantees imply that `call` and `drop` are never called concurrently.
- * @param this_: uninitialized memory location where new closure will be constructed.
- * @param call: a closure body.
- * @param drop: an optional function to be called once on closure drop.
- * @param context: closure context.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs ZShm slice in its gravestone value.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-void z_closure_sample(struct z_owned_closure_sample_t *this_,
-                      void (*call)(struct z_loaned_sample_t *sample, void *context),
-                      void (*drop)(void *context),
-                      void *context);
+void z_internal_shm_null(struct z_owned_shm_t *this_);
+#endif
 /**
- * Calls the closure. Calling an uninitialized closure is a no-op.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns ``true`` if `this` is valid.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-void z_closure_sample_call(const struct z_loaned_closure_sample_t *closure,
-                           struct z_loaned_sample_t *sample);
+bool z_internal_shm_provider_check(const struct z_owned_shm_provider_t *this_);
+#endif
 /**
- * Drops the closure. Droping an uninitialized closure is a no-op.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs SHM Provider in its gravestone value.
  */
-ZENOHC_API void z_closure_sample_drop(struct z_moved_closure_sample_t *closure_);
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+void z_internal_shm_provider_null(struct z_owned_shm_provider_t *this_);
+#endif
 /**
- * Borrows closure.
+ * @return ``true`` if slice is not empty, ``false`` otherwise.
  */
-ZENOHC_API
-const struct z_loaned_closure_sample_t *z_closure_sample_loan(const struct z_owned_closure_sample_t *closure);
+ZENOHC_API bool z_internal_slice_check(const struct z_owned_slice_t *this_);
 /**
- * Mutably borrows closure.
+ * Constructs an empty `z_owned_slice_t`.
  */
-ZENOHC_API
-struct z_loaned_closure_sample_t *z_closure_sample_loan_mut(struct z_owned_closure_sample_t *closure);
+ZENOHC_API void z_internal_slice_null(struct z_owned_slice_t *this_);
 /**
- * @brief Constructs closure.
- *
- * Closures are not guaranteed not to be called concurrently.
- *
- * It is guaranteed that:
- *   - `call` will never be called once `drop` has started.
- *   - `drop` will only be called **once**, and **after every** `call` has ended.
- *   - The two previous guarantees imply that `call` and `drop` are never called concurrently.
- * @param this_: uninitialized memory location where new closure will be constructed.
- * @param call: a closure body.
- * @param drop: an optional function to be called once on closure drop.
- * @param context: closure context.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns ``true`` if source info is valid, ``false`` if it is in gravestone state.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_closure_zid(struct z_owned_closure_zid_t *this_,
-                   void (*call)(const struct z_id_t *z_id, void *context),
-                   void (*drop)(void *context),
-                   void *context);
+bool z_internal_source_info_check(const struct z_owned_source_info_t *this_);
+#endif
 /**
- * @brief Calls the closure. Calling an uninitialized closure is a no-op.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs source info in its gravestone state.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_closure_zid_call(const struct z_loaned_closure_zid_t *closure,
-                        const struct z_id_t *z_id);
+void z_internal_source_info_null(struct z_owned_source_info_t *this_);
+#endif
 /**
- * @brief Drops the closure, resetting it to its gravestone state. Droping an uninitialized (null) closure is a no-op.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns ``true`` if handler is valid, ``false`` if it is in gravestone state.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_closure_zid_drop(struct z_moved_closure_zid_t *closure_);
+bool z_internal_spsc_handler_sample_check(const struct z_owned_spsc_handler_sample_t *this_);
+#endif
 /**
- * @brief Borrows closure.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs a handler in gravestone state.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-const struct z_loaned_closure_zid_t *z_closure_zid_loan(const struct z_owned_closure_zid_t *closure);
+void z_internal_spsc_handler_sample_null(struct z_owned_spsc_handler_sample_t *this_);
+#endif
 /**
- * @brief Mutably borrows closure.
+ * @return ``true`` if the string array is valid, ``false`` if it is in a gravestone state.
  */
-ZENOHC_API
-const struct z_loaned_closure_zid_t *z_closure_zid_loan_mut(const struct z_owned_closure_zid_t *closure);
+ZENOHC_API bool z_internal_string_array_check(const struct z_owned_string_array_t *this_);
 /**
- * Drops conditional variable.
+ * Constructs string array in its gravestone state.
  */
-ZENOHC_API void z_condvar_drop(struct z_moved_condvar_t *this_);
+ZENOHC_API void z_internal_string_array_null(struct z_owned_string_array_t *this_);
 /**
- * Constructs conditional variable.
+ * @return ``true`` if `this_` is a valid string, ``false`` if it is in gravestone state.
  */
-ZENOHC_API void z_condvar_init(struct z_owned_condvar_t *this_);
+ZENOHC_API bool z_internal_string_check(const struct z_owned_string_t *this_);
 /**
- * Borrows conditional variable.
+ * Constructs owned string in a gravestone state.
+ */
+ZENOHC_API void z_internal_string_null(struct z_owned_string_t *this_);
+/**
+ * Returns ``true`` if subscriber is valid, ``false`` otherwise.
+ */
+ZENOHC_API bool z_internal_subscriber_check(const struct z_owned_subscriber_t *this_);
+/**
+ * Constructs a subscriber in a gravestone state.
+ */
+ZENOHC_API void z_internal_subscriber_null(struct z_owned_subscriber_t *this_);
+/**
+ * Returns ``true`` if task is valid, ``false`` otherwise.
  */
-ZENOHC_API const struct z_loaned_condvar_t *z_condvar_loan(const struct z_owned_condvar_t *this_);
+ZENOHC_API bool z_internal_task_check(const struct z_owned_task_t *this_);
 /**
- * Mutably borrows conditional variable.
+ * Constructs task in a gravestone state.
  */
-ZENOHC_API struct z_loaned_condvar_t *z_condvar_loan_mut(struct z_owned_condvar_t *this_);
+ZENOHC_API void z_internal_task_null(struct z_owned_task_t *this_);
 /**
- * Wakes up one blocked thread waiting on this condiitonal variable.
- * @return 0 in case of success, negative error code in case of failure.
+ * Constructs a non-owned non-null-terminated string from key expression.
  */
-ZENOHC_API z_result_t z_condvar_signal(const struct z_loaned_condvar_t *this_);
+ZENOHC_API
+void z_keyexpr_as_view_string(const struct z_loaned_keyexpr_t *this_,
+                              struct z_view_string_t *out_string);
 /**
- * Blocks the current thread until the conditional variable receives a notification.
+ * Canonizes the passed string in place, possibly shortening it by modifying `len`.
  *
- * The function atomically unlocks the guard mutex `m` and blocks the current thread.
- * When the function returns the lock will have been re-aquired again.
- * Note: The function may be subject to spurious wakeups.
+ * May SEGFAULT if `start` is NULL or lies in read-only memory (as values initialized with string litterals do).
+ *
+ * @return 0 upon success, negative error values upon failure (if the passed string was an invalid
+ * key expression for reasons other than a non-canon form).
  */
 ZENOHC_API
-z_result_t z_condvar_wait(const struct z_loaned_condvar_t *this_,
-                          struct z_loaned_mutex_t *m);
+z_result_t z_keyexpr_canonize(char *start,
+                              size_t *len);
 /**
- * Clones the config into provided uninitialized memory location.
+ * Canonizes the passed string in place, possibly shortening it by placing a new null-terminator.
+ * May SEGFAULT if `start` is NULL or lies in read-only memory (as values initialized with string litterals do).
+ *
+ * @return 0 upon success, negative error values upon failure (if the passed string was an invalid
+ * key expression for reasons other than a non-canon form).
  */
-ZENOHC_API void z_config_clone(struct z_owned_config_t *dst, const struct z_loaned_config_t *this_);
+ZENOHC_API
+z_result_t z_keyexpr_canonize_null_terminated(char *start);
 /**
- * Constructs a new empty configuration.
+ * Constructs a copy of the key expression.
  */
-ZENOHC_API z_result_t z_config_default(struct z_owned_config_t *this_);
+ZENOHC_API
+void z_keyexpr_clone(struct z_owned_keyexpr_t *dst,
+                     const struct z_loaned_keyexpr_t *this_);
 /**
- * Frees `config`, and resets it to its gravestone state.
+ * Constructs key expression by concatenation of key expression in `left` with a string in `right`.
+ * Returns 0 in case of success, negative error code otherwise.
+ *
+ * You should probably prefer `z_keyexpr_join` as Zenoh may then take advantage of the hierachical separation it inserts.
+ * To avoid odd behaviors, concatenating a key expression starting with `*` to one ending with `*` is forbidden by this operation,
+ * as this would extremely likely cause bugs.
  */
-ZENOHC_API void z_config_drop(struct z_moved_config_t *this_);
+ZENOHC_API
+z_result_t z_keyexpr_concat(struct z_owned_keyexpr_t *this_,
+                            const struct z_loaned_keyexpr_t *left,
+                            const char *right_start,
+                            size_t right_len);
 /**
- * Borrows config.
+ * Frees key expression and resets it to its gravestone state.
  */
-ZENOHC_API const struct z_loaned_config_t *z_config_loan(const struct z_owned_config_t *this_);
+ZENOHC_API void z_keyexpr_drop(struct z_moved_keyexpr_t *this_);
 /**
- * Mutably borrows config.
+ * Returns ``true`` if both ``left`` and ``right`` are equal, ``false`` otherwise.
  */
-ZENOHC_API struct z_loaned_config_t *z_config_loan_mut(struct z_owned_config_t *this_);
+ZENOHC_API
+bool z_keyexpr_equals(const struct z_loaned_keyexpr_t *left,
+                      const struct z_loaned_keyexpr_t *right);
 /**
- * Declares a background queryable for a given keyexpr. The queryable callback will be be called
- * to proccess incoming queries until the corresponding session is closed or dropped.
- *
- * @param session: The zenoh session.
- * @param key_expr: The key expression the Queryable will reply to.
- * @param callback: The callback function that will be called each time a matching query is received. Its ownership is passed to queryable.
- * @param options: Options for the queryable.
- *
- * @return 0 in case of success, negative error code otherwise (in this case )
+ * Constructs a `z_owned_keyexpr_t` from a string, copying the passed string.
+ * @return 0 in case of success, negative error code in case of failure (for example if `expr` is not a valid key expression or if it is
+ * not in canon form.
  */
 ZENOHC_API
-z_result_t z_declare_background_queryable(const struct z_loaned_session_t *session,
-                                          const struct z_loaned_keyexpr_t *key_expr,
-                                          struct z_moved_closure_query_t *callback,
-                                          struct z_queryable_options_t *options);
+z_result_t z_keyexpr_from_str(struct z_owned_keyexpr_t *this_,
+                              const char *expr);
 /**
- * Constructs and declares a background subscriber. Subscriber callback will be called to process the messages,
- * until the corresponding session is closed or dropped.
- *
- * @param session: The zenoh session.
- * @param key_expr: The key expression to subscribe.
- * @param callback: The callback function that will be called each time a data matching the subscribed expression is received.
- * @param options: The options to be passed to the subscriber declaration.
- *
- * @return 0 in case of success, negative error code otherwise.
+ * Constructs `z_owned_keyexpr_t` from a string, copying the passed string. The copied string is canonized.
+ * @return 0 in case of success, negative error code in case of failure (for example if expr is not a valid key expression
+ * even despite canonization).
  */
 ZENOHC_API
-z_result_t z_declare_background_subscriber(const struct z_loaned_session_t *session,
-                                           const struct z_loaned_keyexpr_t *key_expr,
-                                           struct z_moved_closure_sample_t *callback,
-                                           struct z_subscriber_options_t *options);
+z_result_t z_keyexpr_from_str_autocanonize(struct z_owned_keyexpr_t *this_,
+                                           const char *expr);
 /**
- * Constructs and declares a key expression on the network. This reduces key key expression to a numerical id,
- * which allows to save the bandwitdth, when passing key expression between Zenoh entities.
+ * Constructs a `z_owned_keyexpr_t` by copying a substring.
  *
- * @param session: Session on which to declare key expression.
- * @param declared_key_expr: An uninitialized location in memory where key expression will be constructed.
- * @param key_expr: Key expression to declare on network.
+ * @param this_: An uninitialized location in memory where key expression will be constructed.
+ * @param expr: A buffer with length >= `len`.
+ * @param len: Number of characters from `expr` to consider.
  * @return 0 in case of success, negative error code otherwise.
  */
 ZENOHC_API
-z_result_t z_declare_keyexpr(const struct z_loaned_session_t *session,
-                             struct z_owned_keyexpr_t *declared_key_expr,
-                             const struct z_loaned_keyexpr_t *key_expr);
+z_result_t z_keyexpr_from_substr(struct z_owned_keyexpr_t *this_,
+                                 const char *expr,
+                                 size_t len);
 /**
- * Constructs and declares a publisher for the given key expression.
- *
- * Data can be put and deleted with this publisher with the help of the
- * `z_publisher_put()` and `z_publisher_delete()` functions.
- *
- * @param session: The Zenoh session.
- * @param publisher: An uninitialized location in memory where publisher will be constructed.
- * @param key_expr: The key expression to publish.
- * @param options: Additional options for the publisher.
+ * Constructs a `z_keyexpr_t` by copying a substring.
  *
+ * @param this_: An uninitialized location in memory where key expression will be constructed.
+ * @param start: A buffer of with length >= `len`.
+ * @param len: Number of characters from `expr` to consider. Will be modified to be equal to canonized key expression length.
  * @return 0 in case of success, negative error code otherwise.
  */
 ZENOHC_API
-z_result_t z_declare_publisher(const struct z_loaned_session_t *session,
-                               struct z_owned_publisher_t *publisher,
-                               const struct z_loaned_keyexpr_t *key_expr,
-                               struct z_publisher_options_t *options);
+z_result_t z_keyexpr_from_substr_autocanonize(struct z_owned_keyexpr_t *this_,
+                                              const char *start,
+                                              size_t *len);
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Constructs and declares a querier on the given key expression.
- *
- * The queries can be send with the help of the `z_querier_get()` function.
- *
- * @param session: The Zenoh session.
- * @param querier: An uninitialized location in memory where querier will be constructed.
- * @param key_expr: The key expression to send queries on.
- * @param options: Additional options for the querier.
+ * @brief Returns a 64-bit hash of the key expression.
  *
- * @return 0 in case of success, negative error code otherwise.
+ * The hash is the 64-bit FNV-1a hash of the key expression string. It does not depend on the process nor on the
+ * Zenoh version, so it can be used as a hash-map key, stored or exchanged between applications.
+ * Equal key expressions always have the same hash.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t z_declare_querier(const struct z_loaned_session_t *session,
-                             struct z_owned_querier_t *querier,
-                             const struct z_loaned_keyexpr_t *key_expr,
-                             struct z_querier_options_t *options);
+uint64_t z_keyexpr_hash(const struct z_loaned_keyexpr_t *this_);
 #endif
 /**
- * Constructs a Queryable for the given key expression.
- *
- * @param session: A Zenoh session.
- * @param queryable: An uninitialized memory location where queryable will be constructed.
- * @param key_expr: The key expression the Queryable will reply to.
- * @param callback: The callback function that will be called each time a matching query is received. Its ownership is passed to queryable.
- * @param options: Options for the queryable.
- *
- * @return 0 in case of success, negative error code otherwise (in this case )
+ * Returns ``true`` if ``left`` includes ``right``, i.e. the set defined by ``left`` contains every key belonging to the set
+ * defined by ``right``, ``false`` otherwise.
  */
 ZENOHC_API
-z_result_t z_declare_queryable(const struct z_loaned_session_t *session,
-                               struct z_owned_queryable_t *queryable,
-                               const struct z_loaned_keyexpr_t *key_expr,
-                               struct z_moved_closure_query_t *callback,
-                               struct z_queryable_options_t *options);
+bool z_keyexpr_includes(const struct z_loaned_keyexpr_t *left,
+                        const struct z_loaned_keyexpr_t *right);
 /**
- * Constructs and declares a subscriber for a given key expression. Dropping subscriber undeclares its callback.
- *
- * @param session: The zenoh session.
- * @param subscriber: An uninitialized location in memory, where subscriber will be constructed.
- * @param key_expr: The key expression to subscribe.
- * @param callback: The callback function that will be called each time a data matching the subscribed expression is received.
- * @param options: The options to be passed to the subscriber declaration.
- *
- * @return 0 in case of success, negative error code otherwise (in this case subscriber will be in its gravestone state).
+ * Returns ``true`` if the keyexprs intersect, i.e. there exists at least one key which is contained in both of the
+ * sets defined by ``left`` and ``right``, ``false`` otherwise.
  */
 ZENOHC_API
-z_result_t z_declare_subscriber(const struct z_loaned_session_t *session,
-                                struct z_owned_subscriber_t *subscriber,
-                                const struct z_loaned_keyexpr_t *key_expr,
-                                struct z_moved_closure_sample_t *callback,
-                                struct z_subscriber_options_t *options);
+bool z_keyexpr_intersects(const struct z_loaned_keyexpr_t *left,
+                          const struct z_loaned_keyexpr_t *right);
 /**
- * Sends request to delete data on specified key expression (used when working with <a href="https://zenoh.io/docs/manual/abstractions/#storage"> Zenoh storages </a>).
- *
- * @param session: The zenoh session.
- * @param key_expr: The key expression to delete.
- * @param options: The delete options.
- *
- * @return 0 in case of success, negative values in case of failure.
+ * Returns 0 if the passed string is a valid (and canon) key expression.
+ * Otherwise returns negative error value.
  */
-ZENOHC_API
-z_result_t z_delete(const struct z_loaned_session_t *session,
-                    const struct z_loaned_keyexpr_t *key_expr,
-                    struct z_delete_options_t *options);
+ZENOHC_API z_result_t z_keyexpr_is_canon(const char *start, size_t len);
 /**
- * Constructs the default value for `z_delete_options_t`.
+ * Constructs key expression by performing path-joining (automatically inserting) of `left` with `right`.
+ * @return 0 in case of success, negative error code otherwise.
  */
-ZENOHC_API void z_delete_options_default(struct z_delete_options_t *this_);
+ZENOHC_API
+z_result_t z_keyexpr_join(struct z_owned_keyexpr_t *this_,
+                          const struct z_loaned_keyexpr_t *left,
+                          const struct z_loaned_keyexpr_t *right);
 /**
- * A Concise Binary Object Representation (CBOR)-encoded data.
- *
- * Constant alias for string: `"application/cbor"`.
+ * Borrows `z_owned_keyexpr_t`.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_cbor(void);
+ZENOHC_API const struct z_loaned_keyexpr_t *z_keyexpr_loan(const struct z_owned_keyexpr_t *this_);
 /**
- * A Common Data Representation (CDR)-encoded data.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns the relation between `left` and `right` from `left`'s point of view.
  *
- * Constant alias for string: `"application/cdr"`.
+ * @note This is slower than `z_keyexpr_intersects` and `keyexpr_includes`, so you should favor these methods for most applications.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_cdr(void);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+enum z_keyexpr_intersection_level_t z_keyexpr_relation_to(const struct z_loaned_keyexpr_t *left,
+                                                          const struct z_loaned_keyexpr_t *right);
+#endif
 /**
- * Constrained Application Protocol (CoAP) data intended for CoAP-to-HTTP and HTTP-to-CoAP proxies.
+ * @brief Declares a subscriber on liveliness tokens that intersect `key_expr`.
  *
- * Constant alias for string: `"application/coap-payload"`.
- */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_coap_payload(void);
-/**
- * A Java serialized object.
+ * @param session: A Zenoh session.
+ * @param subscriber: An uninitialized memory location where subscriber will be constructed.
+ * @param key_expr: The key expression to subscribe to.
+ * @param callback: The callback function that will be called each time a liveliness token status is changed.
+ * @param options: The options to be passed to the liveliness subscriber declaration.
  *
- * Constant alias for string: `"application/java-serialized-object"`.
+ * @return 0 in case of success, negative error values otherwise.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_java_serialized_object(void);
+ZENOHC_API
+z_result_t z_liveliness_declare_subscriber(const struct z_loaned_session_t *session,
+                                           struct z_owned_subscriber_t *subscriber,
+                                           const struct z_loaned_keyexpr_t *key_expr,
+                                           struct z_moved_closure_sample_t *callback,
+                                           struct z_liveliness_subscriber_options_t *options);
 /**
- * JSON data intended to be consumed by an application.
+ * @brief Constructs and declares a liveliness token on the network.
  *
- * Constant alias for string: `"application/json"`.
+ * Liveliness token subscribers on an intersecting key expression will receive a PUT sample when connectivity
+ * is achieved, and a DELETE sample if it's lost.
+ *
+ * @param session: A Zenos session to declare the liveliness token.
+ * @param token: An uninitialized memory location where liveliness token will be constructed.
+ * @param key_expr: A keyexpr to declare a liveliess token for.
+ * @param _options: Liveliness token declaration properties.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_json(void);
+ZENOHC_API
+z_result_t z_liveliness_declare_token(const struct z_loaned_session_t *session,
+                                      struct z_owned_liveliness_token_t *token,
+                                      const struct z_loaned_keyexpr_t *key_expr,
+                                      const struct z_liveliness_token_options_t *_options);
 /**
- * Defines a JSON document structure for expressing a sequence of operations to apply to a JSON document.
+ * @brief Queries liveliness tokens currently on the network with a key expression intersecting with `key_expr`.
  *
- * Constant alias for string: `"application/json-patch+json"`.
+ * @param session: The Zenoh session.
+ * @param key_expr: The key expression to query liveliness tokens for.
+ * @param callback: The callback function that will be called for each received reply.
+ * @param options: Additional options for the liveliness get operation.
  */
 ZENOHC_API
-const struct z_loaned_encoding_t *z_encoding_application_json_patch_json(void);
+z_result_t z_liveliness_get(const struct z_loaned_session_t *session,
+                            const struct z_loaned_keyexpr_t *key_expr,
+                            struct z_moved_closure_reply_t *callback,
+                            struct z_liveliness_get_options_t *options);
 /**
- * A JSON text sequence consists of any number of JSON texts, all encoded in UTF-8.
- *
- * Constant alias for string: `"application/json-seq"`.
+ * @brief Constructs default value `z_liveliness_get_options_t`.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_json_seq(void);
+ZENOHC_API void z_liveliness_get_options_default(struct z_liveliness_get_options_t *this_);
 /**
- * A JSONPath defines a string syntax for selecting and extracting JSON values from within a given JSON value.
- *
- * Constant alias for string: `"application/jsonpath"`.
+ * @brief Constucts default value for `z_liveliness_declare_subscriber_options_t`.
  */
 ZENOHC_API
-const struct z_loaned_encoding_t *z_encoding_application_jsonpath(void);
+void z_liveliness_subscriber_options_default(struct z_liveliness_subscriber_options_t *this_);
 /**
- * A JSON Web Token (JWT).
- *
- * Constant alias for string: `"application/jwt"`.
+ * @brief Undeclares liveliness token, frees memory and resets it to a gravestone state.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_jwt(void);
+ZENOHC_API void z_liveliness_token_drop(struct z_moved_liveliness_token_t *this_);
 /**
- * An application-specific MPEG-4 encoded data, either audio or video.
- *
- * Constant alias for string: `"application/mp4"`.
+ * @brief Borrows token.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_mp4(void);
+ZENOHC_API
+const struct z_loaned_liveliness_token_t *z_liveliness_token_loan(const struct z_owned_liveliness_token_t *this_);
 /**
- * An application-specific stream of bytes.
- *
- * Constant alias for string: `"application/octet-stream"`.
+ * @brief Constructs default value for `z_liveliness_token_options_t`.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_octet_stream(void);
+ZENOHC_API void z_liveliness_token_options_default(struct z_liveliness_token_options_t *this_);
 /**
- * An [openmetrics](https://github.com/OpenObservability/OpenMetrics) data, common used by [Prometheus](https://prometheus.io/).
- *
- * Constant alias for string: `"application/openmetrics-text"`.
+ * @brief Destroys a liveliness token, notifying subscribers of its destruction.
  */
-ZENOHC_API
-const struct z_loaned_encoding_t *z_encoding_application_openmetrics_text(void);
+ZENOHC_API z_result_t z_liveliness_undeclare_token(struct z_moved_liveliness_token_t *this_);
 /**
- * An application-specific protobuf-encoded data.
- *
- * Constant alias for string: `"application/protobuf"`.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Deletes Memory Layout.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_protobuf(void);
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+void z_memory_layout_drop(struct z_moved_memory_layout_t *this_);
+#endif
 /**
- * A Python object serialized using [pickle](https://docs.python.org/3/library/pickle.html).
- *
- * Constant alias for string: `"application/python-serialized-object"`.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Extract data from Memory Layout.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_python_serialized_object(void);
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+void z_memory_layout_get_data(const struct z_loaned_memory_layout_t *this_,
+                              size_t *out_size,
+                              struct z_alloc_alignment_t *out_alignment);
+#endif
 /**
- * A SOAP 1.2 message serialized as XML 1.0.
- *
- * Constant alias for string: `"application/soap+xml"`.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Borrows Memory Layout.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_soap_xml(void);
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+const struct z_loaned_memory_layout_t *z_memory_layout_loan(const struct z_owned_memory_layout_t *this_);
+#endif
 /**
- * An application-specific SQL query.
- *
- * Constant alias for string: `"application/sql"`.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Creates a new Memory Layout.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_sql(void);
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+z_result_t z_memory_layout_new(struct z_owned_memory_layout_t *this_,
+                               size_t size,
+                               struct z_alloc_alignment_t alignment);
+#endif
 /**
- * An encoded a list of tuples, each consisting of a name and a value.
- *
- * Constant alias for string: `"application/x-www-form-urlencoded"`.
+ * Drops mutex and resets it to its gravestone state.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_x_www_form_urlencoded(void);
+ZENOHC_API void z_mutex_drop(struct z_moved_mutex_t *this_);
 /**
- * An XML file intended to be consumed by an application..
- *
- * Constant alias for string: `"application/xml"`.
+ * Constructs a mutex.
+ * @return 0 in case of success, negative error code otherwise.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_xml(void);
+ZENOHC_API z_result_t z_mutex_init(struct z_owned_mutex_t *this_);
 /**
- * YAML data intended to be consumed by an application.
- *
- * Constant alias for string: `"application/yaml"`.
+ * Mutably borrows mutex.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_yaml(void);
+ZENOHC_API struct z_loaned_mutex_t *z_mutex_loan_mut(struct z_owned_mutex_t *this_);
 /**
- * A YANG-encoded data commonly used by the Network Configuration Protocol (NETCONF).
- *
- * Constant alias for string: `"application/yang"`.
+ * Locks mutex. If mutex is already locked, blocks the thread until it aquires the lock.
+ * @return 0 in case of success, negative error code in case of failure.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_application_yang(void);
+ZENOHC_API z_result_t z_mutex_lock(struct z_loaned_mutex_t *this_);
 /**
- * A MPEG-4 Advanced Audio Coding (AAC) media.
- *
- * Constant alias for string: `"audio/aac"`.
+ * Tries to lock mutex. If mutex is already locked, return immediately.
+ * @return 0 in case of success, negative value if failed to aquire the lock.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_audio_aac(void);
+ZENOHC_API z_result_t z_mutex_try_lock(struct z_loaned_mutex_t *this_);
 /**
- * A Free Lossless Audio Codec (FLAC) media.
- *
- * Constant alias for string: `"audio/flac"`.
+ * Unlocks previously locked mutex. If mutex was not locked by the current thread, the behaviour is undefined.
+ * @return 0 in case of success, negative error code otherwise.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_audio_flac(void);
+ZENOHC_API
+z_result_t z_mutex_unlock(struct z_loaned_mutex_t *this_);
 /**
- * An audio codec defined in MPEG-1, MPEG-2, MPEG-4, or registered at the MP4 registration authority.
+ * Constructs and opens a new Zenoh session.
  *
- * Constant alias for string: `"audio/mp4"`.
+ * @return 0 in case of success, negative error code otherwise (in this case the session will be in its gravestone state).
  */
 ZENOHC_API
-const struct z_loaned_encoding_t *z_encoding_audio_mp4(void);
+z_result_t z_open(struct z_owned_session_t *this_,
+                  struct z_moved_config_t *config,
+                  const struct z_open_options_t *_options);
 /**
- * An Ogg-encapsulated audio stream.
- *
- * Constant alias for string: `"audio/ogg"`.
+ * Constructs the default value for `z_open_options_t`.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_audio_ogg(void);
+ZENOHC_API void z_open_options_default(struct z_open_options_t *this_);
 /**
- * A Vorbis-encoded audio stream.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs and opens a new Zenoh session with specified client storage.
  *
- * Constant alias for string: `"audio/vorbis"`.
+ * @return 0 in case of success, negative error code otherwise (in this case the session will be in its gravestone state).
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_audio_vorbis(void);
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+z_result_t z_open_with_custom_shm_clients(struct z_owned_session_t *this_,
+                                          struct z_moved_config_t *config,
+                                          const struct z_loaned_shm_client_storage_t *shm_clients);
+#endif
 /**
- * Constructs an owned copy of the encoding in provided uninitilized memory location.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Creates a new POSIX SHM Client.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-void z_encoding_clone(struct z_owned_encoding_t *dst,
-                      const struct z_loaned_encoding_t *this_);
+void z_posix_shm_client_new(struct z_owned_shm_client_t *this_);
+#endif
 /**
- * Frees the memory and resets the encoding it to its default value.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Creates a new POSIX SHM Provider.
  */
-ZENOHC_API void z_encoding_drop(struct z_moved_encoding_t *this_);
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+z_result_t z_posix_shm_provider_new(struct z_owned_shm_provider_t *this_,
+                                    const struct z_loaned_memory_layout_t *layout);
+#endif
 /**
- * Returns ``true`` if `this_` equals to `other`, ``false`` otherwise.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs send and recieve ends of a priority channel, with a bounded queue per sample priority.
+ *
+ * Samples are queued according to `z_sample_priority()`, each priority level having its own capacity and overflow
+ * policy, and are received in priority order rather than in order of arrival: a `Z_PRIORITY_REAL_TIME` sample
+ * overtakes the pending `Z_PRIORITY_BACKGROUND` ones, and a burst of low priority samples can only push out samples
+ * of its own level. Samples of the same level are received in order of arrival.
+ *
+ * @param callback: An uninitialized memory location where the callback will be constructed.
+ * @param handler: An uninitialized memory location where the handler will be constructed.
+ * @param options: The settings of the priority levels, pass NULL to use the default ones
+ * (see `zc_priority_channel_options_default()`).
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-bool z_encoding_equals(const struct z_loaned_encoding_t *this_,
-                       const struct z_loaned_encoding_t *other);
+void z_priority_channel_sample_new(struct z_owned_closure_sample_t *callback,
+                                   struct z_owned_priority_handler_sample_t *handler,
+                                   const struct zc_priority_channel_options_t *options);
+#endif
 /**
- * Constructs a `z_owned_encoding_t` from a specified string.
+ * Returns the default value of #z_priority_t.
  */
-ZENOHC_API z_result_t z_encoding_from_str(struct z_owned_encoding_t *this_, const char *s);
+ZENOHC_API enum z_priority_t z_priority_default(void);
 /**
- * Constructs a `z_owned_encoding_t` from a specified substring.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Drops the handler and resets it to a gravestone state.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t z_encoding_from_substr(struct z_owned_encoding_t *this_,
-                                  const char *s,
-                                  size_t len);
-/**
- * A BitMap (BMP) image.
- *
- * Constant alias for string: `"image/bmp"`.
- */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_image_bmp(void);
+void z_priority_handler_sample_drop(struct z_moved_priority_handler_sample_t *this_);
+#endif
 /**
- * A Graphics Interchange Format (GIF) image.
- *
- * Constant alias for string: `"image/gif"`.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Borrows handler.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_image_gif(void);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+const struct z_loaned_priority_handler_sample_t *z_priority_handler_sample_loan(const struct z_owned_priority_handler_sample_t *this_);
+#endif
 /**
- * A Joint Photographic Experts Group (JPEG) image.
- *
- * Constant alias for string: `"image/jpeg"`.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns the next sample in priority order. If there are no pending samples will block until next sample is
+ * received, or until the channel is dropped (normally when there are no more samples to receive).
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the sample will be in the gravestone state).
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_image_jpeg(void);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_priority_handler_sample_recv(const struct z_loaned_priority_handler_sample_t *this_,
+                                          struct z_owned_sample_t *sample);
+#endif
 /**
- * A Portable Network Graphics (PNG) image.
- *
- * Constant alias for string: `"image/png"`.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns the next sample in priority order. If there are no pending samples will return immediately (with sample
+ * set to its gravestone state).
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the sample will be in the gravestone state),
+ * `Z_CHANNEL_NODATA` if the channel is still alive, but no sample is pending (the sample will be in the gravestone state).
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_image_png(void);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_priority_handler_sample_try_recv(const struct z_loaned_priority_handler_sample_t *this_,
+                                              struct z_owned_sample_t *sample);
+#endif
 /**
- * A Web Portable (WebP) image.
+ * Sends a `DELETE` message onto the publisher's key expression.
  *
- *  Constant alias for string: `"image/webp"`.
+ * @return 0 in case of success, negative error code in case of failure.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_image_webp(void);
+ZENOHC_API
+z_result_t z_publisher_delete(const struct z_loaned_publisher_t *publisher,
+                              struct z_publisher_delete_options_t *options);
 /**
- * Borrows encoding.
+ * Constructs the default values for the delete operation via a publisher entity.
  */
-ZENOHC_API
-const struct z_loaned_encoding_t *z_encoding_loan(const struct z_owned_encoding_t *this_);
+ZENOHC_API void z_publisher_delete_options_default(struct z_publisher_delete_options_t *this_);
 /**
- * Returns a loaned default `z_loaned_encoding_t`.
+ * Frees memory and resets publisher to its gravestone state.
+ * This is equivalent to calling `z_undeclare_publisher()` and discarding its return value.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_loan_default(void);
+ZENOHC_API void z_publisher_drop(struct z_moved_publisher_t *this_);
 /**
- * Mutably borrows encoding.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Sends all messages kept pending by the coalescing mode of the publisher.
+ *
+ * Does nothing if the coalescing mode is not enabled.
+ *
+ * @return 0 in case of success, otherwise the error code of the first failed put.
  */
-ZENOHC_API struct z_loaned_encoding_t *z_encoding_loan_mut(struct z_owned_encoding_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_publisher_flush(const struct z_loaned_publisher_t *this_);
+#endif
 /**
- * Set a schema to this encoding from a c string. Zenoh does not define what a schema is and its semantichs is left to the implementer.
- * E.g. a common schema for `text/plain` encoding is `utf-8`.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns the ID of the publisher.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t z_encoding_set_schema_from_str(struct z_loaned_encoding_t *this_,
-                                          const char *s);
+struct z_entity_global_id_t z_publisher_id(const struct z_loaned_publisher_t *publisher);
+#endif
 /**
- * Set a schema to this encoding from a c substring. Zenoh does not define what a schema is and its semantichs is left to the implementer.
- * E.g. a common schema for `text/plain` encoding is `utf-8`.
+ * Returns the key expression of the publisher.
  */
 ZENOHC_API
-z_result_t z_encoding_set_schema_from_substr(struct z_loaned_encoding_t *this_,
-                                             const char *s,
-                                             size_t len);
+const struct z_loaned_keyexpr_t *z_publisher_keyexpr(const struct z_loaned_publisher_t *publisher);
 /**
- * A CSS file.
- *
- * Constant alias for string: `"text/css"`.
+ * Borrows publisher.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_text_css(void);
+ZENOHC_API
+const struct z_loaned_publisher_t *z_publisher_loan(const struct z_owned_publisher_t *this_);
 /**
- * A CSV file.
- *
- * Constant alias for string: `"text/csv"`.
+ * Mutably borrows publisher.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_text_csv(void);
+ZENOHC_API struct z_loaned_publisher_t *z_publisher_loan_mut(struct z_owned_publisher_t *this_);
 /**
- * An HTML file.
- *
- * Constant alias for string: `"text/html"`.
+ * Constructs the default value for `z_publisher_options_t`.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_text_html(void);
+ZENOHC_API void z_publisher_options_default(struct z_publisher_options_t *this_);
 /**
- * A JavaScript file.
+ * Sends a `PUT` message onto the publisher's key expression, transfering the payload ownership.
  *
- * Constant alias for string: `"text/javascript"`.
- */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_text_javascript(void);
-/**
- * JSON data intended to be human readable.
  *
- * Constant alias for string: `"text/json"`.
- */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_text_json(void);
-/**
- * JSON5 encoded data that are human readable.
+ * The payload and all owned options fields are consumed upon function return.
  *
- * Constant alias for string: `"text/json5"`.
- */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_text_json5(void);
-/**
- * A MarkDown file.
+ * @param this_: The publisher.
+ * @param payload: The data to publish. Will be consumed.
+ * @param options: The publisher put options. All owned fields will be consumed.
  *
- * Constant alias for string: `"text/markdown"`.
+ * @return 0 in case of success, negative error values in case of failure.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_text_markdown(void);
+ZENOHC_API
+z_result_t z_publisher_put(const struct z_loaned_publisher_t *this_,
+                           struct z_moved_bytes_t *payload,
+                           struct z_publisher_put_options_t *options);
 /**
- * A textual file.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Sends a sequence of `PUT` messages onto the publisher's key expression, transfering the ownership of all payloads.
  *
- * Constant alias for string: `"text/plain"`.
- */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_text_plain(void);
-/**
- * An XML file that is human readable.
+ * The messages are enqueued back to back in a single call, with the put options applied to each of them.
+ * The payloads and all owned options fields are consumed upon function return, even if some of the puts fail.
  *
- * Constant alias for string: `"text/xml"`.
- */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_text_xml(void);
-/**
- * YAML data intended to be human readable.
+ * @param this_: The publisher.
+ * @param payloads: A pointer to an array of `len` payloads to publish. All of them will be consumed.
+ * @param len: The number of payloads.
+ * @param options: The publisher put options, applied to every message. All owned fields will be consumed.
+ * @param results: An optional pointer to an array of `len` elements, that will receive the result of each individual put.
  *
- * Constant alias for string: `"text/yaml"`.
+ * @return 0 if all messages were put successfully, otherwise the error code of the first failed put.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_text_yaml(void);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_publisher_put_batch(const struct z_loaned_publisher_t *this_,
+                                 struct z_moved_bytes_t *payloads,
+                                 size_t len,
+                                 struct z_publisher_put_options_t *options,
+                                 z_result_t *results);
+#endif
 /**
- * Constructs an owned non-null-terminated string from encoding
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Sends a `PUT` message onto the publisher's key expression, producing its payload only if there are matching
+ * subscribers.
  *
- * @param this_: Encoding.
- * @param out_str: Uninitialized memory location where a string to be constructed.
+ * `produce` is called to construct the payload, unless the publisher is known to have no matching subscribers, so that
+ * the cost of serializing messages nobody receives is avoided. The first call declares a matching listener for the
+ * publisher, after which checking the matching status is a single atomic load.
+ * Since the status is updated asynchronously, a message may still be produced and dropped by zenoh just after the last
+ * subscriber disappeared, and messages put just after the first subscriber appeared may be skipped.
+ *
+ * All owned options fields are consumed upon function return, whether the message is sent or not.
+ *
+ * @param this_: The publisher.
+ * @param produce: The function constructing the payload in the uninitialized memory location passed to it. It should
+ * return 0 in case of success, or a negative error code, in which case the payload must be left uninitialized and no
+ * message is sent.
+ * @param context: The context passed to `produce`.
+ * @param options: The publisher put options. All owned fields will be consumed.
+ *
+ * @return 0 if the message was sent or skipped, the error code of `produce` if it failed, negative error values in case
+ * of failure otherwise.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_encoding_to_string(const struct z_loaned_encoding_t *this_,
-                          struct z_owned_string_t *out_str);
+z_result_t z_publisher_put_lazy(const struct z_loaned_publisher_t *this_,
+                                z_result_t (*produce)(struct z_owned_bytes_t *payload, void *context),
+                                void *context,
+                                struct z_publisher_put_options_t *options);
+#endif
 /**
- * A h261-encoded video stream.
- *
- * Constant alias for string: `"video/h261"`.
+ * Constructs the default value for `z_publisher_put_options_t`.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_video_h261(void);
+ZENOHC_API void z_publisher_put_options_default(struct z_publisher_put_options_t *this_);
 /**
- * A h263-encoded video stream.
+ * Publishes data on specified key expression.
  *
- * Constant alias for string: `"video/h263"`.
+ * @param session: The Zenoh session.
+ * @param key_expr: The key expression to publish to.
+ * @param payload: The value to put (consumed upon function return).
+ * @param options: The put options (all owned values will be consumed upon function return).
+ *
+ * @return 0 in case of success, negative error values in case of failure.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_video_h263(void);
+ZENOHC_API
+z_result_t z_put(const struct z_loaned_session_t *session,
+                 const struct z_loaned_keyexpr_t *key_expr,
+                 struct z_moved_bytes_t *payload,
+                 struct z_put_options_t *options);
 /**
- * A h264-encoded video stream.
- *
- * Constant alias for string: `"video/h264"`.
+ * Constructs the default value for `z_put_options_t`.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_video_h264(void);
+ZENOHC_API void z_put_options_default(struct z_put_options_t *this_);
 /**
- * A h265-encoded video stream.
- *
- * Constant alias for string: `"video/h265"`.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Frees memory and resets querier to its gravestone state.
+ * This is equivalent to calling `z_undeclare_querier()` and discarding its return value.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_video_h265(void);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+void z_querier_drop(struct z_moved_querier_t *this_);
+#endif
 /**
- * A h266-encoded video stream.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Query data from the matching queryables in the system.
+ * Replies are provided through a callback function.
  *
- * Constant alias for string: `"video/h266"`.
+ * @param querier: The querier to make query from.
+ * @param parameters: The query's parameters, similar to a url's query segment.
+ * @param callback: The callback function that will be called on reception of replies for this query. It will be automatically dropped once all replies are processed.
+ * @param options: Additional options for the get. All owned fields will be consumed.
+ *
+ * @return 0 in case of success, a negative error value upon failure.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_video_h266(void);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_querier_get(const struct z_loaned_querier_t *querier,
+                         const char *parameters,
+                         struct z_moved_closure_reply_t *callback,
+                         struct z_querier_get_options_t *options);
+#endif
 /**
- * A video codec defined in MPEG-1, MPEG-2, MPEG-4, or registered at the MP4 registration authority.
- *
- * Constant alias for string: `"video/mp4"`.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs the default value for `z_querier_get_options_t`.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_video_mp4(void);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+void z_querier_get_options_default(struct z_querier_get_options_t *this_);
+#endif
 /**
- * An Ogg-encapsulated video stream.
- *
- * Constant alias for string: `"video/ogg"`.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns the ID of the querier.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_video_ogg(void);
+#if (defined(Z_FEATURE_UNSTABLE_API) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+struct z_entity_global_id_t z_querier_id(const struct z_loaned_querier_t *querier);
+#endif
 /**
- * An uncompressed, studio-quality video stream.
- *
- * Constant alias for string: `"video/raw"`.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns the key expression of the querier.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_video_raw(void);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+const struct z_loaned_keyexpr_t *z_querier_keyexpr(const struct z_loaned_querier_t *querier);
+#endif
 /**
- * A VP8-encoded video stream.
- *
- * Constant alias for string: `"video/vp8"`.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Borrows querier.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_video_vp8(void);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+const struct z_loaned_querier_t *z_querier_loan(const struct z_owned_querier_t *this_);
+#endif
 /**
- * A VP9-encoded video stream.
- *
- * Constant alias for string: `"video/vp9"`.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Mutably borrows querier.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_video_vp9(void);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+struct z_loaned_querier_t *z_querier_loan_mut(struct z_owned_querier_t *this_);
+#endif
 /**
- * Just some bytes.
- *
- * Constant alias for string: `"zenoh/bytes"`.
- *
- * This encoding supposes that the payload was created with `z_bytes_from_buf()`, `z_bytes_from_slice()` or
- * similar functions and its data can be accessed via `z_bytes_to_slice()`.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs the default value for `z_querier_options_t`.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-const struct z_loaned_encoding_t *z_encoding_zenoh_bytes(void);
+void z_querier_options_default(struct z_querier_options_t *this_);
+#endif
 /**
- * Zenoh serialized data.
- *
- * Constant alias for string: `"zenoh/serialized"`.
+ * Gets query attachment.
  *
- * This encoding supposes that the payload was created with serialization functions.
- * The `schema` field may contain the details of serialziation format.
+ * Returns NULL if query does not contain an attachment.
  */
-ZENOHC_API const struct z_loaned_encoding_t *z_encoding_zenoh_serialized(void);
+ZENOHC_API const struct z_loaned_bytes_t *z_query_attachment(const struct z_loaned_query_t *this_);
 /**
- * A UTF-8 string.
- *
- * Constant alias for string: `"zenoh/string"`.
+ * Gets mutable query attachment.
  *
- * This encoding supposes that the payload was created with `z_bytes_from_str()`, `z_bytes_from_string()` or
- * similar functions and its data can be accessed via `z_bytes_to_string()`.
+ * Returns NULL if query does not contain an attachment.
  */
-ZENOHC_API
-const struct z_loaned_encoding_t *z_encoding_zenoh_string(void);
+ZENOHC_API struct z_loaned_bytes_t *z_query_attachment_mut(struct z_loaned_query_t *this_);
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Returns the entity id of the entity global id.
+ * Constructs a shallow copy of the query, allowing to keep it in an "open" state past the callback's return.
+ *
+ * This operation is infallible, but may return a gravestone value if `query` itself was a gravestone value (which cannot be the case in a callback).
  */
-#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-uint32_t z_entity_global_id_eid(const struct z_entity_global_id_t *this_);
-#endif
+void z_query_clone(struct z_owned_query_t *dst,
+                   const struct z_loaned_query_t *this_);
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Returns the zenoh id of entity global id.
+ * Automatic query consolidation strategy selection.
+ *
+ * A query consolidation strategy will automatically be selected depending the query selector.
+ * If the selector contains time range properties, no consolidation is performed.
+ * Otherwise the `z_query_consolidation_latest` strategy is used.
+ */
+ZENOHC_API struct z_query_consolidation_t z_query_consolidation_auto(void);
+/**
+ * Creates a default `z_query_consolidation_t` (consolidation mode AUTO).
  */
-#if defined(Z_FEATURE_UNSTABLE_API)
-ZENOHC_API
-struct z_id_t z_entity_global_id_zid(const struct z_entity_global_id_t *this_);
-#endif
+ZENOHC_API struct z_query_consolidation_t z_query_consolidation_default(void);
 /**
- * Constructs send and recieve ends of the fifo channel
+ * Latest consolidation.
+ *
+ * This strategy optimizes bandwidth on all links in the system but will provide a very poor latency.
  */
 ZENOHC_API
-void z_fifo_channel_query_new(struct z_owned_closure_query_t *callback,
-                              struct z_owned_fifo_handler_query_t *handler,
-                              size_t capacity);
+struct z_query_consolidation_t z_query_consolidation_latest(void);
 /**
- * Constructs send and recieve ends of the fifo channel
+ * Monotonic consolidation.
+ *
+ * This strategy offers the best latency. Replies are directly transmitted to the application when received
+ * without needing to wait for all replies. This mode does not guarantee that there will be no duplicates.
  */
 ZENOHC_API
-void z_fifo_channel_reply_new(struct z_owned_closure_reply_t *callback,
-                              struct z_owned_fifo_handler_reply_t *handler,
-                              size_t capacity);
+struct z_query_consolidation_t z_query_consolidation_monotonic(void);
 /**
- * Constructs send and recieve ends of the fifo channel
+ * No consolidation.
+ *
+ * This strategy is useful when querying timeseries data bases or when using quorums.
  */
-ZENOHC_API
-void z_fifo_channel_sample_new(struct z_owned_closure_sample_t *callback,
-                               struct z_owned_fifo_handler_sample_t *handler,
-                               size_t capacity);
+ZENOHC_API struct z_query_consolidation_t z_query_consolidation_none(void);
 /**
- * Drops the handler and resets it to a gravestone state.
+ * Destroys the query resetting it to its gravestone value.
  */
-ZENOHC_API void z_fifo_handler_query_drop(struct z_moved_fifo_handler_query_t *this_);
+ZENOHC_API void z_query_drop(struct z_moved_query_t *this_);
 /**
- * Borrows handler.
+ * Gets query <a href="https://github.com/eclipse-zenoh/roadmap/blob/main/rfcs/ALL/Query%20Payload.md">payload encoding</a>.
+ *
+ * Returns NULL if query does not contain an encoding.
  */
 ZENOHC_API
-const struct z_loaned_fifo_handler_query_t *z_fifo_handler_query_loan(const struct z_owned_fifo_handler_query_t *this_);
+const struct z_loaned_encoding_t *z_query_encoding(const struct z_loaned_query_t *this_);
 /**
- * Returns query from the fifo buffer. If there are no more pending queries will block until next query is received, or until
- * the channel is dropped (normally when Queryable is dropped).
- * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the query will be in the gravestone state),
- * `Z_CHANNEL_NODATA` if the channel is still alive, but its buffer is empty (the query will be in the gravestone state).
+ * Gets query key expression.
  */
-ZENOHC_API
-z_result_t z_fifo_handler_query_recv(const struct z_loaned_fifo_handler_query_t *this_,
-                                     struct z_owned_query_t *query);
+ZENOHC_API const struct z_loaned_keyexpr_t *z_query_keyexpr(const struct z_loaned_query_t *this_);
 /**
- * Returns query from the fifo buffer. If there are no more pending queries will return immediately (with query set to its gravestone state).
- * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the query will be in the gravestone state),
- * `Z_CHANNEL_NODATA` if the channel is still alive, but its buffer is empty (the query will be in the gravestone state).
+ * Borrows the query.
  */
-ZENOHC_API
-z_result_t z_fifo_handler_query_try_recv(const struct z_loaned_fifo_handler_query_t *this_,
-                                         struct z_owned_query_t *query);
+ZENOHC_API const struct z_loaned_query_t *z_query_loan(const struct z_owned_query_t *this_);
 /**
- * Drops the handler and resets it to a gravestone state.
+ * Mutably borrows the query.
  */
-ZENOHC_API void z_fifo_handler_reply_drop(struct z_moved_fifo_handler_reply_t *this_);
+ZENOHC_API struct z_loaned_query_t *z_query_loan_mut(struct z_owned_query_t *this_);
 /**
- * Borrows handler.
+ * Gets query <a href="https://github.com/eclipse-zenoh/roadmap/tree/main/rfcs/ALL/Selectors">value selector</a>.
  */
 ZENOHC_API
-const struct z_loaned_fifo_handler_reply_t *z_fifo_handler_reply_loan(const struct z_owned_fifo_handler_reply_t *this_);
+void z_query_parameters(const struct z_loaned_query_t *this_,
+                        struct z_view_string_t *parameters);
 /**
- * Returns reply from the fifo buffer. If there are no more pending replies will block until next reply is received, or until
- * the channel is dropped (normally when all replies are received).
- * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the reply will be in the gravestone state).
+ * Gets query <a href="https://github.com/eclipse-zenoh/roadmap/blob/main/rfcs/ALL/Query%20Payload.md">payload</a>.
+ *
+ * Returns NULL if query does not contain a payload.
  */
 ZENOHC_API
-z_result_t z_fifo_handler_reply_recv(const struct z_loaned_fifo_handler_reply_t *this_,
-                                     struct z_owned_reply_t *reply);
+const struct z_loaned_bytes_t *z_query_payload(const struct z_loaned_query_t *this_);
 /**
- * Returns reply from the fifo buffer. If there are no more pending replies will return immediately (with reply set to its gravestone state).
- * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the reply will be in the gravestone state),
- * `Z_CHANNEL_NODATA` if the channel is still alive, but its buffer is empty (the reply will be in the gravestone state).
+ * Gets mutable query <a href="https://github.com/eclipse-zenoh/roadmap/blob/main/rfcs/ALL/Query%20Payload.md">payload</a>.
+ *
+ * Returns NULL if query does not contain a payload.
  */
 ZENOHC_API
-z_result_t z_fifo_handler_reply_try_recv(const struct z_loaned_fifo_handler_reply_t *this_,
-                                         struct z_owned_reply_t *reply);
+struct z_loaned_bytes_t *z_query_payload_mut(struct z_loaned_query_t *this_);
 /**
- * Drops the handler and resets it to a gravestone state.
+ * Sends a reply to a query.
+ *
+ * This function must be called inside of a Queryable callback passing the
+ * query received as parameters of the callback function. This function can
+ * be called multiple times to send multiple replies to a query. The reply
+ * will be considered complete when the Queryable callback returns.
+ *
+ * @param this_: The query to reply to.
+ * @param key_expr: The key of this reply.
+ * @param payload: The payload of this reply. Will be consumed.
+ * @param options: The options of this reply. All owned fields will be consumed.
+ *
+ * @return 0 in case of success, negative error code otherwise.
  */
-ZENOHC_API void z_fifo_handler_sample_drop(struct z_moved_fifo_handler_sample_t *this_);
+ZENOHC_API
+z_result_t z_query_reply(const struct z_loaned_query_t *this_,
+                         const struct z_loaned_keyexpr_t *key_expr,
+                         struct z_moved_bytes_t *payload,
+                         struct z_query_reply_options_t *options);
 /**
- * Borrows handler.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Sends several replies to a query, transfering the ownership of all payloads.
+ *
+ * The replies are sent back to back in a single call, with the reply options applied to each of them.
+ * The payloads and all owned options fields are consumed upon function return, even if some of the replies fail.
+ * Like `z_query_reply()`, this function must be called inside of a Queryable callback, or before the query is dropped.
+ *
+ * @param this_: The query to reply to.
+ * @param key_exprs: A pointer to an array of `len` keys of the replies.
+ * @param payloads: A pointer to an array of `len` payloads of the replies. All of them will be consumed.
+ * @param len: The number of replies.
+ * @param options: The options applied to every reply. All owned fields will be consumed.
+ * @param results: An optional pointer to an array of `len` elements, that will receive the result of each individual reply.
+ *
+ * @return 0 if all replies were sent successfully, otherwise the error code of the first failed reply.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-const struct z_loaned_fifo_handler_sample_t *z_fifo_handler_sample_loan(const struct z_owned_fifo_handler_sample_t *this_);
+z_result_t z_query_reply_batch(const struct z_loaned_query_t *this_,
+                               const struct z_loaned_keyexpr_t *const *key_exprs,
+                               struct z_moved_bytes_t *payloads,
+                               size_t len,
+                               struct z_query_reply_options_t *options,
+                               z_result_t *results);
+#endif
 /**
- * Returns sample from the fifo buffer. If there are no more pending replies will block until next sample is received, or until
- * the channel is dropped (normally when there are no more samples to receive).
- * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the sample will be in the gravestone state).
+ * Sends a delete reply to a query.
+ *
+ * This function must be called inside of a Queryable callback passing the
+ * query received as parameters of the callback function. This function can
+ * be called multiple times to send multiple replies to a query. The reply
+ * will be considered complete when the Queryable callback returns.
+ *
+ * @param this_: The query to reply to.
+ * @param key_expr: The key of this delete reply.
+ * @param options: The options of this delete reply. All owned fields will be consumed.
+ *
+ * @return 0 in case of success, negative error code otherwise.
  */
 ZENOHC_API
-z_result_t z_fifo_handler_sample_recv(const struct z_loaned_fifo_handler_sample_t *this_,
-                                      struct z_owned_sample_t *sample);
+z_result_t z_query_reply_del(const struct z_loaned_query_t *this_,
+                             const struct z_loaned_keyexpr_t *key_expr,
+                             struct z_query_reply_del_options_t *options);
 /**
- * Returns sample from the fifo buffer.
- * If there are no more pending replies will return immediately (with sample set to its gravestone state).
- * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the sample will be in the gravestone state),
- * `Z_CHANNEL_NODATA` if the channel is still alive, but its buffer is empty (the sample will be in the gravestone state).
+ * Constructs the default value for `z_query_reply_del_options_t`.
  */
-ZENOHC_API
-z_result_t z_fifo_handler_sample_try_recv(const struct z_loaned_fifo_handler_sample_t *this_,
-                                          struct z_owned_sample_t *sample);
+ZENOHC_API void z_query_reply_del_options_default(struct z_query_reply_del_options_t *this_);
 /**
- * Query data from the matching queryables in the system.
- * Replies are provided through a callback function.
+ * Sends a error reply to a query.
  *
- * @param session: The zenoh session.
- * @param key_expr: The key expression matching resources to query.
- * @param parameters: The query's parameters, similar to a url's query segment.
- * @param callback: The callback function that will be called on reception of replies for this query. It will be automatically dropped once all replies are processed.
- * @param options: Additional options for the get. All owned fields will be consumed.
+ * This function must be called inside of a Queryable callback passing the
+ * query received as parameters of the callback function. This function can
+ * be called multiple times to send multiple replies to a query. The reply
+ * will be considered complete when the Queryable callback returns.
  *
- * @return 0 in case of success, a negative error value upon failure.
+ * @param this_: The query to reply to.
+ * @param payload: The payload carrying error message. Will be consumed.
+ * @param options: The options of this reply. All owned fields will be consumed.
+ *
+ * @return 0 in case of success, negative error code otherwise.
  */
 ZENOHC_API
-z_result_t z_get(const struct z_loaned_session_t *session,
-                 const struct z_loaned_keyexpr_t *key_expr,
-                 const char *parameters,
-                 struct z_moved_closure_reply_t *callback,
-                 struct z_get_options_t *options);
+z_result_t z_query_reply_err(const struct z_loaned_query_t *this_,
+                             struct z_moved_bytes_t *payload,
+                             struct z_query_reply_err_options_t *options);
 /**
- * Constructs default `z_get_options_t`
+ * Constructs the default value for `z_query_reply_err_options_t`.
  */
-ZENOHC_API void z_get_options_default(struct z_get_options_t *this_);
+ZENOHC_API void z_query_reply_err_options_default(struct z_query_reply_err_options_t *this_);
 /**
- * Constructs an owned copy of hello message.
+ * Constructs the default value for `z_query_reply_options_t`.
  */
-ZENOHC_API void z_hello_clone(struct z_owned_hello_t *dst, const struct z_loaned_hello_t *this_);
+ZENOHC_API void z_query_reply_options_default(struct z_query_reply_options_t *this_);
 /**
- * Frees memory and resets hello message to its gravestone state.
+ * Create a default `z_query_target_t`.
  */
-ZENOHC_API void z_hello_drop(struct z_moved_hello_t *this_);
+ZENOHC_API enum z_query_target_t z_query_target_default(void);
 /**
- * Borrows hello message.
+ * Undeclares queryable callback and resets it to its gravestone state.
+ * This is equivalent to calling `z_undeclare_queryable()` and discarding its return value.
  */
-ZENOHC_API const struct z_loaned_hello_t *z_hello_loan(const struct z_owned_hello_t *this_);
+ZENOHC_API void z_queryable_drop(struct z_moved_queryable_t *this_);
 /**
- * Constructs an array of non-owned locators (in the form non-null-terminated strings) of Zenoh entity that sent hello message.
- *
- * The lifetime of locator strings is bound to `this_`.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns the ID of the queryable.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_hello_locators(const struct z_loaned_hello_t *this_,
-                      struct z_owned_string_array_t *locators_out);
+struct z_entity_global_id_t z_queryable_id(const struct z_loaned_queryable_t *queryable);
+#endif
+ZENOHC_API
+const struct z_loaned_queryable_t *z_queryable_loan(const struct z_owned_queryable_t *this_);
 /**
- * Returns type of Zenoh entity that transmitted hello message.
+ * Constructs the default value for `z_query_reply_options_t`.
  */
-ZENOHC_API enum z_whatami_t z_hello_whatami(const struct z_loaned_hello_t *this_);
+ZENOHC_API void z_queryable_options_default(struct z_queryable_options_t *this_);
 /**
- * @brief Returns id of Zenoh entity that transmitted hello message.
+ * Fills buffer with random data.
  */
-ZENOHC_API struct z_id_t z_hello_zid(const struct z_loaned_hello_t *this_);
+ZENOHC_API void z_random_fill(void *buf, size_t len);
 /**
- * @brief Formats the `z_id_t` into 16-digit hex string (LSB-first order)
+ * Generates random `uint16_t`.
  */
-ZENOHC_API void z_id_to_string(const struct z_id_t *zid, struct z_owned_string_t *dst);
+ZENOHC_API uint16_t z_random_u16(void);
 /**
- * @brief Fetches the Zenoh IDs of all connected peers.
- *
- * `callback` will be called once for each ID, is guaranteed to never be called concurrently,
- * and is guaranteed to be dropped before this function exits.
- *
- * Retuns 0 on success, negative values on failure
+ * Generates random `uint32_t`.
+ */
+ZENOHC_API uint32_t z_random_u32(void);
+/**
+ * Generates random `uint64_t`.
+ */
+ZENOHC_API uint64_t z_random_u64(void);
+/**
+ * Generates random `uint8_t`.
+ */
+ZENOHC_API uint8_t z_random_u8(void);
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Reference the global client storage.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-z_result_t z_info_peers_zid(const struct z_loaned_session_t *session,
-                            struct z_moved_closure_zid_t *callback);
+void z_ref_shm_client_storage_global(struct z_owned_shm_client_storage_t *this_);
+#endif
 /**
- * @brief Fetches the Zenoh IDs of all connected routers.
- *
- * `callback` will be called once for each ID, is guaranteed to never be called concurrently,
- * and is guaranteed to be dropped before this function exits.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns the default value for `reliability`.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+enum z_reliability_t z_reliability_default(void);
+#endif
+/**
+ * Constructs an owned shallow copy of reply in provided uninitialized memory location.
+ */
+ZENOHC_API void z_reply_clone(struct z_owned_reply_t *dst, const struct z_loaned_reply_t *this_);
+/**
+ * Frees reply, resetting it to its gravestone state.
+ */
+ZENOHC_API void z_reply_drop(struct z_moved_reply_t *this_);
+/**
+ * Yields the contents of the reply by asserting it indicates a failure.
  *
- * Retuns 0 on success, negative values on failure.
+ * Returns `NULL` if reply does not contain a error  (i. e. if `z_reply_is_ok` returns ``true``).
+ */
+ZENOHC_API const struct z_loaned_reply_err_t *z_reply_err(const struct z_loaned_reply_t *this_);
+/**
+ * Constructs a copy of the reply error message.
  */
 ZENOHC_API
-z_result_t z_info_routers_zid(const struct z_loaned_session_t *session,
-                              struct z_moved_closure_zid_t *callback);
+void z_reply_err_clone(struct z_owned_reply_err_t *dst,
+                       const struct z_loaned_reply_err_t *this_);
 /**
- * @brief Returns the session's Zenoh ID.
- *
- * Unless the `session` is invalid, that ID is guaranteed to be non-zero.
- * In other words, this function returning an array of 16 zeros means you failed
- * to pass it a valid session.
+ * Frees the memory and resets the reply error it to its default value.
  */
-ZENOHC_API struct z_id_t z_info_zid(const struct z_loaned_session_t *session);
+ZENOHC_API void z_reply_err_drop(struct z_moved_reply_err_t *this_);
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Returns ``true`` if `this` is valid.
+ * Returns reply error encoding.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-bool z_internal_alloc_layout_check(const struct z_owned_alloc_layout_t *this_);
-#endif
+const struct z_loaned_encoding_t *z_reply_err_encoding(const struct z_loaned_reply_err_t *this_);
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Constructs Alloc Layout in its gravestone value.
+ * Borrows reply error.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-void z_internal_alloc_layout_null(struct z_owned_alloc_layout_t *this_);
-#endif
+const struct z_loaned_reply_err_t *z_reply_err_loan(const struct z_owned_reply_err_t *this_);
 /**
- * Returns ``true`` if `this_` is in a valid state, ``false`` if it is in a gravestone state.
+ * Mutably borrows reply error.
  */
-ZENOHC_API bool z_internal_bytes_check(const struct z_owned_bytes_t *this_);
+ZENOHC_API struct z_loaned_reply_err_t *z_reply_err_loan_mut(struct z_owned_reply_err_t *this_);
 /**
- * The gravestone value for `z_owned_bytes_t`.
+ * Yields the contents of the reply by asserting it indicates a failure.
+ *
+ * Returns `NULL` if reply does not contain a error  (i. e. if `z_reply_is_ok` returns ``true``).
  */
-ZENOHC_API void z_internal_bytes_null(struct z_owned_bytes_t *this_);
+ZENOHC_API struct z_loaned_reply_err_t *z_reply_err_mut(struct z_loaned_reply_t *this_);
 /**
- * Returns ``true`` if `this_` is in a valid state, ``false`` if it is in a gravestone state.
+ * Returns reply error payload.
  */
-ZENOHC_API bool z_internal_bytes_writer_check(const struct z_owned_bytes_writer_t *this_);
+ZENOHC_API
+const struct z_loaned_bytes_t *z_reply_err_payload(const struct z_loaned_reply_err_t *this_);
 /**
- * Constructs a writer in a gravestone state.
+ * Returns mutable reply error payload.
  */
-ZENOHC_API void z_internal_bytes_writer_null(struct z_owned_bytes_writer_t *this_);
+ZENOHC_API struct z_loaned_bytes_t *z_reply_err_payload_mut(struct z_loaned_reply_err_t *this_);
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @return ``true`` if `this` is valid.
+ * Returns ``true`` if reply contains a valid response, ``false`` otherwise (in this case it contains a errror value).
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-bool z_internal_chunk_alloc_result_check(const struct z_owned_chunk_alloc_result_t *this_);
-#endif
+bool z_reply_is_ok(const struct z_loaned_reply_t *this_);
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Constructs Chunk Alloc Result in its gravestone value.
+ * Borrows reply.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
-ZENOHC_API
-void z_internal_chunk_alloc_result_null(struct z_owned_chunk_alloc_result_t *this_);
-#endif
+ZENOHC_API const struct z_loaned_reply_t *z_reply_loan(const struct z_owned_reply_t *this_);
 /**
- * Returns ``true`` if closure is valid, ``false`` if it is in gravestone state.
+ * Mutably borrows reply.
  */
-ZENOHC_API bool z_internal_closure_hello_check(const struct z_owned_closure_hello_t *this_);
+ZENOHC_API struct z_loaned_reply_t *z_reply_loan_mut(struct z_owned_reply_t *this_);
 /**
- * Constructs a closure in a gravestone state.
+ * Yields the contents of the reply by asserting it indicates a success.
+ *
+ * Returns `NULL` if reply does not contain a sample (i. e. if `z_reply_is_ok` returns ``false``).
  */
-ZENOHC_API void z_internal_closure_hello_null(struct z_owned_closure_hello_t *this_);
+ZENOHC_API const struct z_loaned_sample_t *z_reply_ok(const struct z_loaned_reply_t *this_);
 /**
- * Returns ``true`` if closure is valid, ``false`` if it is in gravestone state.
+ * Yields the contents of the reply by asserting it indicates a success.
+ *
+ * Returns `NULL` if reply does not contain a sample (i. e. if `z_reply_is_ok` returns ``false``).
  */
-ZENOHC_API bool z_internal_closure_query_check(const struct z_owned_closure_query_t *this_);
+ZENOHC_API struct z_loaned_sample_t *z_reply_ok_mut(struct z_loaned_reply_t *this_);
 /**
- * Constructs a closure in its gravestone state.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Gets the id of the zenoh instance that answered this Reply.
+ * @return `true` if id is present.
  */
-ZENOHC_API void z_internal_closure_query_null(struct z_owned_closure_query_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+bool z_reply_replier_id(const struct z_loaned_reply_t *this_,
+                        struct z_id_t *out_id);
+#endif
 /**
- * Returns ``true`` if closure is valid, ``false`` if it is in gravestone state.
+ * Constructs send and recieve ends of the ring channel
  */
-ZENOHC_API bool z_internal_closure_reply_check(const struct z_owned_closure_reply_t *this_);
+ZENOHC_API
+void z_ring_channel_query_new(struct z_owned_closure_query_t *callback,
+                              struct z_owned_ring_handler_query_t *handler,
+                              size_t capacity);
 /**
- * Constructs a closure int its gravestone state.
+ * Constructs send and recieve ends of the ring channel
  */
-ZENOHC_API void z_internal_closure_reply_null(struct z_owned_closure_reply_t *this_);
+ZENOHC_API
+void z_ring_channel_reply_new(struct z_owned_closure_reply_t *callback,
+                              struct z_owned_ring_handler_reply_t *handler,
+                              size_t capacity);
 /**
- * Returns ``true`` if closure is valid, ``false`` if it is in gravestone state.
+ * Constructs send and recieve ends of the ring channel
  */
-ZENOHC_API bool z_internal_closure_sample_check(const struct z_owned_closure_sample_t *this_);
+ZENOHC_API
+void z_ring_channel_sample_new(struct z_owned_closure_sample_t *callback,
+                               struct z_owned_ring_handler_sample_t *handler,
+                               size_t capacity);
 /**
- * Constructs a closure in its gravestone state.
+ * Drops the handler and resets it to a gravestone state.
  */
-ZENOHC_API void z_internal_closure_sample_null(struct z_owned_closure_sample_t *this_);
+ZENOHC_API void z_ring_handler_query_drop(struct z_moved_ring_handler_query_t *this_);
 /**
- * @brief Returns ``true`` if closure is valid, ``false`` if it is in gravestone state.
+ * Borrows handler.
  */
-ZENOHC_API bool z_internal_closure_zid_check(const struct z_owned_closure_zid_t *this_);
+ZENOHC_API
+const struct z_loaned_ring_handler_query_t *z_ring_handler_query_loan(const struct z_owned_ring_handler_query_t *this_);
 /**
- * @brief Constructs a null closure.
+ * Returns query from the ring buffer. If there are no more pending queries will block until next query is received, or until
+ * the channel is dropped (normally when Queryable is dropped).
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the query will be in the gravestone state).
  */
-ZENOHC_API void z_internal_closure_zid_null(struct z_owned_closure_zid_t *this_);
+ZENOHC_API
+z_result_t z_ring_handler_query_recv(const struct z_loaned_ring_handler_query_t *this_,
+                                     struct z_owned_query_t *query);
 /**
- * Returns ``true`` if conditional variable is valid, ``false`` otherwise.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Receives up to `capacity` queries from the ring buffer at once. If there are no pending queries will block until next query is received,
+ * or until the channel is dropped (normally when Queryable is dropped). Once at least one query is received, all the queries that are already
+ * pending are returned without blocking.
+ *
+ * @param this_: The handler.
+ * @param queries: A pointer to an array of at least `capacity` uninitialized queries. Only the first `n` elements are initialized upon return.
+ * @param capacity: The maximum number of queries to receive.
+ * @param n: Will be set to the number of received queries.
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped, `Z_EINVAL` if `capacity` is 0.
  */
-ZENOHC_API bool z_internal_condvar_check(const struct z_owned_condvar_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_ring_handler_query_recv_many(const struct z_loaned_ring_handler_query_t *this_,
+                                          struct z_owned_query_t *queries,
+                                          size_t capacity,
+                                          size_t *n);
+#endif
 /**
- * Constructs conditional variable in a gravestone state.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns query from the ring buffer, busy-polling the channel according to `options` before blocking until next query is received,
+ * or until the channel is dropped (normally when Queryable is dropped).
+ *
+ * @param this_: The handler.
+ * @param query: An uninitialized memory location where the query will be constructed.
+ * @param options: The polling options, if `NULL` the default ones are used.
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the query will be in the gravestone state).
  */
-ZENOHC_API void z_internal_condvar_null(struct z_owned_condvar_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_ring_handler_query_recv_spin(const struct z_loaned_ring_handler_query_t *this_,
+                                          struct z_owned_query_t *query,
+                                          const struct zc_recv_spin_options_t *options);
+#endif
 /**
- * Returns ``true`` if config is valid, ``false`` if it is in a gravestone state.
+ * Returns query from the ring buffer. If there are no more pending queries will return immediately (with query set to its gravestone state).
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the query will be in the gravestone state),
+ * Z_CHANNEL_NODATA if the channel is still alive, but its buffer is empty (the query will be in the gravestone state).
  */
-ZENOHC_API bool z_internal_config_check(const struct z_owned_config_t *this_);
+ZENOHC_API
+z_result_t z_ring_handler_query_try_recv(const struct z_loaned_ring_handler_query_t *this_,
+                                         struct z_owned_query_t *query);
 /**
- * Constructs config in its gravestone state.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Receives up to `capacity` queries from the ring buffer at once. If there are no pending queries will return immediately.
+ *
+ * @param this_: The handler.
+ * @param queries: A pointer to an array of at least `capacity` uninitialized queries. Only the first `n` elements are initialized upon return.
+ * @param capacity: The maximum number of queries to receive.
+ * @param n: Will be set to the number of received queries.
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped,
+ * `Z_CHANNEL_NODATA` if the channel is still alive, but its buffer is empty, `Z_EINVAL` if `capacity` is 0.
  */
-ZENOHC_API void z_internal_config_null(struct z_owned_config_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_ring_handler_query_try_recv_many(const struct z_loaned_ring_handler_query_t *this_,
+                                              struct z_owned_query_t *queries,
+                                              size_t capacity,
+                                              size_t *n);
+#endif
 /**
- * Returns ``true`` if encoding is in non-default state, ``false`` otherwise.
+ * Drops the handler and resets it to a gravestone state.
  */
-ZENOHC_API bool z_internal_encoding_check(const struct z_owned_encoding_t *this_);
+ZENOHC_API void z_ring_handler_reply_drop(struct z_moved_ring_handler_reply_t *this_);
 /**
- * Constructs a default `z_owned_encoding_t`.
+ * Borrows handler.
  */
-ZENOHC_API void z_internal_encoding_null(struct z_owned_encoding_t *this_);
+ZENOHC_API
+const struct z_loaned_ring_handler_reply_t *z_ring_handler_reply_loan(const struct z_owned_ring_handler_reply_t *this_);
 /**
- * Returns ``true`` if handler is valid, ``false`` if it is in gravestone state.
+ * Returns reply from the ring buffer. If there are no more pending replies will block until next reply is received, or until
+ * the channel is dropped (normally when all replies are received).
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the reply will be in the gravestone state).
  */
 ZENOHC_API
-bool z_internal_fifo_handler_query_check(const struct z_owned_fifo_handler_query_t *this_);
+z_result_t z_ring_handler_reply_recv(const struct z_loaned_ring_handler_reply_t *this_,
+                                     struct z_owned_reply_t *reply);
 /**
- * Constructs a handler in gravestone state.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Receives up to `capacity` replies from the ring buffer at once. If there are no pending replies will block until next reply is received,
+ * or until the channel is dropped (normally when all replies are received). Once at least one reply is received, all the replies that are already
+ * pending are returned without blocking.
+ *
+ * @param this_: The handler.
+ * @param replies: A pointer to an array of at least `capacity` uninitialized replies. Only the first `n` elements are initialized upon return.
+ * @param capacity: The maximum number of replies to receive.
+ * @param n: Will be set to the number of received replies.
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped, `Z_EINVAL` if `capacity` is 0.
  */
-ZENOHC_API void z_internal_fifo_handler_query_null(struct z_owned_fifo_handler_query_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_ring_handler_reply_recv_many(const struct z_loaned_ring_handler_reply_t *this_,
+                                          struct z_owned_reply_t *replies,
+                                          size_t capacity,
+                                          size_t *n);
+#endif
 /**
- * Returns ``true`` if handler is valid, ``false`` if it is in gravestone state.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns reply from the ring buffer, busy-polling the channel according to `options` before blocking until next reply is received,
+ * or until the channel is dropped (normally when all replies are received).
+ *
+ * @param this_: The handler.
+ * @param reply: An uninitialized memory location where the reply will be constructed.
+ * @param options: The polling options, if `NULL` the default ones are used.
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the reply will be in the gravestone state).
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-bool z_internal_fifo_handler_reply_check(const struct z_owned_fifo_handler_reply_t *this_);
+z_result_t z_ring_handler_reply_recv_spin(const struct z_loaned_ring_handler_reply_t *this_,
+                                          struct z_owned_reply_t *reply,
+                                          const struct zc_recv_spin_options_t *options);
+#endif
 /**
- * Constructs a handler in gravestone state.
+ * Returns reply from the ring buffer. If there are no more pending replies will return immediately (with reply set to its gravestone state).
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the reply will be in the gravestone state),
+ * `Z_CHANNEL_NODATA` if the channel is still alive, but its buffer is empty (the reply will be in the gravestone state).
  */
-ZENOHC_API void z_internal_fifo_handler_reply_null(struct z_owned_fifo_handler_reply_t *this_);
+ZENOHC_API
+z_result_t z_ring_handler_reply_try_recv(const struct z_loaned_ring_handler_reply_t *this_,
+                                         struct z_owned_reply_t *reply);
 /**
- * Returns ``true`` if handler is valid, ``false`` if it is in gravestone state.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Receives up to `capacity` replies from the ring buffer at once. If there are no pending replies will return immediately.
+ *
+ * @param this_: The handler.
+ * @param replies: A pointer to an array of at least `capacity` uninitialized replies. Only the first `n` elements are initialized upon return.
+ * @param capacity: The maximum number of replies to receive.
+ * @param n: Will be set to the number of received replies.
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped,
+ * `Z_CHANNEL_NODATA` if the channel is still alive, but its buffer is empty, `Z_EINVAL` if `capacity` is 0.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-bool z_internal_fifo_handler_sample_check(const struct z_owned_fifo_handler_sample_t *this_);
+z_result_t z_ring_handler_reply_try_recv_many(const struct z_loaned_ring_handler_reply_t *this_,
+                                              struct z_owned_reply_t *replies,
+                                              size_t capacity,
+                                              size_t *n);
+#endif
 /**
- * Constructs a handler in gravestone state.
+ * Drops the handler and resets it to a gravestone state.
  */
-ZENOHC_API void z_internal_fifo_handler_sample_null(struct z_owned_fifo_handler_sample_t *this_);
+ZENOHC_API void z_ring_handler_sample_drop(struct z_moved_ring_handler_sample_t *this_);
 /**
- * Returns ``true`` if `hello message` is valid, ``false`` if it is in a gravestone state.
+ * Borrows handler.
  */
-ZENOHC_API bool z_internal_hello_check(const struct z_owned_hello_t *this_);
+ZENOHC_API
+const struct z_loaned_ring_handler_sample_t *z_ring_handler_sample_loan(const struct z_owned_ring_handler_sample_t *this_);
 /**
- * Constructs hello message in a gravestone state.
+ * Returns sample from the ring buffer. If there are no more pending replies will block until next sample is received, or until
+ * the channel is dropped (normally when there are no more replies to receive).
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the sample will be in the gravestone state).
  */
-ZENOHC_API void z_internal_hello_null(struct z_owned_hello_t *this_);
+ZENOHC_API
+z_result_t z_ring_handler_sample_recv(const struct z_loaned_ring_handler_sample_t *this_,
+                                      struct z_owned_sample_t *sample);
 /**
- * Returns ``true`` if `keyexpr` is valid, ``false`` if it is in gravestone state.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Receives up to `capacity` samples from the ring buffer at once. If there are no pending samples will block until next sample is received,
+ * or until the channel is dropped (normally when there are no more samples to receive). Once at least one sample is received, all the samples that are already
+ * pending are returned without blocking.
+ *
+ * @param this_: The handler.
+ * @param samples: A pointer to an array of at least `capacity` uninitialized samples. Only the first `n` elements are initialized upon return.
+ * @param capacity: The maximum number of samples to receive.
+ * @param n: Will be set to the number of received samples.
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped, `Z_EINVAL` if `capacity` is 0.
  */
-ZENOHC_API bool z_internal_keyexpr_check(const struct z_owned_keyexpr_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_ring_handler_sample_recv_many(const struct z_loaned_ring_handler_sample_t *this_,
+                                           struct z_owned_sample_t *samples,
+                                           size_t capacity,
+                                           size_t *n);
+#endif
 /**
- * Constructs an owned key expression in a gravestone state.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns sample from the ring buffer, busy-polling the channel according to `options` before blocking until next sample is received,
+ * or until the channel is dropped (normally when there are no more samples to receive).
+ *
+ * @param this_: The handler.
+ * @param sample: An uninitialized memory location where the sample will be constructed.
+ * @param options: The polling options, if `NULL` the default ones are used.
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the sample will be in the gravestone state).
  */
-ZENOHC_API void z_internal_keyexpr_null(struct z_owned_keyexpr_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_ring_handler_sample_recv_spin(const struct z_loaned_ring_handler_sample_t *this_,
+                                           struct z_owned_sample_t *sample,
+                                           const struct zc_recv_spin_options_t *options);
+#endif
 /**
- * @brief Returns ``true`` if liveliness token is valid, ``false`` otherwise.
+ * Returns sample from the ring buffer. If there are no more pending replies will return immediately (with sample set to its gravestone state).
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the sample will be in the gravestone state),
+ * `Z_CHANNEL_NODATA` if the channel is still alive, but its buffer is empty (the sample will be in the gravestone state).
  */
-ZENOHC_API bool z_internal_liveliness_token_check(const struct z_owned_liveliness_token_t *this_);
+ZENOHC_API
+z_result_t z_ring_handler_sample_try_recv(const struct z_loaned_ring_handler_sample_t *this_,
+                                          struct z_owned_sample_t *sample);
 /**
- * @brief Constructs liveliness token in its gravestone state.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Receives up to `capacity` samples from the ring buffer at once. If there are no pending samples will return immediately.
+ *
+ * @param this_: The handler.
+ * @param samples: A pointer to an array of at least `capacity` uninitialized samples. Only the first `n` elements are initialized upon return.
+ * @param capacity: The maximum number of samples to receive.
+ * @param n: Will be set to the number of received samples.
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped,
+ * `Z_CHANNEL_NODATA` if the channel is still alive, but its buffer is empty, `Z_EINVAL` if `capacity` is 0.
  */
-ZENOHC_API void z_internal_liveliness_token_null(struct z_owned_liveliness_token_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_ring_handler_sample_try_recv_many(const struct z_loaned_ring_handler_sample_t *this_,
+                                               struct z_owned_sample_t *samples,
+                                               size_t capacity,
+                                               size_t *n);
+#endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Returns ``true`` if `this` is valid.
+ * @brief Drops reader-writer lock and resets it to its gravestone state. The lock must not be held.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-bool z_internal_memory_layout_check(const struct z_owned_memory_layout_t *this_);
+void z_rwlock_drop(struct z_moved_rwlock_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Constructs Memory Layout in its gravestone value.
+ * @brief Constructs a reader-writer lock.
+ *
+ * Unlike `z_owned_mutex_t`, the lock holds no guard: locking and unlocking only update an atomic state word when the
+ * lock is not contended. Contended threads spin for a short while and are then parked in the kernel, e.g. on a futex
+ * on Linux, until the lock is released. Writers waiting for the lock block new readers, so that they do not starve.
+ * @return 0 in case of success, negative error code otherwise.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_internal_memory_layout_null(struct z_owned_memory_layout_t *this_);
+z_result_t z_rwlock_init(struct z_owned_rwlock_t *this_);
 #endif
 /**
- * Returns ``true`` if mutex is valid, ``false`` otherwise.
- */
-ZENOHC_API bool z_internal_mutex_check(const struct z_owned_mutex_t *this_);
-/**
- * Constructs mutex in a gravestone state.
- */
-ZENOHC_API void z_internal_mutex_null(struct z_owned_mutex_t *this_);
-/**
- * Returns ``true`` if publisher is valid, ``false`` otherwise.
- */
-ZENOHC_API bool z_internal_publisher_check(const struct z_owned_publisher_t *this_);
-/**
- * Constructs a publisher in a gravestone state.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Borrows reader-writer lock, so that it can be shared by the threads using it.
  */
-ZENOHC_API void z_internal_publisher_null(struct z_owned_publisher_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+const struct z_loaned_rwlock_t *z_rwlock_loan(const struct z_owned_rwlock_t *this_);
+#endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Returns ``true`` if querier is valid, ``false`` otherwise.
+ * @brief Locks reader-writer lock for reading. If it is locked for writing, blocks the thread until it aquires the lock.
+ * @return 0 in case of success, negative error code in case of failure.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-bool z_internal_querier_check(const struct z_owned_querier_t *this_);
+z_result_t z_rwlock_read_lock(const struct z_loaned_rwlock_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Constructs a querier in a gravestone state.
+ * @brief Releases a read lock previously aquired by the current thread. Otherwise the behaviour is undefined.
+ * @return 0 in case of success, `Z_EINVAL_MUTEX` if the lock is not locked for reading.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_internal_querier_null(struct z_owned_querier_t *this_);
+z_result_t z_rwlock_read_unlock(const struct z_loaned_rwlock_t *this_);
 #endif
 /**
- * Returns `false` if `this` is in a gravestone state, `true` otherwise.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Tries to lock reader-writer lock for reading. If it is locked for writing, return immediately.
+ * @return 0 in case of success, `Z_EBUSY_MUTEX` if failed to aquire the lock.
  */
-ZENOHC_API bool z_internal_query_check(const struct z_owned_query_t *query);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_rwlock_try_read_lock(const struct z_loaned_rwlock_t *this_);
+#endif
 /**
- * Constructs query in its gravestone value.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Tries to lock reader-writer lock for writing. If it is locked, return immediately.
+ * @return 0 in case of success, `Z_EBUSY_MUTEX` if failed to aquire the lock.
  */
-ZENOHC_API void z_internal_query_null(struct z_owned_query_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_rwlock_try_write_lock(const struct z_loaned_rwlock_t *this_);
+#endif
 /**
- * Returns ``true`` if queryable is valid, ``false`` otherwise.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Locks reader-writer lock for writing. If it is locked, blocks the thread until it aquires the lock.
+ * @return 0 in case of success, negative error code in case of failure.
  */
-ZENOHC_API bool z_internal_queryable_check(const struct z_owned_queryable_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_rwlock_write_lock(const struct z_loaned_rwlock_t *this_);
+#endif
 /**
- * Constructs a queryable in its gravestone value.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Releases the write lock previously aquired by the current thread. Otherwise the behaviour is undefined.
+ * @return 0 in case of success, `Z_EINVAL_MUTEX` if the lock is not locked for writing.
  */
-ZENOHC_API void z_internal_queryable_null(struct z_owned_queryable_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t z_rwlock_write_unlock(const struct z_loaned_rwlock_t *this_);
+#endif
 /**
- * Returns ``true`` if `reply` is valid, ``false`` otherwise.
+ * Returns sample attachment.
+ *
+ * Returns `NULL`, if sample does not contain any attachment.
  */
-ZENOHC_API bool z_internal_reply_check(const struct z_owned_reply_t *this_);
+ZENOHC_API
+const struct z_loaned_bytes_t *z_sample_attachment(const struct z_loaned_sample_t *this_);
 /**
- * Returns ``true`` if reply error is in non-default state, ``false`` otherwise.
+ * Constructs an owned shallow copy of the sample (i.e. all modficiations applied to the copy, might be visible in the original) in provided uninitilized memory location.
  */
-ZENOHC_API bool z_internal_reply_err_check(const struct z_owned_reply_err_t *this_);
+ZENOHC_API
+void z_sample_clone(struct z_owned_sample_t *dst,
+                    const struct z_loaned_sample_t *this_);
 /**
- * Constructs an empty `z_owned_reply_err_t`.
+ * Returns sample qos congestion control value.
  */
-ZENOHC_API void z_internal_reply_err_null(struct z_owned_reply_err_t *this_);
+ZENOHC_API
+enum z_congestion_control_t z_sample_congestion_control(const struct z_loaned_sample_t *this_);
 /**
- * Constructs the reply in its gravestone state.
+ * Frees the memory and invalidates the sample, resetting it to a gravestone state.
  */
-ZENOHC_API void z_internal_reply_null(struct z_owned_reply_t *this_);
+ZENOHC_API void z_sample_drop(struct z_moved_sample_t *this_);
 /**
- * Returns ``true`` if handler is valid, ``false`` if it is in gravestone state.
+ * Returns the encoding associated with the sample data.
  */
 ZENOHC_API
-bool z_internal_ring_handler_query_check(const struct z_owned_ring_handler_query_t *this_);
-/**
- * Constructs a handler in gravestone state.
- */
-ZENOHC_API void z_internal_ring_handler_query_null(struct z_owned_ring_handler_query_t *this_);
+const struct z_loaned_encoding_t *z_sample_encoding(const struct z_loaned_sample_t *this_);
 /**
- * Returns ``true`` if handler is valid, ``false`` if it is in gravestone state.
+ * Returns whether sample qos express flag was set or not.
  */
-ZENOHC_API
-bool z_internal_ring_handler_reply_check(const struct z_owned_ring_handler_reply_t *this_);
+ZENOHC_API bool z_sample_express(const struct z_loaned_sample_t *this_);
 /**
- * Constructs a handler in gravestone state.
+ * Returns the key expression of the sample.
  */
-ZENOHC_API void z_internal_ring_handler_reply_null(struct z_owned_ring_handler_reply_t *this_);
+ZENOHC_API const struct z_loaned_keyexpr_t *z_sample_keyexpr(const struct z_loaned_sample_t *this_);
 /**
- * Returns ``true`` if handler is valid, ``false`` if it is in gravestone state.
+ * Returns the sample kind.
  */
-ZENOHC_API
-bool z_internal_ring_handler_sample_check(const struct z_owned_ring_handler_sample_t *this_);
+ZENOHC_API enum z_sample_kind_t z_sample_kind(const struct z_loaned_sample_t *this_);
 /**
- * Constructs a handler in gravestone state.
+ * Borrows sample.
  */
-ZENOHC_API void z_internal_ring_handler_sample_null(struct z_owned_ring_handler_sample_t *this_);
+ZENOHC_API const struct z_loaned_sample_t *z_sample_loan(const struct z_owned_sample_t *this_);
 /**
- * Returns ``true`` if sample is valid, ``false`` if it is in gravestone state.
+ * Mutably borrows sample.
  */
-ZENOHC_API bool z_internal_sample_check(const struct z_owned_sample_t *this_);
+ZENOHC_API struct z_loaned_sample_t *z_sample_loan_mut(struct z_owned_sample_t *this_);
 /**
- * Constructs sample in its gravestone state.
+ * Returns the sample payload data.
  */
-ZENOHC_API void z_internal_sample_null(struct z_owned_sample_t *this_);
+ZENOHC_API const struct z_loaned_bytes_t *z_sample_payload(const struct z_loaned_sample_t *this_);
 /**
- * Returns ``true`` if `session` is valid, ``false`` otherwise.
+ * Returns the mutable sample payload data.
  */
-ZENOHC_API bool z_internal_session_check(const struct z_owned_session_t *this_);
+ZENOHC_API struct z_loaned_bytes_t *z_sample_payload_mut(struct z_loaned_sample_t *this_);
 /**
- * Constructs a Zenoh session in its gravestone state.
+ * Returns sample qos priority value.
  */
-ZENOHC_API void z_internal_session_null(struct z_owned_session_t *this_);
+ZENOHC_API enum z_priority_t z_sample_priority(const struct z_loaned_sample_t *this_);
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @return ``true`` if `this` is valid.
+ * @brief Returns the reliability setting the sample was delivered with.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-bool z_internal_shm_check(const struct z_owned_shm_t *this_);
+enum z_reliability_t z_sample_reliability(const struct z_loaned_sample_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @return Returns ``true`` if `this` is valid.
+ * @brief Returns the sample source_info.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-bool z_internal_shm_client_check(const struct z_owned_shm_client_t *this_);
+const struct z_loaned_source_info_t *z_sample_source_info(const struct z_loaned_sample_t *this_);
 #endif
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Constructs SHM client in its gravestone value.
+ * Returns the sample timestamp.
+ *
+ * Will return `NULL`, if sample is not associated with a timestamp.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
-ZENOHC_API
-void z_internal_shm_client_null(struct z_owned_shm_client_t *this_);
-#endif
+ZENOHC_API const struct z_timestamp_t *z_sample_timestamp(const struct z_loaned_sample_t *this_);
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @return ``true`` if `this` is valid.
+ * Scout for routers and/or peers.
+ *
+ * Scouting lasts for `options.timeout_ms`, unless it stops earlier after `options.max_hellos` hello messages or
+ * `options.grace_ms` after the first one.
+ *
+ * @param config: A set of properties to configure scouting session.
+ * @param callback: A closure that will be called on each hello message received from discoverd Zenoh entities.
+ * @param options: A set of scouting options
+ *
+ * @return 0 if successful, negative error values upon failure.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-bool z_internal_shm_client_storage_check(const struct z_owned_shm_client_storage_t *this_);
-#endif
+z_result_t z_scout(struct z_moved_config_t *config,
+                   struct z_moved_closure_hello_t *callback,
+                   const struct z_scout_options_t *options);
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * Constructs SHM Client Storage in its gravestone value.
+ * Constructs the default values for the scouting operation.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
-ZENOHC_API
-void z_internal_shm_client_storage_null(struct z_owned_shm_client_storage_t *this_);
-#endif
+ZENOHC_API void z_scout_options_default(struct z_scout_options_t *this_);
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @return ``true`` if `this` is valid.
+ * @brief Drops semaphore and resets it to its gravestone state. No thread must be waiting on it.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-bool z_internal_shm_mut_check(const struct z_owned_shm_mut_t *this_);
+void z_semaphore_drop(struct z_moved_semaphore_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Constructs ZShmMut slice in its gravestone value.
+ * @brief Constructs a counting semaphore.
+ *
+ * Waiting on the semaphore takes one of its permits, and posting to it gives one back. While permits are available,
+ * both are a single atomic operation; the internal mutex is only locked when a thread has to wait for a permit.
+ *
+ * @param this_: An uninitialized memory location where the semaphore will be constructed.
+ * @param permits: The initial number of permits.
+ * @return 0 in case of success, negative error code otherwise.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_internal_shm_mut_null(struct z_owned_shm_mut_t *this_);
+z_result_t z_semaphore_init(struct z_owned_semaphore_t *this_,
+                            size_t permits);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Constructs ZShm slice in its gravestone value.
+ * @brief Borrows semaphore, so that it can be shared by the threads using it.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_internal_shm_null(struct z_owned_shm_t *this_);
+const struct z_loaned_semaphore_t *z_semaphore_loan(const struct z_owned_semaphore_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Returns ``true`` if `this` is valid.
+ * @brief Gives a permit back to the semaphore, waking up a thread waiting for one.
+ * @return 0 in case of success, negative error code otherwise.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-bool z_internal_shm_provider_check(const struct z_owned_shm_provider_t *this_);
+z_result_t z_semaphore_post(const struct z_loaned_semaphore_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Constructs SHM Provider in its gravestone value.
+ * @brief Tries to take a permit of the semaphore. If none is available, return immediately.
+ * @return 0 in case of success, `Z_EBUSY_MUTEX` if no permit is available.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_internal_shm_provider_null(struct z_owned_shm_provider_t *this_);
+z_result_t z_semaphore_try_wait(const struct z_loaned_semaphore_t *this_);
 #endif
-/**
- * @return ``true`` if slice is not empty, ``false`` otherwise.
- */
-ZENOHC_API bool z_internal_slice_check(const struct z_owned_slice_t *this_);
-/**
- * Constructs an empty `z_owned_slice_t`.
- */
-ZENOHC_API void z_internal_slice_null(struct z_owned_slice_t *this_);
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Returns ``true`` if source info is valid, ``false`` if it is in gravestone state.
+ * @brief Takes a permit of the semaphore, blocking the thread until one is available.
+ * @return 0 in case of success, negative error code otherwise.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-bool z_internal_source_info_check(const struct z_owned_source_info_t *this_);
+z_result_t z_semaphore_wait(const struct z_loaned_semaphore_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Constructs source info in its gravestone state.
+ * @brief Takes a permit of the semaphore, blocking the thread until one is available or until `deadline`.
+ * @return 0 in case of success, `Z_ETIMEDOUT` if no permit was available before `deadline`.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_internal_source_info_null(struct z_owned_source_info_t *this_);
+z_result_t z_semaphore_wait_until(const struct z_loaned_semaphore_t *this_,
+                                  const struct z_clock_t *deadline);
 #endif
 /**
- * @return ``true`` if the string array is valid, ``false`` if it is in a gravestone state.
- */
-ZENOHC_API bool z_internal_string_array_check(const struct z_owned_string_array_t *this_);
-/**
- * Constructs string array in its gravestone state.
- */
-ZENOHC_API void z_internal_string_array_null(struct z_owned_string_array_t *this_);
-/**
- * @return ``true`` if `this_` is a valid string, ``false`` if it is in gravestone state.
- */
-ZENOHC_API bool z_internal_string_check(const struct z_owned_string_t *this_);
-/**
- * Constructs owned string in a gravestone state.
- */
-ZENOHC_API void z_internal_string_null(struct z_owned_string_t *this_);
-/**
- * Returns ``true`` if subscriber is valid, ``false`` otherwise.
- */
-ZENOHC_API bool z_internal_subscriber_check(const struct z_owned_subscriber_t *this_);
-/**
- * Constructs a subscriber in a gravestone state.
- */
-ZENOHC_API void z_internal_subscriber_null(struct z_owned_subscriber_t *this_);
-/**
- * Returns ``true`` if task is valid, ``false`` otherwise.
- */
-ZENOHC_API bool z_internal_task_check(const struct z_owned_task_t *this_);
-/**
- * Constructs task in a gravestone state.
- */
-ZENOHC_API void z_internal_task_null(struct z_owned_task_t *this_);
-/**
- * Constructs a non-owned non-null-terminated string from key expression.
- */
-ZENOHC_API
-void z_keyexpr_as_view_string(const struct z_loaned_keyexpr_t *this_,
-                              struct z_view_string_t *out_string);
-/**
- * Canonizes the passed string in place, possibly shortening it by modifying `len`.
- *
- * May SEGFAULT if `start` is NULL or lies in read-only memory (as values initialized with string litterals do).
- *
- * @return 0 upon success, negative error values upon failure (if the passed string was an invalid
- * key expression for reasons other than a non-canon form).
+ * Closes and invalidates the session.
  */
-ZENOHC_API
-z_result_t z_keyexpr_canonize(char *start,
-                              size_t *len);
+ZENOHC_API void z_session_drop(struct z_moved_session_t *this_);
 /**
- * Canonizes the passed string in place, possibly shortening it by placing a new null-terminator.
- * May SEGFAULT if `start` is NULL or lies in read-only memory (as values initialized with string litterals do).
+ * Checks if zenoh session is closed.
  *
- * @return 0 upon success, negative error values upon failure (if the passed string was an invalid
- * key expression for reasons other than a non-canon form).
+ * @return `true` if session is closed, `false` otherwise.
  */
-ZENOHC_API
-z_result_t z_keyexpr_canonize_null_terminated(char *start);
+ZENOHC_API bool z_session_is_closed(const struct z_loaned_session_t *session);
 /**
- * Constructs a copy of the key expression.
+ * Borrows session.
  */
-ZENOHC_API
-void z_keyexpr_clone(struct z_owned_keyexpr_t *dst,
-                     const struct z_loaned_keyexpr_t *this_);
+ZENOHC_API const struct z_loaned_session_t *z_session_loan(const struct z_owned_session_t *this_);
+ZENOHC_API struct z_loaned_session_t *z_session_loan_mut(struct z_owned_session_t *this_);
 /**
- * Constructs key expression by concatenation of key expression in `left` with a string in `right`.
- * Returns 0 in case of success, negative error code otherwise.
- *
- * You should probably prefer `z_keyexpr_join` as Zenoh may then take advantage of the hierachical separation it inserts.
- * To avoid odd behaviors, concatenating a key expression starting with `*` to one ending with `*` is forbidden by this operation,
- * as this would extremely likely cause bugs.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Deletes SHM Client.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-z_result_t z_keyexpr_concat(struct z_owned_keyexpr_t *this_,
-                            const struct z_loaned_keyexpr_t *left,
-                            const char *right_start,
-                            size_t right_len);
+void z_shm_client_drop(struct z_moved_shm_client_t *this_);
+#endif
 /**
- * Frees key expression and resets it to its gravestone state.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Creates a new SHM Client.
  */
-ZENOHC_API void z_keyexpr_drop(struct z_moved_keyexpr_t *this_);
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+void z_shm_client_new(struct z_owned_shm_client_t *this_,
+                      struct zc_threadsafe_context_t context,
+                      struct zc_shm_client_callbacks_t callbacks);
+#endif
 /**
- * Returns ``true`` if both ``left`` and ``right`` are equal, ``false`` otherwise.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Performs a shallow copy of SHM Client Storage.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-bool z_keyexpr_equals(const struct z_loaned_keyexpr_t *left,
-                      const struct z_loaned_keyexpr_t *right);
+void z_shm_client_storage_clone(struct z_owned_shm_client_storage_t *this_,
+                                const struct z_loaned_shm_client_storage_t *from);
+#endif
 /**
- * Constructs a `z_owned_keyexpr_t` from a string, copying the passed string.
- * @return 0 in case of success, negative error code in case of failure (for example if `expr` is not a valid key expression or if it is
- * not in canon form.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Derefs SHM Client Storage.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-z_result_t z_keyexpr_from_str(struct z_owned_keyexpr_t *this_,
-                              const char *expr);
+void z_shm_client_storage_drop(struct z_moved_shm_client_storage_t *this_);
+#endif
 /**
- * Constructs `z_owned_keyexpr_t` from a string, copying the passed string. The copied string is canonized.
- * @return 0 in case of success, negative error code in case of failure (for example if expr is not a valid key expression
- * even despite canonization).
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Borrows SHM Client Storage.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-z_result_t z_keyexpr_from_str_autocanonize(struct z_owned_keyexpr_t *this_,
-                                           const char *expr);
+const struct z_loaned_shm_client_storage_t *z_shm_client_storage_loan(const struct z_owned_shm_client_storage_t *this_);
+#endif
 /**
- * Constructs a `z_owned_keyexpr_t` by copying a substring.
- *
- * @param this_: An uninitialized location in memory where key expression will be constructed.
- * @param expr: A buffer with length >= `len`.
- * @param len: Number of characters from `expr` to consider.
- * @return 0 in case of success, negative error code otherwise.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Create a new client storage object.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-z_result_t z_keyexpr_from_substr(struct z_owned_keyexpr_t *this_,
-                                 const char *expr,
-                                 size_t len);
+z_result_t z_shm_client_storage_new(struct z_owned_shm_client_storage_t *this_,
+                                    const struct zc_loaned_shm_client_list_t *clients,
+                                    bool add_default_client_set);
+#endif
 /**
- * Constructs a `z_keyexpr_t` by copying a substring.
- *
- * @param this_: An uninitialized location in memory where key expression will be constructed.
- * @param start: A buffer of with length >= `len`.
- * @param len: Number of characters from `expr` to consider. Will be modified to be equal to canonized key expression length.
- * @return 0 in case of success, negative error code otherwise.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Construct client storage with default client set.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-z_result_t z_keyexpr_from_substr_autocanonize(struct z_owned_keyexpr_t *this_,
-                                              const char *start,
-                                              size_t *len);
+void z_shm_client_storage_new_default(struct z_owned_shm_client_storage_t *this_);
+#endif
 /**
- * Returns ``true`` if ``left`` includes ``right``, i.e. the set defined by ``left`` contains every key belonging to the set
- * defined by ``right``, ``false`` otherwise.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Converts borrowed ZShm slice to owned ZShm slice by performing a shallow SHM reference copy.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-bool z_keyexpr_includes(const struct z_loaned_keyexpr_t *left,
-                        const struct z_loaned_keyexpr_t *right);
+void z_shm_clone(struct z_owned_shm_t *out,
+                 const struct z_loaned_shm_t *this_);
+#endif
 /**
- * Returns ``true`` if the keyexprs intersect, i.e. there exists at least one key which is contained in both of the
- * sets defined by ``left`` and ``right``, ``false`` otherwise.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @return the pointer of the ZShm slice.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-bool z_keyexpr_intersects(const struct z_loaned_keyexpr_t *left,
-                          const struct z_loaned_keyexpr_t *right);
+const unsigned char *z_shm_data(const struct z_loaned_shm_t *this_);
+#endif
 /**
- * Returns 0 if the passed string is a valid (and canon) key expression.
- * Otherwise returns negative error value.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Deletes ZShm slice.
  */
-ZENOHC_API z_result_t z_keyexpr_is_canon(const char *start, size_t len);
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+void z_shm_drop(struct z_moved_shm_t *this_);
+#endif
 /**
- * Constructs key expression by performing path-joining (automatically inserting) of `left` with `right`.
- * @return 0 in case of success, negative error code otherwise.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs ZShm slice from ZShmMut slice.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-z_result_t z_keyexpr_join(struct z_owned_keyexpr_t *this_,
-                          const struct z_loaned_keyexpr_t *left,
-                          const struct z_loaned_keyexpr_t *right);
+void z_shm_from_mut(struct z_owned_shm_t *this_,
+                    struct z_moved_shm_mut_t *that);
+#endif
 /**
- * Borrows `z_owned_keyexpr_t`.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @return the length of the ZShm slice.
  */
-ZENOHC_API const struct z_loaned_keyexpr_t *z_keyexpr_loan(const struct z_owned_keyexpr_t *this_);
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+size_t z_shm_len(const struct z_loaned_shm_t *this_);
+#endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Returns the relation between `left` and `right` from `left`'s point of view.
- *
- * @note This is slower than `z_keyexpr_intersects` and `keyexpr_includes`, so you should favor these methods for most applications.
+ * @brief Borrows ZShm slice.
  */
-#if defined(Z_FEATURE_UNSTABLE_API)
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-enum z_keyexpr_intersection_level_t z_keyexpr_relation_to(const struct z_loaned_keyexpr_t *left,
-                                                          const struct z_loaned_keyexpr_t *right);
+const struct z_loaned_shm_t *z_shm_loan(const struct z_owned_shm_t *this_);
 #endif
 /**
- * @brief Declares a subscriber on liveliness tokens that intersect `key_expr`.
- *
- * @param session: A Zenoh session.
- * @param subscriber: An uninitialized memory location where subscriber will be constructed.
- * @param key_expr: The key expression to subscribe to.
- * @param callback: The callback function that will be called each time a liveliness token status is changed.
- * @param options: The options to be passed to the liveliness subscriber declaration.
- *
- * @return 0 in case of success, negative error values otherwise.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Mutably borrows ZShm slice.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-z_result_t z_liveliness_declare_subscriber(const struct z_loaned_session_t *session,
-                                           struct z_owned_subscriber_t *subscriber,
-                                           const struct z_loaned_keyexpr_t *key_expr,
-                                           struct z_moved_closure_sample_t *callback,
-                                           struct z_liveliness_subscriber_options_t *options);
+struct z_loaned_shm_t *z_shm_loan_mut(struct z_owned_shm_t *this_);
+#endif
 /**
- * @brief Constructs and declares a liveliness token on the network.
- *
- * Liveliness token subscribers on an intersecting key expression will receive a PUT sample when connectivity
- * is achieved, and a DELETE sample if it's lost.
- *
- * @param session: A Zenos session to declare the liveliness token.
- * @param token: An uninitialized memory location where liveliness token will be constructed.
- * @param key_expr: A keyexpr to declare a liveliess token for.
- * @param _options: Liveliness token declaration properties.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @return the immutable pointer to the underlying data.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-z_result_t z_liveliness_declare_token(const struct z_loaned_session_t *session,
-                                      struct z_owned_liveliness_token_t *token,
-                                      const struct z_loaned_keyexpr_t *key_expr,
-                                      const struct z_liveliness_token_options_t *_options);
+const unsigned char *z_shm_mut_data(const struct z_loaned_shm_mut_t *this_);
+#endif
 /**
- * @brief Queries liveliness tokens currently on the network with a key expression intersecting with `key_expr`.
- *
- * @param session: The Zenoh session.
- * @param key_expr: The key expression to query liveliness tokens for.
- * @param callback: The callback function that will be called for each received reply.
- * @param options: Additional options for the liveliness get operation.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @return the mutable pointer to the underlying data.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-z_result_t z_liveliness_get(const struct z_loaned_session_t *session,
-                            const struct z_loaned_keyexpr_t *key_expr,
-                            struct z_moved_closure_reply_t *callback,
-                            struct z_liveliness_get_options_t *options);
+unsigned char *z_shm_mut_data_mut(struct z_loaned_shm_mut_t *this_);
+#endif
 /**
- * @brief Constructs default value `z_liveliness_get_options_t`.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Deletes ZShmMut slice.
  */
-ZENOHC_API void z_liveliness_get_options_default(struct z_liveliness_get_options_t *this_);
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+void z_shm_mut_drop(struct z_moved_shm_mut_t *this_);
+#endif
 /**
- * @brief Constucts default value for `z_liveliness_declare_subscriber_options_t`.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @return the length of the ZShmMut slice.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-void z_liveliness_subscriber_options_default(struct z_liveliness_subscriber_options_t *this_);
+size_t z_shm_mut_len(const struct z_loaned_shm_mut_t *this_);
+#endif
 /**
- * @brief Undeclares liveliness token, frees memory and resets it to a gravestone state.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Borrows ZShmMut slice.
  */
-ZENOHC_API void z_liveliness_token_drop(struct z_moved_liveliness_token_t *this_);
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+const struct z_loaned_shm_mut_t *z_shm_mut_loan(const struct z_owned_shm_mut_t *this_);
+#endif
 /**
- * @brief Borrows token.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Mutably borrows ZShmMut slice.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-const struct z_loaned_liveliness_token_t *z_liveliness_token_loan(const struct z_owned_liveliness_token_t *this_);
+struct z_loaned_shm_mut_t *z_shm_mut_loan_mut(struct z_owned_shm_mut_t *this_);
+#endif
 /**
- * @brief Constructs default value for `z_liveliness_token_options_t`.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Tries to obtain mutable SHM buffer instead of immutable one.
+ * @param this_: mutable SHM buffer to be initialized upon success
+ * @param that: immutable SHM buffer
+ * @param immut: immutable SHM buffer returned back to caller's side
+ * ONLY in case of Z_EUNAVAILABLE failure
+ * @return Z_OK in case of success, Z_EUNAVAILABLE in case of unsuccessful write access,
+ * Z_EINVAL if moved value is incorrect.
  */
-ZENOHC_API void z_liveliness_token_options_default(struct z_liveliness_token_options_t *this_);
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+z_result_t z_shm_mut_try_from_immut(struct z_owned_shm_mut_t *this_,
+                                    struct z_moved_shm_t *that,
+                                    struct z_owned_shm_t *immut);
+#endif
 /**
- * @brief Destroys a liveliness token, notifying subscribers of its destruction.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Make allocation without any additional actions.
  */
-ZENOHC_API z_result_t z_liveliness_undeclare_token(struct z_moved_liveliness_token_t *this_);
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+void z_shm_provider_alloc(struct z_buf_layout_alloc_result_t *out_result,
+                          const struct z_loaned_shm_provider_t *provider,
+                          size_t size,
+                          struct z_alloc_alignment_t alignment);
+#endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Deletes Memory Layout.
+ * @brief Make allocation performing garbage collection if needed.
  */
 #if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-void z_memory_layout_drop(struct z_moved_memory_layout_t *this_);
+void z_shm_provider_alloc_gc(struct z_buf_layout_alloc_result_t *out_result,
+                             const struct z_loaned_shm_provider_t *provider,
+                             size_t size,
+                             struct z_alloc_alignment_t alignment);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Extract data from Memory Layout.
+ * @brief Make allocation performing garbage collection and/or defragmentation if needed.
  */
 #if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-void z_memory_layout_get_data(const struct z_loaned_memory_layout_t *this_,
-                              size_t *out_size,
-                              struct z_alloc_alignment_t *out_alignment);
+void z_shm_provider_alloc_gc_defrag(struct z_buf_layout_alloc_result_t *out_result,
+                                    const struct z_loaned_shm_provider_t *provider,
+                                    size_t size,
+                                    struct z_alloc_alignment_t alignment);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Borrows Memory Layout.
+ * @brief Make allocation performing garbage collection and/or defragmentation in async manner. Will return Z_EINVAL
+ * if used with non-threadsafe SHM Provider.
  */
 #if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-const struct z_loaned_memory_layout_t *z_memory_layout_loan(const struct z_owned_memory_layout_t *this_);
+z_result_t z_shm_provider_alloc_gc_defrag_async(struct z_buf_layout_alloc_result_t *out_result,
+                                                const struct z_loaned_shm_provider_t *provider,
+                                                size_t size,
+                                                struct z_alloc_alignment_t alignment,
+                                                struct zc_threadsafe_context_t result_context,
+                                                void (*result_callback)(void*,
+                                                                        struct z_buf_layout_alloc_result_t*));
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Creates a new Memory Layout.
+ * @brief Make allocation performing garbage collection and/or defragmentation and/or blocking if needed.
  */
 #if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-z_result_t z_memory_layout_new(struct z_owned_memory_layout_t *this_,
-                               size_t size,
-                               struct z_alloc_alignment_t alignment);
+void z_shm_provider_alloc_gc_defrag_blocking(struct z_buf_layout_alloc_result_t *out_result,
+                                             const struct z_loaned_shm_provider_t *provider,
+                                             size_t size,
+                                             struct z_alloc_alignment_t alignment);
 #endif
 /**
- * Drops mutex and resets it to its gravestone state.
- */
-ZENOHC_API void z_mutex_drop(struct z_moved_mutex_t *this_);
-/**
- * Constructs a mutex.
- * @return 0 in case of success, negative error code otherwise.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Make allocation performing garbage collection and/or defragmentation and/or forced deallocation if needed.
  */
-ZENOHC_API z_result_t z_mutex_init(struct z_owned_mutex_t *this_);
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+void z_shm_provider_alloc_gc_defrag_dealloc(struct z_buf_layout_alloc_result_t *out_result,
+                                            const struct z_loaned_shm_provider_t *provider,
+                                            size_t size,
+                                            struct z_alloc_alignment_t alignment);
+#endif
 /**
- * Mutably borrows mutex.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Return the memory size available in the provider.
  */
-ZENOHC_API struct z_loaned_mutex_t *z_mutex_loan_mut(struct z_owned_mutex_t *this_);
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+size_t z_shm_provider_available(const struct z_loaned_shm_provider_t *provider);
+#endif
 /**
- * Locks mutex. If mutex is already locked, blocks the thread until it aquires the lock.
- * @return 0 in case of success, negative error code in case of failure.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Perform memory defragmentation. The real operations taken depend on the provider's backend allocator
+ * implementation.
  */
-ZENOHC_API z_result_t z_mutex_lock(struct z_loaned_mutex_t *this_);
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+size_t z_shm_provider_defragment(const struct z_loaned_shm_provider_t *provider);
+#endif
 /**
- * Tries to lock mutex. If mutex is already locked, return immediately.
- * @return 0 in case of success, negative value if failed to aquire the lock.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Deletes SHM Provider.
  */
-ZENOHC_API z_result_t z_mutex_try_lock(struct z_loaned_mutex_t *this_);
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+void z_shm_provider_drop(struct z_moved_shm_provider_t *this_);
+#endif
 /**
- * Unlocks previously locked mutex. If mutex was not locked by the current thread, the behaviour is undefined.
- * @return 0 in case of success, negative error code otherwise.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Perform memory garbage collection and reclaim all dereferenced SHM buffers.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-z_result_t z_mutex_unlock(struct z_loaned_mutex_t *this_);
+size_t z_shm_provider_garbage_collect(const struct z_loaned_shm_provider_t *provider);
+#endif
 /**
- * Constructs and opens a new Zenoh session.
- *
- * @return 0 in case of success, negative error code otherwise (in this case the session will be in its gravestone state).
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Borrows SHM Provider.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-z_result_t z_open(struct z_owned_session_t *this_,
-                  struct z_moved_config_t *config,
-                  const struct z_open_options_t *_options);
+const struct z_loaned_shm_provider_t *z_shm_provider_loan(const struct z_owned_shm_provider_t *this_);
+#endif
 /**
- * Constructs the default value for `z_open_options_t`.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Map the preallocated data chunk into SHM buffer.
  */
-ZENOHC_API void z_open_options_default(struct z_open_options_t *this_);
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+z_result_t z_shm_provider_map(struct z_owned_shm_mut_t *out_result,
+                              const struct z_loaned_shm_provider_t *provider,
+                              struct z_allocated_chunk_t allocated_chunk,
+                              size_t len);
+#endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Constructs and opens a new Zenoh session with specified client storage.
- *
- * @return 0 in case of success, negative error code otherwise (in this case the session will be in its gravestone state).
+ * @brief Creates a new SHM Provider.
  */
 #if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-z_result_t z_open_with_custom_shm_clients(struct z_owned_session_t *this_,
-                                          struct z_moved_config_t *config,
-                                          const struct z_loaned_shm_client_storage_t *shm_clients);
+void z_shm_provider_new(struct z_owned_shm_provider_t *this_,
+                        z_protocol_id_t id,
+                        struct zc_context_t context,
+                        struct zc_shm_provider_backend_callbacks_t callbacks);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Creates a new POSIX SHM Client.
+ * @brief Creates a new threadsafe SHM Provider.
  */
 #if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-void z_posix_shm_client_new(struct z_owned_shm_client_t *this_);
+void z_shm_provider_threadsafe_new(struct z_owned_shm_provider_t *this_,
+                                   z_protocol_id_t id,
+                                   struct zc_threadsafe_context_t context,
+                                   struct zc_shm_provider_backend_callbacks_t callbacks);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Creates a new POSIX SHM Provider.
+ * @brief Mutably borrows ZShm slice as borrowed ZShmMut slice.
  */
 #if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-z_result_t z_posix_shm_provider_new(struct z_owned_shm_provider_t *this_,
-                                    const struct z_loaned_memory_layout_t *layout);
+struct z_loaned_shm_mut_t *z_shm_try_mut(struct z_owned_shm_t *this_);
 #endif
 /**
- * Returns the default value of #z_priority_t.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Tries to reborrow mutably-borrowed ZShm slice as borrowed ZShmMut slice.
+ * @return borrowed ZShmMut slice in case of success, NULL otherwise.
  */
-ZENOHC_API enum z_priority_t z_priority_default(void);
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+struct z_loaned_shm_mut_t *z_shm_try_reloan_mut(struct z_loaned_shm_t *this_);
+#endif
 /**
- * Sends a `DELETE` message onto the publisher's key expression.
- *
- * @return 0 in case of success, negative error code in case of failure.
+ * Puts current thread to sleep for specified amount of milliseconds.
  */
-ZENOHC_API
-z_result_t z_publisher_delete(const struct z_loaned_publisher_t *publisher,
-                              struct z_publisher_delete_options_t *options);
+ZENOHC_API z_result_t z_sleep_ms(size_t time);
 /**
- * Constructs the default values for the delete operation via a publisher entity.
+ * Puts current thread to sleep for specified amount of seconds.
  */
-ZENOHC_API void z_publisher_delete_options_default(struct z_publisher_delete_options_t *this_);
+ZENOHC_API z_result_t z_sleep_s(size_t time);
 /**
- * Frees memory and resets publisher to its gravestone state.
- * This is equivalent to calling `z_undeclare_publisher()` and discarding its return value.
+ * Puts current thread to sleep for specified amount of microseconds.
  */
-ZENOHC_API void z_publisher_drop(struct z_moved_publisher_t *this_);
+ZENOHC_API z_result_t z_sleep_us(size_t time);
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Returns the ID of the publisher.
+ * Constructs an owned copy of a slice.
  */
-#if defined(Z_FEATURE_UNSTABLE_API)
-ZENOHC_API
-struct z_entity_global_id_t z_publisher_id(const struct z_loaned_publisher_t *publisher);
-#endif
+ZENOHC_API void z_slice_clone(struct z_owned_slice_t *dst, const struct z_loaned_slice_t *this_);
 /**
- * Returns the key expression of the publisher.
+ * Constructs a slice by copying a `len` bytes long sequence starting at `start`.
+ *
+ * @return -1 if `start == NULL` and `len > 0` (creating an empty slice), 0 otherwise.
  */
 ZENOHC_API
-const struct z_loaned_keyexpr_t *z_publisher_keyexpr(const struct z_loaned_publisher_t *publisher);
+z_result_t z_slice_copy_from_buf(struct z_owned_slice_t *this_,
+                                 const uint8_t *start,
+                                 size_t len);
 /**
- * Borrows publisher.
+ * @return the pointer to the slice data.
  */
-ZENOHC_API
-const struct z_loaned_publisher_t *z_publisher_loan(const struct z_owned_publisher_t *this_);
+ZENOHC_API const uint8_t *z_slice_data(const struct z_loaned_slice_t *this_);
 /**
- * Mutably borrows publisher.
+ * Frees the memory and invalidates the slice.
  */
-ZENOHC_API struct z_loaned_publisher_t *z_publisher_loan_mut(struct z_owned_publisher_t *this_);
+ZENOHC_API void z_slice_drop(struct z_moved_slice_t *this_);
 /**
- * Constructs the default value for `z_publisher_options_t`.
+ * Constructs an empty `z_owned_slice_t`.
  */
-ZENOHC_API void z_publisher_options_default(struct z_publisher_options_t *this_);
+ZENOHC_API void z_slice_empty(struct z_owned_slice_t *this_);
 /**
- * Sends a `PUT` message onto the publisher's key expression, transfering the payload ownership.
- *
- *
- * The payload and all owned options fields are consumed upon function return.
- *
- * @param this_: The publisher.
- * @param payload: The data to publish. Will be consumed.
- * @param options: The publisher put options. All owned fields will be consumed.
+ * Constructs a slice by transferring ownership of `data` to it.
+ * @param this_: Pointer to an uninitialized memoery location where slice will be constructed.
+ * @param data: Pointer to the data to be owned by `this_`.
+ * @param len: Number of bytes in `data`.
+ * @param drop: A thread-safe delete function to free the `data`. Will be called once when `this_` is dropped. Can be NULL, in case if `data` is allocated in static memory.
+ * @param context: An optional context to be passed to the `deleter`.
  *
- * @return 0 in case of success, negative error values in case of failure.
+ * @return -1 if `start == NULL` and `len > 0` (creating an empty slice), 0 otherwise.
  */
 ZENOHC_API
-z_result_t z_publisher_put(const struct z_loaned_publisher_t *this_,
-                           struct z_moved_bytes_t *payload,
-                           struct z_publisher_put_options_t *options);
-/**
- * Constructs the default value for `z_publisher_put_options_t`.
- */
-ZENOHC_API void z_publisher_put_options_default(struct z_publisher_put_options_t *this_);
+z_result_t z_slice_from_buf(struct z_owned_slice_t *this_,
+                            uint8_t *data,
+                            size_t len,
+                            void (*drop)(void *data, void *context),
+                            void *context);
 /**
- * Publishes data on specified key expression.
- *
- * @param session: The Zenoh session.
- * @param key_expr: The key expression to publish to.
- * @param payload: The value to put (consumed upon function return).
- * @param options: The put options (all owned values will be consumed upon function return).
- *
- * @return 0 in case of success, negative error values in case of failure.
+ * @return ``true`` if slice is empty, ``false`` otherwise.
  */
-ZENOHC_API
-z_result_t z_put(const struct z_loaned_session_t *session,
-                 const struct z_loaned_keyexpr_t *key_expr,
-                 struct z_moved_bytes_t *payload,
-                 struct z_put_options_t *options);
+ZENOHC_API bool z_slice_is_empty(const struct z_loaned_slice_t *this_);
 /**
- * Constructs the default value for `z_put_options_t`.
+ * @return the length of the slice.
  */
-ZENOHC_API void z_put_options_default(struct z_put_options_t *this_);
+ZENOHC_API size_t z_slice_len(const struct z_loaned_slice_t *this_);
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Frees memory and resets querier to its gravestone state.
- * This is equivalent to calling `z_undeclare_querier()` and discarding its return value.
+ * Borrows slice.
  */
-#if defined(Z_FEATURE_UNSTABLE_API)
-ZENOHC_API
-void z_querier_drop(struct z_moved_querier_t *this_);
-#endif
+ZENOHC_API const struct z_loaned_slice_t *z_slice_loan(const struct z_owned_slice_t *this_);
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Query data from the matching queryables in the system.
- * Replies are provided through a callback function.
- *
- * @param querier: The querier to make query from.
- * @param parameters: The query's parameters, similar to a url's query segment.
- * @param callback: The callback function that will be called on reception of replies for this query. It will be automatically dropped once all replies are processed.
- * @param options: Additional options for the get. All owned fields will be consumed.
- *
- * @return 0 in case of success, a negative error value upon failure.
+ * @brief Frees the memory and invalidates the source info, resetting it to a gravestone state.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t z_querier_get(const struct z_loaned_querier_t *querier,
-                         const char *parameters,
-                         struct z_moved_closure_reply_t *callback,
-                         struct z_querier_get_options_t *options);
+void z_source_info_drop(struct z_moved_source_info_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Constructs the default value for `z_querier_get_options_t`.
+ * @brief Returns the source_id of the source info.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_querier_get_options_default(struct z_querier_get_options_t *this_);
+struct z_entity_global_id_t z_source_info_id(const struct z_loaned_source_info_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Returns the ID of the querier.
+ * @brief Borrows source info.
  */
-#if (defined(Z_FEATURE_UNSTABLE_API) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-struct z_entity_global_id_t z_querier_id(const struct z_loaned_querier_t *querier);
+const struct z_loaned_source_info_t *z_source_info_loan(const struct z_owned_source_info_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Returns the key expression of the querier.
+ * @brief Creates source info.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-const struct z_loaned_keyexpr_t *z_querier_keyexpr(const struct z_loaned_querier_t *querier);
+z_result_t z_source_info_new(struct z_owned_source_info_t *this_,
+                             const struct z_entity_global_id_t *source_id,
+                             uint32_t source_sn);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Borrows querier.
+ * @brief Returns the source_sn of the source info.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-const struct z_loaned_querier_t *z_querier_loan(const struct z_owned_querier_t *this_);
+uint32_t z_source_info_sn(const struct z_loaned_source_info_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Mutably borrows querier.
+ * @brief Constructs send and recieve ends of the single-producer/single-consumer channel.
+ *
+ * The channel is a bounded ring buffer, intended for pipelines where the samples produced by a single callback
+ * (i.e. a single subscriber) are consumed by a single thread. The callback and the receiving thread each take a lock
+ * of their own side only, which is uncontended in this use, and the receiving thread only waits on a condition variable
+ * when the buffer is empty.
+ *
+ * Samples received while the buffer is full are dropped, their number is returned by `z_spsc_handler_sample_dropped()`.
+ * Receiving from several threads is safe but serialized: `z_spsc_handler_sample_try_recv()` returns `Z_CHANNEL_NODATA`
+ * while another thread is receiving.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-struct z_loaned_querier_t *z_querier_loan_mut(struct z_owned_querier_t *this_);
+void z_spsc_channel_sample_new(struct z_owned_closure_sample_t *callback,
+                               struct z_owned_spsc_handler_sample_t *handler,
+                               size_t capacity);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Constructs the default value for `z_querier_options_t`.
+ * @brief Drops the handler and resets it to a gravestone state.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_querier_options_default(struct z_querier_options_t *this_);
+void z_spsc_handler_sample_drop(struct z_moved_spsc_handler_sample_t *this_);
 #endif
 /**
- * Gets query attachment.
- *
- * Returns NULL if query does not contain an attachment.
- */
-ZENOHC_API const struct z_loaned_bytes_t *z_query_attachment(const struct z_loaned_query_t *this_);
-/**
- * Gets mutable query attachment.
- *
- * Returns NULL if query does not contain an attachment.
- */
-ZENOHC_API struct z_loaned_bytes_t *z_query_attachment_mut(struct z_loaned_query_t *this_);
-/**
- * Constructs a shallow copy of the query, allowing to keep it in an "open" state past the callback's return.
- *
- * This operation is infallible, but may return a gravestone value if `query` itself was a gravestone value (which cannot be the case in a callback).
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns the number of samples dropped by the spsc channel because its buffer was full.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_query_clone(struct z_owned_query_t *dst,
-                   const struct z_loaned_query_t *this_);
-/**
- * Automatic query consolidation strategy selection.
- *
- * A query consolidation strategy will automatically be selected depending the query selector.
- * If the selector contains time range properties, no consolidation is performed.
- * Otherwise the `z_query_consolidation_latest` strategy is used.
- */
-ZENOHC_API struct z_query_consolidation_t z_query_consolidation_auto(void);
+uint64_t z_spsc_handler_sample_dropped(const struct z_loaned_spsc_handler_sample_t *this_);
+#endif
 /**
- * Creates a default `z_query_consolidation_t` (consolidation mode AUTO).
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Borrows handler.
  */
-ZENOHC_API struct z_query_consolidation_t z_query_consolidation_default(void);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+const struct z_loaned_spsc_handler_sample_t *z_spsc_handler_sample_loan(const struct z_owned_spsc_handler_sample_t *this_);
+#endif
 /**
- * Latest consolidation.
- *
- * This strategy optimizes bandwidth on all links in the system but will provide a very poor latency.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns sample from the spsc buffer. If there are no more pending samples will block until next sample is received, or until
+ * the channel is dropped (normally when there are no more samples to receive).
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the sample will be in the gravestone state).
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-struct z_query_consolidation_t z_query_consolidation_latest(void);
+z_result_t z_spsc_handler_sample_recv(const struct z_loaned_spsc_handler_sample_t *this_,
+                                      struct z_owned_sample_t *sample);
+#endif
 /**
- * Monotonic consolidation.
- *
- * This strategy offers the best latency. Replies are directly transmitted to the application when received
- * without needing to wait for all replies. This mode does not guarantee that there will be no duplicates.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns sample from the spsc buffer. If there are no more pending samples will return immediately (with sample set to its gravestone state).
+ * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the sample will be in the gravestone state),
+ * `Z_CHANNEL_NODATA` if the channel is still alive, but its buffer is empty (the sample will be in the gravestone state).
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-struct z_query_consolidation_t z_query_consolidation_monotonic(void);
+z_result_t z_spsc_handler_sample_try_recv(const struct z_loaned_spsc_handler_sample_t *this_,
+                                          struct z_owned_sample_t *sample);
+#endif
 /**
- * No consolidation.
- *
- * This strategy is useful when querying timeseries data bases or when using quorums.
+ * Constructs an owned copy of a string array.
  */
-ZENOHC_API struct z_query_consolidation_t z_query_consolidation_none(void);
+ZENOHC_API
+void z_string_array_clone(struct z_owned_string_array_t *dst,
+                          const struct z_loaned_string_array_t *this_);
 /**
- * Destroys the query resetting it to its gravestone value.
+ * Destroys the string array, resetting it to its gravestone value.
  */
-ZENOHC_API void z_query_drop(struct z_moved_query_t *this_);
+ZENOHC_API void z_string_array_drop(struct z_moved_string_array_t *this_);
 /**
- * Gets query <a href="https://github.com/eclipse-zenoh/roadmap/blob/main/rfcs/ALL/Query%20Payload.md">payload encoding</a>.
+ * @return the value at the position of index in the string array.
  *
- * Returns NULL if query does not contain an encoding.
+ * Will return `NULL` if the index is out of bounds.
  */
 ZENOHC_API
-const struct z_loaned_encoding_t *z_query_encoding(const struct z_loaned_query_t *this_);
-/**
- * Gets query key expression.
- */
-ZENOHC_API const struct z_loaned_keyexpr_t *z_query_keyexpr(const struct z_loaned_query_t *this_);
+const struct z_loaned_string_t *z_string_array_get(const struct z_loaned_string_array_t *this_,
+                                                   size_t index);
 /**
- * Borrows the query.
+ * @return ``true`` if the array is empty, ``false`` otherwise.
  */
-ZENOHC_API const struct z_loaned_query_t *z_query_loan(const struct z_owned_query_t *this_);
+ZENOHC_API bool z_string_array_is_empty(const struct z_loaned_string_array_t *this_);
 /**
- * Mutably borrows the query.
+ * @return number of elements in the array.
  */
-ZENOHC_API struct z_loaned_query_t *z_query_loan_mut(struct z_owned_query_t *this_);
+ZENOHC_API size_t z_string_array_len(const struct z_loaned_string_array_t *this_);
 /**
- * Gets query <a href="https://github.com/eclipse-zenoh/roadmap/tree/main/rfcs/ALL/Selectors">value selector</a>.
+ * Borrows string array.
  */
 ZENOHC_API
-void z_query_parameters(const struct z_loaned_query_t *this_,
-                        struct z_view_string_t *parameters);
+const struct z_loaned_string_array_t *z_string_array_loan(const struct z_owned_string_array_t *this_);
 /**
- * Gets query <a href="https://github.com/eclipse-zenoh/roadmap/blob/main/rfcs/ALL/Query%20Payload.md">payload</a>.
- *
- * Returns NULL if query does not contain a payload.
+ * Mutably borrows string array.
  */
 ZENOHC_API
-const struct z_loaned_bytes_t *z_query_payload(const struct z_loaned_query_t *this_);
+struct z_loaned_string_array_t *z_string_array_loan_mut(struct z_owned_string_array_t *this_);
 /**
- * Gets mutable query <a href="https://github.com/eclipse-zenoh/roadmap/blob/main/rfcs/ALL/Query%20Payload.md">payload</a>.
- *
- * Returns NULL if query does not contain a payload.
+ * Constructs a new empty string array.
  */
-ZENOHC_API
-struct z_loaned_bytes_t *z_query_payload_mut(struct z_loaned_query_t *this_);
+ZENOHC_API void z_string_array_new(struct z_owned_string_array_t *this_);
 /**
- * Sends a reply to a query.
- *
- * This function must be called inside of a Queryable callback passing the
- * query received as parameters of the callback function. This function can
- * be called multiple times to send multiple replies to a query. The reply
- * will be considered complete when the Queryable callback returns.
- *
- * @param this_: The query to reply to.
- * @param key_expr: The key of this reply.
- * @param payload: The payload of this reply. Will be consumed.
- * @param options: The options of this reply. All owned fields will be consumed.
+ * Appends specified value to the end of the string array by alias.
  *
- * @return 0 in case of success, negative error code otherwise.
+ * @return the new length of the array.
  */
 ZENOHC_API
-z_result_t z_query_reply(const struct z_loaned_query_t *this_,
-                         const struct z_loaned_keyexpr_t *key_expr,
-                         struct z_moved_bytes_t *payload,
-                         struct z_query_reply_options_t *options);
+size_t z_string_array_push_by_alias(struct z_loaned_string_array_t *this_,
+                                    const struct z_loaned_string_t *value);
 /**
- * Sends a delete reply to a query.
- *
- * This function must be called inside of a Queryable callback passing the
- * query received as parameters of the callback function. This function can
- * be called multiple times to send multiple replies to a query. The reply
- * will be considered complete when the Queryable callback returns.
- *
- * @param this_: The query to reply to.
- * @param key_expr: The key of this delete reply.
- * @param options: The options of this delete reply. All owned fields will be consumed.
+ * Appends specified value to the end of the string array by copying.
  *
- * @return 0 in case of success, negative error code otherwise.
+ * @return the new length of the array.
  */
 ZENOHC_API
-z_result_t z_query_reply_del(const struct z_loaned_query_t *this_,
-                             const struct z_loaned_keyexpr_t *key_expr,
-                             struct z_query_reply_del_options_t *options);
+size_t z_string_array_push_by_copy(struct z_loaned_string_array_t *this_,
+                                   const struct z_loaned_string_t *value);
+ZENOHC_API const struct z_loaned_slice_t *z_string_as_slice(const struct z_loaned_string_t *this_);
 /**
- * Constructs the default value for `z_query_reply_del_options_t`.
+ * Constructs an owned copy of a string.
  */
-ZENOHC_API void z_query_reply_del_options_default(struct z_query_reply_del_options_t *this_);
+ZENOHC_API void z_string_clone(struct z_owned_string_t *dst, const struct z_loaned_string_t *this_);
 /**
- * Sends a error reply to a query.
- *
- * This function must be called inside of a Queryable callback passing the
- * query received as parameters of the callback function. This function can
- * be called multiple times to send multiple replies to a query. The reply
- * will be considered complete when the Queryable callback returns.
- *
- * @param this_: The query to reply to.
- * @param payload: The payload carrying error message. Will be consumed.
- * @param options: The options of this reply. All owned fields will be consumed.
+ * Constructs an owned string by copying `str` into it (including terminating 0), using `strlen` (this should therefore not be used with untrusted inputs).
  *
- * @return 0 in case of success, negative error code otherwise.
+ * @return -1 if `str == NULL` (and creates a string in a gravestone state), 0 otherwise.
  */
 ZENOHC_API
-z_result_t z_query_reply_err(const struct z_loaned_query_t *this_,
-                             struct z_moved_bytes_t *payload,
-                             struct z_query_reply_err_options_t *options);
+z_result_t z_string_copy_from_str(struct z_owned_string_t *this_,
+                                  const char *str);
 /**
- * Constructs the default value for `z_query_reply_err_options_t`.
+ * Constructs an owned string by copying a `str` substring of length `len`.
+ *
+ * @return -1 if `str == NULL` and `len > 0` (and creates a string in a gravestone state), 0 otherwise.
  */
-ZENOHC_API void z_query_reply_err_options_default(struct z_query_reply_err_options_t *this_);
+ZENOHC_API
+z_result_t z_string_copy_from_substr(struct z_owned_string_t *this_,
+                                     const char *str,
+                                     size_t len);
 /**
- * Constructs the default value for `z_query_reply_options_t`.
+ * @return the pointer of the string data.
  */
-ZENOHC_API void z_query_reply_options_default(struct z_query_reply_options_t *this_);
+ZENOHC_API const char *z_string_data(const struct z_loaned_string_t *this_);
 /**
- * Create a default `z_query_target_t`.
+ * Frees memory and invalidates `z_owned_string_t`, putting it in gravestone state.
  */
-ZENOHC_API enum z_query_target_t z_query_target_default(void);
+ZENOHC_API void z_string_drop(struct z_moved_string_t *this_);
 /**
- * Undeclares queryable callback and resets it to its gravestone state.
- * This is equivalent to calling `z_undeclare_queryable()` and discarding its return value.
+ * Constructs an empty owned string.
  */
-ZENOHC_API void z_queryable_drop(struct z_moved_queryable_t *this_);
+ZENOHC_API void z_string_empty(struct z_owned_string_t *this_);
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Returns the ID of the queryable.
+ * Constructs an owned string by transferring ownership of a null-terminated string `str` to it.
+ * @param this_: Pointer to an uninitialized memory location where an owned string will be constructed.
+ * @param str: Pointer to a null terminated string to be owned by `this_`.
+ * @param drop: A thread-safe delete function to free the `str`. Will be called once when `str` is dropped. Can be NULL, in case if `str` is allocated in static memory.
+ * @param context: An optional context to be passed to the `deleter`.
+ * @return -1 if `str == NULL` and `len > 0` (and creates a string in a gravestone state), 0 otherwise.
  */
-#if defined(Z_FEATURE_UNSTABLE_API)
-ZENOHC_API
-struct z_entity_global_id_t z_queryable_id(const struct z_loaned_queryable_t *queryable);
-#endif
 ZENOHC_API
-const struct z_loaned_queryable_t *z_queryable_loan(const struct z_owned_queryable_t *this_);
-/**
- * Constructs the default value for `z_query_reply_options_t`.
- */
-ZENOHC_API void z_queryable_options_default(struct z_queryable_options_t *this_);
-/**
- * Fills buffer with random data.
- */
-ZENOHC_API void z_random_fill(void *buf, size_t len);
-/**
- * Generates random `uint16_t`.
- */
-ZENOHC_API uint16_t z_random_u16(void);
+z_result_t z_string_from_str(struct z_owned_string_t *this_,
+                             char *str,
+                             void (*drop)(void *value, void *context),
+                             void *context);
 /**
- * Generates random `uint32_t`.
+ * @return ``true`` if string is empty, ``false`` otherwise.
  */
-ZENOHC_API uint32_t z_random_u32(void);
+ZENOHC_API bool z_string_is_empty(const struct z_loaned_string_t *this_);
 /**
- * Generates random `uint64_t`.
+ * @return the length of the string (without terminating 0 character).
  */
-ZENOHC_API uint64_t z_random_u64(void);
+ZENOHC_API size_t z_string_len(const struct z_loaned_string_t *this_);
 /**
- * Generates random `uint8_t`.
+ * Borrows string.
  */
-ZENOHC_API uint8_t z_random_u8(void);
+ZENOHC_API const struct z_loaned_string_t *z_string_loan(const struct z_owned_string_t *this_);
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Reference the global client storage.
+ * Undeclares subscriber callback and resets it to its gravestone state.
+ * This is equivalent to calling `z_undeclare_subscriber()` and discarding its return value.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
-ZENOHC_API
-void z_ref_shm_client_storage_global(struct z_owned_shm_client_storage_t *this_);
-#endif
+ZENOHC_API void z_subscriber_drop(struct z_moved_subscriber_t *this_);
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Returns the default value for `reliability`.
+ * @brief Returns the ID of the subscriber.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-enum z_reliability_t z_reliability_default(void);
+struct z_entity_global_id_t z_subscriber_id(const struct z_loaned_subscriber_t *subscriber);
 #endif
 /**
- * Constructs an owned shallow copy of reply in provided uninitialized memory location.
+ * Returns the key expression of the subscriber.
  */
-ZENOHC_API void z_reply_clone(struct z_owned_reply_t *dst, const struct z_loaned_reply_t *this_);
+ZENOHC_API
+const struct z_loaned_keyexpr_t *z_subscriber_keyexpr(const struct z_loaned_subscriber_t *subscriber);
 /**
- * Frees reply, resetting it to its gravestone state.
+ * Borrows subscriber.
  */
-ZENOHC_API void z_reply_drop(struct z_moved_reply_t *this_);
+ZENOHC_API
+const struct z_loaned_subscriber_t *z_subscriber_loan(const struct z_owned_subscriber_t *this_);
 /**
- * Yields the contents of the reply by asserting it indicates a failure.
- *
- * Returns `NULL` if reply does not contain a error  (i. e. if `z_reply_is_ok` returns ``true``).
+ * Constructs the default value for `z_subscriber_options_t`.
  */
-ZENOHC_API const struct z_loaned_reply_err_t *z_reply_err(const struct z_loaned_reply_t *this_);
+ZENOHC_API void z_subscriber_options_default(struct z_subscriber_options_t *this_);
 /**
- * Constructs a copy of the reply error message.
+ * Detaches the task and releases all allocated resources.
  */
-ZENOHC_API
-void z_reply_err_clone(struct z_owned_reply_err_t *dst,
-                       const struct z_loaned_reply_err_t *this_);
+ZENOHC_API void z_task_detach(struct z_moved_task_t *this_);
 /**
- * Frees the memory and resets the reply error it to its default value.
+ * Drop the task. Same as `z_task_detach`. Use `z_task_join` to wait for the task completion.
  */
-ZENOHC_API void z_reply_err_drop(struct z_moved_reply_err_t *this_);
+ZENOHC_API void z_task_drop(struct z_moved_task_t *this_);
 /**
- * Returns reply error encoding.
+ * Constructs a new task.
+ *
+ * @param this_: An uninitialized memory location where task will be constructed.
+ * @param _attr: Attributes of the task (currently unused).
+ * @param fun: Function to be executed by the task.
+ * @param arg: Argument that will be passed to the function `fun`.
  */
 ZENOHC_API
-const struct z_loaned_encoding_t *z_reply_err_encoding(const struct z_loaned_reply_err_t *this_);
+z_result_t z_task_init(struct z_owned_task_t *this_,
+                       const struct z_task_attr_t *_attr,
+                       void *(*fun)(void *arg),
+                       void *arg);
 /**
- * Borrows reply error.
+ * Joins the task and releases all allocated resources
  */
-ZENOHC_API
-const struct z_loaned_reply_err_t *z_reply_err_loan(const struct z_owned_reply_err_t *this_);
+ZENOHC_API z_result_t z_task_join(struct z_moved_task_t *this_);
 /**
- * Mutably borrows reply error.
+ * Get number of milliseconds passed since creation of `time`.
  */
-ZENOHC_API struct z_loaned_reply_err_t *z_reply_err_loan_mut(struct z_owned_reply_err_t *this_);
+ZENOHC_API uint64_t z_time_elapsed_ms(const struct z_time_t *time);
 /**
- * Yields the contents of the reply by asserting it indicates a failure.
- *
- * Returns `NULL` if reply does not contain a error  (i. e. if `z_reply_is_ok` returns ``true``).
+ * Get number of seconds passed since creation of `time`.
  */
-ZENOHC_API struct z_loaned_reply_err_t *z_reply_err_mut(struct z_loaned_reply_t *this_);
+ZENOHC_API uint64_t z_time_elapsed_s(const struct z_time_t *time);
 /**
- * Returns reply error payload.
+ * Get number of microseconds passed since creation of `time`.
  */
-ZENOHC_API
-const struct z_loaned_bytes_t *z_reply_err_payload(const struct z_loaned_reply_err_t *this_);
+ZENOHC_API uint64_t z_time_elapsed_us(const struct z_time_t *time);
 /**
- * Returns mutable reply error payload.
+ * Initialize clock with current time instant.
  */
-ZENOHC_API struct z_loaned_bytes_t *z_reply_err_payload_mut(struct z_loaned_reply_err_t *this_);
+ZENOHC_API struct z_time_t z_time_now(void);
 /**
- * Returns ``true`` if reply contains a valid response, ``false`` otherwise (in this case it contains a errror value).
+ * Converts current system time into null-terminated human readable string and writes it to the `buf`.
+ *
+ * @param buf: A buffer where the string will be writtent
+ * @param len: Maximum number of characters to write (including terminating 0). The string will be truncated
+ * if it is longer than `len`.
  */
 ZENOHC_API
-bool z_reply_is_ok(const struct z_loaned_reply_t *this_);
+const char *z_time_now_as_str(const char *buf,
+                              size_t len);
 /**
- * Borrows reply.
+ * @brief Returns id associated with this timestamp.
  */
-ZENOHC_API const struct z_loaned_reply_t *z_reply_loan(const struct z_owned_reply_t *this_);
+ZENOHC_API struct z_id_t z_timestamp_id(const struct z_timestamp_t *this_);
 /**
- * Mutably borrows reply.
+ * Create uhlc timestamp from session id.
  */
-ZENOHC_API struct z_loaned_reply_t *z_reply_loan_mut(struct z_owned_reply_t *this_);
+ZENOHC_API
+z_result_t z_timestamp_new(struct z_timestamp_t *this_,
+                           const struct z_loaned_session_t *session);
 /**
- * Yields the contents of the reply by asserting it indicates a success.
- *
- * Returns `NULL` if reply does not contain a sample (i. e. if `z_reply_is_ok` returns ``false``).
+ * Returns NPT64 time associated with this timestamp.
  */
-ZENOHC_API const struct z_loaned_sample_t *z_reply_ok(const struct z_loaned_reply_t *this_);
+ZENOHC_API uint64_t z_timestamp_ntp64_time(const struct z_timestamp_t *this_);
 /**
- * Yields the contents of the reply by asserting it indicates a success.
+ * Undeclares the key expression generated by a call to `z_declare_keyexpr()`.
+ * The key expression is consumed.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+ZENOHC_API
+z_result_t z_undeclare_keyexpr(const struct z_loaned_session_t *session,
+                               struct z_moved_keyexpr_t *key_expr);
+/**
+ * @brief Undeclares the given publisher.
  *
- * Returns `NULL` if reply does not contain a sample (i. e. if `z_reply_is_ok` returns ``false``).
+ * @return 0 in case of success, negative error code otherwise.
  */
-ZENOHC_API struct z_loaned_sample_t *z_reply_ok_mut(struct z_loaned_reply_t *this_);
+ZENOHC_API z_result_t z_undeclare_publisher(struct z_moved_publisher_t *this_);
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Gets the id of the zenoh instance that answered this Reply.
- * @return `true` if id is present.
+ * @brief Undeclares the given querier.
+ *
+ * @return 0 in case of success, negative error code otherwise.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-bool z_reply_replier_id(const struct z_loaned_reply_t *this_,
-                        struct z_id_t *out_id);
+z_result_t z_undeclare_querier(struct z_moved_querier_t *this_);
 #endif
 /**
- * Constructs send and recieve ends of the ring channel
+ * Undeclares a `z_owned_queryable_t`.
+ * Returns 0 in case of success, negative error code otherwise.
  */
-ZENOHC_API
-void z_ring_channel_query_new(struct z_owned_closure_query_t *callback,
-                              struct z_owned_ring_handler_query_t *handler,
-                              size_t capacity);
+ZENOHC_API z_result_t z_undeclare_queryable(struct z_moved_queryable_t *this_);
 /**
- * Constructs send and recieve ends of the ring channel
+ * Undeclares the subscriber.
+ *
+ * @return 0 in case of success, negative error code otherwise.
  */
-ZENOHC_API
-void z_ring_channel_reply_new(struct z_owned_closure_reply_t *callback,
-                              struct z_owned_ring_handler_reply_t *handler,
-                              size_t capacity);
+ZENOHC_API z_result_t z_undeclare_subscriber(struct z_moved_subscriber_t *this_);
 /**
- * Constructs send and recieve ends of the ring channel
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs a view key expression by concatenation of key expression in `left` with a string in `right`,
+ * writing the result into the caller-provided buffer `buf` instead of allocating it.
+ *
+ * The result is canonized in place, it is the same as the one of `z_keyexpr_concat()`.
+ * `buf` must outlive the constructed key expression.
+ *
+ * @param this_: An uninitialized location in memory where key expression will be constructed.
+ * @param buf: A buffer of length >= `buf_len` where the resulting key expression is written.
+ * @param buf_len: Length of `buf`, it should be at least the sum of lengths of `left` and `right`.
+ * @param left: The key expression to concatenate to.
+ * @param right_start: A buffer of length >= `right_len` containing the string to concatenate.
+ * @param right_len: Number of characters from `right_start` to consider.
+ * @return 0 in case of success, negative error code otherwise.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_ring_channel_sample_new(struct z_owned_closure_sample_t *callback,
-                               struct z_owned_ring_handler_sample_t *handler,
-                               size_t capacity);
+z_result_t z_view_keyexpr_concat(struct z_view_keyexpr_t *this_,
+                                 char *buf,
+                                 size_t buf_len,
+                                 const struct z_loaned_keyexpr_t *left,
+                                 const char *right_start,
+                                 size_t right_len);
+#endif
 /**
- * Drops the handler and resets it to a gravestone state.
+ * Constructs a view key expression in empty state
  */
-ZENOHC_API void z_ring_handler_query_drop(struct z_moved_ring_handler_query_t *this_);
+ZENOHC_API void z_view_keyexpr_empty(struct z_view_keyexpr_t *this_);
 /**
- * Borrows handler.
+ * Constructs a `z_view_keyexpr_t` by aliasing a string.
+ * @return 0 in case of success, negative error code in case of failure (for example if expr is not a valid key expression or if it is
+ * not in canon form.
+ * `expr` must outlive the constucted key expression.
  */
 ZENOHC_API
-const struct z_loaned_ring_handler_query_t *z_ring_handler_query_loan(const struct z_owned_ring_handler_query_t *this_);
+z_result_t z_view_keyexpr_from_str(struct z_view_keyexpr_t *this_,
+                                   const char *expr);
 /**
- * Returns query from the ring buffer. If there are no more pending queries will block until next query is received, or until
- * the channel is dropped (normally when Queryable is dropped).
- * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the query will be in the gravestone state).
+ * Constructs a `z_view_keyexpr_t` by aliasing a string.
+ * The string is canonized in-place before being passed to keyexpr, possibly shortening it by modifying `len`.
+ * May SEGFAULT if `expr` is NULL or lies in read-only memory (as values initialized with string litterals do).
+ * `expr` must outlive the constucted key expression.
  */
 ZENOHC_API
-z_result_t z_ring_handler_query_recv(const struct z_loaned_ring_handler_query_t *this_,
-                                     struct z_owned_query_t *query);
+z_result_t z_view_keyexpr_from_str_autocanonize(struct z_view_keyexpr_t *this_,
+                                                char *expr);
 /**
- * Returns query from the ring buffer. If there are no more pending queries will return immediately (with query set to its gravestone state).
- * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the query will be in the gravestone state),
- * Z_CHANNEL_NODATA if the channel is still alive, but its buffer is empty (the query will be in the gravestone state).
+ * Constructs a `z_view_keyexpr_t` by aliasing a string without checking any of `z_view_keyexpr_t`'s assertions:
+ *
+ *  - `s` MUST be valid UTF8.
+ *  - `s` MUST follow the Key Expression specification, i.e.:
+ *   - MUST NOT contain `//`, MUST NOT start nor end with `/`, MUST NOT contain any of the characters `?#$`.
+ *   - any instance of `**` may only be lead or followed by `/`.
+ *   - the key expression must have canon form.
+ *
+ * `s` must outlive constructed key expression.
  */
 ZENOHC_API
-z_result_t z_ring_handler_query_try_recv(const struct z_loaned_ring_handler_query_t *this_,
-                                         struct z_owned_query_t *query);
+void z_view_keyexpr_from_str_unchecked(struct z_view_keyexpr_t *this_,
+                                       const char *s);
 /**
- * Drops the handler and resets it to a gravestone state.
+ * Constructs a `z_view_keyexpr_t` by aliasing a substring.
+ * `expr` must outlive the constucted key expression.
+ *
+ * @param this_: An uninitialized location in memory where key expression will be constructed.
+ * @param expr: A buffer with length >= `len`.
+ * @param len: Number of characters from `expr` to consider.
+ * @return 0 in case of success, negative error code otherwise.
  */
-ZENOHC_API void z_ring_handler_reply_drop(struct z_moved_ring_handler_reply_t *this_);
+ZENOHC_API
+z_result_t z_view_keyexpr_from_substr(struct z_view_keyexpr_t *this_,
+                                      const char *expr,
+                                      size_t len);
 /**
- * Borrows handler.
+ * Constructs a `z_view_keyexpr_t` by aliasing a substring.
+ * May SEGFAULT if `start` is NULL or lies in read-only memory (as values initialized with string litterals do).
+ * `expr` must outlive the constucted key expression.
+ *
+ * @param this_: An uninitialized location in memory where key expression will be constructed
+ * @param start: A buffer of with length >= `len`.
+ * @param len: Number of characters from `expr` to consider. Will be modified to be equal to canonized key expression length.
+ * @return 0 in case of success, negative error code otherwise.
  */
 ZENOHC_API
-const struct z_loaned_ring_handler_reply_t *z_ring_handler_reply_loan(const struct z_owned_ring_handler_reply_t *this_);
+z_result_t z_view_keyexpr_from_substr_autocanonize(struct z_view_keyexpr_t *this_,
+                                                   char *start,
+                                                   size_t *len);
 /**
- * Returns reply from the ring buffer. If there are no more pending replies will block until next reply is received, or until
- * the channel is dropped (normally when all replies are received).
- * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the reply will be in the gravestone state).
+ * Constructs a `z_view_keyexpr_t` by aliasing a substring without checking any of `z_view_keyexpr_t`'s assertions:
+ *
+ * - `start` MUST be valid UTF8.
+ * - `start` MUST follow the Key Expression specification, i.e.:
+ *  - MUST NOT contain ``//``, MUST NOT start nor end with ``/``, MUST NOT contain any of the characters ``?#$``.
+ *  - any instance of ``**`` may only be lead or followed by ``/``.
+ *  - the key expression must have canon form.
+ *
+ * `start` must outlive constructed key expression.
  */
 ZENOHC_API
-z_result_t z_ring_handler_reply_recv(const struct z_loaned_ring_handler_reply_t *this_,
-                                     struct z_owned_reply_t *reply);
+void z_view_keyexpr_from_substr_unchecked(struct z_view_keyexpr_t *this_,
+                                          const char *start,
+                                          size_t len);
 /**
- * Returns reply from the ring buffer. If there are no more pending replies will return immediately (with reply set to its gravestone state).
- * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the reply will be in the gravestone state),
- * `Z_CHANNEL_NODATA` if the channel is still alive, but its buffer is empty (the reply will be in the gravestone state).
+ * Returns ``true`` if `keyexpr` is valid, ``false`` if it is in gravestone state.
+ */
+ZENOHC_API bool z_view_keyexpr_is_empty(const struct z_view_keyexpr_t *this_);
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs a view key expression by performing path-joining (automatically inserting `/`) of `left` with `right`,
+ * writing the result into the caller-provided buffer `buf` instead of allocating it.
+ *
+ * The result is the same as the one of `z_keyexpr_join()`. Since both key expressions are already in canon form,
+ * the result is only re-canonized if `left` ends or `right` starts with `**`; otherwise it is only copied.
+ * `buf` must outlive the constructed key expression.
+ *
+ * @param this_: An uninitialized location in memory where key expression will be constructed.
+ * @param buf: A buffer of length >= `buf_len` where the resulting key expression is written.
+ * @param buf_len: Length of `buf`, it should be at least the sum of lengths of `left` and `right` plus 1.
+ * @param left: The first key expression.
+ * @param right: The second key expression.
+ * @return 0 in case of success, negative error code otherwise.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t z_ring_handler_reply_try_recv(const struct z_loaned_ring_handler_reply_t *this_,
-                                         struct z_owned_reply_t *reply);
+z_result_t z_view_keyexpr_join(struct z_view_keyexpr_t *this_,
+                               char *buf,
+                               size_t buf_len,
+                               const struct z_loaned_keyexpr_t *left,
+                               const struct z_loaned_keyexpr_t *right);
+#endif
+/**
+ * Borrows `z_view_keyexpr_t`.
+ */
+ZENOHC_API
+const struct z_loaned_keyexpr_t *z_view_keyexpr_loan(const struct z_view_keyexpr_t *this_);
 /**
- * Drops the handler and resets it to a gravestone state.
+ * Constructs an empty view slice.
  */
-ZENOHC_API void z_ring_handler_sample_drop(struct z_moved_ring_handler_sample_t *this_);
+ZENOHC_API void z_view_slice_empty(struct z_view_slice_t *this_);
 /**
- * Borrows handler.
+ * Constructs a `len` bytes long view starting at `start`.
+ *
+ * @return -1 if `start == NULL` and `len > 0` (and creates an empty view slice), 0 otherwise.
  */
 ZENOHC_API
-const struct z_loaned_ring_handler_sample_t *z_ring_handler_sample_loan(const struct z_owned_ring_handler_sample_t *this_);
+z_result_t z_view_slice_from_buf(struct z_view_slice_t *this_,
+                                 const uint8_t *start,
+                                 size_t len);
 /**
- * Returns sample from the ring buffer. If there are no more pending replies will block until next sample is received, or until
- * the channel is dropped (normally when there are no more replies to receive).
- * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the sample will be in the gravestone state).
+ * @return ``true`` if the slice is not empty, ``false`` otherwise.
  */
-ZENOHC_API
-z_result_t z_ring_handler_sample_recv(const struct z_loaned_ring_handler_sample_t *this_,
-                                      struct z_owned_sample_t *sample);
+ZENOHC_API bool z_view_slice_is_empty(const struct z_view_slice_t *this_);
 /**
- * Returns sample from the ring buffer. If there are no more pending replies will return immediately (with sample set to its gravestone state).
- * @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the sample will be in the gravestone state),
- * `Z_CHANNEL_NODATA` if the channel is still alive, but its buffer is empty (the sample will be in the gravestone state).
+ * Borrows view slice.
  */
-ZENOHC_API
-z_result_t z_ring_handler_sample_try_recv(const struct z_loaned_ring_handler_sample_t *this_,
-                                          struct z_owned_sample_t *sample);
+ZENOHC_API const struct z_loaned_slice_t *z_view_slice_loan(const struct z_view_slice_t *this_);
 /**
- * Returns sample attachment.
+ * Constructs an empty view string.
+ */
+ZENOHC_API void z_view_string_empty(struct z_view_string_t *this_);
+/**
+ * Constructs a view string of `str`, using `strlen` (this should therefore not be used with untrusted inputs).
  *
- * Returns `NULL`, if sample does not contain any attachment.
+ * @return -1 if `str == NULL` (and creates a string in a gravestone state), 0 otherwise.
  */
 ZENOHC_API
-const struct z_loaned_bytes_t *z_sample_attachment(const struct z_loaned_sample_t *this_);
+z_result_t z_view_string_from_str(struct z_view_string_t *this_,
+                                  const char *str);
 /**
- * Constructs an owned shallow copy of the sample (i.e. all modficiations applied to the copy, might be visible in the original) in provided uninitilized memory location.
+ * Constructs a view string to a specified substring of length `len`.
+ *
+ * @return -1 if `str == NULL` and `len > 0` (and creates a string in a gravestone state), 0 otherwise.
  */
 ZENOHC_API
-void z_sample_clone(struct z_owned_sample_t *dst,
-                    const struct z_loaned_sample_t *this_);
+z_result_t z_view_string_from_substr(struct z_view_string_t *this_,
+                                     const char *str,
+                                     size_t len);
 /**
- * Returns sample qos congestion control value.
+ * @return ``true`` if view string is valid, ``false`` if it is in a gravestone state.
  */
-ZENOHC_API
-enum z_congestion_control_t z_sample_congestion_control(const struct z_loaned_sample_t *this_);
+ZENOHC_API bool z_view_string_is_empty(const struct z_view_string_t *this_);
 /**
- * Frees the memory and invalidates the sample, resetting it to a gravestone state.
+ * Borrows view string.
  */
-ZENOHC_API void z_sample_drop(struct z_moved_sample_t *this_);
+ZENOHC_API const struct z_loaned_string_t *z_view_string_loan(const struct z_view_string_t *this_);
 /**
- * Returns the encoding associated with the sample data.
+ * Constructs a non-owned non-null-terminated string from the kind of zenoh entity.
+ *
+ * The string has static storage (i.e. valid until the end of the program).
+ * @param whatami: A whatami bitmask of zenoh entity kind.
+ * @param str_out: An uninitialized memory location where strring will be constructed.
+ *
+ * @return 0 if successful, negative error values if whatami contains an invalid bitmask.
  */
 ZENOHC_API
-const struct z_loaned_encoding_t *z_sample_encoding(const struct z_loaned_sample_t *this_);
+z_result_t z_whatami_to_view_string(enum z_whatami_t whatami,
+                                    struct z_view_string_t *str_out);
 /**
- * Returns whether sample qos express flag was set or not.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Make allocation performing garbage collection and/or defragmentation in async manner, posting the result
+ * to `queue`. Will return Z_EINVAL if used with non-threadsafe SHM Provider.
+ *
+ * @param layout: The layout to allocate with.
+ * @param queue: The queue the result is posted to.
+ * @param user_data: An arbitrary pointer, returned together with the result.
  */
-ZENOHC_API bool z_sample_express(const struct z_loaned_sample_t *this_);
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+z_result_t zc_alloc_layout_threadsafe_alloc_gc_defrag_async_to_queue(const struct z_loaned_alloc_layout_t *layout,
+                                                                     const struct zc_loaned_shm_completion_queue_t *queue,
+                                                                     void *user_data);
+#endif
 /**
- * Returns the key expression of the sample.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns the heap allocation counters of the process.
+ *
+ * The allocations of the library, from all its threads, and those of `z_malloc()` and `z_realloc()` are counted,
+ * so that the allocations performed by an operation are the difference between the counters read before and after
+ * it, provided no other thread allocates meanwhile. Available when zenoh-c is built with the `alloc-stats` feature,
+ * which replaces the global allocator of the library with a counting one.
  */
-ZENOHC_API const struct z_loaned_keyexpr_t *z_sample_keyexpr(const struct z_loaned_sample_t *this_);
+#if defined(Z_FEATURE_ALLOC_STATS)
+ZENOHC_API
+void zc_alloc_stats_get(struct zc_alloc_stats_t *stats);
+#endif
 /**
- * Returns the sample kind.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs payload by copying data into a buffer acquired from the pool.
+ *
+ * The buffer returns to the pool once the last shallow copy of the payload is dropped. The resulting
+ * payload can be published directly or appended to a writer with `z_bytes_writer_append()`.
+ *
+ * @param this_: The bytes pool.
+ * @param dst: An uninitialized memory location where the payload is to be constructed.
+ * @param data: A pointer to the data to copy.
+ * @param len: Length of the data, it should not exceed the pool size class.
+ * @return 0 in case of success, negative error code otherwise.
  */
-ZENOHC_API enum z_sample_kind_t z_sample_kind(const struct z_loaned_sample_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t zc_bytes_pool_acquire(const struct zc_loaned_bytes_pool_t *this_,
+                                 struct z_owned_bytes_t *dst,
+                                 const uint8_t *data,
+                                 size_t len);
+#endif
 /**
- * Borrows sample.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Acquires a raw buffer of `zc_bytes_pool_size_class()` bytes from the pool.
+ *
+ * The buffer is meant to be filled in place and then passed to `z_bytes_from_buf()` together with
+ * `zc_bytes_pool_release_buf` as deleter and `context` as its context, so that the buffer returns
+ * to the pool once the resulting payload is dropped:
+ * @code{.c}
+ * uint8_t *buf;
+ * void *context;
+ * zc_bytes_pool_acquire_buf(z_loan(pool), &buf, &context);
+ * size_t len = fill_payload(buf, zc_bytes_pool_size_class(z_loan(pool)));
+ * z_bytes_from_buf(&payload, buf, len, zc_bytes_pool_release_buf, context);
+ * @endcode
+ * If the buffer ends up not being used, it must be returned with `zc_bytes_pool_release_buf(buf, context)`.
+ *
+ * @param this_: The bytes pool.
+ * @param buf: A memory location where the pointer to the acquired buffer will be written.
+ * @param context: A memory location where the context to pass to `zc_bytes_pool_release_buf()` will be written.
+ * @return 0 in case of success, negative error code otherwise.
  */
-ZENOHC_API const struct z_loaned_sample_t *z_sample_loan(const struct z_owned_sample_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t zc_bytes_pool_acquire_buf(const struct zc_loaned_bytes_pool_t *this_,
+                                     uint8_t **buf,
+                                     void **context);
+#endif
 /**
- * Mutably borrows sample.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Drops the pool and resets it to its gravestone state.
+ *
+ * Buffers currently held by payloads stay valid and are freed once these payloads are dropped.
  */
-ZENOHC_API struct z_loaned_sample_t *z_sample_loan_mut(struct z_owned_sample_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+void zc_bytes_pool_drop(struct zc_moved_bytes_pool_t *this_);
+#endif
 /**
- * Returns the sample payload data.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Borrows bytes pool.
  */
-ZENOHC_API const struct z_loaned_bytes_t *z_sample_payload(const struct z_loaned_sample_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+const struct zc_loaned_bytes_pool_t *zc_bytes_pool_loan(const struct zc_owned_bytes_pool_t *this_);
+#endif
 /**
- * Returns the mutable sample payload data.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs a pool of reusable payload buffers.
+ *
+ * The pool pre-allocates `count` buffers of `size_class` bytes each. Payloads constructed from the pool
+ * return their buffer to it once the last reference to them is dropped, so that publishing at high rate
+ * does not need to allocate and free a backing buffer for every message.
+ * If all pre-allocated buffers are in use, a new one is allocated on demand; it is freed instead of being
+ * kept when released to a pool that already holds `count` free buffers.
+ *
+ * @param this_: An uninitialized memory location where the pool is to be constructed.
+ * @param size_class: Capacity in bytes of each buffer of the pool.
+ * @param count: Number of buffers to pre-allocate.
+ * @return 0 in case of success, negative error code otherwise.
  */
-ZENOHC_API struct z_loaned_bytes_t *z_sample_payload_mut(struct z_loaned_sample_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t zc_bytes_pool_new(struct zc_owned_bytes_pool_t *this_,
+                             size_t size_class,
+                             size_t count);
+#endif
 /**
- * Returns sample qos priority value.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns a buffer obtained with `zc_bytes_pool_acquire_buf()` to its pool.
+ *
+ * Has a signature of the deleter accepted by `z_bytes_from_buf()`.
  */
-ZENOHC_API enum z_priority_t z_sample_priority(const struct z_loaned_sample_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+void zc_bytes_pool_release_buf(void *data,
+                               void *context);
+#endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Returns the reliability setting the sample was delivered with.
+ * @brief Returns the capacity in bytes of each buffer of the pool.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-enum z_reliability_t z_sample_reliability(const struct z_loaned_sample_t *this_);
+size_t zc_bytes_pool_size_class(const struct zc_loaned_bytes_pool_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Returns the sample source_info.
+ * @brief Constructs a data writer with empty payload, whose buffers for in-place writes are acquired from a pool.
+ *
+ * Each call to `z_bytes_writer_reserve()` which does not fit into the current buffer acquires a new buffer from
+ * the pool, unless more than `zc_bytes_pool_size_class()` bytes are reserved. Buffers return to the pool once the
+ * last reference to the finished payload is dropped.
+ *
+ * @param this_: An uninitialized memory location where writer is to be constructed.
+ * @param pool: The pool to acquire buffers from.
+ * @return 0 in case of success, negative error code otherwise.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-const struct z_loaned_source_info_t *z_sample_source_info(const struct z_loaned_sample_t *this_);
+z_result_t zc_bytes_writer_from_pool(struct z_owned_bytes_writer_t *this_,
+                                     const struct zc_loaned_bytes_pool_t *pool);
 #endif
 /**
- * Returns the sample timestamp.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Linux: Trigger cleanup for orphaned SHM segments
+ * If process that created named SHM segment crashes or exits by a signal, the segment persists in the system
+ * disregarding if it is used by other Zenoh processes or not. This is the detail of POSIX specification for
+ * shared memory that is hard to bypass. To deal with this we developed a cleanup routine that enumerates all
+ * segments and tries to find processes that are using it. If no such process found, segment will be removed.
+ * There is no ideal signal to trigger this cleanup, so by default, zenoh triggers it in the following moments:
+ * - first POSIX SHM segment creation
+ * - process exit via exit() call or return from maint function
+ * It is OK to additionally trigger this function at any time, but be aware that this can be costly.
  *
- * Will return `NULL`, if sample is not associated with a timestamp.
+ * For non-linux platforms this function currently does nothing
  */
-ZENOHC_API const struct z_timestamp_t *z_sample_timestamp(const struct z_loaned_sample_t *this_);
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+void zc_cleanup_orphaned_shm_segments(void);
+#endif
 /**
- * Scout for routers and/or peers.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Measures the rate of the CPU counter read by `zc_clock_tsc_read()` against the monotonic clock.
  *
- * @param config: A set of properties to configure scouting session.
- * @param callback: A closure that will be called on each hello message received from discoverd Zenoh entities.
- * @param options: A set of scouting options
+ * The calibration blocks the calling thread for `duration_ms`; a longer calibration gives a more accurate rate. The first
+ * successful calibration of the process is also used by `zc_timestamp_new_fast()`.
  *
- * @return 0 if successful, negative error values upon failure.
+ * @param this_: An uninitialized memory location where the calibration will be written.
+ * @param duration_ms: The duration of the measurement in milliseconds, 0 for 10 ms.
+ * @return 0 in case of success, `Z_EUNAVAILABLE` if the platform has no CPU counter ticking at a constant rate.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t z_scout(struct z_moved_config_t *config,
-                   struct z_moved_closure_hello_t *callback,
-                   const struct z_scout_options_t *options);
+z_result_t zc_clock_tsc_calibrate(struct zc_clock_tsc_calibration_t *this_,
+                                  uint32_t duration_ms);
+#endif
 /**
- * Constructs the default values for the scouting operation.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs closure.
+ *
+ * Closures are not guaranteed not to be called concurrently.
+ *
+ * It is guaranteed that:
+ *   - `call` will never be called once `drop` has started.
+ *   - `drop` will only be called **once**, and **after every** `call` has ended.
+ *   - The two previous guarantees imply that `call` and `drop` are never called concurrently.
+ * @param this_: uninitialized memory location where new closure will be constructed.
+ * @param call: a closure body.
+ * @param drop: an optional function to be called once on closure drop.
+ * @param context: closure context.
  */
-ZENOHC_API void z_scout_options_default(struct z_scout_options_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+void zc_closure_indexed_reply(struct zc_owned_closure_indexed_reply_t *this_,
+                              void (*call)(size_t index, struct z_loaned_reply_t *reply, void *context),
+                              void (*drop)(void *context),
+                              void *context);
+#endif
 /**
- * Closes and invalidates the session.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Calls the closure. Calling an uninitialized closure is a no-op.
  */
-ZENOHC_API void z_session_drop(struct z_moved_session_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+void zc_closure_indexed_reply_call(const struct zc_loaned_closure_indexed_reply_t *closure,
+                                   size_t index,
+                                   struct z_loaned_reply_t *reply);
+#endif
 /**
- * Checks if zenoh session is closed.
- *
- * @return `true` if session is closed, `false` otherwise.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Drops the closure, resetting it to its gravestone state. Droping an uninitialized closure is a no-op.
  */
-ZENOHC_API bool z_session_is_closed(const struct z_loaned_session_t *session);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+void zc_closure_indexed_reply_drop(struct zc_moved_closure_indexed_reply_t *closure_);
+#endif
 /**
- * Borrows session.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Borrows closure.
  */
-ZENOHC_API const struct z_loaned_session_t *z_session_loan(const struct z_owned_session_t *this_);
-ZENOHC_API struct z_loaned_session_t *z_session_loan_mut(struct z_owned_session_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+const struct zc_loaned_closure_indexed_reply_t *zc_closure_indexed_reply_loan(const struct zc_owned_closure_indexed_reply_t *closure);
+#endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Deletes SHM Client.
+ * @brief Constructs closure.
+ *
+ * Closures are not guaranteed not to be called concurrently.
+ *
+ * It is guaranteed that:
+ *   - `call` will never be called once `drop` has started.
+ *   - `drop` will only be called **once**, and **after every** `call` has ended.
+ *   - The two previous guarantees imply that `call` and `drop` are never called concurrently.
+ * @param this_: uninitialized memory location where new closure will be constructed.
+ * @param call: a closure body.
+ * @param drop: an optional function to be called once on closure drop.
+ * @param context: closure context.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_shm_client_drop(struct z_moved_shm_client_t *this_);
+void zc_closure_liveliness_changes(struct zc_owned_closure_liveliness_changes_t *this_,
+                                   void (*call)(const struct zc_liveliness_changes_t *changes, void *context),
+                                   void (*drop)(void *context),
+                                   void *context);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Creates a new SHM Client.
+ * @brief Calls the closure. Calling an uninitialized closure is a no-op.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_shm_client_new(struct z_owned_shm_client_t *this_,
-                      struct zc_threadsafe_context_t context,
-                      struct zc_shm_client_callbacks_t callbacks);
+void zc_closure_liveliness_changes_call(const struct zc_loaned_closure_liveliness_changes_t *closure,
+                                        const struct zc_liveliness_changes_t *changes);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Performs a shallow copy of SHM Client Storage.
+ * @brief Drops the closure, resetting it to its gravestone state. Droping an uninitialized closure is a no-op.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_shm_client_storage_clone(struct z_owned_shm_client_storage_t *this_,
-                                const struct z_loaned_shm_client_storage_t *from);
+void zc_closure_liveliness_changes_drop(struct zc_moved_closure_liveliness_changes_t *closure_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Derefs SHM Client Storage.
+ * @brief Borrows closure.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+const struct zc_loaned_closure_liveliness_changes_t *zc_closure_liveliness_changes_loan(const struct zc_owned_closure_liveliness_changes_t *closure);
+#endif
+/**
+ * @brief Constructs closure.
+ *
+ * Closures are not guaranteed not to be called concurrently.
+ *
+ * It is guaranteed that:
+ *   - `call` will never be called once `drop` has started.
+ *   - `drop` will only be called **once**, and **after every** `call` has ended.
+ *   - The two previous guarantees imply that `call` and `drop` are never called concurrently.
+ * @param this_: uninitialized memory location where new closure will be constructed.
+ * @param call: a closure body.
+ * @param drop: an optional function to be called once on closure drop.
+ * @param context: closure context.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-void z_shm_client_storage_drop(struct z_moved_shm_client_storage_t *this_);
-#endif
+void zc_closure_log(struct zc_owned_closure_log_t *this_,
+                    void (*call)(enum zc_log_severity_t severity,
+                                 const struct z_loaned_string_t *msg,
+                                 void *context),
+                    void (*drop)(void *context),
+                    void *context);
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Borrows SHM Client Storage.
+ * Calls the closure. Calling an uninitialized closure is a no-op.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-const struct z_loaned_shm_client_storage_t *z_shm_client_storage_loan(const struct z_owned_shm_client_storage_t *this_);
-#endif
+void zc_closure_log_call(const struct zc_loaned_closure_log_t *closure,
+                         enum zc_log_severity_t severity,
+                         const struct z_loaned_string_t *msg);
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Create a new client storage object.
+ * Drops the closure. Droping an uninitialized closure is a no-op.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
-ZENOHC_API
-z_result_t z_shm_client_storage_new(struct z_owned_shm_client_storage_t *this_,
-                                    const struct zc_loaned_shm_client_list_t *clients,
-                                    bool add_default_client_set);
-#endif
+ZENOHC_API void zc_closure_log_drop(struct zc_moved_closure_log_t *closure_);
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Construct client storage with default client set.
+ * Borrows closure.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-void z_shm_client_storage_new_default(struct z_owned_shm_client_storage_t *this_);
-#endif
+const struct zc_loaned_closure_log_t *zc_closure_log_loan(const struct zc_owned_closure_log_t *closure);
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Converts borrowed ZShm slice to owned ZShm slice by performing a shallow SHM reference copy.
+ *
+ * Closures are not guaranteed not to be called concurrently.
+ *
+ * It is guaranteed that:
+ *   - `call` will never be called once `drop` has started.
+ *   - `drop` will only be called **once**, and **after every** `call` has ended.
+ *   - The two previous guarantees imply that `call` and `drop` are never called concurrently.
+ * @brief Constructs closure.
+ * @param this_: uninitialized memory location where new closure will be constructed.
+ * @param call: a closure body.
+ * @param drop: an optional function to be called once on closure drop.
+ * @param context: closure context.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_shm_clone(struct z_owned_shm_t *out,
-                 const struct z_loaned_shm_t *this_);
+void zc_closure_matching_status(struct zc_owned_closure_matching_status_t *this_,
+                                void (*call)(const struct zc_matching_status_t *matching_status,
+                                             void *context),
+                                void (*drop)(void *context),
+                                void *context);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @return the pointer of the ZShm slice.
+ * @brief Calls the closure. Calling an uninitialized closure is a no-op.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-const unsigned char *z_shm_data(const struct z_loaned_shm_t *this_);
+void zc_closure_matching_status_call(const struct zc_loaned_closure_matching_status_t *closure,
+                                     const struct zc_matching_status_t *mathing_status);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Deletes ZShm slice.
+ * @brief Drops the closure, resetting it to its gravestone state. Droping an uninitialized closure is a no-op.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_shm_drop(struct z_moved_shm_t *this_);
+void zc_closure_matching_status_drop(struct zc_moved_closure_matching_status_t *closure_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Constructs ZShm slice from ZShmMut slice.
+ * @brief Borrows closure.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_shm_from_mut(struct z_owned_shm_t *this_,
-                    struct z_moved_shm_mut_t *that);
+const struct zc_loaned_closure_matching_status_t *zc_closure_matching_status_loan(const struct zc_owned_closure_matching_status_t *closure);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @return the length of the ZShm slice.
+ * @brief Constructs closure.
+ *
+ * Closures are not guaranteed not to be called concurrently.
+ *
+ * It is guaranteed that:
+ *   - `call` will never be called once `drop` has started.
+ *   - `drop` will only be called **once**, and **after every** `call` has ended.
+ *   - The two previous guarantees imply that `call` and `drop` are never called concurrently.
+ * @param this_: uninitialized memory location where new closure will be constructed.
+ * @param call: a closure body.
+ * @param drop: an optional function to be called once on closure drop.
+ * @param context: closure context.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-size_t z_shm_len(const struct z_loaned_shm_t *this_);
+void zc_closure_span(struct zc_owned_closure_span_t *this_,
+                     void (*call)(const struct zc_span_t *span, void *context),
+                     void (*drop)(void *context),
+                     void *context);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Borrows ZShm slice.
+ * @brief Calls the closure. Calling an uninitialized closure is a no-op.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-const struct z_loaned_shm_t *z_shm_loan(const struct z_owned_shm_t *this_);
+void zc_closure_span_call(const struct zc_loaned_closure_span_t *closure,
+                          const struct zc_span_t *span);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Mutably borrows ZShm slice.
+ * @brief Drops the closure, resetting it to its gravestone state. Droping an uninitialized closure is a no-op.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-struct z_loaned_shm_t *z_shm_loan_mut(struct z_owned_shm_t *this_);
+void zc_closure_span_drop(struct zc_moved_closure_span_t *closure_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @return the immutable pointer to the underlying data.
+ * @brief Borrows closure.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-const unsigned char *z_shm_mut_data(const struct z_loaned_shm_mut_t *this_);
+const struct zc_loaned_closure_span_t *zc_closure_span_loan(const struct zc_owned_closure_span_t *closure);
 #endif
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @return the mutable pointer to the underlying data.
+ * @brief Drops the close handle. The concurrent close task will not be interrupted.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
-ZENOHC_API
-unsigned char *z_shm_mut_data_mut(struct z_loaned_shm_mut_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API void zc_concurrent_close_handle_drop(struct zc_moved_concurrent_close_handle_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Deletes ZShmMut slice.
+ * @brief Returns the number of subscribers and queryables of the closed session which are not undeclared yet.
+ *
+ * Closing a session undeclares all its entities; this count goes down to 0 as their callbacks are dropped,
+ * unless some of them are kept alive by the application, e.g. by an ongoing callback.
+ * The count remains available after the session is dropped, until the close completes.
+ * Returns 0 if the handle is in its gravestone state.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_shm_mut_drop(struct z_moved_shm_mut_t *this_);
+size_t zc_concurrent_close_handle_pending_entities(const struct zc_owned_concurrent_close_handle_t *handle);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @return the length of the ZShmMut slice.
+ * @brief Checks whether the close has completed, without blocking.
+ *
+ * Once the close has completed, the handle is reset to its gravestone state.
+ *
+ * @return `Z_CHANNEL_NODATA` if the close is still in progress, 0 if it completed successfully, `Z_EIO` if it
+ * completed with an error, `Z_EINVAL` if the handle is in its gravestone state.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-size_t z_shm_mut_len(const struct z_loaned_shm_mut_t *this_);
+z_result_t zc_concurrent_close_handle_try_wait(struct zc_owned_concurrent_close_handle_t *handle);
 #endif
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Borrows ZShmMut slice.
+ * @brief Blocking wait on close handle to complete. Returns `Z_EIO` if close finishes with error.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-const struct z_loaned_shm_mut_t *z_shm_mut_loan(const struct z_owned_shm_mut_t *this_);
+z_result_t zc_concurrent_close_handle_wait(struct zc_moved_concurrent_close_handle_t *handle);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Mutably borrows ZShmMut slice.
+ * @brief Constructs a configuration from a blob produced by `zc_config_to_blob()`.
+ *
+ * @param this_: An uninitialized memory location where the configuration will be constructed.
+ * @param data: A pointer to the blob.
+ * @param len: The length of the blob.
+ * @return 0 in case of success, `Z_EINVAL` if the blob was not produced by this version of zenoh-c, `Z_EPARSE` if it is
+ * corrupted.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-struct z_loaned_shm_mut_t *z_shm_mut_loan_mut(struct z_owned_shm_mut_t *this_);
+z_result_t zc_config_from_blob(struct z_owned_config_t *this_,
+                               const uint8_t *data,
+                               size_t len);
 #endif
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Tries to obtain mutable SHM buffer instead of immutable one.
- * @param this_: mutable SHM buffer to be initialized upon success
- * @param that: immutable SHM buffer
- * @param immut: immutable SHM buffer returned back to caller's side
- * ONLY in case of Z_EUNAVAILABLE failure
- * @return Z_OK in case of success, Z_EUNAVAILABLE in case of unsuccessful write access,
- * Z_EINVAL if moved value is incorrect.
+ * Constructs a configuration by parsing a file path stored in ZENOH_CONFIG environmental variable.
+ *
+ * Returns 0 in case of success, negative error code otherwise.
+ */
+ZENOHC_API z_result_t zc_config_from_env(struct z_owned_config_t *this_);
+/**
+ * Constructs a configuration by parsing a file at `path`. Currently supported format is JSON5, a superset of JSON.
+ *
+ * Returns 0 in case of success, negative error code otherwise.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-z_result_t z_shm_mut_try_from_immut(struct z_owned_shm_mut_t *this_,
-                                    struct z_moved_shm_t *that,
-                                    struct z_owned_shm_t *immut);
-#endif
+z_result_t zc_config_from_file(struct z_owned_config_t *this_,
+                               const char *path);
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Make allocation without any additional actions.
+ * Reads a configuration from a JSON-serialized string, such as '{mode:"client",connect:{endpoints:["tcp/127.0.0.1:7447"]}}'.
+ *
+ * Returns 0 in case of success, negative error code otherwise.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-void z_shm_provider_alloc(struct z_buf_layout_alloc_result_t *out_result,
-                          const struct z_loaned_shm_provider_t *provider,
-                          size_t size,
-                          struct z_alloc_alignment_t alignment);
-#endif
+z_result_t zc_config_from_str(struct z_owned_config_t *this_,
+                              const char *s);
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Make allocation performing garbage collection if needed.
+ * Gets the property with the given path key from the configuration, and constructs and owned string from it.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-void z_shm_provider_alloc_gc(struct z_buf_layout_alloc_result_t *out_result,
-                             const struct z_loaned_shm_provider_t *provider,
-                             size_t size,
-                             struct z_alloc_alignment_t alignment);
-#endif
+z_result_t zc_config_get_from_str(const struct z_loaned_config_t *this_,
+                                  const char *key,
+                                  struct z_owned_string_t *out_value_string);
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Make allocation performing garbage collection and/or defragmentation if needed.
+ * Gets the property with the given path key from the configuration, and constructs and owned string from it.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-void z_shm_provider_alloc_gc_defrag(struct z_buf_layout_alloc_result_t *out_result,
-                                    const struct z_loaned_shm_provider_t *provider,
-                                    size_t size,
-                                    struct z_alloc_alignment_t alignment);
-#endif
+z_result_t zc_config_get_from_substr(const struct z_loaned_config_t *this_,
+                                     const char *key,
+                                     size_t key_len,
+                                     struct z_owned_string_t *out_value_string);
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Make allocation performing garbage collection and/or defragmentation in async manner. Will return Z_EINVAL
- * if used with non-threadsafe SHM Provider.
+ * @brief Adds the locators of the routers saved by `z_scout()` in `z_scout_options_t::locator_cache_path` to the
+ * endpoints the session connects to.
+ *
+ * This allows a session to connect immediately to the last known routers, instead of waiting for scouting to find
+ * them. The cached locators are placed before the endpoints already configured.
+ *
+ * @param this_: The configuration, whose `connect/endpoints` must be a list.
+ * @param path: The path of the cache.
+ * @return 0 in case of success, `Z_EUNAVAILABLE` if there is no cache or it is empty, negative error code otherwise.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t z_shm_provider_alloc_gc_defrag_async(struct z_buf_layout_alloc_result_t *out_result,
-                                                const struct z_loaned_shm_provider_t *provider,
-                                                size_t size,
-                                                struct z_alloc_alignment_t alignment,
-                                                struct zc_threadsafe_context_t result_context,
-                                                void (*result_callback)(void*,
-                                                                        struct z_buf_layout_alloc_result_t*));
+z_result_t zc_config_insert_cached_locators(struct z_loaned_config_t *this_,
+                                            const char *path);
 #endif
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Make allocation performing garbage collection and/or defragmentation and/or blocking if needed.
+ * Inserts a JSON-serialized `value` at the `key` position of the configuration.
+ *
+ * Returns 0 if successful, a negative error code otherwise.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-void z_shm_provider_alloc_gc_defrag_blocking(struct z_buf_layout_alloc_result_t *out_result,
-                                             const struct z_loaned_shm_provider_t *provider,
-                                             size_t size,
-                                             struct z_alloc_alignment_t alignment);
-#endif
+z_result_t zc_config_insert_json5(struct z_loaned_config_t *this_,
+                                  const char *key,
+                                  const char *value);
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Make allocation performing garbage collection and/or defragmentation and/or forced deallocation if needed.
+ * Inserts a JSON-serialized `value` at the `key` position of the configuration.
+ *
+ * Returns 0 if successful, a negative error code otherwise.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-void z_shm_provider_alloc_gc_defrag_dealloc(struct z_buf_layout_alloc_result_t *out_result,
-                                            const struct z_loaned_shm_provider_t *provider,
-                                            size_t size,
-                                            struct z_alloc_alignment_t alignment);
-#endif
+z_result_t zc_config_insert_json5_from_substr(struct z_loaned_config_t *this_,
+                                              const char *key,
+                                              size_t key_len,
+                                              const char *value,
+                                              size_t value_len);
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Return the memory size available in the provider.
+ * @brief Serializes a configuration into a binary blob, which can be loaded back with `zc_config_from_blob()`.
+ *
+ * The blob holds the configuration as compact JSON, which is parsed much faster than JSON5. It is meant to be
+ * produced once, e.g. when deploying an application, and loaded by each of its short-lived processes instead of
+ * parsing a JSON5 configuration. A blob can only be loaded by the version of zenoh-c which produced it.
+ *
+ * @param this_: The configuration.
+ * @param blob: An uninitialized memory location where the blob will be constructed.
+ * @return 0 in case of success, negative error code otherwise.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-size_t z_shm_provider_available(const struct z_loaned_shm_provider_t *provider);
+z_result_t zc_config_to_blob(const struct z_loaned_config_t *this_,
+                             struct z_owned_slice_t *blob);
 #endif
 /**
- * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Perform memory defragmentation. The real operations taken depend on the provider's backend allocator
- * implementation.
+ * Constructs a json string representation of the `config`, such as '{"mode":"client","connect":{"endpoints":["tcp/127.0.0.1:7447"]}}'.
+ *
+ * Returns 0 in case of success, negative error code otherwise.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-size_t z_shm_provider_defragment(const struct z_loaned_shm_provider_t *provider);
-#endif
+z_result_t zc_config_to_string(const struct z_loaned_config_t *config,
+                               struct z_owned_string_t *out_config_string);
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Deletes SHM Provider.
+ * @brief Constructs and declares several publishers at once.
+ *
+ * This is a convenience loop over `z_declare_publisher()`: the publishers are declared one by one, sending the same
+ * declaration messages, so neither the number of messages nor the number of round trips is reduced. The function
+ * returns once all publishers are declared.
+ *
+ * @param session: The Zenoh session.
+ * @param publishers: An array of `len` uninitialized locations in memory where the publishers will be constructed.
+ * @param key_exprs: An array of `len` key expressions to publish.
+ * @param len: The number of publishers.
+ * @param options: Additional options applied to all publishers. The encoding is shared by all publishers.
+ *
+ * @return 0 in case of success, negative error code otherwise. In this case, the publishers which were already
+ * declared are undeclared, and all publishers are in their gravestone state.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_shm_provider_drop(struct z_moved_shm_provider_t *this_);
+z_result_t zc_declare_publishers(const struct z_loaned_session_t *session,
+                                 struct z_owned_publisher_t *publishers,
+                                 const struct z_loaned_keyexpr_t *const *key_exprs,
+                                 size_t len,
+                                 struct z_publisher_options_t *options);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Perform memory garbage collection and reclaim all dereferenced SHM buffers.
+ * @brief Constructs and declares several subscribers at once, delivering the samples of all of them to a single
+ * callback.
+ *
+ * This is a convenience loop over `z_declare_subscriber()`: the subscribers are declared one by one, sending the same
+ * declaration messages, so neither the number of messages nor the number of round trips is reduced. The function
+ * returns once all subscribers are declared. The callback is dropped once all subscribers are undeclared. The key
+ * expression of a sample tells which subscriber received it.
+ *
+ * @param session: The zenoh session.
+ * @param subscribers: An array of `len` uninitialized locations in memory, where the subscribers will be constructed.
+ * @param key_exprs: An array of `len` key expressions to subscribe.
+ * @param len: The number of subscribers.
+ * @param callback: The callback function that will be called each time a sample is received by any of the subscribers.
+ * @param options: The options applied to all subscribers.
+ *
+ * @return 0 in case of success, negative error code otherwise. In this case, the subscribers which were already
+ * declared are undeclared, and all subscribers are in their gravestone state.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-size_t z_shm_provider_garbage_collect(const struct z_loaned_shm_provider_t *provider);
+z_result_t zc_declare_subscribers(const struct z_loaned_session_t *session,
+                                  struct z_owned_subscriber_t *subscribers,
+                                  const struct z_loaned_keyexpr_t *const *key_exprs,
+                                  size_t len,
+                                  struct z_moved_closure_sample_t *callback,
+                                  struct z_subscriber_options_t *options);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Borrows SHM Provider.
+ * @brief Looks up the interned copy of an encoding, without interning it.
+ *
+ * The lookup does not allocate, so that it can be done for every received sample to switch on the id of its encoding:
+ * @code{.c}
+ * const zc_interned_encoding_t *e;
+ * if (zc_encoding_find_interned(z_sample_encoding(sample), &e) == Z_OK && e->id == my_message_encoding->id) {
+ *     ...
+ * }
+ * @endcode
+ *
+ * @param encoding: The encoding to look up.
+ * @param interned: A memory location where the pointer to the interned encoding will be written.
+ * @return 0 if the encoding is interned, `Z_EUNAVAILABLE` otherwise.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-const struct z_loaned_shm_provider_t *z_shm_provider_loan(const struct z_owned_shm_provider_t *this_);
+z_result_t zc_encoding_find_interned(const struct z_loaned_encoding_t *encoding,
+                                     const struct zc_interned_encoding_t **interned);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Map the preallocated data chunk into SHM buffer.
+ * @brief Returns the interned copy of an encoding, interning it if it is not interned yet.
+ *
+ * Interning an encoding once, e.g. at startup, and passing it to `z_publisher_put_options_t::interned_encoding`
+ * avoids constructing or cloning an owned encoding for each message. Entries are never removed, so interning is meant
+ * to be used with a bounded set of encodings.
+ *
+ * @param encoding: The encoding to intern. It is copied if it was not interned yet.
+ * @param interned: A memory location where the pointer to the interned encoding will be written.
+ * @return 0 in case of success, negative error code otherwise.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t z_shm_provider_map(struct z_owned_shm_mut_t *out_result,
-                              const struct z_loaned_shm_provider_t *provider,
-                              struct z_allocated_chunk_t allocated_chunk,
-                              size_t len);
+z_result_t zc_encoding_intern(const struct z_loaned_encoding_t *encoding,
+                              const struct zc_interned_encoding_t **interned);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Creates a new SHM Provider.
+ * @brief Returns the interned copy of the encoding represented by a null-terminated string, interning it if it is
+ * not interned yet.
+ *
+ * @param s: The string representation of the encoding, e.g. `"application/protobuf;my.Message"`.
+ * @param interned: A memory location where the pointer to the interned encoding will be written.
+ * @return 0 in case of success, negative error code otherwise.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_shm_provider_new(struct z_owned_shm_provider_t *this_,
-                        z_protocol_id_t id,
-                        struct zc_context_t context,
-                        struct zc_shm_provider_backend_callbacks_t callbacks);
+z_result_t zc_encoding_intern_from_str(const char *s,
+                                       const struct zc_interned_encoding_t **interned);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Creates a new threadsafe SHM Provider.
+ * @brief Query data for several selectors at once, delivering all replies to a single callback.
+ *
+ * The queries are sent one after the other, without waiting for replies, so that they are pipelined by the transport.
+ * Each reply is passed to `callback` together with the index of the query it answers. The callback is dropped
+ * once all replies to all queries have been processed, which can be used as a completion signal.
+ *
+ * @param session: The zenoh session.
+ * @param key_exprs: An array of `len` key expressions to query.
+ * @param parameters: An optional array of `len` query parameters, each of them being possibly `NULL`.
+ * @param len: The number of queries.
+ * @param callback: The callback function that will be called on reception of replies for the queries.
+ * @param options: Additional options applied to all queries. All owned fields will be consumed, the payload,
+ * encoding, source info and attachment are shared by all queries.
+ *
+ * @return 0 in case of success, a negative error value upon failure. If a query fails to be sent, the following
+ * ones are not sent, while replies to the preceding ones are still delivered.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_shm_provider_threadsafe_new(struct z_owned_shm_provider_t *this_,
-                                   z_protocol_id_t id,
-                                   struct zc_threadsafe_context_t context,
-                                   struct zc_shm_provider_backend_callbacks_t callbacks);
+z_result_t zc_get_many(const struct z_loaned_session_t *session,
+                       const struct z_loaned_keyexpr_t *const *key_exprs,
+                       const char *const *parameters,
+                       size_t len,
+                       struct zc_moved_closure_indexed_reply_t *callback,
+                       struct z_get_options_t *options);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Mutably borrows ZShm slice as borrowed ZShmMut slice.
+ * @brief Appends copies of the locators of Zenoh entity that sent hello message to a string arena.
+ *
+ * Unlike `z_hello_locators()`, no memory is allocated per locator, and the same arena can collect the locators of
+ * all hello messages received while scouting.
+ *
+ * @return the new length of the arena.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-struct z_loaned_shm_mut_t *z_shm_try_mut(struct z_owned_shm_t *this_);
+size_t zc_hello_locators_push(const struct z_loaned_hello_t *this_,
+                              struct zc_loaned_string_arena_t *locators);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Tries to reborrow mutably-borrowed ZShm slice as borrowed ZShmMut slice.
- * @return borrowed ZShmMut slice in case of success, NULL otherwise.
+ * @brief Starts timing the callbacks of all subscribers and queryables, reporting the ones taking `threshold_ns`
+ * or longer to `callback`.
+ *
+ * Each slow callback is reported with a span of kind `ZC_SPAN_KIND_SAMPLE_CALLBACK` or `ZC_SPAN_KIND_QUERY_CALLBACK`,
+ * synchronously from the thread which called it, so `callback` should return quickly. While the watchdog is enabled,
+ * the durations of the callbacks of each entity are recorded, see `zc_subscriber_get_callback_histogram()`.
+ *
+ * If `isolation_queue_size` is not 0, a subscriber whose callback was reported is switched to a dedicated delivery
+ * thread, so that it no longer stalls the zenoh runtime threads shared with the other entities of the session.
+ * Samples are passed to this thread through a queue of `isolation_queue_size` samples, and are dropped when the
+ * queue is full. The closure of an isolated subscriber is dropped by its delivery thread, once the samples queued
+ * before its undeclaration are delivered.
+ *
+ * A previously set callback is replaced, and dropped once its last call has returned.
+ *
+ * @param threshold_ns: The duration from which a callback is reported, in nanoseconds.
+ * @param isolation_queue_size: The capacity of the queue of isolated subscribers, 0 to never isolate subscribers.
+ * @param callback: The closure receiving the slow callbacks.
+ * @return 0 in case of success, `Z_EINVAL` if `threshold_ns` is 0.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-struct z_loaned_shm_mut_t *z_shm_try_reloan_mut(struct z_loaned_shm_t *this_);
+z_result_t zc_init_callback_watchdog(uint64_t threshold_ns,
+                                     size_t isolation_queue_size,
+                                     struct zc_moved_closure_span_t *callback);
 #endif
 /**
- * Puts current thread to sleep for specified amount of milliseconds.
- */
-ZENOHC_API z_result_t z_sleep_ms(size_t time);
-/**
- * Puts current thread to sleep for specified amount of seconds.
- */
-ZENOHC_API z_result_t z_sleep_s(size_t time);
-/**
- * Puts current thread to sleep for specified amount of microseconds.
- */
-ZENOHC_API z_result_t z_sleep_us(size_t time);
-/**
- * Constructs an owned copy of a slice.
- */
-ZENOHC_API void z_slice_clone(struct z_owned_slice_t *dst, const struct z_loaned_slice_t *this_);
-/**
- * Constructs a slice by copying a `len` bytes long sequence starting at `start`.
+ * Initializes the zenoh runtime logger, using rust environment settings or the provided fallback level.
+ * E.g.: `RUST_LOG=info` will enable logging at info level. Similarly, you can set the variable to `error` or `debug`.
  *
- * @return -1 if `start == NULL` and `len > 0` (creating an empty slice), 0 otherwise.
+ * Note that if the environment variable is not set, then fallback filter will be used instead.
+ * See https://docs.rs/env_logger/latest/env_logger/index.html for accepted filter format.
+ *
+ * @param fallback_filter: The fallback filter if the `RUST_LOG` environment variable is not set.
  */
 ZENOHC_API
-z_result_t z_slice_copy_from_buf(struct z_owned_slice_t *this_,
-                                 const uint8_t *start,
-                                 size_t len);
-/**
- * @return the pointer to the slice data.
- */
-ZENOHC_API const uint8_t *z_slice_data(const struct z_loaned_slice_t *this_);
-/**
- * Frees the memory and invalidates the slice.
- */
-ZENOHC_API void z_slice_drop(struct z_moved_slice_t *this_);
+z_result_t zc_init_log_from_env_or(const char *fallback_filter);
 /**
- * Constructs an empty `z_owned_slice_t`.
+ * Initializes the zenoh runtime logger with custom callback.
+ *
+ * @param min_severity: Minimum severity level of log message to be be passed to the `callback`.
+ * Messages with lower severity levels will be ignored.
+ * @param callback: A closure that will be called with each log message severity level and content.
  */
-ZENOHC_API void z_slice_empty(struct z_owned_slice_t *this_);
+ZENOHC_API
+void zc_init_log_with_callback(enum zc_log_severity_t min_severity,
+                               struct zc_moved_closure_log_t *callback);
 /**
- * Constructs a slice by transferring ownership of `data` to it.
- * @param this_: Pointer to an uninitialized memoery location where slice will be constructed.
- * @param data: Pointer to the data to be owned by `this_`.
- * @param len: Number of bytes in `data`.
- * @param drop: A thread-safe delete function to free the `data`. Will be called once when `this_` is dropped. Can be NULL, in case if `data` is allocated in static memory.
- * @param context: An optional context to be passed to the `deleter`.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Configures the thread pools of the zenoh runtime, which are shared by all sessions of the process.
  *
- * @return -1 if `start == NULL` and `len > 0` (creating an empty slice), 0 otherwise.
+ * This function must be called before opening the first session, and at most once.
+ *
+ * The thread counts are passed to the runtime through the `ZENOH_RUNTIME` environment variable, which takes precedence
+ * over them if it is already set. The pools with a CPU affinity or a nice value are started immediately, from a thread
+ * with these settings which their threads inherit. Threads started later to run blocking operations inherit the
+ * settings of the thread starting them, which is most often a thread of the same pool.
+ *
+ * @param options: The settings of the pools.
+ * @return 0 in case of success, `Z_EUNAVAILABLE` if the runtime is already configured or in use, or if the CPU affinity
+ * or nice value are not supported on this platform, `Z_EINVAL` if they could not be applied.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t z_slice_from_buf(struct z_owned_slice_t *this_,
-                            uint8_t *data,
-                            size_t len,
-                            void (*drop)(void *data, void *context),
-                            void *context);
+z_result_t zc_init_runtime(const struct zc_runtime_options_t *options);
+#endif
 /**
- * @return ``true`` if slice is empty, ``false`` otherwise.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Starts delivering the timing spans of one in `sample_interval` messages to `callback`.
+ *
+ * Spans are reported for the puts of publishers and the callbacks of subscribers and queryables, the messages being
+ * sampled independently on each thread. Their fields are numeric, so that no formatting takes place on the sampled
+ * path, and they are delivered synchronously from the thread which handled the message, so `callback` should return
+ * quickly. A previously set callback is replaced, and dropped once its last call has returned.
+ *
+ * @param sample_interval: The number of messages per sampled message, 1 reports a span for every message.
+ * @param callback: The closure receiving the spans.
+ * @return 0 in case of success, `Z_EINVAL` if `sample_interval` is 0.
  */
-ZENOHC_API bool z_slice_is_empty(const struct z_loaned_slice_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t zc_init_spans_with_callback(uint32_t sample_interval,
+                                       struct zc_moved_closure_span_t *callback);
+#endif
 /**
- * @return the length of the slice.
+ * @brief Counts an allocation of `size` bytes by `z_malloc()` or `z_realloc()`.
  */
-ZENOHC_API size_t z_slice_len(const struct z_loaned_slice_t *this_);
+#if defined(Z_FEATURE_ALLOC_STATS)
+ZENOHC_API
+void zc_internal_alloc_stats_count_alloc(size_t size);
+#endif
 /**
- * Borrows slice.
+ * @brief Counts a deallocation by `z_free()`.
  */
-ZENOHC_API const struct z_loaned_slice_t *z_slice_loan(const struct z_owned_slice_t *this_);
+#if defined(Z_FEATURE_ALLOC_STATS)
+ZENOHC_API
+void zc_internal_alloc_stats_count_free(void);
+#endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Frees the memory and invalidates the source info, resetting it to a gravestone state.
+ * @brief Returns ``true`` if `this_` is in a valid state, ``false`` if it is in a gravestone state.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_source_info_drop(struct z_moved_source_info_t *this_);
+bool zc_internal_bytes_pool_check(const struct zc_owned_bytes_pool_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Returns the source_id of the source info.
+ * @brief Constructs bytes pool in its gravestone state.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-struct z_entity_global_id_t z_source_info_id(const struct z_loaned_source_info_t *this_);
+void zc_internal_bytes_pool_null(struct zc_owned_bytes_pool_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Borrows source info.
+ * @brief Returns ``true`` if closure is valid, ``false`` if it is in gravestone state.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-const struct z_loaned_source_info_t *z_source_info_loan(const struct z_owned_source_info_t *this_);
+bool zc_internal_closure_indexed_reply_check(const struct zc_owned_closure_indexed_reply_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Creates source info.
+ * @brief Constructs a closure in its gravestone state.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t z_source_info_new(struct z_owned_source_info_t *this_,
-                             const struct z_entity_global_id_t *source_id,
-                             uint32_t source_sn);
+void zc_internal_closure_indexed_reply_null(struct zc_owned_closure_indexed_reply_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Returns the source_sn of the source info.
+ * @brief Returns ``true`` if closure is valid, ``false`` if it is in gravestone state.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-uint32_t z_source_info_sn(const struct z_loaned_source_info_t *this_);
+bool zc_internal_closure_liveliness_changes_check(const struct zc_owned_closure_liveliness_changes_t *this_);
 #endif
 /**
- * Constructs an owned copy of a string array.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs a closure in its gravestone state.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void z_string_array_clone(struct z_owned_string_array_t *dst,
-                          const struct z_loaned_string_array_t *this_);
+void zc_internal_closure_liveliness_changes_null(struct zc_owned_closure_liveliness_changes_t *this_);
+#endif
 /**
- * Destroys the string array, resetting it to its gravestone value.
+ * Returns ``true`` if closure is valid, ``false`` if it is in gravestone state.
  */
-ZENOHC_API void z_string_array_drop(struct z_moved_string_array_t *this_);
+ZENOHC_API bool zc_internal_closure_log_check(const struct zc_owned_closure_log_t *this_);
 /**
- * @return the value at the position of index in the string array.
- *
- * Will return `NULL` if the index is out of bounds.
+ * Constructs a closure in a gravestone state.
  */
-ZENOHC_API
-const struct z_loaned_string_t *z_string_array_get(const struct z_loaned_string_array_t *this_,
-                                                   size_t index);
+ZENOHC_API void zc_internal_closure_log_null(struct zc_owned_closure_log_t *this_);
 /**
- * @return ``true`` if the array is empty, ``false`` otherwise.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns ``true`` if closure is valid, ``false`` if it is in gravestone state.
  */
-ZENOHC_API bool z_string_array_is_empty(const struct z_loaned_string_array_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+bool zc_internal_closure_matching_status_check(const struct zc_owned_closure_matching_status_t *this_);
+#endif
 /**
- * @return number of elements in the array.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs a null value of 'zc_owned_closure_matching_status_t' type
  */
-ZENOHC_API size_t z_string_array_len(const struct z_loaned_string_array_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+void zc_internal_closure_matching_status_null(struct zc_owned_closure_matching_status_t *this_);
+#endif
 /**
- * Borrows string array.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns ``true`` if closure is valid, ``false`` if it is in gravestone state.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-const struct z_loaned_string_array_t *z_string_array_loan(const struct z_owned_string_array_t *this_);
+bool zc_internal_closure_span_check(const struct zc_owned_closure_span_t *this_);
+#endif
 /**
- * Mutably borrows string array.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs a closure in its gravestone state.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-struct z_loaned_string_array_t *z_string_array_loan_mut(struct z_owned_string_array_t *this_);
+void zc_internal_closure_span_null(struct zc_owned_closure_span_t *this_);
+#endif
 /**
- * Constructs a new empty string array.
+ * @brief Returns ``true`` if concurrent close handle is valid, ``false`` if it is in gravestone state.
  */
-ZENOHC_API void z_string_array_new(struct z_owned_string_array_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+bool zc_internal_concurrent_close_handle_check(const struct zc_owned_concurrent_close_handle_t *this_);
+#endif
 /**
- * Appends specified value to the end of the string array by alias.
- *
- * @return the new length of the array.
+ * @brief Constructs concurrent close handle in its gravestone state.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-size_t z_string_array_push_by_alias(struct z_loaned_string_array_t *this_,
-                                    const struct z_loaned_string_t *value);
+void zc_internal_concurrent_close_handle_null(struct zc_owned_concurrent_close_handle_t *this_);
+#endif
 /**
- * Appends specified value to the end of the string array by copying.
- *
- * @return the new length of the array.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns ``true`` if `this_` is in a valid state, ``false`` if it is in a gravestone state.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-size_t z_string_array_push_by_copy(struct z_loaned_string_array_t *this_,
-                                   const struct z_loaned_string_t *value);
-ZENOHC_API const struct z_loaned_slice_t *z_string_as_slice(const struct z_loaned_string_t *this_);
+bool zc_internal_keyexpr_interner_check(const struct zc_owned_keyexpr_interner_t *this_);
+#endif
 /**
- * Constructs an owned copy of a string.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs key expression interning table in its gravestone state.
  */
-ZENOHC_API void z_string_clone(struct z_owned_string_t *dst, const struct z_loaned_string_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+void zc_internal_keyexpr_interner_null(struct zc_owned_keyexpr_interner_t *this_);
+#endif
 /**
- * Constructs an owned string by copying `str` into it (including terminating 0), using `strlen` (this should therefore not be used with untrusted inputs).
- *
- * @return -1 if `str == NULL` (and creates a string in a gravestone state), 0 otherwise.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns ``true`` if `this_` is in a valid state, ``false`` if it is in a gravestone state.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t z_string_copy_from_str(struct z_owned_string_t *this_,
-                                  const char *str);
+bool zc_internal_keyexpr_matcher_check(const struct zc_owned_keyexpr_matcher_t *this_);
+#endif
 /**
- * Constructs an owned string by copying a `str` substring of length `len`.
- *
- * @return -1 if `str == NULL` and `len > 0` (and creates a string in a gravestone state), 0 otherwise.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs matcher in its gravestone state.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t z_string_copy_from_substr(struct z_owned_string_t *this_,
-                                     const char *str,
-                                     size_t len);
+void zc_internal_keyexpr_matcher_null(struct zc_owned_keyexpr_matcher_t *this_);
+#endif
 /**
- * @return the pointer of the string data.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Checks the matching listener is for the gravestone state
  */
-ZENOHC_API const char *z_string_data(const struct z_loaned_string_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+bool zc_internal_matching_listener_check(const struct zc_owned_matching_listener_t *this_);
+#endif
 /**
- * Frees memory and invalidates `z_owned_string_t`, putting it in gravestone state.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs an empty matching listener.
  */
-ZENOHC_API void z_string_drop(struct z_moved_string_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+void zc_internal_matching_listener_null(struct zc_owned_matching_listener_t *this_);
+#endif
 /**
- * Constructs an empty owned string.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @return Returns ``true`` if `this` is valid.
  */
-ZENOHC_API void z_string_empty(struct z_owned_string_t *this_);
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+bool zc_internal_shm_client_cache_check(const struct zc_owned_shm_client_cache_t *this_);
+#endif
 /**
- * Constructs an owned string by transferring ownership of a null-terminated string `str` to it.
- * @param this_: Pointer to an uninitialized memory location where an owned string will be constructed.
- * @param str: Pointer to a null terminated string to be owned by `this_`.
- * @param drop: A thread-safe delete function to free the `str`. Will be called once when `str` is dropped. Can be NULL, in case if `str` is allocated in static memory.
- * @param context: An optional context to be passed to the `deleter`.
- * @return -1 if `str == NULL` and `len > 0` (and creates a string in a gravestone state), 0 otherwise.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs SHM Client cache in its gravestone value.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-z_result_t z_string_from_str(struct z_owned_string_t *this_,
-                             char *str,
-                             void (*drop)(void *value, void *context),
-                             void *context);
+void zc_internal_shm_client_cache_null(struct zc_owned_shm_client_cache_t *this_);
+#endif
 /**
- * @return ``true`` if string is empty, ``false`` otherwise.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns ``true`` if `this` is valid.
  */
-ZENOHC_API bool z_string_is_empty(const struct z_loaned_string_t *this_);
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+bool zc_internal_shm_client_list_check(const struct zc_owned_shm_client_list_t *this_);
+#endif
 /**
- * @return the length of the string (without terminating 0 character).
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs SHM client list in its gravestone value.
  */
-ZENOHC_API size_t z_string_len(const struct z_loaned_string_t *this_);
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+void zc_internal_shm_client_list_null(struct zc_owned_shm_client_list_t *this_);
+#endif
 /**
- * Borrows string.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns ``true`` if `this_` is in a valid state, ``false`` if it is in a gravestone state.
  */
-ZENOHC_API const struct z_loaned_string_t *z_string_loan(const struct z_owned_string_t *this_);
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+bool zc_internal_shm_completion_queue_check(const struct zc_owned_shm_completion_queue_t *this_);
+#endif
 /**
- * Undeclares subscriber callback and resets it to its gravestone state.
- * This is equivalent to calling `z_undeclare_subscriber()` and discarding its return value.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs completion queue in its gravestone state.
  */
-ZENOHC_API void z_subscriber_drop(struct z_moved_subscriber_t *this_);
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+void zc_internal_shm_completion_queue_null(struct zc_owned_shm_completion_queue_t *this_);
+#endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Returns the ID of the subscriber.
+ * @return ``true`` if the string arena is valid, ``false`` if it is in a gravestone state.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-struct z_entity_global_id_t z_subscriber_id(const struct z_loaned_subscriber_t *subscriber);
+bool zc_internal_string_arena_check(const struct zc_owned_string_arena_t *this_);
 #endif
 /**
- * Returns the key expression of the subscriber.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs string arena in its gravestone state.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-const struct z_loaned_keyexpr_t *z_subscriber_keyexpr(const struct z_loaned_subscriber_t *subscriber);
+void zc_internal_string_arena_null(struct zc_owned_string_arena_t *this_);
+#endif
 /**
- * Borrows subscriber.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Frees memory and resets key expression interning table to its gravestone state.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-const struct z_loaned_subscriber_t *z_subscriber_loan(const struct z_owned_subscriber_t *this_);
-/**
- * Constructs the default value for `z_subscriber_options_t`.
- */
-ZENOHC_API void z_subscriber_options_default(struct z_subscriber_options_t *this_);
+void zc_keyexpr_interner_drop(struct zc_moved_keyexpr_interner_t *this_);
+#endif
 /**
- * Detaches the task and releases all allocated resources.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns the id of a key expression, without adding it to the table.
+ *
+ * @param this_: The key expression interning table.
+ * @param key_expr: The key expression to look up.
+ * @param id: A memory location where the id of the key expression will be written.
+ * @return 0 in case of success, `Z_EUNAVAILABLE` if the key expression is not interned.
  */
-ZENOHC_API void z_task_detach(struct z_moved_task_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t zc_keyexpr_interner_find(const struct zc_loaned_keyexpr_interner_t *this_,
+                                    const struct z_loaned_keyexpr_t *key_expr,
+                                    uint32_t *id);
+#endif
 /**
- * Drop the task. Same as `z_task_detach`. Use `z_task_join` to wait for the task completion.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs a copy of the key expression interned with the given id.
+ *
+ * @param this_: The key expression interning table.
+ * @param id: The id of the key expression.
+ * @param dst: An uninitialized memory location where the key expression is to be constructed.
+ * @return 0 in case of success, `Z_EINVAL` if no key expression was interned with this id.
  */
-ZENOHC_API void z_task_drop(struct z_moved_task_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t zc_keyexpr_interner_get(const struct zc_loaned_keyexpr_interner_t *this_,
+                                   uint32_t id,
+                                   struct z_owned_keyexpr_t *dst);
+#endif
 /**
- * Constructs a new task.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns the id of a key expression, adding it to the table if it is not interned yet.
  *
- * @param this_: An uninitialized memory location where task will be constructed.
- * @param _attr: Attributes of the task (currently unused).
- * @param fun: Function to be executed by the task.
- * @param arg: Argument that will be passed to the function `fun`.
+ * Looking up an already interned key expression only takes a shared lock, so that it can be done for every
+ * received sample:
+ * @code{.c}
+ * uint32_t id;
+ * zc_keyexpr_interner_intern(z_loan(interner), z_sample_keyexpr(sample), &id);
+ * struct state *s = &states[id];
+ * @endcode
+ *
+ * @param this_: The key expression interning table.
+ * @param key_expr: The key expression to intern. It is copied into the table if it was not interned yet.
+ * @param id: A memory location where the id of the key expression will be written.
+ * @return 0 in case of success, negative error code otherwise.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t z_task_init(struct z_owned_task_t *this_,
-                       const struct z_task_attr_t *_attr,
-                       void *(*fun)(void *arg),
-                       void *arg);
+z_result_t zc_keyexpr_interner_intern(const struct zc_loaned_keyexpr_interner_t *this_,
+                                      const struct z_loaned_keyexpr_t *key_expr,
+                                      uint32_t *id);
+#endif
 /**
- * Joins the task and releases all allocated resources
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns the number of key expressions interned in the table.
  */
-ZENOHC_API z_result_t z_task_join(struct z_moved_task_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+size_t zc_keyexpr_interner_len(const struct zc_loaned_keyexpr_interner_t *this_);
+#endif
 /**
- * Get number of milliseconds passed since creation of `time`.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Borrows key expression interning table.
  */
-ZENOHC_API uint64_t z_time_elapsed_ms(const struct z_time_t *time);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+const struct zc_loaned_keyexpr_interner_t *zc_keyexpr_interner_loan(const struct zc_owned_keyexpr_interner_t *this_);
+#endif
 /**
- * Get number of seconds passed since creation of `time`.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs an empty key expression interning table.
+ *
+ * The table assigns to each distinct key expression a small integer id, starting from 0 and incremented
+ * by one for each new key expression, so that per-key state can be stored in an array indexed by the id,
+ * instead of in a hash table keyed by the key expression string. Ids are never reused, since entries are
+ * never removed from the table; it is thus meant to be used with a bounded set of key expressions, typically
+ * one table per session.
+ *
+ * The table can be accessed concurrently from several threads, e.g. from subscriber callbacks.
+ *
+ * @param this_: An uninitialized memory location where the table is to be constructed.
+ * @return 0 in case of success, negative error code otherwise.
  */
-ZENOHC_API uint64_t z_time_elapsed_s(const struct z_time_t *time);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t zc_keyexpr_interner_new(struct zc_owned_keyexpr_interner_t *this_);
+#endif
 /**
- * Get number of microseconds passed since creation of `time`.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Frees memory and resets matcher to its gravestone state.
  */
-ZENOHC_API uint64_t z_time_elapsed_us(const struct z_time_t *time);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+void zc_keyexpr_matcher_drop(struct zc_moved_keyexpr_matcher_t *this_);
+#endif
 /**
- * Initialize clock with current time instant.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Finds all key expressions of the matcher that include `key_expr`.
+ *
+ * @param this_: The matcher.
+ * @param key_expr: The key expression to match.
+ * @param callback: A function called with the index of each including key expression, in no particular order.
+ * @param context: An optional context to be passed to `callback`.
+ * @return The number of including key expressions.
  */
-ZENOHC_API struct z_time_t z_time_now(void);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+size_t zc_keyexpr_matcher_includes(const struct zc_loaned_keyexpr_matcher_t *this_,
+                                   const struct z_loaned_keyexpr_t *key_expr,
+                                   void (*callback)(size_t index, void *context),
+                                   void *context);
+#endif
 /**
- * Converts current system time into null-terminated human readable string and writes it to the `buf`.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Finds all key expressions of the matcher that intersect with `key_expr`.
  *
- * @param buf: A buffer where the string will be writtent
- * @param len: Maximum number of characters to write (including terminating 0). The string will be truncated
- * if it is longer than `len`.
+ * @param this_: The matcher.
+ * @param key_expr: The key expression to match.
+ * @param callback: A function called with the index of each intersecting key expression, in no particular order.
+ * @param context: An optional context to be passed to `callback`.
+ * @return The number of intersecting key expressions.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-const char *z_time_now_as_str(const char *buf,
-                              size_t len);
+size_t zc_keyexpr_matcher_intersects(const struct zc_loaned_keyexpr_matcher_t *this_,
+                                     const struct z_loaned_keyexpr_t *key_expr,
+                                     void (*callback)(size_t index, void *context),
+                                     void *context);
+#endif
 /**
- * @brief Returns id associated with this timestamp.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns the number of key expressions of the matcher.
  */
-ZENOHC_API struct z_id_t z_timestamp_id(const struct z_timestamp_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+size_t zc_keyexpr_matcher_len(const struct zc_loaned_keyexpr_matcher_t *this_);
+#endif
 /**
- * Create uhlc timestamp from session id.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Borrows matcher.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t z_timestamp_new(struct z_timestamp_t *this_,
-                           const struct z_loaned_session_t *session);
+const struct zc_loaned_keyexpr_matcher_t *zc_keyexpr_matcher_loan(const struct zc_owned_keyexpr_matcher_t *this_);
+#endif
 /**
- * Returns NPT64 time associated with this timestamp.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs a matcher from a set of key expressions.
+ *
+ * The matcher organizes the key expressions in a tree of chunks, so that finding the ones matching a given key expression
+ * only requires to check those sharing its non-wild prefix, instead of all of them.
+ *
+ * @param this_: An uninitialized memory location where the matcher is to be constructed.
+ * @param keyexprs: A pointer to an array of `len` key expressions. They are copied into the matcher.
+ * Each key expression is then identified by its index in this array.
+ * @param len: Number of key expressions.
+ * @return 0 in case of success, negative error code otherwise.
  */
-ZENOHC_API uint64_t z_timestamp_ntp64_time(const struct z_timestamp_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t zc_keyexpr_matcher_new(struct zc_owned_keyexpr_matcher_t *this_,
+                                  const struct z_loaned_keyexpr_t *const *keyexprs,
+                                  size_t len);
+#endif
 /**
- * Undeclares the key expression generated by a call to `z_declare_keyexpr()`.
- * The key expression is consumed.
- * @return 0 in case of success, negative error code otherwise.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Declares a background subscriber on liveliness tokens that intersect `key_expr`. Subscriber callback will be called to process the messages,
+ * until the corresponding session is closed or dropped.
+ * @param session: The Zenoh session.
+ * @param key_expr: The key expression to subscribe to.
+ * @param callback: The callback function that will be called each time a liveliness token status is changed.
+ * @param options: The options to be passed to the liveliness subscriber declaration.
+ *
+ * @return 0 in case of success, negative error values otherwise.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t z_undeclare_keyexpr(const struct z_loaned_session_t *session,
-                               struct z_moved_keyexpr_t *key_expr);
+z_result_t zc_liveliness_declare_background_subscriber(const struct z_loaned_session_t *session,
+                                                       const struct z_loaned_keyexpr_t *key_expr,
+                                                       struct z_moved_closure_sample_t *callback,
+                                                       struct z_liveliness_subscriber_options_t *options);
+#endif
 /**
- * @brief Undeclares the given publisher.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Declares a subscriber on liveliness tokens that intersect `key_expr`, receiving the alive tokens as a single
+ * snapshot and then batches of joined and left tokens.
  *
- * @return 0 in case of success, negative error code otherwise.
+ * Unlike `z_liveliness_declare_subscriber()` with `history`, which calls the sample callback once per alive token,
+ * the callback is first called once with all alive tokens, packed in a single buffer. The snapshot is built from a
+ * liveliness query and the changes received while it is running, and delivered once the query is complete.
+ *
+ * The callback is then called with the tokens which joined or left since the previous call. Changes received while
+ * the callback runs are batched for its next call, so that bursts of declarations and undeclarations result in few
+ * calls. A batch only holds the last state of each token: a token may be reported as left without having been reported
+ * as joined, or as joined while it was already alive, so batches should be applied as insertions and removals in a set.
+ *
+ * @param session: A Zenoh session.
+ * @param subscriber: An uninitialized memory location where subscriber will be constructed.
+ * @param key_expr: The key expression to subscribe to.
+ * @param callback: The callback function that will be called with the changes of the liveliness tokens.
+ * @param options: The options to be passed to the liveliness subscriber declaration.
+ *
+ * @return 0 in case of success, negative error values otherwise.
  */
-ZENOHC_API z_result_t z_undeclare_publisher(struct z_moved_publisher_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t zc_liveliness_declare_snapshot_subscriber(const struct z_loaned_session_t *session,
+                                                     struct z_owned_subscriber_t *subscriber,
+                                                     const struct z_loaned_keyexpr_t *key_expr,
+                                                     struct zc_moved_closure_liveliness_changes_t *callback,
+                                                     struct zc_liveliness_snapshot_subscriber_options_t *options);
+#endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Undeclares the given querier.
+ * @brief Constructs and declares several liveliness tokens at once.
  *
- * @return 0 in case of success, negative error code otherwise.
+ * This is a convenience loop over `z_liveliness_declare_token()`: the tokens are declared one by one, sending the same
+ * declaration messages, so neither the number of messages nor the number of round trips is reduced. The function
+ * returns once all tokens are declared.
+ *
+ * @param session: A Zenoh session to declare the liveliness tokens.
+ * @param tokens: An array of `len` uninitialized memory locations where the liveliness tokens will be constructed.
+ * @param key_exprs: An array of `len` keyexprs to declare liveliness tokens for.
+ * @param len: The number of tokens.
+ * @param _options: Liveliness token declaration properties, applied to all tokens.
+ *
+ * @return 0 in case of success, negative error code otherwise. In this case, the tokens which were already declared
+ * are undeclared, and all tokens are in their gravestone state.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t z_undeclare_querier(struct z_moved_querier_t *this_);
+z_result_t zc_liveliness_declare_tokens(const struct z_loaned_session_t *session,
+                                        struct z_owned_liveliness_token_t *tokens,
+                                        const struct z_loaned_keyexpr_t *const *key_exprs,
+                                        size_t len,
+                                        const struct z_liveliness_token_options_t *_options);
 #endif
 /**
- * Undeclares a `z_owned_queryable_t`.
- * Returns 0 in case of success, negative error code otherwise.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs the default value for `zc_liveliness_snapshot_subscriber_options_t`.
  */
-ZENOHC_API z_result_t z_undeclare_queryable(struct z_moved_queryable_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+void zc_liveliness_snapshot_subscriber_options_default(struct zc_liveliness_snapshot_subscriber_options_t *this_);
+#endif
 /**
- * Undeclares the subscriber.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Gets a key expression of a batch of liveliness tokens.
  *
- * @return 0 in case of success, negative error code otherwise.
+ * @param this_: The batch.
+ * @param index: The index of the key expression, less than `this_->len`.
+ * @param key_expr: An uninitialized memory location where the key expression will be constructed. It aliases the
+ * batch, so it must not be used once the callback receiving the batch has returned.
+ * @return 0 in case of success, `Z_EINVAL` if `index` is out of bounds.
  */
-ZENOHC_API z_result_t z_undeclare_subscriber(struct z_moved_subscriber_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t zc_liveliness_tokens_get(const struct zc_liveliness_tokens_t *this_,
+                                    size_t index,
+                                    struct z_view_keyexpr_t *key_expr);
+#endif
 /**
- * Constructs a view key expression in empty state
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns default value of `zc_locality_t`
  */
-ZENOHC_API void z_view_keyexpr_empty(struct z_view_keyexpr_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+enum zc_locality_t zc_locality_default(void);
+#endif
 /**
- * Constructs a `z_view_keyexpr_t` by aliasing a string.
- * @return 0 in case of success, negative error code in case of failure (for example if expr is not a valid key expression or if it is
- * not in canon form.
- * `expr` must outlive the constucted key expression.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Undeclares the given matching listener, droping and invalidating it.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t z_view_keyexpr_from_str(struct z_view_keyexpr_t *this_,
-                                   const char *expr);
+void zc_matching_listener_drop(struct zc_moved_matching_listener_t *this_);
+#endif
 /**
- * Constructs a `z_view_keyexpr_t` by aliasing a string.
- * The string is canonized in-place before being passed to keyexpr, possibly shortening it by modifying `len`.
- * May SEGFAULT if `expr` is NULL or lies in read-only memory (as values initialized with string litterals do).
- * `expr` must outlive the constucted key expression.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs the default value for `zc_posix_shm_provider_options_t`.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-z_result_t z_view_keyexpr_from_str_autocanonize(struct z_view_keyexpr_t *this_,
-                                                char *expr);
+void zc_posix_shm_provider_options_default(struct zc_posix_shm_provider_options_t *this_);
+#endif
 /**
- * Constructs a `z_view_keyexpr_t` by aliasing a string without checking any of `z_view_keyexpr_t`'s assertions:
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Creates a new POSIX SHM Provider, placing the memory of its segment according to `options`.
  *
- *  - `s` MUST be valid UTF8.
- *  - `s` MUST follow the Key Expression specification, i.e.:
- *   - MUST NOT contain `//`, MUST NOT start nor end with `/`, MUST NOT contain any of the characters `?#$`.
- *   - any instance of `**` may only be lead or followed by `/`.
- *   - the key expression must have canon form.
+ * See `zc_posix_shm_provider_options_t` for the available placement policies. Subscribers mapping the segment
+ * share its physical pages, so they benefit from the same placement.
  *
- * `s` must outlive constructed key expression.
+ * @param this_: An uninitialized memory location where the provider is to be constructed.
+ * @param layout: The layout of the provider's segment.
+ * @param options: The placement options of the segment.
+ * @return 0 in case of success, negative error code otherwise.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-void z_view_keyexpr_from_str_unchecked(struct z_view_keyexpr_t *this_,
-                                       const char *s);
+z_result_t zc_posix_shm_provider_with_options_new(struct z_owned_shm_provider_t *this_,
+                                                  const struct z_loaned_memory_layout_t *layout,
+                                                  const struct zc_posix_shm_provider_options_t *options);
+#endif
 /**
- * Constructs a `z_view_keyexpr_t` by aliasing a substring.
- * `expr` must outlive the constucted key expression.
- *
- * @param this_: An uninitialized location in memory where key expression will be constructed.
- * @param expr: A buffer with length >= `len`.
- * @param len: Number of characters from `expr` to consider.
- * @return 0 in case of success, negative error code otherwise.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Creates a new POSIX SHM Provider collecting statistics, readable with `zc_shm_provider_stats()`.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-z_result_t z_view_keyexpr_from_substr(struct z_view_keyexpr_t *this_,
-                                      const char *expr,
-                                      size_t len);
+z_result_t zc_posix_shm_provider_with_stats_new(struct z_owned_shm_provider_t *this_,
+                                                const struct z_loaned_memory_layout_t *layout);
+#endif
 /**
- * Constructs a `z_view_keyexpr_t` by aliasing a substring.
- * May SEGFAULT if `start` is NULL or lies in read-only memory (as values initialized with string litterals do).
- * `expr` must outlive the constucted key expression.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Creates a new POSIX SHM Provider with per-thread allocation caches.
  *
- * @param this_: An uninitialized location in memory where key expression will be constructed
- * @param start: A buffer of with length >= `len`.
- * @param len: Number of characters from `expr` to consider. Will be modified to be equal to canonized key expression length.
- * @return 0 in case of success, negative error code otherwise.
+ * See `zc_shm_provider_threadsafe_with_thread_cache_new()` for details on the caching.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-z_result_t z_view_keyexpr_from_substr_autocanonize(struct z_view_keyexpr_t *this_,
-                                                   char *start,
-                                                   size_t *len);
+z_result_t zc_posix_shm_provider_with_thread_cache_new(struct z_owned_shm_provider_t *this_,
+                                                       const struct z_loaned_memory_layout_t *layout,
+                                                       const struct zc_shm_thread_cache_options_t *options);
+#endif
 /**
- * Constructs a `z_view_keyexpr_t` by aliasing a substring without checking any of `z_view_keyexpr_t`'s assertions:
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Creates a new POSIX SHM Provider handing out fixed-size chunks.
  *
- * - `start` MUST be valid UTF8.
- * - `start` MUST follow the Key Expression specification, i.e.:
- *  - MUST NOT contain ``//``, MUST NOT start nor end with ``/``, MUST NOT contain any of the characters ``?#$``.
- *  - any instance of ``**`` may only be lead or followed by ``/``.
- *  - the key expression must have canon form.
+ * The provider's segment is carved at creation into `count` chunks of `layout`, kept in a free list: allocation and
+ * free are O(1), the provider never needs defragmentation and `z_shm_provider_available()` reports the exact
+ * number of bytes of the free chunks. Any allocation with a size and alignment not exceeding those of `layout` takes
+ * a whole chunk, bigger ones fail.
  *
- * `start` must outlive constructed key expression.
+ * @param this_: An uninitialized memory location where the provider is to be constructed.
+ * @param layout: The layout of the chunks.
+ * @param count: The number of chunks.
+ * @return 0 in case of success, negative error code otherwise.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-void z_view_keyexpr_from_substr_unchecked(struct z_view_keyexpr_t *this_,
-                                          const char *start,
-                                          size_t len);
-/**
- * Returns ``true`` if `keyexpr` is valid, ``false`` if it is in gravestone state.
- */
-ZENOHC_API bool z_view_keyexpr_is_empty(const struct z_view_keyexpr_t *this_);
+z_result_t zc_posix_shm_slab_provider_new(struct z_owned_shm_provider_t *this_,
+                                          const struct z_loaned_memory_layout_t *layout,
+                                          size_t count);
+#endif
 /**
- * Borrows `z_view_keyexpr_t`.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Creates a new POSIX SHM Provider handing out fixed-size chunks, notifying when chunks come back.
+ *
+ * Same as `zc_posix_shm_slab_provider_new()`, but `callbacks` are called each time a chunk released by all its
+ * consumers is returned to the free list, from which the next allocation takes it at once. Chunks released by
+ * consumers are detected when the provider collects garbage: either explicitly with `z_shm_provider_garbage_collect()`,
+ * or by the allocation functions with a GC policy when the slab is empty. A collection only checks the chunks in
+ * use, at most `count` of them.
+ *
+ * @param this_: An uninitialized memory location where the provider is to be constructed.
+ * @param layout: The layout of the chunks.
+ * @param count: The number of chunks.
+ * @param context: A context passed to `callbacks`. It is dropped together with the provider.
+ * @param callbacks: The callbacks notified when chunks are returned.
+ * @return 0 in case of success, negative error code otherwise.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-const struct z_loaned_keyexpr_t *z_view_keyexpr_loan(const struct z_view_keyexpr_t *this_);
-/**
- * Constructs an empty view slice.
- */
-ZENOHC_API void z_view_slice_empty(struct z_view_slice_t *this_);
+z_result_t zc_posix_shm_slab_provider_with_notify_new(struct z_owned_shm_provider_t *this_,
+                                                      const struct z_loaned_memory_layout_t *layout,
+                                                      size_t count,
+                                                      struct zc_threadsafe_context_t context,
+                                                      struct zc_shm_slab_callbacks_t callbacks);
+#endif
 /**
- * Constructs a `len` bytes long view starting at `start`.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs the default value for `zc_priority_channel_options_t`.
  *
- * @return -1 if `start == NULL` and `len > 0` (and creates an empty view slice), 0 otherwise.
+ * Each level queues up to 256 samples, dropping the oldest ones on overflow, and the levels are served in strict
+ * priority order. The weights used in weighted mode halve from 64 for `Z_PRIORITY_REAL_TIME` down to 1 for
+ * `Z_PRIORITY_BACKGROUND`.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t z_view_slice_from_buf(struct z_view_slice_t *this_,
-                                 const uint8_t *start,
-                                 size_t len);
-/**
- * @return ``true`` if the slice is not empty, ``false`` otherwise.
- */
-ZENOHC_API bool z_view_slice_is_empty(const struct z_view_slice_t *this_);
+void zc_priority_channel_options_default(struct zc_priority_channel_options_t *this_);
+#endif
 /**
- * Borrows view slice.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs the default value for `zc_publisher_coalesce_options_t`.
  */
-ZENOHC_API const struct z_loaned_slice_t *z_view_slice_loan(const struct z_view_slice_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+void zc_publisher_coalesce_options_default(struct zc_publisher_coalesce_options_t *this_);
+#endif
 /**
- * Constructs an empty view string.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs the default value for `zc_publisher_compression_options_t`, which disables compression.
  */
-ZENOHC_API void z_view_string_empty(struct z_view_string_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+void zc_publisher_compression_options_default(struct zc_publisher_compression_options_t *this_);
+#endif
 /**
- * Constructs a view string of `str`, using `strlen` (this should therefore not be used with untrusted inputs).
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Declares a matching listener, registering a callback for notifying subscribers matching with a given publisher.
+ * The callback will be run in the background until the corresponding publisher is dropped.
  *
- * @return -1 if `str == NULL` (and creates a string in a gravestone state), 0 otherwise.
+ * @param publisher: A publisher to associate with matching listener.
+ * @param callback: A closure that will be called every time the matching status of the publisher changes (If last subscriber disconnects or when the first subscriber connects).
+ *
+ * @return 0 in case of success, negative error code otherwise.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t z_view_string_from_str(struct z_view_string_t *this_,
-                                  const char *str);
+z_result_t zc_publisher_declare_background_matching_listener(const struct z_loaned_publisher_t *publisher,
+                                                             struct zc_moved_closure_matching_status_t *callback);
+#endif
 /**
- * Constructs a view string to a specified substring of length `len`.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs matching listener, registering a callback for notifying subscribers matching with a given publisher.
  *
- * @return -1 if `str == NULL` and `len > 0` (and creates a string in a gravestone state), 0 otherwise.
+ * @param publisher: A publisher to associate with matching listener.
+ * @param matching_listener: An uninitialized memory location where matching listener will be constructed. The matching listener's callback will be automatically dropped when the publisher is dropped.
+ * @param callback: A closure that will be called every time the matching status of the publisher changes (If last subscriber disconnects or when the first subscriber connects).
+ *
+ * @return 0 in case of success, negative error code otherwise.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t z_view_string_from_substr(struct z_view_string_t *this_,
-                                     const char *str,
-                                     size_t len);
+z_result_t zc_publisher_declare_matching_listener(const struct z_loaned_publisher_t *publisher,
+                                                  struct zc_owned_matching_listener_t *matching_listener,
+                                                  struct zc_moved_closure_matching_status_t *callback);
+#endif
 /**
- * @return ``true`` if view string is valid, ``false`` if it is in a gravestone state.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs the default value for `zc_publisher_delta_options_t`, which disables the delta mode.
  */
-ZENOHC_API bool z_view_string_is_empty(const struct z_view_string_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+void zc_publisher_delta_options_default(struct zc_publisher_delta_options_t *this_);
+#endif
 /**
- * Borrows view string.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Gets publisher matching status - i.e. if there are any subscribers matching its key expression.
+ *
+ * @return 0 in case of success, negative error code otherwise (in this case matching_status is not updated).
  */
-ZENOHC_API const struct z_loaned_string_t *z_view_string_loan(const struct z_view_string_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t zc_publisher_get_matching_status(const struct z_loaned_publisher_t *this_,
+                                            struct zc_matching_status_t *matching_status);
+#endif
 /**
- * Constructs a non-owned non-null-terminated string from the kind of zenoh entity.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Reads the counters of a publisher.
  *
- * The string has static storage (i.e. valid until the end of the program).
- * @param whatami: A whatami bitmask of zenoh entity kind.
- * @param str_out: An uninitialized memory location where strring will be constructed.
+ * Messages kept pending by the coalescing mode are counted when they are put.
  *
- * @return 0 if successful, negative error values if whatami contains an invalid bitmask.
+ * @param this_: The publisher.
+ * @param stats: An uninitialized location in memory where the counters will be written.
+ * @return 0 in case of success, negative error code otherwise.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t z_whatami_to_view_string(enum z_whatami_t whatami,
-                                    struct z_view_string_t *str_out);
+z_result_t zc_publisher_get_stats(const struct z_loaned_publisher_t *this_,
+                                  struct zc_entity_stats_t *stats);
+#endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Linux: Trigger cleanup for orphaned SHM segments
- * If process that created named SHM segment crashes or exits by a signal, the segment persists in the system
- * disregarding if it is used by other Zenoh processes or not. This is the detail of POSIX specification for
- * shared memory that is hard to bypass. To deal with this we developed a cleanup routine that enumerates all
- * segments and tries to find processes that are using it. If no such process found, segment will be removed.
- * There is no ideal signal to trigger this cleanup, so by default, zenoh triggers it in the following moments:
- * - first POSIX SHM segment creation
- * - process exit via exit() call or return from maint function
- * It is OK to additionally trigger this function at any time, but be aware that this can be costly.
+ * @brief Declares a matching listener, registering a callback for notifying queryables matching the given querier key expression and target.
+ * The callback will be run in the background until the corresponding querier is dropped.
  *
- * For non-linux platforms this function currently does nothing
+ * @param querier: A querier to associate with matching listener.
+ * @param callback: A closure that will be called every time the matching status of the querier changes (If last queryable disconnects or when the first queryable connects).
+ *
+ * @return 0 in case of success, negative error code otherwise.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if (defined(Z_FEATURE_UNSTABLE_API) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-void zc_cleanup_orphaned_shm_segments(void);
+z_result_t zc_querier_declare_background_matching_listener(const struct z_loaned_querier_t *querier,
+                                                           struct zc_moved_closure_matching_status_t *callback);
 #endif
 /**
- * @brief Constructs closure.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs matching listener, registering a callback for notifying queryables matching with a given querier's key expression and target.
  *
- * Closures are not guaranteed not to be called concurrently.
+ * @param querier: A querier to associate with matching listener.
+ * @param matching_listener: An uninitialized memory location where matching listener will be constructed. The matching listener's callback will be automatically dropped when the querier is dropped.
+ * @param callback: A closure that will be called every time the matching status of the querier changes (If last queryable disconnects or when the first queryable connects).
  *
- * It is guaranteed that:
- *   - `call` will never be called once `drop` has started.
- *   - `drop` will only be called **once**, and **after every** `call` has ended.
- *   - The two previous guarantees imply that `call` and `drop` are never called concurrently.
- * @param this_: uninitialized memory location where new closure will be constructed.
- * @param call: a closure body.
- * @param drop: an optional function to be called once on closure drop.
- * @param context: closure context.
+ * @return 0 in case of success, negative error code otherwise.
  */
+#if (defined(Z_FEATURE_UNSTABLE_API) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-void zc_closure_log(struct zc_owned_closure_log_t *this_,
-                    void (*call)(enum zc_log_severity_t severity,
-                                 const struct z_loaned_string_t *msg,
-                                 void *context),
-                    void (*drop)(void *context),
-                    void *context);
+z_result_t zc_querier_declare_matching_listener(const struct z_loaned_querier_t *querier,
+                                                struct zc_owned_matching_listener_t *matching_listener,
+                                                struct zc_moved_closure_matching_status_t *callback);
+#endif
 /**
- * Calls the closure. Calling an uninitialized closure is a no-op.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Gets querier matching status - i.e. if there are any queryables matching its key expression and target.
+ *
+ * @return 0 in case of success, negative error code otherwise (in this case matching_status is not updated).
  */
+#if (defined(Z_FEATURE_UNSTABLE_API) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-void zc_closure_log_call(const struct zc_loaned_closure_log_t *closure,
-                         enum zc_log_severity_t severity,
-                         const struct z_loaned_string_t *msg);
-/**
- * Drops the closure. Droping an uninitialized closure is a no-op.
- */
-ZENOHC_API void zc_closure_log_drop(struct zc_moved_closure_log_t *closure_);
+z_result_t zc_querier_get_matching_status(const struct z_loaned_querier_t *this_,
+                                          struct zc_matching_status_t *matching_status);
+#endif
 /**
- * Borrows closure.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Reads the distribution of the durations of the callbacks of a queryable, timed while the watchdog is enabled.
+ *
+ * For a queryable with worker threads, the durations are the times needed to dispatch the queries to the workers.
+ *
+ * @param this_: The queryable.
+ * @param histogram: An uninitialized location in memory where the histogram will be written.
+ * @return 0 in case of success, `Z_EUNAVAILABLE` if the queryable has no counters, negative error code otherwise.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-const struct zc_loaned_closure_log_t *zc_closure_log_loan(const struct zc_owned_closure_log_t *closure);
+z_result_t zc_queryable_get_callback_histogram(const struct z_loaned_queryable_t *this_,
+                                               struct zc_callback_histogram_t *histogram);
+#endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Reads the counters of a queryable.
  *
- * Closures are not guaranteed not to be called concurrently.
+ * Queries are counted before being passed to the queryable callback, or to its worker threads.
  *
- * It is guaranteed that:
- *   - `call` will never be called once `drop` has started.
- *   - `drop` will only be called **once**, and **after every** `call` has ended.
- *   - The two previous guarantees imply that `call` and `drop` are never called concurrently.
- * @brief Constructs closure.
- * @param this_: uninitialized memory location where new closure will be constructed.
- * @param call: a closure body.
- * @param drop: an optional function to be called once on closure drop.
- * @param context: closure context.
+ * @param this_: The queryable.
+ * @param stats: An uninitialized location in memory where the counters will be written.
+ * @return 0 in case of success, `Z_EUNAVAILABLE` if the queryable has no counters, negative error code otherwise.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t zc_queryable_get_stats(const struct z_loaned_queryable_t *this_,
+                                  struct zc_entity_stats_t *stats);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs the default value for `zc_recv_spin_options_t`.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
-ZENOHC_API
-void zc_closure_matching_status(struct zc_owned_closure_matching_status_t *this_,
-                                void (*call)(const struct zc_matching_status_t *matching_status,
-                                             void *context),
-                                void (*drop)(void *context),
-                                void *context);
+ZENOHC_API void zc_recv_spin_options_default(struct zc_recv_spin_options_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Calls the closure. Calling an uninitialized closure is a no-op.
+ * @brief Returns the default value of #zc_reply_keyexpr_t.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void zc_closure_matching_status_call(const struct zc_loaned_closure_matching_status_t *closure,
-                                     const struct zc_matching_status_t *mathing_status);
+enum zc_reply_keyexpr_t zc_reply_keyexpr_default(void);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Drops the closure, resetting it to its gravestone state. Droping an uninitialized closure is a no-op.
+ * @brief Constructs the default value for `zc_runtime_options_t`, which keeps the zenoh defaults for all pools.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void zc_closure_matching_status_drop(struct zc_moved_closure_matching_status_t *closure_);
+void zc_runtime_options_default(struct zc_runtime_options_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Borrows closure.
+ * @brief Starts the thread pools of the zenoh runtime ahead of the first session.
+ *
+ * The pools are otherwise started by the first call to `z_open()`, which then includes their startup. They are shared by
+ * all sessions of the process and kept once a session is closed, so a process opening a session per request only pays
+ * for them once, e.g. when calling this function during its initialization.
+ *
+ * `zc_init_runtime()` must be called before this function to configure the pools.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-const struct zc_loaned_closure_matching_status_t *zc_closure_matching_status_loan(const struct zc_owned_closure_matching_status_t *closure);
+void zc_runtime_warm_up(void);
 #endif
 /**
- * @brief Drops the close handle. The concurrent close task will not be interrupted.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns the compression algorithm of the payload of a sample, according to its encoding.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
-ZENOHC_API void zc_concurrent_close_handle_drop(struct zc_moved_concurrent_close_handle_t *this_);
+ZENOHC_API
+enum zc_compression_t zc_sample_compression(const struct z_loaned_sample_t *this_);
 #endif
 /**
- * @brief Blocking wait on close handle to complete. Returns `Z_EIO` if close finishes with error.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Reads the most frequently used fields of a sample with a single call.
+ *
+ * This is equivalent to calling `z_sample_keyexpr()`, `z_sample_payload()`, `z_sample_encoding()`,
+ * `z_sample_timestamp()`, `z_sample_attachment()`, `z_sample_kind()`, `z_sample_priority()`,
+ * `z_sample_congestion_control()`, `z_sample_express()` and `z_sample_reliability()`, so that callbacks reading
+ * several fields of each sample pay for one call into the library, the fields themselves being plain loads.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t zc_concurrent_close_handle_wait(struct zc_moved_concurrent_close_handle_t *handle);
+void zc_sample_get_fields(const struct z_loaned_sample_t *this_,
+                          struct zc_sample_fields_t *fields);
 #endif
 /**
- * Constructs a configuration by parsing a file path stored in ZENOH_CONFIG environmental variable.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs a view on the decompressed payload of a sample.
  *
- * Returns 0 in case of success, negative error code otherwise.
+ * A compressed payload is decompressed into a buffer of the calling thread, which is reused by the next call, so that
+ * no memory is allocated once it is large enough. The view is then only valid until the next call to this function
+ * from the same thread. A payload that is not compressed is viewed in place if it is contiguous, the view being valid
+ * as long as the sample, or copied into the buffer of the thread otherwise.
+ *
+ * @param this_: The sample.
+ * @param payload: An uninitialized memory location where the view is constructed.
+ * @return 0 in case of success, `Z_EDESERIALIZE` if the payload can not be decompressed, in which case an empty view
+ * is constructed.
  */
-ZENOHC_API z_result_t zc_config_from_env(struct z_owned_config_t *this_);
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t zc_sample_payload_decompressed(const struct z_loaned_sample_t *this_,
+                                          struct z_view_slice_t *payload);
+#endif
 /**
- * Constructs a configuration by parsing a file at `path`. Currently supported format is JSON5, a superset of JSON.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Reads the counters aggregated over all publishers, subscribers and queryables declared through a session.
  *
- * Returns 0 in case of success, negative error code otherwise.
+ * @param this_: The session.
+ * @param stats: An uninitialized location in memory where the counters will be written.
+ * @return 0 in case of success, negative error code otherwise.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t zc_config_from_file(struct z_owned_config_t *this_,
-                               const char *path);
+z_result_t zc_session_get_stats(const struct z_loaned_session_t *this_,
+                                struct zc_session_stats_t *stats);
+#endif
 /**
- * Reads a configuration from a JSON-serialized string, such as '{mode:"client",connect:{endpoints:["tcp/127.0.0.1:7447"]}}'.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Runs the callbacks received by a session opened with `z_open_options_t::deferred_callbacks`, on the calling
+ * thread.
  *
- * Returns 0 in case of success, negative error code otherwise.
+ * Waits up to `timeout_ms` for a sample or a query, then runs the callbacks of all samples and queries received so
+ * far. Callbacks queued while they run are left for the next call, so that a busy session can not hold the calling
+ * thread forever.
+ *
+ * @param this_: The session.
+ * @param timeout_ms: The maximum time to wait for a callback in milliseconds, 0 to return immediately.
+ * @return 0 if callbacks were run, `Z_CHANNEL_NODATA` if none was received before `timeout_ms`, `Z_EUNAVAILABLE` if the
+ * session does not defer its callbacks.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t zc_config_from_str(struct z_owned_config_t *this_,
-                              const char *s);
+z_result_t zc_session_poll(const struct z_loaned_session_t *this_,
+                           uint32_t timeout_ms);
+#endif
 /**
- * Gets the property with the given path key from the configuration, and constructs and owned string from it.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs an SHM Client attaching segments through the cache.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-z_result_t zc_config_get_from_str(const struct z_loaned_config_t *this_,
-                                  const char *key,
-                                  struct z_owned_string_t *out_value_string);
+void zc_shm_client_cache_client(const struct zc_loaned_shm_client_cache_t *this_,
+                                struct z_owned_shm_client_t *client);
+#endif
 /**
- * Gets the property with the given path key from the configuration, and constructs and owned string from it.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Deletes SHM Client cache. The segments are released once the clients attaching through it are dropped.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-z_result_t zc_config_get_from_substr(const struct z_loaned_config_t *this_,
-                                     const char *key,
-                                     size_t key_len,
-                                     struct z_owned_string_t *out_value_string);
+void zc_shm_client_cache_drop(struct zc_moved_shm_client_cache_t *this_);
+#endif
 /**
- * Inserts a JSON-serialized `value` at the `key` position of the configuration.
- *
- * Returns 0 if successful, a negative error code otherwise.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns the statistics of an SHM Client cache.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-z_result_t zc_config_insert_json5(struct z_loaned_config_t *this_,
-                                  const char *key,
-                                  const char *value);
+void zc_shm_client_cache_get_stats(const struct zc_loaned_shm_client_cache_t *this_,
+                                   struct zc_shm_client_cache_stats_t *stats);
+#endif
 /**
- * Inserts a JSON-serialized `value` at the `key` position of the configuration.
- *
- * Returns 0 if successful, a negative error code otherwise.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Borrows SHM Client cache.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-z_result_t zc_config_insert_json5_from_substr(struct z_loaned_config_t *this_,
-                                              const char *key,
-                                              size_t key_len,
-                                              const char *value,
-                                              size_t value_len);
+const struct zc_loaned_shm_client_cache_t *zc_shm_client_cache_loan(const struct zc_owned_shm_client_cache_t *this_);
+#endif
 /**
- * Constructs a json string representation of the `config`, such as '{"mode":"client","connect":{"endpoints":["tcp/127.0.0.1:7447"]}}'.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Creates a cache of the segments attached by an SHM Client.
  *
- * Returns 0 in case of success, negative error code otherwise.
+ * The client returned by `zc_shm_client_cache_client()` is meant to be added to a client list in place of `client`,
+ * e.g. with `zc_shm_client_list_add_client()`, so that its segments are attached through the cache. Segments can
+ * then be mapped ahead of the first buffer received from them with `zc_shm_client_cache_prefetch()`, e.g. once a
+ * peer advertised the segments of its provider out of band.
+ *
+ * Once the cache holds more than `max_segments` segments, it releases the least recently attached one. A segment
+ * is unmapped once neither the cache nor a buffer refers to it, zenoh keeping the segments it attached for as long as
+ * the client storage they were attached from.
+ *
+ * @param this_: An uninitialized memory location where the cache will be constructed.
+ * @param client: The client attaching the segments.
+ * @param max_segments: The maximum number of segments held by the cache, 0 for no limit.
+ * @return 0 in case of success, `Z_EINVAL` if `client` is in its gravestone state.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-z_result_t zc_config_to_string(const struct z_loaned_config_t *config,
-                               struct z_owned_string_t *out_config_string);
+z_result_t zc_shm_client_cache_new(struct zc_owned_shm_client_cache_t *this_,
+                                   struct z_moved_shm_client_t *client,
+                                   size_t max_segments);
+#endif
 /**
- * Initializes the zenoh runtime logger, using rust environment settings or the provided fallback level.
- * E.g.: `RUST_LOG=info` will enable logging at info level. Similarly, you can set the variable to `error` or `debug`.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Maps a segment ahead of the first buffer received from it.
  *
- * Note that if the environment variable is not set, then fallback filter will be used instead.
- * See https://docs.rs/env_logger/latest/env_logger/index.html for accepted filter format.
+ * Does nothing if the segment is already cached.
  *
- * @param fallback_filter: The fallback filter if the `RUST_LOG` environment variable is not set.
+ * @return 0 in case of success, negative error code if the client failed to attach the segment.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-z_result_t zc_init_log_from_env_or(const char *fallback_filter);
+z_result_t zc_shm_client_cache_prefetch(const struct zc_loaned_shm_client_cache_t *this_,
+                                        z_segment_id_t segment_id);
+#endif
 /**
- * Initializes the zenoh runtime logger with custom callback.
- *
- * @param min_severity: Minimum severity level of log message to be be passed to the `callback`.
- * Messages with lower severity levels will be ignored.
- * @param callback: A closure that will be called with each log message severity level and content.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Add client to the list.
  */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-void zc_init_log_with_callback(enum zc_log_severity_t min_severity,
-                               struct zc_moved_closure_log_t *callback);
+z_result_t zc_shm_client_list_add_client(struct zc_loaned_shm_client_list_t *this_,
+                                         z_protocol_id_t id,
+                                         struct z_moved_shm_client_t *client);
+#endif
 /**
- * Returns ``true`` if closure is valid, ``false`` if it is in gravestone state.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Deletes list of SHM Clients.
  */
-ZENOHC_API bool zc_internal_closure_log_check(const struct zc_owned_closure_log_t *this_);
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+void zc_shm_client_list_drop(struct zc_moved_shm_client_list_t *this_);
+#endif
 /**
- * Constructs a closure in a gravestone state.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Borrows list of SHM Clients.
  */
-ZENOHC_API void zc_internal_closure_log_null(struct zc_owned_closure_log_t *this_);
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+const struct zc_loaned_shm_client_list_t *zc_shm_client_list_loan(const struct zc_owned_shm_client_list_t *this_);
+#endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Returns ``true`` if closure is valid, ``false`` if it is in gravestone state.
+ * @brief Mutably borrows list of SHM Clients.
  */
-#if defined(Z_FEATURE_UNSTABLE_API)
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-bool zc_internal_closure_matching_status_check(const struct zc_owned_closure_matching_status_t *this_);
+struct zc_loaned_shm_client_list_t *zc_shm_client_list_loan_mut(struct zc_owned_shm_client_list_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Constructs a null value of 'zc_owned_closure_matching_status_t' type
+ * @brief Creates a new empty list of SHM Clients.
  */
-#if defined(Z_FEATURE_UNSTABLE_API)
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-void zc_internal_closure_matching_status_null(struct zc_owned_closure_matching_status_t *this_);
+void zc_shm_client_list_new(struct zc_owned_shm_client_list_t *this_);
 #endif
 /**
- * @brief Returns ``true`` if concurrent close handle is valid, ``false`` if it is in gravestone state.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Moves up to `max` pending completions, in completion order, to the `out` array, without blocking.
+ *
+ * The file descriptor of the queue stays readable if more completions are pending afterwards.
+ * The buffers of the drained results are owned by the caller.
+ * @return The number of completions written to `out`.
  */
-#if defined(Z_FEATURE_UNSTABLE_API)
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-bool zc_internal_concurrent_close_handle_check(const struct zc_owned_concurrent_close_handle_t *this_);
+size_t zc_shm_completion_queue_drain(const struct zc_loaned_shm_completion_queue_t *this_,
+                                     struct zc_shm_completion_t *out,
+                                     size_t max);
 #endif
 /**
- * @brief Constructs concurrent close handle in its gravestone state.
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Drops completion queue and resets it to its gravestone state.
+ *
+ * Allocations still in progress keep the queue alive until they complete, their results are then dropped.
  */
-#if defined(Z_FEATURE_UNSTABLE_API)
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-void zc_internal_concurrent_close_handle_null(struct zc_owned_concurrent_close_handle_t *this_);
+void zc_shm_completion_queue_drop(struct zc_moved_shm_completion_queue_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Checks the matching listener is for the gravestone state
+ * @brief Returns the file descriptor of the queue, readable while completions are pending, or -1 on platforms
+ * without file descriptors. It is owned by the queue and should not be read or closed by the user.
  */
-#if defined(Z_FEATURE_UNSTABLE_API)
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-bool zc_internal_matching_listener_check(const struct zc_owned_matching_listener_t *this_);
+int zc_shm_completion_queue_fd(const struct zc_loaned_shm_completion_queue_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Constructs an empty matching listener.
+ * @brief Borrows completion queue.
  */
-#if defined(Z_FEATURE_UNSTABLE_API)
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-void zc_internal_matching_listener_null(struct zc_owned_matching_listener_t *this_);
+const struct zc_loaned_shm_completion_queue_t *zc_shm_completion_queue_loan(const struct zc_owned_shm_completion_queue_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Returns ``true`` if `this` is valid.
+ * @brief Constructs a queue receiving the results of asynchronous SHM allocations.
+ *
+ * Results are posted to the queue from the runtime threads, and the queue's file descriptor (see
+ * `zc_shm_completion_queue_fd()`) becomes readable. An event loop polls this descriptor and drains all pending
+ * results in a batch with `zc_shm_completion_queue_drain()`, from its own thread.
+ *
+ * @return 0 in case of success, negative error code if the file descriptor could not be created.
  */
 #if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-bool zc_internal_shm_client_list_check(const struct zc_owned_shm_client_list_t *this_);
+z_result_t zc_shm_completion_queue_new(struct zc_owned_shm_completion_queue_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Constructs SHM client list in its gravestone value.
+ * @brief Make allocation performing garbage collection and/or defragmentation in async manner, posting the result
+ * to `queue`. Will return Z_EINVAL if used with non-threadsafe SHM Provider.
+ *
+ * @param provider: The provider to allocate from.
+ * @param size: The size of the buffer.
+ * @param alignment: The alignment of the buffer.
+ * @param queue: The queue the result is posted to.
+ * @param user_data: An arbitrary pointer, returned together with the result.
  */
 #if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-void zc_internal_shm_client_list_null(struct zc_owned_shm_client_list_t *this_);
+z_result_t zc_shm_provider_alloc_gc_defrag_async_to_queue(const struct z_loaned_shm_provider_t *provider,
+                                                          size_t size,
+                                                          struct z_alloc_alignment_t alignment,
+                                                          const struct zc_loaned_shm_completion_queue_t *queue,
+                                                          void *user_data);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Declares a background subscriber on liveliness tokens that intersect `key_expr`. Subscriber callback will be called to process the messages,
- * until the corresponding session is closed or dropped.
- * @param session: The Zenoh session.
- * @param key_expr: The key expression to subscribe to.
- * @param callback: The callback function that will be called each time a liveliness token status is changed.
- * @param options: The options to be passed to the liveliness subscriber declaration.
+ * @brief Reads the statistics of an SHM Provider created with statistics, such as with
+ * `zc_posix_shm_provider_with_stats_new()`.
  *
- * @return 0 in case of success, negative error values otherwise.
+ * The statistics are read from atomic counters, without locking the allocator, so this is cheap enough to be
+ * called periodically. Counters are read one by one, so they may be slightly inconsistent with each other if
+ * allocations are made concurrently.
+ *
+ * @return 0 in case of success, `Z_EUNAVAILABLE` if the provider does not collect statistics.
  */
-#if defined(Z_FEATURE_UNSTABLE_API)
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
 ZENOHC_API
-z_result_t zc_liveliness_declare_background_subscriber(const struct z_loaned_session_t *session,
-                                                       const struct z_loaned_keyexpr_t *key_expr,
-                                                       struct z_moved_closure_sample_t *callback,
-                                                       struct z_liveliness_subscriber_options_t *options);
+z_result_t zc_shm_provider_stats(const struct z_loaned_shm_provider_t *provider,
+                                 struct zc_shm_provider_stats_t *out_stats);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Returns default value of `zc_locality_t`
+ * @brief Creates a new threadsafe SHM Provider with per-thread allocation caches.
+ *
+ * Allocations up to `options->max_size` are served from per-thread caches of chunks of the backend, so that
+ * threads allocating concurrently from the same provider do not contend on the backend allocator.
+ * The backend then allocates and frees chunks of the cached size classes much less often.
+ * Memory cached by the provider is not accounted as available by `z_shm_provider_available()`,
+ * `z_shm_provider_defragment()` returns it to the backend before defragmenting.
+ */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+void zc_shm_provider_threadsafe_with_thread_cache_new(struct z_owned_shm_provider_t *this_,
+                                                      z_protocol_id_t id,
+                                                      struct zc_threadsafe_context_t context,
+                                                      struct zc_shm_provider_backend_callbacks_t callbacks,
+                                                      const struct zc_shm_thread_cache_options_t *options);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs the default value for `zc_shm_thread_cache_options_t`.
+ */
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+ZENOHC_API
+void zc_shm_thread_cache_options_default(struct zc_shm_thread_cache_options_t *this_);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Stops timing callbacks, dropping the watchdog callback once its last call has returned.
+ *
+ * Subscribers already switched to a delivery thread stay isolated.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-enum zc_locality_t zc_locality_default(void);
+void zc_stop_callback_watchdog(void);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Undeclares the given matching listener, droping and invalidating it.
+ * @brief Stops delivering timing spans, dropping the callback once its last call has returned.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void zc_matching_listener_drop(struct zc_moved_matching_listener_t *this_);
+void zc_stop_spans(void);
 #endif
+/**
+ * Stops all Zenoh tasks and drops all related static variables.
+ * All Zenoh-related structures should be properly dropped/undeclared PRIOR to this call.
+ * None of Zenoh functionality can be used after this call.
+ * Useful to suppress memory leaks messages due to Zenoh static variables (since they are never destroyed due to Rust language design).
+ */
+ZENOHC_API
+void zc_stop_z_runtime(void);
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Declares a matching listener, registering a callback for notifying subscribers matching with a given publisher.
- * The callback will be run in the background until the corresponding publisher is dropped.
- *
- * @param publisher: A publisher to associate with matching listener.
- * @param callback: A closure that will be called every time the matching status of the publisher changes (If last subscriber disconnects or when the first subscriber connects).
- *
- * @return 0 in case of success, negative error code otherwise.
+ * @brief Removes all strings from the string arena, keeping its buffer allocated for reuse.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t zc_publisher_declare_background_matching_listener(const struct z_loaned_publisher_t *publisher,
-                                                             struct zc_moved_closure_matching_status_t *callback);
+void zc_string_arena_clear(struct zc_loaned_string_arena_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Constructs matching listener, registering a callback for notifying subscribers matching with a given publisher.
- *
- * @param publisher: A publisher to associate with matching listener.
- * @param matching_listener: An uninitialized memory location where matching listener will be constructed. The matching listener's callback will be automatically dropped when the publisher is dropped.
- * @param callback: A closure that will be called every time the matching status of the publisher changes (If last subscriber disconnects or when the first subscriber connects).
- *
- * @return 0 in case of success, negative error code otherwise.
+ * @brief Constructs an owned copy of a string arena, in a single buffer.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t zc_publisher_declare_matching_listener(const struct z_loaned_publisher_t *publisher,
-                                                  struct zc_owned_matching_listener_t *matching_listener,
-                                                  struct zc_moved_closure_matching_status_t *callback);
+void zc_string_arena_clone(struct zc_owned_string_arena_t *dst,
+                           const struct zc_loaned_string_arena_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Gets publisher matching status - i.e. if there are any subscribers matching its key expression.
- *
- * @return 0 in case of success, negative error code otherwise (in this case matching_status is not updated).
+ * @brief Destroys the string arena and all its strings, resetting it to its gravestone value.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t zc_publisher_get_matching_status(const struct z_loaned_publisher_t *this_,
-                                            struct zc_matching_status_t *matching_status);
+void zc_string_arena_drop(struct zc_moved_string_arena_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Declares a matching listener, registering a callback for notifying queryables matching the given querier key expression and target.
- * The callback will be run in the background until the corresponding querier is dropped.
+ * @brief Constructs a view of a string of the string arena.
  *
- * @param querier: A querier to associate with matching listener.
- * @param callback: A closure that will be called every time the matching status of the querier changes (If last queryable disconnects or when the first queryable connects).
+ * The view data is null-terminated, so that it can be passed as a C string. The view aliases the buffer of the
+ * arena, so it is only valid until the arena is modified or dropped.
  *
- * @return 0 in case of success, negative error code otherwise.
+ * @param this_: The string arena.
+ * @param index: The index of the string, less than `zc_string_arena_len(this_)`.
+ * @param str: An uninitialized memory location where the view will be constructed.
+ * @return 0 in case of success, `Z_EINVAL` if `index` is out of bounds, in which case an empty view is constructed.
  */
-#if (defined(Z_FEATURE_UNSTABLE_API) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t zc_querier_declare_background_matching_listener(const struct z_loaned_querier_t *querier,
-                                                           struct zc_moved_closure_matching_status_t *callback);
+z_result_t zc_string_arena_get(const struct zc_loaned_string_arena_t *this_,
+                               size_t index,
+                               struct z_view_string_t *str);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Constructs matching listener, registering a callback for notifying queryables matching with a given querier's key expression and target.
- *
- * @param querier: A querier to associate with matching listener.
- * @param matching_listener: An uninitialized memory location where matching listener will be constructed. The matching listener's callback will be automatically dropped when the querier is dropped.
- * @param callback: A closure that will be called every time the matching status of the querier changes (If last queryable disconnects or when the first queryable connects).
- *
- * @return 0 in case of success, negative error code otherwise.
+ * @return ``true`` if the string arena is empty, ``false`` otherwise.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+bool zc_string_arena_is_empty(const struct zc_loaned_string_arena_t *this_);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @return number of strings in the string arena.
  */
-#if (defined(Z_FEATURE_UNSTABLE_API) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t zc_querier_declare_matching_listener(const struct z_loaned_querier_t *querier,
-                                                struct zc_owned_matching_listener_t *matching_listener,
-                                                struct zc_moved_closure_matching_status_t *callback);
+size_t zc_string_arena_len(const struct zc_loaned_string_arena_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Gets querier matching status - i.e. if there are any queryables matching its key expression and target.
- *
- * @return 0 in case of success, negative error code otherwise (in this case matching_status is not updated).
+ * @brief Borrows string arena.
  */
-#if (defined(Z_FEATURE_UNSTABLE_API) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t zc_querier_get_matching_status(const struct z_loaned_querier_t *this_,
-                                          struct zc_matching_status_t *matching_status);
+const struct zc_loaned_string_arena_t *zc_string_arena_loan(const struct zc_owned_string_arena_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Returns the default value of #zc_reply_keyexpr_t.
+ * @brief Mutably borrows string arena.
  */
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-enum zc_reply_keyexpr_t zc_reply_keyexpr_default(void);
+struct zc_loaned_string_arena_t *zc_string_arena_loan_mut(struct zc_owned_string_arena_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Add client to the list.
+ * @brief Constructs a new empty string arena.
+ *
+ * Unlike `z_owned_string_array_t`, which holds a separate allocation per string, a string arena copies all its
+ * strings into a single buffer along with a table of their offsets, so that pushing a string only allocates when the
+ * buffer grows, and the arena is freed at once. It can be reused without allocating with `zc_string_arena_clear()`.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-z_result_t zc_shm_client_list_add_client(struct zc_loaned_shm_client_list_t *this_,
-                                         z_protocol_id_t id,
-                                         struct z_moved_shm_client_t *client);
+void zc_string_arena_new(struct zc_owned_string_arena_t *this_);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Deletes list of SHM Clients.
+ * @brief Appends a copy of the specified string to the end of the string arena.
+ *
+ * Pushing may move the buffer of the arena, invalidating the views previously obtained with `zc_string_arena_get()`.
+ *
+ * @return the new length of the arena.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void zc_shm_client_list_drop(struct zc_moved_shm_client_list_t *this_);
+size_t zc_string_arena_push(struct zc_loaned_string_arena_t *this_,
+                            const struct z_loaned_string_t *value);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Borrows list of SHM Clients.
+ * @brief Reserves room in the string arena for at least `additional` more strings of `additional_bytes` bytes in
+ * total, so that pushing them does not allocate.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-const struct zc_loaned_shm_client_list_t *zc_shm_client_list_loan(const struct zc_owned_shm_client_list_t *this_);
+void zc_string_arena_reserve(struct zc_loaned_string_arena_t *this_,
+                             size_t additional,
+                             size_t additional_bytes);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Mutably borrows list of SHM Clients.
+ * @brief Reads the distribution of the durations of the callbacks of a subscriber, timed while the watchdog is enabled.
+ *
+ * For an isolated subscriber, the durations are measured on its delivery thread.
+ *
+ * @param this_: The subscriber.
+ * @param histogram: An uninitialized location in memory where the histogram will be written.
+ * @return 0 in case of success, `Z_EUNAVAILABLE` if the subscriber has no counters, negative error code otherwise.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-struct zc_loaned_shm_client_list_t *zc_shm_client_list_loan_mut(struct zc_owned_shm_client_list_t *this_);
+z_result_t zc_subscriber_get_callback_histogram(const struct z_loaned_subscriber_t *this_,
+                                                struct zc_callback_histogram_t *histogram);
 #endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
- * @brief Creates a new empty list of SHM Clients.
+ * @brief Reads the counters of a subscriber.
+ *
+ * Samples are counted before being passed to the subscriber callback, or pushed to its channel.
+ *
+ * @param this_: The subscriber.
+ * @param stats: An uninitialized location in memory where the counters will be written.
+ * @return 0 in case of success, `Z_EUNAVAILABLE` if the subscriber has no counters, negative error code otherwise.
  */
-#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void zc_shm_client_list_new(struct zc_owned_shm_client_list_t *this_);
+z_result_t zc_subscriber_get_stats(const struct z_loaned_subscriber_t *this_,
+                                   struct zc_entity_stats_t *stats);
 #endif
 /**
- * Stops all Zenoh tasks and drops all related static variables.
- * All Zenoh-related structures should be properly dropped/undeclared PRIOR to this call.
- * None of Zenoh functionality can be used after this call.
- * Useful to suppress memory leaks messages due to Zenoh static variables (since they are never destroyed due to Rust language design).
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Creates a timestamp from the session id without going through the session clock.
+ *
+ * The time is extrapolated from the CPU counter calibrated with `zc_clock_tsc_calibrate()`, or from the monotonic
+ * clock if it is not calibrated, so that neither a lock nor a system clock read is needed, e.g. to timestamp each
+ * message of a high-rate publisher. The timestamps are strictly increasing across the process, but unlike the ones of
+ * `z_timestamp_new()` they are not updated from the timestamps received by the session, and they do not follow the
+ * adjustments of the system clock made after the first call or the calibration.
+ *
+ * @param this_: An uninitialized memory location where the timestamp will be written.
+ * @param session: The session whose id is used for the timestamp.
+ * @return 0 in case of success, negative error code otherwise.
  */
+#if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API
-void zc_stop_z_runtime(void);
+z_result_t zc_timestamp_new_fast(struct z_timestamp_t *this_,
+                                 const struct z_loaned_session_t *session);
+#endif
 /**
  * Initializes the zenoh runtime logger, using rust environment settings.
  * E.g.: `RUST_LOG=info` will enable logging at info level. Similarly, you can set the variable to `error` or `debug`.
@@ -5750,6 +9970,48 @@ void ze_advanced_subscriber_options_default(struct ze_advanced_subscriber_option
 ZENOHC_API
 void ze_advanced_subscriber_recovery_options_default(struct ze_advanced_subscriber_recovery_options_t *this_);
 #endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Drops cache budget and resets it to its gravestone state. The caches sharing it keep it alive until they are
+ * dropped.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+void ze_cache_budget_drop(struct ze_moved_cache_budget_t *this_);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Borrows cache budget.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+const struct ze_loaned_cache_budget_t *ze_cache_budget_loan(const struct ze_owned_cache_budget_t *this_);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs a memory budget, to be shared by several byte-budgeted publication caches,
+ * see `ze_publication_cache_options_t::budget`.
+ *
+ * The caches sharing a budget keep a reference to it, so it can be dropped once they are declared.
+ *
+ * @param this_: An uninitialized location in memory where the budget will be constructed.
+ * @param max_bytes: The maximum number of bytes held by all the caches sharing the budget.
+ *
+ * @return 0 in case of success, `Z_EINVAL` if `max_bytes` is 0.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t ze_cache_budget_new(struct ze_owned_cache_budget_t *this_,
+                               size_t max_bytes);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns the number of bytes currently held by all the publication caches sharing the budget.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+size_t ze_cache_budget_resident_bytes(const struct ze_loaned_cache_budget_t *this_);
+#endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
  *
@@ -5969,12 +10231,63 @@ ZENOHC_API z_result_t ze_deserialize_int8(const struct z_loaned_bytes_t *this_,
 ZENOHC_API
 z_result_t ze_deserialize_slice(const struct z_loaned_bytes_t *this_,
                                 struct z_owned_slice_t *slice);
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Deserializes into a slice view, without copy.
+ *
+ * The view borrows the memory of `this_`, so it is only valid as long as `this_` is not modified or dropped.
+ * This is only possible if the serialized slice is not fragmented, otherwise the function fails with `Z_EUNAVAILABLE`,
+ * and `ze_deserialize_slice()` should be used to obtain a copy instead.
+ * @param this_: Data to deserialize.
+ * @param view: An uninitialized memory location where the view is to be constructed.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t ze_deserialize_slice_view(const struct z_loaned_bytes_t *this_,
+                                     struct z_view_slice_t *view);
+#endif
 /**
  * @brief Deserializes into a UTF-8 string.
  */
 ZENOHC_API
 z_result_t ze_deserialize_string(const struct z_loaned_bytes_t *this_,
                                  struct z_owned_string_t *str);
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Deserializes into a UTF-8 string view, without copy.
+ *
+ * The view borrows the memory of `this_`, so it is only valid as long as `this_` is not modified or dropped.
+ * This is only possible if the serialized string is not fragmented, otherwise the function fails with `Z_EUNAVAILABLE`,
+ * and `ze_deserialize_string()` should be used to obtain a copy instead.
+ * @param this_: Data to deserialize.
+ * @param view: An uninitialized memory location where the view is to be constructed.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t ze_deserialize_string_view(const struct z_loaned_bytes_t *this_,
+                                      struct z_view_string_t *view);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Deserializes a struct described by an array of fields, serialized by `ze_serialize_struct()` or by the
+ * corresponding `ze_serializer_serialize_*()` calls.
+ *
+ * @param this_: Data to deserialize.
+ * @param dst: A pointer to the struct to write the fields to.
+ * @param fields: A pointer to an array of `len` field descriptions.
+ * @param len: The number of fields.
+ * @return 0 in case of success, `Z_EDESERIALIZE` if the data does not match the fields, in which case `dst` may be
+ * partially written, negative error code otherwise.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t ze_deserialize_struct(const struct z_loaned_bytes_t *this_,
+                                 void *dst,
+                                 const struct ze_field_t *fields,
+                                 size_t len);
+#endif
 /**
  * @brief Deserializes into an unsigned integer.
  * @return 0 in case of success, negative error code otherwise.
@@ -5995,6 +10308,166 @@ ZENOHC_API z_result_t ze_deserialize_uint64(const struct z_loaned_bytes_t *this_
  * @return 0 in case of success, negative error code otherwise.
  */
 ZENOHC_API z_result_t ze_deserialize_uint8(const struct z_loaned_bytes_t *this_, uint8_t *dst);
+/**
+ * @brief Deserializes a sequence of doubles into an array.
+ *
+ * Reads a sequence previously written by `ze_serializer_serialize_array_double()`, or by `ze_serializer_serialize_sequence_length()`
+ * followed by `ze_serializer_serialize_double()` for each element.
+ * @param this_: A deserializer instance.
+ * @param dst: A pointer to an array of `cap` elements, where the deserialized elements will be written.
+ * @param cap: Number of elements of `dst`.
+ * @param n: A memory location where the number of elements in the sequence will be written.
+ * @return 0 in case of success, negative error code otherwise (in particular if the sequence contains more than `cap` elements).
+ */
+ZENOHC_API
+z_result_t ze_deserializer_deserialize_array_double(struct ze_deserializer_t *this_,
+                                                    double *dst,
+                                                    size_t cap,
+                                                    size_t *n);
+/**
+ * @brief Deserializes a sequence of floats into an array.
+ *
+ * Reads a sequence previously written by `ze_serializer_serialize_array_float()`, or by `ze_serializer_serialize_sequence_length()`
+ * followed by `ze_serializer_serialize_float()` for each element.
+ * @param this_: A deserializer instance.
+ * @param dst: A pointer to an array of `cap` elements, where the deserialized elements will be written.
+ * @param cap: Number of elements of `dst`.
+ * @param n: A memory location where the number of elements in the sequence will be written.
+ * @return 0 in case of success, negative error code otherwise (in particular if the sequence contains more than `cap` elements).
+ */
+ZENOHC_API
+z_result_t ze_deserializer_deserialize_array_float(struct ze_deserializer_t *this_,
+                                                   float *dst,
+                                                   size_t cap,
+                                                   size_t *n);
+/**
+ * @brief Deserializes a sequence of signed integers into an array.
+ *
+ * Reads a sequence previously written by `ze_serializer_serialize_array_int16()`, or by `ze_serializer_serialize_sequence_length()`
+ * followed by `ze_serializer_serialize_int16()` for each element.
+ * @param this_: A deserializer instance.
+ * @param dst: A pointer to an array of `cap` elements, where the deserialized elements will be written.
+ * @param cap: Number of elements of `dst`.
+ * @param n: A memory location where the number of elements in the sequence will be written.
+ * @return 0 in case of success, negative error code otherwise (in particular if the sequence contains more than `cap` elements).
+ */
+ZENOHC_API
+z_result_t ze_deserializer_deserialize_array_int16(struct ze_deserializer_t *this_,
+                                                   int16_t *dst,
+                                                   size_t cap,
+                                                   size_t *n);
+/**
+ * @brief Deserializes a sequence of signed integers into an array.
+ *
+ * Reads a sequence previously written by `ze_serializer_serialize_array_int32()`, or by `ze_serializer_serialize_sequence_length()`
+ * followed by `ze_serializer_serialize_int32()` for each element.
+ * @param this_: A deserializer instance.
+ * @param dst: A pointer to an array of `cap` elements, where the deserialized elements will be written.
+ * @param cap: Number of elements of `dst`.
+ * @param n: A memory location where the number of elements in the sequence will be written.
+ * @return 0 in case of success, negative error code otherwise (in particular if the sequence contains more than `cap` elements).
+ */
+ZENOHC_API
+z_result_t ze_deserializer_deserialize_array_int32(struct ze_deserializer_t *this_,
+                                                   int32_t *dst,
+                                                   size_t cap,
+                                                   size_t *n);
+/**
+ * @brief Deserializes a sequence of signed integers into an array.
+ *
+ * Reads a sequence previously written by `ze_serializer_serialize_array_int64()`, or by `ze_serializer_serialize_sequence_length()`
+ * followed by `ze_serializer_serialize_int64()` for each element.
+ * @param this_: A deserializer instance.
+ * @param dst: A pointer to an array of `cap` elements, where the deserialized elements will be written.
+ * @param cap: Number of elements of `dst`.
+ * @param n: A memory location where the number of elements in the sequence will be written.
+ * @return 0 in case of success, negative error code otherwise (in particular if the sequence contains more than `cap` elements).
+ */
+ZENOHC_API
+z_result_t ze_deserializer_deserialize_array_int64(struct ze_deserializer_t *this_,
+                                                   int64_t *dst,
+                                                   size_t cap,
+                                                   size_t *n);
+/**
+ * @brief Deserializes a sequence of signed integers into an array.
+ *
+ * Reads a sequence previously written by `ze_serializer_serialize_array_int8()`, or by `ze_serializer_serialize_sequence_length()`
+ * followed by `ze_serializer_serialize_int8()` for each element.
+ * @param this_: A deserializer instance.
+ * @param dst: A pointer to an array of `cap` elements, where the deserialized elements will be written.
+ * @param cap: Number of elements of `dst`.
+ * @param n: A memory location where the number of elements in the sequence will be written.
+ * @return 0 in case of success, negative error code otherwise (in particular if the sequence contains more than `cap` elements).
+ */
+ZENOHC_API
+z_result_t ze_deserializer_deserialize_array_int8(struct ze_deserializer_t *this_,
+                                                  int8_t *dst,
+                                                  size_t cap,
+                                                  size_t *n);
+/**
+ * @brief Deserializes a sequence of unsigned integers into an array.
+ *
+ * Reads a sequence previously written by `ze_serializer_serialize_array_uint16()`, or by `ze_serializer_serialize_sequence_length()`
+ * followed by `ze_serializer_serialize_uint16()` for each element.
+ * @param this_: A deserializer instance.
+ * @param dst: A pointer to an array of `cap` elements, where the deserialized elements will be written.
+ * @param cap: Number of elements of `dst`.
+ * @param n: A memory location where the number of elements in the sequence will be written.
+ * @return 0 in case of success, negative error code otherwise (in particular if the sequence contains more than `cap` elements).
+ */
+ZENOHC_API
+z_result_t ze_deserializer_deserialize_array_uint16(struct ze_deserializer_t *this_,
+                                                    uint16_t *dst,
+                                                    size_t cap,
+                                                    size_t *n);
+/**
+ * @brief Deserializes a sequence of unsigned integers into an array.
+ *
+ * Reads a sequence previously written by `ze_serializer_serialize_array_uint32()`, or by `ze_serializer_serialize_sequence_length()`
+ * followed by `ze_serializer_serialize_uint32()` for each element.
+ * @param this_: A deserializer instance.
+ * @param dst: A pointer to an array of `cap` elements, where the deserialized elements will be written.
+ * @param cap: Number of elements of `dst`.
+ * @param n: A memory location where the number of elements in the sequence will be written.
+ * @return 0 in case of success, negative error code otherwise (in particular if the sequence contains more than `cap` elements).
+ */
+ZENOHC_API
+z_result_t ze_deserializer_deserialize_array_uint32(struct ze_deserializer_t *this_,
+                                                    uint32_t *dst,
+                                                    size_t cap,
+                                                    size_t *n);
+/**
+ * @brief Deserializes a sequence of unsigned integers into an array.
+ *
+ * Reads a sequence previously written by `ze_serializer_serialize_array_uint64()`, or by `ze_serializer_serialize_sequence_length()`
+ * followed by `ze_serializer_serialize_uint64()` for each element.
+ * @param this_: A deserializer instance.
+ * @param dst: A pointer to an array of `cap` elements, where the deserialized elements will be written.
+ * @param cap: Number of elements of `dst`.
+ * @param n: A memory location where the number of elements in the sequence will be written.
+ * @return 0 in case of success, negative error code otherwise (in particular if the sequence contains more than `cap` elements).
+ */
+ZENOHC_API
+z_result_t ze_deserializer_deserialize_array_uint64(struct ze_deserializer_t *this_,
+                                                    uint64_t *dst,
+                                                    size_t cap,
+                                                    size_t *n);
+/**
+ * @brief Deserializes a sequence of unsigned integers into an array.
+ *
+ * Reads a sequence previously written by `ze_serializer_serialize_array_uint8()`, or by `ze_serializer_serialize_sequence_length()`
+ * followed by `ze_serializer_serialize_uint8()` for each element.
+ * @param this_: A deserializer instance.
+ * @param dst: A pointer to an array of `cap` elements, where the deserialized elements will be written.
+ * @param cap: Number of elements of `dst`.
+ * @param n: A memory location where the number of elements in the sequence will be written.
+ * @return 0 in case of success, negative error code otherwise (in particular if the sequence contains more than `cap` elements).
+ */
+ZENOHC_API
+z_result_t ze_deserializer_deserialize_array_uint8(struct ze_deserializer_t *this_,
+                                                   void *dst,
+                                                   size_t cap,
+                                                   size_t *n);
 /**
  * @brief Deserializes into a bool.
  * @return 0 in case of success, negative error code otherwise.
@@ -6101,6 +10574,41 @@ struct ze_deserializer_t ze_deserializer_from_bytes(const struct z_loaned_bytes_
  * @return `true` if there is no more data to parse, `false` otherwise.
  */
 ZENOHC_API bool ze_deserializer_is_done(const struct ze_deserializer_t *this_);
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Retrieves the history cached by advanced publishers, one page of time at a time.
+ *
+ * The history of the last `max_age_ms` milliseconds is split in pages of `page_ms` milliseconds, and at most
+ * `max_inflight_pages` pages are queried at once from the caches of the advanced publishers matching `key_expr`.
+ * The samples are passed to `callback` page by page, oldest page first, each page being sorted by timestamp, so that
+ * the caches are not flooded and the first samples are delivered without waiting for the whole history.
+ * The callback is dropped once all pages are delivered.
+ *
+ * This is meant to be used together with an advanced subscriber declared without history, which delivers
+ * the live samples meanwhile. Samples from the most recent page may then be delivered twice.
+ *
+ * @param session: The zenoh session.
+ * @param key_expr: The key expression of the advanced publishers.
+ * @param callback: The callback function that will be called for each historical sample.
+ * @param options: The options for the retrieval, if `NULL` the default ones are used.
+ *
+ * @return 0 in case of success, `Z_EINVAL` if `max_age_ms` or `page_ms` is 0.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t ze_get_history_paged(const struct z_loaned_session_t *session,
+                                const struct z_loaned_keyexpr_t *key_expr,
+                                struct z_moved_closure_sample_t *callback,
+                                const struct ze_history_pages_options_t *options);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs the default value for `ze_history_pages_options_t`.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+void ze_history_pages_options_default(struct ze_history_pages_options_t *this_);
+#endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
  * Returns ``true`` if advanced publisher is valid, ``false`` otherwise.
@@ -6130,6 +10638,22 @@ bool ze_internal_advanced_subscriber_check(const struct ze_owned_advanced_subscr
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API void ze_internal_advanced_subscriber_null(struct ze_owned_advanced_subscriber_t *this_);
 #endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns ``true`` if cache budget is valid, ``false`` otherwise.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+bool ze_internal_cache_budget_check(const struct ze_owned_cache_budget_t *this_);
+#endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Constructs a cache budget in its gravestone state.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+void ze_internal_cache_budget_null(struct ze_owned_cache_budget_t *this_);
+#endif
 /**
  * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
  * @brief Returns ``true`` if closure is valid, ``false`` if it is in gravestone state.
@@ -6230,6 +10754,22 @@ const struct ze_loaned_publication_cache_t *ze_publication_cache_loan(const stru
 #if defined(Z_FEATURE_UNSTABLE_API)
 ZENOHC_API void ze_publication_cache_options_default(struct ze_publication_cache_options_t *this_);
 #endif
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Returns the number of bytes currently held by a byte-budgeted publication cache, see
+ * `ze_publication_cache_options_t::max_bytes`. The bytes held by the other caches sharing its budget are not counted,
+ * they can be read with `ze_cache_budget_resident_bytes()`.
+ *
+ * For a log-backed cache, see `ze_publication_cache_options_t::log_directory`, this is the number of bytes written
+ * to its retained log segments, which are paged by the OS rather than held in memory.
+ *
+ * @return 0 in case of success, `Z_EUNAVAILABLE` if the cache is bounded by the number of samples only.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t ze_publication_cache_resident_bytes(const struct ze_loaned_publication_cache_t *this_,
+                                               size_t *out_bytes);
+#endif
 /**
  * @warning This API is deprecated. Please use ze_advanced_subscriber.
  * @brief Undeclares querying subscriber callback and resets it to its gravestone state.
@@ -6335,6 +10875,27 @@ ZENOHC_API z_result_t ze_serialize_str(struct z_owned_bytes_t *this_, const char
 ZENOHC_API
 z_result_t ze_serialize_string(struct z_owned_bytes_t *this_,
                                const struct z_loaned_string_t *str);
+/**
+ * @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+ * @brief Serializes a struct described by an array of fields, in a single contiguous buffer.
+ *
+ * The fields are serialized in the order of `fields`, in the same format as the corresponding `ze_serializer_serialize_*()`
+ * calls, so that the result can also be read with a `ze_deserializer_t`. Numbers are written in little-endian order and
+ * `ZE_FIELD_TYPE_BYTES` fields as by `ze_serializer_serialize_buf()`.
+ *
+ * @param this_: An uninitialized memory location where the serialized data is to be constructed.
+ * @param src: A pointer to the struct to serialize.
+ * @param fields: A pointer to an array of `len` field descriptions.
+ * @param len: The number of fields.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+#if defined(Z_FEATURE_UNSTABLE_API)
+ZENOHC_API
+z_result_t ze_serialize_struct(struct z_owned_bytes_t *this_,
+                               const void *src,
+                               const struct ze_field_t *fields,
+                               size_t len);
+#endif
 /**
  * @brief Serializes a substring.
  * The substring should be a valid UTF-8.
@@ -6390,6 +10951,146 @@ const struct ze_loaned_serializer_t *ze_serializer_loan(const struct ze_owned_se
  */
 ZENOHC_API
 struct ze_loaned_serializer_t *ze_serializer_loan_mut(struct ze_owned_serializer_t *this_);
+/**
+ * @brief Serializes an array of doubles as a sequence.
+ *
+ * The result is the same as calling `ze_serializer_serialize_sequence_length()` followed by `ze_serializer_serialize_double()`
+ * for each element, but elements are written in a single bulk operation.
+ * @param this_: A serializer instance.
+ * @param data: A pointer to the first element of the array.
+ * @param n: Number of elements in the array.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+ZENOHC_API
+z_result_t ze_serializer_serialize_array_double(struct ze_loaned_serializer_t *this_,
+                                                const double *data,
+                                                size_t n);
+/**
+ * @brief Serializes an array of floats as a sequence.
+ *
+ * The result is the same as calling `ze_serializer_serialize_sequence_length()` followed by `ze_serializer_serialize_float()`
+ * for each element, but elements are written in a single bulk operation.
+ * @param this_: A serializer instance.
+ * @param data: A pointer to the first element of the array.
+ * @param n: Number of elements in the array.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+ZENOHC_API
+z_result_t ze_serializer_serialize_array_float(struct ze_loaned_serializer_t *this_,
+                                               const float *data,
+                                               size_t n);
+/**
+ * @brief Serializes an array of signed integers as a sequence.
+ *
+ * The result is the same as calling `ze_serializer_serialize_sequence_length()` followed by `ze_serializer_serialize_int16()`
+ * for each element, but elements are written in a single bulk operation.
+ * @param this_: A serializer instance.
+ * @param data: A pointer to the first element of the array.
+ * @param n: Number of elements in the array.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+ZENOHC_API
+z_result_t ze_serializer_serialize_array_int16(struct ze_loaned_serializer_t *this_,
+                                               const int16_t *data,
+                                               size_t n);
+/**
+ * @brief Serializes an array of signed integers as a sequence.
+ *
+ * The result is the same as calling `ze_serializer_serialize_sequence_length()` followed by `ze_serializer_serialize_int32()`
+ * for each element, but elements are written in a single bulk operation.
+ * @param this_: A serializer instance.
+ * @param data: A pointer to the first element of the array.
+ * @param n: Number of elements in the array.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+ZENOHC_API
+z_result_t ze_serializer_serialize_array_int32(struct ze_loaned_serializer_t *this_,
+                                               const int32_t *data,
+                                               size_t n);
+/**
+ * @brief Serializes an array of signed integers as a sequence.
+ *
+ * The result is the same as calling `ze_serializer_serialize_sequence_length()` followed by `ze_serializer_serialize_int64()`
+ * for each element, but elements are written in a single bulk operation.
+ * @param this_: A serializer instance.
+ * @param data: A pointer to the first element of the array.
+ * @param n: Number of elements in the array.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+ZENOHC_API
+z_result_t ze_serializer_serialize_array_int64(struct ze_loaned_serializer_t *this_,
+                                               const int64_t *data,
+                                               size_t n);
+/**
+ * @brief Serializes an array of signed integers as a sequence.
+ *
+ * The result is the same as calling `ze_serializer_serialize_sequence_length()` followed by `ze_serializer_serialize_int8()`
+ * for each element, but elements are written in a single bulk operation.
+ * @param this_: A serializer instance.
+ * @param data: A pointer to the first element of the array.
+ * @param n: Number of elements in the array.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+ZENOHC_API
+z_result_t ze_serializer_serialize_array_int8(struct ze_loaned_serializer_t *this_,
+                                              const int8_t *data,
+                                              size_t n);
+/**
+ * @brief Serializes an array of unsigned integers as a sequence.
+ *
+ * The result is the same as calling `ze_serializer_serialize_sequence_length()` followed by `ze_serializer_serialize_uint16()`
+ * for each element, but elements are written in a single bulk operation.
+ * @param this_: A serializer instance.
+ * @param data: A pointer to the first element of the array.
+ * @param n: Number of elements in the array.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+ZENOHC_API
+z_result_t ze_serializer_serialize_array_uint16(struct ze_loaned_serializer_t *this_,
+                                                const uint16_t *data,
+                                                size_t n);
+/**
+ * @brief Serializes an array of unsigned integers as a sequence.
+ *
+ * The result is the same as calling `ze_serializer_serialize_sequence_length()` followed by `ze_serializer_serialize_uint32()`
+ * for each element, but elements are written in a single bulk operation.
+ * @param this_: A serializer instance.
+ * @param data: A pointer to the first element of the array.
+ * @param n: Number of elements in the array.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+ZENOHC_API
+z_result_t ze_serializer_serialize_array_uint32(struct ze_loaned_serializer_t *this_,
+                                                const uint32_t *data,
+                                                size_t n);
+/**
+ * @brief Serializes an array of unsigned integers as a sequence.
+ *
+ * The result is the same as calling `ze_serializer_serialize_sequence_length()` followed by `ze_serializer_serialize_uint64()`
+ * for each element, but elements are written in a single bulk operation.
+ * @param this_: A serializer instance.
+ * @param data: A pointer to the first element of the array.
+ * @param n: Number of elements in the array.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+ZENOHC_API
+z_result_t ze_serializer_serialize_array_uint64(struct ze_loaned_serializer_t *this_,
+                                                const uint64_t *data,
+                                                size_t n);
+/**
+ * @brief Serializes an array of unsigned integers as a sequence.
+ *
+ * The result is the same as calling `ze_serializer_serialize_sequence_length()` followed by `ze_serializer_serialize_uint8()`
+ * for each element, but elements are written in a single bulk operation.
+ * @param this_: A serializer instance.
+ * @param data: A pointer to the first element of the array.
+ * @param n: Number of elements in the array.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+ZENOHC_API
+z_result_t ze_serializer_serialize_array_uint8(struct ze_loaned_serializer_t *this_,
+                                               const uint8_t *data,
+                                               size_t n);
 /**
  * @brief Serializes a bool.
  */
@@ -38,4 +38,8 @@
 #define Z_EINVAL_MUTEX -22
 #define Z_EAGAIN_MUTEX -11
 #define Z_EPOISON_MUTEX -22
+#define Z_ETIMEDOUT -110
 #define Z_EGENERIC INT8_MIN
+#if (defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API))
+#define ZC_SHM_STATS_SIZE_CLASSES 32
+#endif
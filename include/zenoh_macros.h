@@ -4,9 +4,11 @@
 
 #ifndef __cplusplus
 
+static inline z_moved_adaptive_mutex_t* z_adaptive_mutex_move(z_owned_adaptive_mutex_t* x) { return (z_moved_adaptive_mutex_t*)(x); }
 static inline z_moved_alloc_layout_t* z_alloc_layout_move(z_owned_alloc_layout_t* x) { return (z_moved_alloc_layout_t*)(x); }
 static inline z_moved_bytes_t* z_bytes_move(z_owned_bytes_t* x) { return (z_moved_bytes_t*)(x); }
 static inline z_moved_bytes_writer_t* z_bytes_writer_move(z_owned_bytes_writer_t* x) { return (z_moved_bytes_writer_t*)(x); }
+static inline z_moved_cancellation_token_t* z_cancellation_token_move(z_owned_cancellation_token_t* x) { return (z_moved_cancellation_token_t*)(x); }
 static inline z_moved_chunk_alloc_result_t* z_chunk_alloc_result_move(z_owned_chunk_alloc_result_t* x) { return (z_moved_chunk_alloc_result_t*)(x); }
 static inline z_moved_closure_hello_t* z_closure_hello_move(z_owned_closure_hello_t* x) { return (z_moved_closure_hello_t*)(x); }
 static inline z_moved_closure_query_t* z_closure_query_move(z_owned_closure_query_t* x) { return (z_moved_closure_query_t*)(x); }
@@ -15,7 +17,10 @@ static inline z_moved_closure_sample_t* z_closure_sample_move(z_owned_closure_sa
 static inline z_moved_closure_zid_t* z_closure_zid_move(z_owned_closure_zid_t* x) { return (z_moved_closure_zid_t*)(x); }
 static inline z_moved_condvar_t* z_condvar_move(z_owned_condvar_t* x) { return (z_moved_condvar_t*)(x); }
 static inline z_moved_config_t* z_config_move(z_owned_config_t* x) { return (z_moved_config_t*)(x); }
+static inline z_moved_conflating_handler_sample_t* z_conflating_handler_sample_move(z_owned_conflating_handler_sample_t* x) { return (z_moved_conflating_handler_sample_t*)(x); }
+static inline z_moved_credit_handler_reply_t* z_credit_handler_reply_move(z_owned_credit_handler_reply_t* x) { return (z_moved_credit_handler_reply_t*)(x); }
 static inline z_moved_encoding_t* z_encoding_move(z_owned_encoding_t* x) { return (z_moved_encoding_t*)(x); }
+static inline z_moved_executor_t* z_executor_move(z_owned_executor_t* x) { return (z_moved_executor_t*)(x); }
 static inline z_moved_fifo_handler_query_t* z_fifo_handler_query_move(z_owned_fifo_handler_query_t* x) { return (z_moved_fifo_handler_query_t*)(x); }
 static inline z_moved_fifo_handler_reply_t* z_fifo_handler_reply_move(z_owned_fifo_handler_reply_t* x) { return (z_moved_fifo_handler_reply_t*)(x); }
 static inline z_moved_fifo_handler_sample_t* z_fifo_handler_sample_move(z_owned_fifo_handler_sample_t* x) { return (z_moved_fifo_handler_sample_t*)(x); }
@@ -24,6 +29,7 @@ static inline z_moved_keyexpr_t* z_keyexpr_move(z_owned_keyexpr_t* x) { return (
 static inline z_moved_liveliness_token_t* z_liveliness_token_move(z_owned_liveliness_token_t* x) { return (z_moved_liveliness_token_t*)(x); }
 static inline z_moved_memory_layout_t* z_memory_layout_move(z_owned_memory_layout_t* x) { return (z_moved_memory_layout_t*)(x); }
 static inline z_moved_mutex_t* z_mutex_move(z_owned_mutex_t* x) { return (z_moved_mutex_t*)(x); }
+static inline z_moved_priority_handler_sample_t* z_priority_handler_sample_move(z_owned_priority_handler_sample_t* x) { return (z_moved_priority_handler_sample_t*)(x); }
 static inline z_moved_publisher_t* z_publisher_move(z_owned_publisher_t* x) { return (z_moved_publisher_t*)(x); }
 static inline z_moved_querier_t* z_querier_move(z_owned_querier_t* x) { return (z_moved_querier_t*)(x); }
 static inline z_moved_query_t* z_query_move(z_owned_query_t* x) { return (z_moved_query_t*)(x); }
@@ -33,7 +39,9 @@ static inline z_moved_reply_err_t* z_reply_err_move(z_owned_reply_err_t* x) { re
 static inline z_moved_ring_handler_query_t* z_ring_handler_query_move(z_owned_ring_handler_query_t* x) { return (z_moved_ring_handler_query_t*)(x); }
 static inline z_moved_ring_handler_reply_t* z_ring_handler_reply_move(z_owned_ring_handler_reply_t* x) { return (z_moved_ring_handler_reply_t*)(x); }
 static inline z_moved_ring_handler_sample_t* z_ring_handler_sample_move(z_owned_ring_handler_sample_t* x) { return (z_moved_ring_handler_sample_t*)(x); }
+static inline z_moved_rwlock_t* z_rwlock_move(z_owned_rwlock_t* x) { return (z_moved_rwlock_t*)(x); }
 static inline z_moved_sample_t* z_sample_move(z_owned_sample_t* x) { return (z_moved_sample_t*)(x); }
+static inline z_moved_semaphore_t* z_semaphore_move(z_owned_semaphore_t* x) { return (z_moved_semaphore_t*)(x); }
 static inline z_moved_session_t* z_session_move(z_owned_session_t* x) { return (z_moved_session_t*)(x); }
 static inline z_moved_shm_client_t* z_shm_client_move(z_owned_shm_client_t* x) { return (z_moved_shm_client_t*)(x); }
 static inline z_moved_shm_client_storage_t* z_shm_client_storage_move(z_owned_shm_client_storage_t* x) { return (z_moved_shm_client_storage_t*)(x); }
@@ -42,17 +50,28 @@ static inline z_moved_shm_mut_t* z_shm_mut_move(z_owned_shm_mut_t* x) { return (
 static inline z_moved_shm_provider_t* z_shm_provider_move(z_owned_shm_provider_t* x) { return (z_moved_shm_provider_t*)(x); }
 static inline z_moved_slice_t* z_slice_move(z_owned_slice_t* x) { return (z_moved_slice_t*)(x); }
 static inline z_moved_source_info_t* z_source_info_move(z_owned_source_info_t* x) { return (z_moved_source_info_t*)(x); }
+static inline z_moved_spsc_handler_sample_t* z_spsc_handler_sample_move(z_owned_spsc_handler_sample_t* x) { return (z_moved_spsc_handler_sample_t*)(x); }
 static inline z_moved_string_array_t* z_string_array_move(z_owned_string_array_t* x) { return (z_moved_string_array_t*)(x); }
 static inline z_moved_string_t* z_string_move(z_owned_string_t* x) { return (z_moved_string_t*)(x); }
 static inline z_moved_subscriber_t* z_subscriber_move(z_owned_subscriber_t* x) { return (z_moved_subscriber_t*)(x); }
 static inline z_moved_task_t* z_task_move(z_owned_task_t* x) { return (z_moved_task_t*)(x); }
+static inline zc_moved_bytes_pool_t* zc_bytes_pool_move(zc_owned_bytes_pool_t* x) { return (zc_moved_bytes_pool_t*)(x); }
+static inline zc_moved_closure_indexed_reply_t* zc_closure_indexed_reply_move(zc_owned_closure_indexed_reply_t* x) { return (zc_moved_closure_indexed_reply_t*)(x); }
+static inline zc_moved_closure_liveliness_changes_t* zc_closure_liveliness_changes_move(zc_owned_closure_liveliness_changes_t* x) { return (zc_moved_closure_liveliness_changes_t*)(x); }
 static inline zc_moved_closure_log_t* zc_closure_log_move(zc_owned_closure_log_t* x) { return (zc_moved_closure_log_t*)(x); }
 static inline zc_moved_closure_matching_status_t* zc_closure_matching_status_move(zc_owned_closure_matching_status_t* x) { return (zc_moved_closure_matching_status_t*)(x); }
+static inline zc_moved_closure_span_t* zc_closure_span_move(zc_owned_closure_span_t* x) { return (zc_moved_closure_span_t*)(x); }
 static inline zc_moved_concurrent_close_handle_t* zc_concurrent_close_handle_move(zc_owned_concurrent_close_handle_t* x) { return (zc_moved_concurrent_close_handle_t*)(x); }
+static inline zc_moved_keyexpr_interner_t* zc_keyexpr_interner_move(zc_owned_keyexpr_interner_t* x) { return (zc_moved_keyexpr_interner_t*)(x); }
+static inline zc_moved_keyexpr_matcher_t* zc_keyexpr_matcher_move(zc_owned_keyexpr_matcher_t* x) { return (zc_moved_keyexpr_matcher_t*)(x); }
 static inline zc_moved_matching_listener_t* zc_matching_listener_move(zc_owned_matching_listener_t* x) { return (zc_moved_matching_listener_t*)(x); }
+static inline zc_moved_shm_client_cache_t* zc_shm_client_cache_move(zc_owned_shm_client_cache_t* x) { return (zc_moved_shm_client_cache_t*)(x); }
 static inline zc_moved_shm_client_list_t* zc_shm_client_list_move(zc_owned_shm_client_list_t* x) { return (zc_moved_shm_client_list_t*)(x); }
+static inline zc_moved_shm_completion_queue_t* zc_shm_completion_queue_move(zc_owned_shm_completion_queue_t* x) { return (zc_moved_shm_completion_queue_t*)(x); }
+static inline zc_moved_string_arena_t* zc_string_arena_move(zc_owned_string_arena_t* x) { return (zc_moved_string_arena_t*)(x); }
 static inline ze_moved_advanced_publisher_t* ze_advanced_publisher_move(ze_owned_advanced_publisher_t* x) { return (ze_moved_advanced_publisher_t*)(x); }
 static inline ze_moved_advanced_subscriber_t* ze_advanced_subscriber_move(ze_owned_advanced_subscriber_t* x) { return (ze_moved_advanced_subscriber_t*)(x); }
+static inline ze_moved_cache_budget_t* ze_cache_budget_move(ze_owned_cache_budget_t* x) { return (ze_moved_cache_budget_t*)(x); }
 static inline ze_moved_closure_miss_t* ze_closure_miss_move(ze_owned_closure_miss_t* x) { return (ze_moved_closure_miss_t*)(x); }
 static inline ze_moved_publication_cache_t* ze_publication_cache_move(ze_owned_publication_cache_t* x) { return (ze_moved_publication_cache_t*)(x); }
 static inline ze_moved_querying_subscriber_t* ze_querying_subscriber_move(ze_owned_querying_subscriber_t* x) { return (ze_moved_querying_subscriber_t*)(x); }
@@ -62,9 +81,11 @@ static inline ze_moved_serializer_t* ze_serializer_move(ze_owned_serializer_t* x
 
 #define z_loan(this_) \
     _Generic((this_), \
+        z_owned_adaptive_mutex_t : z_adaptive_mutex_loan, \
         z_owned_alloc_layout_t : z_alloc_layout_loan, \
         z_owned_bytes_t : z_bytes_loan, \
         z_owned_bytes_writer_t : z_bytes_writer_loan, \
+        z_owned_cancellation_token_t : z_cancellation_token_loan, \
         z_owned_closure_hello_t : z_closure_hello_loan, \
         z_owned_closure_query_t : z_closure_query_loan, \
         z_owned_closure_reply_t : z_closure_reply_loan, \
@@ -72,7 +93,10 @@ static inline ze_moved_serializer_t* ze_serializer_move(ze_owned_serializer_t* x
         z_owned_closure_zid_t : z_closure_zid_loan, \
         z_owned_condvar_t : z_condvar_loan, \
         z_owned_config_t : z_config_loan, \
+        z_owned_conflating_handler_sample_t : z_conflating_handler_sample_loan, \
+        z_owned_credit_handler_reply_t : z_credit_handler_reply_loan, \
         z_owned_encoding_t : z_encoding_loan, \
+        z_owned_executor_t : z_executor_loan, \
         z_owned_fifo_handler_query_t : z_fifo_handler_query_loan, \
         z_owned_fifo_handler_reply_t : z_fifo_handler_reply_loan, \
         z_owned_fifo_handler_sample_t : z_fifo_handler_sample_loan, \
@@ -80,6 +104,7 @@ static inline ze_moved_serializer_t* ze_serializer_move(ze_owned_serializer_t* x
         z_owned_keyexpr_t : z_keyexpr_loan, \
         z_owned_liveliness_token_t : z_liveliness_token_loan, \
         z_owned_memory_layout_t : z_memory_layout_loan, \
+        z_owned_priority_handler_sample_t : z_priority_handler_sample_loan, \
         z_owned_publisher_t : z_publisher_loan, \
         z_owned_querier_t : z_querier_loan, \
         z_owned_query_t : z_query_loan, \
@@ -89,7 +114,9 @@ static inline ze_moved_serializer_t* ze_serializer_move(ze_owned_serializer_t* x
         z_owned_ring_handler_query_t : z_ring_handler_query_loan, \
         z_owned_ring_handler_reply_t : z_ring_handler_reply_loan, \
         z_owned_ring_handler_sample_t : z_ring_handler_sample_loan, \
+        z_owned_rwlock_t : z_rwlock_loan, \
         z_owned_sample_t : z_sample_loan, \
+        z_owned_semaphore_t : z_semaphore_loan, \
         z_owned_session_t : z_session_loan, \
         z_owned_shm_client_storage_t : z_shm_client_storage_loan, \
         z_owned_shm_t : z_shm_loan, \
@@ -97,17 +124,28 @@ static inline ze_moved_serializer_t* ze_serializer_move(ze_owned_serializer_t* x
         z_owned_shm_provider_t : z_shm_provider_loan, \
         z_owned_slice_t : z_slice_loan, \
         z_owned_source_info_t : z_source_info_loan, \
+        z_owned_spsc_handler_sample_t : z_spsc_handler_sample_loan, \
         z_owned_string_array_t : z_string_array_loan, \
         z_owned_string_t : z_string_loan, \
         z_owned_subscriber_t : z_subscriber_loan, \
         z_view_keyexpr_t : z_view_keyexpr_loan, \
         z_view_slice_t : z_view_slice_loan, \
         z_view_string_t : z_view_string_loan, \
+        zc_owned_bytes_pool_t : zc_bytes_pool_loan, \
+        zc_owned_closure_indexed_reply_t : zc_closure_indexed_reply_loan, \
+        zc_owned_closure_liveliness_changes_t : zc_closure_liveliness_changes_loan, \
         zc_owned_closure_log_t : zc_closure_log_loan, \
         zc_owned_closure_matching_status_t : zc_closure_matching_status_loan, \
+        zc_owned_closure_span_t : zc_closure_span_loan, \
+        zc_owned_keyexpr_interner_t : zc_keyexpr_interner_loan, \
+        zc_owned_keyexpr_matcher_t : zc_keyexpr_matcher_loan, \
+        zc_owned_shm_client_cache_t : zc_shm_client_cache_loan, \
         zc_owned_shm_client_list_t : zc_shm_client_list_loan, \
+        zc_owned_shm_completion_queue_t : zc_shm_completion_queue_loan, \
+        zc_owned_string_arena_t : zc_string_arena_loan, \
         ze_owned_advanced_publisher_t : ze_advanced_publisher_loan, \
         ze_owned_advanced_subscriber_t : ze_advanced_subscriber_loan, \
+        ze_owned_cache_budget_t : ze_cache_budget_loan, \
         ze_owned_closure_miss_t : ze_closure_miss_loan, \
         ze_owned_publication_cache_t : ze_publication_cache_loan, \
         ze_owned_querying_subscriber_t : ze_querying_subscriber_loan, \
@@ -137,15 +175,18 @@ static inline ze_moved_serializer_t* ze_serializer_move(ze_owned_serializer_t* x
         z_owned_shm_mut_t : z_shm_mut_loan_mut, \
         z_owned_string_array_t : z_string_array_loan_mut, \
         zc_owned_shm_client_list_t : zc_shm_client_list_loan_mut, \
+        zc_owned_string_arena_t : zc_string_arena_loan_mut, \
         ze_owned_advanced_publisher_t : ze_advanced_publisher_loan_mut, \
         ze_owned_serializer_t : ze_serializer_loan_mut \
     )(&this_)
 
 #define z_drop(this_) \
     _Generic((this_), \
+        z_moved_adaptive_mutex_t* : z_adaptive_mutex_drop, \
         z_moved_alloc_layout_t* : z_alloc_layout_drop, \
         z_moved_bytes_t* : z_bytes_drop, \
         z_moved_bytes_writer_t* : z_bytes_writer_drop, \
+        z_moved_cancellation_token_t* : z_cancellation_token_drop, \
         z_moved_chunk_alloc_result_t* : z_chunk_alloc_result_drop, \
         z_moved_closure_hello_t* : z_closure_hello_drop, \
         z_moved_closure_query_t* : z_closure_query_drop, \
@@ -154,7 +195,10 @@ static inline ze_moved_serializer_t* ze_serializer_move(ze_owned_serializer_t* x
         z_moved_closure_zid_t* : z_closure_zid_drop, \
         z_moved_condvar_t* : z_condvar_drop, \
         z_moved_config_t* : z_config_drop, \
+        z_moved_conflating_handler_sample_t* : z_conflating_handler_sample_drop, \
+        z_moved_credit_handler_reply_t* : z_credit_handler_reply_drop, \
         z_moved_encoding_t* : z_encoding_drop, \
+        z_moved_executor_t* : z_executor_drop, \
         z_moved_fifo_handler_query_t* : z_fifo_handler_query_drop, \
         z_moved_fifo_handler_reply_t* : z_fifo_handler_reply_drop, \
         z_moved_fifo_handler_sample_t* : z_fifo_handler_sample_drop, \
@@ -163,6 +207,7 @@ static inline ze_moved_serializer_t* ze_serializer_move(ze_owned_serializer_t* x
         z_moved_liveliness_token_t* : z_liveliness_token_drop, \
         z_moved_memory_layout_t* : z_memory_layout_drop, \
         z_moved_mutex_t* : z_mutex_drop, \
+        z_moved_priority_handler_sample_t* : z_priority_handler_sample_drop, \
         z_moved_publisher_t* : z_publisher_drop, \
         z_moved_querier_t* : z_querier_drop, \
         z_moved_query_t* : z_query_drop, \
@@ -172,7 +217,9 @@ static inline ze_moved_serializer_t* ze_serializer_move(ze_owned_serializer_t* x
         z_moved_ring_handler_query_t* : z_ring_handler_query_drop, \
         z_moved_ring_handler_reply_t* : z_ring_handler_reply_drop, \
         z_moved_ring_handler_sample_t* : z_ring_handler_sample_drop, \
+        z_moved_rwlock_t* : z_rwlock_drop, \
         z_moved_sample_t* : z_sample_drop, \
+        z_moved_semaphore_t* : z_semaphore_drop, \
         z_moved_session_t* : z_session_drop, \
         z_moved_shm_client_t* : z_shm_client_drop, \
         z_moved_shm_client_storage_t* : z_shm_client_storage_drop, \
@@ -181,17 +228,28 @@ static inline ze_moved_serializer_t* ze_serializer_move(ze_owned_serializer_t* x
         z_moved_shm_provider_t* : z_shm_provider_drop, \
         z_moved_slice_t* : z_slice_drop, \
         z_moved_source_info_t* : z_source_info_drop, \
+        z_moved_spsc_handler_sample_t* : z_spsc_handler_sample_drop, \
         z_moved_string_array_t* : z_string_array_drop, \
         z_moved_string_t* : z_string_drop, \
         z_moved_subscriber_t* : z_subscriber_drop, \
         z_moved_task_t* : z_task_drop, \
+        zc_moved_bytes_pool_t* : zc_bytes_pool_drop, \
+        zc_moved_closure_indexed_reply_t* : zc_closure_indexed_reply_drop, \
+        zc_moved_closure_liveliness_changes_t* : zc_closure_liveliness_changes_drop, \
         zc_moved_closure_log_t* : zc_closure_log_drop, \
         zc_moved_closure_matching_status_t* : zc_closure_matching_status_drop, \
+        zc_moved_closure_span_t* : zc_closure_span_drop, \
         zc_moved_concurrent_close_handle_t* : zc_concurrent_close_handle_drop, \
+        zc_moved_keyexpr_interner_t* : zc_keyexpr_interner_drop, \
+        zc_moved_keyexpr_matcher_t* : zc_keyexpr_matcher_drop, \
         zc_moved_matching_listener_t* : zc_matching_listener_drop, \
+        zc_moved_shm_client_cache_t* : zc_shm_client_cache_drop, \
         zc_moved_shm_client_list_t* : zc_shm_client_list_drop, \
+        zc_moved_shm_completion_queue_t* : zc_shm_completion_queue_drop, \
+        zc_moved_string_arena_t* : zc_string_arena_drop, \
         ze_moved_advanced_publisher_t* : ze_advanced_publisher_drop, \
         ze_moved_advanced_subscriber_t* : ze_advanced_subscriber_drop, \
+        ze_moved_cache_budget_t* : ze_cache_budget_drop, \
         ze_moved_closure_miss_t* : ze_closure_miss_drop, \
         ze_moved_publication_cache_t* : ze_publication_cache_drop, \
         ze_moved_querying_subscriber_t* : ze_querying_subscriber_drop, \
@@ -201,9 +259,11 @@ static inline ze_moved_serializer_t* ze_serializer_move(ze_owned_serializer_t* x
 
 #define z_move(this_) \
     _Generic((this_), \
+        z_owned_adaptive_mutex_t : z_adaptive_mutex_move, \
         z_owned_alloc_layout_t : z_alloc_layout_move, \
         z_owned_bytes_t : z_bytes_move, \
         z_owned_bytes_writer_t : z_bytes_writer_move, \
+        z_owned_cancellation_token_t : z_cancellation_token_move, \
         z_owned_chunk_alloc_result_t : z_chunk_alloc_result_move, \
         z_owned_closure_hello_t : z_closure_hello_move, \
         z_owned_closure_query_t : z_closure_query_move, \
@@ -212,7 +272,10 @@ static inline ze_moved_serializer_t* ze_serializer_move(ze_owned_serializer_t* x
         z_owned_closure_zid_t : z_closure_zid_move, \
         z_owned_condvar_t : z_condvar_move, \
         z_owned_config_t : z_config_move, \
+        z_owned_conflating_handler_sample_t : z_conflating_handler_sample_move, \
+        z_owned_credit_handler_reply_t : z_credit_handler_reply_move, \
         z_owned_encoding_t : z_encoding_move, \
+        z_owned_executor_t : z_executor_move, \
         z_owned_fifo_handler_query_t : z_fifo_handler_query_move, \
         z_owned_fifo_handler_reply_t : z_fifo_handler_reply_move, \
         z_owned_fifo_handler_sample_t : z_fifo_handler_sample_move, \
@@ -221,6 +284,7 @@ static inline ze_moved_serializer_t* ze_serializer_move(ze_owned_serializer_t* x
         z_owned_liveliness_token_t : z_liveliness_token_move, \
         z_owned_memory_layout_t : z_memory_layout_move, \
         z_owned_mutex_t : z_mutex_move, \
+        z_owned_priority_handler_sample_t : z_priority_handler_sample_move, \
         z_owned_publisher_t : z_publisher_move, \
         z_owned_querier_t : z_querier_move, \
         z_owned_query_t : z_query_move, \
@@ -230,7 +294,9 @@ static inline ze_moved_serializer_t* ze_serializer_move(ze_owned_serializer_t* x
         z_owned_ring_handler_query_t : z_ring_handler_query_move, \
         z_owned_ring_handler_reply_t : z_ring_handler_reply_move, \
         z_owned_ring_handler_sample_t : z_ring_handler_sample_move, \
+        z_owned_rwlock_t : z_rwlock_move, \
         z_owned_sample_t : z_sample_move, \
+        z_owned_semaphore_t : z_semaphore_move, \
         z_owned_session_t : z_session_move, \
         z_owned_shm_client_t : z_shm_client_move, \
         z_owned_shm_client_storage_t : z_shm_client_storage_move, \
@@ -239,17 +305,28 @@ static inline ze_moved_serializer_t* ze_serializer_move(ze_owned_serializer_t* x
         z_owned_shm_provider_t : z_shm_provider_move, \
         z_owned_slice_t : z_slice_move, \
         z_owned_source_info_t : z_source_info_move, \
+        z_owned_spsc_handler_sample_t : z_spsc_handler_sample_move, \
         z_owned_string_array_t : z_string_array_move, \
         z_owned_string_t : z_string_move, \
         z_owned_subscriber_t : z_subscriber_move, \
         z_owned_task_t : z_task_move, \
+        zc_owned_bytes_pool_t : zc_bytes_pool_move, \
+        zc_owned_closure_indexed_reply_t : zc_closure_indexed_reply_move, \
+        zc_owned_closure_liveliness_changes_t : zc_closure_liveliness_changes_move, \
         zc_owned_closure_log_t : zc_closure_log_move, \
         zc_owned_closure_matching_status_t : zc_closure_matching_status_move, \
+        zc_owned_closure_span_t : zc_closure_span_move, \
         zc_owned_concurrent_close_handle_t : zc_concurrent_close_handle_move, \
+        zc_owned_keyexpr_interner_t : zc_keyexpr_interner_move, \
+        zc_owned_keyexpr_matcher_t : zc_keyexpr_matcher_move, \
         zc_owned_matching_listener_t : zc_matching_listener_move, \
+        zc_owned_shm_client_cache_t : zc_shm_client_cache_move, \
         zc_owned_shm_client_list_t : zc_shm_client_list_move, \
+        zc_owned_shm_completion_queue_t : zc_shm_completion_queue_move, \
+        zc_owned_string_arena_t : zc_string_arena_move, \
         ze_owned_advanced_publisher_t : ze_advanced_publisher_move, \
         ze_owned_advanced_subscriber_t : ze_advanced_subscriber_move, \
+        ze_owned_cache_budget_t : ze_cache_budget_move, \
         ze_owned_closure_miss_t : ze_closure_miss_move, \
         ze_owned_publication_cache_t : ze_publication_cache_move, \
         ze_owned_querying_subscriber_t : ze_querying_subscriber_move, \
@@ -259,9 +336,11 @@ static inline ze_moved_serializer_t* ze_serializer_move(ze_owned_serializer_t* x
 
 #define z_internal_null(this_) \
     _Generic((this_), \
+        z_owned_adaptive_mutex_t* : z_internal_adaptive_mutex_null, \
         z_owned_alloc_layout_t* : z_internal_alloc_layout_null, \
         z_owned_bytes_t* : z_internal_bytes_null, \
         z_owned_bytes_writer_t* : z_internal_bytes_writer_null, \
+        z_owned_cancellation_token_t* : z_internal_cancellation_token_null, \
         z_owned_chunk_alloc_result_t* : z_internal_chunk_alloc_result_null, \
         z_owned_closure_hello_t* : z_internal_closure_hello_null, \
         z_owned_closure_query_t* : z_internal_closure_query_null, \
@@ -270,7 +349,10 @@ static inline ze_moved_serializer_t* ze_serializer_move(ze_owned_serializer_t* x
         z_owned_closure_zid_t* : z_internal_closure_zid_null, \
         z_owned_condvar_t* : z_internal_condvar_null, \
         z_owned_config_t* : z_internal_config_null, \
+        z_owned_conflating_handler_sample_t* : z_internal_conflating_handler_sample_null, \
+        z_owned_credit_handler_reply_t* : z_internal_credit_handler_reply_null, \
         z_owned_encoding_t* : z_internal_encoding_null, \
+        z_owned_executor_t* : z_internal_executor_null, \
         z_owned_fifo_handler_query_t* : z_internal_fifo_handler_query_null, \
         z_owned_fifo_handler_reply_t* : z_internal_fifo_handler_reply_null, \
         z_owned_fifo_handler_sample_t* : z_internal_fifo_handler_sample_null, \
@@ -279,6 +361,7 @@ static inline ze_moved_serializer_t* ze_serializer_move(ze_owned_serializer_t* x
         z_owned_liveliness_token_t* : z_internal_liveliness_token_null, \
         z_owned_memory_layout_t* : z_internal_memory_layout_null, \
         z_owned_mutex_t* : z_internal_mutex_null, \
+        z_owned_priority_handler_sample_t* : z_internal_priority_handler_sample_null, \
         z_owned_publisher_t* : z_internal_publisher_null, \
         z_owned_querier_t* : z_internal_querier_null, \
         z_owned_query_t* : z_internal_query_null, \
@@ -288,7 +371,9 @@ static inline ze_moved_serializer_t* ze_serializer_move(ze_owned_serializer_t* x
         z_owned_ring_handler_query_t* : z_internal_ring_handler_query_null, \
         z_owned_ring_handler_reply_t* : z_internal_ring_handler_reply_null, \
         z_owned_ring_handler_sample_t* : z_internal_ring_handler_sample_null, \
+        z_owned_rwlock_t* : z_internal_rwlock_null, \
         z_owned_sample_t* : z_internal_sample_null, \
+        z_owned_semaphore_t* : z_internal_semaphore_null, \
         z_owned_session_t* : z_internal_session_null, \
         z_owned_shm_client_t* : z_internal_shm_client_null, \
         z_owned_shm_client_storage_t* : z_internal_shm_client_storage_null, \
@@ -297,17 +382,28 @@ static inline ze_moved_serializer_t* ze_serializer_move(ze_owned_serializer_t* x
         z_owned_shm_provider_t* : z_internal_shm_provider_null, \
         z_owned_slice_t* : z_internal_slice_null, \
         z_owned_source_info_t* : z_internal_source_info_null, \
+        z_owned_spsc_handler_sample_t* : z_internal_spsc_handler_sample_null, \
         z_owned_string_array_t* : z_internal_string_array_null, \
         z_owned_string_t* : z_internal_string_null, \
         z_owned_subscriber_t* : z_internal_subscriber_null, \
         z_owned_task_t* : z_internal_task_null, \
+        zc_owned_bytes_pool_t* : zc_internal_bytes_pool_null, \
+        zc_owned_closure_indexed_reply_t* : zc_internal_closure_indexed_reply_null, \
+        zc_owned_closure_liveliness_changes_t* : zc_internal_closure_liveliness_changes_null, \
         zc_owned_closure_log_t* : zc_internal_closure_log_null, \
         zc_owned_closure_matching_status_t* : zc_internal_closure_matching_status_null, \
+        zc_owned_closure_span_t* : zc_internal_closure_span_null, \
         zc_owned_concurrent_close_handle_t* : zc_internal_concurrent_close_handle_null, \
+        zc_owned_keyexpr_interner_t* : zc_internal_keyexpr_interner_null, \
+        zc_owned_keyexpr_matcher_t* : zc_internal_keyexpr_matcher_null, \
         zc_owned_matching_listener_t* : zc_internal_matching_listener_null, \
+        zc_owned_shm_client_cache_t* : zc_internal_shm_client_cache_null, \
         zc_owned_shm_client_list_t* : zc_internal_shm_client_list_null, \
+        zc_owned_shm_completion_queue_t* : zc_internal_shm_completion_queue_null, \
+        zc_owned_string_arena_t* : zc_internal_string_arena_null, \
         ze_owned_advanced_publisher_t* : ze_internal_advanced_publisher_null, \
         ze_owned_advanced_subscriber_t* : ze_internal_advanced_subscriber_null, \
+        ze_owned_cache_budget_t* : ze_internal_cache_budget_null, \
         ze_owned_closure_miss_t* : ze_internal_closure_miss_null, \
         ze_owned_publication_cache_t* : ze_internal_publication_cache_null, \
         ze_owned_querying_subscriber_t* : ze_internal_querying_subscriber_null, \
@@ -315,9 +411,11 @@ static inline ze_moved_serializer_t* ze_serializer_move(ze_owned_serializer_t* x
         ze_owned_serializer_t* : ze_internal_serializer_null \
     )(this_)
 
+static inline void z_adaptive_mutex_take(z_owned_adaptive_mutex_t* this_, z_moved_adaptive_mutex_t* x) { *this_ = x->_this; z_internal_adaptive_mutex_null(&x->_this); }
 static inline void z_alloc_layout_take(z_owned_alloc_layout_t* this_, z_moved_alloc_layout_t* x) { *this_ = x->_this; z_internal_alloc_layout_null(&x->_this); }
 static inline void z_bytes_take(z_owned_bytes_t* this_, z_moved_bytes_t* x) { *this_ = x->_this; z_internal_bytes_null(&x->_this); }
 static inline void z_bytes_writer_take(z_owned_bytes_writer_t* this_, z_moved_bytes_writer_t* x) { *this_ = x->_this; z_internal_bytes_writer_null(&x->_this); }
+static inline void z_cancellation_token_take(z_owned_cancellation_token_t* this_, z_moved_cancellation_token_t* x) { *this_ = x->_this; z_internal_cancellation_token_null(&x->_this); }
 static inline void z_chunk_alloc_result_take(z_owned_chunk_alloc_result_t* this_, z_moved_chunk_alloc_result_t* x) { *this_ = x->_this; z_internal_chunk_alloc_result_null(&x->_this); }
 static inline void z_closure_hello_take(z_owned_closure_hello_t* this_, z_moved_closure_hello_t* x) { *this_ = x->_this; z_internal_closure_hello_null(&x->_this); }
 static inline void z_closure_query_take(z_owned_closure_query_t* closure_, z_moved_closure_query_t* x) { *closure_ = x->_this; z_internal_closure_query_null(&x->_this); }
@@ -326,7 +424,10 @@ static inline void z_closure_sample_take(z_owned_closure_sample_t* closure_, z_m
 static inline void z_closure_zid_take(z_owned_closure_zid_t* closure_, z_moved_closure_zid_t* x) { *closure_ = x->_this; z_internal_closure_zid_null(&x->_this); }
 static inline void z_condvar_take(z_owned_condvar_t* this_, z_moved_condvar_t* x) { *this_ = x->_this; z_internal_condvar_null(&x->_this); }
 static inline void z_config_take(z_owned_config_t* this_, z_moved_config_t* x) { *this_ = x->_this; z_internal_config_null(&x->_this); }
+static inline void z_conflating_handler_sample_take(z_owned_conflating_handler_sample_t* this_, z_moved_conflating_handler_sample_t* x) { *this_ = x->_this; z_internal_conflating_handler_sample_null(&x->_this); }
+static inline void z_credit_handler_reply_take(z_owned_credit_handler_reply_t* this_, z_moved_credit_handler_reply_t* x) { *this_ = x->_this; z_internal_credit_handler_reply_null(&x->_this); }
 static inline void z_encoding_take(z_owned_encoding_t* this_, z_moved_encoding_t* x) { *this_ = x->_this; z_internal_encoding_null(&x->_this); }
+static inline void z_executor_take(z_owned_executor_t* this_, z_moved_executor_t* x) { *this_ = x->_this; z_internal_executor_null(&x->_this); }
 static inline void z_fifo_handler_query_take(z_owned_fifo_handler_query_t* this_, z_moved_fifo_handler_query_t* x) { *this_ = x->_this; z_internal_fifo_handler_query_null(&x->_this); }
 static inline void z_fifo_handler_reply_take(z_owned_fifo_handler_reply_t* this_, z_moved_fifo_handler_reply_t* x) { *this_ = x->_this; z_internal_fifo_handler_reply_null(&x->_this); }
 static inline void z_fifo_handler_sample_take(z_owned_fifo_handler_sample_t* this_, z_moved_fifo_handler_sample_t* x) { *this_ = x->_this; z_internal_fifo_handler_sample_null(&x->_this); }
@@ -335,6 +436,7 @@ static inline void z_keyexpr_take(z_owned_keyexpr_t* this_, z_moved_keyexpr_t* x
 static inline void z_liveliness_token_take(z_owned_liveliness_token_t* this_, z_moved_liveliness_token_t* x) { *this_ = x->_this; z_internal_liveliness_token_null(&x->_this); }
 static inline void z_memory_layout_take(z_owned_memory_layout_t* this_, z_moved_memory_layout_t* x) { *this_ = x->_this; z_internal_memory_layout_null(&x->_this); }
 static inline void z_mutex_take(z_owned_mutex_t* this_, z_moved_mutex_t* x) { *this_ = x->_this; z_internal_mutex_null(&x->_this); }
+static inline void z_priority_handler_sample_take(z_owned_priority_handler_sample_t* this_, z_moved_priority_handler_sample_t* x) { *this_ = x->_this; z_internal_priority_handler_sample_null(&x->_this); }
 static inline void z_publisher_take(z_owned_publisher_t* this_, z_moved_publisher_t* x) { *this_ = x->_this; z_internal_publisher_null(&x->_this); }
 static inline void z_querier_take(z_owned_querier_t* this_, z_moved_querier_t* x) { *this_ = x->_this; z_internal_querier_null(&x->_this); }
 static inline void z_query_take(z_owned_query_t* this_, z_moved_query_t* x) { *this_ = x->_this; z_internal_query_null(&x->_this); }
@@ -344,7 +446,9 @@ static inline void z_reply_err_take(z_owned_reply_err_t* this_, z_moved_reply_er
 static inline void z_ring_handler_query_take(z_owned_ring_handler_query_t* this_, z_moved_ring_handler_query_t* x) { *this_ = x->_this; z_internal_ring_handler_query_null(&x->_this); }
 static inline void z_ring_handler_reply_take(z_owned_ring_handler_reply_t* this_, z_moved_ring_handler_reply_t* x) { *this_ = x->_this; z_internal_ring_handler_reply_null(&x->_this); }
 static inline void z_ring_handler_sample_take(z_owned_ring_handler_sample_t* this_, z_moved_ring_handler_sample_t* x) { *this_ = x->_this; z_internal_ring_handler_sample_null(&x->_this); }
+static inline void z_rwlock_take(z_owned_rwlock_t* this_, z_moved_rwlock_t* x) { *this_ = x->_this; z_internal_rwlock_null(&x->_this); }
 static inline void z_sample_take(z_owned_sample_t* this_, z_moved_sample_t* x) { *this_ = x->_this; z_internal_sample_null(&x->_this); }
+static inline void z_semaphore_take(z_owned_semaphore_t* this_, z_moved_semaphore_t* x) { *this_ = x->_this; z_internal_semaphore_null(&x->_this); }
 static inline void z_session_take(z_owned_session_t* this_, z_moved_session_t* x) { *this_ = x->_this; z_internal_session_null(&x->_this); }
 static inline void z_shm_client_take(z_owned_shm_client_t* this_, z_moved_shm_client_t* x) { *this_ = x->_this; z_internal_shm_client_null(&x->_this); }
 static inline void z_shm_client_storage_take(z_owned_shm_client_storage_t* this_, z_moved_shm_client_storage_t* x) { *this_ = x->_this; z_internal_shm_client_storage_null(&x->_this); }
@@ -353,17 +457,28 @@ static inline void z_shm_mut_take(z_owned_shm_mut_t* this_, z_moved_shm_mut_t* x
 static inline void z_shm_provider_take(z_owned_shm_provider_t* this_, z_moved_shm_provider_t* x) { *this_ = x->_this; z_internal_shm_provider_null(&x->_this); }
 static inline void z_slice_take(z_owned_slice_t* this_, z_moved_slice_t* x) { *this_ = x->_this; z_internal_slice_null(&x->_this); }
 static inline void z_source_info_take(z_owned_source_info_t* this_, z_moved_source_info_t* x) { *this_ = x->_this; z_internal_source_info_null(&x->_this); }
+static inline void z_spsc_handler_sample_take(z_owned_spsc_handler_sample_t* this_, z_moved_spsc_handler_sample_t* x) { *this_ = x->_this; z_internal_spsc_handler_sample_null(&x->_this); }
 static inline void z_string_array_take(z_owned_string_array_t* this_, z_moved_string_array_t* x) { *this_ = x->_this; z_internal_string_array_null(&x->_this); }
 static inline void z_string_take(z_owned_string_t* this_, z_moved_string_t* x) { *this_ = x->_this; z_internal_string_null(&x->_this); }
 static inline void z_subscriber_take(z_owned_subscriber_t* this_, z_moved_subscriber_t* x) { *this_ = x->_this; z_internal_subscriber_null(&x->_this); }
 static inline void z_task_take(z_owned_task_t* this_, z_moved_task_t* x) { *this_ = x->_this; z_internal_task_null(&x->_this); }
+static inline void zc_bytes_pool_take(zc_owned_bytes_pool_t* this_, zc_moved_bytes_pool_t* x) { *this_ = x->_this; zc_internal_bytes_pool_null(&x->_this); }
+static inline void zc_closure_indexed_reply_take(zc_owned_closure_indexed_reply_t* this_, zc_moved_closure_indexed_reply_t* x) { *this_ = x->_this; zc_internal_closure_indexed_reply_null(&x->_this); }
+static inline void zc_closure_liveliness_changes_take(zc_owned_closure_liveliness_changes_t* this_, zc_moved_closure_liveliness_changes_t* x) { *this_ = x->_this; zc_internal_closure_liveliness_changes_null(&x->_this); }
 static inline void zc_closure_log_take(zc_owned_closure_log_t* closure_, zc_moved_closure_log_t* x) { *closure_ = x->_this; zc_internal_closure_log_null(&x->_this); }
 static inline void zc_closure_matching_status_take(zc_owned_closure_matching_status_t* closure_, zc_moved_closure_matching_status_t* x) { *closure_ = x->_this; zc_internal_closure_matching_status_null(&x->_this); }
+static inline void zc_closure_span_take(zc_owned_closure_span_t* this_, zc_moved_closure_span_t* x) { *this_ = x->_this; zc_internal_closure_span_null(&x->_this); }
 static inline void zc_concurrent_close_handle_take(zc_owned_concurrent_close_handle_t* this_, zc_moved_concurrent_close_handle_t* x) { *this_ = x->_this; zc_internal_concurrent_close_handle_null(&x->_this); }
+static inline void zc_keyexpr_interner_take(zc_owned_keyexpr_interner_t* this_, zc_moved_keyexpr_interner_t* x) { *this_ = x->_this; zc_internal_keyexpr_interner_null(&x->_this); }
+static inline void zc_keyexpr_matcher_take(zc_owned_keyexpr_matcher_t* this_, zc_moved_keyexpr_matcher_t* x) { *this_ = x->_this; zc_internal_keyexpr_matcher_null(&x->_this); }
 static inline void zc_matching_listener_take(zc_owned_matching_listener_t* this_, zc_moved_matching_listener_t* x) { *this_ = x->_this; zc_internal_matching_listener_null(&x->_this); }
+static inline void zc_shm_client_cache_take(zc_owned_shm_client_cache_t* this_, zc_moved_shm_client_cache_t* x) { *this_ = x->_this; zc_internal_shm_client_cache_null(&x->_this); }
 static inline void zc_shm_client_list_take(zc_owned_shm_client_list_t* this_, zc_moved_shm_client_list_t* x) { *this_ = x->_this; zc_internal_shm_client_list_null(&x->_this); }
+static inline void zc_shm_completion_queue_take(zc_owned_shm_completion_queue_t* this_, zc_moved_shm_completion_queue_t* x) { *this_ = x->_this; zc_internal_shm_completion_queue_null(&x->_this); }
+static inline void zc_string_arena_take(zc_owned_string_arena_t* this_, zc_moved_string_arena_t* x) { *this_ = x->_this; zc_internal_string_arena_null(&x->_this); }
 static inline void ze_advanced_publisher_take(ze_owned_advanced_publisher_t* this_, ze_moved_advanced_publisher_t* x) { *this_ = x->_this; ze_internal_advanced_publisher_null(&x->_this); }
 static inline void ze_advanced_subscriber_take(ze_owned_advanced_subscriber_t* this_, ze_moved_advanced_subscriber_t* x) { *this_ = x->_this; ze_internal_advanced_subscriber_null(&x->_this); }
+static inline void ze_cache_budget_take(ze_owned_cache_budget_t* this_, ze_moved_cache_budget_t* x) { *this_ = x->_this; ze_internal_cache_budget_null(&x->_this); }
 static inline void ze_closure_miss_take(ze_owned_closure_miss_t* closure_, ze_moved_closure_miss_t* x) { *closure_ = x->_this; ze_internal_closure_miss_null(&x->_this); }
 static inline void ze_publication_cache_take(ze_owned_publication_cache_t* this_, ze_moved_publication_cache_t* x) { *this_ = x->_this; ze_internal_publication_cache_null(&x->_this); }
 static inline void ze_querying_subscriber_take(ze_owned_querying_subscriber_t* this_, ze_moved_querying_subscriber_t* x) { *this_ = x->_this; ze_internal_querying_subscriber_null(&x->_this); }
@@ -373,9 +488,11 @@ static inline void ze_serializer_take(ze_owned_serializer_t* this_, ze_moved_ser
 
 #define z_take(this_, x) \
     _Generic((this_), \
+        z_owned_adaptive_mutex_t* : z_adaptive_mutex_take, \
         z_owned_alloc_layout_t* : z_alloc_layout_take, \
         z_owned_bytes_t* : z_bytes_take, \
         z_owned_bytes_writer_t* : z_bytes_writer_take, \
+        z_owned_cancellation_token_t* : z_cancellation_token_take, \
         z_owned_chunk_alloc_result_t* : z_chunk_alloc_result_take, \
         z_owned_closure_hello_t* : z_closure_hello_take, \
         z_owned_closure_query_t* : z_closure_query_take, \
@@ -384,7 +501,10 @@ static inline void ze_serializer_take(ze_owned_serializer_t* this_, ze_moved_ser
         z_owned_closure_zid_t* : z_closure_zid_take, \
         z_owned_condvar_t* : z_condvar_take, \
         z_owned_config_t* : z_config_take, \
+        z_owned_conflating_handler_sample_t* : z_conflating_handler_sample_take, \
+        z_owned_credit_handler_reply_t* : z_credit_handler_reply_take, \
         z_owned_encoding_t* : z_encoding_take, \
+        z_owned_executor_t* : z_executor_take, \
         z_owned_fifo_handler_query_t* : z_fifo_handler_query_take, \
         z_owned_fifo_handler_reply_t* : z_fifo_handler_reply_take, \
         z_owned_fifo_handler_sample_t* : z_fifo_handler_sample_take, \
@@ -393,6 +513,7 @@ static inline void ze_serializer_take(ze_owned_serializer_t* this_, ze_moved_ser
         z_owned_liveliness_token_t* : z_liveliness_token_take, \
         z_owned_memory_layout_t* : z_memory_layout_take, \
         z_owned_mutex_t* : z_mutex_take, \
+        z_owned_priority_handler_sample_t* : z_priority_handler_sample_take, \
         z_owned_publisher_t* : z_publisher_take, \
         z_owned_querier_t* : z_querier_take, \
         z_owned_query_t* : z_query_take, \
@@ -402,7 +523,9 @@ static inline void ze_serializer_take(ze_owned_serializer_t* this_, ze_moved_ser
         z_owned_ring_handler_query_t* : z_ring_handler_query_take, \
         z_owned_ring_handler_reply_t* : z_ring_handler_reply_take, \
         z_owned_ring_handler_sample_t* : z_ring_handler_sample_take, \
+        z_owned_rwlock_t* : z_rwlock_take, \
         z_owned_sample_t* : z_sample_take, \
+        z_owned_semaphore_t* : z_semaphore_take, \
         z_owned_session_t* : z_session_take, \
         z_owned_shm_client_t* : z_shm_client_take, \
         z_owned_shm_client_storage_t* : z_shm_client_storage_take, \
@@ -411,17 +534,28 @@ static inline void ze_serializer_take(ze_owned_serializer_t* this_, ze_moved_ser
         z_owned_shm_provider_t* : z_shm_provider_take, \
         z_owned_slice_t* : z_slice_take, \
         z_owned_source_info_t* : z_source_info_take, \
+        z_owned_spsc_handler_sample_t* : z_spsc_handler_sample_take, \
         z_owned_string_array_t* : z_string_array_take, \
         z_owned_string_t* : z_string_take, \
         z_owned_subscriber_t* : z_subscriber_take, \
         z_owned_task_t* : z_task_take, \
+        zc_owned_bytes_pool_t* : zc_bytes_pool_take, \
+        zc_owned_closure_indexed_reply_t* : zc_closure_indexed_reply_take, \
+        zc_owned_closure_liveliness_changes_t* : zc_closure_liveliness_changes_take, \
         zc_owned_closure_log_t* : zc_closure_log_take, \
         zc_owned_closure_matching_status_t* : zc_closure_matching_status_take, \
+        zc_owned_closure_span_t* : zc_closure_span_take, \
         zc_owned_concurrent_close_handle_t* : zc_concurrent_close_handle_take, \
+        zc_owned_keyexpr_interner_t* : zc_keyexpr_interner_take, \
+        zc_owned_keyexpr_matcher_t* : zc_keyexpr_matcher_take, \
         zc_owned_matching_listener_t* : zc_matching_listener_take, \
+        zc_owned_shm_client_cache_t* : zc_shm_client_cache_take, \
         zc_owned_shm_client_list_t* : zc_shm_client_list_take, \
+        zc_owned_shm_completion_queue_t* : zc_shm_completion_queue_take, \
+        zc_owned_string_arena_t* : zc_string_arena_take, \
         ze_owned_advanced_publisher_t* : ze_advanced_publisher_take, \
         ze_owned_advanced_subscriber_t* : ze_advanced_subscriber_take, \
+        ze_owned_cache_budget_t* : ze_cache_budget_take, \
         ze_owned_closure_miss_t* : ze_closure_miss_take, \
         ze_owned_publication_cache_t* : ze_publication_cache_take, \
         ze_owned_querying_subscriber_t* : ze_querying_subscriber_take, \
@@ -431,9 +565,11 @@ static inline void ze_serializer_take(ze_owned_serializer_t* this_, ze_moved_ser
 
 #define z_internal_check(this_) \
     _Generic((this_), \
+        z_owned_adaptive_mutex_t : z_internal_adaptive_mutex_check, \
         z_owned_alloc_layout_t : z_internal_alloc_layout_check, \
         z_owned_bytes_t : z_internal_bytes_check, \
         z_owned_bytes_writer_t : z_internal_bytes_writer_check, \
+        z_owned_cancellation_token_t : z_internal_cancellation_token_check, \
         z_owned_chunk_alloc_result_t : z_internal_chunk_alloc_result_check, \
         z_owned_closure_hello_t : z_internal_closure_hello_check, \
         z_owned_closure_query_t : z_internal_closure_query_check, \
@@ -442,7 +578,10 @@ static inline void ze_serializer_take(ze_owned_serializer_t* this_, ze_moved_ser
         z_owned_closure_zid_t : z_internal_closure_zid_check, \
         z_owned_condvar_t : z_internal_condvar_check, \
         z_owned_config_t : z_internal_config_check, \
+        z_owned_conflating_handler_sample_t : z_internal_conflating_handler_sample_check, \
+        z_owned_credit_handler_reply_t : z_internal_credit_handler_reply_check, \
         z_owned_encoding_t : z_internal_encoding_check, \
+        z_owned_executor_t : z_internal_executor_check, \
         z_owned_fifo_handler_query_t : z_internal_fifo_handler_query_check, \
         z_owned_fifo_handler_reply_t : z_internal_fifo_handler_reply_check, \
         z_owned_fifo_handler_sample_t : z_internal_fifo_handler_sample_check, \
@@ -451,6 +590,7 @@ static inline void ze_serializer_take(ze_owned_serializer_t* this_, ze_moved_ser
         z_owned_liveliness_token_t : z_internal_liveliness_token_check, \
         z_owned_memory_layout_t : z_internal_memory_layout_check, \
         z_owned_mutex_t : z_internal_mutex_check, \
+        z_owned_priority_handler_sample_t : z_internal_priority_handler_sample_check, \
         z_owned_publisher_t : z_internal_publisher_check, \
         z_owned_querier_t : z_internal_querier_check, \
         z_owned_query_t : z_internal_query_check, \
@@ -460,7 +600,9 @@ static inline void ze_serializer_take(ze_owned_serializer_t* this_, ze_moved_ser
         z_owned_ring_handler_query_t : z_internal_ring_handler_query_check, \
         z_owned_ring_handler_reply_t : z_internal_ring_handler_reply_check, \
         z_owned_ring_handler_sample_t : z_internal_ring_handler_sample_check, \
+        z_owned_rwlock_t : z_internal_rwlock_check, \
         z_owned_sample_t : z_internal_sample_check, \
+        z_owned_semaphore_t : z_internal_semaphore_check, \
         z_owned_session_t : z_internal_session_check, \
         z_owned_shm_t : z_internal_shm_check, \
         z_owned_shm_client_t : z_internal_shm_client_check, \
@@ -469,17 +611,28 @@ static inline void ze_serializer_take(ze_owned_serializer_t* this_, ze_moved_ser
         z_owned_shm_provider_t : z_internal_shm_provider_check, \
         z_owned_slice_t : z_internal_slice_check, \
         z_owned_source_info_t : z_internal_source_info_check, \
+        z_owned_spsc_handler_sample_t : z_internal_spsc_handler_sample_check, \
         z_owned_string_array_t : z_internal_string_array_check, \
         z_owned_string_t : z_internal_string_check, \
         z_owned_subscriber_t : z_internal_subscriber_check, \
         z_owned_task_t : z_internal_task_check, \
+        zc_owned_bytes_pool_t : zc_internal_bytes_pool_check, \
+        zc_owned_closure_indexed_reply_t : zc_internal_closure_indexed_reply_check, \
+        zc_owned_closure_liveliness_changes_t : zc_internal_closure_liveliness_changes_check, \
         zc_owned_closure_log_t : zc_internal_closure_log_check, \
         zc_owned_closure_matching_status_t : zc_internal_closure_matching_status_check, \
+        zc_owned_closure_span_t : zc_internal_closure_span_check, \
         zc_owned_concurrent_close_handle_t : zc_internal_concurrent_close_handle_check, \
+        zc_owned_keyexpr_interner_t : zc_internal_keyexpr_interner_check, \
+        zc_owned_keyexpr_matcher_t : zc_internal_keyexpr_matcher_check, \
         zc_owned_matching_listener_t : zc_internal_matching_listener_check, \
+        zc_owned_shm_client_cache_t : zc_internal_shm_client_cache_check, \
         zc_owned_shm_client_list_t : zc_internal_shm_client_list_check, \
+        zc_owned_shm_completion_queue_t : zc_internal_shm_completion_queue_check, \
+        zc_owned_string_arena_t : zc_internal_string_arena_check, \
         ze_owned_advanced_publisher_t : ze_internal_advanced_publisher_check, \
         ze_owned_advanced_subscriber_t : ze_internal_advanced_subscriber_check, \
+        ze_owned_cache_budget_t : ze_internal_cache_budget_check, \
         ze_owned_closure_miss_t : ze_internal_closure_miss_check, \
         ze_owned_publication_cache_t : ze_internal_publication_cache_check, \
         ze_owned_querying_subscriber_t : ze_internal_querying_subscriber_check, \
@@ -494,7 +647,9 @@ static inline void ze_serializer_take(ze_owned_serializer_t* this_, ze_moved_ser
         const z_loaned_closure_reply_t* : z_closure_reply_call, \
         const z_loaned_closure_sample_t* : z_closure_sample_call, \
         const z_loaned_closure_zid_t* : z_closure_zid_call, \
+        const zc_loaned_closure_liveliness_changes_t* : zc_closure_liveliness_changes_call, \
         const zc_loaned_closure_matching_status_t* : zc_closure_matching_status_call, \
+        const zc_loaned_closure_span_t* : zc_closure_span_call, \
         const ze_loaned_closure_miss_t* : ze_closure_miss_call \
     )(closure, hello)
 
@@ -504,8 +659,10 @@ typedef void(*z_closure_query_callback_t)(z_loaned_query_t *query, void *context
 typedef void(*z_closure_reply_callback_t)(z_loaned_reply_t *reply, void *context);
 typedef void(*z_closure_sample_callback_t)(z_loaned_sample_t *sample, void *context);
 typedef void(*z_closure_zid_callback_t)(const z_id_t *z_id, void *context);
+typedef void(*zc_closure_liveliness_changes_callback_t)(const zc_liveliness_changes_t *changes, void *context);
 typedef void(*zc_closure_log_callback_t)(zc_log_severity_t severity, const z_loaned_string_t *msg, void *context);
 typedef void(*zc_closure_matching_status_callback_t)(const zc_matching_status_t *matching_status, void *context);
+typedef void(*zc_closure_span_callback_t)(const zc_span_t *span, void *context);
 typedef void(*ze_closure_miss_callback_t)(const ze_miss_t *matching_status, void *context);
 
 #define z_closure(this_, call, drop, context) \
@@ -515,34 +672,45 @@ typedef void(*ze_closure_miss_callback_t)(const ze_miss_t *matching_status, void
         z_owned_closure_reply_t* : z_closure_reply, \
         z_owned_closure_sample_t* : z_closure_sample, \
         z_owned_closure_zid_t* : z_closure_zid, \
+        zc_owned_closure_liveliness_changes_t* : zc_closure_liveliness_changes, \
         zc_owned_closure_log_t* : zc_closure_log, \
         zc_owned_closure_matching_status_t* : zc_closure_matching_status, \
+        zc_owned_closure_span_t* : zc_closure_span, \
         ze_owned_closure_miss_t* : ze_closure_miss \
     )(this_, call, drop, context)
 
 #define z_try_recv(this_, query) \
     _Generic((this_), \
+        const z_loaned_conflating_handler_sample_t* : z_conflating_handler_sample_try_recv, \
+        const z_loaned_credit_handler_reply_t* : z_credit_handler_reply_try_recv, \
         const z_loaned_fifo_handler_query_t* : z_fifo_handler_query_try_recv, \
         const z_loaned_fifo_handler_reply_t* : z_fifo_handler_reply_try_recv, \
         const z_loaned_fifo_handler_sample_t* : z_fifo_handler_sample_try_recv, \
+        const z_loaned_priority_handler_sample_t* : z_priority_handler_sample_try_recv, \
         const z_loaned_ring_handler_query_t* : z_ring_handler_query_try_recv, \
         const z_loaned_ring_handler_reply_t* : z_ring_handler_reply_try_recv, \
-        const z_loaned_ring_handler_sample_t* : z_ring_handler_sample_try_recv \
+        const z_loaned_ring_handler_sample_t* : z_ring_handler_sample_try_recv, \
+        const z_loaned_spsc_handler_sample_t* : z_spsc_handler_sample_try_recv \
     )(this_, query)
 
 #define z_recv(this_, query) \
     _Generic((this_), \
+        const z_loaned_conflating_handler_sample_t* : z_conflating_handler_sample_recv, \
+        const z_loaned_credit_handler_reply_t* : z_credit_handler_reply_recv, \
         const z_loaned_fifo_handler_query_t* : z_fifo_handler_query_recv, \
         const z_loaned_fifo_handler_reply_t* : z_fifo_handler_reply_recv, \
         const z_loaned_fifo_handler_sample_t* : z_fifo_handler_sample_recv, \
+        const z_loaned_priority_handler_sample_t* : z_priority_handler_sample_recv, \
         const z_loaned_ring_handler_query_t* : z_ring_handler_query_recv, \
         const z_loaned_ring_handler_reply_t* : z_ring_handler_reply_recv, \
-        const z_loaned_ring_handler_sample_t* : z_ring_handler_sample_recv \
+        const z_loaned_ring_handler_sample_t* : z_ring_handler_sample_recv, \
+        const z_loaned_spsc_handler_sample_t* : z_spsc_handler_sample_recv \
     )(this_, query)
 
 #define z_clone(dst, this_) \
     _Generic((dst), \
         z_owned_bytes_t* : z_bytes_clone, \
+        z_owned_cancellation_token_t* : z_cancellation_token_clone, \
         z_owned_config_t* : z_config_clone, \
         z_owned_encoding_t* : z_encoding_clone, \
         z_owned_hello_t* : z_hello_clone, \
@@ -555,14 +723,17 @@ typedef void(*ze_closure_miss_callback_t)(const ze_miss_t *matching_status, void
         z_owned_shm_t* : z_shm_clone, \
         z_owned_slice_t* : z_slice_clone, \
         z_owned_string_array_t* : z_string_array_clone, \
-        z_owned_string_t* : z_string_clone \
+        z_owned_string_t* : z_string_clone, \
+        zc_owned_string_arena_t* : zc_string_arena_clone \
     )(dst, this_)
 #else  // #ifndef __cplusplus
 
 
+static inline z_moved_adaptive_mutex_t* z_adaptive_mutex_move(z_owned_adaptive_mutex_t* x) { return reinterpret_cast<z_moved_adaptive_mutex_t*>(x); }
 static inline z_moved_alloc_layout_t* z_alloc_layout_move(z_owned_alloc_layout_t* x) { return reinterpret_cast<z_moved_alloc_layout_t*>(x); }
 static inline z_moved_bytes_t* z_bytes_move(z_owned_bytes_t* x) { return reinterpret_cast<z_moved_bytes_t*>(x); }
 static inline z_moved_bytes_writer_t* z_bytes_writer_move(z_owned_bytes_writer_t* x) { return reinterpret_cast<z_moved_bytes_writer_t*>(x); }
+static inline z_moved_cancellation_token_t* z_cancellation_token_move(z_owned_cancellation_token_t* x) { return reinterpret_cast<z_moved_cancellation_token_t*>(x); }
 static inline z_moved_chunk_alloc_result_t* z_chunk_alloc_result_move(z_owned_chunk_alloc_result_t* x) { return reinterpret_cast<z_moved_chunk_alloc_result_t*>(x); }
 static inline z_moved_closure_hello_t* z_closure_hello_move(z_owned_closure_hello_t* x) { return reinterpret_cast<z_moved_closure_hello_t*>(x); }
 static inline z_moved_closure_query_t* z_closure_query_move(z_owned_closure_query_t* x) { return reinterpret_cast<z_moved_closure_query_t*>(x); }
@@ -571,7 +742,10 @@ static inline z_moved_closure_sample_t* z_closure_sample_move(z_owned_closure_sa
 static inline z_moved_closure_zid_t* z_closure_zid_move(z_owned_closure_zid_t* x) { return reinterpret_cast<z_moved_closure_zid_t*>(x); }
 static inline z_moved_condvar_t* z_condvar_move(z_owned_condvar_t* x) { return reinterpret_cast<z_moved_condvar_t*>(x); }
 static inline z_moved_config_t* z_config_move(z_owned_config_t* x) { return reinterpret_cast<z_moved_config_t*>(x); }
+static inline z_moved_conflating_handler_sample_t* z_conflating_handler_sample_move(z_owned_conflating_handler_sample_t* x) { return reinterpret_cast<z_moved_conflating_handler_sample_t*>(x); }
+static inline z_moved_credit_handler_reply_t* z_credit_handler_reply_move(z_owned_credit_handler_reply_t* x) { return reinterpret_cast<z_moved_credit_handler_reply_t*>(x); }
 static inline z_moved_encoding_t* z_encoding_move(z_owned_encoding_t* x) { return reinterpret_cast<z_moved_encoding_t*>(x); }
+static inline z_moved_executor_t* z_executor_move(z_owned_executor_t* x) { return reinterpret_cast<z_moved_executor_t*>(x); }
 static inline z_moved_fifo_handler_query_t* z_fifo_handler_query_move(z_owned_fifo_handler_query_t* x) { return reinterpret_cast<z_moved_fifo_handler_query_t*>(x); }
 static inline z_moved_fifo_handler_reply_t* z_fifo_handler_reply_move(z_owned_fifo_handler_reply_t* x) { return reinterpret_cast<z_moved_fifo_handler_reply_t*>(x); }
 static inline z_moved_fifo_handler_sample_t* z_fifo_handler_sample_move(z_owned_fifo_handler_sample_t* x) { return reinterpret_cast<z_moved_fifo_handler_sample_t*>(x); }
@@ -580,6 +754,7 @@ static inline z_moved_keyexpr_t* z_keyexpr_move(z_owned_keyexpr_t* x) { return r
 static inline z_moved_liveliness_token_t* z_liveliness_token_move(z_owned_liveliness_token_t* x) { return reinterpret_cast<z_moved_liveliness_token_t*>(x); }
 static inline z_moved_memory_layout_t* z_memory_layout_move(z_owned_memory_layout_t* x) { return reinterpret_cast<z_moved_memory_layout_t*>(x); }
 static inline z_moved_mutex_t* z_mutex_move(z_owned_mutex_t* x) { return reinterpret_cast<z_moved_mutex_t*>(x); }
+static inline z_moved_priority_handler_sample_t* z_priority_handler_sample_move(z_owned_priority_handler_sample_t* x) { return reinterpret_cast<z_moved_priority_handler_sample_t*>(x); }
 static inline z_moved_publisher_t* z_publisher_move(z_owned_publisher_t* x) { return reinterpret_cast<z_moved_publisher_t*>(x); }
 static inline z_moved_querier_t* z_querier_move(z_owned_querier_t* x) { return reinterpret_cast<z_moved_querier_t*>(x); }
 static inline z_moved_query_t* z_query_move(z_owned_query_t* x) { return reinterpret_cast<z_moved_query_t*>(x); }
@@ -589,7 +764,9 @@ static inline z_moved_reply_err_t* z_reply_err_move(z_owned_reply_err_t* x) { re
 static inline z_moved_ring_handler_query_t* z_ring_handler_query_move(z_owned_ring_handler_query_t* x) { return reinterpret_cast<z_moved_ring_handler_query_t*>(x); }
 static inline z_moved_ring_handler_reply_t* z_ring_handler_reply_move(z_owned_ring_handler_reply_t* x) { return reinterpret_cast<z_moved_ring_handler_reply_t*>(x); }
 static inline z_moved_ring_handler_sample_t* z_ring_handler_sample_move(z_owned_ring_handler_sample_t* x) { return reinterpret_cast<z_moved_ring_handler_sample_t*>(x); }
+static inline z_moved_rwlock_t* z_rwlock_move(z_owned_rwlock_t* x) { return reinterpret_cast<z_moved_rwlock_t*>(x); }
 static inline z_moved_sample_t* z_sample_move(z_owned_sample_t* x) { return reinterpret_cast<z_moved_sample_t*>(x); }
+static inline z_moved_semaphore_t* z_semaphore_move(z_owned_semaphore_t* x) { return reinterpret_cast<z_moved_semaphore_t*>(x); }
 static inline z_moved_session_t* z_session_move(z_owned_session_t* x) { return reinterpret_cast<z_moved_session_t*>(x); }
 static inline z_moved_shm_client_t* z_shm_client_move(z_owned_shm_client_t* x) { return reinterpret_cast<z_moved_shm_client_t*>(x); }
 static inline z_moved_shm_client_storage_t* z_shm_client_storage_move(z_owned_shm_client_storage_t* x) { return reinterpret_cast<z_moved_shm_client_storage_t*>(x); }
@@ -598,17 +775,28 @@ static inline z_moved_shm_mut_t* z_shm_mut_move(z_owned_shm_mut_t* x) { return r
 static inline z_moved_shm_provider_t* z_shm_provider_move(z_owned_shm_provider_t* x) { return reinterpret_cast<z_moved_shm_provider_t*>(x); }
 static inline z_moved_slice_t* z_slice_move(z_owned_slice_t* x) { return reinterpret_cast<z_moved_slice_t*>(x); }
 static inline z_moved_source_info_t* z_source_info_move(z_owned_source_info_t* x) { return reinterpret_cast<z_moved_source_info_t*>(x); }
+static inline z_moved_spsc_handler_sample_t* z_spsc_handler_sample_move(z_owned_spsc_handler_sample_t* x) { return reinterpret_cast<z_moved_spsc_handler_sample_t*>(x); }
 static inline z_moved_string_array_t* z_string_array_move(z_owned_string_array_t* x) { return reinterpret_cast<z_moved_string_array_t*>(x); }
 static inline z_moved_string_t* z_string_move(z_owned_string_t* x) { return reinterpret_cast<z_moved_string_t*>(x); }
 static inline z_moved_subscriber_t* z_subscriber_move(z_owned_subscriber_t* x) { return reinterpret_cast<z_moved_subscriber_t*>(x); }
 static inline z_moved_task_t* z_task_move(z_owned_task_t* x) { return reinterpret_cast<z_moved_task_t*>(x); }
+static inline zc_moved_bytes_pool_t* zc_bytes_pool_move(zc_owned_bytes_pool_t* x) { return reinterpret_cast<zc_moved_bytes_pool_t*>(x); }
+static inline zc_moved_closure_indexed_reply_t* zc_closure_indexed_reply_move(zc_owned_closure_indexed_reply_t* x) { return reinterpret_cast<zc_moved_closure_indexed_reply_t*>(x); }
+static inline zc_moved_closure_liveliness_changes_t* zc_closure_liveliness_changes_move(zc_owned_closure_liveliness_changes_t* x) { return reinterpret_cast<zc_moved_closure_liveliness_changes_t*>(x); }
 static inline zc_moved_closure_log_t* zc_closure_log_move(zc_owned_closure_log_t* x) { return reinterpret_cast<zc_moved_closure_log_t*>(x); }
 static inline zc_moved_closure_matching_status_t* zc_closure_matching_status_move(zc_owned_closure_matching_status_t* x) { return reinterpret_cast<zc_moved_closure_matching_status_t*>(x); }
+static inline zc_moved_closure_span_t* zc_closure_span_move(zc_owned_closure_span_t* x) { return reinterpret_cast<zc_moved_closure_span_t*>(x); }
 static inline zc_moved_concurrent_close_handle_t* zc_concurrent_close_handle_move(zc_owned_concurrent_close_handle_t* x) { return reinterpret_cast<zc_moved_concurrent_close_handle_t*>(x); }
+static inline zc_moved_keyexpr_interner_t* zc_keyexpr_interner_move(zc_owned_keyexpr_interner_t* x) { return reinterpret_cast<zc_moved_keyexpr_interner_t*>(x); }
+static inline zc_moved_keyexpr_matcher_t* zc_keyexpr_matcher_move(zc_owned_keyexpr_matcher_t* x) { return reinterpret_cast<zc_moved_keyexpr_matcher_t*>(x); }
 static inline zc_moved_matching_listener_t* zc_matching_listener_move(zc_owned_matching_listener_t* x) { return reinterpret_cast<zc_moved_matching_listener_t*>(x); }
+static inline zc_moved_shm_client_cache_t* zc_shm_client_cache_move(zc_owned_shm_client_cache_t* x) { return reinterpret_cast<zc_moved_shm_client_cache_t*>(x); }
 static inline zc_moved_shm_client_list_t* zc_shm_client_list_move(zc_owned_shm_client_list_t* x) { return reinterpret_cast<zc_moved_shm_client_list_t*>(x); }
+static inline zc_moved_shm_completion_queue_t* zc_shm_completion_queue_move(zc_owned_shm_completion_queue_t* x) { return reinterpret_cast<zc_moved_shm_completion_queue_t*>(x); }
+static inline zc_moved_string_arena_t* zc_string_arena_move(zc_owned_string_arena_t* x) { return reinterpret_cast<zc_moved_string_arena_t*>(x); }
 static inline ze_moved_advanced_publisher_t* ze_advanced_publisher_move(ze_owned_advanced_publisher_t* x) { return reinterpret_cast<ze_moved_advanced_publisher_t*>(x); }
 static inline ze_moved_advanced_subscriber_t* ze_advanced_subscriber_move(ze_owned_advanced_subscriber_t* x) { return reinterpret_cast<ze_moved_advanced_subscriber_t*>(x); }
+static inline ze_moved_cache_budget_t* ze_cache_budget_move(ze_owned_cache_budget_t* x) { return reinterpret_cast<ze_moved_cache_budget_t*>(x); }
 static inline ze_moved_closure_miss_t* ze_closure_miss_move(ze_owned_closure_miss_t* x) { return reinterpret_cast<ze_moved_closure_miss_t*>(x); }
 static inline ze_moved_publication_cache_t* ze_publication_cache_move(ze_owned_publication_cache_t* x) { return reinterpret_cast<ze_moved_publication_cache_t*>(x); }
 static inline ze_moved_querying_subscriber_t* ze_querying_subscriber_move(ze_owned_querying_subscriber_t* x) { return reinterpret_cast<ze_moved_querying_subscriber_t*>(x); }
@@ -617,9 +805,11 @@ static inline ze_moved_serializer_t* ze_serializer_move(ze_owned_serializer_t* x
 
 
 
+inline const z_loaned_adaptive_mutex_t* z_loan(const z_owned_adaptive_mutex_t& this_) { return z_adaptive_mutex_loan(&this_); };
 inline const z_loaned_alloc_layout_t* z_loan(const z_owned_alloc_layout_t& this_) { return z_alloc_layout_loan(&this_); };
 inline const z_loaned_bytes_t* z_loan(const z_owned_bytes_t& this_) { return z_bytes_loan(&this_); };
 inline const z_loaned_bytes_writer_t* z_loan(const z_owned_bytes_writer_t& this_) { return z_bytes_writer_loan(&this_); };
+inline const z_loaned_cancellation_token_t* z_loan(const z_owned_cancellation_token_t& this_) { return z_cancellation_token_loan(&this_); };
 inline const z_loaned_closure_hello_t* z_loan(const z_owned_closure_hello_t& closure) { return z_closure_hello_loan(&closure); };
 inline const z_loaned_closure_query_t* z_loan(const z_owned_closure_query_t& closure) { return z_closure_query_loan(&closure); };
 inline const z_loaned_closure_reply_t* z_loan(const z_owned_closure_reply_t& closure) { return z_closure_reply_loan(&closure); };
@@ -627,7 +817,10 @@ inline const z_loaned_closure_sample_t* z_loan(const z_owned_closure_sample_t& c
 inline const z_loaned_closure_zid_t* z_loan(const z_owned_closure_zid_t& closure) { return z_closure_zid_loan(&closure); };
 inline const z_loaned_condvar_t* z_loan(const z_owned_condvar_t& this_) { return z_condvar_loan(&this_); };
 inline const z_loaned_config_t* z_loan(const z_owned_config_t& this_) { return z_config_loan(&this_); };
+inline const z_loaned_conflating_handler_sample_t* z_loan(const z_owned_conflating_handler_sample_t& this_) { return z_conflating_handler_sample_loan(&this_); };
+inline const z_loaned_credit_handler_reply_t* z_loan(const z_owned_credit_handler_reply_t& this_) { return z_credit_handler_reply_loan(&this_); };
 inline const z_loaned_encoding_t* z_loan(const z_owned_encoding_t& this_) { return z_encoding_loan(&this_); };
+inline const z_loaned_executor_t* z_loan(const z_owned_executor_t& this_) { return z_executor_loan(&this_); };
 inline const z_loaned_fifo_handler_query_t* z_loan(const z_owned_fifo_handler_query_t& this_) { return z_fifo_handler_query_loan(&this_); };
 inline const z_loaned_fifo_handler_reply_t* z_loan(const z_owned_fifo_handler_reply_t& this_) { return z_fifo_handler_reply_loan(&this_); };
 inline const z_loaned_fifo_handler_sample_t* z_loan(const z_owned_fifo_handler_sample_t& this_) { return z_fifo_handler_sample_loan(&this_); };
@@ -635,6 +828,7 @@ inline const z_loaned_hello_t* z_loan(const z_owned_hello_t& this_) { return z_h
 inline const z_loaned_keyexpr_t* z_loan(const z_owned_keyexpr_t& this_) { return z_keyexpr_loan(&this_); };
 inline const z_loaned_liveliness_token_t* z_loan(const z_owned_liveliness_token_t& this_) { return z_liveliness_token_loan(&this_); };
 inline const z_loaned_memory_layout_t* z_loan(const z_owned_memory_layout_t& this_) { return z_memory_layout_loan(&this_); };
+inline const z_loaned_priority_handler_sample_t* z_loan(const z_owned_priority_handler_sample_t& this_) { return z_priority_handler_sample_loan(&this_); };
 inline const z_loaned_publisher_t* z_loan(const z_owned_publisher_t& this_) { return z_publisher_loan(&this_); };
 inline const z_loaned_querier_t* z_loan(const z_owned_querier_t& this_) { return z_querier_loan(&this_); };
 inline const z_loaned_query_t* z_loan(const z_owned_query_t& this_) { return z_query_loan(&this_); };
@@ -644,7 +838,9 @@ inline const z_loaned_reply_t* z_loan(const z_owned_reply_t& this_) { return z_r
 inline const z_loaned_ring_handler_query_t* z_loan(const z_owned_ring_handler_query_t& this_) { return z_ring_handler_query_loan(&this_); };
 inline const z_loaned_ring_handler_reply_t* z_loan(const z_owned_ring_handler_reply_t& this_) { return z_ring_handler_reply_loan(&this_); };
 inline const z_loaned_ring_handler_sample_t* z_loan(const z_owned_ring_handler_sample_t& this_) { return z_ring_handler_sample_loan(&this_); };
+inline const z_loaned_rwlock_t* z_loan(const z_owned_rwlock_t& this_) { return z_rwlock_loan(&this_); };
 inline const z_loaned_sample_t* z_loan(const z_owned_sample_t& this_) { return z_sample_loan(&this_); };
+inline const z_loaned_semaphore_t* z_loan(const z_owned_semaphore_t& this_) { return z_semaphore_loan(&this_); };
 inline const z_loaned_session_t* z_loan(const z_owned_session_t& this_) { return z_session_loan(&this_); };
 inline const z_loaned_shm_client_storage_t* z_loan(const z_owned_shm_client_storage_t& this_) { return z_shm_client_storage_loan(&this_); };
 inline const z_loaned_shm_t* z_loan(const z_owned_shm_t& this_) { return z_shm_loan(&this_); };
@@ -652,17 +848,28 @@ inline const z_loaned_shm_mut_t* z_loan(const z_owned_shm_mut_t& this_) { return
 inline const z_loaned_shm_provider_t* z_loan(const z_owned_shm_provider_t& this_) { return z_shm_provider_loan(&this_); };
 inline const z_loaned_slice_t* z_loan(const z_owned_slice_t& this_) { return z_slice_loan(&this_); };
 inline const z_loaned_source_info_t* z_loan(const z_owned_source_info_t& this_) { return z_source_info_loan(&this_); };
+inline const z_loaned_spsc_handler_sample_t* z_loan(const z_owned_spsc_handler_sample_t& this_) { return z_spsc_handler_sample_loan(&this_); };
 inline const z_loaned_string_array_t* z_loan(const z_owned_string_array_t& this_) { return z_string_array_loan(&this_); };
 inline const z_loaned_string_t* z_loan(const z_owned_string_t& this_) { return z_string_loan(&this_); };
 inline const z_loaned_subscriber_t* z_loan(const z_owned_subscriber_t& this_) { return z_subscriber_loan(&this_); };
 inline const z_loaned_keyexpr_t* z_loan(const z_view_keyexpr_t& this_) { return z_view_keyexpr_loan(&this_); };
 inline const z_loaned_slice_t* z_loan(const z_view_slice_t& this_) { return z_view_slice_loan(&this_); };
 inline const z_loaned_string_t* z_loan(const z_view_string_t& this_) { return z_view_string_loan(&this_); };
+inline const zc_loaned_bytes_pool_t* z_loan(const zc_owned_bytes_pool_t& this_) { return zc_bytes_pool_loan(&this_); };
+inline const zc_loaned_closure_indexed_reply_t* z_loan(const zc_owned_closure_indexed_reply_t& this_) { return zc_closure_indexed_reply_loan(&this_); };
+inline const zc_loaned_closure_liveliness_changes_t* z_loan(const zc_owned_closure_liveliness_changes_t& this_) { return zc_closure_liveliness_changes_loan(&this_); };
 inline const zc_loaned_closure_log_t* z_loan(const zc_owned_closure_log_t& closure) { return zc_closure_log_loan(&closure); };
 inline const zc_loaned_closure_matching_status_t* z_loan(const zc_owned_closure_matching_status_t& closure) { return zc_closure_matching_status_loan(&closure); };
+inline const zc_loaned_closure_span_t* z_loan(const zc_owned_closure_span_t& this_) { return zc_closure_span_loan(&this_); };
+inline const zc_loaned_keyexpr_interner_t* z_loan(const zc_owned_keyexpr_interner_t& this_) { return zc_keyexpr_interner_loan(&this_); };
+inline const zc_loaned_keyexpr_matcher_t* z_loan(const zc_owned_keyexpr_matcher_t& this_) { return zc_keyexpr_matcher_loan(&this_); };
+inline const zc_loaned_shm_client_cache_t* z_loan(const zc_owned_shm_client_cache_t& this_) { return zc_shm_client_cache_loan(&this_); };
 inline const zc_loaned_shm_client_list_t* z_loan(const zc_owned_shm_client_list_t& this_) { return zc_shm_client_list_loan(&this_); };
+inline const zc_loaned_shm_completion_queue_t* z_loan(const zc_owned_shm_completion_queue_t& this_) { return zc_shm_completion_queue_loan(&this_); };
+inline const zc_loaned_string_arena_t* z_loan(const zc_owned_string_arena_t& this_) { return zc_string_arena_loan(&this_); };
 inline const ze_loaned_advanced_publisher_t* z_loan(const ze_owned_advanced_publisher_t& this_) { return ze_advanced_publisher_loan(&this_); };
 inline const ze_loaned_advanced_subscriber_t* z_loan(const ze_owned_advanced_subscriber_t& this_) { return ze_advanced_subscriber_loan(&this_); };
+inline const ze_loaned_cache_budget_t* z_loan(const ze_owned_cache_budget_t& this_) { return ze_cache_budget_loan(&this_); };
 inline const ze_loaned_closure_miss_t* z_loan(const ze_owned_closure_miss_t& closure) { return ze_closure_miss_loan(&closure); };
 inline const ze_loaned_publication_cache_t* z_loan(const ze_owned_publication_cache_t& this_) { return ze_publication_cache_loan(&this_); };
 inline const ze_loaned_querying_subscriber_t* z_loan(const ze_owned_querying_subscriber_t& this_) { return ze_querying_subscriber_loan(&this_); };
@@ -690,13 +897,16 @@ inline z_loaned_shm_t* z_loan_mut(z_owned_shm_t& this_) { return z_shm_loan_mut(
 inline z_loaned_shm_mut_t* z_loan_mut(z_owned_shm_mut_t& this_) { return z_shm_mut_loan_mut(&this_); };
 inline z_loaned_string_array_t* z_loan_mut(z_owned_string_array_t& this_) { return z_string_array_loan_mut(&this_); };
 inline zc_loaned_shm_client_list_t* z_loan_mut(zc_owned_shm_client_list_t& this_) { return zc_shm_client_list_loan_mut(&this_); };
+inline zc_loaned_string_arena_t* z_loan_mut(zc_owned_string_arena_t& this_) { return zc_string_arena_loan_mut(&this_); };
 inline ze_loaned_advanced_publisher_t* z_loan_mut(ze_owned_advanced_publisher_t& this_) { return ze_advanced_publisher_loan_mut(&this_); };
 inline ze_loaned_serializer_t* z_loan_mut(ze_owned_serializer_t& this_) { return ze_serializer_loan_mut(&this_); };
 
 
+inline void z_drop(z_moved_adaptive_mutex_t* this_) { z_adaptive_mutex_drop(this_); };
 inline void z_drop(z_moved_alloc_layout_t* this_) { z_alloc_layout_drop(this_); };
 inline void z_drop(z_moved_bytes_t* this_) { z_bytes_drop(this_); };
 inline void z_drop(z_moved_bytes_writer_t* this_) { z_bytes_writer_drop(this_); };
+inline void z_drop(z_moved_cancellation_token_t* this_) { z_cancellation_token_drop(this_); };
 inline void z_drop(z_moved_chunk_alloc_result_t* this_) { z_chunk_alloc_result_drop(this_); };
 inline void z_drop(z_moved_closure_hello_t* this_) { z_closure_hello_drop(this_); };
 inline void z_drop(z_moved_closure_query_t* closure_) { z_closure_query_drop(closure_); };
@@ -705,7 +915,10 @@ inline void z_drop(z_moved_closure_sample_t* closure_) { z_closure_sample_drop(c
 inline void z_drop(z_moved_closure_zid_t* closure_) { z_closure_zid_drop(closure_); };
 inline void z_drop(z_moved_condvar_t* this_) { z_condvar_drop(this_); };
 inline void z_drop(z_moved_config_t* this_) { z_config_drop(this_); };
+inline void z_drop(z_moved_conflating_handler_sample_t* this_) { z_conflating_handler_sample_drop(this_); };
+inline void z_drop(z_moved_credit_handler_reply_t* this_) { z_credit_handler_reply_drop(this_); };
 inline void z_drop(z_moved_encoding_t* this_) { z_encoding_drop(this_); };
+inline void z_drop(z_moved_executor_t* this_) { z_executor_drop(this_); };
 inline void z_drop(z_moved_fifo_handler_query_t* this_) { z_fifo_handler_query_drop(this_); };
 inline void z_drop(z_moved_fifo_handler_reply_t* this_) { z_fifo_handler_reply_drop(this_); };
 inline void z_drop(z_moved_fifo_handler_sample_t* this_) { z_fifo_handler_sample_drop(this_); };
@@ -714,6 +927,7 @@ inline void z_drop(z_moved_keyexpr_t* this_) { z_keyexpr_drop(this_); };
 inline void z_drop(z_moved_liveliness_token_t* this_) { z_liveliness_token_drop(this_); };
 inline void z_drop(z_moved_memory_layout_t* this_) { z_memory_layout_drop(this_); };
 inline void z_drop(z_moved_mutex_t* this_) { z_mutex_drop(this_); };
+inline void z_drop(z_moved_priority_handler_sample_t* this_) { z_priority_handler_sample_drop(this_); };
 inline void z_drop(z_moved_publisher_t* this_) { z_publisher_drop(this_); };
 inline void z_drop(z_moved_querier_t* this_) { z_querier_drop(this_); };
 inline void z_drop(z_moved_query_t* this_) { z_query_drop(this_); };
@@ -723,7 +937,9 @@ inline void z_drop(z_moved_reply_err_t* this_) { z_reply_err_drop(this_); };
 inline void z_drop(z_moved_ring_handler_query_t* this_) { z_ring_handler_query_drop(this_); };
 inline void z_drop(z_moved_ring_handler_reply_t* this_) { z_ring_handler_reply_drop(this_); };
 inline void z_drop(z_moved_ring_handler_sample_t* this_) { z_ring_handler_sample_drop(this_); };
+inline void z_drop(z_moved_rwlock_t* this_) { z_rwlock_drop(this_); };
 inline void z_drop(z_moved_sample_t* this_) { z_sample_drop(this_); };
+inline void z_drop(z_moved_semaphore_t* this_) { z_semaphore_drop(this_); };
 inline void z_drop(z_moved_session_t* this_) { z_session_drop(this_); };
 inline void z_drop(z_moved_shm_client_t* this_) { z_shm_client_drop(this_); };
 inline void z_drop(z_moved_shm_client_storage_t* this_) { z_shm_client_storage_drop(this_); };
@@ -732,17 +948,28 @@ inline void z_drop(z_moved_shm_mut_t* this_) { z_shm_mut_drop(this_); };
 inline void z_drop(z_moved_shm_provider_t* this_) { z_shm_provider_drop(this_); };
 inline void z_drop(z_moved_slice_t* this_) { z_slice_drop(this_); };
 inline void z_drop(z_moved_source_info_t* this_) { z_source_info_drop(this_); };
+inline void z_drop(z_moved_spsc_handler_sample_t* this_) { z_spsc_handler_sample_drop(this_); };
 inline void z_drop(z_moved_string_array_t* this_) { z_string_array_drop(this_); };
 inline void z_drop(z_moved_string_t* this_) { z_string_drop(this_); };
 inline void z_drop(z_moved_subscriber_t* this_) { z_subscriber_drop(this_); };
 inline void z_drop(z_moved_task_t* this_) { z_task_drop(this_); };
+inline void z_drop(zc_moved_bytes_pool_t* this_) { zc_bytes_pool_drop(this_); };
+inline void z_drop(zc_moved_closure_indexed_reply_t* this_) { zc_closure_indexed_reply_drop(this_); };
+inline void z_drop(zc_moved_closure_liveliness_changes_t* this_) { zc_closure_liveliness_changes_drop(this_); };
 inline void z_drop(zc_moved_closure_log_t* closure_) { zc_closure_log_drop(closure_); };
 inline void z_drop(zc_moved_closure_matching_status_t* closure_) { zc_closure_matching_status_drop(closure_); };
+inline void z_drop(zc_moved_closure_span_t* this_) { zc_closure_span_drop(this_); };
 inline void z_drop(zc_moved_concurrent_close_handle_t* this_) { zc_concurrent_close_handle_drop(this_); };
+inline void z_drop(zc_moved_keyexpr_interner_t* this_) { zc_keyexpr_interner_drop(this_); };
+inline void z_drop(zc_moved_keyexpr_matcher_t* this_) { zc_keyexpr_matcher_drop(this_); };
 inline void z_drop(zc_moved_matching_listener_t* this_) { zc_matching_listener_drop(this_); };
+inline void z_drop(zc_moved_shm_client_cache_t* this_) { zc_shm_client_cache_drop(this_); };
 inline void z_drop(zc_moved_shm_client_list_t* this_) { zc_shm_client_list_drop(this_); };
+inline void z_drop(zc_moved_shm_completion_queue_t* this_) { zc_shm_completion_queue_drop(this_); };
+inline void z_drop(zc_moved_string_arena_t* this_) { zc_string_arena_drop(this_); };
 inline void z_drop(ze_moved_advanced_publisher_t* this_) { ze_advanced_publisher_drop(this_); };
 inline void z_drop(ze_moved_advanced_subscriber_t* this_) { ze_advanced_subscriber_drop(this_); };
+inline void z_drop(ze_moved_cache_budget_t* this_) { ze_cache_budget_drop(this_); };
 inline void z_drop(ze_moved_closure_miss_t* closure_) { ze_closure_miss_drop(closure_); };
 inline void z_drop(ze_moved_publication_cache_t* this_) { ze_publication_cache_drop(this_); };
 inline void z_drop(ze_moved_querying_subscriber_t* this_) { ze_querying_subscriber_drop(this_); };
@@ -750,9 +977,11 @@ inline void z_drop(ze_moved_sample_miss_listener_t* this_) { ze_sample_miss_list
 inline void z_drop(ze_moved_serializer_t* this_) { ze_serializer_drop(this_); };
 
 
+inline z_moved_adaptive_mutex_t* z_move(z_owned_adaptive_mutex_t& this_) { return z_adaptive_mutex_move(&this_); };
 inline z_moved_alloc_layout_t* z_move(z_owned_alloc_layout_t& this_) { return z_alloc_layout_move(&this_); };
 inline z_moved_bytes_t* z_move(z_owned_bytes_t& this_) { return z_bytes_move(&this_); };
 inline z_moved_bytes_writer_t* z_move(z_owned_bytes_writer_t& this_) { return z_bytes_writer_move(&this_); };
+inline z_moved_cancellation_token_t* z_move(z_owned_cancellation_token_t& this_) { return z_cancellation_token_move(&this_); };
 inline z_moved_chunk_alloc_result_t* z_move(z_owned_chunk_alloc_result_t& this_) { return z_chunk_alloc_result_move(&this_); };
 inline z_moved_closure_hello_t* z_move(z_owned_closure_hello_t& this_) { return z_closure_hello_move(&this_); };
 inline z_moved_closure_query_t* z_move(z_owned_closure_query_t& closure_) { return z_closure_query_move(&closure_); };
@@ -761,7 +990,10 @@ inline z_moved_closure_sample_t* z_move(z_owned_closure_sample_t& closure_) { re
 inline z_moved_closure_zid_t* z_move(z_owned_closure_zid_t& closure_) { return z_closure_zid_move(&closure_); };
 inline z_moved_condvar_t* z_move(z_owned_condvar_t& this_) { return z_condvar_move(&this_); };
 inline z_moved_config_t* z_move(z_owned_config_t& this_) { return z_config_move(&this_); };
+inline z_moved_conflating_handler_sample_t* z_move(z_owned_conflating_handler_sample_t& this_) { return z_conflating_handler_sample_move(&this_); };
+inline z_moved_credit_handler_reply_t* z_move(z_owned_credit_handler_reply_t& this_) { return z_credit_handler_reply_move(&this_); };
 inline z_moved_encoding_t* z_move(z_owned_encoding_t& this_) { return z_encoding_move(&this_); };
+inline z_moved_executor_t* z_move(z_owned_executor_t& this_) { return z_executor_move(&this_); };
 inline z_moved_fifo_handler_query_t* z_move(z_owned_fifo_handler_query_t& this_) { return z_fifo_handler_query_move(&this_); };
 inline z_moved_fifo_handler_reply_t* z_move(z_owned_fifo_handler_reply_t& this_) { return z_fifo_handler_reply_move(&this_); };
 inline z_moved_fifo_handler_sample_t* z_move(z_owned_fifo_handler_sample_t& this_) { return z_fifo_handler_sample_move(&this_); };
@@ -770,6 +1002,7 @@ inline z_moved_keyexpr_t* z_move(z_owned_keyexpr_t& this_) { return z_keyexpr_mo
 inline z_moved_liveliness_token_t* z_move(z_owned_liveliness_token_t& this_) { return z_liveliness_token_move(&this_); };
 inline z_moved_memory_layout_t* z_move(z_owned_memory_layout_t& this_) { return z_memory_layout_move(&this_); };
 inline z_moved_mutex_t* z_move(z_owned_mutex_t& this_) { return z_mutex_move(&this_); };
+inline z_moved_priority_handler_sample_t* z_move(z_owned_priority_handler_sample_t& this_) { return z_priority_handler_sample_move(&this_); };
 inline z_moved_publisher_t* z_move(z_owned_publisher_t& this_) { return z_publisher_move(&this_); };
 inline z_moved_querier_t* z_move(z_owned_querier_t& this_) { return z_querier_move(&this_); };
 inline z_moved_query_t* z_move(z_owned_query_t& this_) { return z_query_move(&this_); };
@@ -779,7 +1012,9 @@ inline z_moved_reply_err_t* z_move(z_owned_reply_err_t& this_) { return z_reply_
 inline z_moved_ring_handler_query_t* z_move(z_owned_ring_handler_query_t& this_) { return z_ring_handler_query_move(&this_); };
 inline z_moved_ring_handler_reply_t* z_move(z_owned_ring_handler_reply_t& this_) { return z_ring_handler_reply_move(&this_); };
 inline z_moved_ring_handler_sample_t* z_move(z_owned_ring_handler_sample_t& this_) { return z_ring_handler_sample_move(&this_); };
+inline z_moved_rwlock_t* z_move(z_owned_rwlock_t& this_) { return z_rwlock_move(&this_); };
 inline z_moved_sample_t* z_move(z_owned_sample_t& this_) { return z_sample_move(&this_); };
+inline z_moved_semaphore_t* z_move(z_owned_semaphore_t& this_) { return z_semaphore_move(&this_); };
 inline z_moved_session_t* z_move(z_owned_session_t& this_) { return z_session_move(&this_); };
 inline z_moved_shm_client_t* z_move(z_owned_shm_client_t& this_) { return z_shm_client_move(&this_); };
 inline z_moved_shm_client_storage_t* z_move(z_owned_shm_client_storage_t& this_) { return z_shm_client_storage_move(&this_); };
@@ -788,17 +1023,28 @@ inline z_moved_shm_mut_t* z_move(z_owned_shm_mut_t& this_) { return z_shm_mut_mo
 inline z_moved_shm_provider_t* z_move(z_owned_shm_provider_t& this_) { return z_shm_provider_move(&this_); };
 inline z_moved_slice_t* z_move(z_owned_slice_t& this_) { return z_slice_move(&this_); };
 inline z_moved_source_info_t* z_move(z_owned_source_info_t& this_) { return z_source_info_move(&this_); };
+inline z_moved_spsc_handler_sample_t* z_move(z_owned_spsc_handler_sample_t& this_) { return z_spsc_handler_sample_move(&this_); };
 inline z_moved_string_array_t* z_move(z_owned_string_array_t& this_) { return z_string_array_move(&this_); };
 inline z_moved_string_t* z_move(z_owned_string_t& this_) { return z_string_move(&this_); };
 inline z_moved_subscriber_t* z_move(z_owned_subscriber_t& this_) { return z_subscriber_move(&this_); };
 inline z_moved_task_t* z_move(z_owned_task_t& this_) { return z_task_move(&this_); };
+inline zc_moved_bytes_pool_t* z_move(zc_owned_bytes_pool_t& this_) { return zc_bytes_pool_move(&this_); };
+inline zc_moved_closure_indexed_reply_t* z_move(zc_owned_closure_indexed_reply_t& this_) { return zc_closure_indexed_reply_move(&this_); };
+inline zc_moved_closure_liveliness_changes_t* z_move(zc_owned_closure_liveliness_changes_t& this_) { return zc_closure_liveliness_changes_move(&this_); };
 inline zc_moved_closure_log_t* z_move(zc_owned_closure_log_t& closure_) { return zc_closure_log_move(&closure_); };
 inline zc_moved_closure_matching_status_t* z_move(zc_owned_closure_matching_status_t& closure_) { return zc_closure_matching_status_move(&closure_); };
+inline zc_moved_closure_span_t* z_move(zc_owned_closure_span_t& this_) { return zc_closure_span_move(&this_); };
 inline zc_moved_concurrent_close_handle_t* z_move(zc_owned_concurrent_close_handle_t& this_) { return zc_concurrent_close_handle_move(&this_); };
+inline zc_moved_keyexpr_interner_t* z_move(zc_owned_keyexpr_interner_t& this_) { return zc_keyexpr_interner_move(&this_); };
+inline zc_moved_keyexpr_matcher_t* z_move(zc_owned_keyexpr_matcher_t& this_) { return zc_keyexpr_matcher_move(&this_); };
 inline zc_moved_matching_listener_t* z_move(zc_owned_matching_listener_t& this_) { return zc_matching_listener_move(&this_); };
+inline zc_moved_shm_client_cache_t* z_move(zc_owned_shm_client_cache_t& this_) { return zc_shm_client_cache_move(&this_); };
 inline zc_moved_shm_client_list_t* z_move(zc_owned_shm_client_list_t& this_) { return zc_shm_client_list_move(&this_); };
+inline zc_moved_shm_completion_queue_t* z_move(zc_owned_shm_completion_queue_t& this_) { return zc_shm_completion_queue_move(&this_); };
+inline zc_moved_string_arena_t* z_move(zc_owned_string_arena_t& this_) { return zc_string_arena_move(&this_); };
 inline ze_moved_advanced_publisher_t* z_move(ze_owned_advanced_publisher_t& this_) { return ze_advanced_publisher_move(&this_); };
 inline ze_moved_advanced_subscriber_t* z_move(ze_owned_advanced_subscriber_t& this_) { return ze_advanced_subscriber_move(&this_); };
+inline ze_moved_cache_budget_t* z_move(ze_owned_cache_budget_t& this_) { return ze_cache_budget_move(&this_); };
 inline ze_moved_closure_miss_t* z_move(ze_owned_closure_miss_t& closure_) { return ze_closure_miss_move(&closure_); };
 inline ze_moved_publication_cache_t* z_move(ze_owned_publication_cache_t& this_) { return ze_publication_cache_move(&this_); };
 inline ze_moved_querying_subscriber_t* z_move(ze_owned_querying_subscriber_t& this_) { return ze_querying_subscriber_move(&this_); };
@@ -806,9 +1052,11 @@ inline ze_moved_sample_miss_listener_t* z_move(ze_owned_sample_miss_listener_t&
 inline ze_moved_serializer_t* z_move(ze_owned_serializer_t& this_) { return ze_serializer_move(&this_); };
 
 
+inline void z_internal_null(z_owned_adaptive_mutex_t* this_) { z_internal_adaptive_mutex_null(this_); };
 inline void z_internal_null(z_owned_alloc_layout_t* this_) { z_internal_alloc_layout_null(this_); };
 inline void z_internal_null(z_owned_bytes_t* this_) { z_internal_bytes_null(this_); };
 inline void z_internal_null(z_owned_bytes_writer_t* this_) { z_internal_bytes_writer_null(this_); };
+inline void z_internal_null(z_owned_cancellation_token_t* this_) { z_internal_cancellation_token_null(this_); };
 inline void z_internal_null(z_owned_chunk_alloc_result_t* this_) { z_internal_chunk_alloc_result_null(this_); };
 inline void z_internal_null(z_owned_closure_hello_t* this_) { z_internal_closure_hello_null(this_); };
 inline void z_internal_null(z_owned_closure_query_t* this_) { z_internal_closure_query_null(this_); };
@@ -817,7 +1065,10 @@ inline void z_internal_null(z_owned_closure_sample_t* this_) { z_internal_closur
 inline void z_internal_null(z_owned_closure_zid_t* this_) { z_internal_closure_zid_null(this_); };
 inline void z_internal_null(z_owned_condvar_t* this_) { z_internal_condvar_null(this_); };
 inline void z_internal_null(z_owned_config_t* this_) { z_internal_config_null(this_); };
+inline void z_internal_null(z_owned_conflating_handler_sample_t* this_) { z_internal_conflating_handler_sample_null(this_); };
+inline void z_internal_null(z_owned_credit_handler_reply_t* this_) { z_internal_credit_handler_reply_null(this_); };
 inline void z_internal_null(z_owned_encoding_t* this_) { z_internal_encoding_null(this_); };
+inline void z_internal_null(z_owned_executor_t* this_) { z_internal_executor_null(this_); };
 inline void z_internal_null(z_owned_fifo_handler_query_t* this_) { z_internal_fifo_handler_query_null(this_); };
 inline void z_internal_null(z_owned_fifo_handler_reply_t* this_) { z_internal_fifo_handler_reply_null(this_); };
 inline void z_internal_null(z_owned_fifo_handler_sample_t* this_) { z_internal_fifo_handler_sample_null(this_); };
@@ -826,6 +1077,7 @@ inline void z_internal_null(z_owned_keyexpr_t* this_) { z_internal_keyexpr_null(
 inline void z_internal_null(z_owned_liveliness_token_t* this_) { z_internal_liveliness_token_null(this_); };
 inline void z_internal_null(z_owned_memory_layout_t* this_) { z_internal_memory_layout_null(this_); };
 inline void z_internal_null(z_owned_mutex_t* this_) { z_internal_mutex_null(this_); };
+inline void z_internal_null(z_owned_priority_handler_sample_t* this_) { z_internal_priority_handler_sample_null(this_); };
 inline void z_internal_null(z_owned_publisher_t* this_) { z_internal_publisher_null(this_); };
 inline void z_internal_null(z_owned_querier_t* this_) { z_internal_querier_null(this_); };
 inline void z_internal_null(z_owned_query_t* this_) { z_internal_query_null(this_); };
@@ -835,7 +1087,9 @@ inline void z_internal_null(z_owned_reply_t* this_) { z_internal_reply_null(this
 inline void z_internal_null(z_owned_ring_handler_query_t* this_) { z_internal_ring_handler_query_null(this_); };
 inline void z_internal_null(z_owned_ring_handler_reply_t* this_) { z_internal_ring_handler_reply_null(this_); };
 inline void z_internal_null(z_owned_ring_handler_sample_t* this_) { z_internal_ring_handler_sample_null(this_); };
+inline void z_internal_null(z_owned_rwlock_t* this_) { z_internal_rwlock_null(this_); };
 inline void z_internal_null(z_owned_sample_t* this_) { z_internal_sample_null(this_); };
+inline void z_internal_null(z_owned_semaphore_t* this_) { z_internal_semaphore_null(this_); };
 inline void z_internal_null(z_owned_session_t* this_) { z_internal_session_null(this_); };
 inline void z_internal_null(z_owned_shm_client_t* this_) { z_internal_shm_client_null(this_); };
 inline void z_internal_null(z_owned_shm_client_storage_t* this_) { z_internal_shm_client_storage_null(this_); };
@@ -844,26 +1098,39 @@ inline void z_internal_null(z_owned_shm_t* this_) { z_internal_shm_null(this_);
 inline void z_internal_null(z_owned_shm_provider_t* this_) { z_internal_shm_provider_null(this_); };
 inline void z_internal_null(z_owned_slice_t* this_) { z_internal_slice_null(this_); };
 inline void z_internal_null(z_owned_source_info_t* this_) { z_internal_source_info_null(this_); };
+inline void z_internal_null(z_owned_spsc_handler_sample_t* this_) { z_internal_spsc_handler_sample_null(this_); };
 inline void z_internal_null(z_owned_string_array_t* this_) { z_internal_string_array_null(this_); };
 inline void z_internal_null(z_owned_string_t* this_) { z_internal_string_null(this_); };
 inline void z_internal_null(z_owned_subscriber_t* this_) { z_internal_subscriber_null(this_); };
 inline void z_internal_null(z_owned_task_t* this_) { z_internal_task_null(this_); };
+inline void z_internal_null(zc_owned_bytes_pool_t* this_) { zc_internal_bytes_pool_null(this_); };
+inline void z_internal_null(zc_owned_closure_indexed_reply_t* this_) { zc_internal_closure_indexed_reply_null(this_); };
+inline void z_internal_null(zc_owned_closure_liveliness_changes_t* this_) { zc_internal_closure_liveliness_changes_null(this_); };
 inline void z_internal_null(zc_owned_closure_log_t* this_) { zc_internal_closure_log_null(this_); };
 inline void z_internal_null(zc_owned_closure_matching_status_t* this_) { zc_internal_closure_matching_status_null(this_); };
+inline void z_internal_null(zc_owned_closure_span_t* this_) { zc_internal_closure_span_null(this_); };
 inline void z_internal_null(zc_owned_concurrent_close_handle_t* this_) { zc_internal_concurrent_close_handle_null(this_); };
+inline void z_internal_null(zc_owned_keyexpr_interner_t* this_) { zc_internal_keyexpr_interner_null(this_); };
+inline void z_internal_null(zc_owned_keyexpr_matcher_t* this_) { zc_internal_keyexpr_matcher_null(this_); };
 inline void z_internal_null(zc_owned_matching_listener_t* this_) { zc_internal_matching_listener_null(this_); };
+inline void z_internal_null(zc_owned_shm_client_cache_t* this_) { zc_internal_shm_client_cache_null(this_); };
 inline void z_internal_null(zc_owned_shm_client_list_t* this_) { zc_internal_shm_client_list_null(this_); };
+inline void z_internal_null(zc_owned_shm_completion_queue_t* this_) { zc_internal_shm_completion_queue_null(this_); };
+inline void z_internal_null(zc_owned_string_arena_t* this_) { zc_internal_string_arena_null(this_); };
 inline void z_internal_null(ze_owned_advanced_publisher_t* this_) { ze_internal_advanced_publisher_null(this_); };
 inline void z_internal_null(ze_owned_advanced_subscriber_t* this_) { ze_internal_advanced_subscriber_null(this_); };
+inline void z_internal_null(ze_owned_cache_budget_t* this_) { ze_internal_cache_budget_null(this_); };
 inline void z_internal_null(ze_owned_closure_miss_t* this_) { ze_internal_closure_miss_null(this_); };
 inline void z_internal_null(ze_owned_publication_cache_t* this_) { ze_internal_publication_cache_null(this_); };
 inline void z_internal_null(ze_owned_querying_subscriber_t* this_) { ze_internal_querying_subscriber_null(this_); };
 inline void z_internal_null(ze_owned_sample_miss_listener_t* this_) { ze_internal_sample_miss_listener_null(this_); };
 inline void z_internal_null(ze_owned_serializer_t* this_) { ze_internal_serializer_null(this_); };
 
+static inline void z_adaptive_mutex_take(z_owned_adaptive_mutex_t* this_, z_moved_adaptive_mutex_t* x) { *this_ = x->_this; z_internal_adaptive_mutex_null(&x->_this); }
 static inline void z_alloc_layout_take(z_owned_alloc_layout_t* this_, z_moved_alloc_layout_t* x) { *this_ = x->_this; z_internal_alloc_layout_null(&x->_this); }
 static inline void z_bytes_take(z_owned_bytes_t* this_, z_moved_bytes_t* x) { *this_ = x->_this; z_internal_bytes_null(&x->_this); }
 static inline void z_bytes_writer_take(z_owned_bytes_writer_t* this_, z_moved_bytes_writer_t* x) { *this_ = x->_this; z_internal_bytes_writer_null(&x->_this); }
+static inline void z_cancellation_token_take(z_owned_cancellation_token_t* this_, z_moved_cancellation_token_t* x) { *this_ = x->_this; z_internal_cancellation_token_null(&x->_this); }
 static inline void z_chunk_alloc_result_take(z_owned_chunk_alloc_result_t* this_, z_moved_chunk_alloc_result_t* x) { *this_ = x->_this; z_internal_chunk_alloc_result_null(&x->_this); }
 static inline void z_closure_hello_take(z_owned_closure_hello_t* this_, z_moved_closure_hello_t* x) { *this_ = x->_this; z_internal_closure_hello_null(&x->_this); }
 static inline void z_closure_query_take(z_owned_closure_query_t* closure_, z_moved_closure_query_t* x) { *closure_ = x->_this; z_internal_closure_query_null(&x->_this); }
@@ -872,7 +1139,10 @@ static inline void z_closure_sample_take(z_owned_closure_sample_t* closure_, z_m
 static inline void z_closure_zid_take(z_owned_closure_zid_t* closure_, z_moved_closure_zid_t* x) { *closure_ = x->_this; z_internal_closure_zid_null(&x->_this); }
 static inline void z_condvar_take(z_owned_condvar_t* this_, z_moved_condvar_t* x) { *this_ = x->_this; z_internal_condvar_null(&x->_this); }
 static inline void z_config_take(z_owned_config_t* this_, z_moved_config_t* x) { *this_ = x->_this; z_internal_config_null(&x->_this); }
+static inline void z_conflating_handler_sample_take(z_owned_conflating_handler_sample_t* this_, z_moved_conflating_handler_sample_t* x) { *this_ = x->_this; z_internal_conflating_handler_sample_null(&x->_this); }
+static inline void z_credit_handler_reply_take(z_owned_credit_handler_reply_t* this_, z_moved_credit_handler_reply_t* x) { *this_ = x->_this; z_internal_credit_handler_reply_null(&x->_this); }
 static inline void z_encoding_take(z_owned_encoding_t* this_, z_moved_encoding_t* x) { *this_ = x->_this; z_internal_encoding_null(&x->_this); }
+static inline void z_executor_take(z_owned_executor_t* this_, z_moved_executor_t* x) { *this_ = x->_this; z_internal_executor_null(&x->_this); }
 static inline void z_fifo_handler_query_take(z_owned_fifo_handler_query_t* this_, z_moved_fifo_handler_query_t* x) { *this_ = x->_this; z_internal_fifo_handler_query_null(&x->_this); }
 static inline void z_fifo_handler_reply_take(z_owned_fifo_handler_reply_t* this_, z_moved_fifo_handler_reply_t* x) { *this_ = x->_this; z_internal_fifo_handler_reply_null(&x->_this); }
 static inline void z_fifo_handler_sample_take(z_owned_fifo_handler_sample_t* this_, z_moved_fifo_handler_sample_t* x) { *this_ = x->_this; z_internal_fifo_handler_sample_null(&x->_this); }
@@ -881,6 +1151,7 @@ static inline void z_keyexpr_take(z_owned_keyexpr_t* this_, z_moved_keyexpr_t* x
 static inline void z_liveliness_token_take(z_owned_liveliness_token_t* this_, z_moved_liveliness_token_t* x) { *this_ = x->_this; z_internal_liveliness_token_null(&x->_this); }
 static inline void z_memory_layout_take(z_owned_memory_layout_t* this_, z_moved_memory_layout_t* x) { *this_ = x->_this; z_internal_memory_layout_null(&x->_this); }
 static inline void z_mutex_take(z_owned_mutex_t* this_, z_moved_mutex_t* x) { *this_ = x->_this; z_internal_mutex_null(&x->_this); }
+static inline void z_priority_handler_sample_take(z_owned_priority_handler_sample_t* this_, z_moved_priority_handler_sample_t* x) { *this_ = x->_this; z_internal_priority_handler_sample_null(&x->_this); }
 static inline void z_publisher_take(z_owned_publisher_t* this_, z_moved_publisher_t* x) { *this_ = x->_this; z_internal_publisher_null(&x->_this); }
 static inline void z_querier_take(z_owned_querier_t* this_, z_moved_querier_t* x) { *this_ = x->_this; z_internal_querier_null(&x->_this); }
 static inline void z_query_take(z_owned_query_t* this_, z_moved_query_t* x) { *this_ = x->_this; z_internal_query_null(&x->_this); }
@@ -890,7 +1161,9 @@ static inline void z_reply_err_take(z_owned_reply_err_t* this_, z_moved_reply_er
 static inline void z_ring_handler_query_take(z_owned_ring_handler_query_t* this_, z_moved_ring_handler_query_t* x) { *this_ = x->_this; z_internal_ring_handler_query_null(&x->_this); }
 static inline void z_ring_handler_reply_take(z_owned_ring_handler_reply_t* this_, z_moved_ring_handler_reply_t* x) { *this_ = x->_this; z_internal_ring_handler_reply_null(&x->_this); }
 static inline void z_ring_handler_sample_take(z_owned_ring_handler_sample_t* this_, z_moved_ring_handler_sample_t* x) { *this_ = x->_this; z_internal_ring_handler_sample_null(&x->_this); }
+static inline void z_rwlock_take(z_owned_rwlock_t* this_, z_moved_rwlock_t* x) { *this_ = x->_this; z_internal_rwlock_null(&x->_this); }
 static inline void z_sample_take(z_owned_sample_t* this_, z_moved_sample_t* x) { *this_ = x->_this; z_internal_sample_null(&x->_this); }
+static inline void z_semaphore_take(z_owned_semaphore_t* this_, z_moved_semaphore_t* x) { *this_ = x->_this; z_internal_semaphore_null(&x->_this); }
 static inline void z_session_take(z_owned_session_t* this_, z_moved_session_t* x) { *this_ = x->_this; z_internal_session_null(&x->_this); }
 static inline void z_shm_client_take(z_owned_shm_client_t* this_, z_moved_shm_client_t* x) { *this_ = x->_this; z_internal_shm_client_null(&x->_this); }
 static inline void z_shm_client_storage_take(z_owned_shm_client_storage_t* this_, z_moved_shm_client_storage_t* x) { *this_ = x->_this; z_internal_shm_client_storage_null(&x->_this); }
@@ -899,17 +1172,28 @@ static inline void z_shm_mut_take(z_owned_shm_mut_t* this_, z_moved_shm_mut_t* x
 static inline void z_shm_provider_take(z_owned_shm_provider_t* this_, z_moved_shm_provider_t* x) { *this_ = x->_this; z_internal_shm_provider_null(&x->_this); }
 static inline void z_slice_take(z_owned_slice_t* this_, z_moved_slice_t* x) { *this_ = x->_this; z_internal_slice_null(&x->_this); }
 static inline void z_source_info_take(z_owned_source_info_t* this_, z_moved_source_info_t* x) { *this_ = x->_this; z_internal_source_info_null(&x->_this); }
+static inline void z_spsc_handler_sample_take(z_owned_spsc_handler_sample_t* this_, z_moved_spsc_handler_sample_t* x) { *this_ = x->_this; z_internal_spsc_handler_sample_null(&x->_this); }
 static inline void z_string_array_take(z_owned_string_array_t* this_, z_moved_string_array_t* x) { *this_ = x->_this; z_internal_string_array_null(&x->_this); }
 static inline void z_string_take(z_owned_string_t* this_, z_moved_string_t* x) { *this_ = x->_this; z_internal_string_null(&x->_this); }
 static inline void z_subscriber_take(z_owned_subscriber_t* this_, z_moved_subscriber_t* x) { *this_ = x->_this; z_internal_subscriber_null(&x->_this); }
 static inline void z_task_take(z_owned_task_t* this_, z_moved_task_t* x) { *this_ = x->_this; z_internal_task_null(&x->_this); }
+static inline void zc_bytes_pool_take(zc_owned_bytes_pool_t* this_, zc_moved_bytes_pool_t* x) { *this_ = x->_this; zc_internal_bytes_pool_null(&x->_this); }
+static inline void zc_closure_indexed_reply_take(zc_owned_closure_indexed_reply_t* this_, zc_moved_closure_indexed_reply_t* x) { *this_ = x->_this; zc_internal_closure_indexed_reply_null(&x->_this); }
+static inline void zc_closure_liveliness_changes_take(zc_owned_closure_liveliness_changes_t* this_, zc_moved_closure_liveliness_changes_t* x) { *this_ = x->_this; zc_internal_closure_liveliness_changes_null(&x->_this); }
 static inline void zc_closure_log_take(zc_owned_closure_log_t* closure_, zc_moved_closure_log_t* x) { *closure_ = x->_this; zc_internal_closure_log_null(&x->_this); }
 static inline void zc_closure_matching_status_take(zc_owned_closure_matching_status_t* closure_, zc_moved_closure_matching_status_t* x) { *closure_ = x->_this; zc_internal_closure_matching_status_null(&x->_this); }
+static inline void zc_closure_span_take(zc_owned_closure_span_t* this_, zc_moved_closure_span_t* x) { *this_ = x->_this; zc_internal_closure_span_null(&x->_this); }
 static inline void zc_concurrent_close_handle_take(zc_owned_concurrent_close_handle_t* this_, zc_moved_concurrent_close_handle_t* x) { *this_ = x->_this; zc_internal_concurrent_close_handle_null(&x->_this); }
+static inline void zc_keyexpr_interner_take(zc_owned_keyexpr_interner_t* this_, zc_moved_keyexpr_interner_t* x) { *this_ = x->_this; zc_internal_keyexpr_interner_null(&x->_this); }
+static inline void zc_keyexpr_matcher_take(zc_owned_keyexpr_matcher_t* this_, zc_moved_keyexpr_matcher_t* x) { *this_ = x->_this; zc_internal_keyexpr_matcher_null(&x->_this); }
 static inline void zc_matching_listener_take(zc_owned_matching_listener_t* this_, zc_moved_matching_listener_t* x) { *this_ = x->_this; zc_internal_matching_listener_null(&x->_this); }
+static inline void zc_shm_client_cache_take(zc_owned_shm_client_cache_t* this_, zc_moved_shm_client_cache_t* x) { *this_ = x->_this; zc_internal_shm_client_cache_null(&x->_this); }
 static inline void zc_shm_client_list_take(zc_owned_shm_client_list_t* this_, zc_moved_shm_client_list_t* x) { *this_ = x->_this; zc_internal_shm_client_list_null(&x->_this); }
+static inline void zc_shm_completion_queue_take(zc_owned_shm_completion_queue_t* this_, zc_moved_shm_completion_queue_t* x) { *this_ = x->_this; zc_internal_shm_completion_queue_null(&x->_this); }
+static inline void zc_string_arena_take(zc_owned_string_arena_t* this_, zc_moved_string_arena_t* x) { *this_ = x->_this; zc_internal_string_arena_null(&x->_this); }
 static inline void ze_advanced_publisher_take(ze_owned_advanced_publisher_t* this_, ze_moved_advanced_publisher_t* x) { *this_ = x->_this; ze_internal_advanced_publisher_null(&x->_this); }
 static inline void ze_advanced_subscriber_take(ze_owned_advanced_subscriber_t* this_, ze_moved_advanced_subscriber_t* x) { *this_ = x->_this; ze_internal_advanced_subscriber_null(&x->_this); }
+static inline void ze_cache_budget_take(ze_owned_cache_budget_t* this_, ze_moved_cache_budget_t* x) { *this_ = x->_this; ze_internal_cache_budget_null(&x->_this); }
 static inline void ze_closure_miss_take(ze_owned_closure_miss_t* closure_, ze_moved_closure_miss_t* x) { *closure_ = x->_this; ze_internal_closure_miss_null(&x->_this); }
 static inline void ze_publication_cache_take(ze_owned_publication_cache_t* this_, ze_moved_publication_cache_t* x) { *this_ = x->_this; ze_internal_publication_cache_null(&x->_this); }
 static inline void ze_querying_subscriber_take(ze_owned_querying_subscriber_t* this_, ze_moved_querying_subscriber_t* x) { *this_ = x->_this; ze_internal_querying_subscriber_null(&x->_this); }
@@ -918,6 +1202,9 @@ static inline void ze_serializer_take(ze_owned_serializer_t* this_, ze_moved_ser
 
 
 
+inline void z_take(z_owned_adaptive_mutex_t* this_, z_moved_adaptive_mutex_t* x) {
+    z_adaptive_mutex_take(this_, x);
+};
 inline void z_take(z_owned_alloc_layout_t* this_, z_moved_alloc_layout_t* x) {
     z_alloc_layout_take(this_, x);
 };
@@ -927,6 +1214,9 @@ inline void z_take(z_owned_bytes_t* this_, z_moved_bytes_t* x) {
 inline void z_take(z_owned_bytes_writer_t* this_, z_moved_bytes_writer_t* x) {
     z_bytes_writer_take(this_, x);
 };
+inline void z_take(z_owned_cancellation_token_t* this_, z_moved_cancellation_token_t* x) {
+    z_cancellation_token_take(this_, x);
+};
 inline void z_take(z_owned_chunk_alloc_result_t* this_, z_moved_chunk_alloc_result_t* x) {
     z_chunk_alloc_result_take(this_, x);
 };
@@ -951,9 +1241,18 @@ inline void z_take(z_owned_condvar_t* this_, z_moved_condvar_t* x) {
 inline void z_take(z_owned_config_t* this_, z_moved_config_t* x) {
     z_config_take(this_, x);
 };
+inline void z_take(z_owned_conflating_handler_sample_t* this_, z_moved_conflating_handler_sample_t* x) {
+    z_conflating_handler_sample_take(this_, x);
+};
+inline void z_take(z_owned_credit_handler_reply_t* this_, z_moved_credit_handler_reply_t* x) {
+    z_credit_handler_reply_take(this_, x);
+};
 inline void z_take(z_owned_encoding_t* this_, z_moved_encoding_t* x) {
     z_encoding_take(this_, x);
 };
+inline void z_take(z_owned_executor_t* this_, z_moved_executor_t* x) {
+    z_executor_take(this_, x);
+};
 inline void z_take(z_owned_fifo_handler_query_t* this_, z_moved_fifo_handler_query_t* x) {
     z_fifo_handler_query_take(this_, x);
 };
@@ -978,6 +1277,9 @@ inline void z_take(z_owned_memory_layout_t* this_, z_moved_memory_layout_t* x) {
 inline void z_take(z_owned_mutex_t* this_, z_moved_mutex_t* x) {
     z_mutex_take(this_, x);
 };
+inline void z_take(z_owned_priority_handler_sample_t* this_, z_moved_priority_handler_sample_t* x) {
+    z_priority_handler_sample_take(this_, x);
+};
 inline void z_take(z_owned_publisher_t* this_, z_moved_publisher_t* x) {
     z_publisher_take(this_, x);
 };
@@ -1005,9 +1307,15 @@ inline void z_take(z_owned_ring_handler_reply_t* this_, z_moved_ring_handler_rep
 inline void z_take(z_owned_ring_handler_sample_t* this_, z_moved_ring_handler_sample_t* x) {
     z_ring_handler_sample_take(this_, x);
 };
+inline void z_take(z_owned_rwlock_t* this_, z_moved_rwlock_t* x) {
+    z_rwlock_take(this_, x);
+};
 inline void z_take(z_owned_sample_t* this_, z_moved_sample_t* x) {
     z_sample_take(this_, x);
 };
+inline void z_take(z_owned_semaphore_t* this_, z_moved_semaphore_t* x) {
+    z_semaphore_take(this_, x);
+};
 inline void z_take(z_owned_session_t* this_, z_moved_session_t* x) {
     z_session_take(this_, x);
 };
@@ -1032,6 +1340,9 @@ inline void z_take(z_owned_slice_t* this_, z_moved_slice_t* x) {
 inline void z_take(z_owned_source_info_t* this_, z_moved_source_info_t* x) {
     z_source_info_take(this_, x);
 };
+inline void z_take(z_owned_spsc_handler_sample_t* this_, z_moved_spsc_handler_sample_t* x) {
+    z_spsc_handler_sample_take(this_, x);
+};
 inline void z_take(z_owned_string_array_t* this_, z_moved_string_array_t* x) {
     z_string_array_take(this_, x);
 };
@@ -1044,27 +1355,57 @@ inline void z_take(z_owned_subscriber_t* this_, z_moved_subscriber_t* x) {
 inline void z_take(z_owned_task_t* this_, z_moved_task_t* x) {
     z_task_take(this_, x);
 };
+inline void z_take(zc_owned_bytes_pool_t* this_, zc_moved_bytes_pool_t* x) {
+    zc_bytes_pool_take(this_, x);
+};
+inline void z_take(zc_owned_closure_indexed_reply_t* this_, zc_moved_closure_indexed_reply_t* x) {
+    zc_closure_indexed_reply_take(this_, x);
+};
+inline void z_take(zc_owned_closure_liveliness_changes_t* this_, zc_moved_closure_liveliness_changes_t* x) {
+    zc_closure_liveliness_changes_take(this_, x);
+};
 inline void z_take(zc_owned_closure_log_t* closure_, zc_moved_closure_log_t* x) {
     zc_closure_log_take(closure_, x);
 };
 inline void z_take(zc_owned_closure_matching_status_t* closure_, zc_moved_closure_matching_status_t* x) {
     zc_closure_matching_status_take(closure_, x);
 };
+inline void z_take(zc_owned_closure_span_t* this_, zc_moved_closure_span_t* x) {
+    zc_closure_span_take(this_, x);
+};
 inline void z_take(zc_owned_concurrent_close_handle_t* this_, zc_moved_concurrent_close_handle_t* x) {
     zc_concurrent_close_handle_take(this_, x);
 };
+inline void z_take(zc_owned_keyexpr_interner_t* this_, zc_moved_keyexpr_interner_t* x) {
+    zc_keyexpr_interner_take(this_, x);
+};
+inline void z_take(zc_owned_keyexpr_matcher_t* this_, zc_moved_keyexpr_matcher_t* x) {
+    zc_keyexpr_matcher_take(this_, x);
+};
 inline void z_take(zc_owned_matching_listener_t* this_, zc_moved_matching_listener_t* x) {
     zc_matching_listener_take(this_, x);
 };
+inline void z_take(zc_owned_shm_client_cache_t* this_, zc_moved_shm_client_cache_t* x) {
+    zc_shm_client_cache_take(this_, x);
+};
 inline void z_take(zc_owned_shm_client_list_t* this_, zc_moved_shm_client_list_t* x) {
     zc_shm_client_list_take(this_, x);
 };
+inline void z_take(zc_owned_shm_completion_queue_t* this_, zc_moved_shm_completion_queue_t* x) {
+    zc_shm_completion_queue_take(this_, x);
+};
+inline void z_take(zc_owned_string_arena_t* this_, zc_moved_string_arena_t* x) {
+    zc_string_arena_take(this_, x);
+};
 inline void z_take(ze_owned_advanced_publisher_t* this_, ze_moved_advanced_publisher_t* x) {
     ze_advanced_publisher_take(this_, x);
 };
 inline void z_take(ze_owned_advanced_subscriber_t* this_, ze_moved_advanced_subscriber_t* x) {
     ze_advanced_subscriber_take(this_, x);
 };
+inline void z_take(ze_owned_cache_budget_t* this_, ze_moved_cache_budget_t* x) {
+    ze_cache_budget_take(this_, x);
+};
 inline void z_take(ze_owned_closure_miss_t* closure_, ze_moved_closure_miss_t* x) {
     ze_closure_miss_take(closure_, x);
 };
@@ -1082,9 +1423,11 @@ inline void z_take(ze_owned_serializer_t* this_, ze_moved_serializer_t* x) {
 };
 
 
+inline bool z_internal_check(const z_owned_adaptive_mutex_t& this_) { return z_internal_adaptive_mutex_check(&this_); };
 inline bool z_internal_check(const z_owned_alloc_layout_t& this_) { return z_internal_alloc_layout_check(&this_); };
 inline bool z_internal_check(const z_owned_bytes_t& this_) { return z_internal_bytes_check(&this_); };
 inline bool z_internal_check(const z_owned_bytes_writer_t& this_) { return z_internal_bytes_writer_check(&this_); };
+inline bool z_internal_check(const z_owned_cancellation_token_t& this_) { return z_internal_cancellation_token_check(&this_); };
 inline bool z_internal_check(const z_owned_chunk_alloc_result_t& this_) { return z_internal_chunk_alloc_result_check(&this_); };
 inline bool z_internal_check(const z_owned_closure_hello_t& this_) { return z_internal_closure_hello_check(&this_); };
 inline bool z_internal_check(const z_owned_closure_query_t& this_) { return z_internal_closure_query_check(&this_); };
@@ -1093,7 +1436,10 @@ inline bool z_internal_check(const z_owned_closure_sample_t& this_) { return z_i
 inline bool z_internal_check(const z_owned_closure_zid_t& this_) { return z_internal_closure_zid_check(&this_); };
 inline bool z_internal_check(const z_owned_condvar_t& this_) { return z_internal_condvar_check(&this_); };
 inline bool z_internal_check(const z_owned_config_t& this_) { return z_internal_config_check(&this_); };
+inline bool z_internal_check(const z_owned_conflating_handler_sample_t& this_) { return z_internal_conflating_handler_sample_check(&this_); };
+inline bool z_internal_check(const z_owned_credit_handler_reply_t& this_) { return z_internal_credit_handler_reply_check(&this_); };
 inline bool z_internal_check(const z_owned_encoding_t& this_) { return z_internal_encoding_check(&this_); };
+inline bool z_internal_check(const z_owned_executor_t& this_) { return z_internal_executor_check(&this_); };
 inline bool z_internal_check(const z_owned_fifo_handler_query_t& this_) { return z_internal_fifo_handler_query_check(&this_); };
 inline bool z_internal_check(const z_owned_fifo_handler_reply_t& this_) { return z_internal_fifo_handler_reply_check(&this_); };
 inline bool z_internal_check(const z_owned_fifo_handler_sample_t& this_) { return z_internal_fifo_handler_sample_check(&this_); };
@@ -1102,6 +1448,7 @@ inline bool z_internal_check(const z_owned_keyexpr_t& this_) { return z_internal
 inline bool z_internal_check(const z_owned_liveliness_token_t& this_) { return z_internal_liveliness_token_check(&this_); };
 inline bool z_internal_check(const z_owned_memory_layout_t& this_) { return z_internal_memory_layout_check(&this_); };
 inline bool z_internal_check(const z_owned_mutex_t& this_) { return z_internal_mutex_check(&this_); };
+inline bool z_internal_check(const z_owned_priority_handler_sample_t& this_) { return z_internal_priority_handler_sample_check(&this_); };
 inline bool z_internal_check(const z_owned_publisher_t& this_) { return z_internal_publisher_check(&this_); };
 inline bool z_internal_check(const z_owned_querier_t& this_) { return z_internal_querier_check(&this_); };
 inline bool z_internal_check(const z_owned_query_t& query) { return z_internal_query_check(&query); };
@@ -1111,7 +1458,9 @@ inline bool z_internal_check(const z_owned_reply_err_t& this_) { return z_intern
 inline bool z_internal_check(const z_owned_ring_handler_query_t& this_) { return z_internal_ring_handler_query_check(&this_); };
 inline bool z_internal_check(const z_owned_ring_handler_reply_t& this_) { return z_internal_ring_handler_reply_check(&this_); };
 inline bool z_internal_check(const z_owned_ring_handler_sample_t& this_) { return z_internal_ring_handler_sample_check(&this_); };
+inline bool z_internal_check(const z_owned_rwlock_t& this_) { return z_internal_rwlock_check(&this_); };
 inline bool z_internal_check(const z_owned_sample_t& this_) { return z_internal_sample_check(&this_); };
+inline bool z_internal_check(const z_owned_semaphore_t& this_) { return z_internal_semaphore_check(&this_); };
 inline bool z_internal_check(const z_owned_session_t& this_) { return z_internal_session_check(&this_); };
 inline bool z_internal_check(const z_owned_shm_t& this_) { return z_internal_shm_check(&this_); };
 inline bool z_internal_check(const z_owned_shm_client_t& this_) { return z_internal_shm_client_check(&this_); };
@@ -1120,17 +1469,28 @@ inline bool z_internal_check(const z_owned_shm_mut_t& this_) { return z_internal
 inline bool z_internal_check(const z_owned_shm_provider_t& this_) { return z_internal_shm_provider_check(&this_); };
 inline bool z_internal_check(const z_owned_slice_t& this_) { return z_internal_slice_check(&this_); };
 inline bool z_internal_check(const z_owned_source_info_t& this_) { return z_internal_source_info_check(&this_); };
+inline bool z_internal_check(const z_owned_spsc_handler_sample_t& this_) { return z_internal_spsc_handler_sample_check(&this_); };
 inline bool z_internal_check(const z_owned_string_array_t& this_) { return z_internal_string_array_check(&this_); };
 inline bool z_internal_check(const z_owned_string_t& this_) { return z_internal_string_check(&this_); };
 inline bool z_internal_check(const z_owned_subscriber_t& this_) { return z_internal_subscriber_check(&this_); };
 inline bool z_internal_check(const z_owned_task_t& this_) { return z_internal_task_check(&this_); };
+inline bool z_internal_check(const zc_owned_bytes_pool_t& this_) { return zc_internal_bytes_pool_check(&this_); };
+inline bool z_internal_check(const zc_owned_closure_indexed_reply_t& this_) { return zc_internal_closure_indexed_reply_check(&this_); };
+inline bool z_internal_check(const zc_owned_closure_liveliness_changes_t& this_) { return zc_internal_closure_liveliness_changes_check(&this_); };
 inline bool z_internal_check(const zc_owned_closure_log_t& this_) { return zc_internal_closure_log_check(&this_); };
 inline bool z_internal_check(const zc_owned_closure_matching_status_t& this_) { return zc_internal_closure_matching_status_check(&this_); };
+inline bool z_internal_check(const zc_owned_closure_span_t& this_) { return zc_internal_closure_span_check(&this_); };
 inline bool z_internal_check(const zc_owned_concurrent_close_handle_t& this_) { return zc_internal_concurrent_close_handle_check(&this_); };
+inline bool z_internal_check(const zc_owned_keyexpr_interner_t& this_) { return zc_internal_keyexpr_interner_check(&this_); };
+inline bool z_internal_check(const zc_owned_keyexpr_matcher_t& this_) { return zc_internal_keyexpr_matcher_check(&this_); };
 inline bool z_internal_check(const zc_owned_matching_listener_t& this_) { return zc_internal_matching_listener_check(&this_); };
+inline bool z_internal_check(const zc_owned_shm_client_cache_t& this_) { return zc_internal_shm_client_cache_check(&this_); };
 inline bool z_internal_check(const zc_owned_shm_client_list_t& this_) { return zc_internal_shm_client_list_check(&this_); };
+inline bool z_internal_check(const zc_owned_shm_completion_queue_t& this_) { return zc_internal_shm_completion_queue_check(&this_); };
+inline bool z_internal_check(const zc_owned_string_arena_t& this_) { return zc_internal_string_arena_check(&this_); };
 inline bool z_internal_check(const ze_owned_advanced_publisher_t& this_) { return ze_internal_advanced_publisher_check(&this_); };
 inline bool z_internal_check(const ze_owned_advanced_subscriber_t& this_) { return ze_internal_advanced_subscriber_check(&this_); };
+inline bool z_internal_check(const ze_owned_cache_budget_t& this_) { return ze_internal_cache_budget_check(&this_); };
 inline bool z_internal_check(const ze_owned_closure_miss_t& this_) { return ze_internal_closure_miss_check(&this_); };
 inline bool z_internal_check(const ze_owned_publication_cache_t& this_) { return ze_internal_publication_cache_check(&this_); };
 inline bool z_internal_check(const ze_owned_querying_subscriber_t& this_) { return ze_internal_querying_subscriber_check(&this_); };
@@ -1153,9 +1513,15 @@ inline void z_call(const z_loaned_closure_sample_t* closure, z_loaned_sample_t*
 inline void z_call(const z_loaned_closure_zid_t* closure, const z_id_t* z_id) {
     z_closure_zid_call(closure, z_id);
 };
+inline void z_call(const zc_loaned_closure_liveliness_changes_t* closure, const zc_liveliness_changes_t* changes) {
+    zc_closure_liveliness_changes_call(closure, changes);
+};
 inline void z_call(const zc_loaned_closure_matching_status_t* closure, const zc_matching_status_t* mathing_status) {
     zc_closure_matching_status_call(closure, mathing_status);
 };
+inline void z_call(const zc_loaned_closure_span_t* closure, const zc_span_t* span) {
+    zc_closure_span_call(closure, span);
+};
 inline void z_call(const ze_loaned_closure_miss_t* closure, const ze_miss_t* mathing_status) {
     ze_closure_miss_call(closure, mathing_status);
 };
@@ -1166,8 +1532,10 @@ extern "C" using z_closure_query_callback_t = void(z_loaned_query_t *query, void
 extern "C" using z_closure_reply_callback_t = void(z_loaned_reply_t *reply, void *context);
 extern "C" using z_closure_sample_callback_t = void(z_loaned_sample_t *sample, void *context);
 extern "C" using z_closure_zid_callback_t = void(const z_id_t *z_id, void *context);
+extern "C" using zc_closure_liveliness_changes_callback_t = void(const zc_liveliness_changes_t *changes, void *context);
 extern "C" using zc_closure_log_callback_t = void(zc_log_severity_t severity, const z_loaned_string_t *msg, void *context);
 extern "C" using zc_closure_matching_status_callback_t = void(const zc_matching_status_t *matching_status, void *context);
+extern "C" using zc_closure_span_callback_t = void(const zc_span_t *span, void *context);
 extern "C" using ze_closure_miss_callback_t = void(const ze_miss_t *matching_status, void *context);
 
 inline void z_closure(z_owned_closure_hello_t* this_, z_closure_hello_callback_t* call,
@@ -1190,6 +1558,10 @@ inline void z_closure(z_owned_closure_zid_t* this_, z_closure_zid_callback_t* ca
     z_closure_drop_callback_t* drop, void* context) {
     z_closure_zid(this_, call, drop, context);
 };
+inline void z_closure(zc_owned_closure_liveliness_changes_t* this_, zc_closure_liveliness_changes_callback_t* call,
+    z_closure_drop_callback_t* drop, void* context) {
+    zc_closure_liveliness_changes(this_, call, drop, context);
+};
 inline void z_closure(zc_owned_closure_log_t* this_, zc_closure_log_callback_t* call,
     z_closure_drop_callback_t* drop, void* context) {
     zc_closure_log(this_, call, drop, context);
@@ -1198,12 +1570,22 @@ inline void z_closure(zc_owned_closure_matching_status_t* this_, zc_closure_matc
     z_closure_drop_callback_t* drop, void* context) {
     zc_closure_matching_status(this_, call, drop, context);
 };
+inline void z_closure(zc_owned_closure_span_t* this_, zc_closure_span_callback_t* call,
+    z_closure_drop_callback_t* drop, void* context) {
+    zc_closure_span(this_, call, drop, context);
+};
 inline void z_closure(ze_owned_closure_miss_t* this_, ze_closure_miss_callback_t* call,
     z_closure_drop_callback_t* drop, void* context) {
     ze_closure_miss(this_, call, drop, context);
 };
 
 
+inline z_result_t z_try_recv(const z_loaned_conflating_handler_sample_t* this_, z_owned_sample_t* sample) {
+    return z_conflating_handler_sample_try_recv(this_, sample);
+};
+inline z_result_t z_try_recv(const z_loaned_credit_handler_reply_t* this_, z_owned_reply_t* reply) {
+    return z_credit_handler_reply_try_recv(this_, reply);
+};
 inline z_result_t z_try_recv(const z_loaned_fifo_handler_query_t* this_, z_owned_query_t* query) {
     return z_fifo_handler_query_try_recv(this_, query);
 };
@@ -1213,6 +1595,9 @@ inline z_result_t z_try_recv(const z_loaned_fifo_handler_reply_t* this_, z_owned
 inline z_result_t z_try_recv(const z_loaned_fifo_handler_sample_t* this_, z_owned_sample_t* sample) {
     return z_fifo_handler_sample_try_recv(this_, sample);
 };
+inline z_result_t z_try_recv(const z_loaned_priority_handler_sample_t* this_, z_owned_sample_t* sample) {
+    return z_priority_handler_sample_try_recv(this_, sample);
+};
 inline z_result_t z_try_recv(const z_loaned_ring_handler_query_t* this_, z_owned_query_t* query) {
     return z_ring_handler_query_try_recv(this_, query);
 };
@@ -1222,8 +1607,17 @@ inline z_result_t z_try_recv(const z_loaned_ring_handler_reply_t* this_, z_owned
 inline z_result_t z_try_recv(const z_loaned_ring_handler_sample_t* this_, z_owned_sample_t* sample) {
     return z_ring_handler_sample_try_recv(this_, sample);
 };
+inline z_result_t z_try_recv(const z_loaned_spsc_handler_sample_t* this_, z_owned_sample_t* sample) {
+    return z_spsc_handler_sample_try_recv(this_, sample);
+};
 
 
+inline z_result_t z_recv(const z_loaned_conflating_handler_sample_t* this_, z_owned_sample_t* sample) {
+    return z_conflating_handler_sample_recv(this_, sample);
+};
+inline z_result_t z_recv(const z_loaned_credit_handler_reply_t* this_, z_owned_reply_t* reply) {
+    return z_credit_handler_reply_recv(this_, reply);
+};
 inline z_result_t z_recv(const z_loaned_fifo_handler_query_t* this_, z_owned_query_t* query) {
     return z_fifo_handler_query_recv(this_, query);
 };
@@ -1233,6 +1627,9 @@ inline z_result_t z_recv(const z_loaned_fifo_handler_reply_t* this_, z_owned_rep
 inline z_result_t z_recv(const z_loaned_fifo_handler_sample_t* this_, z_owned_sample_t* sample) {
     return z_fifo_handler_sample_recv(this_, sample);
 };
+inline z_result_t z_recv(const z_loaned_priority_handler_sample_t* this_, z_owned_sample_t* sample) {
+    return z_priority_handler_sample_recv(this_, sample);
+};
 inline z_result_t z_recv(const z_loaned_ring_handler_query_t* this_, z_owned_query_t* query) {
     return z_ring_handler_query_recv(this_, query);
 };
@@ -1242,11 +1639,17 @@ inline z_result_t z_recv(const z_loaned_ring_handler_reply_t* this_, z_owned_rep
 inline z_result_t z_recv(const z_loaned_ring_handler_sample_t* this_, z_owned_sample_t* sample) {
     return z_ring_handler_sample_recv(this_, sample);
 };
+inline z_result_t z_recv(const z_loaned_spsc_handler_sample_t* this_, z_owned_sample_t* sample) {
+    return z_spsc_handler_sample_recv(this_, sample);
+};
 
 
 inline void z_clone(z_owned_bytes_t* dst, z_loaned_bytes_t* this_) {
     z_bytes_clone(dst, this_);
 };
+inline void z_clone(z_owned_cancellation_token_t* dst, z_loaned_cancellation_token_t* this_) {
+    z_cancellation_token_clone(dst, this_);
+};
 inline void z_clone(z_owned_config_t* dst, z_loaned_config_t* this_) {
     z_config_clone(dst, this_);
 };
@@ -1286,15 +1689,22 @@ inline void z_clone(z_owned_string_array_t* dst, z_loaned_string_array_t* this_)
 inline void z_clone(z_owned_string_t* dst, z_loaned_string_t* this_) {
     z_string_clone(dst, this_);
 };
+inline void z_clone(zc_owned_string_arena_t* dst, zc_loaned_string_arena_t* this_) {
+    zc_string_arena_clone(dst, this_);
+};
 
 template<class T> struct z_loaned_to_owned_type_t {};
 template<class T> struct z_owned_to_loaned_type_t {};
+template<> struct z_loaned_to_owned_type_t<z_loaned_adaptive_mutex_t> { typedef z_owned_adaptive_mutex_t type; };
+template<> struct z_owned_to_loaned_type_t<z_owned_adaptive_mutex_t> { typedef z_loaned_adaptive_mutex_t type; };
 template<> struct z_loaned_to_owned_type_t<z_loaned_alloc_layout_t> { typedef z_owned_alloc_layout_t type; };
 template<> struct z_owned_to_loaned_type_t<z_owned_alloc_layout_t> { typedef z_loaned_alloc_layout_t type; };
 template<> struct z_loaned_to_owned_type_t<z_loaned_bytes_t> { typedef z_owned_bytes_t type; };
 template<> struct z_owned_to_loaned_type_t<z_owned_bytes_t> { typedef z_loaned_bytes_t type; };
 template<> struct z_loaned_to_owned_type_t<z_loaned_bytes_writer_t> { typedef z_owned_bytes_writer_t type; };
 template<> struct z_owned_to_loaned_type_t<z_owned_bytes_writer_t> { typedef z_loaned_bytes_writer_t type; };
+template<> struct z_loaned_to_owned_type_t<z_loaned_cancellation_token_t> { typedef z_owned_cancellation_token_t type; };
+template<> struct z_owned_to_loaned_type_t<z_owned_cancellation_token_t> { typedef z_loaned_cancellation_token_t type; };
 template<> struct z_loaned_to_owned_type_t<z_loaned_closure_hello_t> { typedef z_owned_closure_hello_t type; };
 template<> struct z_owned_to_loaned_type_t<z_owned_closure_hello_t> { typedef z_loaned_closure_hello_t type; };
 template<> struct z_loaned_to_owned_type_t<z_loaned_closure_query_t> { typedef z_owned_closure_query_t type; };
@@ -1309,8 +1719,14 @@ template<> struct z_loaned_to_owned_type_t<z_loaned_condvar_t> { typedef z_owned
 template<> struct z_owned_to_loaned_type_t<z_owned_condvar_t> { typedef z_loaned_condvar_t type; };
 template<> struct z_loaned_to_owned_type_t<z_loaned_config_t> { typedef z_owned_config_t type; };
 template<> struct z_owned_to_loaned_type_t<z_owned_config_t> { typedef z_loaned_config_t type; };
+template<> struct z_loaned_to_owned_type_t<z_loaned_conflating_handler_sample_t> { typedef z_owned_conflating_handler_sample_t type; };
+template<> struct z_owned_to_loaned_type_t<z_owned_conflating_handler_sample_t> { typedef z_loaned_conflating_handler_sample_t type; };
+template<> struct z_loaned_to_owned_type_t<z_loaned_credit_handler_reply_t> { typedef z_owned_credit_handler_reply_t type; };
+template<> struct z_owned_to_loaned_type_t<z_owned_credit_handler_reply_t> { typedef z_loaned_credit_handler_reply_t type; };
 template<> struct z_loaned_to_owned_type_t<z_loaned_encoding_t> { typedef z_owned_encoding_t type; };
 template<> struct z_owned_to_loaned_type_t<z_owned_encoding_t> { typedef z_loaned_encoding_t type; };
+template<> struct z_loaned_to_owned_type_t<z_loaned_executor_t> { typedef z_owned_executor_t type; };
+template<> struct z_owned_to_loaned_type_t<z_owned_executor_t> { typedef z_loaned_executor_t type; };
 template<> struct z_loaned_to_owned_type_t<z_loaned_fifo_handler_query_t> { typedef z_owned_fifo_handler_query_t type; };
 template<> struct z_owned_to_loaned_type_t<z_owned_fifo_handler_query_t> { typedef z_loaned_fifo_handler_query_t type; };
 template<> struct z_loaned_to_owned_type_t<z_loaned_fifo_handler_reply_t> { typedef z_owned_fifo_handler_reply_t type; };
@@ -1325,6 +1741,8 @@ template<> struct z_loaned_to_owned_type_t<z_loaned_liveliness_token_t> { typede
 template<> struct z_owned_to_loaned_type_t<z_owned_liveliness_token_t> { typedef z_loaned_liveliness_token_t type; };
 template<> struct z_loaned_to_owned_type_t<z_loaned_memory_layout_t> { typedef z_owned_memory_layout_t type; };
 template<> struct z_owned_to_loaned_type_t<z_owned_memory_layout_t> { typedef z_loaned_memory_layout_t type; };
+template<> struct z_loaned_to_owned_type_t<z_loaned_priority_handler_sample_t> { typedef z_owned_priority_handler_sample_t type; };
+template<> struct z_owned_to_loaned_type_t<z_owned_priority_handler_sample_t> { typedef z_loaned_priority_handler_sample_t type; };
 template<> struct z_loaned_to_owned_type_t<z_loaned_publisher_t> { typedef z_owned_publisher_t type; };
 template<> struct z_owned_to_loaned_type_t<z_owned_publisher_t> { typedef z_loaned_publisher_t type; };
 template<> struct z_loaned_to_owned_type_t<z_loaned_querier_t> { typedef z_owned_querier_t type; };
@@ -1343,8 +1761,12 @@ template<> struct z_loaned_to_owned_type_t<z_loaned_ring_handler_reply_t> { type
 template<> struct z_owned_to_loaned_type_t<z_owned_ring_handler_reply_t> { typedef z_loaned_ring_handler_reply_t type; };
 template<> struct z_loaned_to_owned_type_t<z_loaned_ring_handler_sample_t> { typedef z_owned_ring_handler_sample_t type; };
 template<> struct z_owned_to_loaned_type_t<z_owned_ring_handler_sample_t> { typedef z_loaned_ring_handler_sample_t type; };
+template<> struct z_loaned_to_owned_type_t<z_loaned_rwlock_t> { typedef z_owned_rwlock_t type; };
+template<> struct z_owned_to_loaned_type_t<z_owned_rwlock_t> { typedef z_loaned_rwlock_t type; };
 template<> struct z_loaned_to_owned_type_t<z_loaned_sample_t> { typedef z_owned_sample_t type; };
 template<> struct z_owned_to_loaned_type_t<z_owned_sample_t> { typedef z_loaned_sample_t type; };
+template<> struct z_loaned_to_owned_type_t<z_loaned_semaphore_t> { typedef z_owned_semaphore_t type; };
+template<> struct z_owned_to_loaned_type_t<z_owned_semaphore_t> { typedef z_loaned_semaphore_t type; };
 template<> struct z_loaned_to_owned_type_t<z_loaned_session_t> { typedef z_owned_session_t type; };
 template<> struct z_owned_to_loaned_type_t<z_owned_session_t> { typedef z_loaned_session_t type; };
 template<> struct z_loaned_to_owned_type_t<z_loaned_shm_client_storage_t> { typedef z_owned_shm_client_storage_t type; };
@@ -1359,22 +1781,44 @@ template<> struct z_loaned_to_owned_type_t<z_loaned_slice_t> { typedef z_owned_s
 template<> struct z_owned_to_loaned_type_t<z_owned_slice_t> { typedef z_loaned_slice_t type; };
 template<> struct z_loaned_to_owned_type_t<z_loaned_source_info_t> { typedef z_owned_source_info_t type; };
 template<> struct z_owned_to_loaned_type_t<z_owned_source_info_t> { typedef z_loaned_source_info_t type; };
+template<> struct z_loaned_to_owned_type_t<z_loaned_spsc_handler_sample_t> { typedef z_owned_spsc_handler_sample_t type; };
+template<> struct z_owned_to_loaned_type_t<z_owned_spsc_handler_sample_t> { typedef z_loaned_spsc_handler_sample_t type; };
 template<> struct z_loaned_to_owned_type_t<z_loaned_string_array_t> { typedef z_owned_string_array_t type; };
 template<> struct z_owned_to_loaned_type_t<z_owned_string_array_t> { typedef z_loaned_string_array_t type; };
 template<> struct z_loaned_to_owned_type_t<z_loaned_string_t> { typedef z_owned_string_t type; };
 template<> struct z_owned_to_loaned_type_t<z_owned_string_t> { typedef z_loaned_string_t type; };
 template<> struct z_loaned_to_owned_type_t<z_loaned_subscriber_t> { typedef z_owned_subscriber_t type; };
 template<> struct z_owned_to_loaned_type_t<z_owned_subscriber_t> { typedef z_loaned_subscriber_t type; };
+template<> struct z_loaned_to_owned_type_t<zc_loaned_bytes_pool_t> { typedef zc_owned_bytes_pool_t type; };
+template<> struct z_owned_to_loaned_type_t<zc_owned_bytes_pool_t> { typedef zc_loaned_bytes_pool_t type; };
+template<> struct z_loaned_to_owned_type_t<zc_loaned_closure_indexed_reply_t> { typedef zc_owned_closure_indexed_reply_t type; };
+template<> struct z_owned_to_loaned_type_t<zc_owned_closure_indexed_reply_t> { typedef zc_loaned_closure_indexed_reply_t type; };
+template<> struct z_loaned_to_owned_type_t<zc_loaned_closure_liveliness_changes_t> { typedef zc_owned_closure_liveliness_changes_t type; };
+template<> struct z_owned_to_loaned_type_t<zc_owned_closure_liveliness_changes_t> { typedef zc_loaned_closure_liveliness_changes_t type; };
 template<> struct z_loaned_to_owned_type_t<zc_loaned_closure_log_t> { typedef zc_owned_closure_log_t type; };
 template<> struct z_owned_to_loaned_type_t<zc_owned_closure_log_t> { typedef zc_loaned_closure_log_t type; };
 template<> struct z_loaned_to_owned_type_t<zc_loaned_closure_matching_status_t> { typedef zc_owned_closure_matching_status_t type; };
 template<> struct z_owned_to_loaned_type_t<zc_owned_closure_matching_status_t> { typedef zc_loaned_closure_matching_status_t type; };
+template<> struct z_loaned_to_owned_type_t<zc_loaned_closure_span_t> { typedef zc_owned_closure_span_t type; };
+template<> struct z_owned_to_loaned_type_t<zc_owned_closure_span_t> { typedef zc_loaned_closure_span_t type; };
+template<> struct z_loaned_to_owned_type_t<zc_loaned_keyexpr_interner_t> { typedef zc_owned_keyexpr_interner_t type; };
+template<> struct z_owned_to_loaned_type_t<zc_owned_keyexpr_interner_t> { typedef zc_loaned_keyexpr_interner_t type; };
+template<> struct z_loaned_to_owned_type_t<zc_loaned_keyexpr_matcher_t> { typedef zc_owned_keyexpr_matcher_t type; };
+template<> struct z_owned_to_loaned_type_t<zc_owned_keyexpr_matcher_t> { typedef zc_loaned_keyexpr_matcher_t type; };
+template<> struct z_loaned_to_owned_type_t<zc_loaned_shm_client_cache_t> { typedef zc_owned_shm_client_cache_t type; };
+template<> struct z_owned_to_loaned_type_t<zc_owned_shm_client_cache_t> { typedef zc_loaned_shm_client_cache_t type; };
 template<> struct z_loaned_to_owned_type_t<zc_loaned_shm_client_list_t> { typedef zc_owned_shm_client_list_t type; };
 template<> struct z_owned_to_loaned_type_t<zc_owned_shm_client_list_t> { typedef zc_loaned_shm_client_list_t type; };
+template<> struct z_loaned_to_owned_type_t<zc_loaned_shm_completion_queue_t> { typedef zc_owned_shm_completion_queue_t type; };
+template<> struct z_owned_to_loaned_type_t<zc_owned_shm_completion_queue_t> { typedef zc_loaned_shm_completion_queue_t type; };
+template<> struct z_loaned_to_owned_type_t<zc_loaned_string_arena_t> { typedef zc_owned_string_arena_t type; };
+template<> struct z_owned_to_loaned_type_t<zc_owned_string_arena_t> { typedef zc_loaned_string_arena_t type; };
 template<> struct z_loaned_to_owned_type_t<ze_loaned_advanced_publisher_t> { typedef ze_owned_advanced_publisher_t type; };
 template<> struct z_owned_to_loaned_type_t<ze_owned_advanced_publisher_t> { typedef ze_loaned_advanced_publisher_t type; };
 template<> struct z_loaned_to_owned_type_t<ze_loaned_advanced_subscriber_t> { typedef ze_owned_advanced_subscriber_t type; };
 template<> struct z_owned_to_loaned_type_t<ze_owned_advanced_subscriber_t> { typedef ze_loaned_advanced_subscriber_t type; };
+template<> struct z_loaned_to_owned_type_t<ze_loaned_cache_budget_t> { typedef ze_owned_cache_budget_t type; };
+template<> struct z_owned_to_loaned_type_t<ze_owned_cache_budget_t> { typedef ze_loaned_cache_budget_t type; };
 template<> struct z_loaned_to_owned_type_t<ze_loaned_closure_miss_t> { typedef ze_owned_closure_miss_t type; };
 template<> struct z_owned_to_loaned_type_t<ze_owned_closure_miss_t> { typedef ze_loaned_closure_miss_t type; };
 template<> struct z_loaned_to_owned_type_t<ze_loaned_publication_cache_t> { typedef ze_owned_publication_cache_t type; };
@@ -2,6 +2,23 @@
 #include <stdlib.h>
 
 /*------------------ Memory ------------------*/
+#if defined(Z_FEATURE_ALLOC_STATS)
+static inline void *z_malloc(size_t size) {
+    zc_internal_alloc_stats_count_alloc(size);
+    return malloc(size);
+}
+static inline void *z_realloc(void *ptr, size_t size) {
+    zc_internal_alloc_stats_count_alloc(size);
+    return realloc(ptr, size);
+}
+static inline void z_free(void *ptr) {
+    if (ptr != NULL) {
+        zc_internal_alloc_stats_count_free();
+    }
+    free(ptr);
+}
+#else
 static inline void *z_malloc(size_t size) { return malloc(size); }
 static inline void *z_realloc(void *ptr, size_t size) { return realloc(ptr, size); }
-static inline void z_free(void *ptr) { free(ptr); }
\ No newline at end of file
+static inline void z_free(void *ptr) { free(ptr); }
+#endif
@@ -0,0 +1,251 @@
+//
+// Copyright (c) 2024 ZettaScale Technology.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh team, <zenoh@zettascale.tech>
+//
+
+use std::{
+    collections::BTreeMap,
+    mem::MaybeUninit,
+    sync::{Arc, Mutex},
+    time::{Duration, SystemTime},
+};
+
+use chrono::{DateTime, SecondsFormat, Utc};
+use zenoh::{
+    key_expr::KeyExpr,
+    query::{ConsolidationMode, Selector},
+    sample::Sample,
+    Session, Wait,
+};
+
+use crate::{
+    result,
+    transmute::{LoanedCTypeRef, RustTypeRef, TakeRustType},
+    z_closure_sample_call, z_closure_sample_loan, z_loaned_keyexpr_t, z_loaned_session_t,
+    z_moved_closure_sample_t, z_owned_closure_sample_t,
+};
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Options passed to the `ze_get_history_paged()` function.
+#[repr(C)]
+pub struct ze_history_pages_options_t {
+    /// Maximum age of the samples to retrieve, must be non-zero.
+    pub max_age_ms: u64,
+    /// The time span covered by each page, i.e. by each query to the publishers' caches.
+    pub page_ms: u64,
+    /// The maximum number of pages queried at once. Completed pages are buffered until all the older ones are delivered,
+    /// so this also bounds the number of pages held in memory.
+    pub max_inflight_pages: usize,
+    /// The timeout of each page query. Default query timeout from zenoh configuration will be used if set to ``0``.
+    pub query_timeout_ms: u64,
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs the default value for `ze_history_pages_options_t`.
+#[no_mangle]
+pub extern "C" fn ze_history_pages_options_default(
+    this: &mut MaybeUninit<ze_history_pages_options_t>,
+) {
+    this.write(ze_history_pages_options_t {
+        max_age_ms: 60_000,
+        page_ms: 1000,
+        max_inflight_pages: 4,
+        query_timeout_ms: 0,
+    });
+}
+
+#[derive(Default)]
+struct PagesState {
+    next_query: usize,
+    next_delivery: usize,
+    completed: BTreeMap<usize, Vec<Sample>>,
+}
+
+/// A history retrieval split into time windows, queried a few at a time and delivered oldest first.
+struct HistoryPages {
+    session: Session,
+    key_expr: KeyExpr<'static>,
+    timeout: Option<Duration>,
+    windows: Vec<(SystemTime, SystemTime)>,
+    max_inflight: usize,
+    state: Mutex<PagesState>,
+    // serializes the deliveries, it is always taken before releasing `state`
+    delivery: Mutex<()>,
+    callback: z_owned_closure_sample_t,
+}
+
+/// Collects the samples of one page, the page is completed when the collector is dropped with the query callback.
+struct PageCollector {
+    pages: Arc<HistoryPages>,
+    index: usize,
+    samples: Mutex<Vec<Sample>>,
+}
+
+impl Drop for PageCollector {
+    fn drop(&mut self) {
+        let samples = std::mem::take(self.samples.get_mut().unwrap_or_else(|e| e.into_inner()));
+        HistoryPages::complete(&self.pages, self.index, samples);
+    }
+}
+
+fn format_time(t: SystemTime) -> String {
+    DateTime::<Utc>::from(t).to_rfc3339_opts(SecondsFormat::Nanos, true)
+}
+
+impl HistoryPages {
+    fn query(this: &Arc<Self>, index: usize) {
+        let (start, end) = this.windows[index];
+        // all windows but the last one exclude their end, which is the start of the next one
+        let end_bound = if index + 1 == this.windows.len() {
+            ']'
+        } else {
+            '['
+        };
+        let parameters = format!(
+            "_time=[{}..{}{}",
+            format_time(start),
+            format_time(end),
+            end_bound
+        );
+        let collector = PageCollector {
+            pages: this.clone(),
+            index,
+            samples: Mutex::new(Vec::new()),
+        };
+        let mut get = this
+            .session
+            .get(Selector::from((&this.key_expr, parameters)))
+            .consolidation(ConsolidationMode::None);
+        if let Some(timeout) = this.timeout {
+            get = get.timeout(timeout);
+        }
+        let res = get
+            .callback(move |reply| {
+                if let Ok(sample) = reply.into_result() {
+                    collector
+                        .samples
+                        .lock()
+                        .unwrap_or_else(|e| e.into_inner())
+                        .push(sample);
+                }
+            })
+            .wait();
+        // on failure the callback, hence the collector, is dropped and the page is completed empty
+        if let Err(e) = res {
+            tracing::error!("Failed to query history page {}: {}", index, e);
+        }
+    }
+
+    fn complete(this: &Arc<Self>, index: usize, mut samples: Vec<Sample>) {
+        samples.sort_by(|a, b| a.timestamp().cmp(&b.timestamp()));
+        let mut state = this.state.lock().unwrap_or_else(|e| e.into_inner());
+        state.completed.insert(index, samples);
+        let mut ready = Vec::new();
+        while let Some(samples) = state.completed.remove(&state.next_delivery) {
+            ready.push(samples);
+            state.next_delivery += 1;
+        }
+        let mut to_query = Vec::new();
+        while state.next_query < this.windows.len()
+            && state.next_query - state.next_delivery < this.max_inflight
+        {
+            to_query.push(state.next_query);
+            state.next_query += 1;
+        }
+        let delivery = this.delivery.lock().unwrap_or_else(|e| e.into_inner());
+        drop(state);
+        for sample in ready.into_iter().flatten() {
+            let mut owned_sample = Some(sample);
+            z_closure_sample_call(z_closure_sample_loan(&this.callback), unsafe {
+                owned_sample
+                    .as_mut()
+                    .unwrap_unchecked()
+                    .as_loaned_c_type_mut()
+            });
+        }
+        drop(delivery);
+        for index in to_query {
+            HistoryPages::query(this, index);
+        }
+    }
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Retrieves the history cached by advanced publishers, one page of time at a time.
+///
+/// The history of the last `max_age_ms` milliseconds is split in pages of `page_ms` milliseconds, and at most
+/// `max_inflight_pages` pages are queried at once from the caches of the advanced publishers matching `key_expr`.
+/// The samples are passed to `callback` page by page, oldest page first, each page being sorted by timestamp, so that
+/// the caches are not flooded and the first samples are delivered without waiting for the whole history.
+/// The callback is dropped once all pages are delivered.
+///
+/// This is meant to be used together with an advanced subscriber declared without history, which delivers
+/// the live samples meanwhile. Samples from the most recent page may then be delivered twice.
+///
+/// @param session: The zenoh session.
+/// @param key_expr: The key expression of the advanced publishers.
+/// @param callback: The callback function that will be called for each historical sample.
+/// @param options: The options for the retrieval, if `NULL` the default ones are used.
+///
+/// @return 0 in case of success, `Z_EINVAL` if `max_age_ms` or `page_ms` is 0.
+#[no_mangle]
+pub extern "C" fn ze_get_history_paged(
+    session: &z_loaned_session_t,
+    key_expr: &z_loaned_keyexpr_t,
+    callback: &mut z_moved_closure_sample_t,
+    options: Option<&ze_history_pages_options_t>,
+) -> result::z_result_t {
+    let callback = callback.take_rust_type();
+    let mut default = MaybeUninit::uninit();
+    ze_history_pages_options_default(&mut default);
+    let options = options.unwrap_or_else(|| unsafe { default.assume_init_ref() });
+    if options.max_age_ms == 0 || options.page_ms == 0 {
+        tracing::error!("History max age and page duration must be non-zero");
+        return result::Z_EINVAL;
+    }
+    let key_expr = match key_expr.as_rust_type_ref().join("@adv/**") {
+        Ok(k) => k,
+        Err(e) => {
+            tracing::error!("{}", e);
+            return result::Z_EINVAL;
+        }
+    };
+    let now = SystemTime::now();
+    let page = Duration::from_millis(options.page_ms);
+    let mut windows = Vec::new();
+    let mut start = now - Duration::from_millis(options.max_age_ms);
+    while start < now {
+        let end = (start + page).min(now);
+        windows.push((start, end));
+        start = end;
+    }
+    let pages = Arc::new(HistoryPages {
+        session: session.as_rust_type_ref().clone(),
+        key_expr,
+        timeout: (options.query_timeout_ms != 0)
+            .then(|| Duration::from_millis(options.query_timeout_ms)),
+        windows,
+        max_inflight: options.max_inflight_pages.max(1),
+        state: Mutex::new(PagesState::default()),
+        delivery: Mutex::new(()),
+        callback,
+    });
+    let first = {
+        let mut state = pages.state.lock().unwrap_or_else(|e| e.into_inner());
+        state.next_query = pages.windows.len().min(pages.max_inflight);
+        state.next_query
+    };
+    for index in 0..first {
+        HistoryPages::query(&pages, index);
+    }
+    result::Z_OK
+}
@@ -12,7 +12,7 @@
 //   ZettaScale Zenoh team, <zenoh@zettascale.tech>
 //
 
-use std::mem::MaybeUninit;
+use std::{mem::MaybeUninit, ops::Deref};
 
 use zenoh::{
     handlers::Callback,
@@ -25,6 +25,7 @@ use zenoh_ext::{AdvancedPublisherBuilderExt, CacheConfig};
 
 use crate::{
     _apply_pubisher_delete_options, _apply_pubisher_put_options, _declare_publisher_inner,
+    delta::DeltaEncoder,
     result::{self},
     transmute::{IntoCType, LoanedCTypeRef, RustTypeRef, RustTypeRefUninit, TakeRustType},
     z_congestion_control_t, z_entity_global_id_t, z_loaned_keyexpr_t, z_loaned_session_t,
@@ -123,8 +124,23 @@ pub extern "C" fn ze_advanced_publisher_options_default(
 pub use crate::opaque_types::{
     ze_loaned_advanced_publisher_t, ze_moved_advanced_publisher_t, ze_owned_advanced_publisher_t,
 };
+
+/// An advanced publisher, together with the state of its delta mode.
+pub struct CAdvancedPublisher {
+    delta: Option<DeltaEncoder>,
+    publisher: zenoh_ext::AdvancedPublisher<'static>,
+}
+
+impl Deref for CAdvancedPublisher {
+    type Target = zenoh_ext::AdvancedPublisher<'static>;
+
+    fn deref(&self) -> &Self::Target {
+        &self.publisher
+    }
+}
+
 decl_c_type!(
-    owned(ze_owned_advanced_publisher_t, option zenoh_ext::AdvancedPublisher<'static>),
+    owned(ze_owned_advanced_publisher_t, option CAdvancedPublisher),
     loaned(ze_loaned_advanced_publisher_t),
 );
 
@@ -149,11 +165,20 @@ pub extern "C" fn ze_declare_advanced_publisher(
     mut options: Option<&'static mut ze_advanced_publisher_options_t>,
 ) -> result::z_result_t {
     let this = publisher.as_rust_type_mut_uninit();
-    let p = _declare_publisher_inner(
+    let delta = options.as_ref().map(|o| o.publisher_options.delta);
+    // The encoding is kept to mark the payloads of the delta mode.
+    let encoding = options
+        .as_mut()
+        .and_then(|o| o.publisher_options.encoding.take())
+        .map(|e| e.take_rust_type());
+    let mut p = _declare_publisher_inner(
         session,
         key_expr,
         options.as_mut().map(|o| &mut o.publisher_options),
     );
+    if let Some(encoding) = &encoding {
+        p = p.encoding(encoding.clone());
+    }
     let mut p = p.advanced();
     if let Some(options) = options {
         if options.publisher_detection {
@@ -176,7 +201,9 @@ pub extern "C" fn ze_declare_advanced_publisher(
             result::Z_EGENERIC
         }
         Ok(publisher) => {
-            this.write(Some(publisher));
+            let delta = delta
+                .and_then(|d| DeltaEncoder::new(&d, publisher.id(), &encoding.unwrap_or_default()));
+            this.write(Some(CAdvancedPublisher { delta, publisher }));
             result::Z_OK
         }
     }
@@ -268,11 +295,28 @@ pub unsafe extern "C" fn ze_advanced_publisher_put(
 ) -> result::z_result_t {
     let publisher = this.as_rust_type_ref();
     let payload = payload.take_rust_type();
-    let mut put = publisher.put(payload);
-    if let Some(options) = options {
-        put = _apply_pubisher_put_options(put, &mut options.put_options);
-    }
-    match put.wait() {
+    let Some(delta) = &publisher.delta else {
+        let mut put = publisher.put(payload);
+        if let Some(options) = options {
+            put = _apply_pubisher_put_options(put, &mut options.put_options);
+        }
+        return _advanced_publisher_put_result(put.wait());
+    };
+    let mut options = options;
+    let encoding = options
+        .as_deref_mut()
+        .and_then(|o| o.put_options.take_encoding());
+    delta.encode_with(&payload, |encoded| {
+        let mut put = publisher.put(encoded);
+        if let Some(options) = options {
+            put = _apply_pubisher_put_options(put, &mut options.put_options);
+        }
+        _advanced_publisher_put_result(put.encoding(delta.encoding(encoding)).wait())
+    })
+}
+
+fn _advanced_publisher_put_result(res: zenoh::Result<()>) -> result::z_result_t {
+    match res {
         Ok(_) => result::Z_OK,
         Err(e) if e.downcast_ref::<SessionClosedError>().is_some() => result::Z_ESESSION_CLOSED,
         Err(e) => {
@@ -462,7 +506,7 @@ pub extern "C" fn ze_undeclare_advanced_publisher(
     this_: &mut ze_moved_advanced_publisher_t,
 ) -> result::z_result_t {
     if let Some(p) = this_.take_rust_type() {
-        if let Err(e) = p.undeclare().wait() {
+        if let Err(e) = p.publisher.undeclare().wait() {
             tracing::error!("{}", e);
             return result::Z_ENETWORK;
         }
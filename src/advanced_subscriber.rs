@@ -12,13 +12,18 @@
 //   ZettaScale Zenoh team, <zenoh@zettascale.tech>
 //
 
-use std::{mem::MaybeUninit, time::Duration};
+use std::{collections::HashMap, mem::MaybeUninit, time::Duration};
 
-use zenoh::{handlers::Callback, liveliness::LivelinessSubscriberBuilder, sample::Sample, Wait};
+use zenoh::{
+    handlers::Callback, liveliness::LivelinessSubscriberBuilder, sample::Sample,
+    session::EntityGlobalId, Wait,
+};
 use zenoh_ext::{AdvancedSubscriberBuilderExt, HistoryConfig, RecoveryConfig, SampleMissListener};
 
 use crate::{
-    _declare_subscriber_inner, result,
+    _declare_subscriber_inner,
+    entity_stats::{EntityKind, EntityStats},
+    result,
     transmute::{IntoCType, LoanedCTypeRef, RustTypeRef, RustTypeRefUninit, TakeRustType},
     z_closure_sample_call, z_closure_sample_loan, z_entity_global_id_t,
     z_liveliness_subscriber_options_t, z_loaned_keyexpr_t, z_loaned_session_t,
@@ -177,8 +182,9 @@ fn _declare_advanced_subscriber_inner(
     let sub = _declare_subscriber_inner(
         session,
         key_expr,
-        callback,
+        callback.take_rust_type(),
         options.as_mut().map(|o| &mut o.subscriber_options),
+        EntityStats::new(session.as_rust_type_ref().zid(), EntityKind::Subscriber),
     );
     let mut sub = sub.advanced();
     if let Some(options) = options {
@@ -325,6 +331,12 @@ pub struct ze_miss_t {
     pub source: z_entity_global_id_t,
     /// The number of missed samples.
     pub nb: u32,
+    /// The total number of samples missed from this source since the listener was declared, including these ones.
+    ///
+    /// Only the samples which are permanently missed are counted. Lost samples which are recovered from the publisher's
+    /// cache are delivered to the subscriber's callback like any other sample: they are neither reported to the listener
+    /// nor counted, and no count of recovered samples is available.
+    pub total_nb: u64,
 }
 
 decl_c_type!(
@@ -380,10 +392,14 @@ fn _advanced_subscriber_sample_miss_listener_declare_inner<'a>(
 ) -> zenoh_ext::SampleMissListenerBuilder<'a, Callback<zenoh_ext::Miss>> {
     let subscriber = subscriber.as_rust_type_ref();
     let callback = callback.take_rust_type();
+    let mut totals: HashMap<EntityGlobalId, u64> = HashMap::new();
     let listener = subscriber.sample_miss_listener().callback_mut(move |miss| {
+        let total_nb = totals.entry(miss.source()).or_default();
+        *total_nb += miss.nb() as u64;
         let miss = ze_miss_t {
             source: miss.source().into_c_type(),
             nb: miss.nb(),
+            total_nb: *total_nb,
         };
         ze_closure_miss_call(ze_closure_miss_loan(&callback), &miss);
     });
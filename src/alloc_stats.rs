@@ -0,0 +1,103 @@
+//
+// Copyright (c) 2024 ZettaScale Technology.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh team, <zenoh@zettascale.tech>
+//
+
+use std::{
+    alloc::{GlobalAlloc, Layout, System},
+    mem::MaybeUninit,
+    sync::atomic::{AtomicU64, Ordering},
+};
+
+static ALLOCATIONS: AtomicU64 = AtomicU64::new(0);
+static DEALLOCATIONS: AtomicU64 = AtomicU64::new(0);
+static ALLOCATED_BYTES: AtomicU64 = AtomicU64::new(0);
+
+fn count_alloc(size: usize) {
+    ALLOCATIONS.fetch_add(1, Ordering::Relaxed);
+    ALLOCATED_BYTES.fetch_add(size as u64, Ordering::Relaxed);
+}
+
+fn count_dealloc() {
+    DEALLOCATIONS.fetch_add(1, Ordering::Relaxed);
+}
+
+/// The system allocator, counting the allocations of the library.
+struct CountingAllocator;
+
+unsafe impl GlobalAlloc for CountingAllocator {
+    unsafe fn alloc(&self, layout: Layout) -> *mut u8 {
+        count_alloc(layout.size());
+        System.alloc(layout)
+    }
+
+    unsafe fn alloc_zeroed(&self, layout: Layout) -> *mut u8 {
+        count_alloc(layout.size());
+        System.alloc_zeroed(layout)
+    }
+
+    unsafe fn dealloc(&self, ptr: *mut u8, layout: Layout) {
+        count_dealloc();
+        System.dealloc(ptr, layout)
+    }
+
+    unsafe fn realloc(&self, ptr: *mut u8, layout: Layout, new_size: usize) -> *mut u8 {
+        count_alloc(new_size);
+        System.realloc(ptr, layout, new_size)
+    }
+}
+
+#[global_allocator]
+static ALLOCATOR: CountingAllocator = CountingAllocator;
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief A snapshot of the heap allocation counters of the process, see `zc_alloc_stats_get()`.
+///
+/// Counters are cumulative since the library was loaded, a reallocation counting as an allocation of its new size.
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Default)]
+pub struct zc_alloc_stats_t {
+    /// Number of heap allocations.
+    pub allocations: u64,
+    /// Number of heap deallocations.
+    pub deallocations: u64,
+    /// Number of bytes allocated.
+    pub allocated_bytes: u64,
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns the heap allocation counters of the process.
+///
+/// The allocations of the library, from all its threads, and those of `z_malloc()` and `z_realloc()` are counted,
+/// so that the allocations performed by an operation are the difference between the counters read before and after
+/// it, provided no other thread allocates meanwhile. Available when zenoh-c is built with the `alloc-stats` feature,
+/// which replaces the global allocator of the library with a counting one.
+#[no_mangle]
+pub extern "C" fn zc_alloc_stats_get(stats: &mut MaybeUninit<zc_alloc_stats_t>) {
+    stats.write(zc_alloc_stats_t {
+        allocations: ALLOCATIONS.load(Ordering::Relaxed),
+        deallocations: DEALLOCATIONS.load(Ordering::Relaxed),
+        allocated_bytes: ALLOCATED_BYTES.load(Ordering::Relaxed),
+    });
+}
+
+/// @brief Counts an allocation of `size` bytes by `z_malloc()` or `z_realloc()`.
+#[no_mangle]
+pub extern "C" fn zc_internal_alloc_stats_count_alloc(size: usize) {
+    count_alloc(size);
+}
+
+/// @brief Counts a deallocation by `z_free()`.
+#[no_mangle]
+pub extern "C" fn zc_internal_alloc_stats_count_free() {
+    count_dealloc();
+}
@@ -0,0 +1,237 @@
+//
+// Copyright (c) 2024 ZettaScale Technology.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh team, <zenoh@zettascale.tech>
+//
+
+use std::{any::Any, fmt, mem::MaybeUninit, sync::Arc};
+
+use libc::c_char;
+use zenoh::{
+    bytes::ZBytes,
+    internal::buffers::{ZBuf, ZSliceBuffer},
+};
+
+use crate::{
+    result::{self, z_result_t},
+    transmute::RustTypeRefUninit,
+    z_owned_bytes_t,
+};
+
+// The size of the slices of a mapped file, matching the default batch size of the transport, so that each slice
+// is written in a single batch or fragment.
+const FILE_SLICE_SIZE: usize = 65535;
+
+/// A read-only mapping of a file region, unmapped once no slice refers to it anymore.
+struct FileMapping {
+    map: *mut u8,
+    map_len: usize,
+    // The offset of the requested region in the mapping, which starts at a page boundary.
+    start: usize,
+}
+
+// The mapping is never written.
+unsafe impl Send for FileMapping {}
+unsafe impl Sync for FileMapping {}
+
+impl FileMapping {
+    #[cfg(unix)]
+    fn open(
+        path: &std::path::Path,
+        offset: u64,
+        len: usize,
+    ) -> std::io::Result<(FileMapping, usize)> {
+        use std::os::unix::io::AsRawFd;
+        let file = std::fs::File::open(path)?;
+        let file_len = file.metadata()?.len();
+        if offset > file_len {
+            return Err(std::io::ErrorKind::InvalidInput.into());
+        }
+        let available = usize::try_from(file_len - offset)
+            .map_err(|_| std::io::Error::from(std::io::ErrorKind::InvalidInput))?;
+        let len = match len {
+            0 => available,
+            len if len <= available => len,
+            _ => return Err(std::io::ErrorKind::InvalidInput.into()),
+        };
+        if len == 0 {
+            return Ok((
+                FileMapping {
+                    map: std::ptr::null_mut(),
+                    map_len: 0,
+                    start: 0,
+                },
+                0,
+            ));
+        }
+        let page = unsafe { libc::sysconf(libc::_SC_PAGESIZE) } as u64;
+        let start = (offset % page) as usize;
+        let map_len = start + len;
+        let map = unsafe {
+            libc::mmap(
+                std::ptr::null_mut(),
+                map_len,
+                libc::PROT_READ,
+                libc::MAP_PRIVATE,
+                file.as_raw_fd(),
+                (offset - start as u64) as libc::off_t,
+            )
+        };
+        if map == libc::MAP_FAILED {
+            return Err(std::io::Error::last_os_error());
+        }
+        // Payloads are read front to back when they are sent, a failure to advise the kernel is harmless.
+        unsafe { libc::madvise(map, map_len, libc::MADV_SEQUENTIAL) };
+        // The mapping stays valid once the file is closed.
+        Ok((
+            FileMapping {
+                map: map as *mut u8,
+                map_len,
+                start,
+            },
+            len,
+        ))
+    }
+
+    #[cfg(not(unix))]
+    fn open(
+        _path: &std::path::Path,
+        _offset: u64,
+        _len: usize,
+    ) -> std::io::Result<(FileMapping, usize)> {
+        Err(std::io::ErrorKind::Unsupported.into())
+    }
+}
+
+impl Drop for FileMapping {
+    fn drop(&mut self) {
+        #[cfg(unix)]
+        if self.map_len != 0 {
+            unsafe {
+                libc::munmap(self.map as *mut libc::c_void, self.map_len);
+            }
+        }
+    }
+}
+
+/// A range of a mapped file region, passed to zenoh as a payload slice without copying it.
+struct FileSlice {
+    mapping: Arc<FileMapping>,
+    offset: usize,
+    len: usize,
+}
+
+impl fmt::Debug for FileSlice {
+    fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
+        f.debug_struct("FileSlice")
+            .field("offset", &self.offset)
+            .field("len", &self.len)
+            .finish()
+    }
+}
+
+impl ZSliceBuffer for FileSlice {
+    fn as_slice(&self) -> &[u8] {
+        unsafe {
+            std::slice::from_raw_parts(
+                self.mapping.map.add(self.mapping.start + self.offset),
+                self.len,
+            )
+        }
+    }
+    fn as_any(&self) -> &dyn Any {
+        self
+    }
+
+    fn as_any_mut(&mut self) -> &mut dyn Any {
+        self
+    }
+}
+
+#[cfg(unix)]
+unsafe fn path_from_c_str<'a>(path: *const c_char) -> Option<&'a std::path::Path> {
+    use std::os::unix::ffi::OsStrExt;
+    let path = std::ffi::CStr::from_ptr(path).to_bytes();
+    Some(std::path::Path::new(std::ffi::OsStr::from_bytes(path)))
+}
+
+#[cfg(not(unix))]
+unsafe fn path_from_c_str<'a>(path: *const c_char) -> Option<&'a std::path::Path> {
+    std::ffi::CStr::from_ptr(path)
+        .to_str()
+        .ok()
+        .map(std::path::Path::new)
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs data from a region of a file, mapped in memory rather than read.
+///
+/// The region is mapped read-only, so that it is paged in by the OS as the data is sent instead of being held in
+/// heap memory, and unmapped once the data and all its clones are dropped. The data is made of slices of up to
+/// 65535 bytes, the default batch size of the transport, which `z_bytes_get_slice_iterator()` returns in order.
+///
+/// The file must not be truncated while the data is alive: accessing a page beyond its end raises `SIGBUS`.
+/// Changes to the file may or may not be visible in the data, which should be treated as a snapshot of a file
+/// that is not written anymore.
+///
+/// @param this_: An uninitialized location in memory where `z_owned_bytes_t` is to be constructed.
+/// @param path: The null-terminated path of the file.
+/// @param offset: The offset of the region in the file.
+/// @param len: The length of the region, 0 for the rest of the file.
+/// @return 0 in case of success, `Z_EINVAL` if the region is not within the file, `Z_EIO` if the file can not be
+/// opened or mapped, `Z_EUNAVAILABLE` if mapping files is not supported on this platform. In case of failure,
+/// `this_` is constructed as empty data.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_bytes_from_file(
+    this_: &mut MaybeUninit<z_owned_bytes_t>,
+    path: *const c_char,
+    offset: u64,
+    len: usize,
+) -> z_result_t {
+    let this_ = this_.as_rust_type_mut_uninit();
+    this_.write(ZBytes::default());
+    let Some(path) = (!path.is_null()).then(|| path_from_c_str(path)).flatten() else {
+        tracing::error!("Invalid file path");
+        return result::Z_EINVAL;
+    };
+    let (mapping, len) = match FileMapping::open(path, offset, len) {
+        Ok(m) => m,
+        Err(e) if e.kind() == std::io::ErrorKind::InvalidInput => {
+            tracing::error!(
+                "The region at offset {} of length {} is not within {}",
+                offset,
+                len,
+                path.display()
+            );
+            return result::Z_EINVAL;
+        }
+        Err(e) if e.kind() == std::io::ErrorKind::Unsupported => {
+            tracing::error!("Mapping files is not supported on this platform");
+            return result::Z_EUNAVAILABLE;
+        }
+        Err(e) => {
+            tracing::error!("Failed to map {}: {}", path.display(), e);
+            return result::Z_EIO;
+        }
+    };
+    let mapping = Arc::new(mapping);
+    let mut writer = ZBytes::writer();
+    for offset in (0..len).step_by(FILE_SLICE_SIZE) {
+        writer.append(ZBytes::from(ZBuf::from(FileSlice {
+            mapping: mapping.clone(),
+            offset,
+            len: FILE_SLICE_SIZE.min(len - offset),
+        })));
+    }
+    this_.write(writer.finish());
+    result::Z_OK
+}
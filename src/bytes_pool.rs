@@ -0,0 +1,324 @@
+//
+// Copyright (c) 2017, 2024 ZettaScale Technology.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh team, <zenoh@zettascale.tech>
+//
+
+use std::{
+    any::Any,
+    fmt,
+    mem::MaybeUninit,
+    os::raw::c_void,
+    ptr::slice_from_raw_parts_mut,
+    sync::{Arc, Mutex},
+};
+
+use zenoh::{
+    bytes::ZBytes,
+    internal::buffers::{ZBuf, ZSliceBuffer},
+};
+
+pub use crate::opaque_types::{
+    zc_loaned_bytes_pool_t, zc_moved_bytes_pool_t, zc_owned_bytes_pool_t,
+};
+use crate::{
+    result::{self, z_result_t},
+    transmute::{LoanedCTypeRef, RustTypeRef, RustTypeRefUninit, TakeRustType},
+    z_owned_bytes_t,
+};
+
+pub(crate) struct BytesPoolInner {
+    size_class: usize,
+    count: usize,
+    free: Mutex<Vec<Box<[u8]>>>,
+}
+
+impl BytesPoolInner {
+    fn acquire(&self) -> Box<[u8]> {
+        let buf = match self.free.lock() {
+            Ok(mut free) => free.pop(),
+            Err(_) => None,
+        };
+        // The pool never fails to hand out a buffer: once all pre-allocated buffers are in use,
+        // a new one is allocated and dropped when released if the free list is already full.
+        buf.unwrap_or_else(|| vec![0u8; self.size_class].into_boxed_slice())
+    }
+
+    fn release(&self, buf: Box<[u8]>) {
+        if let Ok(mut free) = self.free.lock() {
+            if free.len() < self.count {
+                free.push(buf);
+            }
+        }
+    }
+}
+
+#[derive(Clone)]
+pub struct BytesPool(Arc<BytesPoolInner>);
+
+impl BytesPool {
+    pub(crate) fn new(size_class: usize, count: usize) -> Self {
+        let free = (0..count)
+            .map(|_| vec![0u8; size_class].into_boxed_slice())
+            .collect();
+        BytesPool(Arc::new(BytesPoolInner {
+            size_class,
+            count,
+            free: Mutex::new(free),
+        }))
+    }
+
+    pub(crate) fn size_class(&self) -> usize {
+        self.0.size_class
+    }
+
+    /// Acquires an empty buffer from the pool, to be filled in place.
+    pub(crate) fn acquire_empty(&self) -> PooledBuf {
+        PooledBuf {
+            buf: Some(self.0.acquire()),
+            len: 0,
+            pool: self.0.clone(),
+        }
+    }
+}
+
+pub(crate) struct PooledBuf {
+    buf: Option<Box<[u8]>>,
+    len: usize,
+    pool: Arc<BytesPoolInner>,
+}
+
+impl Drop for PooledBuf {
+    fn drop(&mut self) {
+        if let Some(buf) = self.buf.take() {
+            self.pool.release(buf);
+        }
+    }
+}
+
+impl PooledBuf {
+    /// The part of the buffer past its length.
+    pub(crate) fn spare_mut(&mut self) -> &mut [u8] {
+        match &mut self.buf {
+            Some(buf) => &mut buf[self.len..],
+            None => &mut [],
+        }
+    }
+
+    /// Extends the length of the buffer over `n` bytes of its spare part, which were written in place.
+    pub(crate) fn commit(&mut self, n: usize) {
+        debug_assert!(n <= self.spare_mut().len());
+        self.len += n;
+    }
+
+    pub(crate) fn len(&self) -> usize {
+        self.len
+    }
+
+    pub(crate) fn into_zbytes(self) -> ZBytes {
+        ZBytes::from(ZBuf::from(self))
+    }
+}
+
+impl fmt::Debug for PooledBuf {
+    fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
+        f.debug_struct("PooledBuf")
+            .field("len", &self.len)
+            .field("size_class", &self.pool.size_class)
+            .finish()
+    }
+}
+
+impl ZSliceBuffer for PooledBuf {
+    fn as_slice(&self) -> &[u8] {
+        match &self.buf {
+            Some(buf) => &buf[..self.len],
+            None => &[],
+        }
+    }
+    fn as_any(&self) -> &dyn Any {
+        self
+    }
+
+    fn as_any_mut(&mut self) -> &mut dyn Any {
+        self
+    }
+}
+
+decl_c_type!(
+    owned(zc_owned_bytes_pool_t, option BytesPool),
+    loaned(zc_loaned_bytes_pool_t),
+);
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs a pool of reusable payload buffers.
+///
+/// The pool pre-allocates `count` buffers of `size_class` bytes each. Payloads constructed from the pool
+/// return their buffer to it once the last reference to them is dropped, so that publishing at high rate
+/// does not need to allocate and free a backing buffer for every message.
+/// If all pre-allocated buffers are in use, a new one is allocated on demand; it is freed instead of being
+/// kept when released to a pool that already holds `count` free buffers.
+///
+/// @param this_: An uninitialized memory location where the pool is to be constructed.
+/// @param size_class: Capacity in bytes of each buffer of the pool.
+/// @param count: Number of buffers to pre-allocate.
+/// @return 0 in case of success, negative error code otherwise.
+#[no_mangle]
+pub extern "C" fn zc_bytes_pool_new(
+    this: &mut MaybeUninit<zc_owned_bytes_pool_t>,
+    size_class: usize,
+    count: usize,
+) -> z_result_t {
+    if size_class == 0 {
+        tracing::error!("Bytes pool size class should be greater than 0");
+        this.as_rust_type_mut_uninit().write(None);
+        return result::Z_EINVAL;
+    }
+    this.as_rust_type_mut_uninit()
+        .write(Some(BytesPool::new(size_class, count)));
+    result::Z_OK
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs bytes pool in its gravestone state.
+#[no_mangle]
+pub extern "C" fn zc_internal_bytes_pool_null(this_: &mut MaybeUninit<zc_owned_bytes_pool_t>) {
+    this_.as_rust_type_mut_uninit().write(None);
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns ``true`` if `this_` is in a valid state, ``false`` if it is in a gravestone state.
+#[no_mangle]
+pub extern "C" fn zc_internal_bytes_pool_check(this_: &zc_owned_bytes_pool_t) -> bool {
+    this_.as_rust_type_ref().is_some()
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Borrows bytes pool.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn zc_bytes_pool_loan(
+    this_: &zc_owned_bytes_pool_t,
+) -> &zc_loaned_bytes_pool_t {
+    this_
+        .as_rust_type_ref()
+        .as_ref()
+        .unwrap_unchecked()
+        .as_loaned_c_type_ref()
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Drops the pool and resets it to its gravestone state.
+///
+/// Buffers currently held by payloads stay valid and are freed once these payloads are dropped.
+#[no_mangle]
+pub extern "C" fn zc_bytes_pool_drop(this_: &mut zc_moved_bytes_pool_t) {
+    let _ = this_.take_rust_type();
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns the capacity in bytes of each buffer of the pool.
+#[no_mangle]
+pub extern "C" fn zc_bytes_pool_size_class(this_: &zc_loaned_bytes_pool_t) -> usize {
+    this_.as_rust_type_ref().0.size_class
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs payload by copying data into a buffer acquired from the pool.
+///
+/// The buffer returns to the pool once the last shallow copy of the payload is dropped. The resulting
+/// payload can be published directly or appended to a writer with `z_bytes_writer_append()`.
+///
+/// @param this_: The bytes pool.
+/// @param dst: An uninitialized memory location where the payload is to be constructed.
+/// @param data: A pointer to the data to copy.
+/// @param len: Length of the data, it should not exceed the pool size class.
+/// @return 0 in case of success, negative error code otherwise.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn zc_bytes_pool_acquire(
+    this_: &zc_loaned_bytes_pool_t,
+    dst: &mut MaybeUninit<z_owned_bytes_t>,
+    data: *const u8,
+    len: usize,
+) -> z_result_t {
+    let pool = &this_.as_rust_type_ref().0;
+    if len > pool.size_class || (data.is_null() && len > 0) {
+        tracing::error!(
+            "Can not acquire a buffer of {} bytes from a pool of size class {}",
+            len,
+            pool.size_class
+        );
+        dst.as_rust_type_mut_uninit().write(ZBytes::default());
+        return result::Z_EINVAL;
+    }
+    let mut buf = pool.acquire();
+    if len > 0 {
+        buf[..len].copy_from_slice(std::slice::from_raw_parts(data, len));
+    }
+    let pooled = PooledBuf {
+        buf: Some(buf),
+        len,
+        pool: pool.clone(),
+    };
+    dst.as_rust_type_mut_uninit()
+        .write(ZBytes::from(ZBuf::from(pooled)));
+    result::Z_OK
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Acquires a raw buffer of `zc_bytes_pool_size_class()` bytes from the pool.
+///
+/// The buffer is meant to be filled in place and then passed to `z_bytes_from_buf()` together with
+/// `zc_bytes_pool_release_buf` as deleter and `context` as its context, so that the buffer returns
+/// to the pool once the resulting payload is dropped:
+/// @code{.c}
+/// uint8_t *buf;
+/// void *context;
+/// zc_bytes_pool_acquire_buf(z_loan(pool), &buf, &context);
+/// size_t len = fill_payload(buf, zc_bytes_pool_size_class(z_loan(pool)));
+/// z_bytes_from_buf(&payload, buf, len, zc_bytes_pool_release_buf, context);
+/// @endcode
+/// If the buffer ends up not being used, it must be returned with `zc_bytes_pool_release_buf(buf, context)`.
+///
+/// @param this_: The bytes pool.
+/// @param buf: A memory location where the pointer to the acquired buffer will be written.
+/// @param context: A memory location where the context to pass to `zc_bytes_pool_release_buf()` will be written.
+/// @return 0 in case of success, negative error code otherwise.
+#[no_mangle]
+pub extern "C" fn zc_bytes_pool_acquire_buf(
+    this_: &zc_loaned_bytes_pool_t,
+    buf: &mut *mut u8,
+    context: &mut *mut c_void,
+) -> z_result_t {
+    let pool = &this_.as_rust_type_ref().0;
+    *buf = Box::into_raw(pool.acquire()) as *mut u8;
+    *context = Arc::into_raw(pool.clone()) as *mut c_void;
+    result::Z_OK
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns a buffer obtained with `zc_bytes_pool_acquire_buf()` to its pool.
+///
+/// Has a signature of the deleter accepted by `z_bytes_from_buf()`.
+#[no_mangle]
+pub extern "C" fn zc_bytes_pool_release_buf(data: *mut c_void, context: *mut c_void) {
+    if context.is_null() {
+        return;
+    }
+    unsafe {
+        let pool = Arc::from_raw(context as *const BytesPoolInner);
+        if !data.is_null() {
+            let buf = Box::from_raw(slice_from_raw_parts_mut(data as *mut u8, pool.size_class));
+            pool.release(buf);
+        }
+    }
+}
@@ -0,0 +1,311 @@
+//
+// Copyright (c) 2024 ZettaScale Technology.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh team, <zenoh@zettascale.tech>
+//
+
+use std::{
+    collections::{BTreeMap, HashMap, VecDeque},
+    mem::MaybeUninit,
+    sync::{
+        atomic::{AtomicU64, Ordering},
+        Arc, Mutex, MutexGuard,
+    },
+    time::{Duration, Instant},
+};
+
+use zenoh::{key_expr::KeyExpr, sample::Sample};
+
+use crate::{
+    result,
+    transmute::{LoanedCTypeRef, RustTypeRef, RustTypeRefUninit, TakeRustType},
+};
+
+/// The samples cached for one key expression of one cache, oldest first.
+struct Resource {
+    last_access: u64,
+    bytes: usize,
+    samples: VecDeque<(Instant, usize, Sample)>,
+}
+
+#[derive(Default)]
+struct BudgetState {
+    resident_bytes: usize,
+    next_access: u64,
+    /// The resources by last access, the least recently used one first.
+    lru: BTreeMap<u64, (u64, KeyExpr<'static>)>,
+    caches: HashMap<u64, HashMap<KeyExpr<'static>, Resource>>,
+}
+
+impl BudgetState {
+    fn touch(&mut self, cache: u64, key_expr: &KeyExpr<'static>) {
+        let access = self.next_access;
+        self.next_access += 1;
+        if let Some(resource) = self
+            .caches
+            .get_mut(&cache)
+            .and_then(|resources| resources.get_mut(key_expr))
+        {
+            self.lru.remove(&resource.last_access);
+            resource.last_access = access;
+            self.lru.insert(access, (cache, key_expr.clone()));
+        }
+    }
+
+    /// Drops the oldest samples of a resource while `f` returns `true`, removing the resource once it is empty.
+    fn pop_while(
+        &mut self,
+        cache: u64,
+        key_expr: &KeyExpr<'static>,
+        mut f: impl FnMut(&Resource) -> bool,
+    ) {
+        let Some(resources) = self.caches.get_mut(&cache) else {
+            return;
+        };
+        let Some(resource) = resources.get_mut(key_expr) else {
+            return;
+        };
+        while !resource.samples.is_empty() && f(resource) {
+            if let Some((_, size, _)) = resource.samples.pop_front() {
+                resource.bytes -= size;
+                self.resident_bytes -= size;
+            }
+        }
+        if resource.samples.is_empty() {
+            self.lru.remove(&resource.last_access);
+            resources.remove(key_expr);
+        }
+    }
+}
+
+/// A memory budget shared by byte-budgeted publication caches.
+///
+/// The cached samples are accounted by their payload, key expression and attachment sizes. When the budget is
+/// exceeded, the oldest samples of the least recently used key expression, either published or queried, are evicted,
+/// whichever cache they belong to.
+pub struct CacheBudget {
+    max_bytes: usize,
+    next_cache: AtomicU64,
+    state: Mutex<BudgetState>,
+}
+
+fn sample_size(sample: &Sample) -> usize {
+    sample.key_expr().as_str().len()
+        + sample.payload().len()
+        + sample.attachment().map(|a| a.len()).unwrap_or(0)
+}
+
+impl CacheBudget {
+    pub(crate) fn new(max_bytes: usize) -> Self {
+        CacheBudget {
+            max_bytes,
+            next_cache: AtomicU64::new(0),
+            state: Mutex::new(BudgetState::default()),
+        }
+    }
+
+    fn lock(&self) -> MutexGuard<'_, BudgetState> {
+        self.state.lock().unwrap_or_else(|e| e.into_inner())
+    }
+
+    /// Returns a new identifier for a cache sharing this budget.
+    pub(crate) fn register(&self) -> u64 {
+        self.next_cache.fetch_add(1, Ordering::Relaxed)
+    }
+
+    /// Removes all the samples of a cache.
+    pub(crate) fn unregister(&self, cache: u64) {
+        let mut state = self.lock();
+        if let Some(resources) = state.caches.remove(&cache) {
+            for resource in resources.values() {
+                state.lru.remove(&resource.last_access);
+                state.resident_bytes -= resource.bytes;
+            }
+        }
+    }
+
+    /// Caches a sample, keeping at most `history` samples per key expression if non-zero,
+    /// and at most `resources_limit` key expressions for the cache if non-zero.
+    pub(crate) fn insert(
+        &self,
+        cache: u64,
+        sample: Sample,
+        history: usize,
+        resources_limit: usize,
+        max_age: Option<Duration>,
+    ) {
+        let key_expr = sample.key_expr().clone().into_owned();
+        let size = sample_size(&sample);
+        let now = Instant::now();
+        let mut state = self.lock();
+        let resources = state.caches.entry(cache).or_default();
+        if !resources.contains_key(&key_expr) {
+            if resources_limit != 0 && resources.len() >= resources_limit {
+                tracing::error!(
+                    "Publication cache: resources limit exceeded, can't cache publication on {}",
+                    key_expr
+                );
+                return;
+            }
+            resources.insert(
+                key_expr.clone(),
+                Resource {
+                    last_access: u64::MAX,
+                    bytes: 0,
+                    samples: VecDeque::new(),
+                },
+            );
+        }
+        if let Some(resource) = resources.get_mut(&key_expr) {
+            resource.bytes += size;
+            resource.samples.push_back((now, size, sample));
+        }
+        state.resident_bytes += size;
+        state.touch(cache, &key_expr);
+        state.pop_while(cache, &key_expr, |r| {
+            let expired = max_age.is_some_and(|age| now.duration_since(r.samples[0].0) > age);
+            expired || (history != 0 && r.samples.len() > history)
+        });
+        while state.resident_bytes > self.max_bytes {
+            let Some((&access, _)) = state.lru.first_key_value() else {
+                break;
+            };
+            let Some((victim_cache, victim_key)) = state.lru.get(&access).cloned() else {
+                break;
+            };
+            let mut first = true;
+            state.pop_while(victim_cache, &victim_key, |_| std::mem::take(&mut first));
+        }
+    }
+
+    /// Calls `f` on the non-expired samples of a cache whose key expression matches, oldest first,
+    /// and marks the matching key expressions as recently used.
+    pub(crate) fn for_each(
+        &self,
+        cache: u64,
+        max_age: Option<Duration>,
+        mut matches: impl FnMut(&KeyExpr<'static>) -> bool,
+        mut f: impl FnMut(&Sample),
+    ) {
+        let now = Instant::now();
+        let mut state = self.lock();
+        let Some(resources) = state.caches.get(&cache) else {
+            return;
+        };
+        let keys: Vec<KeyExpr<'static>> =
+            resources.keys().filter(|k| matches(k)).cloned().collect();
+        for key_expr in keys {
+            if let Some(age) = max_age {
+                state.pop_while(cache, &key_expr, |r| {
+                    now.duration_since(r.samples[0].0) > age
+                });
+            }
+            state.touch(cache, &key_expr);
+            if let Some(resource) = state
+                .caches
+                .get(&cache)
+                .and_then(|resources| resources.get(&key_expr))
+            {
+                resource.samples.iter().for_each(|(_, _, s)| f(s));
+            }
+        }
+    }
+
+    /// Returns the number of bytes cached by all the caches sharing this budget.
+    pub(crate) fn resident_bytes(&self) -> usize {
+        self.lock().resident_bytes
+    }
+
+    /// Returns the number of bytes cached by one cache.
+    pub(crate) fn cache_resident_bytes(&self, cache: u64) -> usize {
+        self.lock()
+            .caches
+            .get(&cache)
+            .map(|resources| resources.values().map(|r| r.bytes).sum())
+            .unwrap_or(0)
+    }
+}
+
+pub use crate::opaque_types::{
+    ze_loaned_cache_budget_t, ze_moved_cache_budget_t, ze_owned_cache_budget_t,
+};
+decl_c_type!(
+    owned(ze_owned_cache_budget_t, option Arc<CacheBudget>),
+    loaned(ze_loaned_cache_budget_t),
+);
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs a memory budget, to be shared by several byte-budgeted publication caches,
+/// see `ze_publication_cache_options_t::budget`.
+///
+/// The caches sharing a budget keep a reference to it, so it can be dropped once they are declared.
+///
+/// @param this_: An uninitialized location in memory where the budget will be constructed.
+/// @param max_bytes: The maximum number of bytes held by all the caches sharing the budget.
+///
+/// @return 0 in case of success, `Z_EINVAL` if `max_bytes` is 0.
+#[no_mangle]
+pub extern "C" fn ze_cache_budget_new(
+    this_: &mut MaybeUninit<ze_owned_cache_budget_t>,
+    max_bytes: usize,
+) -> result::z_result_t {
+    let this = this_.as_rust_type_mut_uninit();
+    if max_bytes == 0 {
+        tracing::error!("Cache budget must be non-zero");
+        this.write(None);
+        return result::Z_EINVAL;
+    }
+    this.write(Some(Arc::new(CacheBudget::new(max_bytes))));
+    result::Z_OK
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns the number of bytes currently held by all the publication caches sharing the budget.
+#[no_mangle]
+pub extern "C" fn ze_cache_budget_resident_bytes(this_: &ze_loaned_cache_budget_t) -> usize {
+    this_.as_rust_type_ref().resident_bytes()
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs a cache budget in its gravestone state.
+#[no_mangle]
+pub extern "C" fn ze_internal_cache_budget_null(this_: &mut MaybeUninit<ze_owned_cache_budget_t>) {
+    this_.as_rust_type_mut_uninit().write(None);
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns ``true`` if cache budget is valid, ``false`` otherwise.
+#[no_mangle]
+pub extern "C" fn ze_internal_cache_budget_check(this_: &ze_owned_cache_budget_t) -> bool {
+    this_.as_rust_type_ref().is_some()
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Borrows cache budget.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn ze_cache_budget_loan(
+    this_: &ze_owned_cache_budget_t,
+) -> &ze_loaned_cache_budget_t {
+    this_
+        .as_rust_type_ref()
+        .as_ref()
+        .unwrap_unchecked()
+        .as_loaned_c_type_ref()
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Drops cache budget and resets it to its gravestone state. The caches sharing it keep it alive until they are
+/// dropped.
+#[no_mangle]
+pub extern "C" fn ze_cache_budget_drop(this_: &mut ze_moved_cache_budget_t) {
+    let _ = this_.take_rust_type();
+}
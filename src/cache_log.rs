@@ -0,0 +1,393 @@
+//
+// Copyright (c) 2024 ZettaScale Technology.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh team, <zenoh@zettascale.tech>
+//
+
+use std::{
+    any::Any,
+    collections::{HashMap, VecDeque},
+    fmt,
+    path::PathBuf,
+    sync::{
+        atomic::{AtomicU64, AtomicUsize, Ordering},
+        Arc, Mutex, MutexGuard,
+    },
+    time::{Duration, Instant},
+};
+
+use zenoh::{
+    bytes::{Encoding, ZBytes},
+    internal::buffers::{ZBuf, ZSliceBuffer},
+    key_expr::KeyExpr,
+    sample::{Sample, SampleKind},
+    time::Timestamp,
+};
+
+use crate::publication_cache::CachedReply;
+
+/// A log file mapped in memory. The file is removed once the segment is dropped, that is once it is rotated out of
+/// the log and no reply refers to its content anymore.
+struct Segment {
+    id: u64,
+    path: PathBuf,
+    map: *mut u8,
+    capacity: usize,
+    written: AtomicUsize,
+    newest: Mutex<Instant>,
+}
+
+// The mapping is only written by the log, under its lock, at offsets which are not indexed yet,
+// so the indexed ranges can be read concurrently.
+unsafe impl Send for Segment {}
+unsafe impl Sync for Segment {}
+
+impl Segment {
+    #[cfg(unix)]
+    fn create(path: PathBuf, id: u64, capacity: usize) -> std::io::Result<Segment> {
+        use std::os::unix::io::AsRawFd;
+        let file = std::fs::OpenOptions::new()
+            .read(true)
+            .write(true)
+            .create_new(true)
+            .open(&path)?;
+        let map = file.set_len(capacity as u64).and_then(|_| {
+            let map = unsafe {
+                libc::mmap(
+                    std::ptr::null_mut(),
+                    capacity,
+                    libc::PROT_READ | libc::PROT_WRITE,
+                    libc::MAP_SHARED,
+                    file.as_raw_fd(),
+                    0,
+                )
+            };
+            if map == libc::MAP_FAILED {
+                Err(std::io::Error::last_os_error())
+            } else {
+                Ok(map as *mut u8)
+            }
+        });
+        match map {
+            Ok(map) => Ok(Segment {
+                id,
+                path,
+                map,
+                capacity,
+                written: AtomicUsize::new(0),
+                newest: Mutex::new(Instant::now()),
+            }),
+            Err(e) => {
+                let _ = std::fs::remove_file(&path);
+                Err(e)
+            }
+        }
+    }
+
+    #[cfg(not(unix))]
+    fn create(_path: PathBuf, _id: u64, _capacity: usize) -> std::io::Result<Segment> {
+        Err(std::io::Error::new(
+            std::io::ErrorKind::Unsupported,
+            "memory-mapped publication cache logs are only supported on unix platforms",
+        ))
+    }
+
+    /// Copies `data` at `offset`, which must not have been indexed yet.
+    unsafe fn write(&self, offset: usize, data: &[u8]) {
+        std::ptr::copy_nonoverlapping(data.as_ptr(), self.map.add(offset), data.len());
+    }
+
+    fn appended(&self, len: usize, now: Instant) {
+        self.written.fetch_add(len, Ordering::Relaxed);
+        *self.newest.lock().unwrap_or_else(|e| e.into_inner()) = now;
+    }
+
+    fn newest(&self) -> Instant {
+        *self.newest.lock().unwrap_or_else(|e| e.into_inner())
+    }
+}
+
+impl Drop for Segment {
+    fn drop(&mut self) {
+        #[cfg(unix)]
+        unsafe {
+            libc::munmap(self.map as *mut libc::c_void, self.capacity);
+        }
+        if let Err(e) = std::fs::remove_file(&self.path) {
+            tracing::warn!(
+                "Failed to remove publication cache log {}: {}",
+                self.path.display(),
+                e
+            );
+        }
+    }
+}
+
+/// A range of a segment, passed to zenoh as a payload without copying it out of the mapping.
+struct MappedSlice {
+    segment: Arc<Segment>,
+    offset: usize,
+    len: usize,
+}
+
+impl fmt::Debug for MappedSlice {
+    fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
+        f.debug_struct("MappedSlice")
+            .field("segment", &self.segment.id)
+            .field("offset", &self.offset)
+            .field("len", &self.len)
+            .finish()
+    }
+}
+
+impl ZSliceBuffer for MappedSlice {
+    fn as_slice(&self) -> &[u8] {
+        unsafe { std::slice::from_raw_parts(self.segment.map.add(self.offset), self.len) }
+    }
+    fn as_any(&self) -> &dyn Any {
+        self
+    }
+
+    fn as_any_mut(&mut self) -> &mut dyn Any {
+        self
+    }
+}
+
+/// The in-memory description of a logged sample, its payload and attachment are stored contiguously in a segment.
+struct IndexEntry {
+    segment: u64,
+    offset: usize,
+    payload_len: usize,
+    attachment_len: Option<usize>,
+    kind: SampleKind,
+    encoding: Encoding,
+    timestamp: Option<Timestamp>,
+    received: Instant,
+}
+
+#[derive(Default)]
+struct LogState {
+    segments: VecDeque<Arc<Segment>>,
+    next_segment: u64,
+    write_offset: usize,
+    logged_bytes: usize,
+    index: HashMap<KeyExpr<'static>, VecDeque<IndexEntry>>,
+}
+
+pub(crate) struct CacheLogOptions {
+    pub directory: PathBuf,
+    pub segment_size: usize,
+    pub max_segments: usize,
+    pub history: usize,
+    pub resources_limit: usize,
+    pub max_age: Option<Duration>,
+}
+
+/// A publication cache store appending the samples to rotated memory-mapped log files, so that the history
+/// is paged by the OS instead of being held in memory. Only an index by key expression is kept in memory.
+pub struct CacheLog {
+    options: CacheLogOptions,
+    prefix: String,
+    state: Mutex<LogState>,
+}
+
+static NEXT_LOG: AtomicU64 = AtomicU64::new(0);
+
+impl CacheLog {
+    pub(crate) fn new(options: CacheLogOptions) -> std::io::Result<CacheLog> {
+        std::fs::create_dir_all(&options.directory)?;
+        let prefix = format!(
+            "zc-pubcache-{}-{}",
+            std::process::id(),
+            NEXT_LOG.fetch_add(1, Ordering::Relaxed)
+        );
+        Ok(CacheLog {
+            options,
+            prefix,
+            state: Mutex::new(LogState::default()),
+        })
+    }
+
+    fn lock(&self) -> MutexGuard<'_, LogState> {
+        self.state.lock().unwrap_or_else(|e| e.into_inner())
+    }
+
+    /// Removes the segments older than the maximum age, except the one being written, with their index entries.
+    fn expire_segments(&self, state: &mut LogState, now: Instant) {
+        if let Some(age) = self.options.max_age {
+            while state.segments.len() > 1
+                && state
+                    .segments
+                    .front()
+                    .is_some_and(|s| now.duration_since(s.newest()) > age)
+            {
+                Self::remove_front_segment(state);
+            }
+        }
+    }
+
+    /// Removes the oldest index entries of a key expression while they are out of the history or too old.
+    fn trim(&self, entries: &mut VecDeque<IndexEntry>, now: Instant) {
+        let max_age = self.options.max_age;
+        let history = self.options.history;
+        while let Some(entry) = entries.front() {
+            let expired = max_age.is_some_and(|age| now.duration_since(entry.received) > age);
+            if expired || (history != 0 && entries.len() > history) {
+                entries.pop_front();
+            } else {
+                break;
+            }
+        }
+    }
+
+    fn remove_front_segment(state: &mut LogState) {
+        if let Some(segment) = state.segments.pop_front() {
+            state.logged_bytes -= segment.written.load(Ordering::Relaxed);
+            state.index.retain(|_, entries| {
+                while entries.front().is_some_and(|e| e.segment <= segment.id) {
+                    entries.pop_front();
+                }
+                !entries.is_empty()
+            });
+        }
+    }
+
+    /// Returns the segment where `len` bytes can be appended, rotating the log if needed.
+    fn segment_for(&self, state: &mut LogState, len: usize) -> std::io::Result<Arc<Segment>> {
+        if let Some(segment) = state.segments.back() {
+            if state.write_offset + len <= segment.capacity {
+                return Ok(segment.clone());
+            }
+        }
+        let id = state.next_segment;
+        let capacity = self.options.segment_size.max(len).max(1);
+        let path = self
+            .options
+            .directory
+            .join(format!("{}-{}.log", self.prefix, id));
+        let segment = Arc::new(Segment::create(path, id, capacity)?);
+        state.next_segment += 1;
+        state.write_offset = 0;
+        state.segments.push_back(segment.clone());
+        if self.options.max_segments != 0 {
+            while state.segments.len() > self.options.max_segments {
+                Self::remove_front_segment(state);
+            }
+        }
+        Ok(segment)
+    }
+
+    pub(crate) fn insert(&self, sample: Sample) {
+        let key_expr = sample.key_expr().clone().into_owned();
+        let payload = sample.payload().to_bytes();
+        let attachment = sample.attachment().map(|a| a.to_bytes());
+        let len = payload.len() + attachment.as_ref().map(|a| a.len()).unwrap_or(0);
+        let now = Instant::now();
+        let mut state = self.lock();
+        if !state.index.contains_key(&key_expr)
+            && self.options.resources_limit != 0
+            && state.index.len() >= self.options.resources_limit
+        {
+            tracing::error!(
+                "Publication cache: resources limit exceeded, can't cache publication on {}",
+                key_expr
+            );
+            return;
+        }
+        let segment = match self.segment_for(&mut state, len) {
+            Ok(segment) => segment,
+            Err(e) => {
+                tracing::error!(
+                    "Publication cache: failed to rotate log, can't cache publication on {}: {}",
+                    key_expr,
+                    e
+                );
+                return;
+            }
+        };
+        let offset = state.write_offset;
+        unsafe {
+            segment.write(offset, &payload);
+            if let Some(attachment) = &attachment {
+                segment.write(offset + payload.len(), attachment);
+            }
+        }
+        segment.appended(len, now);
+        state.write_offset += len;
+        state.logged_bytes += len;
+        state
+            .index
+            .entry(key_expr.clone())
+            .or_default()
+            .push_back(IndexEntry {
+                segment: segment.id,
+                offset,
+                payload_len: payload.len(),
+                attachment_len: attachment.as_ref().map(|a| a.len()),
+                kind: sample.kind(),
+                encoding: sample.encoding().clone(),
+                timestamp: sample.timestamp().cloned(),
+                received: now,
+            });
+        let state = &mut *state;
+        if let Some(entries) = state.index.get_mut(&key_expr) {
+            self.trim(entries, now);
+        }
+        self.expire_segments(state, now);
+    }
+
+    /// Returns the logged samples whose key expression matches, oldest first. Their payloads refer to the mapped
+    /// segments, without copying them.
+    pub(crate) fn replies(
+        &self,
+        mut matches: impl FnMut(&KeyExpr<'static>) -> bool,
+    ) -> Vec<CachedReply> {
+        let now = Instant::now();
+        let mut state = self.lock();
+        self.expire_segments(&mut state, now);
+        state.index.retain(|_, entries| {
+            self.trim(entries, now);
+            !entries.is_empty()
+        });
+        let Some(first_segment) = state.segments.front().map(|s| s.id) else {
+            return Vec::new();
+        };
+        let mapped = |segment: &Arc<Segment>, offset, len| {
+            ZBytes::from(ZBuf::from(MappedSlice {
+                segment: segment.clone(),
+                offset,
+                len,
+            }))
+        };
+        let mut replies = Vec::new();
+        for (key_expr, entries) in state.index.iter().filter(|(k, _)| matches(k)) {
+            for entry in entries {
+                let segment = &state.segments[(entry.segment - first_segment) as usize];
+                replies.push(CachedReply {
+                    key_expr: key_expr.clone(),
+                    kind: entry.kind,
+                    payload: mapped(segment, entry.offset, entry.payload_len),
+                    encoding: entry.encoding.clone(),
+                    timestamp: entry.timestamp,
+                    attachment: entry
+                        .attachment_len
+                        .map(|len| mapped(segment, entry.offset + entry.payload_len, len)),
+                });
+            }
+        }
+        replies
+    }
+
+    /// Returns the number of bytes written to the log segments which are still retained.
+    pub(crate) fn logged_bytes(&self) -> usize {
+        self.lock().logged_bytes
+    }
+}
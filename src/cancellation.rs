@@ -0,0 +1,211 @@
+//
+// Copyright (c) 2024 ZettaScale Technology.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh team, <zenoh@zettascale.tech>
+//
+
+use std::{
+    mem::MaybeUninit,
+    sync::{
+        atomic::{AtomicBool, Ordering},
+        Arc, Mutex, MutexGuard, Weak,
+    },
+};
+
+pub use crate::opaque_types::{
+    z_loaned_cancellation_token_t, z_moved_cancellation_token_t, z_owned_cancellation_token_t,
+};
+use crate::{
+    result,
+    transmute::{LoanedCTypeRef, RustTypeRef, RustTypeRefUninit, TakeRustType},
+};
+
+trait Cancel: Send + Sync {
+    fn cancel(&self);
+}
+
+/// The callback of a query, dropped as soon as its cancellation token is cancelled.
+struct CancellableCallback<T> {
+    callback: Mutex<Option<Arc<T>>>,
+}
+
+impl<T> CancellableCallback<T> {
+    fn lock(&self) -> MutexGuard<'_, Option<Arc<T>>> {
+        self.callback.lock().unwrap_or_else(|e| e.into_inner())
+    }
+
+    /// Returns the callback, or `None` once the query is cancelled.
+    ///
+    /// The lock is not held while the callback is called, so that it can cancel its own query, the callback being
+    /// dropped once the call returns.
+    fn get(&self) -> Option<Arc<T>> {
+        self.lock().clone()
+    }
+}
+
+impl<T: Send + Sync> Cancel for CancellableCallback<T> {
+    fn cancel(&self) {
+        let callback = self.lock().take();
+        drop(callback);
+    }
+}
+
+/// A token shared by the queries it cancels.
+#[derive(Default)]
+pub struct CancellationToken {
+    cancelled: AtomicBool,
+    // The callbacks of the queries which are not finalized yet, the others being pruned on registration.
+    callbacks: Mutex<Vec<Weak<dyn Cancel>>>,
+}
+
+impl CancellationToken {
+    fn lock(&self) -> MutexGuard<'_, Vec<Weak<dyn Cancel>>> {
+        self.callbacks.lock().unwrap_or_else(|e| e.into_inner())
+    }
+
+    fn register<T: Send + Sync + 'static>(
+        &self,
+        callback: T,
+    ) -> Option<Arc<CancellableCallback<T>>> {
+        let mut callbacks = self.lock();
+        if self.cancelled.load(Ordering::Acquire) {
+            return None;
+        }
+        let cancellable = Arc::new(CancellableCallback {
+            callback: Mutex::new(Some(Arc::new(callback))),
+        });
+        callbacks.retain(|c| c.strong_count() != 0);
+        callbacks.push(Arc::downgrade(&cancellable) as Weak<dyn Cancel>);
+        Some(cancellable)
+    }
+
+    /// Wraps the callback of a query, passed to `call` with each reply, so that it is dropped once the token is
+    /// cancelled, or returns `None` if it is already.
+    pub(crate) fn wrap<T: Send + Sync + 'static, R>(
+        &self,
+        callback: T,
+        call: fn(&T, R),
+    ) -> Option<impl Fn(R) + Send + Sync + 'static> {
+        let callback = self.register(callback)?;
+        Some(move |reply: R| {
+            if let Some(callback) = callback.get() {
+                call(&callback, reply)
+            }
+        })
+    }
+
+    fn cancel(&self) {
+        let callbacks = {
+            let mut callbacks = self.lock();
+            self.cancelled.store(true, Ordering::Release);
+            std::mem::take(&mut *callbacks)
+        };
+        for callback in callbacks.iter().filter_map(Weak::upgrade) {
+            callback.cancel();
+        }
+    }
+}
+
+decl_c_type!(
+    owned(z_owned_cancellation_token_t, option Arc<CancellationToken>),
+    loaned(z_loaned_cancellation_token_t),
+);
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs a cancellation token, which cancels the queries it is passed to with `z_get_options_t` or
+/// `z_querier_get_options_t`.
+///
+/// The token is moved into the options, so that a clone of it, obtained with `z_cancellation_token_clone()`, is
+/// kept to cancel the queries with `z_cancellation_token_cancel()`, e.g. once the first good reply is received.
+#[no_mangle]
+pub extern "C" fn z_cancellation_token_new(this_: &mut MaybeUninit<z_owned_cancellation_token_t>) {
+    this_
+        .as_rust_type_mut_uninit()
+        .write(Some(Arc::new(CancellationToken::default())));
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs a shallow copy of a cancellation token, cancelling the same queries.
+#[no_mangle]
+pub extern "C" fn z_cancellation_token_clone(
+    dst: &mut MaybeUninit<z_owned_cancellation_token_t>,
+    this_: &z_loaned_cancellation_token_t,
+) {
+    dst.as_rust_type_mut_uninit()
+        .write(Some(this_.as_rust_type_ref().clone()));
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Cancels the queries of a cancellation token.
+///
+/// The reply callbacks of the queries are dropped right away, or once they return if they are running, e.g. when a
+/// callback cancels its own query. No reply is delivered to them afterwards, so that a FIFO or ring channel is closed
+/// once its pending replies are received. The replies retained by a local consolidation, see
+/// `z_get_options_t::consolidation_capacity`, are still delivered as the callback is dropped. Queries passed the token
+/// later on are not sent, their callback being dropped immediately.
+///
+/// The queryables, which are not notified, keep replying, the replies being discarded once they are received. The
+/// routing state of the queries is released once they are finalized or time out.
+///
+/// @return 0.
+#[no_mangle]
+pub extern "C" fn z_cancellation_token_cancel(
+    this_: &z_loaned_cancellation_token_t,
+) -> result::z_result_t {
+    this_.as_rust_type_ref().cancel();
+    result::Z_OK
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns ``true`` if the cancellation token was cancelled, ``false`` otherwise.
+#[no_mangle]
+pub extern "C" fn z_cancellation_token_is_cancelled(this_: &z_loaned_cancellation_token_t) -> bool {
+    this_.as_rust_type_ref().cancelled.load(Ordering::Acquire)
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Borrows cancellation token.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_cancellation_token_loan(
+    this_: &z_owned_cancellation_token_t,
+) -> &z_loaned_cancellation_token_t {
+    this_
+        .as_rust_type_ref()
+        .as_ref()
+        .unwrap_unchecked()
+        .as_loaned_c_type_ref()
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs cancellation token in its gravestone state.
+#[no_mangle]
+pub extern "C" fn z_internal_cancellation_token_null(
+    this_: &mut MaybeUninit<z_owned_cancellation_token_t>,
+) {
+    this_.as_rust_type_mut_uninit().write(None);
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns ``true`` if cancellation token is valid, ``false`` if it is in its gravestone state.
+#[no_mangle]
+pub extern "C" fn z_internal_cancellation_token_check(
+    this_: &z_owned_cancellation_token_t,
+) -> bool {
+    this_.as_rust_type_ref().is_some()
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Drops cancellation token, resetting it to its gravestone state. The queries are not cancelled.
+#[no_mangle]
+pub extern "C" fn z_cancellation_token_drop(this_: &mut z_moved_cancellation_token_t) {
+    let _ = this_.take_rust_type();
+}
@@ -12,36 +12,88 @@
 //   ZettaScale Zenoh team, <zenoh@zettascale.tech>
 //
 
-use std::mem::MaybeUninit;
+use std::{mem::MaybeUninit, sync::Arc};
 
 use zenoh_runtime::ZRuntime;
 
 #[cfg(feature = "unstable")]
 use crate::opaque_types::zc_owned_concurrent_close_handle_t;
 use crate::{
-    result::{z_result_t, Z_EIO, Z_OK},
+    entity_stats::SessionCounters,
+    result::{z_result_t, Z_CHANNEL_NODATA, Z_EINVAL, Z_EIO, Z_OK},
     transmute::{RustTypeRef, RustTypeRefUninit, TakeRustType},
     zc_moved_concurrent_close_handle_t,
 };
 
+/// The close task, with the counters of the closed session to report its progress.
+///
+/// The counters are held rather than looked up by session id, since they are unregistered when the session is dropped
+/// while its entities may still be alive.
+pub(crate) type CloseHandle = (
+    tokio::task::JoinHandle<zenoh::Result<()>>,
+    Arc<SessionCounters>,
+);
+
 #[cfg(feature = "unstable")]
 decl_c_type!(
-    owned(zc_owned_concurrent_close_handle_t, option tokio::task::JoinHandle<zenoh::Result<()>>),
+    owned(zc_owned_concurrent_close_handle_t, option CloseHandle),
 );
 
+fn close_result(handle: CloseHandle) -> z_result_t {
+    match ZRuntime::Application.block_on(handle.0) {
+        Ok(_) => Z_OK,
+        Err(e) => {
+            tracing::error!("Close error: {}", e);
+            Z_EIO
+        }
+    }
+}
+
 /// @brief Blocking wait on close handle to complete. Returns `Z_EIO` if close finishes with error.
 #[no_mangle]
 #[allow(clippy::missing_safety_doc)]
 pub unsafe extern "C" fn zc_concurrent_close_handle_wait(
     handle: &mut zc_moved_concurrent_close_handle_t,
 ) -> z_result_t {
-    match ZRuntime::Application.block_on(handle.take_rust_type().unwrap_unchecked()) {
-        Ok(_) => Z_OK,
-        Err(e) => {
-            tracing::error!("Close error: {}", e);
-            Z_EIO
-        }
+    close_result(handle.take_rust_type().unwrap_unchecked())
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Checks whether the close has completed, without blocking.
+///
+/// Once the close has completed, the handle is reset to its gravestone state.
+///
+/// @return `Z_CHANNEL_NODATA` if the close is still in progress, 0 if it completed successfully, `Z_EIO` if it
+/// completed with an error, `Z_EINVAL` if the handle is in its gravestone state.
+#[no_mangle]
+pub extern "C" fn zc_concurrent_close_handle_try_wait(
+    handle: &mut zc_owned_concurrent_close_handle_t,
+) -> z_result_t {
+    let this = handle.as_rust_type_mut();
+    let Some((task, _)) = this.as_ref() else {
+        return Z_EINVAL;
+    };
+    if !task.is_finished() {
+        return Z_CHANNEL_NODATA;
     }
+    close_result(this.take().unwrap())
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns the number of subscribers and queryables of the closed session which are not undeclared yet.
+///
+/// Closing a session undeclares all its entities; this count goes down to 0 as their callbacks are dropped,
+/// unless some of them are kept alive by the application, e.g. by an ongoing callback.
+/// The count remains available after the session is dropped, until the close completes.
+/// Returns 0 if the handle is in its gravestone state.
+#[no_mangle]
+pub extern "C" fn zc_concurrent_close_handle_pending_entities(
+    handle: &zc_owned_concurrent_close_handle_t,
+) -> usize {
+    handle
+        .as_rust_type_ref()
+        .as_ref()
+        .map_or(0, |(_, counters)| counters.pending_callbacks())
 }
 
 /// @brief Drops the close handle. The concurrent close task will not be interrupted.
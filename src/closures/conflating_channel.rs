@@ -0,0 +1,153 @@
+//
+// Copyright (c) 2017, 2024 ZettaScale Technology.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh team, <zenoh@zettascale.tech>
+//
+use std::{
+    collections::{HashMap, VecDeque},
+    hash::Hash,
+    sync::{Arc, Condvar, Mutex, MutexGuard},
+};
+
+struct ConflatingState<K, T> {
+    // The keys with a pending value, in the order of arrival of their first pending value.
+    order: VecDeque<K>,
+    pending: HashMap<K, T>,
+    sender_alive: bool,
+    receiver_alive: bool,
+}
+
+/// A queue keeping at most one value per key, a newer value replacing the pending one in place.
+///
+/// Values are received in the order in which their key became pending, so that a key receiving values
+/// at a high rate does not delay nor push out the other keys.
+struct ConflatingQueue<K, T> {
+    state: Mutex<ConflatingState<K, T>>,
+    items_cv: Condvar,
+}
+
+impl<K: Eq + Hash, T> ConflatingQueue<K, T> {
+    fn lock(&self) -> MutexGuard<'_, ConflatingState<K, T>> {
+        self.state.lock().unwrap_or_else(|e| e.into_inner())
+    }
+}
+
+impl<K: Eq + Hash, T> ConflatingState<K, T> {
+    fn pop(&mut self) -> Option<T> {
+        let key = self.order.pop_front()?;
+        self.pending.remove(&key)
+    }
+}
+
+/// The receiving end of a conflating channel, the channel is closed for senders when it is dropped.
+pub struct ConflatingChannelHandler<K: Eq + Hash, T> {
+    queue: Arc<ConflatingQueue<K, T>>,
+}
+
+impl<K: Eq + Hash, T> ConflatingChannelHandler<K, T> {
+    /// Blocks until a value is received, returns `Err` once the sender is dropped and the queue is drained.
+    pub(crate) fn recv(&self) -> Result<T, ()> {
+        let mut state = self.queue.lock();
+        loop {
+            if let Some(v) = state.pop() {
+                return Ok(v);
+            }
+            if !state.sender_alive {
+                return Err(());
+            }
+            state = self
+                .queue
+                .items_cv
+                .wait(state)
+                .unwrap_or_else(|e| e.into_inner());
+        }
+    }
+
+    /// Returns `Ok(None)` if the queue is empty, `Err` once the sender is dropped and the queue is drained.
+    pub(crate) fn try_recv(&self) -> Result<Option<T>, ()> {
+        let mut state = self.queue.lock();
+        match state.pop() {
+            Some(v) => Ok(Some(v)),
+            None if !state.sender_alive => Err(()),
+            None => Ok(None),
+        }
+    }
+}
+
+impl<K: Eq + Hash, T> Drop for ConflatingChannelHandler<K, T> {
+    fn drop(&mut self) {
+        let mut state = self.queue.lock();
+        state.receiver_alive = false;
+        state.order.clear();
+        state.pending.clear();
+    }
+}
+
+/// The sending end of a conflating channel, the channel is disconnected when it is dropped.
+pub(crate) struct ConflatingChannelSender<K: Eq + Hash, T> {
+    queue: Arc<ConflatingQueue<K, T>>,
+    key: fn(&T) -> K,
+}
+
+impl<K: Eq + Hash + Clone, T> ConflatingChannelSender<K, T> {
+    /// Queues the value, replacing the pending value with the same key if any. The value is dropped if the
+    /// receiver is dropped.
+    pub(crate) fn send(&self, value: T) {
+        let key = (self.key)(&value);
+        let mut state = self.queue.lock();
+        if !state.receiver_alive {
+            return;
+        }
+        // The replaced value is dropped once the lock is released.
+        let _replaced = match state.pending.get_mut(&key) {
+            Some(pending) => Some(std::mem::replace(pending, value)),
+            None => {
+                state.order.push_back(key.clone());
+                state.pending.insert(key, value);
+                self.queue.items_cv.notify_one();
+                None
+            }
+        };
+        drop(state);
+    }
+}
+
+impl<K: Eq + Hash, T> Drop for ConflatingChannelSender<K, T> {
+    fn drop(&mut self) {
+        self.queue.lock().sender_alive = false;
+        self.queue.items_cv.notify_all();
+    }
+}
+
+/// Constructs a conflating channel whose values are grouped by `key`.
+pub(crate) fn conflating_channel<K: Eq + Hash, T>(
+    key: fn(&T) -> K,
+) -> (
+    ConflatingChannelSender<K, T>,
+    ConflatingChannelHandler<K, T>,
+) {
+    let queue = Arc::new(ConflatingQueue {
+        state: Mutex::new(ConflatingState {
+            order: VecDeque::new(),
+            pending: HashMap::new(),
+            sender_alive: true,
+            receiver_alive: true,
+        }),
+        items_cv: Condvar::new(),
+    });
+    (
+        ConflatingChannelSender {
+            queue: queue.clone(),
+            key,
+        },
+        ConflatingChannelHandler { queue },
+    )
+}
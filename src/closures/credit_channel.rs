@@ -0,0 +1,150 @@
+//
+// Copyright (c) 2017, 2024 ZettaScale Technology.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh team, <zenoh@zettascale.tech>
+//
+
+use std::{
+    collections::VecDeque,
+    sync::{Arc, Condvar, Mutex, MutexGuard},
+};
+
+struct CreditState<T> {
+    items: VecDeque<T>,
+    credit: usize,
+    sender_alive: bool,
+    receiver_alive: bool,
+}
+
+/// A queue whose senders block while the credit granted by the receiver is exhausted.
+///
+/// Each sent value consumes one unit of credit, which is only given back explicitly by the receiver,
+/// so the number of values in flight is bounded by the credit it decided to grant.
+struct CreditQueue<T> {
+    state: Mutex<CreditState<T>>,
+    credit_cv: Condvar,
+    items_cv: Condvar,
+}
+
+impl<T> CreditQueue<T> {
+    fn lock(&self) -> MutexGuard<'_, CreditState<T>> {
+        self.state.lock().unwrap_or_else(|e| e.into_inner())
+    }
+}
+
+/// The receiving end of a credit channel, the channel is closed for senders when it is dropped.
+pub struct CreditChannelHandler<T> {
+    queue: Arc<CreditQueue<T>>,
+}
+
+impl<T> CreditChannelHandler<T> {
+    /// Blocks until a value is received, returns `Err` once the sender is dropped and the queue is drained.
+    pub(crate) fn recv(&self) -> Result<T, ()> {
+        let mut state = self.queue.lock();
+        loop {
+            if let Some(v) = state.items.pop_front() {
+                return Ok(v);
+            }
+            if !state.sender_alive {
+                return Err(());
+            }
+            state = self
+                .queue
+                .items_cv
+                .wait(state)
+                .unwrap_or_else(|e| e.into_inner());
+        }
+    }
+
+    /// Returns `Ok(None)` if the queue is empty, `Err` once the sender is dropped and the queue is drained.
+    pub(crate) fn try_recv(&self) -> Result<Option<T>, ()> {
+        let mut state = self.queue.lock();
+        match state.items.pop_front() {
+            Some(v) => Ok(Some(v)),
+            None if !state.sender_alive => Err(()),
+            None => Ok(None),
+        }
+    }
+
+    /// Grants `n` more values to the senders, waking them up if they were waiting for credit.
+    pub(crate) fn grant(&self, n: usize) {
+        let mut state = self.queue.lock();
+        state.credit = state.credit.saturating_add(n);
+        self.queue.credit_cv.notify_all();
+    }
+
+    /// Returns the credit which is not consumed yet.
+    pub(crate) fn credit(&self) -> usize {
+        self.queue.lock().credit
+    }
+}
+
+impl<T> Drop for CreditChannelHandler<T> {
+    fn drop(&mut self) {
+        let mut state = self.queue.lock();
+        state.receiver_alive = false;
+        state.items.clear();
+        self.queue.credit_cv.notify_all();
+    }
+}
+
+/// The sending end of a credit channel, the channel is disconnected when it is dropped.
+pub(crate) struct CreditChannelSender<T> {
+    queue: Arc<CreditQueue<T>>,
+}
+
+impl<T> CreditChannelSender<T> {
+    /// Blocks until some credit is available, the value is dropped if the receiver is dropped meanwhile.
+    pub(crate) fn send(&self, value: T) {
+        let mut state = self.queue.lock();
+        while state.credit == 0 && state.receiver_alive {
+            state = self
+                .queue
+                .credit_cv
+                .wait(state)
+                .unwrap_or_else(|e| e.into_inner());
+        }
+        if !state.receiver_alive {
+            return;
+        }
+        state.credit -= 1;
+        state.items.push_back(value);
+        self.queue.items_cv.notify_one();
+    }
+}
+
+impl<T> Drop for CreditChannelSender<T> {
+    fn drop(&mut self) {
+        self.queue.lock().sender_alive = false;
+        self.queue.items_cv.notify_all();
+    }
+}
+
+pub(crate) fn credit_channel<T>(
+    credit: usize,
+) -> (CreditChannelSender<T>, CreditChannelHandler<T>) {
+    let queue = Arc::new(CreditQueue {
+        state: Mutex::new(CreditState {
+            items: VecDeque::new(),
+            credit,
+            sender_alive: true,
+            receiver_alive: true,
+        }),
+        credit_cv: Condvar::new(),
+        items_cv: Condvar::new(),
+    });
+    (
+        CreditChannelSender {
+            queue: queue.clone(),
+        },
+        CreditChannelHandler { queue },
+    )
+}
@@ -11,6 +11,15 @@
 // Contributors:
 //   ZettaScale Zenoh team, <zenoh@zettascale.tech>
 //
+#[cfg(feature = "unstable")]
+use std::{
+    mem::MaybeUninit,
+    time::{Duration, Instant},
+};
+
+#[cfg(feature = "unstable")]
+use crate::result::{self, z_result_t};
+
 pub use sample_closure::*;
 mod sample_closure;
 
@@ -32,6 +41,23 @@ mod query_channel;
 pub use sample_channel::*;
 mod sample_channel;
 
+#[cfg(feature = "unstable")]
+mod spsc_ring;
+
+#[cfg(feature = "unstable")]
+mod credit_channel;
+
+#[cfg(feature = "unstable")]
+mod conflating_channel;
+
+#[cfg(feature = "unstable")]
+pub use priority_channel::{
+    zc_priority_channel_options_default, zc_priority_channel_options_t,
+    zc_priority_level_options_t, zc_priority_overflow_t,
+};
+#[cfg(feature = "unstable")]
+mod priority_channel;
+
 pub use hello_closure::*;
 mod hello_closure;
 
@@ -43,7 +69,123 @@ pub use matching_status_closure::*;
 #[cfg(feature = "unstable")]
 mod matching_status_closure;
 
+#[cfg(feature = "unstable")]
+pub use indexed_reply_closure::*;
+#[cfg(feature = "unstable")]
+mod indexed_reply_closure;
+
 #[cfg(feature = "unstable")]
 pub use miss_closure::*;
 #[cfg(feature = "unstable")]
 mod miss_closure;
+
+#[cfg(feature = "unstable")]
+pub use span_closure::*;
+#[cfg(feature = "unstable")]
+mod span_closure;
+
+#[cfg(feature = "unstable")]
+pub use liveliness_changes_closure::*;
+#[cfg(feature = "unstable")]
+mod liveliness_changes_closure;
+
+#[cfg(feature = "unstable")]
+/// Receives up to `capacity` items from a channel handler, calling `first` to obtain the first one
+/// and then draining the items that are already pending with `try_next`, without blocking.
+pub(crate) fn _channel_recv_many<T, E>(
+    first: impl FnOnce() -> Result<Option<T>, E>,
+    try_next: impl Fn() -> Result<Option<T>, E>,
+    mut write: impl FnMut(usize, T),
+    capacity: usize,
+    n: &mut usize,
+) -> z_result_t {
+    *n = 0;
+    if capacity == 0 {
+        return result::Z_EINVAL;
+    }
+    match first() {
+        Ok(Some(v)) => write(0, v),
+        Ok(None) => return result::Z_CHANNEL_NODATA,
+        Err(_) => return result::Z_CHANNEL_DISCONNECTED,
+    }
+    *n = 1;
+    while *n < capacity {
+        match try_next() {
+            Ok(Some(v)) => {
+                write(*n, v);
+                *n += 1;
+            }
+            _ => break,
+        }
+    }
+    result::Z_OK
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Options passed to the `*_recv_spin()` functions of the channel handlers.
+///
+/// The receiving thread busy-polls the channel before falling back to a blocking wait, trading CPU time for
+/// a lower wake-up latency.
+#[repr(C)]
+#[derive(Clone, Copy)]
+pub struct zc_recv_spin_options_t {
+    /// Maximum number of polling iterations before parking, 0 means no iteration limit.
+    pub spin_count: usize,
+    /// Maximum time in nanoseconds spent polling before parking, 0 means no time limit.
+    /// If both `spin_count` and `spin_duration_ns` are 0, the channel is not polled at all.
+    pub spin_duration_ns: u64,
+    /// If ``true``, the thread yields its time slice to the OS scheduler before parking.
+    pub yield_before_park: bool,
+}
+
+#[cfg(feature = "unstable")]
+impl Default for zc_recv_spin_options_t {
+    fn default() -> Self {
+        Self {
+            spin_count: 1000,
+            spin_duration_ns: 0,
+            yield_before_park: true,
+        }
+    }
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs the default value for `zc_recv_spin_options_t`.
+#[no_mangle]
+pub extern "C" fn zc_recv_spin_options_default(this_: &mut MaybeUninit<zc_recv_spin_options_t>) {
+    this_.write(zc_recv_spin_options_t::default());
+}
+
+#[cfg(feature = "unstable")]
+/// Polls the channel with `try_recv` according to `options`, and blocks with `recv` if nothing was received.
+pub(crate) fn _channel_recv_spin<T, E>(
+    try_recv: impl Fn() -> Result<Option<T>, E>,
+    recv: impl FnOnce() -> Result<T, E>,
+    options: Option<&zc_recv_spin_options_t>,
+) -> Result<T, E> {
+    let options = options.copied().unwrap_or_default();
+    if options.spin_count != 0 || options.spin_duration_ns != 0 {
+        let deadline = (options.spin_duration_ns != 0)
+            .then(|| Instant::now() + Duration::from_nanos(options.spin_duration_ns));
+        let mut i = 0usize;
+        while options.spin_count == 0 || i < options.spin_count {
+            if let Some(v) = try_recv()? {
+                return Ok(v);
+            }
+            if deadline.is_some_and(|d| Instant::now() >= d) {
+                break;
+            }
+            std::hint::spin_loop();
+            i += 1;
+        }
+    }
+    if options.yield_before_park {
+        std::thread::yield_now();
+        if let Some(v) = try_recv()? {
+            return Ok(v);
+        }
+    }
+    recv()
+}
@@ -0,0 +1,269 @@
+//
+// Copyright (c) 2017, 2024 ZettaScale Technology.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh team, <zenoh@zettascale.tech>
+//
+use std::{
+    collections::VecDeque,
+    mem::MaybeUninit,
+    sync::{Arc, Condvar, Mutex, MutexGuard},
+};
+
+/// The number of priority levels, one per value of `z_priority_t`.
+pub(crate) const PRIORITY_LEVELS: usize = 7;
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief What a priority channel does with a sample received for a level whose queue is full.
+#[repr(C)]
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub enum zc_priority_overflow_t {
+    /// Drops the oldest sample of the level to queue the new one, as a ring channel does.
+    DROP_OLDEST = 0,
+    /// Drops the new sample.
+    DROP_NEWEST = 1,
+    /// Blocks the callback until a sample of the level is received, as a FIFO channel does. This also delays
+    /// the samples of all the other levels delivered by the same thread, so it is meant for levels whose samples
+    /// may not be lost.
+    BLOCK = 2,
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief The settings of one priority level of a priority channel.
+#[repr(C)]
+#[derive(Clone, Copy, Debug)]
+pub struct zc_priority_level_options_t {
+    /// The maximum number of pending samples of the level, 0 to drop all samples of the level.
+    pub capacity: usize,
+    /// What to do with a sample received while the queue of the level is full.
+    pub overflow: zc_priority_overflow_t,
+    /// The number of consecutive samples of the level received in its turn when `weighted` is set, 0 is treated as 1.
+    pub weight: u32,
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Options passed to `z_priority_channel_sample_new()`.
+#[repr(C)]
+#[derive(Clone, Copy, Debug)]
+pub struct zc_priority_channel_options_t {
+    /// The settings of each priority level, `levels[0]` for `Z_PRIORITY_REAL_TIME` up to `levels[6]` for
+    /// `Z_PRIORITY_BACKGROUND`.
+    pub levels: [zc_priority_level_options_t; PRIORITY_LEVELS],
+    /// If ``false``, a sample is only received once all the samples of the higher levels are received. If ``true``,
+    /// the levels with pending samples are served in turn, each receiving up to `weight` samples per turn, so that
+    /// the lower levels are never starved.
+    pub weighted: bool,
+}
+
+impl Default for zc_priority_channel_options_t {
+    fn default() -> Self {
+        let mut levels = [zc_priority_level_options_t {
+            capacity: 256,
+            overflow: zc_priority_overflow_t::DROP_OLDEST,
+            weight: 1,
+        }; PRIORITY_LEVELS];
+        for (i, level) in levels.iter_mut().enumerate() {
+            level.weight = 1 << (PRIORITY_LEVELS - 1 - i);
+        }
+        Self {
+            levels,
+            weighted: false,
+        }
+    }
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs the default value for `zc_priority_channel_options_t`.
+///
+/// Each level queues up to 256 samples, dropping the oldest ones on overflow, and the levels are served in strict
+/// priority order. The weights used in weighted mode halve from 64 for `Z_PRIORITY_REAL_TIME` down to 1 for
+/// `Z_PRIORITY_BACKGROUND`.
+#[no_mangle]
+pub extern "C" fn zc_priority_channel_options_default(
+    this_: &mut MaybeUninit<zc_priority_channel_options_t>,
+) {
+    this_.write(zc_priority_channel_options_t::default());
+}
+
+struct PriorityState<T> {
+    levels: [VecDeque<T>; PRIORITY_LEVELS],
+    // The level served by the weighted dequeue and the number of values it received in its current turn.
+    turn: usize,
+    served: u32,
+    sender_alive: bool,
+    receiver_alive: bool,
+}
+
+/// A queue per priority level, each bounded with its own overflow policy.
+struct PriorityQueue<T> {
+    state: Mutex<PriorityState<T>>,
+    options: zc_priority_channel_options_t,
+    items_cv: Condvar,
+    space_cv: Condvar,
+}
+
+impl<T> PriorityQueue<T> {
+    fn lock(&self) -> MutexGuard<'_, PriorityState<T>> {
+        self.state.lock().unwrap_or_else(|e| e.into_inner())
+    }
+
+    fn pop(&self, state: &mut PriorityState<T>) -> Option<T> {
+        let v = if self.options.weighted {
+            self.pop_weighted(state)
+        } else {
+            state.levels.iter_mut().find_map(|l| l.pop_front())
+        };
+        if v.is_some() {
+            self.space_cv.notify_all();
+        }
+        v
+    }
+
+    fn pop_weighted(&self, state: &mut PriorityState<T>) -> Option<T> {
+        // Visits the current level and then all the others, coming back to the current one if it is the only
+        // level with pending values.
+        for _ in 0..=PRIORITY_LEVELS {
+            let weight = self.options.levels[state.turn].weight.max(1);
+            if state.served < weight {
+                if let Some(v) = state.levels[state.turn].pop_front() {
+                    state.served += 1;
+                    return Some(v);
+                }
+            }
+            state.turn = (state.turn + 1) % PRIORITY_LEVELS;
+            state.served = 0;
+        }
+        None
+    }
+}
+
+/// The receiving end of a priority channel, the channel is closed for senders when it is dropped.
+pub struct PriorityChannelHandler<T> {
+    queue: Arc<PriorityQueue<T>>,
+}
+
+impl<T> PriorityChannelHandler<T> {
+    /// Blocks until a value is received, returns `Err` once the sender is dropped and the queues are drained.
+    pub(crate) fn recv(&self) -> Result<T, ()> {
+        let mut state = self.queue.lock();
+        loop {
+            if let Some(v) = self.queue.pop(&mut state) {
+                return Ok(v);
+            }
+            if !state.sender_alive {
+                return Err(());
+            }
+            state = self
+                .queue
+                .items_cv
+                .wait(state)
+                .unwrap_or_else(|e| e.into_inner());
+        }
+    }
+
+    /// Returns `Ok(None)` if the queues are empty, `Err` once the sender is dropped and the queues are drained.
+    pub(crate) fn try_recv(&self) -> Result<Option<T>, ()> {
+        let mut state = self.queue.lock();
+        match self.queue.pop(&mut state) {
+            Some(v) => Ok(Some(v)),
+            None if !state.sender_alive => Err(()),
+            None => Ok(None),
+        }
+    }
+}
+
+impl<T> Drop for PriorityChannelHandler<T> {
+    fn drop(&mut self) {
+        let mut state = self.queue.lock();
+        state.receiver_alive = false;
+        state.levels.iter_mut().for_each(VecDeque::clear);
+        // Unblocks a sender waiting for space.
+        self.queue.space_cv.notify_all();
+    }
+}
+
+/// The sending end of a priority channel, the channel is disconnected when it is dropped.
+pub(crate) struct PriorityChannelSender<T> {
+    queue: Arc<PriorityQueue<T>>,
+    level: fn(&T) -> usize,
+}
+
+impl<T> PriorityChannelSender<T> {
+    /// Queues the value at its level, applying the overflow policy of the level if its queue is full. The value
+    /// is dropped if the receiver is dropped.
+    pub(crate) fn send(&self, value: T) {
+        let level = (self.level)(&value).min(PRIORITY_LEVELS - 1);
+        let options = &self.queue.options.levels[level];
+        if options.capacity == 0 {
+            return;
+        }
+        let mut state = self.queue.lock();
+        loop {
+            if !state.receiver_alive {
+                return;
+            }
+            if state.levels[level].len() < options.capacity {
+                state.levels[level].push_back(value);
+                self.queue.items_cv.notify_one();
+                return;
+            }
+            match options.overflow {
+                zc_priority_overflow_t::DROP_NEWEST => return,
+                zc_priority_overflow_t::DROP_OLDEST => {
+                    let dropped = state.levels[level].pop_front();
+                    state.levels[level].push_back(value);
+                    drop(state);
+                    drop(dropped);
+                    return;
+                }
+                zc_priority_overflow_t::BLOCK => {
+                    state = self
+                        .queue
+                        .space_cv
+                        .wait(state)
+                        .unwrap_or_else(|e| e.into_inner());
+                }
+            }
+        }
+    }
+}
+
+impl<T> Drop for PriorityChannelSender<T> {
+    fn drop(&mut self) {
+        self.queue.lock().sender_alive = false;
+        self.queue.items_cv.notify_all();
+    }
+}
+
+/// Constructs a priority channel, `level` returning the index of the queue of a value, 0 being the highest priority.
+pub(crate) fn priority_channel<T>(
+    options: zc_priority_channel_options_t,
+    level: fn(&T) -> usize,
+) -> (PriorityChannelSender<T>, PriorityChannelHandler<T>) {
+    let queue = Arc::new(PriorityQueue {
+        state: Mutex::new(PriorityState {
+            levels: Default::default(),
+            turn: 0,
+            served: 0,
+            sender_alive: true,
+            receiver_alive: true,
+        }),
+        options,
+        items_cv: Condvar::new(),
+        space_cv: Condvar::new(),
+    });
+    (
+        PriorityChannelSender {
+            queue: queue.clone(),
+            level,
+        },
+        PriorityChannelHandler { queue },
+    )
+}
@@ -20,6 +20,8 @@ use zenoh::{
     query::Query,
 };
 
+#[cfg(feature = "unstable")]
+use crate::closures::{_channel_recv_many, _channel_recv_spin, zc_recv_spin_options_t};
 pub use crate::opaque_types::{
     z_loaned_fifo_handler_query_t, z_moved_fifo_handler_query_t, z_owned_fifo_handler_query_t,
 };
@@ -148,6 +150,95 @@ pub extern "C" fn z_fifo_handler_query_try_recv(
     }
 }
 
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Receives up to `capacity` queries from the fifo buffer at once. If there are no pending queries will block until next query is received,
+/// or until the channel is dropped (normally when Queryable is dropped). Once at least one query is received, all the queries that are already
+/// pending are returned without blocking.
+///
+/// @param this_: The handler.
+/// @param queries: A pointer to an array of at least `capacity` uninitialized queries. Only the first `n` elements are initialized upon return.
+/// @param capacity: The maximum number of queries to receive.
+/// @param n: Will be set to the number of received queries.
+/// @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped, `Z_EINVAL` if `capacity` is 0.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_fifo_handler_query_recv_many(
+    this_: &z_loaned_fifo_handler_query_t,
+    queries: *mut MaybeUninit<z_owned_query_t>,
+    capacity: usize,
+    n: &mut usize,
+) -> z_result_t {
+    let handler = this_.as_rust_type_ref();
+    _channel_recv_many(
+        || handler.recv().map(Some),
+        || handler.try_recv(),
+        |i, v| {
+            (*queries.add(i)).as_rust_type_mut_uninit().write(Some(v));
+        },
+        capacity,
+        n,
+    )
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns query from the fifo buffer, busy-polling the channel according to `options` before blocking until next query is received,
+/// or until the channel is dropped (normally when Queryable is dropped).
+///
+/// @param this_: The handler.
+/// @param query: An uninitialized memory location where the query will be constructed.
+/// @param options: The polling options, if `NULL` the default ones are used.
+/// @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the query will be in the gravestone state).
+#[no_mangle]
+pub extern "C" fn z_fifo_handler_query_recv_spin(
+    this_: &z_loaned_fifo_handler_query_t,
+    query: &mut MaybeUninit<z_owned_query_t>,
+    options: Option<&zc_recv_spin_options_t>,
+) -> z_result_t {
+    let handler = this_.as_rust_type_ref();
+    match _channel_recv_spin(|| handler.try_recv(), || handler.recv(), options) {
+        Ok(v) => {
+            query.as_rust_type_mut_uninit().write(Some(v));
+            result::Z_OK
+        }
+        Err(_) => {
+            query.as_rust_type_mut_uninit().write(None);
+            result::Z_CHANNEL_DISCONNECTED
+        }
+    }
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Receives up to `capacity` queries from the fifo buffer at once. If there are no pending queries will return immediately.
+///
+/// @param this_: The handler.
+/// @param queries: A pointer to an array of at least `capacity` uninitialized queries. Only the first `n` elements are initialized upon return.
+/// @param capacity: The maximum number of queries to receive.
+/// @param n: Will be set to the number of received queries.
+/// @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped,
+/// `Z_CHANNEL_NODATA` if the channel is still alive, but its buffer is empty, `Z_EINVAL` if `capacity` is 0.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_fifo_handler_query_try_recv_many(
+    this_: &z_loaned_fifo_handler_query_t,
+    queries: *mut MaybeUninit<z_owned_query_t>,
+    capacity: usize,
+    n: &mut usize,
+) -> z_result_t {
+    let handler = this_.as_rust_type_ref();
+    _channel_recv_many(
+        || handler.try_recv(),
+        || handler.try_recv(),
+        |i, v| {
+            (*queries.add(i)).as_rust_type_mut_uninit().write(Some(v));
+        },
+        capacity,
+        n,
+    )
+}
+
 pub use crate::opaque_types::{
     z_loaned_ring_handler_query_t, z_moved_ring_handler_query_t, z_owned_ring_handler_query_t,
 };
@@ -256,3 +347,92 @@ pub extern "C" fn z_ring_handler_query_try_recv(
         }
     }
 }
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Receives up to `capacity` queries from the ring buffer at once. If there are no pending queries will block until next query is received,
+/// or until the channel is dropped (normally when Queryable is dropped). Once at least one query is received, all the queries that are already
+/// pending are returned without blocking.
+///
+/// @param this_: The handler.
+/// @param queries: A pointer to an array of at least `capacity` uninitialized queries. Only the first `n` elements are initialized upon return.
+/// @param capacity: The maximum number of queries to receive.
+/// @param n: Will be set to the number of received queries.
+/// @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped, `Z_EINVAL` if `capacity` is 0.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_ring_handler_query_recv_many(
+    this_: &z_loaned_ring_handler_query_t,
+    queries: *mut MaybeUninit<z_owned_query_t>,
+    capacity: usize,
+    n: &mut usize,
+) -> z_result_t {
+    let handler = this_.as_rust_type_ref();
+    _channel_recv_many(
+        || handler.recv().map(Some),
+        || handler.try_recv(),
+        |i, v| {
+            (*queries.add(i)).as_rust_type_mut_uninit().write(Some(v));
+        },
+        capacity,
+        n,
+    )
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns query from the ring buffer, busy-polling the channel according to `options` before blocking until next query is received,
+/// or until the channel is dropped (normally when Queryable is dropped).
+///
+/// @param this_: The handler.
+/// @param query: An uninitialized memory location where the query will be constructed.
+/// @param options: The polling options, if `NULL` the default ones are used.
+/// @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the query will be in the gravestone state).
+#[no_mangle]
+pub extern "C" fn z_ring_handler_query_recv_spin(
+    this_: &z_loaned_ring_handler_query_t,
+    query: &mut MaybeUninit<z_owned_query_t>,
+    options: Option<&zc_recv_spin_options_t>,
+) -> z_result_t {
+    let handler = this_.as_rust_type_ref();
+    match _channel_recv_spin(|| handler.try_recv(), || handler.recv(), options) {
+        Ok(v) => {
+            query.as_rust_type_mut_uninit().write(Some(v));
+            result::Z_OK
+        }
+        Err(_) => {
+            query.as_rust_type_mut_uninit().write(None);
+            result::Z_CHANNEL_DISCONNECTED
+        }
+    }
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Receives up to `capacity` queries from the ring buffer at once. If there are no pending queries will return immediately.
+///
+/// @param this_: The handler.
+/// @param queries: A pointer to an array of at least `capacity` uninitialized queries. Only the first `n` elements are initialized upon return.
+/// @param capacity: The maximum number of queries to receive.
+/// @param n: Will be set to the number of received queries.
+/// @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped,
+/// `Z_CHANNEL_NODATA` if the channel is still alive, but its buffer is empty, `Z_EINVAL` if `capacity` is 0.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_ring_handler_query_try_recv_many(
+    this_: &z_loaned_ring_handler_query_t,
+    queries: *mut MaybeUninit<z_owned_query_t>,
+    capacity: usize,
+    n: &mut usize,
+) -> z_result_t {
+    let handler = this_.as_rust_type_ref();
+    _channel_recv_many(
+        || handler.try_recv(),
+        || handler.try_recv(),
+        |i, v| {
+            (*queries.add(i)).as_rust_type_mut_uninit().write(Some(v));
+        },
+        capacity,
+        n,
+    )
+}
@@ -20,6 +20,12 @@ use zenoh::{
     query::Reply,
 };
 
+#[cfg(feature = "unstable")]
+use crate::closures::{
+    _channel_recv_many, _channel_recv_spin,
+    credit_channel::{credit_channel, CreditChannelHandler, CreditChannelSender},
+    zc_recv_spin_options_t,
+};
 pub use crate::opaque_types::{
     z_loaned_fifo_handler_reply_t, z_moved_fifo_handler_reply_t, z_owned_fifo_handler_reply_t,
 };
@@ -147,6 +153,95 @@ pub extern "C" fn z_fifo_handler_reply_try_recv(
     }
 }
 
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Receives up to `capacity` replies from the fifo buffer at once. If there are no pending replies will block until next reply is received,
+/// or until the channel is dropped (normally when all replies are received). Once at least one reply is received, all the replies that are already
+/// pending are returned without blocking.
+///
+/// @param this_: The handler.
+/// @param replies: A pointer to an array of at least `capacity` uninitialized replies. Only the first `n` elements are initialized upon return.
+/// @param capacity: The maximum number of replies to receive.
+/// @param n: Will be set to the number of received replies.
+/// @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped, `Z_EINVAL` if `capacity` is 0.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_fifo_handler_reply_recv_many(
+    this_: &z_loaned_fifo_handler_reply_t,
+    replies: *mut MaybeUninit<z_owned_reply_t>,
+    capacity: usize,
+    n: &mut usize,
+) -> z_result_t {
+    let handler = this_.as_rust_type_ref();
+    _channel_recv_many(
+        || handler.recv().map(Some),
+        || handler.try_recv(),
+        |i, v| {
+            (*replies.add(i)).as_rust_type_mut_uninit().write(Some(v));
+        },
+        capacity,
+        n,
+    )
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns reply from the fifo buffer, busy-polling the channel according to `options` before blocking until next reply is received,
+/// or until the channel is dropped (normally when all replies are received).
+///
+/// @param this_: The handler.
+/// @param reply: An uninitialized memory location where the reply will be constructed.
+/// @param options: The polling options, if `NULL` the default ones are used.
+/// @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the reply will be in the gravestone state).
+#[no_mangle]
+pub extern "C" fn z_fifo_handler_reply_recv_spin(
+    this_: &z_loaned_fifo_handler_reply_t,
+    reply: &mut MaybeUninit<z_owned_reply_t>,
+    options: Option<&zc_recv_spin_options_t>,
+) -> z_result_t {
+    let handler = this_.as_rust_type_ref();
+    match _channel_recv_spin(|| handler.try_recv(), || handler.recv(), options) {
+        Ok(v) => {
+            reply.as_rust_type_mut_uninit().write(Some(v));
+            result::Z_OK
+        }
+        Err(_) => {
+            reply.as_rust_type_mut_uninit().write(None);
+            result::Z_CHANNEL_DISCONNECTED
+        }
+    }
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Receives up to `capacity` replies from the fifo buffer at once. If there are no pending replies will return immediately.
+///
+/// @param this_: The handler.
+/// @param replies: A pointer to an array of at least `capacity` uninitialized replies. Only the first `n` elements are initialized upon return.
+/// @param capacity: The maximum number of replies to receive.
+/// @param n: Will be set to the number of received replies.
+/// @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped,
+/// `Z_CHANNEL_NODATA` if the channel is still alive, but its buffer is empty, `Z_EINVAL` if `capacity` is 0.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_fifo_handler_reply_try_recv_many(
+    this_: &z_loaned_fifo_handler_reply_t,
+    replies: *mut MaybeUninit<z_owned_reply_t>,
+    capacity: usize,
+    n: &mut usize,
+) -> z_result_t {
+    let handler = this_.as_rust_type_ref();
+    _channel_recv_many(
+        || handler.try_recv(),
+        || handler.try_recv(),
+        |i, v| {
+            (*replies.add(i)).as_rust_type_mut_uninit().write(Some(v));
+        },
+        capacity,
+        n,
+    )
+}
+
 pub use crate::opaque_types::{
     z_loaned_ring_handler_reply_t, z_moved_ring_handler_reply_t, z_owned_ring_handler_reply_t,
 };
@@ -252,3 +347,268 @@ pub extern "C" fn z_ring_handler_reply_try_recv(
         }
     }
 }
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Receives up to `capacity` replies from the ring buffer at once. If there are no pending replies will block until next reply is received,
+/// or until the channel is dropped (normally when all replies are received). Once at least one reply is received, all the replies that are already
+/// pending are returned without blocking.
+///
+/// @param this_: The handler.
+/// @param replies: A pointer to an array of at least `capacity` uninitialized replies. Only the first `n` elements are initialized upon return.
+/// @param capacity: The maximum number of replies to receive.
+/// @param n: Will be set to the number of received replies.
+/// @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped, `Z_EINVAL` if `capacity` is 0.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_ring_handler_reply_recv_many(
+    this_: &z_loaned_ring_handler_reply_t,
+    replies: *mut MaybeUninit<z_owned_reply_t>,
+    capacity: usize,
+    n: &mut usize,
+) -> z_result_t {
+    let handler = this_.as_rust_type_ref();
+    _channel_recv_many(
+        || handler.recv().map(Some),
+        || handler.try_recv(),
+        |i, v| {
+            (*replies.add(i)).as_rust_type_mut_uninit().write(Some(v));
+        },
+        capacity,
+        n,
+    )
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns reply from the ring buffer, busy-polling the channel according to `options` before blocking until next reply is received,
+/// or until the channel is dropped (normally when all replies are received).
+///
+/// @param this_: The handler.
+/// @param reply: An uninitialized memory location where the reply will be constructed.
+/// @param options: The polling options, if `NULL` the default ones are used.
+/// @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the reply will be in the gravestone state).
+#[no_mangle]
+pub extern "C" fn z_ring_handler_reply_recv_spin(
+    this_: &z_loaned_ring_handler_reply_t,
+    reply: &mut MaybeUninit<z_owned_reply_t>,
+    options: Option<&zc_recv_spin_options_t>,
+) -> z_result_t {
+    let handler = this_.as_rust_type_ref();
+    match _channel_recv_spin(|| handler.try_recv(), || handler.recv(), options) {
+        Ok(v) => {
+            reply.as_rust_type_mut_uninit().write(Some(v));
+            result::Z_OK
+        }
+        Err(_) => {
+            reply.as_rust_type_mut_uninit().write(None);
+            result::Z_CHANNEL_DISCONNECTED
+        }
+    }
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Receives up to `capacity` replies from the ring buffer at once. If there are no pending replies will return immediately.
+///
+/// @param this_: The handler.
+/// @param replies: A pointer to an array of at least `capacity` uninitialized replies. Only the first `n` elements are initialized upon return.
+/// @param capacity: The maximum number of replies to receive.
+/// @param n: Will be set to the number of received replies.
+/// @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped,
+/// `Z_CHANNEL_NODATA` if the channel is still alive, but its buffer is empty, `Z_EINVAL` if `capacity` is 0.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_ring_handler_reply_try_recv_many(
+    this_: &z_loaned_ring_handler_reply_t,
+    replies: *mut MaybeUninit<z_owned_reply_t>,
+    capacity: usize,
+    n: &mut usize,
+) -> z_result_t {
+    let handler = this_.as_rust_type_ref();
+    _channel_recv_many(
+        || handler.try_recv(),
+        || handler.try_recv(),
+        |i, v| {
+            (*replies.add(i)).as_rust_type_mut_uninit().write(Some(v));
+        },
+        capacity,
+        n,
+    )
+}
+
+#[cfg(feature = "unstable")]
+pub use crate::opaque_types::{
+    z_loaned_credit_handler_reply_t, z_moved_credit_handler_reply_t, z_owned_credit_handler_reply_t,
+};
+#[cfg(feature = "unstable")]
+decl_c_type!(
+    owned(
+        z_owned_credit_handler_reply_t,
+        option CreditChannelHandler<Reply>,
+    ),
+    loaned(z_loaned_credit_handler_reply_t),
+);
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Drops the handler and resets it to a gravestone state.
+///
+/// The pending replies are dropped, as well as all the replies received afterwards.
+#[no_mangle]
+pub extern "C" fn z_credit_handler_reply_drop(this_: &mut z_moved_credit_handler_reply_t) {
+    let _ = this_.take_rust_type();
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs a handler in gravestone state.
+#[no_mangle]
+pub extern "C" fn z_internal_credit_handler_reply_null(
+    this_: &mut MaybeUninit<z_owned_credit_handler_reply_t>,
+) {
+    this_.as_rust_type_mut_uninit().write(None);
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns ``true`` if handler is valid, ``false`` if it is in gravestone state.
+#[no_mangle]
+pub extern "C" fn z_internal_credit_handler_reply_check(
+    this_: &z_owned_credit_handler_reply_t,
+) -> bool {
+    this_.as_rust_type_ref().is_some()
+}
+
+#[cfg(feature = "unstable")]
+extern "C" fn __z_credit_handler_reply_send(reply: &mut z_loaned_reply_t, context: *mut c_void) {
+    unsafe {
+        let sender = (context as *const CreditChannelSender<Reply>)
+            .as_ref()
+            .unwrap_unchecked();
+        let owned_ref: &mut Option<Reply> = std::mem::transmute(reply);
+        sender.send(std::mem::take(owned_ref).unwrap_unchecked());
+    }
+}
+
+#[cfg(feature = "unstable")]
+extern "C" fn __z_credit_handler_reply_drop(context: *mut c_void) {
+    unsafe {
+        let sender = Box::from_raw(context as *mut CreditChannelSender<Reply>);
+        std::mem::drop(sender);
+    }
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs send and recieve ends of a flow-controlled reply channel.
+///
+/// Each received reply consumes one unit of the credit granted by the consumer, starting with `credit`, and further
+/// credit is only granted explicitly with `z_credit_handler_reply_grant()`. Once the credit is exhausted, the reply
+/// callback blocks, applying back-pressure to the transport: remote queryables replying with
+/// `Z_CONGESTION_CONTROL_BLOCK` (the default) then block in `z_query_reply()` once their transmission queue is full.
+/// This way a query returning a large number of replies is streamed with bounded memory on both ends.
+///
+/// Note that while the callback is blocked, the other messages received on the same link are delayed as well, so the
+/// consumer should keep granting credit while it processes replies.
+///
+/// The callback blocks the thread delivering the reply. For a queryable declared on the same session, this is the
+/// thread calling `z_query_reply()`, which is the thread calling `z_get()` when the query is answered from the
+/// queryable callback itself. Credit must therefore be granted from a thread other than the one issuing the query,
+/// and a local queryable must not wait for the consumer while replying, otherwise both ends deadlock once the credit is
+/// exhausted.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_credit_channel_reply_new(
+    callback: &mut MaybeUninit<z_owned_closure_reply_t>,
+    handler: &mut MaybeUninit<z_owned_credit_handler_reply_t>,
+    credit: usize,
+) {
+    let (sender, h) = credit_channel(credit);
+    let cb_ptr = Box::into_raw(Box::new(sender)) as *mut libc::c_void;
+    handler.as_rust_type_mut_uninit().write(Some(h));
+    callback.write(z_owned_closure_reply_t {
+        _call: Some(__z_credit_handler_reply_send),
+        _context: cb_ptr,
+        _drop: Some(__z_credit_handler_reply_drop),
+    });
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Borrows handler.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_credit_handler_reply_loan(
+    this: &z_owned_credit_handler_reply_t,
+) -> &z_loaned_credit_handler_reply_t {
+    this.as_rust_type_ref()
+        .as_ref()
+        .unwrap_unchecked()
+        .as_loaned_c_type_ref()
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Grants the reception of `n` more replies, unblocking the reply callback if it was waiting for credit.
+#[no_mangle]
+pub extern "C" fn z_credit_handler_reply_grant(this: &z_loaned_credit_handler_reply_t, n: usize) {
+    this.as_rust_type_ref().grant(n);
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns the number of replies that can still be received before the reply callback blocks.
+#[no_mangle]
+pub extern "C" fn z_credit_handler_reply_credit(this: &z_loaned_credit_handler_reply_t) -> usize {
+    this.as_rust_type_ref().credit()
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns reply from the credit buffer. If there are no more pending replies will block until next reply is received, or until
+/// the channel is dropped (normally when all replies are received). Receiving a reply does not grant any new credit.
+/// @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the reply will be in the gravestone state).
+#[no_mangle]
+pub extern "C" fn z_credit_handler_reply_recv(
+    this: &z_loaned_credit_handler_reply_t,
+    reply: &mut MaybeUninit<z_owned_reply_t>,
+) -> z_result_t {
+    match this.as_rust_type_ref().recv() {
+        Ok(q) => {
+            reply.as_rust_type_mut_uninit().write(Some(q));
+            result::Z_OK
+        }
+        Err(_) => {
+            reply.as_rust_type_mut_uninit().write(None);
+            result::Z_CHANNEL_DISCONNECTED
+        }
+    }
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns reply from the credit buffer. If there are no more pending replies will return immediately (with reply set to its gravestone state).
+/// @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the reply will be in the gravestone state),
+/// `Z_CHANNEL_NODATA` if the channel is still alive, but its buffer is empty (the reply will be in the gravestone state).
+#[no_mangle]
+pub extern "C" fn z_credit_handler_reply_try_recv(
+    this: &z_loaned_credit_handler_reply_t,
+    reply: &mut MaybeUninit<z_owned_reply_t>,
+) -> z_result_t {
+    match this.as_rust_type_ref().try_recv() {
+        Ok(q) => {
+            let r = if q.is_some() {
+                result::Z_OK
+            } else {
+                result::Z_CHANNEL_NODATA
+            };
+            reply.as_rust_type_mut_uninit().write(q);
+            r
+        }
+        Err(_) => {
+            reply.as_rust_type_mut_uninit().write(None);
+            result::Z_CHANNEL_DISCONNECTED
+        }
+    }
+}
@@ -23,6 +23,23 @@ use zenoh::{
 pub use crate::opaque_types::{
     z_loaned_fifo_handler_sample_t, z_moved_fifo_handler_sample_t, z_owned_fifo_handler_sample_t,
 };
+#[cfg(feature = "unstable")]
+use zenoh::{key_expr::KeyExpr, session::EntityGlobalId};
+
+#[cfg(feature = "unstable")]
+use crate::closures::{
+    conflating_channel::{conflating_channel, ConflatingChannelHandler, ConflatingChannelSender},
+    priority_channel::{
+        priority_channel, zc_priority_channel_options_t, PriorityChannelHandler,
+        PriorityChannelSender,
+    },
+    spsc_ring::{spsc_channel, SpscChannelHandler, SpscChannelSender},
+};
+#[cfg(feature = "unstable")]
+use crate::{
+    closures::{_channel_recv_many, _channel_recv_spin, zc_recv_spin_options_t},
+    z_priority_t,
+};
 use crate::{
     result::{self, z_result_t},
     transmute::{LoanedCTypeRef, RustTypeRef, RustTypeRefUninit, TakeRustType},
@@ -148,6 +165,95 @@ pub extern "C" fn z_fifo_handler_sample_try_recv(
     }
 }
 
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Receives up to `capacity` samples from the fifo buffer at once. If there are no pending samples will block until next sample is received,
+/// or until the channel is dropped (normally when there are no more samples to receive). Once at least one sample is received, all the samples that are already
+/// pending are returned without blocking.
+///
+/// @param this_: The handler.
+/// @param samples: A pointer to an array of at least `capacity` uninitialized samples. Only the first `n` elements are initialized upon return.
+/// @param capacity: The maximum number of samples to receive.
+/// @param n: Will be set to the number of received samples.
+/// @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped, `Z_EINVAL` if `capacity` is 0.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_fifo_handler_sample_recv_many(
+    this_: &z_loaned_fifo_handler_sample_t,
+    samples: *mut MaybeUninit<z_owned_sample_t>,
+    capacity: usize,
+    n: &mut usize,
+) -> z_result_t {
+    let handler = this_.as_rust_type_ref();
+    _channel_recv_many(
+        || handler.recv().map(Some),
+        || handler.try_recv(),
+        |i, v| {
+            (*samples.add(i)).as_rust_type_mut_uninit().write(Some(v));
+        },
+        capacity,
+        n,
+    )
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns sample from the fifo buffer, busy-polling the channel according to `options` before blocking until next sample is received,
+/// or until the channel is dropped (normally when there are no more samples to receive).
+///
+/// @param this_: The handler.
+/// @param sample: An uninitialized memory location where the sample will be constructed.
+/// @param options: The polling options, if `NULL` the default ones are used.
+/// @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the sample will be in the gravestone state).
+#[no_mangle]
+pub extern "C" fn z_fifo_handler_sample_recv_spin(
+    this_: &z_loaned_fifo_handler_sample_t,
+    sample: &mut MaybeUninit<z_owned_sample_t>,
+    options: Option<&zc_recv_spin_options_t>,
+) -> z_result_t {
+    let handler = this_.as_rust_type_ref();
+    match _channel_recv_spin(|| handler.try_recv(), || handler.recv(), options) {
+        Ok(v) => {
+            sample.as_rust_type_mut_uninit().write(Some(v));
+            result::Z_OK
+        }
+        Err(_) => {
+            sample.as_rust_type_mut_uninit().write(None);
+            result::Z_CHANNEL_DISCONNECTED
+        }
+    }
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Receives up to `capacity` samples from the fifo buffer at once. If there are no pending samples will return immediately.
+///
+/// @param this_: The handler.
+/// @param samples: A pointer to an array of at least `capacity` uninitialized samples. Only the first `n` elements are initialized upon return.
+/// @param capacity: The maximum number of samples to receive.
+/// @param n: Will be set to the number of received samples.
+/// @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped,
+/// `Z_CHANNEL_NODATA` if the channel is still alive, but its buffer is empty, `Z_EINVAL` if `capacity` is 0.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_fifo_handler_sample_try_recv_many(
+    this_: &z_loaned_fifo_handler_sample_t,
+    samples: *mut MaybeUninit<z_owned_sample_t>,
+    capacity: usize,
+    n: &mut usize,
+) -> z_result_t {
+    let handler = this_.as_rust_type_ref();
+    _channel_recv_many(
+        || handler.try_recv(),
+        || handler.try_recv(),
+        |i, v| {
+            (*samples.add(i)).as_rust_type_mut_uninit().write(Some(v));
+        },
+        capacity,
+        n,
+    )
+}
+
 pub use crate::opaque_types::{
     z_loaned_ring_handler_sample_t, z_moved_ring_handler_sample_t, z_owned_ring_handler_sample_t,
 };
@@ -256,3 +362,596 @@ pub extern "C" fn z_ring_handler_sample_try_recv(
         }
     }
 }
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Receives up to `capacity` samples from the ring buffer at once. If there are no pending samples will block until next sample is received,
+/// or until the channel is dropped (normally when there are no more samples to receive). Once at least one sample is received, all the samples that are already
+/// pending are returned without blocking.
+///
+/// @param this_: The handler.
+/// @param samples: A pointer to an array of at least `capacity` uninitialized samples. Only the first `n` elements are initialized upon return.
+/// @param capacity: The maximum number of samples to receive.
+/// @param n: Will be set to the number of received samples.
+/// @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped, `Z_EINVAL` if `capacity` is 0.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_ring_handler_sample_recv_many(
+    this_: &z_loaned_ring_handler_sample_t,
+    samples: *mut MaybeUninit<z_owned_sample_t>,
+    capacity: usize,
+    n: &mut usize,
+) -> z_result_t {
+    let handler = this_.as_rust_type_ref();
+    _channel_recv_many(
+        || handler.recv().map(Some),
+        || handler.try_recv(),
+        |i, v| {
+            (*samples.add(i)).as_rust_type_mut_uninit().write(Some(v));
+        },
+        capacity,
+        n,
+    )
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns sample from the ring buffer, busy-polling the channel according to `options` before blocking until next sample is received,
+/// or until the channel is dropped (normally when there are no more samples to receive).
+///
+/// @param this_: The handler.
+/// @param sample: An uninitialized memory location where the sample will be constructed.
+/// @param options: The polling options, if `NULL` the default ones are used.
+/// @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the sample will be in the gravestone state).
+#[no_mangle]
+pub extern "C" fn z_ring_handler_sample_recv_spin(
+    this_: &z_loaned_ring_handler_sample_t,
+    sample: &mut MaybeUninit<z_owned_sample_t>,
+    options: Option<&zc_recv_spin_options_t>,
+) -> z_result_t {
+    let handler = this_.as_rust_type_ref();
+    match _channel_recv_spin(|| handler.try_recv(), || handler.recv(), options) {
+        Ok(v) => {
+            sample.as_rust_type_mut_uninit().write(Some(v));
+            result::Z_OK
+        }
+        Err(_) => {
+            sample.as_rust_type_mut_uninit().write(None);
+            result::Z_CHANNEL_DISCONNECTED
+        }
+    }
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Receives up to `capacity` samples from the ring buffer at once. If there are no pending samples will return immediately.
+///
+/// @param this_: The handler.
+/// @param samples: A pointer to an array of at least `capacity` uninitialized samples. Only the first `n` elements are initialized upon return.
+/// @param capacity: The maximum number of samples to receive.
+/// @param n: Will be set to the number of received samples.
+/// @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped,
+/// `Z_CHANNEL_NODATA` if the channel is still alive, but its buffer is empty, `Z_EINVAL` if `capacity` is 0.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_ring_handler_sample_try_recv_many(
+    this_: &z_loaned_ring_handler_sample_t,
+    samples: *mut MaybeUninit<z_owned_sample_t>,
+    capacity: usize,
+    n: &mut usize,
+) -> z_result_t {
+    let handler = this_.as_rust_type_ref();
+    _channel_recv_many(
+        || handler.try_recv(),
+        || handler.try_recv(),
+        |i, v| {
+            (*samples.add(i)).as_rust_type_mut_uninit().write(Some(v));
+        },
+        capacity,
+        n,
+    )
+}
+
+#[cfg(feature = "unstable")]
+pub use crate::opaque_types::{
+    z_loaned_spsc_handler_sample_t, z_moved_spsc_handler_sample_t, z_owned_spsc_handler_sample_t,
+};
+#[cfg(feature = "unstable")]
+decl_c_type!(
+    owned(
+        z_owned_spsc_handler_sample_t,
+        option SpscChannelHandler<Sample>,
+    ),
+    loaned(z_loaned_spsc_handler_sample_t),
+);
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Drops the handler and resets it to a gravestone state.
+#[no_mangle]
+pub extern "C" fn z_spsc_handler_sample_drop(this_: &mut z_moved_spsc_handler_sample_t) {
+    let _ = this_.take_rust_type();
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs a handler in gravestone state.
+#[no_mangle]
+pub extern "C" fn z_internal_spsc_handler_sample_null(
+    this: &mut MaybeUninit<z_owned_spsc_handler_sample_t>,
+) {
+    this.as_rust_type_mut_uninit().write(None);
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns ``true`` if handler is valid, ``false`` if it is in gravestone state.
+#[no_mangle]
+pub extern "C" fn z_internal_spsc_handler_sample_check(
+    this_: &z_owned_spsc_handler_sample_t,
+) -> bool {
+    this_.as_rust_type_ref().is_some()
+}
+
+#[cfg(feature = "unstable")]
+extern "C" fn __z_spsc_handler_sample_send(sample: &mut z_loaned_sample_t, context: *mut c_void) {
+    unsafe {
+        let sender = (context as *const SpscChannelSender<Sample>)
+            .as_ref()
+            .unwrap_unchecked();
+        let owned_ref: &mut Option<Sample> = std::mem::transmute(sample);
+        sender.send(std::mem::take(owned_ref).unwrap_unchecked());
+    }
+}
+
+#[cfg(feature = "unstable")]
+extern "C" fn __z_spsc_handler_sample_drop(context: *mut c_void) {
+    unsafe {
+        let sender = Box::from_raw(context as *mut SpscChannelSender<Sample>);
+        std::mem::drop(sender);
+    }
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs send and recieve ends of the single-producer/single-consumer channel.
+///
+/// The channel is a bounded ring buffer, intended for pipelines where the samples produced by a single callback
+/// (i.e. a single subscriber) are consumed by a single thread. The callback and the receiving thread each take a lock
+/// of their own side only, which is uncontended in this use, and the receiving thread only waits on a condition variable
+/// when the buffer is empty.
+///
+/// Samples received while the buffer is full are dropped, their number is returned by `z_spsc_handler_sample_dropped()`.
+/// Receiving from several threads is safe but serialized: `z_spsc_handler_sample_try_recv()` returns `Z_CHANNEL_NODATA`
+/// while another thread is receiving.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_spsc_channel_sample_new(
+    callback: &mut MaybeUninit<z_owned_closure_sample_t>,
+    handler: &mut MaybeUninit<z_owned_spsc_handler_sample_t>,
+    capacity: usize,
+) {
+    let (sender, h) = spsc_channel(capacity);
+    let cb_ptr = Box::into_raw(Box::new(sender)) as *mut libc::c_void;
+    handler.as_rust_type_mut_uninit().write(Some(h));
+    callback.write(z_owned_closure_sample_t {
+        _call: Some(__z_spsc_handler_sample_send),
+        _context: cb_ptr,
+        _drop: Some(__z_spsc_handler_sample_drop),
+    });
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Borrows handler.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_spsc_handler_sample_loan(
+    this: &z_owned_spsc_handler_sample_t,
+) -> &z_loaned_spsc_handler_sample_t {
+    this.as_rust_type_ref()
+        .as_ref()
+        .unwrap_unchecked()
+        .as_loaned_c_type_ref()
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns sample from the spsc buffer. If there are no more pending samples will block until next sample is received, or until
+/// the channel is dropped (normally when there are no more samples to receive).
+/// @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the sample will be in the gravestone state).
+#[no_mangle]
+pub extern "C" fn z_spsc_handler_sample_recv(
+    this: &z_loaned_spsc_handler_sample_t,
+    sample: &mut MaybeUninit<z_owned_sample_t>,
+) -> z_result_t {
+    match this.as_rust_type_ref().recv() {
+        Ok(q) => {
+            sample.as_rust_type_mut_uninit().write(Some(q));
+            result::Z_OK
+        }
+        Err(_) => {
+            sample.as_rust_type_mut_uninit().write(None);
+            result::Z_CHANNEL_DISCONNECTED
+        }
+    }
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns sample from the spsc buffer. If there are no more pending samples will return immediately (with sample set to its gravestone state).
+/// @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the sample will be in the gravestone state),
+/// `Z_CHANNEL_NODATA` if the channel is still alive, but its buffer is empty (the sample will be in the gravestone state).
+#[no_mangle]
+pub extern "C" fn z_spsc_handler_sample_try_recv(
+    this: &z_loaned_spsc_handler_sample_t,
+    sample: &mut MaybeUninit<z_owned_sample_t>,
+) -> z_result_t {
+    match this.as_rust_type_ref().try_recv() {
+        Ok(q) => {
+            let r = if q.is_some() {
+                result::Z_OK
+            } else {
+                result::Z_CHANNEL_NODATA
+            };
+            sample.as_rust_type_mut_uninit().write(q);
+            r
+        }
+        Err(_) => {
+            sample.as_rust_type_mut_uninit().write(None);
+            result::Z_CHANNEL_DISCONNECTED
+        }
+    }
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns the number of samples dropped by the spsc channel because its buffer was full.
+#[no_mangle]
+pub extern "C" fn z_spsc_handler_sample_dropped(this: &z_loaned_spsc_handler_sample_t) -> u64 {
+    this.as_rust_type_ref().dropped()
+}
+
+/// The key under which the samples of a conflating channel replace each other.
+#[cfg(feature = "unstable")]
+type ConflationKey = (KeyExpr<'static>, Option<EntityGlobalId>);
+
+#[cfg(feature = "unstable")]
+pub use crate::opaque_types::{
+    z_loaned_conflating_handler_sample_t, z_moved_conflating_handler_sample_t,
+    z_owned_conflating_handler_sample_t,
+};
+#[cfg(feature = "unstable")]
+decl_c_type!(
+    owned(
+        z_owned_conflating_handler_sample_t,
+        option ConflatingChannelHandler<ConflationKey, Sample>,
+    ),
+    loaned(z_loaned_conflating_handler_sample_t),
+);
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Drops the handler and resets it to a gravestone state.
+#[no_mangle]
+pub extern "C" fn z_conflating_handler_sample_drop(
+    this_: &mut z_moved_conflating_handler_sample_t,
+) {
+    let _ = this_.take_rust_type();
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs a handler in gravestone state.
+#[no_mangle]
+pub extern "C" fn z_internal_conflating_handler_sample_null(
+    this: &mut MaybeUninit<z_owned_conflating_handler_sample_t>,
+) {
+    this.as_rust_type_mut_uninit().write(None);
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns ``true`` if handler is valid, ``false`` if it is in gravestone state.
+#[no_mangle]
+pub extern "C" fn z_internal_conflating_handler_sample_check(
+    this_: &z_owned_conflating_handler_sample_t,
+) -> bool {
+    this_.as_rust_type_ref().is_some()
+}
+
+#[cfg(feature = "unstable")]
+extern "C" fn __z_conflating_handler_sample_send(
+    sample: &mut z_loaned_sample_t,
+    context: *mut c_void,
+) {
+    unsafe {
+        let sender = (context as *const ConflatingChannelSender<ConflationKey, Sample>)
+            .as_ref()
+            .unwrap_unchecked();
+        let owned_ref: &mut Option<Sample> = std::mem::transmute(sample);
+        sender.send(std::mem::take(owned_ref).unwrap_unchecked());
+    }
+}
+
+#[cfg(feature = "unstable")]
+extern "C" fn __z_conflating_handler_sample_drop(context: *mut c_void) {
+    unsafe {
+        let sender = Box::from_raw(context as *mut ConflatingChannelSender<ConflationKey, Sample>);
+        std::mem::drop(sender);
+    }
+}
+
+#[cfg(feature = "unstable")]
+fn conflation_key(sample: &Sample) -> ConflationKey {
+    (sample.key_expr().clone(), None)
+}
+
+#[cfg(feature = "unstable")]
+fn conflation_key_per_source(sample: &Sample) -> ConflationKey {
+    (
+        sample.key_expr().clone(),
+        sample.source_info().source_id().copied(),
+    )
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs send and recieve ends of a conflating channel, keeping only the latest sample of each key expression.
+///
+/// A sample received while a sample with the same key expression is pending replaces it in place, so a consumer falling
+/// behind reads the current value of each key instead of a backlog of stale samples, and a burst on a single key does not
+/// push out the samples of the other keys, as it would with a ring channel under a wildcard subscription. Samples are
+/// received in the order in which their key became pending. The memory is bounded by the number of distinct keys.
+///
+/// @param callback: An uninitialized memory location where the callback will be constructed.
+/// @param handler: An uninitialized memory location where the handler will be constructed.
+/// @param per_source: If ``true``, samples only replace the pending sample with the same key expression and the same
+/// source id (see `z_source_info_id()`), so that the latest sample of each publisher of a key is kept.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_conflating_channel_sample_new(
+    callback: &mut MaybeUninit<z_owned_closure_sample_t>,
+    handler: &mut MaybeUninit<z_owned_conflating_handler_sample_t>,
+    per_source: bool,
+) {
+    let key: fn(&Sample) -> ConflationKey = if per_source {
+        conflation_key_per_source
+    } else {
+        conflation_key
+    };
+    let (sender, h) = conflating_channel(key);
+    let cb_ptr = Box::into_raw(Box::new(sender)) as *mut libc::c_void;
+    handler.as_rust_type_mut_uninit().write(Some(h));
+    callback.write(z_owned_closure_sample_t {
+        _call: Some(__z_conflating_handler_sample_send),
+        _context: cb_ptr,
+        _drop: Some(__z_conflating_handler_sample_drop),
+    });
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Borrows handler.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_conflating_handler_sample_loan(
+    this: &z_owned_conflating_handler_sample_t,
+) -> &z_loaned_conflating_handler_sample_t {
+    this.as_rust_type_ref()
+        .as_ref()
+        .unwrap_unchecked()
+        .as_loaned_c_type_ref()
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns the oldest pending sample. If there are no pending samples will block until next sample is received, or until
+/// the channel is dropped (normally when there are no more samples to receive).
+/// @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the sample will be in the gravestone state).
+#[no_mangle]
+pub extern "C" fn z_conflating_handler_sample_recv(
+    this: &z_loaned_conflating_handler_sample_t,
+    sample: &mut MaybeUninit<z_owned_sample_t>,
+) -> z_result_t {
+    match this.as_rust_type_ref().recv() {
+        Ok(q) => {
+            sample.as_rust_type_mut_uninit().write(Some(q));
+            result::Z_OK
+        }
+        Err(_) => {
+            sample.as_rust_type_mut_uninit().write(None);
+            result::Z_CHANNEL_DISCONNECTED
+        }
+    }
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns the oldest pending sample. If there are no pending samples will return immediately (with sample set to its gravestone state).
+/// @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the sample will be in the gravestone state),
+/// `Z_CHANNEL_NODATA` if the channel is still alive, but no sample is pending (the sample will be in the gravestone state).
+#[no_mangle]
+pub extern "C" fn z_conflating_handler_sample_try_recv(
+    this: &z_loaned_conflating_handler_sample_t,
+    sample: &mut MaybeUninit<z_owned_sample_t>,
+) -> z_result_t {
+    match this.as_rust_type_ref().try_recv() {
+        Ok(q) => {
+            let r = if q.is_some() {
+                result::Z_OK
+            } else {
+                result::Z_CHANNEL_NODATA
+            };
+            sample.as_rust_type_mut_uninit().write(q);
+            r
+        }
+        Err(_) => {
+            sample.as_rust_type_mut_uninit().write(None);
+            result::Z_CHANNEL_DISCONNECTED
+        }
+    }
+}
+
+#[cfg(feature = "unstable")]
+pub use crate::opaque_types::{
+    z_loaned_priority_handler_sample_t, z_moved_priority_handler_sample_t,
+    z_owned_priority_handler_sample_t,
+};
+#[cfg(feature = "unstable")]
+decl_c_type!(
+    owned(
+        z_owned_priority_handler_sample_t,
+        option PriorityChannelHandler<Sample>,
+    ),
+    loaned(z_loaned_priority_handler_sample_t),
+);
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Drops the handler and resets it to a gravestone state.
+#[no_mangle]
+pub extern "C" fn z_priority_handler_sample_drop(this_: &mut z_moved_priority_handler_sample_t) {
+    let _ = this_.take_rust_type();
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs a handler in gravestone state.
+#[no_mangle]
+pub extern "C" fn z_internal_priority_handler_sample_null(
+    this: &mut MaybeUninit<z_owned_priority_handler_sample_t>,
+) {
+    this.as_rust_type_mut_uninit().write(None);
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns ``true`` if handler is valid, ``false`` if it is in gravestone state.
+#[no_mangle]
+pub extern "C" fn z_internal_priority_handler_sample_check(
+    this_: &z_owned_priority_handler_sample_t,
+) -> bool {
+    this_.as_rust_type_ref().is_some()
+}
+
+#[cfg(feature = "unstable")]
+extern "C" fn __z_priority_handler_sample_send(
+    sample: &mut z_loaned_sample_t,
+    context: *mut c_void,
+) {
+    unsafe {
+        let sender = (context as *const PriorityChannelSender<Sample>)
+            .as_ref()
+            .unwrap_unchecked();
+        let owned_ref: &mut Option<Sample> = std::mem::transmute(sample);
+        sender.send(std::mem::take(owned_ref).unwrap_unchecked());
+    }
+}
+
+#[cfg(feature = "unstable")]
+extern "C" fn __z_priority_handler_sample_drop(context: *mut c_void) {
+    unsafe {
+        let sender = Box::from_raw(context as *mut PriorityChannelSender<Sample>);
+        std::mem::drop(sender);
+    }
+}
+
+#[cfg(feature = "unstable")]
+fn priority_level(sample: &Sample) -> usize {
+    z_priority_t::from(sample.priority()) as usize - z_priority_t::REAL_TIME as usize
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs send and recieve ends of a priority channel, with a bounded queue per sample priority.
+///
+/// Samples are queued according to `z_sample_priority()`, each priority level having its own capacity and overflow
+/// policy, and are received in priority order rather than in order of arrival: a `Z_PRIORITY_REAL_TIME` sample
+/// overtakes the pending `Z_PRIORITY_BACKGROUND` ones, and a burst of low priority samples can only push out samples
+/// of its own level. Samples of the same level are received in order of arrival.
+///
+/// @param callback: An uninitialized memory location where the callback will be constructed.
+/// @param handler: An uninitialized memory location where the handler will be constructed.
+/// @param options: The settings of the priority levels, pass NULL to use the default ones
+/// (see `zc_priority_channel_options_default()`).
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_priority_channel_sample_new(
+    callback: &mut MaybeUninit<z_owned_closure_sample_t>,
+    handler: &mut MaybeUninit<z_owned_priority_handler_sample_t>,
+    options: Option<&zc_priority_channel_options_t>,
+) {
+    let (sender, h) = priority_channel(options.copied().unwrap_or_default(), priority_level);
+    let cb_ptr = Box::into_raw(Box::new(sender)) as *mut libc::c_void;
+    handler.as_rust_type_mut_uninit().write(Some(h));
+    callback.write(z_owned_closure_sample_t {
+        _call: Some(__z_priority_handler_sample_send),
+        _context: cb_ptr,
+        _drop: Some(__z_priority_handler_sample_drop),
+    });
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Borrows handler.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_priority_handler_sample_loan(
+    this: &z_owned_priority_handler_sample_t,
+) -> &z_loaned_priority_handler_sample_t {
+    this.as_rust_type_ref()
+        .as_ref()
+        .unwrap_unchecked()
+        .as_loaned_c_type_ref()
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns the next sample in priority order. If there are no pending samples will block until next sample is
+/// received, or until the channel is dropped (normally when there are no more samples to receive).
+/// @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the sample will be in the gravestone state).
+#[no_mangle]
+pub extern "C" fn z_priority_handler_sample_recv(
+    this: &z_loaned_priority_handler_sample_t,
+    sample: &mut MaybeUninit<z_owned_sample_t>,
+) -> z_result_t {
+    match this.as_rust_type_ref().recv() {
+        Ok(q) => {
+            sample.as_rust_type_mut_uninit().write(Some(q));
+            result::Z_OK
+        }
+        Err(_) => {
+            sample.as_rust_type_mut_uninit().write(None);
+            result::Z_CHANNEL_DISCONNECTED
+        }
+    }
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns the next sample in priority order. If there are no pending samples will return immediately (with sample
+/// set to its gravestone state).
+/// @return 0 in case of success, `Z_CHANNEL_DISCONNECTED` if channel was dropped (the sample will be in the gravestone state),
+/// `Z_CHANNEL_NODATA` if the channel is still alive, but no sample is pending (the sample will be in the gravestone state).
+#[no_mangle]
+pub extern "C" fn z_priority_handler_sample_try_recv(
+    this: &z_loaned_priority_handler_sample_t,
+    sample: &mut MaybeUninit<z_owned_sample_t>,
+) -> z_result_t {
+    match this.as_rust_type_ref().try_recv() {
+        Ok(q) => {
+            let r = if q.is_some() {
+                result::Z_OK
+            } else {
+                result::Z_CHANNEL_NODATA
+            };
+            sample.as_rust_type_mut_uninit().write(q);
+            r
+        }
+        Err(_) => {
+            sample.as_rust_type_mut_uninit().write(None);
+            result::Z_CHANNEL_DISCONNECTED
+        }
+    }
+}
@@ -0,0 +1,209 @@
+//
+// Copyright (c) 2017, 2024 ZettaScale Technology.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh team, <zenoh@zettascale.tech>
+//
+
+use std::{
+    cell::UnsafeCell,
+    mem::MaybeUninit,
+    sync::{
+        atomic::{AtomicBool, AtomicU64, AtomicUsize, Ordering},
+        Arc, Condvar, Mutex, MutexGuard, TryLockError,
+    },
+};
+
+#[repr(align(64))]
+struct CachePadded<T>(T);
+
+/// Bounded single-producer/single-consumer ring buffer.
+///
+/// The producer only writes `tail` and the consumer only writes `head`, both indices are monotonic and
+/// live on their own cache line. The consumer only falls back to the condition variable when the
+/// buffer is empty and it has to block.
+struct SpscRing<T> {
+    head: CachePadded<AtomicUsize>,
+    tail: CachePadded<AtomicUsize>,
+    buffer: Box<[UnsafeCell<MaybeUninit<T>>]>,
+    // Zenoh does not formally guarantee that a callback is never invoked concurrently, so the producer
+    // side is serialized with an (uncontended in practice) spin lock to keep the ring sound.
+    producer: spin::Mutex<()>,
+    // The handler can be shared by several C threads, so the consumer side is serialized as well. It is
+    // held by a blocking receive while it waits, hence a lock parking the other receivers.
+    consumer: Mutex<()>,
+    dropped: AtomicU64,
+    disconnected: AtomicBool,
+    waiting: AtomicBool,
+    lock: Mutex<()>,
+    cv: Condvar,
+}
+
+unsafe impl<T: Send> Send for SpscRing<T> {}
+unsafe impl<T: Send> Sync for SpscRing<T> {}
+
+impl<T> SpscRing<T> {
+    fn new(capacity: usize) -> Self {
+        let capacity = capacity.max(1);
+        SpscRing {
+            head: CachePadded(AtomicUsize::new(0)),
+            tail: CachePadded(AtomicUsize::new(0)),
+            buffer: (0..capacity)
+                .map(|_| UnsafeCell::new(MaybeUninit::uninit()))
+                .collect(),
+            producer: spin::Mutex::new(()),
+            consumer: Mutex::new(()),
+            dropped: AtomicU64::new(0),
+            disconnected: AtomicBool::new(false),
+            waiting: AtomicBool::new(false),
+            lock: Mutex::new(()),
+            cv: Condvar::new(),
+        }
+    }
+
+    /// Pushes a value. Returns `false` (dropping the value) if the ring is full.
+    fn push(&self, value: T) -> bool {
+        let _guard = self.producer.lock();
+        let tail = self.tail.0.load(Ordering::Relaxed);
+        let head = self.head.0.load(Ordering::Acquire);
+        if tail.wrapping_sub(head) == self.buffer.len() {
+            self.dropped.fetch_add(1, Ordering::Relaxed);
+            return false;
+        }
+        unsafe {
+            (*self.buffer[tail % self.buffer.len()].get()).write(value);
+        }
+        self.tail.0.store(tail.wrapping_add(1), Ordering::SeqCst);
+        if self.waiting.load(Ordering::SeqCst) {
+            self.wake();
+        }
+        true
+    }
+
+    /// Pops a value, the consumer lock being held.
+    fn pop(&self, _consumer: &MutexGuard<'_, ()>) -> Option<T> {
+        let head = self.head.0.load(Ordering::Relaxed);
+        let tail = self.tail.0.load(Ordering::SeqCst);
+        if head == tail {
+            return None;
+        }
+        let value = unsafe { (*self.buffer[head % self.buffer.len()].get()).assume_init_read() };
+        self.head.0.store(head.wrapping_add(1), Ordering::Release);
+        Some(value)
+    }
+
+    fn wake(&self) {
+        let _guard = self.lock.lock().unwrap_or_else(|e| e.into_inner());
+        self.cv.notify_one();
+    }
+
+    fn disconnect(&self) {
+        self.disconnected.store(true, Ordering::SeqCst);
+        self.wake();
+    }
+
+    fn lock_consumer(&self) -> MutexGuard<'_, ()> {
+        self.consumer.lock().unwrap_or_else(|e| e.into_inner())
+    }
+
+    fn try_pop(&self, consumer: &MutexGuard<'_, ()>) -> Result<Option<T>, ()> {
+        match self.pop(consumer) {
+            Some(v) => Ok(Some(v)),
+            // re-check after observing the disconnection, so that no value pushed before it is lost
+            None if self.disconnected.load(Ordering::SeqCst) => {
+                self.pop(consumer).map(Some).ok_or(())
+            }
+            None => Ok(None),
+        }
+    }
+
+    /// Returns `Ok(None)` without waiting if another thread is receiving.
+    fn try_recv(&self) -> Result<Option<T>, ()> {
+        let consumer = match self.consumer.try_lock() {
+            Ok(guard) => guard,
+            Err(TryLockError::Poisoned(e)) => e.into_inner(),
+            Err(TryLockError::WouldBlock) => return Ok(None),
+        };
+        self.try_pop(&consumer)
+    }
+
+    fn recv(&self) -> Result<T, ()> {
+        let consumer = self.lock_consumer();
+        loop {
+            if let Some(v) = self.try_pop(&consumer)? {
+                return Ok(v);
+            }
+            let guard = self.lock.lock().unwrap_or_else(|e| e.into_inner());
+            self.waiting.store(true, Ordering::SeqCst);
+            let ready = self.head.0.load(Ordering::Relaxed) != self.tail.0.load(Ordering::SeqCst)
+                || self.disconnected.load(Ordering::SeqCst);
+            if !ready {
+                let _guard = self.cv.wait(guard).unwrap_or_else(|e| e.into_inner());
+            }
+            self.waiting.store(false, Ordering::SeqCst);
+        }
+    }
+}
+
+impl<T> Drop for SpscRing<T> {
+    fn drop(&mut self) {
+        let consumer = self.lock_consumer();
+        while self.pop(&consumer).is_some() {}
+    }
+}
+
+/// The receiving end of a [`SpscRing`].
+pub struct SpscChannelHandler<T> {
+    ring: Arc<SpscRing<T>>,
+}
+
+impl<T> SpscChannelHandler<T> {
+    /// Blocks until a value is received, returns `Err` once the sender is dropped and the ring is drained.
+    pub(crate) fn recv(&self) -> Result<T, ()> {
+        self.ring.recv()
+    }
+
+    /// Returns `Ok(None)` if the ring is empty, `Err` once the sender is dropped and the ring is drained.
+    pub(crate) fn try_recv(&self) -> Result<Option<T>, ()> {
+        self.ring.try_recv()
+    }
+
+    /// Returns the number of values dropped because the ring was full.
+    pub(crate) fn dropped(&self) -> u64 {
+        self.ring.dropped.load(Ordering::Relaxed)
+    }
+}
+
+/// The sending end of a [`SpscRing`], the channel is disconnected when it is dropped.
+pub(crate) struct SpscChannelSender<T> {
+    ring: Arc<SpscRing<T>>,
+}
+
+impl<T> SpscChannelSender<T> {
+    pub(crate) fn send(&self, value: T) {
+        if !self.ring.push(value) {
+            tracing::trace!("spsc channel is full, value dropped");
+        }
+    }
+}
+
+impl<T> Drop for SpscChannelSender<T> {
+    fn drop(&mut self) {
+        self.ring.disconnect();
+    }
+}
+
+pub(crate) fn spsc_channel<T>(capacity: usize) -> (SpscChannelSender<T>, SpscChannelHandler<T>) {
+    let ring = Arc::new(SpscRing::new(capacity));
+    (
+        SpscChannelSender { ring: ring.clone() },
+        SpscChannelHandler { ring },
+    )
+}
@@ -850,3 +850,221 @@ pub extern "C" fn z_string_array_clone(
     dst.as_rust_type_mut_uninit()
         .write(this_.as_rust_type_ref().clone());
 }
+
+#[cfg(feature = "unstable")]
+pub use crate::opaque_types::{
+    zc_loaned_string_arena_t, zc_moved_string_arena_t, zc_owned_string_arena_t,
+};
+
+/// The strings of a `zc_owned_string_arena_t`, each of them null-terminated, packed one after the other in a single
+/// buffer.
+#[cfg(feature = "unstable")]
+#[derive(Default, Clone)]
+pub struct StringArena {
+    data: Vec<u8>,
+    // The end of each string in `data`, past its terminating 0 character.
+    ends: Vec<usize>,
+}
+
+#[cfg(feature = "unstable")]
+impl StringArena {
+    pub fn len(&self) -> usize {
+        self.ends.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.ends.is_empty()
+    }
+
+    /// Reserves room for `additional` more strings of `bytes` bytes in total, excluding their terminating 0 characters.
+    pub fn reserve(&mut self, additional: usize, bytes: usize) {
+        self.data.reserve(bytes.saturating_add(additional));
+        self.ends.reserve(additional);
+    }
+
+    pub fn push(&mut self, s: &[u8]) -> usize {
+        self.data.reserve(s.len() + 1);
+        self.data.extend_from_slice(s);
+        self.data.push(0);
+        self.ends.push(self.data.len());
+        self.ends.len()
+    }
+
+    pub fn get(&self, index: usize) -> Option<&[u8]> {
+        let end = *self.ends.get(index)?;
+        let start = match index {
+            0 => 0,
+            _ => self.ends[index - 1],
+        };
+        Some(&self.data[start..end - 1])
+    }
+
+    pub fn clear(&mut self) {
+        self.data.clear();
+        self.ends.clear();
+    }
+}
+
+#[cfg(feature = "unstable")]
+decl_c_type!(
+    owned(zc_owned_string_arena_t, StringArena),
+    loaned(zc_loaned_string_arena_t),
+);
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs a new empty string arena.
+///
+/// Unlike `z_owned_string_array_t`, which holds a separate allocation per string, a string arena copies all its
+/// strings into a single buffer along with a table of their offsets, so that pushing a string only allocates when the
+/// buffer grows, and the arena is freed at once. It can be reused without allocating with `zc_string_arena_clear()`.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn zc_string_arena_new(this_: &mut MaybeUninit<zc_owned_string_arena_t>) {
+    this_
+        .as_rust_type_mut_uninit()
+        .write(StringArena::default());
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs string arena in its gravestone state.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn zc_internal_string_arena_null(this_: &mut MaybeUninit<zc_owned_string_arena_t>) {
+    zc_string_arena_new(this_)
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @return ``true`` if the string arena is valid, ``false`` if it is in a gravestone state.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn zc_internal_string_arena_check(this_: &zc_owned_string_arena_t) -> bool {
+    !this_.as_rust_type_ref().is_empty()
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Destroys the string arena and all its strings, resetting it to its gravestone value.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn zc_string_arena_drop(this_: &mut zc_moved_string_arena_t) {
+    let _ = this_.take_rust_type();
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Borrows string arena.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn zc_string_arena_loan(
+    this_: &zc_owned_string_arena_t,
+) -> &zc_loaned_string_arena_t {
+    this_.as_rust_type_ref().as_loaned_c_type_ref()
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Mutably borrows string arena.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn zc_string_arena_loan_mut(
+    this_: &mut zc_owned_string_arena_t,
+) -> &mut zc_loaned_string_arena_t {
+    this_.as_rust_type_mut().as_loaned_c_type_mut()
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs an owned copy of a string arena, in a single buffer.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn zc_string_arena_clone(
+    dst: &mut MaybeUninit<zc_owned_string_arena_t>,
+    this_: &zc_loaned_string_arena_t,
+) {
+    dst.as_rust_type_mut_uninit()
+        .write(this_.as_rust_type_ref().clone());
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Reserves room in the string arena for at least `additional` more strings of `additional_bytes` bytes in
+/// total, so that pushing them does not allocate.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn zc_string_arena_reserve(
+    this_: &mut zc_loaned_string_arena_t,
+    additional: usize,
+    additional_bytes: usize,
+) {
+    this_
+        .as_rust_type_mut()
+        .reserve(additional, additional_bytes);
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Appends a copy of the specified string to the end of the string arena.
+///
+/// Pushing may move the buffer of the arena, invalidating the views previously obtained with `zc_string_arena_get()`.
+///
+/// @return the new length of the arena.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn zc_string_arena_push(
+    this_: &mut zc_loaned_string_arena_t,
+    value: &z_loaned_string_t,
+) -> usize {
+    this_
+        .as_rust_type_mut()
+        .push(value.as_rust_type_ref().slice())
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs a view of a string of the string arena.
+///
+/// The view data is null-terminated, so that it can be passed as a C string. The view aliases the buffer of the
+/// arena, so it is only valid until the arena is modified or dropped.
+///
+/// @param this_: The string arena.
+/// @param index: The index of the string, less than `zc_string_arena_len(this_)`.
+/// @param str: An uninitialized memory location where the view will be constructed.
+/// @return 0 in case of success, `Z_EINVAL` if `index` is out of bounds, in which case an empty view is constructed.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn zc_string_arena_get(
+    this_: &zc_loaned_string_arena_t,
+    index: usize,
+    str: &mut MaybeUninit<z_view_string_t>,
+) -> z_result_t {
+    let str = str.as_rust_type_mut_uninit();
+    match this_.as_rust_type_ref().get(index) {
+        Some(s) => {
+            str.write(CStringView::new_borrowed_from_slice(s));
+            result::Z_OK
+        }
+        None => {
+            str.write(CStringView::default());
+            result::Z_EINVAL
+        }
+    }
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @return number of strings in the string arena.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn zc_string_arena_len(this_: &zc_loaned_string_arena_t) -> usize {
+    this_.as_rust_type_ref().len()
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @return ``true`` if the string arena is empty, ``false`` otherwise.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn zc_string_arena_is_empty(this_: &zc_loaned_string_arena_t) -> bool {
+    this_.as_rust_type_ref().is_empty()
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Removes all strings from the string arena, keeping its buffer allocated for reuse.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn zc_string_arena_clear(this_: &mut zc_loaned_string_arena_t) {
+    this_.as_rust_type_mut().clear();
+}
@@ -21,6 +21,7 @@ use zenoh::{
     query::ReplyKeyExpr,
     sample::{Locality, SourceInfo},
     session::EntityGlobalId,
+    time::{TimestampId, NTP64},
 };
 use zenoh::{
     qos::{CongestionControl, Priority},
@@ -84,6 +85,34 @@ pub extern "C" fn z_timestamp_new(
     result::Z_OK
 }
 
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Creates a timestamp from the session id without going through the session clock.
+///
+/// The time is extrapolated from the CPU counter calibrated with `zc_clock_tsc_calibrate()`, or from the monotonic
+/// clock if it is not calibrated, so that neither a lock nor a system clock read is needed, e.g. to timestamp each
+/// message of a high-rate publisher. The timestamps are strictly increasing across the process, but unlike the ones of
+/// `z_timestamp_new()` they are not updated from the timestamps received by the session, and they do not follow the
+/// adjustments of the system clock made after the first call or the calibration.
+///
+/// @param this_: An uninitialized memory location where the timestamp will be written.
+/// @param session: The session whose id is used for the timestamp.
+/// @return 0 in case of success, negative error code otherwise.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn zc_timestamp_new_fast(
+    this_: &mut MaybeUninit<z_timestamp_t>,
+    session: &z_loaned_session_t,
+) -> result::z_result_t {
+    // `z_id_t` holds the little-endian bytes of the id, the layout of a `TimestampId`.
+    let zid: z_id_t = session.as_rust_type_ref().zid().into_c_type();
+    let Ok(id) = TimestampId::try_from(&zid.id[..]) else {
+        return result::Z_EGENERIC;
+    };
+    let timestamp = Timestamp::new(NTP64(crate::platform::fast_ntp64_now()), id);
+    this_.as_rust_type_mut_uninit().write(timestamp);
+    result::Z_OK
+}
+
 /// Returns NPT64 time associated with this timestamp.
 #[no_mangle]
 pub extern "C" fn z_timestamp_ntp64_time(this_: &z_timestamp_t) -> u64 {
@@ -201,6 +230,67 @@ pub extern "C" fn z_sample_reliability(this_: &z_loaned_sample_t) -> z_reliabili
     this_.as_rust_type_ref().reliability().into()
 }
 
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief The most frequently read fields of a sample, filled at once by `zc_sample_get_fields()`.
+///
+/// The pointers borrow from the sample and are valid as long as it is.
+#[cfg(feature = "unstable")]
+#[repr(C)]
+pub struct zc_sample_fields_t {
+    /// The key expression of the sample.
+    pub keyexpr: *const z_loaned_keyexpr_t,
+    /// The payload of the sample.
+    pub payload: *const z_loaned_bytes_t,
+    /// The encoding of the payload.
+    pub encoding: *const z_loaned_encoding_t,
+    /// The timestamp of the sample, `NULL` if it has none.
+    pub timestamp: *const z_timestamp_t,
+    /// The attachment of the sample, `NULL` if it has none.
+    pub attachment: *const z_loaned_bytes_t,
+    /// The sample kind.
+    pub kind: z_sample_kind_t,
+    /// The qos priority of the sample.
+    pub priority: z_priority_t,
+    /// The qos congestion control of the sample.
+    pub congestion_control: z_congestion_control_t,
+    /// Whether the qos express flag of the sample was set.
+    pub express: bool,
+    /// The reliability the sample was delivered with.
+    pub reliability: z_reliability_t,
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Reads the most frequently used fields of a sample with a single call.
+///
+/// This is equivalent to calling `z_sample_keyexpr()`, `z_sample_payload()`, `z_sample_encoding()`,
+/// `z_sample_timestamp()`, `z_sample_attachment()`, `z_sample_kind()`, `z_sample_priority()`,
+/// `z_sample_congestion_control()`, `z_sample_express()` and `z_sample_reliability()`, so that callbacks reading
+/// several fields of each sample pay for one call into the library, the fields themselves being plain loads.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn zc_sample_get_fields(
+    this_: &z_loaned_sample_t,
+    fields: &mut MaybeUninit<zc_sample_fields_t>,
+) {
+    let sample = this_.as_rust_type_ref();
+    fields.write(zc_sample_fields_t {
+        keyexpr: sample.key_expr().as_loaned_c_type_ref(),
+        payload: sample.payload().as_loaned_c_type_ref(),
+        encoding: sample.encoding().as_loaned_c_type_ref(),
+        timestamp: sample
+            .timestamp()
+            .map_or(null(), |t| t.as_ctype_ref() as *const _),
+        attachment: sample
+            .attachment()
+            .map_or(null(), |a| a.as_loaned_c_type_ref() as *const _),
+        kind: sample.kind().into(),
+        priority: sample.priority().into(),
+        congestion_control: sample.congestion_control().into(),
+        express: sample.express(),
+        reliability: sample.reliability().into(),
+    });
+}
+
 /// Returns ``true`` if sample is valid, ``false`` if it is in gravestone state.
 #[no_mangle]
 pub extern "C" fn z_internal_sample_check(this_: &z_owned_sample_t) -> bool {
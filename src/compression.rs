@@ -0,0 +1,203 @@
+//
+// Copyright (c) 2024 ZettaScale Technology.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh team, <zenoh@zettascale.tech>
+//
+
+use std::{borrow::Cow, cell::RefCell, mem::MaybeUninit};
+
+use zenoh::bytes::{Encoding, ZBytes};
+
+use crate::{
+    result::{self, z_result_t},
+    transmute::RustTypeRef,
+    z_loaned_sample_t, z_view_slice_from_buf, z_view_slice_t,
+};
+
+// The schema marking a compressed payload, prepended to the schema of its encoding.
+const LZ4_SCHEMA: &str = "zc-lz4";
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief The compression algorithm of a payload.
+#[repr(C)]
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub enum zc_compression_t {
+    /// The payload is not compressed.
+    NONE = 0,
+    /// The payload is compressed with LZ4, prefixed with its uncompressed length as a 32-bit little-endian integer.
+    LZ4 = 1,
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Settings of the payload compression of a publisher.
+///
+/// A compressed payload is marked by prepending `zc-lz4` to the schema of its encoding, e.g. `application/json`
+/// becomes `application/json;zc-lz4` and `application/protobuf;my.Message` becomes
+/// `application/protobuf;zc-lz4:my.Message`, so that subscribers can tell compressed payloads apart with
+/// `zc_sample_compression()` and decompress them with `zc_sample_payload_decompressed()`.
+#[repr(C)]
+#[derive(Clone, Copy, Debug)]
+pub struct zc_publisher_compression_options_t {
+    /// The compression algorithm, `NONE` to send payloads as they are.
+    pub algorithm: zc_compression_t,
+    /// The minimal size of the payloads to compress, smaller ones being sent as they are. A payload is also sent
+    /// as it is if it does not get smaller once compressed.
+    pub min_size: usize,
+}
+
+impl Default for zc_publisher_compression_options_t {
+    fn default() -> Self {
+        Self {
+            algorithm: zc_compression_t::NONE,
+            min_size: 1024,
+        }
+    }
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs the default value for `zc_publisher_compression_options_t`, which disables compression.
+#[no_mangle]
+pub extern "C" fn zc_publisher_compression_options_default(
+    this_: &mut MaybeUninit<zc_publisher_compression_options_t>,
+) {
+    this_.write(zc_publisher_compression_options_t::default());
+}
+
+impl zc_publisher_compression_options_t {
+    /// Returns `None` if compression is disabled.
+    pub(crate) fn enabled(self) -> Option<Self> {
+        (self.algorithm != zc_compression_t::NONE).then_some(self)
+    }
+
+    /// Returns the compressed payload, or `None` if it should be sent as it is.
+    pub(crate) fn compress(&self, payload: &ZBytes) -> Option<ZBytes> {
+        if self.algorithm == zc_compression_t::NONE || payload.len() < self.min_size {
+            return None;
+        }
+        if u32::try_from(payload.len()).is_err() {
+            return None;
+        }
+        let input = payload.to_bytes();
+        let compressed = lz4_flex::compress_prepend_size(&input);
+        (compressed.len() < input.len()).then(|| ZBytes::from(compressed))
+    }
+}
+
+/// Returns the encoding marking a payload of the encoding `encoding` as compressed.
+pub(crate) fn compressed_encoding(encoding: &Encoding) -> Encoding {
+    let s: Cow<str> = encoding.into();
+    let marked = match s.split_once(';') {
+        Some((id, schema)) => format!("{id};{LZ4_SCHEMA}:{schema}"),
+        None => format!("{s};{LZ4_SCHEMA}"),
+    };
+    Encoding::from(marked)
+}
+
+fn compression_of(encoding: &Encoding) -> zc_compression_t {
+    let s: Cow<str> = encoding.into();
+    match s.split_once(';') {
+        Some((_, schema))
+            if schema
+                .strip_prefix(LZ4_SCHEMA)
+                .is_some_and(|rest| rest.is_empty() || rest.starts_with(':')) =>
+        {
+            zc_compression_t::LZ4
+        }
+        _ => zc_compression_t::NONE,
+    }
+}
+
+thread_local! {
+    // The contiguous copy of a fragmented compressed payload, and the last decompressed payload of the thread.
+    static INPUT: RefCell<Vec<u8>> = const { RefCell::new(Vec::new()) };
+    static OUTPUT: RefCell<Vec<u8>> = const { RefCell::new(Vec::new()) };
+}
+
+fn decompress_lz4(input: &[u8], output: &mut Vec<u8>) -> Result<(), ()> {
+    if input.len() < 4 {
+        return Err(());
+    }
+    let (len, input) = input.split_at(4);
+    let len = u32::from_le_bytes([len[0], len[1], len[2], len[3]]) as usize;
+    // LZ4 does not expand data more than 255 times, so a larger length is not trusted before allocating the output.
+    if len > input.len().saturating_mul(255) {
+        return Err(());
+    }
+    output.resize(len, 0);
+    match lz4_flex::decompress_into(input, output) {
+        Ok(n) if n == len => Ok(()),
+        _ => Err(()),
+    }
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns the compression algorithm of the payload of a sample, according to its encoding.
+#[no_mangle]
+pub extern "C" fn zc_sample_compression(this_: &z_loaned_sample_t) -> zc_compression_t {
+    compression_of(this_.as_rust_type_ref().encoding())
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs a view on the decompressed payload of a sample.
+///
+/// A compressed payload is decompressed into a buffer of the calling thread, which is reused by the next call, so that
+/// no memory is allocated once it is large enough. The view is then only valid until the next call to this function
+/// from the same thread. A payload that is not compressed is viewed in place if it is contiguous, the view being valid
+/// as long as the sample, or copied into the buffer of the thread otherwise.
+///
+/// @param this_: The sample.
+/// @param payload: An uninitialized memory location where the view is constructed.
+/// @return 0 in case of success, `Z_EDESERIALIZE` if the payload can not be decompressed, in which case an empty view
+/// is constructed.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn zc_sample_payload_decompressed(
+    this_: &z_loaned_sample_t,
+    payload: &mut MaybeUninit<z_view_slice_t>,
+) -> z_result_t {
+    let sample = this_.as_rust_type_ref();
+    let bytes = sample.payload();
+    let compression = compression_of(sample.encoding());
+    let mut slices = bytes.slices();
+    let contiguous = match (slices.next(), slices.next()) {
+        (None, _) => Some(&[][..]),
+        (Some(slice), None) => Some(slice),
+        _ => None,
+    };
+    if let (zc_compression_t::NONE, Some(slice)) = (compression, contiguous) {
+        return z_view_slice_from_buf(payload, slice.as_ptr(), slice.len());
+    }
+    OUTPUT.with_borrow_mut(|output| {
+        let decompressed = match compression {
+            zc_compression_t::NONE => {
+                output.clear();
+                bytes.slices().for_each(|s| output.extend_from_slice(s));
+                Ok(())
+            }
+            zc_compression_t::LZ4 => match contiguous {
+                Some(input) => decompress_lz4(input, output),
+                None => INPUT.with_borrow_mut(|input| {
+                    input.clear();
+                    bytes.slices().for_each(|s| input.extend_from_slice(s));
+                    decompress_lz4(input, output)
+                }),
+            },
+        };
+        match decompressed {
+            Ok(()) => z_view_slice_from_buf(payload, output.as_ptr(), output.len()),
+            Err(()) => {
+                tracing::error!("Failed to decompress the payload of the sample");
+                z_view_slice_from_buf(payload, std::ptr::null(), 0);
+                result::Z_EDESERIALIZE
+            }
+        }
+    })
+}
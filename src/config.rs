@@ -21,6 +21,8 @@ use crate::{
     transmute::{LoanedCTypeRef, RustTypeRef, RustTypeRefUninit, TakeRustType},
     z_internal_string_null, z_owned_string_t, z_string_copy_from_substr,
 };
+#[cfg(feature = "unstable")]
+use crate::{z_owned_slice_t, z_slice_empty, CSliceOwned};
 
 #[no_mangle]
 pub static Z_ROUTER: c_uint = WhatAmI::Router as c_uint;
@@ -287,6 +289,92 @@ pub unsafe extern "C" fn zc_config_to_string(
     }
 }
 
+// The prefix of the binary form of a configuration, followed by the length and the string of the zenoh-c version.
+#[cfg(feature = "unstable")]
+const CONFIG_BLOB_MAGIC: &[u8; 5] = b"ZCFG\x01";
+
+#[cfg(feature = "unstable")]
+fn config_blob_header() -> Vec<u8> {
+    let version = env!("CARGO_PKG_VERSION").as_bytes();
+    let mut header = Vec::with_capacity(CONFIG_BLOB_MAGIC.len() + 1 + version.len());
+    header.extend_from_slice(CONFIG_BLOB_MAGIC);
+    header.push(version.len() as u8);
+    header.extend_from_slice(version);
+    header
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Serializes a configuration into a binary blob, which can be loaded back with `zc_config_from_blob()`.
+///
+/// The blob holds the configuration as compact JSON, which is parsed much faster than JSON5. It is meant to be
+/// produced once, e.g. when deploying an application, and loaded by each of its short-lived processes instead of
+/// parsing a JSON5 configuration. A blob can only be loaded by the version of zenoh-c which produced it.
+///
+/// @param this_: The configuration.
+/// @param blob: An uninitialized memory location where the blob will be constructed.
+/// @return 0 in case of success, negative error code otherwise.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn zc_config_to_blob(
+    this_: &z_loaned_config_t,
+    blob: &mut MaybeUninit<z_owned_slice_t>,
+) -> result::z_result_t {
+    let mut data = config_blob_header();
+    match serde_json::to_writer(&mut data, this_.as_rust_type_ref()) {
+        Ok(()) => {
+            blob.as_rust_type_mut_uninit()
+                .write(CSliceOwned::from(data));
+            result::Z_OK
+        }
+        Err(e) => {
+            tracing::error!("Failed to serialize the config: {}", e);
+            z_slice_empty(blob);
+            result::Z_EGENERIC
+        }
+    }
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs a configuration from a blob produced by `zc_config_to_blob()`.
+///
+/// @param this_: An uninitialized memory location where the configuration will be constructed.
+/// @param data: A pointer to the blob.
+/// @param len: The length of the blob.
+/// @return 0 in case of success, `Z_EINVAL` if the blob was not produced by this version of zenoh-c, `Z_EPARSE` if it is
+/// corrupted.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn zc_config_from_blob(
+    this_: &mut MaybeUninit<z_owned_config_t>,
+    data: *const u8,
+    len: usize,
+) -> result::z_result_t {
+    let this = this_.as_rust_type_mut_uninit();
+    if data.is_null() {
+        this.write(None);
+        return result::Z_EINVAL;
+    }
+    let data = from_raw_parts(data, len);
+    let header = config_blob_header();
+    let Some(json) = data.strip_prefix(header.as_slice()) else {
+        tracing::error!("The config blob was not produced by this version of zenoh-c");
+        this.write(None);
+        return result::Z_EINVAL;
+    };
+    match serde_json::from_slice::<Config>(json) {
+        Ok(config) => {
+            this.write(Some(config));
+            result::Z_OK
+        }
+        Err(e) => {
+            tracing::error!("Failed to load the config blob: {}", e);
+            this.write(None);
+            result::Z_EPARSE
+        }
+    }
+}
+
 /// Constructs a configuration by parsing a file at `path`. Currently supported format is JSON5, a superset of JSON.
 ///
 /// Returns 0 in case of success, negative error code otherwise.
@@ -0,0 +1,109 @@
+//
+// Copyright (c) 2024 ZettaScale Technology.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh team, <zenoh@zettascale.tech>
+//
+
+use std::{
+    collections::HashMap,
+    sync::{Arc, Mutex},
+    time::Duration,
+};
+
+use lazy_static::lazy_static;
+use zenoh::session::ZenohId;
+
+use crate::{result, transmute::RustTypeRef, z_loaned_session_t};
+
+type Task = Box<dyn FnOnce() + Send>;
+
+/// The queue of the callbacks of a session opened with `deferred_callbacks`, run by `zc_session_poll()`.
+pub(crate) struct Deferred {
+    tx: flume::Sender<Task>,
+    rx: flume::Receiver<Task>,
+}
+
+lazy_static! {
+    // Sessions are unregistered when dropped, the queue is dropped with the last entity holding it.
+    static ref DEFERRED: Mutex<HashMap<ZenohId, Arc<Deferred>>> = Mutex::new(HashMap::new());
+}
+
+impl Deferred {
+    /// Queues `f` to be run by the next call to `zc_session_poll()`.
+    pub(crate) fn defer(&self, f: impl FnOnce() + Send + 'static) {
+        // The receiver is owned by the queue, so sending never fails.
+        let _ = self.tx.send(Box::new(f));
+    }
+
+    /// The queue of the callbacks of a session, if they are deferred.
+    pub(crate) fn of_session(zid: ZenohId) -> Option<Arc<Deferred>> {
+        DEFERRED
+            .lock()
+            .unwrap_or_else(|e| e.into_inner())
+            .get(&zid)
+            .cloned()
+    }
+}
+
+/// Defers the callbacks of the entities declared through a session, which was just opened.
+pub(crate) fn defer_session_callbacks(zid: ZenohId) {
+    let (tx, rx) = flume::unbounded();
+    DEFERRED
+        .lock()
+        .unwrap_or_else(|e| e.into_inner())
+        .insert(zid, Arc::new(Deferred { tx, rx }));
+}
+
+/// Unregisters the queue of a session, which is about to be dropped.
+pub(crate) fn forget_session(zid: ZenohId) {
+    DEFERRED
+        .lock()
+        .unwrap_or_else(|e| e.into_inner())
+        .remove(&zid);
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Runs the callbacks received by a session opened with `z_open_options_t::deferred_callbacks`, on the calling
+/// thread.
+///
+/// Waits up to `timeout_ms` for a sample or a query, then runs the callbacks of all samples and queries received so
+/// far. Callbacks queued while they run are left for the next call, so that a busy session can not hold the calling
+/// thread forever.
+///
+/// @param this_: The session.
+/// @param timeout_ms: The maximum time to wait for a callback in milliseconds, 0 to return immediately.
+/// @return 0 if callbacks were run, `Z_CHANNEL_NODATA` if none was received before `timeout_ms`, `Z_EUNAVAILABLE` if the
+/// session does not defer its callbacks.
+#[no_mangle]
+pub extern "C" fn zc_session_poll(
+    this_: &z_loaned_session_t,
+    timeout_ms: u32,
+) -> result::z_result_t {
+    let Some(deferred) = Deferred::of_session(this_.as_rust_type_ref().zid()) else {
+        return result::Z_EUNAVAILABLE;
+    };
+    let first = match timeout_ms {
+        0 => deferred.rx.try_recv().ok(),
+        ms => deferred
+            .rx
+            .recv_timeout(Duration::from_millis(ms as u64))
+            .ok(),
+    };
+    let Some(first) = first else {
+        return result::Z_CHANNEL_NODATA;
+    };
+    let pending = deferred.rx.len();
+    first();
+    for task in deferred.rx.try_iter().take(pending) {
+        task();
+    }
+    result::Z_OK
+}
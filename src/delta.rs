@@ -0,0 +1,328 @@
+//
+// Copyright (c) 2024 ZettaScale Technology.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh team, <zenoh@zettascale.tech>
+//
+
+use std::{
+    borrow::Cow,
+    collections::{hash_map::DefaultHasher, HashMap},
+    hash::{Hash, Hasher},
+    mem::MaybeUninit,
+    sync::{Mutex, MutexGuard},
+};
+
+use zenoh::{
+    bytes::{Encoding, ZBytes},
+    internal::traits::{
+        EncodingBuilderTrait, QoSBuilderTrait, SampleBuilderTrait, TimestampBuilderTrait,
+    },
+    sample::{Sample, SampleBuilder, SampleKind},
+    session::EntityGlobalId,
+};
+
+// The schema marking a delta-encoded payload, prepended to the schema of its encoding.
+const DELTA_SCHEMA: &str = "zc-delta";
+
+// The kind of a frame, its first byte.
+const KEYFRAME: u8 = 0;
+const DELTA: u8 = 1;
+// The header of a frame: its kind, the stream of the publisher as a 64-bit integer, and the sequence number of the
+// keyframe as a 32-bit integer, all little-endian.
+const HEADER_LEN: usize = 13;
+// The header of a run of a delta: its offset and length as 32-bit little-endian integers.
+const RUN_HEADER_LEN: usize = 8;
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Settings of the delta mode of a publisher.
+///
+/// In delta mode, the publisher periodically sends its payload in full as a keyframe, and sends the payloads put in
+/// between as the bytes differing from the last keyframe. A delta is sent as a keyframe if it would not be smaller than
+/// the payload. Since each delta only depends on the last keyframe, a subscriber which misses deltas rebuilds the
+/// following ones, and one which misses a keyframe drops the deltas up to the next one.
+///
+/// The payloads are marked by prepending `zc-delta` to the schema of their encoding, like the compressed ones, and
+/// rebuilt by the subscribers declared with `z_subscriber_options_t::delta_decoding` before their callback runs.
+/// Payload compression is not applied in delta mode. With an advanced publisher, the cache should hold at least
+/// `keyframe_interval` samples, so that the history retrieved by late joiners starts with a keyframe.
+///
+/// Concurrent puts on a publisher in delta mode are sent one at a time, so that no delta is sent before its keyframe.
+/// Hence the callbacks of subscribers of the same session receiving them must not put on this publisher.
+#[repr(C)]
+#[derive(Clone, Copy, Debug)]
+pub struct zc_publisher_delta_options_t {
+    /// Must be set to ``true``, to enable the delta mode.
+    pub is_enabled: bool,
+    /// The number of payloads put from a keyframe to the next one, 0 or 1 to only send keyframes.
+    pub keyframe_interval: usize,
+}
+
+impl Default for zc_publisher_delta_options_t {
+    fn default() -> Self {
+        Self {
+            is_enabled: false,
+            keyframe_interval: 16,
+        }
+    }
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs the default value for `zc_publisher_delta_options_t`, which disables the delta mode.
+#[no_mangle]
+pub extern "C" fn zc_publisher_delta_options_default(
+    this_: &mut MaybeUninit<zc_publisher_delta_options_t>,
+) {
+    this_.write(zc_publisher_delta_options_t::default());
+}
+
+/// Returns the encoding marking a payload of the encoding `encoding` as delta-encoded.
+fn delta_encoding(encoding: &Encoding) -> Encoding {
+    let s: Cow<str> = encoding.into();
+    let marked = match s.split_once(';') {
+        Some((id, schema)) => format!("{id};{DELTA_SCHEMA}:{schema}"),
+        None => format!("{s};{DELTA_SCHEMA}"),
+    };
+    Encoding::from(marked)
+}
+
+/// Returns the encoding of a delta-encoded payload before it was marked, or `None` if it is not delta-encoded.
+fn unmarked_encoding(encoding: &Encoding) -> Option<Encoding> {
+    let s: Cow<str> = encoding.into();
+    let (id, schema) = s.split_once(';')?;
+    match schema.strip_prefix(DELTA_SCHEMA)? {
+        "" => Some(Encoding::from(id.to_string())),
+        rest => Some(Encoding::from(format!("{id};{}", rest.strip_prefix(':')?))),
+    }
+}
+
+fn write_header(out: &mut Vec<u8>, kind: u8, stream: u64, keyframe: u32) {
+    out.push(kind);
+    out.extend_from_slice(&stream.to_le_bytes());
+    out.extend_from_slice(&keyframe.to_le_bytes());
+}
+
+/// Appends to `out` the runs of `target` differing from `base`, merging the runs separated by fewer equal bytes than a
+/// run header. Returns `false` as soon as `out` grows past `limit` bytes.
+fn diff(base: &[u8], target: &[u8], out: &mut Vec<u8>, limit: usize) -> bool {
+    let common = base.len().min(target.len());
+    let equal = |i: usize| i < common && base[i] == target[i];
+    let mut i = 0;
+    while i < target.len() {
+        if equal(i) {
+            i += 1;
+            continue;
+        }
+        let start = i;
+        let mut end = i;
+        while end < target.len() {
+            if !equal(end) {
+                end += 1;
+                continue;
+            }
+            let mut gap = end;
+            while gap < target.len() && equal(gap) && gap - end < RUN_HEADER_LEN {
+                gap += 1;
+            }
+            if gap == target.len() || gap - end == RUN_HEADER_LEN {
+                break;
+            }
+            end = gap;
+        }
+        if out.len() + RUN_HEADER_LEN + end - start > limit {
+            return false;
+        }
+        out.extend_from_slice(&(start as u32).to_le_bytes());
+        out.extend_from_slice(&((end - start) as u32).to_le_bytes());
+        out.extend_from_slice(&target[start..end]);
+        i = end;
+    }
+    true
+}
+
+/// Returns the payload rebuilt from the runs of a delta applied to `base`, or `None` if the delta is malformed.
+fn patch(base: &[u8], delta: &[u8]) -> Option<Vec<u8>> {
+    let read_u32 = |b: &[u8], at: usize| -> Option<usize> {
+        let b = b.get(at..at + 4)?;
+        Some(u32::from_le_bytes([b[0], b[1], b[2], b[3]]) as usize)
+    };
+    let len = read_u32(delta, 0)?;
+    // The runs can only extend the keyframe by the bytes they carry, so a larger length is not trusted before
+    // allocating the payload.
+    if len > base.len().saturating_add(delta.len()) {
+        return None;
+    }
+    let mut payload = base[..base.len().min(len)].to_vec();
+    payload.resize(len, 0);
+    let mut at = 4;
+    while at < delta.len() {
+        let offset = read_u32(delta, at)?;
+        let run = read_u32(delta, at + 4)?;
+        let bytes = delta.get(at + RUN_HEADER_LEN..at + RUN_HEADER_LEN + run)?;
+        payload
+            .get_mut(offset..offset + run)?
+            .copy_from_slice(bytes);
+        at += RUN_HEADER_LEN + run;
+    }
+    Some(payload)
+}
+
+#[derive(Default)]
+struct EncoderState {
+    keyframe: Vec<u8>,
+    seq: u32,
+    // The number of payloads sent since the last keyframe included, 0 before the first keyframe.
+    sent: usize,
+}
+
+/// The state of the delta mode of a publisher.
+pub(crate) struct DeltaEncoder {
+    stream: u64,
+    keyframe_interval: usize,
+    // The marked encoding of the publisher.
+    encoding: Encoding,
+    state: Mutex<EncoderState>,
+}
+
+impl DeltaEncoder {
+    /// Returns `None` if the delta mode is disabled.
+    pub(crate) fn new(
+        options: &zc_publisher_delta_options_t,
+        id: EntityGlobalId,
+        encoding: &Encoding,
+    ) -> Option<Self> {
+        if !options.is_enabled {
+            return None;
+        }
+        let mut hasher = DefaultHasher::new();
+        id.hash(&mut hasher);
+        Some(DeltaEncoder {
+            stream: hasher.finish(),
+            keyframe_interval: options.keyframe_interval,
+            encoding: delta_encoding(encoding),
+            state: Mutex::new(EncoderState::default()),
+        })
+    }
+
+    fn lock(&self) -> MutexGuard<'_, EncoderState> {
+        self.state.lock().unwrap_or_else(|e| e.into_inner())
+    }
+
+    /// Calls `send` with the keyframe or delta sent in place of `payload`, returning its result.
+    ///
+    /// A delta refers to the last keyframe encoded before it, so `send` runs under the lock of the encoder: the
+    /// keyframes and deltas are sent in the order in which they are encoded, even when putting concurrently.
+    pub(crate) fn encode_with<R>(&self, payload: &ZBytes, send: impl FnOnce(ZBytes) -> R) -> R {
+        let input = payload.to_bytes();
+        let mut state = self.lock();
+        let mut out = Vec::new();
+        if state.sent != 0
+            && state.sent < self.keyframe_interval
+            && input.len() <= u32::MAX as usize
+        {
+            out.reserve(input.len());
+            write_header(&mut out, DELTA, self.stream, state.seq);
+            out.extend_from_slice(&(input.len() as u32).to_le_bytes());
+            if diff(&state.keyframe, &input, &mut out, input.len()) && out.len() < input.len() {
+                state.sent += 1;
+                return send(out.into());
+            }
+            out.clear();
+        }
+        state.seq = state.seq.wrapping_add(1);
+        state.sent = 1;
+        state.keyframe.clear();
+        state.keyframe.extend_from_slice(&input);
+        out.reserve(HEADER_LEN + input.len());
+        write_header(&mut out, KEYFRAME, self.stream, state.seq);
+        out.extend_from_slice(&input);
+        send(out.into())
+    }
+
+    /// Returns the encoding of a payload put with `encoding`, the publisher encoding if `None`.
+    pub(crate) fn encoding(&self, encoding: Option<Encoding>) -> Encoding {
+        match encoding {
+            Some(encoding) => delta_encoding(&encoding),
+            None => self.encoding.clone(),
+        }
+    }
+}
+
+/// The last keyframe received from each publisher by a subscriber.
+#[derive(Default)]
+pub(crate) struct DeltaDecoder {
+    keyframes: Mutex<HashMap<u64, (u32, Vec<u8>)>>,
+}
+
+impl DeltaDecoder {
+    fn lock(&self) -> MutexGuard<'_, HashMap<u64, (u32, Vec<u8>)>> {
+        self.keyframes.lock().unwrap_or_else(|e| e.into_inner())
+    }
+
+    /// Returns the sample with its payload rebuilt if it is delta-encoded, or `None` if it can not be rebuilt, e.g.
+    /// because its keyframe was missed.
+    pub(crate) fn decode(&self, sample: Sample) -> Option<Sample> {
+        if sample.kind() != SampleKind::Put {
+            return Some(sample);
+        }
+        let Some(encoding) = unmarked_encoding(sample.encoding()) else {
+            return Some(sample);
+        };
+        let input = sample.payload().to_bytes();
+        if input.len() < HEADER_LEN {
+            tracing::error!("Failed to decode the delta-encoded payload of the sample");
+            return None;
+        }
+        let (header, body) = input.split_at(HEADER_LEN);
+        let mut stream = [0u8; 8];
+        stream.copy_from_slice(&header[1..9]);
+        let stream = u64::from_le_bytes(stream);
+        let seq = u32::from_le_bytes([header[9], header[10], header[11], header[12]]);
+        let payload = match header[0] {
+            KEYFRAME => {
+                self.lock().insert(stream, (seq, body.to_vec()));
+                body.to_vec()
+            }
+            DELTA => {
+                let keyframes = self.lock();
+                match keyframes.get(&stream) {
+                    Some((keyframe_seq, keyframe)) if *keyframe_seq == seq => {
+                        match patch(keyframe, body) {
+                            Some(payload) => payload,
+                            None => {
+                                tracing::error!("Failed to decode the delta of the sample");
+                                return None;
+                            }
+                        }
+                    }
+                    _ => {
+                        tracing::debug!("Dropping a delta of a missed keyframe");
+                        return None;
+                    }
+                }
+            }
+            _ => {
+                tracing::error!("Failed to decode the delta-encoded payload of the sample");
+                return None;
+            }
+        };
+        Some(
+            SampleBuilder::put(sample.key_expr().clone(), payload)
+                .encoding(encoding)
+                .timestamp(sample.timestamp().copied())
+                .attachment(sample.attachment().cloned())
+                .source_info(sample.source_info().clone())
+                .congestion_control(sample.congestion_control())
+                .priority(sample.priority())
+                .express(sample.express())
+                .into(),
+        )
+    }
+}
@@ -0,0 +1,182 @@
+//
+// Copyright (c) 2024 ZettaScale Technology.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh team, <zenoh@zettascale.tech>
+//
+
+use std::{borrow::Cow, collections::HashMap, mem::MaybeUninit, str::FromStr, sync::RwLock};
+
+use lazy_static::lazy_static;
+use libc::c_char;
+use unwrap_infallible::UnwrapInfallible;
+use zenoh::bytes::Encoding;
+
+use crate::{
+    keyexpr_interner::keyexpr_hash,
+    result::{self, z_result_t},
+    transmute::{LoanedCTypeRef, RustTypeRef},
+    z_loaned_encoding_t,
+};
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief An interned encoding, obtained with `zc_encoding_intern()`.
+///
+/// Interned encodings are never freed: a pointer to an interned encoding stays valid until the end of the process,
+/// and can be shared between threads without being cloned or dropped.
+#[repr(C)]
+pub struct zc_interned_encoding_t {
+    /// The id of the encoding in the process, starting from 0 and incremented by one for each new encoding.
+    pub id: u32,
+    /// The 64-bit FNV-1a hash of the schema of the encoding, 0 if it has no schema. It is the same across processes,
+    /// so that it can be used to identify a schema in a message.
+    pub schema_hash: u64,
+    /// The encoding.
+    pub encoding: &'static z_loaned_encoding_t,
+}
+
+#[derive(Default)]
+struct EncodingInternerState {
+    ids: HashMap<Box<str>, u32>,
+    encodings: Vec<&'static zc_interned_encoding_t>,
+}
+
+lazy_static! {
+    static ref ENCODINGS: RwLock<EncodingInternerState> =
+        RwLock::new(EncodingInternerState::default());
+}
+
+fn schema_hash(s: &str) -> u64 {
+    match s.split_once(';') {
+        Some((_, schema)) if !schema.is_empty() => keyexpr_hash(schema),
+        _ => 0,
+    }
+}
+
+fn find(encoding: &Encoding) -> Option<&'static zc_interned_encoding_t> {
+    // Encodings are compared directly rather than through their string form, which would have to be formatted
+    // for encodings with a schema. The set of interned encodings is expected to be small.
+    let state = ENCODINGS.read().unwrap_or_else(|e| e.into_inner());
+    state
+        .encodings
+        .iter()
+        .find(|e| e.encoding.as_rust_type_ref() == encoding)
+        .copied()
+}
+
+fn intern(encoding: &Encoding) -> Option<&'static zc_interned_encoding_t> {
+    if let Some(interned) = find(encoding) {
+        return Some(interned);
+    }
+    let s: Cow<str> = encoding.into();
+    let mut state = ENCODINGS.write().unwrap_or_else(|e| e.into_inner());
+    // The encoding may have been interned by another thread in the meantime.
+    if let Some(id) = state.ids.get(&*s) {
+        return Some(state.encodings[*id as usize]);
+    }
+    let id = u32::try_from(state.encodings.len()).ok()?;
+    let interned: &'static zc_interned_encoding_t = Box::leak(Box::new(zc_interned_encoding_t {
+        id,
+        schema_hash: schema_hash(&s),
+        encoding: Box::leak(Box::new(encoding.clone())).as_loaned_c_type_ref(),
+    }));
+    state.ids.insert(s.into(), id);
+    state.encodings.push(interned);
+    Some(interned)
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns the interned copy of an encoding, interning it if it is not interned yet.
+///
+/// Interning an encoding once, e.g. at startup, and passing it to `z_publisher_put_options_t::interned_encoding`
+/// avoids constructing or cloning an owned encoding for each message. Entries are never removed, so interning is meant
+/// to be used with a bounded set of encodings.
+///
+/// @param encoding: The encoding to intern. It is copied if it was not interned yet.
+/// @param interned: A memory location where the pointer to the interned encoding will be written.
+/// @return 0 in case of success, negative error code otherwise.
+#[no_mangle]
+pub extern "C" fn zc_encoding_intern(
+    encoding: &z_loaned_encoding_t,
+    interned: &mut MaybeUninit<&'static zc_interned_encoding_t>,
+) -> z_result_t {
+    match intern(encoding.as_rust_type_ref()) {
+        Some(e) => {
+            interned.write(e);
+            result::Z_OK
+        }
+        None => {
+            tracing::error!("Failed to intern encoding: too many interned encodings");
+            result::Z_EGENERIC
+        }
+    }
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns the interned copy of the encoding represented by a null-terminated string, interning it if it is
+/// not interned yet.
+///
+/// @param s: The string representation of the encoding, e.g. `"application/protobuf;my.Message"`.
+/// @param interned: A memory location where the pointer to the interned encoding will be written.
+/// @return 0 in case of success, negative error code otherwise.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn zc_encoding_intern_from_str(
+    s: *const c_char,
+    interned: &mut MaybeUninit<&'static zc_interned_encoding_t>,
+) -> z_result_t {
+    if s.is_null() {
+        return result::Z_EINVAL;
+    }
+    let s = match std::ffi::CStr::from_ptr(s).to_str() {
+        Ok(s) => s,
+        Err(e) => {
+            tracing::error!("Can not create encoding from non UTF-8 string: {}", e);
+            return result::Z_EINVAL;
+        }
+    };
+    zc_encoding_intern(
+        Encoding::from_str(s)
+            .unwrap_infallible()
+            .as_loaned_c_type_ref(),
+        interned,
+    )
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Looks up the interned copy of an encoding, without interning it.
+///
+/// The lookup does not allocate, so that it can be done for every received sample to switch on the id of its encoding:
+/// @code{.c}
+/// const zc_interned_encoding_t *e;
+/// if (zc_encoding_find_interned(z_sample_encoding(sample), &e) == Z_OK && e->id == my_message_encoding->id) {
+///     ...
+/// }
+/// @endcode
+///
+/// @param encoding: The encoding to look up.
+/// @param interned: A memory location where the pointer to the interned encoding will be written.
+/// @return 0 if the encoding is interned, `Z_EUNAVAILABLE` otherwise.
+#[no_mangle]
+pub extern "C" fn zc_encoding_find_interned(
+    encoding: &z_loaned_encoding_t,
+    interned: &mut MaybeUninit<Option<&'static zc_interned_encoding_t>>,
+) -> z_result_t {
+    match find(encoding.as_rust_type_ref()) {
+        Some(e) => {
+            interned.write(Some(e));
+            result::Z_OK
+        }
+        None => {
+            interned.write(None);
+            result::Z_EUNAVAILABLE
+        }
+    }
+}
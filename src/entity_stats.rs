@@ -0,0 +1,366 @@
+//
+// Copyright (c) 2024 ZettaScale Technology.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh team, <zenoh@zettascale.tech>
+//
+
+use std::{
+    collections::HashMap,
+    mem::MaybeUninit,
+    sync::{
+        atomic::{AtomicU32, AtomicU64, Ordering},
+        Arc, Mutex, Weak,
+    },
+    time::Instant,
+};
+
+use lazy_static::lazy_static;
+use zenoh::{
+    session::{EntityGlobalId, ZenohId},
+    time::Timestamp,
+};
+
+use crate::{
+    result,
+    spans::{zc_span_kind_t, Span},
+    transmute::RustTypeRef,
+    watchdog::{CallbackHistogram, Watch},
+    z_loaned_publisher_t, z_loaned_queryable_t, z_loaned_session_t, z_loaned_subscriber_t,
+};
+
+/// Counters of one entity, or of all entities of the same kind of a session.
+#[derive(Default)]
+pub(crate) struct Counters {
+    messages: AtomicU64,
+    bytes: AtomicU64,
+    dropped: AtomicU64,
+    blocked_ns: AtomicU64,
+}
+
+impl Counters {
+    fn add(&self, messages: u64, bytes: u64, dropped: u64, blocked_ns: u64) {
+        self.messages.fetch_add(messages, Ordering::Relaxed);
+        self.bytes.fetch_add(bytes, Ordering::Relaxed);
+        if dropped != 0 {
+            self.dropped.fetch_add(dropped, Ordering::Relaxed);
+        }
+        if blocked_ns != 0 {
+            self.blocked_ns.fetch_add(blocked_ns, Ordering::Relaxed);
+        }
+    }
+
+    fn snapshot(&self) -> zc_entity_stats_t {
+        zc_entity_stats_t {
+            messages: self.messages.load(Ordering::Relaxed),
+            bytes: self.bytes.load(Ordering::Relaxed),
+            dropped: self.dropped.load(Ordering::Relaxed),
+            blocked_time_ns: self.blocked_ns.load(Ordering::Relaxed),
+        }
+    }
+}
+
+/// The counters aggregated over all entities declared through a session.
+#[derive(Default)]
+pub(crate) struct SessionCounters {
+    publishers: Counters,
+    subscribers: Counters,
+    queryables: Counters,
+    // The number of subscribers and queryables whose callbacks are not dropped yet.
+    callbacks: AtomicU64,
+}
+
+#[derive(Clone, Copy)]
+pub(crate) enum EntityKind {
+    Publisher,
+    Subscriber,
+    Queryable,
+}
+
+/// The counters of an entity, shared by its callback or its publisher with the registry.
+pub(crate) struct EntityStats {
+    kind: EntityKind,
+    eid: AtomicU32,
+    counters: Counters,
+    callbacks: CallbackHistogram,
+    session: Arc<SessionCounters>,
+}
+
+lazy_static! {
+    // Sessions are unregistered when dropped, entities are purged once their stats are dropped with them.
+    static ref SESSIONS: Mutex<HashMap<ZenohId, Arc<SessionCounters>>> = Mutex::new(HashMap::new());
+    static ref ENTITIES: Mutex<HashMap<EntityGlobalId, Weak<EntityStats>>> = Mutex::new(HashMap::new());
+}
+
+impl EntityStats {
+    pub(crate) fn new(zid: ZenohId, kind: EntityKind) -> Arc<EntityStats> {
+        let session = session_counters(zid);
+        if !matches!(kind, EntityKind::Publisher) {
+            session.callbacks.fetch_add(1, Ordering::Relaxed);
+        }
+        Arc::new(EntityStats {
+            kind,
+            eid: AtomicU32::new(0),
+            counters: Counters::default(),
+            callbacks: CallbackHistogram::default(),
+            session,
+        })
+    }
+
+    /// Makes the stats readable by the entity id, once the entity is declared.
+    pub(crate) fn register(self: &Arc<Self>, id: EntityGlobalId) {
+        self.eid.store(id.eid(), Ordering::Relaxed);
+        let mut entities = ENTITIES.lock().unwrap_or_else(|e| e.into_inner());
+        entities.retain(|_, s| s.strong_count() > 0);
+        entities.insert(id, Arc::downgrade(self));
+    }
+
+    pub(crate) fn eid(&self) -> u32 {
+        self.eid.load(Ordering::Relaxed)
+    }
+
+    pub(crate) fn callbacks(&self) -> &CallbackHistogram {
+        &self.callbacks
+    }
+
+    fn session_counters(&self) -> &Counters {
+        match self.kind {
+            EntityKind::Publisher => &self.session.publishers,
+            EntityKind::Subscriber => &self.session.subscribers,
+            EntityKind::Queryable => &self.session.queryables,
+        }
+    }
+
+    fn add(&self, messages: u64, bytes: u64, dropped: u64, blocked_ns: u64) {
+        self.counters.add(messages, bytes, dropped, blocked_ns);
+        self.session_counters()
+            .add(messages, bytes, dropped, blocked_ns);
+    }
+
+    /// Counts a received sample or query, and times its handling by `f` if it is sampled or the watchdog is enabled.
+    pub(crate) fn received<R>(
+        &self,
+        bytes: usize,
+        timestamp: Option<&Timestamp>,
+        f: impl FnOnce() -> R,
+    ) -> R {
+        self.add(1, bytes as u64, 0, 0);
+        let span = Span::start();
+        let watch = Watch::start();
+        let r = f();
+        let kind = match self.kind {
+            EntityKind::Queryable => zc_span_kind_t::QUERY_CALLBACK,
+            _ => zc_span_kind_t::SAMPLE_CALLBACK,
+        };
+        if let Some(watch) = watch {
+            watch.end(&self.callbacks, kind, self.eid(), bytes, timestamp);
+        }
+        if let Some(span) = span {
+            span.end(kind, self.eid(), bytes, timestamp);
+        }
+        r
+    }
+
+    /// Counts a received query which could not be dispatched.
+    pub(crate) fn rejected(&self) {
+        self.add(0, 0, 1, 0);
+    }
+
+    /// Runs a put or delete of `bytes` bytes and counts it, timing it when the publisher may block or it is sampled.
+    pub(crate) fn sent(
+        &self,
+        bytes: usize,
+        blocking: bool,
+        f: impl FnOnce() -> result::z_result_t,
+    ) -> result::z_result_t {
+        let span = Span::start();
+        let start = blocking.then(Instant::now);
+        let r = f();
+        let blocked_ns = start.map_or(0, |s| s.elapsed().as_nanos() as u64);
+        self.add(1, bytes as u64, (r != result::Z_OK) as u64, blocked_ns);
+        if let Some(span) = span {
+            span.end(
+                zc_span_kind_t::PUT,
+                self.eid.load(Ordering::Relaxed),
+                bytes,
+                None,
+            );
+        }
+        r
+    }
+}
+
+impl Drop for EntityStats {
+    fn drop(&mut self) {
+        if !matches!(self.kind, EntityKind::Publisher) {
+            self.session.callbacks.fetch_sub(1, Ordering::Relaxed);
+        }
+    }
+}
+
+impl SessionCounters {
+    /// The number of subscribers and queryables of the session whose callbacks are not dropped yet.
+    pub(crate) fn pending_callbacks(&self) -> usize {
+        self.callbacks.load(Ordering::Relaxed) as usize
+    }
+}
+
+/// The aggregated counters of a session, which outlive its unregistration as long as they are referenced.
+pub(crate) fn session_counters(zid: ZenohId) -> Arc<SessionCounters> {
+    SESSIONS
+        .lock()
+        .unwrap_or_else(|e| e.into_inner())
+        .entry(zid)
+        .or_default()
+        .clone()
+}
+
+/// Unregisters the aggregated counters of a session, which is about to be dropped.
+pub(crate) fn forget_session(zid: ZenohId) {
+    SESSIONS
+        .lock()
+        .unwrap_or_else(|e| e.into_inner())
+        .remove(&zid);
+}
+
+/// The stats of a declared entity, if it has some.
+pub(crate) fn find_entity_stats(id: EntityGlobalId) -> Option<Arc<EntityStats>> {
+    ENTITIES
+        .lock()
+        .unwrap_or_else(|e| e.into_inner())
+        .get(&id)
+        .and_then(Weak::upgrade)
+}
+
+fn get_entity_stats(
+    id: EntityGlobalId,
+    stats: &mut MaybeUninit<zc_entity_stats_t>,
+) -> result::z_result_t {
+    match find_entity_stats(id) {
+        Some(entity) => {
+            stats.write(entity.counters.snapshot());
+            result::Z_OK
+        }
+        None => {
+            stats.write(zc_entity_stats_t::default());
+            result::Z_EUNAVAILABLE
+        }
+    }
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Counters of the messages handled by an entity since its declaration.
+///
+/// The counters are updated with relaxed atomic operations, so a snapshot is not guaranteed to be consistent
+/// across fields while messages are in flight.
+#[repr(C)]
+#[derive(Default, Clone, Copy)]
+pub struct zc_entity_stats_t {
+    /// The number of messages sent by a publisher, or of samples and queries received by a subscriber or a queryable.
+    pub messages: u64,
+    /// The total size of the payloads of the messages.
+    pub bytes: u64,
+    /// The number of messages which were not delivered: puts that failed for a publisher, queries rejected
+    /// by a full worker queue for a queryable.
+    pub dropped: u64,
+    /// The time spent in the puts and deletes of a publisher with `Z_CONGESTION_CONTROL_BLOCK`, which includes the time
+    /// they were blocked by congestion. Always 0 for other entities.
+    pub blocked_time_ns: u64,
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Counters aggregated over all entities declared through a session, including the undeclared ones.
+#[repr(C)]
+#[derive(Default, Clone, Copy)]
+pub struct zc_session_stats_t {
+    /// The counters of the publishers.
+    pub publishers: zc_entity_stats_t,
+    /// The counters of the subscribers.
+    pub subscribers: zc_entity_stats_t,
+    /// The counters of the queryables.
+    pub queryables: zc_entity_stats_t,
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Reads the counters of a publisher.
+///
+/// Messages kept pending by the coalescing mode are counted when they are put.
+///
+/// @param this_: The publisher.
+/// @param stats: An uninitialized location in memory where the counters will be written.
+/// @return 0 in case of success, negative error code otherwise.
+#[no_mangle]
+pub extern "C" fn zc_publisher_get_stats(
+    this_: &z_loaned_publisher_t,
+    stats: &mut MaybeUninit<zc_entity_stats_t>,
+) -> result::z_result_t {
+    stats.write(this_.as_rust_type_ref().stats.counters.snapshot());
+    result::Z_OK
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Reads the counters of a subscriber.
+///
+/// Samples are counted before being passed to the subscriber callback, or pushed to its channel.
+///
+/// @param this_: The subscriber.
+/// @param stats: An uninitialized location in memory where the counters will be written.
+/// @return 0 in case of success, `Z_EUNAVAILABLE` if the subscriber has no counters, negative error code otherwise.
+#[no_mangle]
+pub extern "C" fn zc_subscriber_get_stats(
+    this_: &z_loaned_subscriber_t,
+    stats: &mut MaybeUninit<zc_entity_stats_t>,
+) -> result::z_result_t {
+    get_entity_stats(this_.as_rust_type_ref().id(), stats)
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Reads the counters of a queryable.
+///
+/// Queries are counted before being passed to the queryable callback, or to its worker threads.
+///
+/// @param this_: The queryable.
+/// @param stats: An uninitialized location in memory where the counters will be written.
+/// @return 0 in case of success, `Z_EUNAVAILABLE` if the queryable has no counters, negative error code otherwise.
+#[no_mangle]
+pub extern "C" fn zc_queryable_get_stats(
+    this_: &z_loaned_queryable_t,
+    stats: &mut MaybeUninit<zc_entity_stats_t>,
+) -> result::z_result_t {
+    get_entity_stats(this_.as_rust_type_ref().id(), stats)
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Reads the counters aggregated over all publishers, subscribers and queryables declared through a session.
+///
+/// @param this_: The session.
+/// @param stats: An uninitialized location in memory where the counters will be written.
+/// @return 0 in case of success, negative error code otherwise.
+#[no_mangle]
+pub extern "C" fn zc_session_get_stats(
+    this_: &z_loaned_session_t,
+    stats: &mut MaybeUninit<zc_session_stats_t>,
+) -> result::z_result_t {
+    let zid = this_.as_rust_type_ref().zid();
+    let session = SESSIONS
+        .lock()
+        .unwrap_or_else(|e| e.into_inner())
+        .get(&zid)
+        .cloned();
+    stats.write(match session {
+        Some(s) => zc_session_stats_t {
+            publishers: s.publishers.snapshot(),
+            subscribers: s.subscribers.snapshot(),
+            queryables: s.queryables.snapshot(),
+        },
+        None => zc_session_stats_t::default(),
+    });
+    result::Z_OK
+}
@@ -37,8 +37,10 @@ use crate::{
 };
 #[cfg(feature = "unstable")]
 use crate::{
-    transmute::IntoCType, z_id_t, z_moved_source_info_t, zc_locality_default, zc_locality_t,
-    zc_reply_keyexpr_default, zc_reply_keyexpr_t,
+    transmute::IntoCType, z_id_t, z_moved_cancellation_token_t, z_moved_source_info_t,
+    z_owned_closure_reply_t, zc_closure_indexed_reply_call, zc_closure_indexed_reply_loan,
+    zc_locality_default, zc_locality_t, zc_moved_closure_indexed_reply_t,
+    zc_owned_closure_indexed_reply_t, zc_reply_keyexpr_default, zc_reply_keyexpr_t,
 };
 decl_c_type!(
     owned(z_owned_reply_err_t, ReplyError),
@@ -231,6 +233,164 @@ pub struct z_get_options_t {
     pub attachment: Option<&'static mut z_moved_bytes_t>,
     /// The timeout for the query in milliseconds. 0 means default query timeout from zenoh configuration.
     pub timeout_ms: u64,
+    #[cfg(feature = "unstable")]
+    /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+    ///
+    /// The expected number of distinct key expressions among the replies. If non-zero, and the consolidation mode is
+    /// `Z_CONSOLIDATION_MODE_LATEST` or `Z_CONSOLIDATION_MODE_MONOTONIC`, the replies are consolidated locally in a table
+    /// pre-sized for this number of keys, instead of by the zenoh runtime. Note that the replies are then not
+    /// consolidated by the routers on their way.
+    pub consolidation_capacity: usize,
+    #[cfg(feature = "unstable")]
+    /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+    ///
+    /// An optional location where the consolidation statistics of the query will be written, once all replies
+    /// are processed, right before the reply callback is dropped. It must stay valid until then. Setting it enables
+    /// local consolidation, as for `consolidation_capacity`, for `Z_CONSOLIDATION_MODE_LATEST`,
+    /// `Z_CONSOLIDATION_MODE_MONOTONIC` and `Z_CONSOLIDATION_MODE_NONE`; it is ignored with other modes.
+    /// Only used by `z_get()`.
+    pub consolidation_stats: *mut zc_reply_consolidation_stats_t,
+    #[cfg(feature = "unstable")]
+    /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+    ///
+    /// An optional cancellation token, see `z_cancellation_token_new()`. Once it is cancelled, the reply callback is
+    /// dropped without waiting for the query to be finalized.
+    pub cancellation_token: Option<&'static mut z_moved_cancellation_token_t>,
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Statistics of the local consolidation of the replies to a query, see `z_get_options_t::consolidation_stats`.
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Default)]
+pub struct zc_reply_consolidation_stats_t {
+    /// Number of replies received.
+    pub replies_received: u64,
+    /// Number of replies dropped because a more recent reply (or one as recent) was received for the same key expression.
+    pub replies_dropped: u64,
+    /// Number of distinct key expressions among the replies.
+    pub keys: u64,
+    /// Total time spent consolidating the replies, in nanoseconds.
+    pub consolidation_ns: u64,
+}
+
+#[cfg(feature = "unstable")]
+/// Consolidates the replies in zenoh-c before passing them to `callback`.
+///
+/// With the latest mode, the retained replies are delivered when the consolidation is dropped, that is, once the query is finalized.
+struct LocalConsolidation {
+    mode: ConsolidationMode,
+    replies: std::sync::Mutex<
+        std::collections::HashMap<
+            zenoh::key_expr::KeyExpr<'static>,
+            (Option<zenoh::time::Timestamp>, Option<Reply>),
+        >,
+    >,
+    stats: std::sync::Mutex<zc_reply_consolidation_stats_t>,
+    stats_out: *mut zc_reply_consolidation_stats_t,
+    // declared last to be dropped after the pending replies are delivered
+    callback: z_owned_closure_reply_t,
+}
+
+#[cfg(feature = "unstable")]
+unsafe impl Send for LocalConsolidation {}
+#[cfg(feature = "unstable")]
+unsafe impl Sync for LocalConsolidation {}
+
+#[cfg(feature = "unstable")]
+impl LocalConsolidation {
+    fn new(
+        mode: ConsolidationMode,
+        capacity: usize,
+        stats_out: *mut zc_reply_consolidation_stats_t,
+        callback: z_owned_closure_reply_t,
+    ) -> Self {
+        let capacity = match mode {
+            ConsolidationMode::None => 0,
+            _ => capacity,
+        };
+        LocalConsolidation {
+            mode,
+            replies: std::sync::Mutex::new(std::collections::HashMap::with_capacity(capacity)),
+            stats: Default::default(),
+            stats_out,
+            callback,
+        }
+    }
+
+    fn deliver(&self, reply: Reply) {
+        let mut owned_reply = Some(reply);
+        z_closure_reply_call(z_closure_reply_loan(&self.callback), unsafe {
+            owned_reply
+                .as_mut()
+                .unwrap_unchecked()
+                .as_loaned_c_type_mut()
+        })
+    }
+
+    fn on_reply(&self, reply: Reply) {
+        let start = std::time::Instant::now();
+        let (key, timestamp) = match reply.result() {
+            Ok(sample) if self.mode != ConsolidationMode::None => {
+                (sample.key_expr().clone(), sample.timestamp().cloned())
+            }
+            _ => {
+                self.account(start, 0, 0);
+                return self.deliver(reply);
+            }
+        };
+        let latest = self.mode == ConsolidationMode::Latest;
+        let mut replies = self.replies.lock().unwrap_or_else(|e| e.into_inner());
+        let (to_deliver, new_keys, dropped) = match replies.get_mut(&key) {
+            Some(entry) if timestamp > entry.0 => {
+                entry.0 = timestamp;
+                match latest {
+                    true => (None, 0, entry.1.replace(reply).map_or(0, |_| 1)),
+                    false => (Some(reply), 0, 0),
+                }
+            }
+            Some(_) => (None, 0, 1),
+            None => match latest {
+                true => {
+                    replies.insert(key, (timestamp, Some(reply)));
+                    (None, 1, 0)
+                }
+                false => {
+                    replies.insert(key, (timestamp, None));
+                    (Some(reply), 1, 0)
+                }
+            },
+        };
+        drop(replies);
+        self.account(start, new_keys, dropped);
+        if let Some(reply) = to_deliver {
+            self.deliver(reply);
+        }
+    }
+
+    fn account(&self, start: std::time::Instant, new_keys: u64, dropped: u64) {
+        let mut stats = self.stats.lock().unwrap_or_else(|e| e.into_inner());
+        stats.replies_received += 1;
+        stats.replies_dropped += dropped;
+        stats.keys += new_keys;
+        stats.consolidation_ns += start.elapsed().as_nanos() as u64;
+    }
+}
+
+#[cfg(feature = "unstable")]
+impl Drop for LocalConsolidation {
+    fn drop(&mut self) {
+        let replies = std::mem::take(self.replies.get_mut().unwrap_or_else(|e| e.into_inner()));
+        for (_, (_, reply)) in replies {
+            if let Some(reply) = reply {
+                self.deliver(reply);
+            }
+        }
+        if !self.stats_out.is_null() {
+            let stats = *self.stats.get_mut().unwrap_or_else(|e| e.into_inner());
+            unsafe { *self.stats_out = stats };
+        }
+    }
 }
 
 /// Constructs default `z_get_options_t`
@@ -252,9 +412,26 @@ pub extern "C" fn z_get_options_default(this_: &mut MaybeUninit<z_get_options_t>
         #[cfg(feature = "unstable")]
         source_info: None,
         attachment: None,
+        #[cfg(feature = "unstable")]
+        consolidation_capacity: 0,
+        #[cfg(feature = "unstable")]
+        consolidation_stats: std::ptr::null_mut(),
+        #[cfg(feature = "unstable")]
+        cancellation_token: None,
     });
 }
 
+#[cfg(feature = "unstable")]
+pub(crate) fn _call_reply_closure(callback: &z_owned_closure_reply_t, reply: Reply) {
+    let mut owned_reply = Some(reply);
+    z_closure_reply_call(z_closure_reply_loan(callback), unsafe {
+        owned_reply
+            .as_mut()
+            .unwrap_unchecked()
+            .as_loaned_c_type_mut()
+    })
+}
+
 /// Query data from the matching queryables in the system.
 /// Replies are provided through a callback function.
 ///
@@ -264,7 +441,8 @@ pub extern "C" fn z_get_options_default(this_: &mut MaybeUninit<z_get_options_t>
 /// @param callback: The callback function that will be called on reception of replies for this query. It will be automatically dropped once all replies are processed.
 /// @param options: Additional options for the get. All owned fields will be consumed.
 ///
-/// @return 0 in case of success, a negative error value upon failure.
+/// @return 0 in case of success, a negative error value upon failure. If the cancellation token of the options is
+/// already cancelled, the query is not sent and 0 is returned, the callback being dropped.
 #[allow(clippy::missing_safety_doc)]
 #[no_mangle]
 pub unsafe extern "C" fn z_get(
@@ -283,6 +461,10 @@ pub unsafe extern "C" fn z_get(
     let session = session.as_rust_type_ref();
     let key_expr = key_expr.as_rust_type_ref();
     let mut get = session.get(Selector::from((key_expr, p)));
+    #[cfg(feature = "unstable")]
+    let mut local_consolidation = None;
+    #[cfg(feature = "unstable")]
+    let mut cancellation_token = None;
     if let Some(options) = options {
         if let Some(payload) = options.payload.take() {
             get = get.payload(payload.take_rust_type());
@@ -297,6 +479,13 @@ pub unsafe extern "C" fn z_get(
         if let Some(attachment) = options.attachment.take() {
             get = get.attachment(attachment.take_rust_type());
         }
+        #[cfg(feature = "unstable")]
+        {
+            cancellation_token = options
+                .cancellation_token
+                .take()
+                .and_then(|t| t.take_rust_type());
+        }
 
         get = get
             .consolidation(options.consolidation)
@@ -314,9 +503,51 @@ pub unsafe extern "C" fn z_get(
         if options.timeout_ms != 0 {
             get = get.timeout(std::time::Duration::from_millis(options.timeout_ms));
         }
+        #[cfg(feature = "unstable")]
+        {
+            let mode: ConsolidationMode = options.consolidation.mode.into();
+            let local = match mode {
+                ConsolidationMode::Latest | ConsolidationMode::Monotonic => {
+                    options.consolidation_capacity != 0 || !options.consolidation_stats.is_null()
+                }
+                ConsolidationMode::None => !options.consolidation_stats.is_null(),
+                _ => false,
+            };
+            if local {
+                get = get.consolidation(ConsolidationMode::None);
+                local_consolidation = Some((
+                    mode,
+                    options.consolidation_capacity,
+                    options.consolidation_stats,
+                ));
+            }
+        }
+    }
+    #[cfg(feature = "unstable")]
+    if let Some(token) = cancellation_token {
+        let res = match local_consolidation {
+            Some((mode, capacity, stats)) => token
+                .wrap(
+                    LocalConsolidation::new(mode, capacity, stats, callback),
+                    LocalConsolidation::on_reply,
+                )
+                .map(|on_reply| get.callback(on_reply).wait()),
+            None => token
+                .wrap(callback, _call_reply_closure)
+                .map(|on_reply| get.callback(on_reply).wait()),
+        };
+        return res.map_or(result::Z_OK, _get_result);
     }
-    match get
-        .callback(move |response| {
+    #[cfg(feature = "unstable")]
+    if let Some((mode, capacity, stats)) = local_consolidation {
+        let consolidation = LocalConsolidation::new(mode, capacity, stats, callback);
+        return _get_result(
+            get.callback(move |response| consolidation.on_reply(response))
+                .wait(),
+        );
+    }
+    _get_result(
+        get.callback(move |response| {
             let mut owned_response = Some(response);
             z_closure_reply_call(
                 z_closure_reply_loan(&callback),
@@ -326,8 +557,12 @@ pub unsafe extern "C" fn z_get(
                     .as_loaned_c_type_mut(),
             )
         })
-        .wait()
-    {
+        .wait(),
+    )
+}
+
+pub(crate) fn _get_result(res: zenoh::Result<()>) -> result::z_result_t {
+    match res {
         Ok(()) => result::Z_OK,
         Err(e) if e.downcast_ref::<SessionClosedError>().is_some() => result::Z_ESESSION_CLOSED,
         Err(e) => {
@@ -337,6 +572,138 @@ pub unsafe extern "C" fn z_get(
     }
 }
 
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Query data for several selectors at once, delivering all replies to a single callback.
+///
+/// The queries are sent one after the other, without waiting for replies, so that they are pipelined by the transport.
+/// Each reply is passed to `callback` together with the index of the query it answers. The callback is dropped
+/// once all replies to all queries have been processed, which can be used as a completion signal.
+///
+/// @param session: The zenoh session.
+/// @param key_exprs: An array of `len` key expressions to query.
+/// @param parameters: An optional array of `len` query parameters, each of them being possibly `NULL`.
+/// @param len: The number of queries.
+/// @param callback: The callback function that will be called on reception of replies for the queries.
+/// @param options: Additional options applied to all queries. All owned fields will be consumed, the payload,
+/// encoding, source info and attachment are shared by all queries.
+///
+/// @return 0 in case of success, a negative error value upon failure. If a query fails to be sent, the following
+/// ones are not sent, while replies to the preceding ones are still delivered. The cancellation token of the options
+/// cancels all the queries.
+#[cfg(feature = "unstable")]
+#[allow(clippy::missing_safety_doc)]
+#[no_mangle]
+pub unsafe extern "C" fn zc_get_many(
+    session: &z_loaned_session_t,
+    key_exprs: *const &z_loaned_keyexpr_t,
+    parameters: *const *const c_char,
+    len: usize,
+    callback: &mut zc_moved_closure_indexed_reply_t,
+    options: Option<&mut z_get_options_t>,
+) -> result::z_result_t {
+    let callback = callback.take_rust_type();
+    if key_exprs.is_null() && len > 0 {
+        tracing::error!("Key expressions array should not be null");
+        return result::Z_EINVAL;
+    }
+    let mut selectors = Vec::with_capacity(len);
+    for i in 0..len {
+        let p = match parameters.is_null() || (*parameters.add(i)).is_null() {
+            true => "",
+            false => match CStr::from_ptr(*parameters.add(i)).to_str() {
+                Ok(p) => p,
+                Err(e) => {
+                    tracing::error!("Invalid parameters of query {}: {}", i, e);
+                    return result::Z_EINVAL;
+                }
+            },
+        };
+        selectors.push(Selector::from(((*key_exprs.add(i)).as_rust_type_ref(), p)));
+    }
+    let mut options = options;
+    let (payload, encoding, source_info, attachment) = match options.as_deref_mut() {
+        Some(o) => (
+            o.payload.take().map(|v| v.take_rust_type()),
+            o.encoding.take().map(|v| v.take_rust_type()),
+            o.source_info.take().map(|v| v.take_rust_type()),
+            o.attachment.take().map(|v| v.take_rust_type()),
+        ),
+        None => (None, None, None, None),
+    };
+    let cancellation_token = options
+        .as_deref_mut()
+        .and_then(|o| o.cancellation_token.take())
+        .and_then(|t| t.take_rust_type());
+    let on_reply: std::sync::Arc<dyn Fn(usize, Reply) + Send + Sync> = match cancellation_token {
+        Some(token) => {
+            let Some(on_reply) =
+                token.wrap(callback, |callback, (index, reply): (usize, Reply)| {
+                    _call_indexed_reply_closure(callback, index, reply)
+                })
+            else {
+                return result::Z_OK;
+            };
+            std::sync::Arc::new(move |index, reply| on_reply((index, reply)))
+        }
+        None => std::sync::Arc::new(move |index, reply| {
+            _call_indexed_reply_closure(&callback, index, reply)
+        }),
+    };
+    let session = session.as_rust_type_ref();
+    for (index, selector) in selectors.into_iter().enumerate() {
+        let mut get = session.get(selector);
+        if let Some(payload) = &payload {
+            get = get.payload(payload.clone());
+        }
+        if let Some(encoding) = &encoding {
+            get = get.encoding(encoding.clone());
+        }
+        if let Some(source_info) = &source_info {
+            get = get.source_info(source_info.clone());
+        }
+        if let Some(attachment) = &attachment {
+            get = get.attachment(attachment.clone());
+        }
+        if let Some(options) = options.as_deref() {
+            get = get
+                .consolidation(options.consolidation)
+                .target(options.target.into())
+                .congestion_control(options.congestion_control.into())
+                .priority(options.priority.into())
+                .express(options.is_express)
+                .allowed_destination(options.allowed_destination.into())
+                .accept_replies(options.accept_replies.into());
+            if options.timeout_ms != 0 {
+                get = get.timeout(std::time::Duration::from_millis(options.timeout_ms));
+            }
+        }
+        let on_reply = on_reply.clone();
+        let res = get
+            .callback(move |response| on_reply(index, response))
+            .wait();
+        let res = _get_result(res);
+        if res != result::Z_OK {
+            return res;
+        }
+    }
+    result::Z_OK
+}
+
+#[cfg(feature = "unstable")]
+fn _call_indexed_reply_closure(
+    callback: &zc_owned_closure_indexed_reply_t,
+    index: usize,
+    reply: Reply,
+) {
+    let mut owned_reply = Some(reply);
+    zc_closure_indexed_reply_call(zc_closure_indexed_reply_loan(callback), index, unsafe {
+        owned_reply
+            .as_mut()
+            .unwrap_unchecked()
+            .as_loaned_c_type_mut()
+    })
+}
+
 /// Frees reply, resetting it to its gravestone state.
 #[no_mangle]
 pub extern "C" fn z_reply_drop(this_: &mut z_moved_reply_t) {
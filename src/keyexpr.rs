@@ -17,7 +17,7 @@ use libc::c_char;
 #[cfg(feature = "unstable")]
 use zenoh::key_expr::SetIntersectionLevel;
 use zenoh::{
-    key_expr::{keyexpr, Canonize, KeyExpr},
+    key_expr::{keyexpr, Canonize, KeyExpr, OwnedKeyExpr},
     Wait,
 };
 
@@ -48,11 +48,59 @@ pub extern "C" fn z_view_keyexpr_empty(this_: &mut MaybeUninit<z_view_keyexpr_t>
     this_.as_rust_type_mut_uninit().write(None);
 }
 
+const SWAR_LOWS: u64 = 0x0101_0101_0101_0101;
+const SWAR_HIGHS: u64 = 0x8080_8080_8080_8080;
+
+/// Returns a word with the high bit of each byte set iff the corresponding byte of `word` is equal to `b`.
+#[inline(always)]
+fn swar_eq(word: u64, b: u8) -> u64 {
+    let x = word ^ SWAR_LOWS.wrapping_mul(b as u64);
+    !(((x & !SWAR_HIGHS).wrapping_add(!SWAR_HIGHS)) | x) & SWAR_HIGHS
+}
+
+/// Returns ``true`` if `name` is a key expression in canon form containing no wildcard nor `$`,
+/// i.e. a non-empty string with no empty chunk and none of the `*`, `$`, `#` and `?` characters.
+///
+/// Such key expressions, which are the vast majority of those used to publish, are left unchanged by
+/// canonization, so their validation can be reduced to this check, done 8 bytes at a time.
+fn keyexpr_is_plain_canon(name: &[u8]) -> bool {
+    if name.first().map_or(true, |b| *b == b'/') || name.last() == Some(&b'/') {
+        return false;
+    }
+    let mut words = name.chunks_exact(8);
+    // Whether the last byte of the previous word is a `/`, to detect empty chunks across words
+    let mut prev_slash = 0u64;
+    for w in &mut words {
+        let w = u64::from_le_bytes(w.try_into().unwrap());
+        let specials = swar_eq(w, b'*') | swar_eq(w, b'$') | swar_eq(w, b'#') | swar_eq(w, b'?');
+        let slashes = swar_eq(w, b'/');
+        if specials != 0 || slashes & ((slashes >> 8) | (prev_slash >> 56)) != 0 {
+            return false;
+        }
+        prev_slash = slashes;
+    }
+    let mut prev = if prev_slash >> 56 != 0 { b'/' } else { 0 };
+    for b in words.remainder() {
+        if matches!(*b, b'*' | b'$' | b'#' | b'?') || (*b == b'/' && prev == b'/') {
+            return false;
+        }
+        prev = *b;
+    }
+    true
+}
+
 fn keyexpr_create_inner(
     mut name: &'static mut str,
     should_auto_canonize: bool,
     should_copy: bool,
 ) -> Result<KeyExpr<'static>, Box<dyn Error + Send + Sync>> {
+    if keyexpr_is_plain_canon(name.as_bytes()) {
+        return Ok(if should_copy {
+            unsafe { OwnedKeyExpr::from_string_unchecked(name.to_string()) }.into()
+        } else {
+            unsafe { keyexpr::from_str_unchecked(name) }.into()
+        });
+    }
     if should_copy {
         let s = name.to_string();
         match should_auto_canonize {
@@ -516,6 +564,18 @@ pub extern "C" fn z_keyexpr_equals(left: &z_loaned_keyexpr_t, right: &z_loaned_k
     *l == *r
 }
 
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns a 64-bit hash of the key expression.
+///
+/// The hash is the 64-bit FNV-1a hash of the key expression string. It does not depend on the process nor on the
+/// Zenoh version, so it can be used as a hash-map key, stored or exchanged between applications.
+/// Equal key expressions always have the same hash.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn z_keyexpr_hash(this_: &z_loaned_keyexpr_t) -> u64 {
+    crate::keyexpr_interner::keyexpr_hash(this_.as_rust_type_ref().as_str())
+}
+
 /// Returns ``true`` if the keyexprs intersect, i.e. there exists at least one key which is contained in both of the
 /// sets defined by ``left`` and ``right``, ``false`` otherwise.
 #[no_mangle]
@@ -606,6 +666,142 @@ pub extern "C" fn z_keyexpr_join(
         }
     }
 }
+/// Copies `parts` one after the other into the buffer `buf`, returning the written part of the buffer.
+#[cfg(feature = "unstable")]
+unsafe fn keyexpr_write_parts(
+    buf: *mut c_char,
+    buf_len: usize,
+    parts: &[&[u8]],
+) -> Option<&'static mut [u8]> {
+    let len = parts.iter().map(|p| p.len()).sum();
+    if buf.is_null() || len > buf_len {
+        tracing::error!(
+            "Buffer of {} bytes is too small to hold a key expression of {} bytes",
+            buf_len,
+            len
+        );
+        return None;
+    }
+    let dst = std::slice::from_raw_parts_mut(buf as *mut u8, len);
+    let mut offset = 0;
+    for p in parts {
+        dst[offset..offset + p.len()].copy_from_slice(p);
+        offset += p.len();
+    }
+    Some(dst)
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs a view key expression by concatenation of key expression in `left` with a string in `right`,
+/// writing the result into the caller-provided buffer `buf` instead of allocating it.
+///
+/// The result is canonized in place, it is the same as the one of `z_keyexpr_concat()`.
+/// `buf` must outlive the constructed key expression.
+///
+/// @param this_: An uninitialized location in memory where key expression will be constructed.
+/// @param buf: A buffer of length >= `buf_len` where the resulting key expression is written.
+/// @param buf_len: Length of `buf`, it should be at least the sum of lengths of `left` and `right`.
+/// @param left: The key expression to concatenate to.
+/// @param right_start: A buffer of length >= `right_len` containing the string to concatenate.
+/// @param right_len: Number of characters from `right_start` to consider.
+/// @return 0 in case of success, negative error code otherwise.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_view_keyexpr_concat(
+    this_: &mut MaybeUninit<z_view_keyexpr_t>,
+    buf: *mut c_char,
+    buf_len: usize,
+    left: &z_loaned_keyexpr_t,
+    right_start: *const c_char,
+    right_len: usize,
+) -> result::z_result_t {
+    let this = this_.as_rust_type_mut_uninit();
+    let left = left.as_rust_type_ref();
+    if right_start.is_null() && right_len > 0 {
+        this.write(None);
+        return result::Z_EINVAL;
+    }
+    let right = if right_len > 0 {
+        std::slice::from_raw_parts(right_start as *const u8, right_len)
+    } else {
+        &[]
+    };
+    if left.ends_with('*') && right.first() == Some(&b'*') {
+        tracing::error!(
+            "Tried to concatenate {} (ends with *) and {} (starts with *), which would likely have caused bugs. If you're sure you want to do this, concatenate these into a string and then try to convert.",
+            left,
+            String::from_utf8_lossy(right)
+        );
+        this.write(None);
+        return result::Z_EINVAL;
+    }
+    let Some(dst) = keyexpr_write_parts(buf, buf_len, &[left.as_bytes(), right]) else {
+        this.write(None);
+        return result::Z_EINVAL;
+    };
+    match keyexpr_create(dst, true, false) {
+        Ok(ke) => {
+            this.write(Some(ke));
+            result::Z_OK
+        }
+        Err(e) => {
+            this.write(None);
+            e
+        }
+    }
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs a view key expression by performing path-joining (automatically inserting `/`) of `left` with `right`,
+/// writing the result into the caller-provided buffer `buf` instead of allocating it.
+///
+/// The result is the same as the one of `z_keyexpr_join()`. Since both key expressions are already in canon form,
+/// the result is only re-canonized if `left` ends or `right` starts with `**`; otherwise it is only copied.
+/// `buf` must outlive the constructed key expression.
+///
+/// @param this_: An uninitialized location in memory where key expression will be constructed.
+/// @param buf: A buffer of length >= `buf_len` where the resulting key expression is written.
+/// @param buf_len: Length of `buf`, it should be at least the sum of lengths of `left` and `right` plus 1.
+/// @param left: The first key expression.
+/// @param right: The second key expression.
+/// @return 0 in case of success, negative error code otherwise.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_view_keyexpr_join(
+    this_: &mut MaybeUninit<z_view_keyexpr_t>,
+    buf: *mut c_char,
+    buf_len: usize,
+    left: &z_loaned_keyexpr_t,
+    right: &z_loaned_keyexpr_t,
+) -> result::z_result_t {
+    let this = this_.as_rust_type_mut_uninit();
+    let left = left.as_rust_type_ref();
+    let right = right.as_rust_type_ref();
+    let Some(dst) = keyexpr_write_parts(buf, buf_len, &[left.as_bytes(), b"/", right.as_bytes()])
+    else {
+        this.write(None);
+        return result::Z_EINVAL;
+    };
+    if left.ends_with("**") || right.starts_with("**") {
+        return match keyexpr_create(dst, true, false) {
+            Ok(ke) => {
+                this.write(Some(ke));
+                result::Z_OK
+            }
+            Err(e) => {
+                this.write(None);
+                e
+            }
+        };
+    }
+    // Chunks of canon key expressions are canon, and only `**` chunks interact with their neighbours
+    // during canonization, so joining them with `/` yields a canon key expression.
+    let ke = keyexpr::from_str_unchecked(std::str::from_utf8_unchecked(dst));
+    this.write(Some(ke.into()));
+    result::Z_OK
+}
 #[cfg(feature = "unstable")]
 /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
 /// @brief Intersection level of 2 key expressions.
@@ -0,0 +1,254 @@
+//
+// Copyright (c) 2017, 2024 ZettaScale Technology.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh team, <zenoh@zettascale.tech>
+//
+
+use std::{
+    collections::HashMap,
+    hash::{BuildHasherDefault, Hasher},
+    mem::MaybeUninit,
+    sync::RwLock,
+};
+
+use zenoh::key_expr::KeyExpr;
+
+pub use crate::opaque_types::{
+    zc_loaned_keyexpr_interner_t, zc_moved_keyexpr_interner_t, zc_owned_keyexpr_interner_t,
+};
+use crate::{
+    result::{self, z_result_t},
+    transmute::{LoanedCTypeRef, RustTypeRef, RustTypeRefUninit, TakeRustType},
+    z_loaned_keyexpr_t, z_owned_keyexpr_t,
+};
+
+const FNV_OFFSET_BASIS: u64 = 0xcbf29ce484222325;
+const FNV_PRIME: u64 = 0x100000001b3;
+
+/// 64-bit FNV-1a hasher. Unlike the default hasher of the standard library it is not seeded,
+/// so that the hash of a key expression is the same across processes and runs.
+pub(crate) struct KeyExprHasher(u64);
+
+impl Default for KeyExprHasher {
+    fn default() -> Self {
+        KeyExprHasher(FNV_OFFSET_BASIS)
+    }
+}
+
+impl Hasher for KeyExprHasher {
+    fn write(&mut self, bytes: &[u8]) {
+        for b in bytes {
+            self.0 = (self.0 ^ *b as u64).wrapping_mul(FNV_PRIME);
+        }
+    }
+
+    fn finish(&self) -> u64 {
+        self.0
+    }
+}
+
+pub(crate) fn keyexpr_hash(s: &str) -> u64 {
+    let mut hasher = KeyExprHasher::default();
+    hasher.write(s.as_bytes());
+    hasher.finish()
+}
+
+#[derive(Default)]
+struct KeyExprInternerState {
+    ids: HashMap<Box<str>, u32, BuildHasherDefault<KeyExprHasher>>,
+    keyexprs: Vec<KeyExpr<'static>>,
+}
+
+#[derive(Default)]
+pub struct KeyExprInterner(RwLock<KeyExprInternerState>);
+
+impl KeyExprInterner {
+    fn find(&self, ke: &str) -> Option<u32> {
+        self.0.read().ok()?.ids.get(ke).copied()
+    }
+
+    fn intern(&self, ke: &KeyExpr<'static>) -> Option<u32> {
+        if let Some(id) = self.find(ke.as_str()) {
+            return Some(id);
+        }
+        let mut state = self.0.write().ok()?;
+        // The key expression may have been interned by another thread in the meantime.
+        if let Some(id) = state.ids.get(ke.as_str()) {
+            return Some(*id);
+        }
+        let id = u32::try_from(state.keyexprs.len()).ok()?;
+        state.ids.insert(ke.as_str().into(), id);
+        state.keyexprs.push(ke.clone().into_owned());
+        Some(id)
+    }
+}
+
+decl_c_type!(
+    owned(zc_owned_keyexpr_interner_t, option KeyExprInterner),
+    loaned(zc_loaned_keyexpr_interner_t),
+);
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs an empty key expression interning table.
+///
+/// The table assigns to each distinct key expression a small integer id, starting from 0 and incremented
+/// by one for each new key expression, so that per-key state can be stored in an array indexed by the id,
+/// instead of in a hash table keyed by the key expression string. Ids are never reused, since entries are
+/// never removed from the table; it is thus meant to be used with a bounded set of key expressions, typically
+/// one table per session.
+///
+/// The table can be accessed concurrently from several threads, e.g. from subscriber callbacks.
+///
+/// @param this_: An uninitialized memory location where the table is to be constructed.
+/// @return 0 in case of success, negative error code otherwise.
+#[no_mangle]
+pub extern "C" fn zc_keyexpr_interner_new(
+    this_: &mut MaybeUninit<zc_owned_keyexpr_interner_t>,
+) -> z_result_t {
+    this_
+        .as_rust_type_mut_uninit()
+        .write(Some(KeyExprInterner::default()));
+    result::Z_OK
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs key expression interning table in its gravestone state.
+#[no_mangle]
+pub extern "C" fn zc_internal_keyexpr_interner_null(
+    this_: &mut MaybeUninit<zc_owned_keyexpr_interner_t>,
+) {
+    this_.as_rust_type_mut_uninit().write(None);
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns ``true`` if `this_` is in a valid state, ``false`` if it is in a gravestone state.
+#[no_mangle]
+pub extern "C" fn zc_internal_keyexpr_interner_check(this_: &zc_owned_keyexpr_interner_t) -> bool {
+    this_.as_rust_type_ref().is_some()
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Borrows key expression interning table.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn zc_keyexpr_interner_loan(
+    this_: &zc_owned_keyexpr_interner_t,
+) -> &zc_loaned_keyexpr_interner_t {
+    this_
+        .as_rust_type_ref()
+        .as_ref()
+        .unwrap_unchecked()
+        .as_loaned_c_type_ref()
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Frees memory and resets key expression interning table to its gravestone state.
+#[no_mangle]
+pub extern "C" fn zc_keyexpr_interner_drop(this_: &mut zc_moved_keyexpr_interner_t) {
+    let _ = this_.take_rust_type();
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns the number of key expressions interned in the table.
+#[no_mangle]
+pub extern "C" fn zc_keyexpr_interner_len(this_: &zc_loaned_keyexpr_interner_t) -> usize {
+    match this_.as_rust_type_ref().0.read() {
+        Ok(state) => state.keyexprs.len(),
+        Err(_) => 0,
+    }
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns the id of a key expression, adding it to the table if it is not interned yet.
+///
+/// Looking up an already interned key expression only takes a shared lock, so that it can be done for every
+/// received sample:
+/// @code{.c}
+/// uint32_t id;
+/// zc_keyexpr_interner_intern(z_loan(interner), z_sample_keyexpr(sample), &id);
+/// struct state *s = &states[id];
+/// @endcode
+///
+/// @param this_: The key expression interning table.
+/// @param key_expr: The key expression to intern. It is copied into the table if it was not interned yet.
+/// @param id: A memory location where the id of the key expression will be written.
+/// @return 0 in case of success, negative error code otherwise.
+#[no_mangle]
+pub extern "C" fn zc_keyexpr_interner_intern(
+    this_: &zc_loaned_keyexpr_interner_t,
+    key_expr: &z_loaned_keyexpr_t,
+    id: &mut u32,
+) -> z_result_t {
+    match this_.as_rust_type_ref().intern(key_expr.as_rust_type_ref()) {
+        Some(i) => {
+            *id = i;
+            result::Z_OK
+        }
+        None => {
+            tracing::error!(
+                "Failed to intern key expression {}",
+                key_expr.as_rust_type_ref()
+            );
+            result::Z_EGENERIC
+        }
+    }
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns the id of a key expression, without adding it to the table.
+///
+/// @param this_: The key expression interning table.
+/// @param key_expr: The key expression to look up.
+/// @param id: A memory location where the id of the key expression will be written.
+/// @return 0 in case of success, `Z_EUNAVAILABLE` if the key expression is not interned.
+#[no_mangle]
+pub extern "C" fn zc_keyexpr_interner_find(
+    this_: &zc_loaned_keyexpr_interner_t,
+    key_expr: &z_loaned_keyexpr_t,
+    id: &mut u32,
+) -> z_result_t {
+    match this_
+        .as_rust_type_ref()
+        .find(key_expr.as_rust_type_ref().as_str())
+    {
+        Some(i) => {
+            *id = i;
+            result::Z_OK
+        }
+        None => result::Z_EUNAVAILABLE,
+    }
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs a copy of the key expression interned with the given id.
+///
+/// @param this_: The key expression interning table.
+/// @param id: The id of the key expression.
+/// @param dst: An uninitialized memory location where the key expression is to be constructed.
+/// @return 0 in case of success, `Z_EINVAL` if no key expression was interned with this id.
+#[no_mangle]
+pub extern "C" fn zc_keyexpr_interner_get(
+    this_: &zc_loaned_keyexpr_interner_t,
+    id: u32,
+    dst: &mut MaybeUninit<z_owned_keyexpr_t>,
+) -> z_result_t {
+    let ke = match this_.as_rust_type_ref().0.read() {
+        Ok(state) => state.keyexprs.get(id as usize).cloned(),
+        Err(_) => None,
+    };
+    let res = if ke.is_some() {
+        result::Z_OK
+    } else {
+        result::Z_EINVAL
+    };
+    dst.as_rust_type_mut_uninit().write(ke);
+    res
+}
@@ -0,0 +1,251 @@
+//
+// Copyright (c) 2017, 2024 ZettaScale Technology.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh team, <zenoh@zettascale.tech>
+//
+
+use std::{collections::HashMap, mem::MaybeUninit, os::raw::c_void};
+
+use zenoh::key_expr::{keyexpr, KeyExpr};
+
+pub use crate::opaque_types::{
+    zc_loaned_keyexpr_matcher_t, zc_moved_keyexpr_matcher_t, zc_owned_keyexpr_matcher_t,
+};
+use crate::{
+    result::{self, z_result_t},
+    transmute::{LoanedCTypeRef, RustTypeRef, RustTypeRefUninit, TakeRustType},
+    z_loaned_keyexpr_t,
+};
+
+fn is_wild_chunk(chunk: &str) -> bool {
+    chunk.contains(['*', '$'])
+}
+
+/// A node of the chunk trie. Patterns are stored at the node reached by their longest prefix of
+/// non-wild chunks.
+#[derive(Default)]
+struct MatcherNode {
+    children: HashMap<Box<str>, MatcherNode>,
+    /// Patterns without wildcards, that end at this node.
+    exact: Vec<usize>,
+    /// Patterns whose next chunk, after this node, contains a wildcard.
+    wild: Vec<usize>,
+}
+
+impl MatcherNode {
+    fn for_each(&self, f: &mut impl FnMut(usize)) {
+        self.exact
+            .iter()
+            .chain(self.wild.iter())
+            .for_each(|i| f(*i));
+        for child in self.children.values() {
+            child.for_each(f);
+        }
+    }
+}
+
+struct KeyExprMatcherInner {
+    root: MatcherNode,
+    patterns: Vec<KeyExpr<'static>>,
+}
+
+pub struct KeyExprMatcher(Box<KeyExprMatcherInner>);
+
+impl KeyExprMatcherInner {
+    fn new(patterns: Vec<KeyExpr<'static>>) -> Self {
+        let mut root = MatcherNode::default();
+        for (i, pattern) in patterns.iter().enumerate() {
+            let mut node = &mut root;
+            let mut is_wild = false;
+            for chunk in pattern.as_str().split('/') {
+                if is_wild_chunk(chunk) {
+                    is_wild = true;
+                    break;
+                }
+                node = node.children.entry(chunk.into()).or_default();
+            }
+            if is_wild {
+                node.wild.push(i);
+            } else {
+                node.exact.push(i);
+            }
+        }
+        KeyExprMatcherInner { root, patterns }
+    }
+
+    /// Calls `f` on the index of every pattern `p` such that `check(p, ke)` is ``true``.
+    /// Only patterns sharing their non-wild prefix with `ke` are checked, other ones can not match.
+    fn matches(
+        &self,
+        ke: &keyexpr,
+        check: impl Fn(&keyexpr, &keyexpr) -> bool,
+        mut f: impl FnMut(usize),
+    ) -> usize {
+        let mut n = 0;
+        let mut emit = |i: usize, verify: bool| {
+            if !verify || check(&self.patterns[i], ke) {
+                n += 1;
+                f(i);
+            }
+        };
+        let mut node = &self.root;
+        for chunk in ke.as_str().split('/') {
+            if is_wild_chunk(chunk) {
+                node.for_each(&mut |i| emit(i, true));
+                return n;
+            }
+            node.wild.iter().for_each(|i| emit(*i, true));
+            match node.children.get(chunk) {
+                Some(child) => node = child,
+                None => return n,
+            }
+        }
+        // Both the key expression and these patterns have no wildcards and are equal.
+        node.exact.iter().for_each(|i| emit(*i, false));
+        node.wild.iter().for_each(|i| emit(*i, true));
+        n
+    }
+}
+
+decl_c_type!(
+    owned(zc_owned_keyexpr_matcher_t, option KeyExprMatcher),
+    loaned(zc_loaned_keyexpr_matcher_t),
+);
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs a matcher from a set of key expressions.
+///
+/// The matcher organizes the key expressions in a tree of chunks, so that finding the ones matching a given key expression
+/// only requires to check those sharing its non-wild prefix, instead of all of them.
+///
+/// @param this_: An uninitialized memory location where the matcher is to be constructed.
+/// @param keyexprs: A pointer to an array of `len` key expressions. They are copied into the matcher.
+/// Each key expression is then identified by its index in this array.
+/// @param len: Number of key expressions.
+/// @return 0 in case of success, negative error code otherwise.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn zc_keyexpr_matcher_new(
+    this_: &mut MaybeUninit<zc_owned_keyexpr_matcher_t>,
+    keyexprs: *const &z_loaned_keyexpr_t,
+    len: usize,
+) -> z_result_t {
+    if keyexprs.is_null() && len > 0 {
+        tracing::error!("Key expressions array should not be null");
+        this_.as_rust_type_mut_uninit().write(None);
+        return result::Z_EINVAL;
+    }
+    let patterns = (0..len)
+        .map(|i| (*keyexprs.add(i)).as_rust_type_ref().clone().into_owned())
+        .collect();
+    this_
+        .as_rust_type_mut_uninit()
+        .write(Some(KeyExprMatcher(Box::new(KeyExprMatcherInner::new(
+            patterns,
+        )))));
+    result::Z_OK
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs matcher in its gravestone state.
+#[no_mangle]
+pub extern "C" fn zc_internal_keyexpr_matcher_null(
+    this_: &mut MaybeUninit<zc_owned_keyexpr_matcher_t>,
+) {
+    this_.as_rust_type_mut_uninit().write(None);
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns ``true`` if `this_` is in a valid state, ``false`` if it is in a gravestone state.
+#[no_mangle]
+pub extern "C" fn zc_internal_keyexpr_matcher_check(this_: &zc_owned_keyexpr_matcher_t) -> bool {
+    this_.as_rust_type_ref().is_some()
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Borrows matcher.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn zc_keyexpr_matcher_loan(
+    this_: &zc_owned_keyexpr_matcher_t,
+) -> &zc_loaned_keyexpr_matcher_t {
+    this_
+        .as_rust_type_ref()
+        .as_ref()
+        .unwrap_unchecked()
+        .as_loaned_c_type_ref()
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Frees memory and resets matcher to its gravestone state.
+#[no_mangle]
+pub extern "C" fn zc_keyexpr_matcher_drop(this_: &mut zc_moved_keyexpr_matcher_t) {
+    let _ = this_.take_rust_type();
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns the number of key expressions of the matcher.
+#[no_mangle]
+pub extern "C" fn zc_keyexpr_matcher_len(this_: &zc_loaned_keyexpr_matcher_t) -> usize {
+    this_.as_rust_type_ref().0.patterns.len()
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Finds all key expressions of the matcher that intersect with `key_expr`.
+///
+/// @param this_: The matcher.
+/// @param key_expr: The key expression to match.
+/// @param callback: A function called with the index of each intersecting key expression, in no particular order.
+/// @param context: An optional context to be passed to `callback`.
+/// @return The number of intersecting key expressions.
+#[no_mangle]
+pub extern "C" fn zc_keyexpr_matcher_intersects(
+    this_: &zc_loaned_keyexpr_matcher_t,
+    key_expr: &z_loaned_keyexpr_t,
+    callback: Option<extern "C" fn(index: usize, context: *mut c_void)>,
+    context: *mut c_void,
+) -> usize {
+    this_.as_rust_type_ref().0.matches(
+        key_expr.as_rust_type_ref(),
+        |p, ke| p.intersects(ke),
+        |i| {
+            if let Some(cb) = callback {
+                cb(i, context)
+            }
+        },
+    )
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Finds all key expressions of the matcher that include `key_expr`.
+///
+/// @param this_: The matcher.
+/// @param key_expr: The key expression to match.
+/// @param callback: A function called with the index of each including key expression, in no particular order.
+/// @param context: An optional context to be passed to `callback`.
+/// @return The number of including key expressions.
+#[no_mangle]
+pub extern "C" fn zc_keyexpr_matcher_includes(
+    this_: &zc_loaned_keyexpr_matcher_t,
+    key_expr: &z_loaned_keyexpr_t,
+    callback: Option<extern "C" fn(index: usize, context: *mut c_void)>,
+    context: *mut c_void,
+) -> usize {
+    this_.as_rust_type_ref().0.matches(
+        key_expr.as_rust_type_ref(),
+        |p, ke| p.includes(ke),
+        |i| {
+            if let Some(cb) = callback {
+                cb(i, context)
+            }
+        },
+    )
+}
@@ -35,12 +35,48 @@ mod close;
 pub use crate::close::*;
 pub mod encoding;
 pub use crate::encoding::*;
+#[cfg(feature = "unstable")]
+mod encoding_interner;
+#[cfg(feature = "unstable")]
+pub use crate::encoding_interner::*;
 mod commons;
 pub use crate::commons::*;
 mod zbytes;
 pub use crate::zbytes::*;
+#[cfg(feature = "unstable")]
+mod bytes_pool;
+#[cfg(feature = "unstable")]
+pub use crate::bytes_pool::*;
+#[cfg(feature = "unstable")]
+mod bytes_file;
+#[cfg(feature = "unstable")]
+pub use crate::bytes_file::*;
+#[cfg(feature = "unstable")]
+mod compression;
+#[cfg(feature = "unstable")]
+pub use crate::compression::*;
+#[cfg(feature = "unstable")]
+mod delta;
+#[cfg(feature = "unstable")]
+pub use crate::delta::*;
+#[cfg(feature = "unstable")]
+mod cancellation;
+#[cfg(feature = "unstable")]
+pub use crate::cancellation::*;
+#[cfg(feature = "alloc-stats")]
+mod alloc_stats;
+#[cfg(feature = "alloc-stats")]
+pub use crate::alloc_stats::*;
 mod keyexpr;
 pub use crate::keyexpr::*;
+#[cfg(feature = "unstable")]
+mod keyexpr_matcher;
+#[cfg(feature = "unstable")]
+pub use crate::keyexpr_matcher::*;
+#[cfg(feature = "unstable")]
+mod keyexpr_interner;
+#[cfg(feature = "unstable")]
+pub use crate::keyexpr_interner::*;
 mod info;
 pub use crate::info::*;
 mod get;
@@ -61,6 +97,26 @@ mod subscriber;
 pub use crate::subscriber::*;
 mod publisher;
 pub use crate::publisher::*;
+#[cfg(feature = "unstable")]
+mod entity_stats;
+#[cfg(feature = "unstable")]
+pub use crate::entity_stats::*;
+#[cfg(feature = "unstable")]
+mod spans;
+#[cfg(feature = "unstable")]
+pub use crate::spans::*;
+#[cfg(feature = "unstable")]
+mod watchdog;
+#[cfg(feature = "unstable")]
+pub use crate::watchdog::*;
+#[cfg(feature = "unstable")]
+mod runtime;
+#[cfg(feature = "unstable")]
+pub use crate::runtime::*;
+#[cfg(feature = "unstable")]
+mod deferred;
+#[cfg(feature = "unstable")]
+pub use crate::deferred::*;
 mod closures;
 pub use closures::*;
 pub mod platform;
@@ -72,6 +128,12 @@ mod matching;
 #[cfg(feature = "unstable")]
 pub use matching::*;
 #[cfg(feature = "unstable")]
+mod cache_budget;
+#[cfg(feature = "unstable")]
+pub use cache_budget::*;
+#[cfg(feature = "unstable")]
+mod cache_log;
+#[cfg(feature = "unstable")]
 mod publication_cache;
 #[cfg(feature = "unstable")]
 pub use publication_cache::*;
@@ -84,6 +146,10 @@ mod advanced_subscriber;
 #[cfg(feature = "unstable")]
 pub use advanced_subscriber::*;
 #[cfg(feature = "unstable")]
+mod advanced_history;
+#[cfg(feature = "unstable")]
+pub use advanced_history::*;
+#[cfg(feature = "unstable")]
 mod advanced_publisher;
 #[cfg(feature = "unstable")]
 pub use advanced_publisher::*;
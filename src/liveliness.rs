@@ -13,7 +13,16 @@
 //
 
 use std::mem::MaybeUninit;
+#[cfg(feature = "unstable")]
+use std::{
+    collections::{HashMap, HashSet},
+    sync::{Arc, Mutex, MutexGuard},
+};
 
+#[cfg(feature = "unstable")]
+use libc::c_char;
+#[cfg(feature = "unstable")]
+use zenoh::sample::SampleKind;
 use zenoh::{
     handlers::Callback,
     liveliness::{LivelinessSubscriberBuilder, LivelinessToken},
@@ -29,6 +38,12 @@ use crate::{
     z_loaned_keyexpr_t, z_loaned_session_t, z_moved_closure_reply_t, z_moved_closure_sample_t,
     z_moved_liveliness_token_t, z_owned_subscriber_t,
 };
+#[cfg(feature = "unstable")]
+use crate::{
+    z_view_keyexpr_from_substr_unchecked, z_view_keyexpr_t, zc_closure_liveliness_changes_call,
+    zc_closure_liveliness_changes_loan, zc_moved_closure_liveliness_changes_t,
+    zc_owned_closure_liveliness_changes_t,
+};
 decl_c_type!(
     owned(z_owned_liveliness_token_t, option LivelinessToken),
     loaned(z_loaned_liveliness_token_t),
@@ -112,6 +127,62 @@ pub extern "C" fn z_liveliness_declare_token(
     }
 }
 
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs and declares several liveliness tokens at once.
+///
+/// This is a convenience loop over `z_liveliness_declare_token()`: the tokens are declared one by one, sending the same
+/// declaration messages, so neither the number of messages nor the number of round trips is reduced. The function
+/// returns once all tokens are declared.
+///
+/// @param session: A Zenoh session to declare the liveliness tokens.
+/// @param tokens: An array of `len` uninitialized memory locations where the liveliness tokens will be constructed.
+/// @param key_exprs: An array of `len` keyexprs to declare liveliness tokens for.
+/// @param len: The number of tokens.
+/// @param _options: Liveliness token declaration properties, applied to all tokens.
+///
+/// @return 0 in case of success, negative error code otherwise. In this case, the tokens which were already declared
+/// are undeclared, and all tokens are in their gravestone state.
+#[cfg(feature = "unstable")]
+#[allow(clippy::missing_safety_doc)]
+#[no_mangle]
+pub unsafe extern "C" fn zc_liveliness_declare_tokens(
+    session: &z_loaned_session_t,
+    tokens: *mut MaybeUninit<z_owned_liveliness_token_t>,
+    key_exprs: *const &z_loaned_keyexpr_t,
+    len: usize,
+    _options: Option<&z_liveliness_token_options_t>,
+) -> result::z_result_t {
+    if (tokens.is_null() || key_exprs.is_null()) && len > 0 {
+        tracing::error!("Tokens and key expressions arrays should not be null");
+        return result::Z_EINVAL;
+    }
+    let liveliness = session.as_rust_type_ref().liveliness();
+    let mut declared = Vec::with_capacity(len);
+    let mut res = result::Z_OK;
+    for i in 0..len {
+        match liveliness
+            .declare_token((*key_exprs.add(i)).as_rust_type_ref())
+            .wait()
+        {
+            Ok(token) => declared.push(token),
+            Err(e) => {
+                tracing::error!("Failed to declare liveliness token {}: {e}", i);
+                res = result::Z_EGENERIC;
+                break;
+            }
+        }
+    }
+    if res != result::Z_OK {
+        declared.clear();
+    }
+    let tokens = std::slice::from_raw_parts_mut(tokens, len);
+    let mut declared = declared.into_iter();
+    for t in tokens {
+        t.as_rust_type_mut_uninit().write(declared.next());
+    }
+    res
+}
+
 /// @brief Destroys a liveliness token, notifying subscribers of its destruction.
 #[no_mangle]
 pub extern "C" fn z_liveliness_undeclare_token(
@@ -276,3 +347,319 @@ pub extern "C" fn z_liveliness_get(
         }
     }
 }
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief A batch of liveliness token key expressions, packed one after the other in a single buffer.
+///
+/// The key expression `i` is the string of `offsets[i + 1] - offsets[i]` bytes starting at `data + offsets[i]`, it is not
+/// null-terminated. It can be obtained as a `z_view_keyexpr_t` with `zc_liveliness_tokens_get()`. The batch is only
+/// valid during the call to the closure it is passed to.
+#[cfg(feature = "unstable")]
+#[repr(C)]
+pub struct zc_liveliness_tokens_t {
+    /// The key expressions.
+    pub data: *const c_char,
+    /// The `len + 1` offsets of the key expressions in `data`.
+    pub offsets: *const usize,
+    /// The number of key expressions.
+    pub len: usize,
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief The changes of the liveliness tokens watched by a subscriber declared with
+/// `zc_liveliness_declare_snapshot_subscriber()`.
+#[cfg(feature = "unstable")]
+#[repr(C)]
+pub struct zc_liveliness_changes_t {
+    /// `true` for the first batch, in which `joined` holds all alive tokens and `left` is empty.
+    pub is_snapshot: bool,
+    /// The tokens which are alive.
+    pub joined: zc_liveliness_tokens_t,
+    /// The tokens which are no longer alive.
+    pub left: zc_liveliness_tokens_t,
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Gets a key expression of a batch of liveliness tokens.
+///
+/// @param this_: The batch.
+/// @param index: The index of the key expression, less than `this_->len`.
+/// @param key_expr: An uninitialized memory location where the key expression will be constructed. It aliases the
+/// batch, so it must not be used once the callback receiving the batch has returned.
+/// @return 0 in case of success, `Z_EINVAL` if `index` is out of bounds.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn zc_liveliness_tokens_get(
+    this_: &zc_liveliness_tokens_t,
+    index: usize,
+    key_expr: &mut MaybeUninit<z_view_keyexpr_t>,
+) -> result::z_result_t {
+    if index >= this_.len {
+        key_expr.as_rust_type_mut_uninit().write(None);
+        return result::Z_EINVAL;
+    }
+    let start = *this_.offsets.add(index);
+    let end = *this_.offsets.add(index + 1);
+    z_view_keyexpr_from_substr_unchecked(key_expr, this_.data.add(start), end - start);
+    result::Z_OK
+}
+
+/// The key expressions of a `zc_liveliness_tokens_t`.
+#[cfg(feature = "unstable")]
+struct TokenBatch {
+    data: String,
+    offsets: Vec<usize>,
+}
+
+#[cfg(feature = "unstable")]
+impl TokenBatch {
+    fn new() -> Self {
+        TokenBatch {
+            data: String::new(),
+            offsets: vec![0],
+        }
+    }
+
+    fn is_empty(&self) -> bool {
+        self.offsets.len() == 1
+    }
+
+    fn push(&mut self, key_expr: &str) {
+        self.data.push_str(key_expr);
+        self.offsets.push(self.data.len());
+    }
+
+    fn as_c(&self) -> zc_liveliness_tokens_t {
+        zc_liveliness_tokens_t {
+            data: self.data.as_ptr() as *const c_char,
+            offsets: self.offsets.as_ptr(),
+            len: self.offsets.len() - 1,
+        }
+    }
+}
+
+#[cfg(feature = "unstable")]
+#[derive(Default)]
+struct SnapshotState {
+    // The tokens replied to the liveliness query, `None` once the snapshot is delivered.
+    snapshot: Option<HashSet<Box<str>>>,
+    // The last state of the tokens which changed since the previous batch, `true` if alive.
+    pending: HashMap<Box<str>, bool>,
+    // Set while a batch is being delivered, so that changes received meanwhile are batched.
+    delivering: bool,
+    // Set once the subscriber is declared, the snapshot being delivered by the declaring thread if the query was
+    // finalized before.
+    declared: bool,
+    query_done: bool,
+}
+
+#[cfg(feature = "unstable")]
+struct SnapshotSubscriber {
+    state: Mutex<SnapshotState>,
+    callback: zc_owned_closure_liveliness_changes_t,
+}
+
+#[cfg(feature = "unstable")]
+impl SnapshotSubscriber {
+    fn state(&self) -> MutexGuard<'_, SnapshotState> {
+        self.state.lock().unwrap_or_else(|e| e.into_inner())
+    }
+
+    fn on_reply(&self, key_expr: &str) {
+        if let Some(snapshot) = self.state().snapshot.as_mut() {
+            snapshot.insert(key_expr.into());
+        }
+    }
+
+    fn on_change(&self, key_expr: &str, alive: bool) {
+        let mut state = self.state();
+        state.pending.insert(key_expr.into(), alive);
+        if state.snapshot.is_none() && !state.delivering {
+            self.deliver(state, None);
+        }
+    }
+
+    /// Called once all replies to the liveliness query are received.
+    fn finish_query(&self) {
+        let mut state = self.state();
+        state.query_done = true;
+        if state.declared {
+            self.deliver_snapshot(state);
+        }
+    }
+
+    /// Called once the subscriber is successfully declared.
+    fn finish_declaration(&self) {
+        let mut state = self.state();
+        state.declared = true;
+        if state.query_done {
+            self.deliver_snapshot(state);
+        }
+    }
+
+    fn deliver_snapshot(&self, mut state: MutexGuard<'_, SnapshotState>) {
+        let Some(mut snapshot) = state.snapshot.take() else {
+            return;
+        };
+        // Changes received during the query are more recent than its replies.
+        for (key_expr, alive) in state.pending.drain() {
+            if alive {
+                snapshot.insert(key_expr);
+            } else {
+                snapshot.remove(&key_expr);
+            }
+        }
+        let mut joined = TokenBatch::new();
+        for key_expr in snapshot {
+            joined.push(&key_expr);
+        }
+        self.deliver(state, Some(joined));
+    }
+
+    /// Calls the callback with the snapshot if any, then with the pending changes until there are none left.
+    fn deliver(&self, mut state: MutexGuard<'_, SnapshotState>, snapshot: Option<TokenBatch>) {
+        state.delivering = true;
+        let mut is_snapshot = snapshot.is_some();
+        let mut joined = snapshot.unwrap_or_else(TokenBatch::new);
+        let mut left = TokenBatch::new();
+        loop {
+            for (key_expr, alive) in state.pending.drain() {
+                if alive {
+                    joined.push(&key_expr);
+                } else {
+                    left.push(&key_expr);
+                }
+            }
+            if !is_snapshot && joined.is_empty() && left.is_empty() {
+                state.delivering = false;
+                return;
+            }
+            drop(state);
+            let changes = zc_liveliness_changes_t {
+                is_snapshot,
+                joined: joined.as_c(),
+                left: left.as_c(),
+            };
+            zc_closure_liveliness_changes_call(
+                zc_closure_liveliness_changes_loan(&self.callback),
+                &changes,
+            );
+            is_snapshot = false;
+            joined = TokenBatch::new();
+            left = TokenBatch::new();
+            state = self.state();
+        }
+    }
+}
+
+/// Notifies the subscriber when dropped, i.e. once the liveliness query is finalized.
+#[cfg(feature = "unstable")]
+struct SnapshotGuard(Arc<SnapshotSubscriber>);
+
+#[cfg(feature = "unstable")]
+impl Drop for SnapshotGuard {
+    fn drop(&mut self) {
+        self.0.finish_query();
+    }
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief The options for `zc_liveliness_declare_snapshot_subscriber()`.
+#[cfg(feature = "unstable")]
+#[repr(C)]
+pub struct zc_liveliness_snapshot_subscriber_options_t {
+    /// The timeout of the liveliness query building the snapshot in milliseconds, 0 for the default query timeout
+    /// from the zenoh configuration.
+    pub timeout_ms: u64,
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs the default value for `zc_liveliness_snapshot_subscriber_options_t`.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn zc_liveliness_snapshot_subscriber_options_default(
+    this: &mut MaybeUninit<zc_liveliness_snapshot_subscriber_options_t>,
+) {
+    this.write(zc_liveliness_snapshot_subscriber_options_t { timeout_ms: 10000 });
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Declares a subscriber on liveliness tokens that intersect `key_expr`, receiving the alive tokens as a single
+/// snapshot and then batches of joined and left tokens.
+///
+/// Unlike `z_liveliness_declare_subscriber()` with `history`, which calls the sample callback once per alive token,
+/// the callback is first called once with all alive tokens, packed in a single buffer. The snapshot is built from a
+/// liveliness query and the changes received while it is running, and delivered once the query is complete.
+///
+/// The callback is then called with the tokens which joined or left since the previous call. Changes received while
+/// the callback runs are batched for its next call, so that bursts of declarations and undeclarations result in few
+/// calls. A batch only holds the last state of each token: a token may be reported as left without having been reported
+/// as joined, or as joined while it was already alive, so batches should be applied as insertions and removals in a set.
+///
+/// @param session: A Zenoh session.
+/// @param subscriber: An uninitialized memory location where subscriber will be constructed.
+/// @param key_expr: The key expression to subscribe to.
+/// @param callback: The callback function that will be called with the changes of the liveliness tokens.
+/// @param options: The options to be passed to the liveliness subscriber declaration.
+///
+/// @return 0 in case of success, negative error values otherwise.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn zc_liveliness_declare_snapshot_subscriber(
+    session: &z_loaned_session_t,
+    subscriber: &mut MaybeUninit<z_owned_subscriber_t>,
+    key_expr: &z_loaned_keyexpr_t,
+    callback: &mut zc_moved_closure_liveliness_changes_t,
+    options: Option<&mut zc_liveliness_snapshot_subscriber_options_t>,
+) -> result::z_result_t {
+    let this = subscriber.as_rust_type_mut_uninit();
+    let session = session.as_rust_type_ref();
+    let key_expr = key_expr.as_rust_type_ref();
+    let shared = Arc::new(SnapshotSubscriber {
+        state: Mutex::new(SnapshotState {
+            snapshot: Some(HashSet::new()),
+            ..Default::default()
+        }),
+        callback: callback.take_rust_type(),
+    });
+    // The subscriber is declared first, so that no change is missed between the query and the subscription.
+    let changes = shared.clone();
+    let declared = session
+        .liveliness()
+        .declare_subscriber(key_expr)
+        .callback(move |sample| {
+            changes.on_change(sample.key_expr().as_str(), sample.kind() == SampleKind::Put)
+        })
+        .wait();
+    let sub = match declared {
+        Ok(sub) => sub,
+        Err(e) => {
+            tracing::error!("Failed to subscribe to liveliness: {e}");
+            this.write(None);
+            return result::Z_EGENERIC;
+        }
+    };
+    let guard = SnapshotGuard(shared.clone());
+    let liveliness = session.liveliness();
+    let mut builder = liveliness.get(key_expr).callback(move |reply| {
+        if let Ok(sample) = reply.result() {
+            guard.0.on_reply(sample.key_expr().as_str());
+        }
+    });
+    if let Some(timeout_ms) = options.map(|o| o.timeout_ms).filter(|t| *t != 0) {
+        builder = builder.timeout(core::time::Duration::from_millis(timeout_ms));
+    }
+    match builder.wait() {
+        Ok(()) => {
+            this.write(Some(sub));
+            shared.finish_declaration();
+            result::Z_OK
+        }
+        Err(e) => {
+            tracing::error!("Failed to query liveliness tokens: {e}");
+            this.write(None);
+            result::Z_EGENERIC
+        }
+    }
+}
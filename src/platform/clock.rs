@@ -1,3 +1,11 @@
+#[cfg(feature = "unstable")]
+use std::{
+    mem::MaybeUninit,
+    sync::{
+        atomic::{AtomicU64, Ordering},
+        OnceLock,
+    },
+};
 use std::{
     os::raw::c_void,
     time::{Duration, Instant, SystemTime, UNIX_EPOCH},
@@ -7,6 +15,8 @@ use chrono::{DateTime, Local};
 use lazy_static::lazy_static;
 use libc::c_char;
 
+#[cfg(feature = "unstable")]
+use crate::result;
 use crate::CopyableToCArray;
 
 // Use initial time stored in static variable as a reference time,
@@ -71,6 +81,177 @@ pub unsafe extern "C" fn z_clock_elapsed_us(time: *const z_clock_t) -> u64 {
     get_elapsed_nanos(time) / 1_000
 }
 
+/// The instant of a clock time point, e.g. the deadline of a wait.
+pub(crate) fn clock_instant(time: &z_clock_t) -> Instant {
+    *CLOCK_BASE + Duration::from_nanos(time.t)
+}
+
+/// Offsets `time` by `duration` seconds.
+#[no_mangle]
+pub extern "C" fn z_clock_advance_s(time: &mut z_clock_t, duration: u64) {
+    time.t = time
+        .t
+        .saturating_add(duration.saturating_mul(1_000_000_000));
+}
+
+/// Offsets `time` by `duration` milliseconds.
+#[no_mangle]
+pub extern "C" fn z_clock_advance_ms(time: &mut z_clock_t, duration: u64) {
+    time.t = time.t.saturating_add(duration.saturating_mul(1_000_000));
+}
+
+/// Offsets `time` by `duration` microseconds.
+#[no_mangle]
+pub extern "C" fn z_clock_advance_us(time: &mut z_clock_t, duration: u64) {
+    time.t = time.t.saturating_add(duration.saturating_mul(1_000));
+}
+
+/// Offsets `time` by `duration` nanoseconds.
+#[no_mangle]
+pub extern "C" fn z_clock_advance_ns(time: &mut z_clock_t, duration: u64) {
+    time.t = time.t.saturating_add(duration);
+}
+
+/// Get number of nanoseconds passed since creation of `time`.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_clock_elapsed_ns(time: *const z_clock_t) -> u64 {
+    get_elapsed_nanos(time)
+}
+
+/// Reads the CPU counter also read by `zc_clock_tsc_read()`, if it is usable as a clock.
+#[cfg(all(feature = "unstable", target_arch = "x86_64"))]
+fn read_tsc() -> Option<u64> {
+    use std::arch::x86_64::{__cpuid, _rdtsc};
+    lazy_static! {
+        // The TSC only ticks at a constant rate across power states and cores when it is invariant.
+        static ref INVARIANT_TSC: bool = unsafe {
+            __cpuid(0x8000_0000).eax >= 0x8000_0007 && __cpuid(0x8000_0007).edx & (1 << 8) != 0
+        };
+    }
+    INVARIANT_TSC.then(|| unsafe { _rdtsc() })
+}
+
+#[cfg(all(feature = "unstable", target_arch = "aarch64"))]
+fn read_tsc() -> Option<u64> {
+    let ticks: u64;
+    unsafe { std::arch::asm!("mrs {}, cntvct_el0", out(reg) ticks, options(nomem, nostack)) };
+    Some(ticks)
+}
+
+#[cfg(all(
+    feature = "unstable",
+    not(any(target_arch = "x86_64", target_arch = "aarch64"))
+))]
+fn read_tsc() -> Option<u64> {
+    None
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief The calibration of the CPU counter read by `zc_clock_tsc_read()`, i.e. the TSC on x86_64 and the virtual
+/// counter `CNTVCT_EL0` on aarch64.
+#[cfg(feature = "unstable")]
+#[repr(C)]
+#[derive(Clone, Copy, Default)]
+pub struct zc_clock_tsc_calibration_t {
+    /// The duration of a tick of the counter, in nanoseconds.
+    pub ns_per_tick: f64,
+    /// The value of the counter at the end of the calibration.
+    pub ticks_base: u64,
+    /// The system time at the end of the calibration, in nanoseconds since the UNIX epoch.
+    pub unix_ns_base: u64,
+}
+
+#[cfg(feature = "unstable")]
+impl zc_clock_tsc_calibration_t {
+    fn unix_ns(&self, ticks: u64) -> u64 {
+        let elapsed = ticks.saturating_sub(self.ticks_base) as f64 * self.ns_per_tick;
+        self.unix_ns_base + elapsed as u64
+    }
+}
+
+// The first calibration, used by `zc_timestamp_new_fast()`.
+#[cfg(feature = "unstable")]
+static TSC_CALIBRATION: OnceLock<zc_clock_tsc_calibration_t> = OnceLock::new();
+// The last NTP64 time returned by `fast_ntp64_now()`.
+#[cfg(feature = "unstable")]
+static FAST_CLOCK_LAST: AtomicU64 = AtomicU64::new(0);
+#[cfg(feature = "unstable")]
+lazy_static! {
+    static ref FAST_CLOCK_BASE: (Instant, u64) = (Instant::now(), unix_now_ns());
+}
+
+#[cfg(feature = "unstable")]
+fn unix_now_ns() -> u64 {
+    SystemTime::now()
+        .duration_since(UNIX_EPOCH)
+        .unwrap_or(Duration::new(0, 0))
+        .as_nanos() as u64
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Measures the rate of the CPU counter read by `zc_clock_tsc_read()` against the monotonic clock.
+///
+/// The calibration blocks the calling thread for `duration_ms`; a longer calibration gives a more accurate rate. The first
+/// successful calibration of the process is also used by `zc_timestamp_new_fast()`.
+///
+/// @param this_: An uninitialized memory location where the calibration will be written.
+/// @param duration_ms: The duration of the measurement in milliseconds, 0 for 10 ms.
+/// @return 0 in case of success, `Z_EUNAVAILABLE` if the platform has no CPU counter ticking at a constant rate.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn zc_clock_tsc_calibrate(
+    this_: &mut MaybeUninit<zc_clock_tsc_calibration_t>,
+    duration_ms: u32,
+) -> result::z_result_t {
+    let (Some(start_ticks), start) = (read_tsc(), Instant::now()) else {
+        this_.write(zc_clock_tsc_calibration_t::default());
+        return result::Z_EUNAVAILABLE;
+    };
+    let duration_ms = if duration_ms == 0 { 10 } else { duration_ms };
+    std::thread::sleep(Duration::from_millis(duration_ms as u64));
+    let (end_ticks, elapsed, unix_ns_base) =
+        (read_tsc().unwrap_or(0), start.elapsed(), unix_now_ns());
+    if end_ticks <= start_ticks {
+        this_.write(zc_clock_tsc_calibration_t::default());
+        return result::Z_EUNAVAILABLE;
+    }
+    let calibration = zc_clock_tsc_calibration_t {
+        ns_per_tick: elapsed.as_nanos() as f64 / (end_ticks - start_ticks) as f64,
+        ticks_base: end_ticks,
+        unix_ns_base,
+    };
+    let _ = TSC_CALIBRATION.set(calibration);
+    this_.write(calibration);
+    result::Z_OK
+}
+
+/// The current NTP64 time, strictly increasing across the calls of the process.
+///
+/// The time is extrapolated from the calibrated CPU counter, or from the monotonic clock if it is not calibrated, so that
+/// it neither takes a lock nor reads the system clock. Like the HLC, the 4 low bits act as a counter for the times which
+/// would otherwise be equal.
+#[cfg(feature = "unstable")]
+pub(crate) fn fast_ntp64_now() -> u64 {
+    const CMASK: u64 = (1 << 4) - 1;
+    let unix_ns = match TSC_CALIBRATION.get().zip(read_tsc()) {
+        Some((calibration, ticks)) => calibration.unix_ns(ticks),
+        None => FAST_CLOCK_BASE.1 + FAST_CLOCK_BASE.0.elapsed().as_nanos() as u64,
+    };
+    let (secs, nanos) = (unix_ns / 1_000_000_000, unix_ns % 1_000_000_000);
+    let now = ((secs << 32) + ((nanos << 32) / 1_000_000_000)) & !CMASK;
+    let previous = FAST_CLOCK_LAST
+        .fetch_update(Ordering::Relaxed, Ordering::Relaxed, |last| {
+            Some(if now > last { now } else { last + 1 })
+        })
+        .unwrap_or_else(|last| last);
+    if now > previous {
+        now
+    } else {
+        previous + 1
+    }
+}
+
 /// Returns system clock time point corresponding to the current time instant.
 #[repr(C)]
 #[derive(Clone, Copy)]
@@ -0,0 +1,457 @@
+//
+// Copyright (c) 2017, 2024 ZettaScale Technology.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh team, <zenoh@zettascale.tech>
+//
+
+use std::{
+    collections::VecDeque,
+    iter,
+    mem::MaybeUninit,
+    sync::{
+        atomic::{AtomicBool, AtomicUsize, Ordering},
+        Arc, Condvar, Mutex, MutexGuard,
+    },
+    thread::{self, JoinHandle},
+};
+
+use crossbeam_deque::{Injector, Stealer, Worker};
+use libc::c_void;
+
+pub use crate::opaque_types::{z_loaned_executor_t, z_moved_executor_t, z_owned_executor_t};
+use crate::{
+    platform::synchronization::{FunArgPair, Task},
+    result,
+    transmute::{LoanedCTypeRef, RustTypeRef, RustTypeRefUninit, TakeRustType},
+    z_owned_task_t,
+};
+
+type Job = Box<dyn FnOnce() + Send>;
+
+struct ExecutorState {
+    injector: Injector<Job>,
+    stealers: Vec<Stealer<Job>>,
+    // The number of spawned jobs which are not started yet, including the ones being pushed to the injector.
+    pending: AtomicUsize,
+    // The number of workers waiting for a job, so that spawning only takes the lock when one needs to be woken up.
+    sleeping: AtomicUsize,
+    shutdown: AtomicBool,
+    sleep: Mutex<()>,
+    wake: Condvar,
+}
+
+impl ExecutorState {
+    fn lock(&self) -> MutexGuard<'_, ()> {
+        self.sleep.lock().unwrap_or_else(|e| e.into_inner())
+    }
+
+    fn find_job(&self, local: &Worker<Job>) -> Option<Job> {
+        local.pop().or_else(|| {
+            iter::repeat_with(|| {
+                self.injector
+                    .steal_batch_and_pop(local)
+                    .or_else(|| self.stealers.iter().map(|s| s.steal()).collect())
+            })
+            .find(|s| !s.is_retry())
+            .and_then(|s| s.success())
+        })
+    }
+
+    fn run_worker(&self, local: Worker<Job>) {
+        loop {
+            if let Some(job) = self.find_job(&local) {
+                self.pending.fetch_sub(1, Ordering::SeqCst);
+                job();
+                continue;
+            }
+            let mut guard = self.lock();
+            self.sleeping.fetch_add(1, Ordering::SeqCst);
+            // Spawned jobs are run before exiting, so that the executor is drained when it is dropped.
+            while self.pending.load(Ordering::SeqCst) == 0 {
+                if self.shutdown.load(Ordering::SeqCst) {
+                    self.sleeping.fetch_sub(1, Ordering::SeqCst);
+                    return;
+                }
+                guard = self.wake.wait(guard).unwrap_or_else(|e| e.into_inner());
+            }
+            self.sleeping.fetch_sub(1, Ordering::SeqCst);
+        }
+    }
+}
+
+/// A pool of threads running jobs, idle threads stealing the jobs queued by the busy ones.
+pub(crate) struct Executor {
+    state: Arc<ExecutorState>,
+    threads: Vec<JoinHandle<()>>,
+}
+
+impl Executor {
+    pub(crate) fn spawn(&self, job: impl FnOnce() + Send + 'static) {
+        // Counted before being pushed, so that a worker popping it right away never decrements the count below 0.
+        self.state.pending.fetch_add(1, Ordering::SeqCst);
+        self.state.injector.push(Box::new(job));
+        if self.state.sleeping.load(Ordering::SeqCst) > 0 {
+            let _guard = self.state.lock();
+            self.state.wake.notify_one();
+        }
+    }
+}
+
+impl Drop for Executor {
+    fn drop(&mut self) {
+        self.state.shutdown.store(true, Ordering::SeqCst);
+        {
+            let _guard = self.state.lock();
+            self.state.wake.notify_all();
+        }
+        // The executor may be dropped by one of its jobs, whose thread exits once the job returns.
+        let current = thread::current().id();
+        for t in self.threads.drain(..) {
+            if t.thread().id() != current {
+                let _ = t.join();
+            }
+        }
+    }
+}
+
+/// Signals the completion of a job to the task joining it.
+#[derive(Default)]
+pub(crate) struct Completion {
+    done: Mutex<bool>,
+    cv: Condvar,
+}
+
+impl Completion {
+    fn complete(&self) {
+        *self.done.lock().unwrap_or_else(|e| e.into_inner()) = true;
+        self.cv.notify_all();
+    }
+
+    pub(crate) fn wait(&self) {
+        let mut done = self.done.lock().unwrap_or_else(|e| e.into_inner());
+        while !*done {
+            done = self.cv.wait(done).unwrap_or_else(|e| e.into_inner());
+        }
+    }
+}
+
+decl_c_type!(
+    owned(z_owned_executor_t, option Arc<Executor>),
+    loaned(z_loaned_executor_t),
+);
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Options passed to `z_executor_new()`.
+#[repr(C)]
+#[derive(Default, Clone, Copy)]
+pub struct z_executor_options_t {
+    /// The number of worker threads, 0 for the number of CPUs available to the process.
+    pub worker_threads: usize,
+    /// If not 0, worker `i` is pinned to the `i`-th CPU set in the mask, bit `j` standing for CPU `j`, wrapping around
+    /// when there are more workers than CPUs in the mask. Only supported on Linux.
+    pub cpu_affinity_mask: u64,
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs the default value for `z_executor_options_t`, with a worker per CPU and no pinning.
+#[no_mangle]
+pub extern "C" fn z_executor_options_default(this_: &mut MaybeUninit<z_executor_options_t>) {
+    this_.write(z_executor_options_t::default());
+}
+
+#[cfg(target_os = "linux")]
+fn pin_thread(cpu: usize) -> std::io::Result<()> {
+    unsafe {
+        let mut set: libc::cpu_set_t = std::mem::zeroed();
+        libc::CPU_SET(cpu, &mut set);
+        if libc::sched_setaffinity(0, std::mem::size_of::<libc::cpu_set_t>(), &set) != 0 {
+            return Err(std::io::Error::last_os_error());
+        }
+    }
+    Ok(())
+}
+
+#[cfg(not(target_os = "linux"))]
+fn pin_thread(_cpu: usize) -> std::io::Result<()> {
+    Err(std::io::ErrorKind::Unsupported.into())
+}
+
+enum StartError {
+    Spawn(std::io::Error),
+    Pin(std::io::Error),
+}
+
+fn start_executor(options: &z_executor_options_t) -> Result<Executor, StartError> {
+    let threads = match options.worker_threads {
+        0 => thread::available_parallelism().map_or(1, |n| n.get()),
+        n => n,
+    };
+    let cpus: Vec<usize> = (0..u64::BITS as usize)
+        .filter(|cpu| options.cpu_affinity_mask & (1 << cpu) != 0)
+        .collect();
+    let workers: Vec<Worker<Job>> = (0..threads).map(|_| Worker::new_fifo()).collect();
+    let state = Arc::new(ExecutorState {
+        injector: Injector::new(),
+        stealers: workers.iter().map(Worker::stealer).collect(),
+        pending: AtomicUsize::new(0),
+        sleeping: AtomicUsize::new(0),
+        shutdown: AtomicBool::new(false),
+        sleep: Mutex::new(()),
+        wake: Condvar::new(),
+    });
+    // Dropping the executor stops the workers already started if one of them fails to start.
+    let mut executor = Executor {
+        state: state.clone(),
+        threads: Vec::with_capacity(threads),
+    };
+    for (i, local) in workers.into_iter().enumerate() {
+        let cpu = (!cpus.is_empty()).then(|| cpus[i % cpus.len()]);
+        let state = state.clone();
+        let (tx, rx) = std::sync::mpsc::sync_channel(1);
+        let thread = thread::Builder::new()
+            .name(format!("zc-executor-{i}"))
+            .spawn(move || {
+                let pinned = cpu.map_or(Ok(()), pin_thread);
+                let started = pinned.is_ok();
+                let _ = tx.send(pinned);
+                if started {
+                    state.run_worker(local);
+                }
+            })
+            .map_err(StartError::Spawn)?;
+        executor.threads.push(thread);
+        if let Ok(Err(e)) = rx.recv() {
+            return Err(StartError::Pin(e));
+        }
+    }
+    Ok(executor)
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs an executor, a pool of worker threads running short tasks.
+///
+/// Spawning a task on an executor is much cheaper than starting a thread with `z_task_init()`. Each worker runs the
+/// tasks in the order in which it took them, and idle workers steal the tasks waiting for busy ones. The executor can
+/// also run the workers of subscribers and queryables (see `z_subscriber_options_t::worker_executor`), so that an
+/// application tunes a single set of threads.
+///
+/// @param this_: An uninitialized memory location where the executor will be constructed.
+/// @param options: The options of the executor, pass NULL to use the default ones.
+/// @return 0 in case of success, `Z_EUNAVAILABLE` if `cpu_affinity_mask` is set and not supported on this platform,
+/// `Z_EINVAL` if the workers could not be pinned, `Z_EAGAIN_MUTEX` if the threads could not be started.
+#[no_mangle]
+pub extern "C" fn z_executor_new(
+    this_: &mut MaybeUninit<z_owned_executor_t>,
+    options: Option<&z_executor_options_t>,
+) -> result::z_result_t {
+    let this = this_.as_rust_type_mut_uninit();
+    match start_executor(&options.copied().unwrap_or_default()) {
+        Ok(executor) => {
+            this.write(Some(Arc::new(executor)));
+            result::Z_OK
+        }
+        Err(StartError::Spawn(e)) => {
+            tracing::error!("Failed to start the executor threads: {}", e);
+            this.write(None);
+            result::Z_EAGAIN_MUTEX
+        }
+        Err(StartError::Pin(e)) if e.kind() == std::io::ErrorKind::Unsupported => {
+            tracing::error!("Thread pinning is not supported on this platform");
+            this.write(None);
+            result::Z_EUNAVAILABLE
+        }
+        Err(StartError::Pin(e)) => {
+            tracing::error!("Failed to pin the executor threads: {}", e);
+            this.write(None);
+            result::Z_EINVAL
+        }
+    }
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Spawns a task on the executor.
+///
+/// The task should not block for long, as it holds a worker while it runs. It must not join another task of the
+/// same executor, which may be waiting for the worker it holds.
+///
+/// @param this_: The executor.
+/// @param task: An uninitialized memory location where the handle of the task will be constructed, pass NULL to
+/// detach the task. Joining the handle with `z_task_join()` waits for the completion of the task.
+/// @param fun: Function to be executed by the task.
+/// @param arg: Argument that will be passed to the function `fun`.
+/// @return 0 in case of success, negative error code otherwise.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_executor_spawn(
+    this_: &z_loaned_executor_t,
+    task: Option<&mut MaybeUninit<z_owned_task_t>>,
+    fun: unsafe extern "C" fn(arg: *mut c_void) -> *mut c_void,
+    arg: *mut c_void,
+) -> result::z_result_t {
+    let fun_arg_pair = FunArgPair { fun, arg };
+    match task {
+        Some(task) => {
+            let completion = Arc::new(Completion::default());
+            task.as_rust_type_mut_uninit()
+                .write(Some(Task::Executor(completion.clone())));
+            this_.as_rust_type_ref().spawn(move || {
+                fun_arg_pair.call();
+                completion.complete();
+            });
+        }
+        None => this_.as_rust_type_ref().spawn(move || fun_arg_pair.call()),
+    }
+    result::Z_OK
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Borrows executor.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_executor_loan(this_: &z_owned_executor_t) -> &z_loaned_executor_t {
+    this_
+        .as_rust_type_ref()
+        .as_ref()
+        .unwrap_unchecked()
+        .as_loaned_c_type_ref()
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Drops the executor and resets it to its gravestone state.
+///
+/// The executor is stopped once it is not used anymore by subscribers nor queryables, after running all the tasks
+/// spawned on it. This function then waits for these tasks, unless it is called from one of them.
+#[no_mangle]
+pub extern "C" fn z_executor_drop(this_: &mut z_moved_executor_t) {
+    let _ = this_.take_rust_type();
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs executor in its gravestone state.
+#[no_mangle]
+pub extern "C" fn z_internal_executor_null(this_: &mut MaybeUninit<z_owned_executor_t>) {
+    this_.as_rust_type_mut_uninit().write(None);
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns ``true`` if executor is valid, ``false`` if it is in gravestone state.
+#[no_mangle]
+pub extern "C" fn z_internal_executor_check(this_: &z_owned_executor_t) -> bool {
+    this_.as_rust_type_ref().is_some()
+}
+
+// The maximal number of values delivered by a strand before giving its worker back to the other tasks.
+const STRAND_BATCH: usize = 64;
+
+/// A bounded queue of values delivered in order by at most one task of an executor at a time.
+struct Strand<T> {
+    executor: Arc<Executor>,
+    f: Arc<dyn Fn(T) + Send + Sync>,
+    capacity: usize,
+    // The pending values, and whether a task delivering them is spawned.
+    state: Mutex<(VecDeque<T>, bool)>,
+}
+
+impl<T: Send + 'static> Strand<T> {
+    fn try_send(self: &Arc<Self>, value: T) -> Result<(), T> {
+        let mut state = self.state.lock().unwrap_or_else(|e| e.into_inner());
+        if state.0.len() >= self.capacity {
+            return Err(value);
+        }
+        state.0.push_back(value);
+        if !state.1 {
+            state.1 = true;
+            drop(state);
+            self.schedule();
+        }
+        Ok(())
+    }
+
+    fn schedule(self: &Arc<Self>) {
+        let this = self.clone();
+        self.executor.spawn(move || this.deliver());
+    }
+
+    fn deliver(self: &Arc<Self>) {
+        for _ in 0..STRAND_BATCH {
+            let value = {
+                let mut state = self.state.lock().unwrap_or_else(|e| e.into_inner());
+                match state.0.pop_front() {
+                    Some(v) => v,
+                    None => {
+                        state.1 = false;
+                        return;
+                    }
+                }
+            };
+            (self.f)(value);
+        }
+        self.schedule();
+    }
+}
+
+enum Shard<T> {
+    Thread(flume::Sender<T>),
+    Strand(Arc<Strand<T>>),
+}
+
+/// The workers of a subscriber or a queryable, each delivering the values dispatched to it in order.
+///
+/// The workers are either dedicated threads or strands of an executor. They stop once this is dropped and the
+/// values they hold are delivered, the last one dropping the delivery function.
+pub(crate) struct ShardedWorkers<T> {
+    shards: Vec<Shard<T>>,
+}
+
+impl<T: Send + 'static> ShardedWorkers<T> {
+    pub(crate) fn new(
+        name: &str,
+        shards: usize,
+        queue_size: usize,
+        executor: Option<&z_loaned_executor_t>,
+        f: impl Fn(T) + Send + Sync + 'static,
+    ) -> std::io::Result<Self> {
+        let f: Arc<dyn Fn(T) + Send + Sync> = Arc::new(f);
+        let mut workers = Vec::with_capacity(shards);
+        for i in 0..shards {
+            let shard = match executor {
+                Some(executor) => Shard::Strand(Arc::new(Strand {
+                    executor: executor.as_rust_type_ref().clone(),
+                    f: f.clone(),
+                    capacity: queue_size.max(1),
+                    state: Mutex::new((VecDeque::new(), false)),
+                })),
+                None => {
+                    let (tx, rx) = flume::bounded::<T>(queue_size.max(1));
+                    let f = f.clone();
+                    thread::Builder::new()
+                        .name(format!("{name}-{i}"))
+                        .spawn(move || {
+                            while let Ok(v) = rx.recv() {
+                                f(v);
+                            }
+                        })?;
+                    Shard::Thread(tx)
+                }
+            };
+            workers.push(shard);
+        }
+        Ok(Self { shards: workers })
+    }
+
+    /// Queues the value to the worker selected by `hash`, returns it if the queue of the worker is full.
+    pub(crate) fn try_send(&self, hash: u64, value: T) -> Result<(), T> {
+        match &self.shards[hash as usize % self.shards.len()] {
+            Shard::Thread(tx) => tx.try_send(value).map_err(|e| e.into_inner()),
+            Shard::Strand(strand) => strand.try_send(value),
+        }
+    }
+}
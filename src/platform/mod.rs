@@ -18,6 +18,10 @@ pub use sleep::*;
 mod sleep;
 pub use synchronization::*;
 mod synchronization;
+#[cfg(feature = "unstable")]
+pub use executor::*;
+#[cfg(feature = "unstable")]
+mod executor;
 
 pub use random::*;
 mod random;
@@ -1,13 +1,33 @@
+#[cfg(feature = "unstable")]
+use std::sync::{
+    atomic::{AtomicUsize, Ordering},
+    Arc,
+};
 use std::{
     mem::MaybeUninit,
     sync::{Condvar, Mutex, MutexGuard},
     thread::{self, JoinHandle},
+    time::Instant,
 };
 
 use libc::c_void;
+#[cfg(feature = "unstable")]
+use parking_lot::{
+    lock_api::{RawMutex as _, RawRwLock as _},
+    RawMutex, RawRwLock,
+};
 
+#[cfg(feature = "unstable")]
+pub use crate::opaque_types::{
+    z_loaned_adaptive_mutex_t, z_loaned_rwlock_t, z_loaned_semaphore_t, z_moved_adaptive_mutex_t,
+    z_moved_rwlock_t, z_moved_semaphore_t, z_owned_adaptive_mutex_t, z_owned_rwlock_t,
+    z_owned_semaphore_t,
+};
 pub use crate::opaque_types::{z_loaned_mutex_t, z_moved_mutex_t, z_owned_mutex_t};
+#[cfg(feature = "unstable")]
+use crate::platform::executor::Completion;
 use crate::{
+    platform::clock::{clock_instant, z_clock_t},
     result,
     transmute::{LoanedCTypeRef, RustTypeRef, RustTypeRefUninit, TakeRustType},
 };
@@ -196,9 +216,469 @@ pub unsafe extern "C" fn z_condvar_wait(
     result::Z_OK
 }
 
+/// Blocks the current thread until the conditional variable receives a notification, or until `deadline`.
+///
+/// The function atomically unlocks the guard mutex `m` and blocks the current thread.
+/// When the function returns the lock will have been re-aquired again, also if the wait timed out.
+/// Note: The function may be subject to spurious wakeups.
+///
+/// @param this_: The conditional variable.
+/// @param m: The locked guard mutex.
+/// @param deadline: The time point at which to stop waiting, e.g. `z_clock_now()` advanced with `z_clock_advance_ms()`.
+/// @return 0 if the conditional variable was notified, `Z_ETIMEDOUT` if `deadline` was reached, negative error code
+/// otherwise.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_condvar_wait_until(
+    this_: &z_loaned_condvar_t,
+    m: &mut z_loaned_mutex_t,
+    deadline: &z_clock_t,
+) -> result::z_result_t {
+    let this = this_.as_rust_type_ref();
+    let m = m.as_rust_type_mut();
+    if m.1.is_none() {
+        return result::Z_EINVAL_MUTEX; // lock was not aquired prior to wait call
+    }
+    let Some(timeout) = clock_instant(deadline).checked_duration_since(Instant::now()) else {
+        return result::Z_ETIMEDOUT;
+    };
+
+    let lock = m.1.take().unwrap();
+    match this.wait_timeout(lock, timeout) {
+        Ok((new_lock, status)) => {
+            m.1 = Some(new_lock);
+            if status.timed_out() {
+                return result::Z_ETIMEDOUT;
+            }
+        }
+        Err(_) => return result::Z_EPOISON_MUTEX,
+    }
+
+    result::Z_OK
+}
+
+#[cfg(feature = "unstable")]
+decl_c_type_inequal!(
+    owned(z_owned_rwlock_t, option RawRwLock),
+    loaned(z_loaned_rwlock_t),
+);
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs a reader-writer lock.
+///
+/// Unlike `z_owned_mutex_t`, the lock holds no guard: locking and unlocking only update an atomic state word when the
+/// lock is not contended. Contended threads spin for a short while and are then parked in the kernel, e.g. on a futex
+/// on Linux, until the lock is released. Writers waiting for the lock block new readers, so that they do not starve.
+/// @return 0 in case of success, negative error code otherwise.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn z_rwlock_init(this_: &mut MaybeUninit<z_owned_rwlock_t>) -> result::z_result_t {
+    this_.as_rust_type_mut_uninit().write(Some(RawRwLock::INIT));
+    result::Z_OK
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs reader-writer lock in a gravestone state.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn z_internal_rwlock_null(this_: &mut MaybeUninit<z_owned_rwlock_t>) {
+    this_.as_rust_type_mut_uninit().write(None);
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Drops reader-writer lock and resets it to its gravestone state. The lock must not be held.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn z_rwlock_drop(this_: &mut z_moved_rwlock_t) {
+    let _ = this_.take_rust_type();
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns ``true`` if reader-writer lock is valid, ``false`` otherwise.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn z_internal_rwlock_check(this_: &z_owned_rwlock_t) -> bool {
+    this_.as_rust_type_ref().is_some()
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Borrows reader-writer lock, so that it can be shared by the threads using it.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_rwlock_loan(this_: &z_owned_rwlock_t) -> &z_loaned_rwlock_t {
+    this_
+        .as_rust_type_ref()
+        .as_ref()
+        .unwrap_unchecked()
+        .as_loaned_c_type_ref()
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Locks reader-writer lock for reading. If it is locked for writing, blocks the thread until it aquires the lock.
+/// @return 0 in case of success, negative error code in case of failure.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn z_rwlock_read_lock(this_: &z_loaned_rwlock_t) -> result::z_result_t {
+    this_.as_rust_type_ref().lock_shared();
+    result::Z_OK
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Tries to lock reader-writer lock for reading. If it is locked for writing, return immediately.
+/// @return 0 in case of success, `Z_EBUSY_MUTEX` if failed to aquire the lock.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn z_rwlock_try_read_lock(this_: &z_loaned_rwlock_t) -> result::z_result_t {
+    match this_.as_rust_type_ref().try_lock_shared() {
+        true => result::Z_OK,
+        false => result::Z_EBUSY_MUTEX,
+    }
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Releases a read lock previously aquired by the current thread. Otherwise the behaviour is undefined.
+/// @return 0 in case of success, `Z_EINVAL_MUTEX` if the lock is not locked for reading.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn z_rwlock_read_unlock(this_: &z_loaned_rwlock_t) -> result::z_result_t {
+    let this = this_.as_rust_type_ref();
+    if !this.is_locked() || this.is_locked_exclusive() {
+        return result::Z_EINVAL_MUTEX;
+    }
+    unsafe { this.unlock_shared() };
+    result::Z_OK
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Locks reader-writer lock for writing. If it is locked, blocks the thread until it aquires the lock.
+/// @return 0 in case of success, negative error code in case of failure.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn z_rwlock_write_lock(this_: &z_loaned_rwlock_t) -> result::z_result_t {
+    this_.as_rust_type_ref().lock_exclusive();
+    result::Z_OK
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Tries to lock reader-writer lock for writing. If it is locked, return immediately.
+/// @return 0 in case of success, `Z_EBUSY_MUTEX` if failed to aquire the lock.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn z_rwlock_try_write_lock(this_: &z_loaned_rwlock_t) -> result::z_result_t {
+    match this_.as_rust_type_ref().try_lock_exclusive() {
+        true => result::Z_OK,
+        false => result::Z_EBUSY_MUTEX,
+    }
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Releases the write lock previously aquired by the current thread. Otherwise the behaviour is undefined.
+/// @return 0 in case of success, `Z_EINVAL_MUTEX` if the lock is not locked for writing.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn z_rwlock_write_unlock(this_: &z_loaned_rwlock_t) -> result::z_result_t {
+    let this = this_.as_rust_type_ref();
+    if !this.is_locked_exclusive() {
+        return result::Z_EINVAL_MUTEX;
+    }
+    unsafe { this.unlock_exclusive() };
+    result::Z_OK
+}
+
+#[cfg(feature = "unstable")]
+decl_c_type_inequal!(
+    owned(z_owned_adaptive_mutex_t, option RawMutex),
+    loaned(z_loaned_adaptive_mutex_t),
+);
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs an adaptive mutex.
+///
+/// Unlike `z_owned_mutex_t`, the mutex holds no guard and is a single byte: when it is not contended, locking and
+/// unlocking it are a single atomic operation. A thread waiting for the mutex spins for a short while, which avoids a
+/// context switch when the mutex is only held for short sections, and is then parked in the kernel, e.g. on a futex on
+/// Linux, until the mutex is released. The mutex can not be used with `z_owned_condvar_t`.
+/// @return 0 in case of success, negative error code otherwise.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn z_adaptive_mutex_init(
+    this_: &mut MaybeUninit<z_owned_adaptive_mutex_t>,
+) -> result::z_result_t {
+    this_.as_rust_type_mut_uninit().write(Some(RawMutex::INIT));
+    result::Z_OK
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs adaptive mutex in a gravestone state.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn z_internal_adaptive_mutex_null(
+    this_: &mut MaybeUninit<z_owned_adaptive_mutex_t>,
+) {
+    this_.as_rust_type_mut_uninit().write(None);
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Drops adaptive mutex and resets it to its gravestone state. The mutex must not be locked.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn z_adaptive_mutex_drop(this_: &mut z_moved_adaptive_mutex_t) {
+    let _ = this_.take_rust_type();
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns ``true`` if adaptive mutex is valid, ``false`` otherwise.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn z_internal_adaptive_mutex_check(this_: &z_owned_adaptive_mutex_t) -> bool {
+    this_.as_rust_type_ref().is_some()
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Borrows adaptive mutex, so that it can be shared by the threads using it.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_adaptive_mutex_loan(
+    this_: &z_owned_adaptive_mutex_t,
+) -> &z_loaned_adaptive_mutex_t {
+    this_
+        .as_rust_type_ref()
+        .as_ref()
+        .unwrap_unchecked()
+        .as_loaned_c_type_ref()
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Locks adaptive mutex. If it is already locked, blocks the thread until it aquires the lock.
+/// @return 0 in case of success, negative error code in case of failure.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn z_adaptive_mutex_lock(this_: &z_loaned_adaptive_mutex_t) -> result::z_result_t {
+    this_.as_rust_type_ref().lock();
+    result::Z_OK
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Tries to lock adaptive mutex. If it is already locked, return immediately.
+/// @return 0 in case of success, `Z_EBUSY_MUTEX` if failed to aquire the lock.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn z_adaptive_mutex_try_lock(
+    this_: &z_loaned_adaptive_mutex_t,
+) -> result::z_result_t {
+    match this_.as_rust_type_ref().try_lock() {
+        true => result::Z_OK,
+        false => result::Z_EBUSY_MUTEX,
+    }
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Unlocks adaptive mutex previously locked by the current thread. Otherwise the behaviour is undefined.
+/// @return 0 in case of success, `Z_EINVAL_MUTEX` if the mutex is not locked.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn z_adaptive_mutex_unlock(this_: &z_loaned_adaptive_mutex_t) -> result::z_result_t {
+    let this = this_.as_rust_type_ref();
+    if !this.is_locked() {
+        return result::Z_EINVAL_MUTEX;
+    }
+    unsafe { this.unlock() };
+    result::Z_OK
+}
+
+/// A counting semaphore, whose permits are taken without locking while they are available.
+#[cfg(feature = "unstable")]
+pub struct Semaphore {
+    permits: AtomicUsize,
+    // The number of threads waiting on `available`, so that `post()` only locks when there are some.
+    waiters: AtomicUsize,
+    lock: Mutex<()>,
+    available: Condvar,
+}
+
+#[cfg(feature = "unstable")]
+impl Semaphore {
+    fn new(permits: usize) -> Self {
+        Semaphore {
+            permits: AtomicUsize::new(permits),
+            waiters: AtomicUsize::new(0),
+            lock: Mutex::new(()),
+            available: Condvar::new(),
+        }
+    }
+
+    fn try_acquire(&self) -> bool {
+        self.permits
+            .fetch_update(Ordering::SeqCst, Ordering::SeqCst, |p| p.checked_sub(1))
+            .is_ok()
+    }
+
+    /// Takes a permit, waiting until `deadline` for one if none is available.
+    fn acquire(&self, deadline: Option<Instant>) -> result::z_result_t {
+        if self.try_acquire() {
+            return result::Z_OK;
+        }
+        let mut guard = self.lock.lock().unwrap_or_else(|e| e.into_inner());
+        // A permit posted after the increment is seen by the next `try_acquire()`, and a permit posted before it
+        // notifies `available` after this thread started waiting, since it has to lock `self.lock` to do so.
+        self.waiters.fetch_add(1, Ordering::SeqCst);
+        let res = loop {
+            if self.try_acquire() {
+                break result::Z_OK;
+            }
+            match deadline {
+                None => {
+                    guard = self
+                        .available
+                        .wait(guard)
+                        .unwrap_or_else(|e| e.into_inner())
+                }
+                Some(deadline) => {
+                    let Some(timeout) = deadline.checked_duration_since(Instant::now()) else {
+                        break result::Z_ETIMEDOUT;
+                    };
+                    guard = self
+                        .available
+                        .wait_timeout(guard, timeout)
+                        .unwrap_or_else(|e| e.into_inner())
+                        .0;
+                }
+            }
+        };
+        self.waiters.fetch_sub(1, Ordering::SeqCst);
+        res
+    }
+
+    fn release(&self) {
+        self.permits.fetch_add(1, Ordering::SeqCst);
+        if self.waiters.load(Ordering::SeqCst) != 0 {
+            let _guard = self.lock.lock().unwrap_or_else(|e| e.into_inner());
+            self.available.notify_one();
+        }
+    }
+}
+
+#[cfg(feature = "unstable")]
+decl_c_type_inequal!(
+    owned(z_owned_semaphore_t, option Semaphore),
+    loaned(z_loaned_semaphore_t),
+);
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs a counting semaphore.
+///
+/// Waiting on the semaphore takes one of its permits, and posting to it gives one back. While permits are available,
+/// both are a single atomic operation; the internal mutex is only locked when a thread has to wait for a permit.
+///
+/// @param this_: An uninitialized memory location where the semaphore will be constructed.
+/// @param permits: The initial number of permits.
+/// @return 0 in case of success, negative error code otherwise.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn z_semaphore_init(
+    this_: &mut MaybeUninit<z_owned_semaphore_t>,
+    permits: usize,
+) -> result::z_result_t {
+    this_
+        .as_rust_type_mut_uninit()
+        .write(Some(Semaphore::new(permits)));
+    result::Z_OK
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs semaphore in a gravestone state.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn z_internal_semaphore_null(this_: &mut MaybeUninit<z_owned_semaphore_t>) {
+    this_.as_rust_type_mut_uninit().write(None);
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Drops semaphore and resets it to its gravestone state. No thread must be waiting on it.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn z_semaphore_drop(this_: &mut z_moved_semaphore_t) {
+    let _ = this_.take_rust_type();
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns ``true`` if semaphore is valid, ``false`` otherwise.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn z_internal_semaphore_check(this_: &z_owned_semaphore_t) -> bool {
+    this_.as_rust_type_ref().is_some()
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Borrows semaphore, so that it can be shared by the threads using it.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_semaphore_loan(this_: &z_owned_semaphore_t) -> &z_loaned_semaphore_t {
+    this_
+        .as_rust_type_ref()
+        .as_ref()
+        .unwrap_unchecked()
+        .as_loaned_c_type_ref()
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Takes a permit of the semaphore, blocking the thread until one is available.
+/// @return 0 in case of success, negative error code otherwise.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn z_semaphore_wait(this_: &z_loaned_semaphore_t) -> result::z_result_t {
+    this_.as_rust_type_ref().acquire(None)
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Takes a permit of the semaphore, blocking the thread until one is available or until `deadline`.
+/// @return 0 in case of success, `Z_ETIMEDOUT` if no permit was available before `deadline`.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn z_semaphore_wait_until(
+    this_: &z_loaned_semaphore_t,
+    deadline: &z_clock_t,
+) -> result::z_result_t {
+    this_
+        .as_rust_type_ref()
+        .acquire(Some(clock_instant(deadline)))
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Tries to take a permit of the semaphore. If none is available, return immediately.
+/// @return 0 in case of success, `Z_EBUSY_MUTEX` if no permit is available.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn z_semaphore_try_wait(this_: &z_loaned_semaphore_t) -> result::z_result_t {
+    match this_.as_rust_type_ref().try_acquire() {
+        true => result::Z_OK,
+        false => result::Z_EBUSY_MUTEX,
+    }
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Gives a permit back to the semaphore, waking up a thread waiting for one.
+/// @return 0 in case of success, negative error code otherwise.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn z_semaphore_post(this_: &z_loaned_semaphore_t) -> result::z_result_t {
+    this_.as_rust_type_ref().release();
+    result::Z_OK
+}
+
+/// A task started by `z_task_init()`, or spawned on an executor by `z_executor_spawn()`.
+pub(crate) enum Task {
+    Thread(JoinHandle<()>),
+    #[cfg(feature = "unstable")]
+    Executor(Arc<Completion>),
+}
+
 pub use crate::opaque_types::{z_moved_task_t, z_owned_task_t};
 decl_c_type!(
-    owned(z_owned_task_t, option JoinHandle<()>),
+    owned(z_owned_task_t, option Task),
 );
 
 #[repr(C)]
@@ -223,9 +703,16 @@ pub extern "C" fn z_task_join(this_: &mut z_moved_task_t) -> result::z_result_t
     let Some(task) = this_.take_rust_type() else {
         return result::Z_OK;
     };
-    match task.join() {
-        Ok(_) => result::Z_OK,
-        Err(_) => result::Z_EINVAL_MUTEX,
+    match task {
+        Task::Thread(thread) => match thread.join() {
+            Ok(_) => result::Z_OK,
+            Err(_) => result::Z_EINVAL_MUTEX,
+        },
+        #[cfg(feature = "unstable")]
+        Task::Executor(completion) => {
+            completion.wait();
+            result::Z_OK
+        }
     }
 }
 
@@ -241,13 +728,13 @@ pub extern "C" fn z_internal_task_check(this_: &z_owned_task_t) -> bool {
     this_.as_rust_type_ref().is_some()
 }
 
-struct FunArgPair {
-    fun: unsafe extern "C" fn(arg: *mut c_void) -> *mut c_void,
-    arg: *mut c_void,
+pub(crate) struct FunArgPair {
+    pub(crate) fun: unsafe extern "C" fn(arg: *mut c_void) -> *mut c_void,
+    pub(crate) arg: *mut c_void,
 }
 
 impl FunArgPair {
-    unsafe fn call(self) {
+    pub(crate) unsafe fn call(self) {
         (self.fun)(self.arg);
     }
 }
@@ -273,7 +760,7 @@ pub unsafe extern "C" fn z_task_init(
 
     match thread::Builder::new().spawn(move || fun_arg_pair.call()) {
         Ok(join_handle) => {
-            this.write(Some(join_handle));
+            this.write(Some(Task::Thread(join_handle)));
         }
         Err(_) => return result::Z_EAGAIN_MUTEX,
     }
@@ -13,15 +13,25 @@
 //
 #![allow(deprecated)]
 
-use std::{mem::MaybeUninit, ptr::null};
+use std::{ffi::CStr, mem::MaybeUninit, ptr::null, sync::Arc, time::Duration};
 
-use zenoh::Wait;
-use zenoh_ext::{PublicationCacheBuilder, SessionExt};
+use libc::c_char;
+use zenoh::{
+    bytes::{Encoding, ZBytes},
+    key_expr::KeyExpr,
+    pubsub::Subscriber,
+    query::{Query, Queryable, ZenohParameters},
+    sample::{Locality, Sample, SampleKind},
+    time::Timestamp,
+    Session, Wait,
+};
+use zenoh_ext::SessionExt;
 
 use crate::{
+    cache_log::{CacheLog, CacheLogOptions},
     result,
     transmute::{LoanedCTypeRef, RustTypeRef, RustTypeRefUninit, TakeRustType},
-    z_loaned_keyexpr_t, z_loaned_session_t,
+    z_loaned_keyexpr_t, z_loaned_session_t, ze_loaned_cache_budget_t, CacheBudget,
 };
 #[cfg(feature = "unstable")]
 use crate::{zc_locality_default, zc_locality_t};
@@ -41,6 +51,34 @@ pub struct ze_publication_cache_options_t {
     pub history: usize,
     /// The limit number of cached resources.
     pub resources_limit: usize,
+    /// The maximum number of bytes held by the cache, ``0`` to bound the cache by the number of samples only.
+    /// When non-zero, the cache evicts the oldest samples of its least recently used key expressions to stay within
+    /// this budget, and ``history`` becomes the maximum number of samples per key expression, ``0`` meaning no limit.
+    /// Ignored if ``budget`` is set.
+    #[cfg(feature = "unstable")]
+    pub max_bytes: usize,
+    /// A memory budget shared with other publication caches, whose least recently used key expressions are evicted
+    /// across all of them, see `ze_cache_budget_new()`. The cache is byte-budgeted if set, as with ``max_bytes``.
+    #[cfg(feature = "unstable")]
+    pub budget: *const ze_loaned_cache_budget_t,
+    /// The maximum age of the samples held by a byte-budgeted or log-backed cache, in milliseconds, ``0`` for no limit.
+    #[cfg(feature = "unstable")]
+    pub max_age_ms: u64,
+    /// The directory where a log-backed cache writes its log files, ``NULL`` to keep the cache in memory.
+    /// When set, the samples are appended to memory-mapped log segments, and only an index by key expression is held
+    /// in memory, so that a long history does not increase the resident memory. Queries are replied with payloads
+    /// referring to the mapped segments, without copying them. ``max_bytes`` and ``budget`` are ignored, and
+    /// ``history`` is the maximum number of samples per key expression, ``0`` meaning no limit. The log files are removed
+    /// once rotated out or when the cache is dropped. Only supported on unix platforms.
+    #[cfg(feature = "unstable")]
+    pub log_directory: *const c_char,
+    /// The size of the segments of a log-backed cache, a segment being bigger if a single sample does not fit.
+    #[cfg(feature = "unstable")]
+    pub log_segment_size: usize,
+    /// The maximum number of segments of a log-backed cache, the oldest one being removed when a new one is started.
+    /// ``0`` for no limit.
+    #[cfg(feature = "unstable")]
+    pub log_max_segments: usize,
 }
 
 /// @warning This API is deprecated. Please use ze_advanced_publisher.
@@ -56,27 +94,285 @@ pub extern "C" fn ze_publication_cache_options_default(
         queryable_complete: false,
         history: 1,
         resources_limit: 0,
+        #[cfg(feature = "unstable")]
+        max_bytes: 0,
+        #[cfg(feature = "unstable")]
+        budget: null(),
+        #[cfg(feature = "unstable")]
+        max_age_ms: 0,
+        #[cfg(feature = "unstable")]
+        log_directory: null(),
+        #[cfg(feature = "unstable")]
+        log_segment_size: 64 * 1024 * 1024,
+        #[cfg(feature = "unstable")]
+        log_max_segments: 16,
     });
 }
 
+/// A cached publication, as sent back to the queries.
+pub struct CachedReply {
+    pub(crate) key_expr: KeyExpr<'static>,
+    pub(crate) kind: SampleKind,
+    pub(crate) payload: ZBytes,
+    pub(crate) encoding: Encoding,
+    pub(crate) timestamp: Option<Timestamp>,
+    pub(crate) attachment: Option<ZBytes>,
+}
+
+impl From<&Sample> for CachedReply {
+    fn from(sample: &Sample) -> Self {
+        CachedReply {
+            key_expr: sample.key_expr().clone().into_owned(),
+            kind: sample.kind(),
+            payload: sample.payload().clone(),
+            encoding: sample.encoding().clone(),
+            timestamp: sample.timestamp().cloned(),
+            attachment: sample.attachment().cloned(),
+        }
+    }
+}
+
+/// The storage of a publication cache implemented by zenoh-c.
+#[derive(Clone)]
+enum CacheStore {
+    /// Samples held in memory, within a budget possibly shared with other caches.
+    Budget(Arc<CacheBudget>, u64),
+    /// Samples appended to memory-mapped log files.
+    Log(Arc<CacheLog>),
+}
+
+impl CacheStore {
+    fn insert(&self, sample: Sample, options: &CacheStoreOptions) {
+        match self {
+            CacheStore::Budget(budget, id) => budget.insert(
+                *id,
+                sample,
+                options.history,
+                options.resources_limit,
+                options.max_age,
+            ),
+            CacheStore::Log(log) => log.insert(sample),
+        }
+    }
+
+    fn replies(
+        &self,
+        options: &CacheStoreOptions,
+        matches: impl FnMut(&KeyExpr<'static>) -> bool,
+    ) -> Vec<CachedReply> {
+        match self {
+            CacheStore::Budget(budget, id) => {
+                let mut replies = Vec::new();
+                budget.for_each(*id, options.max_age, matches, |s| replies.push(s.into()));
+                replies
+            }
+            CacheStore::Log(log) => log.replies(matches),
+        }
+    }
+
+    fn resident_bytes(&self) -> usize {
+        match self {
+            CacheStore::Budget(budget, id) => budget.cache_resident_bytes(*id),
+            CacheStore::Log(log) => log.logged_bytes(),
+        }
+    }
+}
+
+#[derive(Clone, Copy)]
+struct CacheStoreOptions {
+    history: usize,
+    resources_limit: usize,
+    max_age: Option<Duration>,
+}
+
+/// A publication cache implemented by zenoh-c, either byte-budgeted or backed by a log.
+pub struct LocalPublicationCache {
+    key_expr: KeyExpr<'static>,
+    store: CacheStore,
+    subscriber: Option<Subscriber<()>>,
+    queryable: Option<Queryable<()>>,
+}
+
+impl LocalPublicationCache {
+    fn undeclare(mut self) -> zenoh::Result<()> {
+        if let Some(subscriber) = self.subscriber.take() {
+            subscriber.undeclare().wait()?;
+        }
+        if let Some(queryable) = self.queryable.take() {
+            queryable.undeclare().wait()?;
+        }
+        Ok(())
+    }
+}
+
+impl Drop for LocalPublicationCache {
+    fn drop(&mut self) {
+        // the subscriber must be undeclared first, so that no sample is cached once the cache is unregistered
+        drop(self.subscriber.take());
+        drop(self.queryable.take());
+        if let CacheStore::Budget(budget, id) = &self.store {
+            budget.unregister(*id);
+        }
+    }
+}
+
+pub enum PublicationCache {
+    Ext(zenoh_ext::PublicationCache),
+    Local(Box<LocalPublicationCache>),
+}
+
+impl PublicationCache {
+    fn key_expr(&self) -> &KeyExpr<'static> {
+        match self {
+            PublicationCache::Ext(p) => p.key_expr(),
+            PublicationCache::Local(p) => &p.key_expr,
+        }
+    }
+}
+
 pub use crate::opaque_types::{
     ze_loaned_publication_cache_t, ze_moved_publication_cache_t, ze_owned_publication_cache_t,
 };
 decl_c_type!(
-    owned(
-        ze_owned_publication_cache_t,
-        option zenoh_ext::PublicationCache,
-    ),
+    owned(ze_owned_publication_cache_t, option PublicationCache),
     loaned(ze_loaned_publication_cache_t),
 );
 
-fn _declare_publication_cache_inner<'a, 'b, 'c>(
-    session: &'a z_loaned_session_t,
-    key_expr: &'b z_loaned_keyexpr_t,
-    options: Option<&'c mut ze_publication_cache_options_t>,
-) -> PublicationCacheBuilder<'a, 'b, 'c> {
+fn _reply_cached(query: &Query, cached: CachedReply) {
+    let res = match cached.kind {
+        SampleKind::Put => {
+            let mut reply = query
+                .reply(cached.key_expr, cached.payload)
+                .encoding(cached.encoding)
+                .timestamp(cached.timestamp);
+            if let Some(attachment) = cached.attachment {
+                reply = reply.attachment(attachment);
+            }
+            reply.wait()
+        }
+        SampleKind::Delete => query
+            .reply_del(cached.key_expr)
+            .timestamp(cached.timestamp)
+            .wait(),
+    };
+    if let Err(e) = res {
+        tracing::warn!("Publication cache: failed to reply to query: {}", e);
+    }
+}
+
+/// Declares the subscriber and queryable of a publication cache implemented by zenoh-c.
+fn _declare_local_publication_cache(
+    session: &Session,
+    key_expr: KeyExpr<'static>,
+    options: &ze_publication_cache_options_t,
+    store: CacheStore,
+    background: bool,
+) -> zenoh::Result<Option<LocalPublicationCache>> {
+    let store_options = CacheStoreOptions {
+        history: options.history,
+        resources_limit: options.resources_limit,
+        max_age: (options.max_age_ms != 0).then(|| Duration::from_millis(options.max_age_ms)),
+    };
+    let queryable_key_expr = match unsafe { options.queryable_prefix.as_ref() } {
+        Some(prefix) => prefix.as_rust_type_ref().join(key_expr.as_str())?,
+        None => key_expr.clone(),
+    };
+    let subscriber_store = store.clone();
+    let subscriber = session
+        .declare_subscriber(key_expr.clone())
+        .allowed_origin(Locality::SessionLocal)
+        .callback(move |sample| subscriber_store.insert(sample, &store_options));
+    let queryable_store = store.clone();
+    let queryable = session
+        .declare_queryable(queryable_key_expr)
+        .allowed_origin(options.queryable_origin.into())
+        .complete(options.queryable_complete)
+        .callback(move |query| {
+            let time_range = match query.parameters().time_range() {
+                Some(Ok(time_range)) => Some(time_range),
+                Some(Err(e)) => {
+                    tracing::warn!("Publication cache: invalid time range in query: {}", e);
+                    None
+                }
+                None => None,
+            };
+            // replies are sent once the store is unlocked, since they may block on congestion
+            let replies =
+                queryable_store.replies(&store_options, |k| query.key_expr().intersects(k));
+            for cached in replies {
+                let in_range = match (&time_range, &cached.timestamp) {
+                    (Some(range), Some(t)) => range.contains(t.get_time().to_system_time()),
+                    (Some(_), None) => false,
+                    (None, _) => true,
+                };
+                if in_range {
+                    _reply_cached(&query, cached);
+                }
+            }
+        });
+    if background {
+        subscriber.background().wait()?;
+        queryable.background().wait()?;
+        return Ok(None);
+    }
+    let subscriber = subscriber.wait()?;
+    let queryable = queryable.wait()?;
+    Ok(Some(LocalPublicationCache {
+        key_expr,
+        store,
+        subscriber: Some(subscriber),
+        queryable: Some(queryable),
+    }))
+}
+
+fn _local_cache_store(
+    options: &ze_publication_cache_options_t,
+) -> zenoh::Result<Option<CacheStore>> {
+    if !options.log_directory.is_null() {
+        let directory = unsafe { CStr::from_ptr(options.log_directory) }.to_str()?;
+        let log = CacheLog::new(CacheLogOptions {
+            directory: directory.into(),
+            segment_size: options.log_segment_size,
+            max_segments: options.log_max_segments,
+            history: options.history,
+            resources_limit: options.resources_limit,
+            max_age: (options.max_age_ms != 0).then(|| Duration::from_millis(options.max_age_ms)),
+        })?;
+        return Ok(Some(CacheStore::Log(Arc::new(log))));
+    }
+    let budget = match unsafe { options.budget.as_ref() } {
+        Some(budget) => Some(budget.as_rust_type_ref().clone()),
+        None => (options.max_bytes != 0).then(|| Arc::new(CacheBudget::new(options.max_bytes))),
+    };
+    Ok(budget.map(|budget| {
+        let id = budget.register();
+        CacheStore::Budget(budget, id)
+    }))
+}
+
+fn _declare_publication_cache_inner(
+    session: &z_loaned_session_t,
+    key_expr: &z_loaned_keyexpr_t,
+    options: Option<&mut ze_publication_cache_options_t>,
+    background: bool,
+) -> zenoh::Result<Option<PublicationCache>> {
     let session = session.as_rust_type_ref();
     let key_expr = key_expr.as_rust_type_ref();
+    #[cfg(feature = "unstable")]
+    {
+        if let Some(options) = options.as_deref() {
+            if let Some(store) = _local_cache_store(options)? {
+                return Ok(_declare_local_publication_cache(
+                    session,
+                    key_expr.clone().into_owned(),
+                    options,
+                    store,
+                    background,
+                )?
+                .map(|p| PublicationCache::Local(Box::new(p))));
+            }
+        }
+    }
     let mut p = session.declare_publication_cache(key_expr);
     if let Some(options) = options {
         p = p.history(options.history);
@@ -93,7 +389,11 @@ fn _declare_publication_cache_inner<'a, 'b, 'c>(
             p = p.queryable_prefix(queryable_prefix.clone());
         }
     }
-    p
+    if background {
+        p.background().wait()?;
+        return Ok(None);
+    }
+    Ok(Some(PublicationCache::Ext(p.wait()?)))
 }
 
 /// @warning This API is deprecated. Please use ze_advanced_publisher.
@@ -113,10 +413,9 @@ pub extern "C" fn ze_declare_publication_cache(
     options: Option<&mut ze_publication_cache_options_t>,
 ) -> result::z_result_t {
     let this = pub_cache.as_rust_type_mut_uninit();
-    let p = _declare_publication_cache_inner(session, key_expr, options);
-    match p.wait() {
+    match _declare_publication_cache_inner(session, key_expr, options, false) {
         Ok(publication_cache) => {
-            this.write(Some(publication_cache));
+            this.write(publication_cache);
             result::Z_OK
         }
         Err(e) => {
@@ -141,8 +440,7 @@ pub extern "C" fn ze_declare_background_publication_cache(
     key_expr: &z_loaned_keyexpr_t,
     options: Option<&mut ze_publication_cache_options_t>,
 ) -> result::z_result_t {
-    let p = _declare_publication_cache_inner(session, key_expr, options);
-    match p.background().wait() {
+    match _declare_publication_cache_inner(session, key_expr, options, true) {
         Ok(_) => result::Z_OK,
         Err(e) => {
             tracing::error!("{}", e);
@@ -211,10 +509,37 @@ pub extern "C" fn ze_undeclare_publication_cache(
     this: &mut ze_moved_publication_cache_t,
 ) -> result::z_result_t {
     if let Some(p) = this.take_rust_type() {
-        if let Err(e) = p.undeclare().wait() {
+        let res = match p {
+            PublicationCache::Ext(p) => p.undeclare().wait(),
+            PublicationCache::Local(p) => p.undeclare(),
+        };
+        if let Err(e) = res {
             tracing::error!("{}", e);
             return result::Z_EGENERIC;
         }
     }
     result::Z_OK
 }
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns the number of bytes currently held by a byte-budgeted publication cache, see
+/// `ze_publication_cache_options_t::max_bytes`. The bytes held by the other caches sharing its budget are not counted,
+/// they can be read with `ze_cache_budget_resident_bytes()`.
+///
+/// For a log-backed cache, see `ze_publication_cache_options_t::log_directory`, this is the number of bytes written
+/// to its retained log segments, which are paged by the OS rather than held in memory.
+///
+/// @return 0 in case of success, `Z_EUNAVAILABLE` if the cache is bounded by the number of samples only.
+#[no_mangle]
+pub extern "C" fn ze_publication_cache_resident_bytes(
+    this_: &ze_loaned_publication_cache_t,
+    out_bytes: &mut usize,
+) -> result::z_result_t {
+    match this_.as_rust_type_ref() {
+        PublicationCache::Local(p) => {
+            *out_bytes = p.store.resident_bytes();
+            result::Z_OK
+        }
+        PublicationCache::Ext(_) => result::Z_EUNAVAILABLE,
+    }
+}
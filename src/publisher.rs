@@ -12,20 +12,40 @@
 //   ZettaScale Zenoh team, <zenoh@zettascale.tech>
 //
 
-use std::mem::MaybeUninit;
-
 #[cfg(feature = "unstable")]
-use zenoh::{handlers::Callback, matching::MatchingStatus};
+use std::{
+    ffi::c_void,
+    sync::{
+        atomic::{AtomicU8, Ordering},
+        Condvar, Mutex, MutexGuard, OnceLock, Weak,
+    },
+    thread::JoinHandle,
+    time::{Duration, Instant},
+};
+use std::{mem::MaybeUninit, ops::Deref, sync::Arc};
+
 use zenoh::{
+    bytes::{Encoding, ZBytes},
     internal::traits::{EncodingBuilderTrait, SampleBuilderTrait, TimestampBuilderTrait},
     pubsub::{Publisher, PublisherBuilder},
     qos::{CongestionControl, Priority},
     session::SessionClosedError,
     Wait,
 };
+#[cfg(feature = "unstable")]
+use zenoh::{handlers::Callback, matching::MatchingStatus, sample::SourceInfo, time::Timestamp};
 
 #[cfg(feature = "unstable")]
 use crate::zc_moved_closure_matching_status_t;
+#[cfg(feature = "unstable")]
+use crate::{
+    compression::{compressed_encoding, zc_publisher_compression_options_t},
+    delta::{zc_publisher_delta_options_t, DeltaEncoder},
+    entity_stats::{EntityKind, EntityStats},
+    transmute::IntoCType,
+    z_entity_global_id_t, z_reliability_default, z_reliability_t, zc_closure_matching_status_call,
+    zc_closure_matching_status_loan, zc_locality_default, zc_locality_t,
+};
 use crate::{
     result::{self},
     transmute::{LoanedCTypeRef, RustTypeRef, RustTypeRefUninit, TakeRustType},
@@ -34,12 +54,9 @@ use crate::{
 };
 #[cfg(feature = "unstable")]
 use crate::{
-    transmute::IntoCType, z_entity_global_id_t, z_reliability_default, z_reliability_t,
-    zc_closure_matching_status_call, zc_closure_matching_status_loan, zc_locality_default,
-    zc_locality_t,
+    z_moved_source_info_t, z_owned_bytes_t, zc_interned_encoding_t, zc_matching_status_t,
+    zc_owned_matching_listener_t,
 };
-#[cfg(feature = "unstable")]
-use crate::{z_moved_source_info_t, zc_matching_status_t, zc_owned_matching_listener_t};
 /// Options passed to the `z_declare_publisher()` function.
 #[repr(C)]
 pub struct z_publisher_options_t {
@@ -61,6 +78,21 @@ pub struct z_publisher_options_t {
     ///
     /// The allowed destination for this publisher.
     pub allowed_destination: zc_locality_t,
+    #[cfg(feature = "unstable")]
+    /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+    ///
+    /// Settings of the coalescing mode of this publisher. Ignored by `ze_declare_advanced_publisher()`.
+    pub coalesce: zc_publisher_coalesce_options_t,
+    #[cfg(feature = "unstable")]
+    /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+    ///
+    /// Settings of the payload compression of this publisher. Ignored by `ze_declare_advanced_publisher()`.
+    pub compression: zc_publisher_compression_options_t,
+    #[cfg(feature = "unstable")]
+    /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+    ///
+    /// Settings of the delta mode of this publisher.
+    pub delta: zc_publisher_delta_options_t,
 }
 
 impl Default for z_publisher_options_t {
@@ -74,6 +106,12 @@ impl Default for z_publisher_options_t {
             reliability: z_reliability_default(),
             #[cfg(feature = "unstable")]
             allowed_destination: zc_locality_default(),
+            #[cfg(feature = "unstable")]
+            coalesce: zc_publisher_coalesce_options_t::default(),
+            #[cfg(feature = "unstable")]
+            compression: zc_publisher_compression_options_t::default(),
+            #[cfg(feature = "unstable")]
+            delta: zc_publisher_delta_options_t::default(),
         }
     }
 }
@@ -84,9 +122,431 @@ pub extern "C" fn z_publisher_options_default(this_: &mut MaybeUninit<z_publishe
     this_.write(z_publisher_options_t::default());
 }
 
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Settings of the publisher coalescing mode.
+///
+/// In coalescing mode, messages put by the publisher are kept pending, and sent back to back once one of the limits
+/// below is reached, whichever comes first, or when `z_publisher_flush()` is called. This allows the transport to pack
+/// them into fewer frames, at the cost of an increased latency.
+/// If all limits are set to 0, pending messages are only sent by `z_publisher_flush()`, when a delete is issued, or when
+/// the publisher is undeclared.
+#[repr(C)]
+#[derive(Clone, Copy)]
+pub struct zc_publisher_coalesce_options_t {
+    /// Must be set to ``true``, to enable the coalescing mode.
+    pub is_enabled: bool,
+    /// Send pending messages once their total payload size reaches this number of bytes, 0 means no limit.
+    pub max_bytes: usize,
+    /// Send pending messages once their number reaches this value, 0 means no limit.
+    pub max_messages: usize,
+    /// Send pending messages at most this number of microseconds after the oldest of them was put, 0 means no deadline.
+    pub deadline_us: u64,
+}
+
+#[cfg(feature = "unstable")]
+impl Default for zc_publisher_coalesce_options_t {
+    fn default() -> Self {
+        Self {
+            is_enabled: false,
+            max_bytes: 8192,
+            max_messages: 0,
+            deadline_us: 1000,
+        }
+    }
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs the default value for `zc_publisher_coalesce_options_t`.
+#[no_mangle]
+pub extern "C" fn zc_publisher_coalesce_options_default(
+    this_: &mut MaybeUninit<zc_publisher_coalesce_options_t>,
+) {
+    this_.write(zc_publisher_coalesce_options_t::default());
+}
+
+fn _publisher_put_result(r: zenoh::Result<()>) -> result::z_result_t {
+    match r {
+        Ok(_) => result::Z_OK,
+        Err(e) if e.downcast_ref::<SessionClosedError>().is_some() => result::Z_ESESSION_CLOSED,
+        Err(e) => {
+            tracing::error!("{}", e);
+            result::Z_EGENERIC
+        }
+    }
+}
+
+#[cfg(feature = "unstable")]
+struct PendingPut {
+    payload: ZBytes,
+    encoding: Option<Encoding>,
+    source_info: Option<SourceInfo>,
+    attachment: Option<ZBytes>,
+    timestamp: Option<Timestamp>,
+}
+
+#[cfg(feature = "unstable")]
+impl PendingPut {
+    fn new(payload: ZBytes, options: Option<&mut z_publisher_put_options_t>) -> Self {
+        let mut put = PendingPut {
+            payload,
+            encoding: None,
+            source_info: None,
+            attachment: None,
+            timestamp: None,
+        };
+        if let Some(options) = options {
+            put.encoding = options.take_encoding();
+            put.source_info = options.source_info.take().map(|s| s.take_rust_type());
+            put.attachment = options.attachment.take().map(|a| a.take_rust_type());
+            put.timestamp = options.timestamp.map(|t| *t.as_rust_type_ref());
+        }
+        put
+    }
+
+    fn send(self, publisher: &Publisher<'static>) -> result::z_result_t {
+        let mut put = publisher.put(self.payload);
+        if let Some(encoding) = self.encoding {
+            put = put.encoding(encoding);
+        }
+        if let Some(source_info) = self.source_info {
+            put = put.source_info(source_info);
+        }
+        if let Some(attachment) = self.attachment {
+            put = put.attachment(attachment);
+        }
+        if self.timestamp.is_some() {
+            put = put.timestamp(self.timestamp);
+        }
+        _publisher_put_result(put.wait())
+    }
+}
+
+#[cfg(feature = "unstable")]
+#[derive(Default)]
+struct CoalesceState {
+    pending: Vec<PendingPut>,
+    bytes: usize,
+    deadline: Option<Instant>,
+    closed: bool,
+}
+
+#[cfg(feature = "unstable")]
+struct CoalesceShared {
+    state: Mutex<CoalesceState>,
+    cond: Condvar,
+    // Serializes flushes, so that batches taken by different threads are sent in order.
+    flush_lock: Mutex<()>,
+    max_bytes: usize,
+    max_messages: usize,
+    delay: Option<Duration>,
+}
+
+#[cfg(feature = "unstable")]
+impl CoalesceShared {
+    fn lock(&self) -> MutexGuard<'_, CoalesceState> {
+        self.state.lock().unwrap_or_else(|e| e.into_inner())
+    }
+
+    fn flush(&self, publisher: &Publisher<'static>) -> result::z_result_t {
+        let _guard = self.flush_lock.lock().unwrap_or_else(|e| e.into_inner());
+        let batch = {
+            let mut state = self.lock();
+            state.bytes = 0;
+            state.deadline = None;
+            std::mem::take(&mut state.pending)
+        };
+        let mut res = result::Z_OK;
+        for put in batch {
+            let r = put.send(publisher);
+            if res == result::Z_OK {
+                res = r;
+            }
+        }
+        res
+    }
+
+    fn run_timer(&self, publisher: Weak<Publisher<'static>>) {
+        let mut state = self.lock();
+        loop {
+            if state.closed {
+                return;
+            }
+            match state.deadline {
+                None => state = self.cond.wait(state).unwrap_or_else(|e| e.into_inner()),
+                Some(deadline) => {
+                    let now = Instant::now();
+                    if now < deadline {
+                        state = self
+                            .cond
+                            .wait_timeout(state, deadline - now)
+                            .unwrap_or_else(|e| e.into_inner())
+                            .0;
+                        continue;
+                    }
+                    drop(state);
+                    match publisher.upgrade() {
+                        Some(p) => {
+                            self.flush(&p);
+                        }
+                        None => return,
+                    }
+                    state = self.lock();
+                }
+            }
+        }
+    }
+}
+
+#[cfg(feature = "unstable")]
+pub struct PublisherCoalescer {
+    shared: Arc<CoalesceShared>,
+    publisher: Weak<Publisher<'static>>,
+    timer: Option<JoinHandle<()>>,
+}
+
+#[cfg(feature = "unstable")]
+impl PublisherCoalescer {
+    fn new(options: &zc_publisher_coalesce_options_t, publisher: &Arc<Publisher<'static>>) -> Self {
+        let shared = Arc::new(CoalesceShared {
+            state: Mutex::new(CoalesceState::default()),
+            cond: Condvar::new(),
+            flush_lock: Mutex::new(()),
+            max_bytes: options.max_bytes,
+            max_messages: options.max_messages,
+            delay: (options.deadline_us != 0).then(|| Duration::from_micros(options.deadline_us)),
+        });
+        let timer = if shared.delay.is_some() {
+            let s = shared.clone();
+            let p = Arc::downgrade(publisher);
+            match std::thread::Builder::new()
+                .name("zc-publisher-coalesce".to_string())
+                .spawn(move || s.run_timer(p))
+            {
+                Ok(h) => Some(h),
+                Err(e) => {
+                    tracing::error!("Failed to start the publisher coalescing timer: {}", e);
+                    None
+                }
+            }
+        } else {
+            None
+        };
+        PublisherCoalescer {
+            shared,
+            publisher: Arc::downgrade(publisher),
+            timer,
+        }
+    }
+
+    fn push(&self, publisher: &Publisher<'static>, put: PendingPut) -> result::z_result_t {
+        let flush_now = {
+            let mut state = self.shared.lock();
+            state.bytes += put.payload.len();
+            state.pending.push(put);
+            if state.deadline.is_none() {
+                if let Some(delay) = self.shared.delay {
+                    state.deadline = Some(Instant::now() + delay);
+                    self.shared.cond.notify_one();
+                }
+            }
+            (self.shared.max_messages != 0 && state.pending.len() >= self.shared.max_messages)
+                || (self.shared.max_bytes != 0 && state.bytes >= self.shared.max_bytes)
+        };
+        if flush_now {
+            self.shared.flush(publisher)
+        } else {
+            result::Z_OK
+        }
+    }
+}
+
+#[cfg(feature = "unstable")]
+impl Drop for PublisherCoalescer {
+    fn drop(&mut self) {
+        self.shared.lock().closed = true;
+        self.shared.cond.notify_one();
+        if let Some(timer) = self.timer.take() {
+            let _ = timer.join();
+        }
+        if let Some(p) = self.publisher.upgrade() {
+            self.shared.flush(&p);
+        }
+    }
+}
+
+/// A publisher, together with the state of its coalescing mode.
+pub struct CPublisher {
+    // Declared first, so that pending messages are sent before the publisher is dropped.
+    #[cfg(feature = "unstable")]
+    coalescer: Option<PublisherCoalescer>,
+    #[cfg(feature = "unstable")]
+    pub(crate) stats: Arc<EntityStats>,
+    #[cfg(feature = "unstable")]
+    blocking: bool,
+    #[cfg(feature = "unstable")]
+    compression: Option<zc_publisher_compression_options_t>,
+    #[cfg(feature = "unstable")]
+    delta: Option<DeltaEncoder>,
+    // The matching status used by `z_publisher_put_lazy()`, tracked from its first call.
+    #[cfg(feature = "unstable")]
+    matching: OnceLock<Arc<AtomicU8>>,
+    publisher: Arc<Publisher<'static>>,
+}
+
+// The values of `CPublisher::matching`, the status being unknown until a matching listener or query reports it.
+#[cfg(feature = "unstable")]
+const MATCHING_NONE: u8 = 0;
+#[cfg(feature = "unstable")]
+const MATCHING_SOME: u8 = 1;
+#[cfg(feature = "unstable")]
+const MATCHING_UNKNOWN: u8 = 2;
+
+impl CPublisher {
+    fn new(
+        publisher: Publisher<'static>,
+        #[cfg(feature = "unstable")] coalesce: Option<&zc_publisher_coalesce_options_t>,
+        #[cfg(feature = "unstable")] compression: Option<zc_publisher_compression_options_t>,
+        #[cfg(feature = "unstable")] delta: Option<zc_publisher_delta_options_t>,
+        #[cfg(feature = "unstable")] blocking: bool,
+    ) -> Self {
+        let publisher = Arc::new(publisher);
+        CPublisher {
+            #[cfg(feature = "unstable")]
+            coalescer: coalesce
+                .filter(|c| c.is_enabled)
+                .map(|c| PublisherCoalescer::new(c, &publisher)),
+            #[cfg(feature = "unstable")]
+            stats: {
+                let stats = EntityStats::new(publisher.id().zid(), EntityKind::Publisher);
+                stats.register(publisher.id());
+                stats
+            },
+            #[cfg(feature = "unstable")]
+            blocking,
+            #[cfg(feature = "unstable")]
+            compression: compression.and_then(|c| c.enabled()),
+            #[cfg(feature = "unstable")]
+            delta: delta.and_then(|d| DeltaEncoder::new(&d, publisher.id(), publisher.encoding())),
+            #[cfg(feature = "unstable")]
+            matching: OnceLock::new(),
+            publisher,
+        }
+    }
+
+    /// Returns `true` if the publisher may have matching subscribers.
+    ///
+    /// The first call declares a background matching listener updating the status, so that the next ones only load it.
+    #[cfg(feature = "unstable")]
+    fn is_matching(&self) -> bool {
+        let status = self.matching.get_or_init(|| {
+            let status = Arc::new(AtomicU8::new(MATCHING_UNKNOWN));
+            let listener = status.clone();
+            let declared = self
+                .publisher
+                .matching_listener()
+                .callback(move |m: MatchingStatus| {
+                    let matching = if m.matching() {
+                        MATCHING_SOME
+                    } else {
+                        MATCHING_NONE
+                    };
+                    listener.store(matching, Ordering::Relaxed);
+                })
+                .background()
+                .wait();
+            if let Err(e) = declared {
+                // Without a listener, the status can not be tracked, so it stays unknown and messages are always sent.
+                tracing::error!(
+                    "Failed to declare the matching listener of the publisher: {}",
+                    e
+                );
+                return status;
+            }
+            // The listener may have reported a more recent status in the meantime.
+            if let Ok(m) = self.publisher.matching_status().wait() {
+                let matching = if m.matching() {
+                    MATCHING_SOME
+                } else {
+                    MATCHING_NONE
+                };
+                let _ = status.compare_exchange(
+                    MATCHING_UNKNOWN,
+                    matching,
+                    Ordering::Relaxed,
+                    Ordering::Relaxed,
+                );
+            }
+            status
+        });
+        status.load(Ordering::Relaxed) != MATCHING_NONE
+    }
+
+    /// Sends all pending messages of the coalescing mode.
+    fn flush(&self) -> result::z_result_t {
+        #[cfg(feature = "unstable")]
+        if let Some(c) = &self.coalescer {
+            return c.shared.flush(&self.publisher);
+        }
+        result::Z_OK
+    }
+
+    /// Calls `send` with the payload encoded by the delta mode, or compressed, and ``true``, or with `payload` and
+    /// ``false`` if it should be sent as it is, returning its result.
+    ///
+    /// In delta mode, `send` runs under the lock of the encoder, so that deltas are never sent before their keyframe.
+    #[cfg(feature = "unstable")]
+    fn encode_with<R>(&self, payload: ZBytes, send: impl FnOnce(ZBytes, bool) -> R) -> R {
+        if let Some(delta) = &self.delta {
+            return delta.encode_with(&payload, |encoded| send(encoded, true));
+        }
+        match self.compression.as_ref().and_then(|c| c.compress(&payload)) {
+            Some(compressed) => send(compressed, true),
+            None => send(payload, false),
+        }
+    }
+
+    /// Returns the encoding of an encoded payload put with `encoding`, the publisher encoding if `None`.
+    #[cfg(feature = "unstable")]
+    fn encoded_encoding(&self, encoding: Option<Encoding>) -> Encoding {
+        if let Some(delta) = &self.delta {
+            return delta.encoding(encoding);
+        }
+        compressed_encoding(encoding.as_ref().unwrap_or(self.publisher.encoding()))
+    }
+
+    /// Counts a put or delete of `bytes` bytes in the publisher stats.
+    #[cfg(feature = "unstable")]
+    fn sent(&self, bytes: usize, f: impl FnOnce() -> result::z_result_t) -> result::z_result_t {
+        self.stats.sent(bytes, self.blocking, f)
+    }
+
+    #[cfg(not(feature = "unstable"))]
+    fn sent(&self, _bytes: usize, f: impl FnOnce() -> result::z_result_t) -> result::z_result_t {
+        f()
+    }
+
+    fn undeclare(self) -> zenoh::Result<()> {
+        #[cfg(feature = "unstable")]
+        std::mem::drop(self.coalescer);
+        match Arc::try_unwrap(self.publisher) {
+            Ok(p) => p.undeclare().wait(),
+            Err(_) => Ok(()),
+        }
+    }
+}
+
+impl Deref for CPublisher {
+    type Target = Publisher<'static>;
+    fn deref(&self) -> &Self::Target {
+        &self.publisher
+    }
+}
+
 pub use crate::opaque_types::{z_loaned_publisher_t, z_moved_publisher_t, z_owned_publisher_t};
 decl_c_type!(
-    owned(z_owned_publisher_t, option Publisher<'static>),
+    owned(z_owned_publisher_t, option CPublisher),
     loaned(z_loaned_publisher_t),
 );
 
@@ -135,6 +595,17 @@ pub extern "C" fn z_declare_publisher(
     options: Option<&'static mut z_publisher_options_t>,
 ) -> result::z_result_t {
     let this = publisher.as_rust_type_mut_uninit();
+    #[cfg(feature = "unstable")]
+    let coalesce = options.as_ref().map(|o| o.coalesce);
+    #[cfg(feature = "unstable")]
+    let compression = options.as_ref().map(|o| o.compression);
+    #[cfg(feature = "unstable")]
+    let delta = options.as_ref().map(|o| o.delta);
+    #[cfg(feature = "unstable")]
+    let blocking = options.as_ref().map_or(
+        matches!(CongestionControl::default(), CongestionControl::Block),
+        |o| matches!(o.congestion_control, z_congestion_control_t::BLOCK),
+    );
     let p = _declare_publisher_inner(session, key_expr, options);
     match p.wait() {
         Err(e) => {
@@ -143,12 +614,96 @@ pub extern "C" fn z_declare_publisher(
             result::Z_EGENERIC
         }
         Ok(publisher) => {
-            this.write(Some(publisher));
+            this.write(Some(CPublisher::new(
+                publisher,
+                #[cfg(feature = "unstable")]
+                coalesce.as_ref(),
+                #[cfg(feature = "unstable")]
+                compression,
+                #[cfg(feature = "unstable")]
+                delta,
+                #[cfg(feature = "unstable")]
+                blocking,
+            )));
             result::Z_OK
         }
     }
 }
 
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs and declares several publishers at once.
+///
+/// This is a convenience loop over `z_declare_publisher()`: the publishers are declared one by one, sending the same
+/// declaration messages, so neither the number of messages nor the number of round trips is reduced. The function
+/// returns once all publishers are declared.
+///
+/// @param session: The Zenoh session.
+/// @param publishers: An array of `len` uninitialized locations in memory where the publishers will be constructed.
+/// @param key_exprs: An array of `len` key expressions to publish.
+/// @param len: The number of publishers.
+/// @param options: Additional options applied to all publishers. The encoding is shared by all publishers.
+///
+/// @return 0 in case of success, negative error code otherwise. In this case, the publishers which were already
+/// declared are undeclared, and all publishers are in their gravestone state.
+#[cfg(feature = "unstable")]
+#[allow(clippy::missing_safety_doc)]
+#[no_mangle]
+pub unsafe extern "C" fn zc_declare_publishers(
+    session: &'static z_loaned_session_t,
+    publishers: *mut MaybeUninit<z_owned_publisher_t>,
+    key_exprs: *const &'static z_loaned_keyexpr_t,
+    len: usize,
+    options: Option<&'static mut z_publisher_options_t>,
+) -> result::z_result_t {
+    if (publishers.is_null() || key_exprs.is_null()) && len > 0 {
+        tracing::error!("Publishers and key expressions arrays should not be null");
+        return result::Z_EINVAL;
+    }
+    let mut options = options;
+    let coalesce = options.as_ref().map(|o| o.coalesce);
+    let compression = options.as_ref().map(|o| o.compression);
+    let delta = options.as_ref().map(|o| o.delta);
+    let blocking = options.as_ref().map_or(
+        matches!(CongestionControl::default(), CongestionControl::Block),
+        |o| matches!(o.congestion_control, z_congestion_control_t::BLOCK),
+    );
+    let encoding: Option<Encoding> = options
+        .as_deref_mut()
+        .and_then(|o| o.encoding.take())
+        .map(|e| e.take_rust_type());
+    let mut declared = Vec::with_capacity(len);
+    let mut res = result::Z_OK;
+    for i in 0..len {
+        let mut p = _declare_publisher_inner(session, *key_exprs.add(i), options.as_deref_mut());
+        if let Some(encoding) = &encoding {
+            p = p.encoding(encoding.clone());
+        }
+        match p.wait() {
+            Ok(publisher) => declared.push(CPublisher::new(
+                publisher,
+                coalesce.as_ref(),
+                compression,
+                delta,
+                blocking,
+            )),
+            Err(e) => {
+                tracing::error!("Failed to declare publisher {}: {}", i, e);
+                res = result::Z_EGENERIC;
+                break;
+            }
+        }
+    }
+    if res != result::Z_OK {
+        declared.clear();
+    }
+    let publishers = std::slice::from_raw_parts_mut(publishers, len);
+    let mut declared = declared.into_iter();
+    for p in publishers {
+        p.as_rust_type_mut_uninit().write(declared.next());
+    }
+    res
+}
+
 /// Constructs a publisher in a gravestone state.
 #[no_mangle]
 pub extern "C" fn z_internal_publisher_null(this_: &mut MaybeUninit<z_owned_publisher_t>) {
@@ -199,6 +754,12 @@ pub struct z_publisher_put_options_t {
     pub source_info: Option<&'static mut z_moved_source_info_t>,
     /// The attachment to attach to the publication.
     pub attachment: Option<&'static mut z_moved_bytes_t>,
+    #[cfg(feature = "unstable")]
+    /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+    ///
+    /// The interned encoding of the data to publish, see `zc_encoding_intern()`. Ignored if `encoding` is set.
+    /// Unlike `encoding`, it is not consumed, so that the same interned encoding can be passed to every put.
+    pub interned_encoding: Option<&'static zc_interned_encoding_t>,
 }
 
 /// Constructs the default value for `z_publisher_put_options_t`.
@@ -213,9 +774,32 @@ pub extern "C" fn z_publisher_put_options_default(
         #[cfg(feature = "unstable")]
         source_info: None,
         attachment: None,
+        #[cfg(feature = "unstable")]
+        interned_encoding: None,
     });
 }
 
+impl z_publisher_put_options_t {
+    /// Drops the owned fields of the options.
+    #[cfg(feature = "unstable")]
+    fn drop_owned(&mut self) {
+        let _ = self.encoding.take().map(|e| e.take_rust_type());
+        let _ = self.source_info.take().map(|s| s.take_rust_type());
+        let _ = self.attachment.take().map(|a| a.take_rust_type());
+    }
+
+    /// Takes the encoding of the options, falling back to their interned encoding.
+    pub(crate) fn take_encoding(&mut self) -> Option<Encoding> {
+        #[cfg(feature = "unstable")]
+        if self.encoding.is_none() {
+            return self
+                .interned_encoding
+                .map(|e| e.encoding.as_rust_type_ref().clone());
+        }
+        self.encoding.take().map(|e| e.take_rust_type())
+    }
+}
+
 pub(crate) fn _apply_pubisher_put_options<
     T: SampleBuilderTrait + TimestampBuilderTrait + EncodingBuilderTrait,
 >(
@@ -223,8 +807,8 @@ pub(crate) fn _apply_pubisher_put_options<
     options: &mut z_publisher_put_options_t,
 ) -> T {
     let mut builder = builder;
-    if let Some(encoding) = options.encoding.take() {
-        builder = builder.encoding(encoding.take_rust_type());
+    if let Some(encoding) = options.take_encoding() {
+        builder = builder.encoding(encoding);
     };
     #[cfg(feature = "unstable")]
     if let Some(source_info) = options.source_info.take() {
@@ -256,21 +840,208 @@ pub unsafe extern "C" fn z_publisher_put(
     payload: &mut z_moved_bytes_t,
     options: Option<&mut z_publisher_put_options_t>,
 ) -> result::z_result_t {
-    let publisher = this.as_rust_type_ref();
-    let payload = payload.take_rust_type();
+    publisher_put(this.as_rust_type_ref(), payload.take_rust_type(), options)
+}
+
+fn publisher_put(
+    publisher: &CPublisher,
+    payload: ZBytes,
+    options: Option<&mut z_publisher_put_options_t>,
+) -> result::z_result_t {
+    publisher.sent(payload.len(), || {
+        #[cfg(feature = "unstable")]
+        return publisher.encode_with(payload, |payload, encoded| {
+            let mut options = options;
+            let encoded_encoding = encoded.then(|| {
+                let encoding = options.as_deref_mut().and_then(|o| o.take_encoding());
+                publisher.encoded_encoding(encoding)
+            });
+            publisher_send_put(publisher, payload, options, encoded_encoding)
+        });
+        #[cfg(not(feature = "unstable"))]
+        publisher_send_put(publisher, payload, options)
+    })
+}
+
+/// Sends the put of an encoded payload with `encoded_encoding`, or the one of a payload sent as it is if `None`.
+fn publisher_send_put(
+    publisher: &CPublisher,
+    payload: ZBytes,
+    options: Option<&mut z_publisher_put_options_t>,
+    #[cfg(feature = "unstable")] encoded_encoding: Option<Encoding>,
+) -> result::z_result_t {
+    #[cfg(feature = "unstable")]
+    if let Some(coalescer) = &publisher.coalescer {
+        let mut put = PendingPut::new(payload, options);
+        if encoded_encoding.is_some() {
+            put.encoding = encoded_encoding;
+        }
+        return coalescer.push(publisher, put);
+    }
     let mut put = publisher.put(payload);
     if let Some(options) = options {
         put = _apply_pubisher_put_options(put, options);
     }
+    #[cfg(feature = "unstable")]
+    if let Some(encoding) = encoded_encoding {
+        put = put.encoding(encoding);
+    }
+    _publisher_put_result(put.wait())
+}
 
-    match put.wait() {
-        Ok(_) => result::Z_OK,
-        Err(e) if e.downcast_ref::<SessionClosedError>().is_some() => result::Z_ESESSION_CLOSED,
-        Err(e) => {
-            tracing::error!("{}", e);
-            result::Z_EGENERIC
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Sends a `PUT` message onto the publisher's key expression, producing its payload only if there are matching
+/// subscribers.
+///
+/// `produce` is called to construct the payload, unless the publisher is known to have no matching subscribers, so that
+/// the cost of serializing messages nobody receives is avoided. The first call declares a matching listener for the
+/// publisher, after which checking the matching status is a single atomic load.
+/// Since the status is updated asynchronously, a message may still be produced and dropped by zenoh just after the last
+/// subscriber disappeared, and messages put just after the first subscriber appeared may be skipped.
+///
+/// All owned options fields are consumed upon function return, whether the message is sent or not.
+///
+/// @param this_: The publisher.
+/// @param produce: The function constructing the payload in the uninitialized memory location passed to it. It should
+/// return 0 in case of success, or a negative error code, in which case the payload must be left uninitialized and no
+/// message is sent.
+/// @param context: The context passed to `produce`.
+/// @param options: The publisher put options. All owned fields will be consumed.
+///
+/// @return 0 if the message was sent or skipped, the error code of `produce` if it failed, negative error values in case
+/// of failure otherwise.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_publisher_put_lazy(
+    this_: &z_loaned_publisher_t,
+    produce: Option<
+        extern "C" fn(
+            payload: &mut MaybeUninit<z_owned_bytes_t>,
+            context: *mut c_void,
+        ) -> result::z_result_t,
+    >,
+    context: *mut c_void,
+    mut options: Option<&mut z_publisher_put_options_t>,
+) -> result::z_result_t {
+    let publisher = this_.as_rust_type_ref();
+    let Some(produce) = produce.filter(|_| publisher.is_matching()) else {
+        if let Some(options) = options.as_mut() {
+            options.drop_owned();
+        }
+        return if produce.is_some() {
+            result::Z_OK
+        } else {
+            result::Z_EINVAL
+        };
+    };
+    let mut payload = MaybeUninit::<z_owned_bytes_t>::uninit();
+    let res = produce(&mut payload, context);
+    if res != result::Z_OK {
+        if let Some(options) = options.as_mut() {
+            options.drop_owned();
         }
+        return res;
     }
+    let payload = payload.as_rust_type_mut_uninit().assume_init_read();
+    publisher_put(publisher, payload, options)
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Sends all messages kept pending by the coalescing mode of the publisher.
+///
+/// Does nothing if the coalescing mode is not enabled.
+///
+/// @return 0 in case of success, otherwise the error code of the first failed put.
+#[no_mangle]
+pub extern "C" fn z_publisher_flush(this_: &z_loaned_publisher_t) -> result::z_result_t {
+    this_.as_rust_type_ref().flush()
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Sends a sequence of `PUT` messages onto the publisher's key expression, transfering the ownership of all payloads.
+///
+/// The messages are enqueued back to back in a single call, with the put options applied to each of them.
+/// The payloads and all owned options fields are consumed upon function return, even if some of the puts fail.
+///
+/// @param this_: The publisher.
+/// @param payloads: A pointer to an array of `len` payloads to publish. All of them will be consumed.
+/// @param len: The number of payloads.
+/// @param options: The publisher put options, applied to every message. All owned fields will be consumed.
+/// @param results: An optional pointer to an array of `len` elements, that will receive the result of each individual put.
+///
+/// @return 0 if all messages were put successfully, otherwise the error code of the first failed put.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_publisher_put_batch(
+    this: &z_loaned_publisher_t,
+    payloads: *mut z_moved_bytes_t,
+    len: usize,
+    options: Option<&mut z_publisher_put_options_t>,
+    results: *mut result::z_result_t,
+) -> result::z_result_t {
+    let publisher = this.as_rust_type_ref();
+    let mut encoding = None;
+    let mut source_info = None;
+    let mut attachment = None;
+    let mut timestamp = None;
+    if let Some(options) = options {
+        encoding = options.take_encoding();
+        source_info = options.source_info.take().map(|s| s.take_rust_type());
+        attachment = options.attachment.take().map(|a| a.take_rust_type());
+        timestamp = options.timestamp.map(|t| *t.as_rust_type_ref());
+    }
+    if len == 0 {
+        return result::Z_OK;
+    }
+    if payloads.is_null() {
+        return result::Z_EINVAL;
+    }
+
+    // Messages kept pending by the coalescing mode must be sent first, to preserve ordering.
+    let mut res = publisher.flush();
+    // The encoding of the encoded payloads, marked once for all of them.
+    let mut encoded_encoding = None;
+    for (i, payload) in std::slice::from_raw_parts_mut(payloads, len)
+        .iter_mut()
+        .enumerate()
+    {
+        let payload = payload.take_rust_type();
+        let r = publisher.sent(payload.len(), || {
+            publisher.encode_with(payload, |payload, encoded| {
+                let encoding = match encoded {
+                    true => Some(
+                        &*encoded_encoding
+                            .get_or_insert_with(|| publisher.encoded_encoding(encoding.clone())),
+                    ),
+                    false => encoding.as_ref(),
+                };
+                let mut put = publisher.put(payload);
+                if let Some(encoding) = encoding {
+                    put = put.encoding(encoding.clone());
+                }
+                if let Some(source_info) = &source_info {
+                    put = put.source_info(source_info.clone());
+                }
+                if let Some(attachment) = &attachment {
+                    put = put.attachment(attachment.clone());
+                }
+                if timestamp.is_some() {
+                    put = put.timestamp(timestamp);
+                }
+                _publisher_put_result(put.wait())
+            })
+        });
+        if !results.is_null() {
+            *results.add(i) = r;
+        }
+        if res == result::Z_OK {
+            res = r;
+        }
+    }
+    res
 }
 
 /// Represents the set of options that can be applied to the delete operation by a previously declared publisher,
@@ -312,16 +1083,21 @@ pub extern "C" fn z_publisher_delete(
     options: Option<&mut z_publisher_delete_options_t>,
 ) -> result::z_result_t {
     let publisher = publisher.as_rust_type_ref();
-    let mut del = publisher.delete();
-    if let Some(options) = options {
-        del = _apply_pubisher_delete_options(del, options);
-    }
-    if let Err(e) = del.wait() {
-        tracing::error!("{}", e);
-        result::Z_EGENERIC
-    } else {
-        result::Z_OK
+    if publisher.flush() != result::Z_OK {
+        tracing::error!("Failed to send messages pending before delete");
     }
+    publisher.sent(0, || {
+        let mut del = publisher.delete();
+        if let Some(options) = options {
+            del = _apply_pubisher_delete_options(del, options);
+        }
+        if let Err(e) = del.wait() {
+            tracing::error!("{}", e);
+            result::Z_EGENERIC
+        } else {
+            result::Z_OK
+        }
+    })
 }
 #[cfg(feature = "unstable")]
 /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
@@ -451,7 +1227,7 @@ pub extern "C" fn z_publisher_drop(this: &mut z_moved_publisher_t) {
 /// @return 0 in case of success, negative error code otherwise.
 pub extern "C" fn z_undeclare_publisher(this_: &mut z_moved_publisher_t) -> result::z_result_t {
     if let Some(p) = this_.take_rust_type() {
-        if let Err(e) = p.undeclare().wait() {
+        if let Err(e) = p.undeclare() {
             tracing::error!("{}", e);
             return result::Z_ENETWORK;
         }
@@ -24,6 +24,15 @@ use zenoh::{
     Wait,
 };
 
+#[cfg(feature = "unstable")]
+use crate::{
+    get::{_call_reply_closure, _get_result},
+    transmute::IntoCType,
+    z_entity_global_id_t, z_moved_cancellation_token_t, z_moved_source_info_t,
+    zc_closure_matching_status_call, zc_closure_matching_status_loan, zc_locality_default,
+    zc_locality_t, zc_matching_status_t, zc_moved_closure_matching_status_t,
+    zc_owned_matching_listener_t, zc_reply_keyexpr_default, zc_reply_keyexpr_t,
+};
 use crate::{
     result,
     transmute::{LoanedCTypeRef, RustTypeRef, RustTypeRefUninit, TakeRustType},
@@ -32,13 +41,6 @@ use crate::{
     z_moved_encoding_t, z_moved_querier_t, z_owned_querier_t, z_priority_t,
     z_query_consolidation_t, z_query_target_t,
 };
-#[cfg(feature = "unstable")]
-use crate::{
-    transmute::IntoCType, z_entity_global_id_t, z_moved_source_info_t,
-    zc_closure_matching_status_call, zc_closure_matching_status_loan, zc_locality_default,
-    zc_locality_t, zc_matching_status_t, zc_moved_closure_matching_status_t,
-    zc_owned_matching_listener_t, zc_reply_keyexpr_default, zc_reply_keyexpr_t,
-};
 
 /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
 /// @brief Options passed to the `z_declare_querier()` function.
@@ -200,6 +202,12 @@ pub struct z_querier_get_options_t {
     pub source_info: Option<&'static mut z_moved_source_info_t>,
     /// An optional attachment to attach to the query.
     pub attachment: Option<&'static mut z_moved_bytes_t>,
+    #[cfg(feature = "unstable")]
+    /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+    ///
+    /// An optional cancellation token, see `z_cancellation_token_new()`. Once it is cancelled, the reply callback is
+    /// dropped without waiting for the query to be finalized.
+    pub cancellation_token: Option<&'static mut z_moved_cancellation_token_t>,
 }
 
 /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
@@ -213,6 +221,8 @@ pub extern "C" fn z_querier_get_options_default(this: &mut MaybeUninit<z_querier
         #[cfg(feature = "unstable")]
         source_info: None,
         attachment: None,
+        #[cfg(feature = "unstable")]
+        cancellation_token: None,
     });
 }
 
@@ -225,7 +235,8 @@ pub extern "C" fn z_querier_get_options_default(this: &mut MaybeUninit<z_querier
 /// @param callback: The callback function that will be called on reception of replies for this query. It will be automatically dropped once all replies are processed.
 /// @param options: Additional options for the get. All owned fields will be consumed.
 ///
-/// @return 0 in case of success, a negative error value upon failure.
+/// @return 0 in case of success, a negative error value upon failure. If the cancellation token of the options is
+/// already cancelled, the query is not sent and 0 is returned, the callback being dropped.
 #[allow(clippy::missing_safety_doc)]
 #[no_mangle]
 pub unsafe extern "C" fn z_querier_get(
@@ -237,6 +248,8 @@ pub unsafe extern "C" fn z_querier_get(
     let querier = querier.as_rust_type_ref();
     let callback = callback.take_rust_type();
     let mut get = querier.get();
+    #[cfg(feature = "unstable")]
+    let mut cancellation_token = None;
     if let Some(options) = options {
         if let Some(payload) = options.payload.take() {
             get = get.payload(payload.take_rust_type());
@@ -251,10 +264,24 @@ pub unsafe extern "C" fn z_querier_get(
         if let Some(attachment) = options.attachment.take() {
             get = get.attachment(attachment.take_rust_type());
         }
+        #[cfg(feature = "unstable")]
+        {
+            cancellation_token = options
+                .cancellation_token
+                .take()
+                .and_then(|t| t.take_rust_type());
+        }
     }
     if !parameters.is_null() {
         get = get.parameters(CStr::from_ptr(parameters).to_str().unwrap());
     }
+    #[cfg(feature = "unstable")]
+    if let Some(token) = cancellation_token {
+        let Some(on_reply) = token.wrap(callback, _call_reply_closure) else {
+            return result::Z_OK;
+        };
+        return _get_result(get.callback(on_reply).wait());
+    }
     match get
         .callback(move |response| {
             let mut owned_response = Some(response);
@@ -24,6 +24,13 @@ use zenoh::{
 pub use crate::opaque_types::{z_loaned_queryable_t, z_owned_queryable_t};
 #[cfg(feature = "unstable")]
 use crate::transmute::IntoCType;
+#[cfg(feature = "unstable")]
+use crate::{
+    deferred::Deferred,
+    entity_stats::{EntityKind, EntityStats},
+    platform::ShardedWorkers,
+    z_entity_global_id_t, z_loaned_executor_t, z_moved_source_info_t,
+};
 use crate::{
     result,
     transmute::{IntoRustType, LoanedCTypeRef, RustTypeRef, RustTypeRefUninit, TakeRustType},
@@ -32,8 +39,6 @@ use crate::{
     z_moved_closure_query_t, z_moved_encoding_t, z_moved_queryable_t, z_priority_t, z_timestamp_t,
     z_view_string_from_substr, z_view_string_t,
 };
-#[cfg(feature = "unstable")]
-use crate::{z_entity_global_id_t, z_moved_source_info_t};
 decl_c_type!(
     owned(z_owned_queryable_t, option Queryable<()>),
     loaned(z_loaned_queryable_t),
@@ -114,12 +119,38 @@ pub extern "C" fn z_query_clone(dst: &mut MaybeUninit<z_owned_query_t>, this_: &
 pub struct z_queryable_options_t {
     /// The completeness of the Queryable.
     pub complete: bool,
+    /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+    /// @brief The number of dedicated worker threads running the queryable callback. If 0 (default), the callback is
+    /// run inline on the zenoh runtime thread which received the query.
+    ///
+    /// Queries on the same key expression are always dispatched to the same worker, so that they are processed in order.
+    #[cfg(feature = "unstable")]
+    pub worker_threads: usize,
+    /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+    /// @brief The maximal number of queries waiting for each worker thread, ignored if `worker_threads` is 0.
+    /// A query received while the queue of its worker is full is rejected with an error reply.
+    #[cfg(feature = "unstable")]
+    pub worker_queue_size: usize,
+    /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+    /// @brief The executor running the workers, ignored if `worker_threads` is 0. If NULL (default), each worker is a
+    /// dedicated thread. Otherwise `worker_threads` is the number of workers run by the executor, each of them
+    /// processing its queries in order, and the executor is kept until the queryable is dropped.
+    #[cfg(feature = "unstable")]
+    pub worker_executor: Option<&'static z_loaned_executor_t>,
 }
 /// Constructs the default value for `z_query_reply_options_t`.
 #[no_mangle]
 #[allow(clippy::missing_safety_doc)]
 pub extern "C" fn z_queryable_options_default(this_: &mut MaybeUninit<z_queryable_options_t>) {
-    this_.write(z_queryable_options_t { complete: false });
+    this_.write(z_queryable_options_t {
+        complete: false,
+        #[cfg(feature = "unstable")]
+        worker_threads: 0,
+        #[cfg(feature = "unstable")]
+        worker_queue_size: 64,
+        #[cfg(feature = "unstable")]
+        worker_executor: None,
+    });
 }
 
 /// Represents the set of options that can be applied to a query reply,
@@ -219,29 +250,109 @@ pub extern "C" fn z_query_reply_del_options_default(
     });
 }
 
+fn _call_query_closure(callback: &z_owned_closure_query_t, query: Query) {
+    let mut owned_query = Some(query);
+    z_closure_query_call(z_closure_query_loan(callback), unsafe {
+        owned_query
+            .as_mut()
+            .unwrap_unchecked()
+            .as_loaned_c_type_mut()
+    })
+}
+
+/// Starts `threads` workers running `callback`, returns the function dispatching the queries to them.
+///
+/// The workers exit once the returned function is dropped (i.e. when the queryable is undeclared) and their queue
+/// is drained, the last one dropping `callback`.
+#[cfg(feature = "unstable")]
+fn _query_worker_pool(
+    callback: z_owned_closure_query_t,
+    threads: usize,
+    queue_size: usize,
+    executor: Option<&z_loaned_executor_t>,
+    stats: std::sync::Arc<EntityStats>,
+) -> std::io::Result<impl Fn(Query) + Send + Sync + 'static> {
+    use std::{
+        collections::hash_map::DefaultHasher,
+        hash::{Hash, Hasher},
+    };
+    let workers = ShardedWorkers::new(
+        "zc-queryable-worker",
+        threads,
+        queue_size,
+        executor,
+        move |query| _call_query_closure(&callback, query),
+    )?;
+    Ok(move |query: Query| {
+        let len = query.payload().map_or(0, |p| p.len());
+        let mut hasher = DefaultHasher::new();
+        query.key_expr().as_str().hash(&mut hasher);
+        if let Err(query) = stats.received(len, None, || workers.try_send(hasher.finish(), query)) {
+            stats.rejected();
+            tracing::warn!(
+                "Queryable worker queue is full, rejecting query on {}",
+                query.key_expr()
+            );
+            if let Err(e) = query.reply_err("queryable overloaded").wait() {
+                tracing::error!("{}", e);
+            }
+        }
+    })
+}
+
 fn _declare_queryable_inner<'a, 'b>(
     session: &'a z_loaned_session_t,
     key_expr: &'b z_loaned_keyexpr_t,
     callback: &mut z_moved_closure_query_t,
     options: Option<&mut z_queryable_options_t>,
-) -> QueryableBuilder<'a, 'b, Callback<Query>> {
+    #[cfg(feature = "unstable")] stats: std::sync::Arc<EntityStats>,
+) -> Result<QueryableBuilder<'a, 'b, Callback<Query>>, result::z_result_t> {
     let session = session.as_rust_type_ref();
     let keyexpr = key_expr.as_rust_type_ref();
     let callback = callback.take_rust_type();
     let mut builder = session.declare_queryable(keyexpr);
-    if let Some(options) = options {
+    if let Some(options) = options.as_deref() {
         builder = builder.complete(options.complete);
     }
-    let queryable = builder.callback(move |query| {
-        let mut owned_query = Some(query);
-        z_closure_query_call(z_closure_query_loan(&callback), unsafe {
-            owned_query
-                .as_mut()
-                .unwrap_unchecked()
-                .as_loaned_c_type_mut()
-        })
-    });
-    queryable
+    #[cfg(feature = "unstable")]
+    if let Some(options) = options.filter(|o| o.worker_threads > 0) {
+        return match _query_worker_pool(
+            callback,
+            options.worker_threads,
+            options.worker_queue_size,
+            options.worker_executor,
+            stats,
+        ) {
+            Ok(dispatch) => Ok(builder.callback(dispatch)),
+            Err(e) => {
+                tracing::error!("Failed to spawn queryable worker threads: {}", e);
+                Err(result::Z_EGENERIC)
+            }
+        };
+    }
+    #[cfg(feature = "unstable")]
+    if let Some(deferred) = Deferred::of_session(session.zid()) {
+        let callback = std::sync::Arc::new(callback);
+        return Ok(builder.callback(move |query| {
+            // The closure is dropped with the queryable, even if some of its queries are still queued.
+            let (stats, callback) = (stats.clone(), std::sync::Arc::downgrade(&callback));
+            deferred.defer(move || {
+                if let Some(callback) = callback.upgrade() {
+                    stats.received(query.payload().map_or(0, |p| p.len()), None, || {
+                        _call_query_closure(&callback, query)
+                    })
+                }
+            });
+        }));
+    }
+    Ok(builder.callback(move |query| {
+        #[cfg(feature = "unstable")]
+        return stats.received(query.payload().map_or(0, |p| p.len()), None, || {
+            _call_query_closure(&callback, query)
+        });
+        #[cfg(not(feature = "unstable"))]
+        _call_query_closure(&callback, query)
+    }))
 }
 
 /// Constructs a Queryable for the given key expression.
@@ -262,9 +373,26 @@ pub extern "C" fn z_declare_queryable(
     options: Option<&mut z_queryable_options_t>,
 ) -> result::z_result_t {
     let this = queryable.as_rust_type_mut_uninit();
-    let queryable = _declare_queryable_inner(session, key_expr, callback, options);
+    #[cfg(feature = "unstable")]
+    let stats = EntityStats::new(session.as_rust_type_ref().zid(), EntityKind::Queryable);
+    let queryable = match _declare_queryable_inner(
+        session,
+        key_expr,
+        callback,
+        options,
+        #[cfg(feature = "unstable")]
+        stats.clone(),
+    ) {
+        Ok(queryable) => queryable,
+        Err(e) => {
+            this.write(None);
+            return e;
+        }
+    };
     match queryable.wait() {
         Ok(q) => {
+            #[cfg(feature = "unstable")]
+            stats.register(q.id());
             this.write(Some(q));
             result::Z_OK
         }
@@ -292,7 +420,17 @@ pub extern "C" fn z_declare_background_queryable(
     callback: &mut z_moved_closure_query_t,
     options: Option<&mut z_queryable_options_t>,
 ) -> result::z_result_t {
-    let queryable = _declare_queryable_inner(session, key_expr, callback, options);
+    let queryable = match _declare_queryable_inner(
+        session,
+        key_expr,
+        callback,
+        options,
+        #[cfg(feature = "unstable")]
+        EntityStats::new(session.as_rust_type_ref().zid(), EntityKind::Queryable),
+    ) {
+        Ok(queryable) => queryable,
+        Err(e) => return e,
+    };
     match queryable.background().wait() {
         Ok(_) => result::Z_OK,
         Err(e) => {
@@ -375,6 +513,95 @@ pub extern "C" fn z_query_reply(
     result::Z_OK
 }
 
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Sends several replies to a query, transfering the ownership of all payloads.
+///
+/// The replies are sent back to back in a single call, with the reply options applied to each of them.
+/// The payloads and all owned options fields are consumed upon function return, even if some of the replies fail.
+/// Like `z_query_reply()`, this function must be called inside of a Queryable callback, or before the query is dropped.
+///
+/// @param this_: The query to reply to.
+/// @param key_exprs: A pointer to an array of `len` keys of the replies.
+/// @param payloads: A pointer to an array of `len` payloads of the replies. All of them will be consumed.
+/// @param len: The number of replies.
+/// @param options: The options applied to every reply. All owned fields will be consumed.
+/// @param results: An optional pointer to an array of `len` elements, that will receive the result of each individual reply.
+///
+/// @return 0 if all replies were sent successfully, otherwise the error code of the first failed reply.
+#[allow(clippy::missing_safety_doc)]
+#[no_mangle]
+pub unsafe extern "C" fn z_query_reply_batch(
+    this: &z_loaned_query_t,
+    key_exprs: *const &z_loaned_keyexpr_t,
+    payloads: *mut z_moved_bytes_t,
+    len: usize,
+    options: Option<&mut z_query_reply_options_t>,
+    results: *mut result::z_result_t,
+) -> result::z_result_t {
+    let query = this.as_rust_type_ref();
+    let mut encoding = None;
+    let mut source_info = None;
+    let mut attachment = None;
+    let mut timestamp = None;
+    let mut qos: Option<(Priority, CongestionControl, bool)> = None;
+    if let Some(options) = options {
+        encoding = options.encoding.take().map(|e| e.take_rust_type());
+        source_info = options.source_info.take().map(|s| s.take_rust_type());
+        attachment = options.attachment.take().map(|a| a.take_rust_type());
+        timestamp = options.timestamp.as_ref().map(|t| t.into_rust_type());
+        qos = Some((
+            options.priority.into(),
+            options.congestion_control.into(),
+            options.is_express,
+        ));
+    }
+    if len == 0 {
+        return result::Z_OK;
+    }
+    if key_exprs.is_null() || payloads.is_null() {
+        return result::Z_EINVAL;
+    }
+    let key_exprs = std::slice::from_raw_parts(key_exprs, len);
+    let payloads = std::slice::from_raw_parts_mut(payloads, len);
+    let mut res = result::Z_OK;
+    for (i, (key_expr, payload)) in key_exprs.iter().zip(payloads.iter_mut()).enumerate() {
+        let mut reply = query.reply(key_expr.as_rust_type_ref(), payload.take_rust_type());
+        if let Some(encoding) = &encoding {
+            reply = reply.encoding(encoding.clone());
+        }
+        if let Some(source_info) = &source_info {
+            reply = reply.source_info(source_info.clone());
+        }
+        if let Some(attachment) = &attachment {
+            reply = reply.attachment(attachment.clone());
+        }
+        if timestamp.is_some() {
+            reply = reply.timestamp(timestamp);
+        }
+        if let Some((priority, congestion_control, is_express)) = qos {
+            reply = reply
+                .priority(priority)
+                .congestion_control(congestion_control)
+                .express(is_express);
+        }
+        let r = match reply.wait() {
+            Ok(()) => result::Z_OK,
+            Err(e) => {
+                tracing::error!("{}", e);
+                result::Z_EGENERIC
+            }
+        };
+        if !results.is_null() {
+            *results.add(i) = r;
+        }
+        if res == result::Z_OK {
+            res = r;
+        }
+    }
+    res
+}
+
 /// Sends a error reply to a query.
 ///
 /// This function must be called inside of a Queryable callback passing the
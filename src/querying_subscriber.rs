@@ -13,9 +13,16 @@
 //
 #![allow(deprecated)]
 
-use std::mem::MaybeUninit;
+use std::{
+    collections::HashMap,
+    mem::MaybeUninit,
+    sync::{Arc, Mutex},
+};
 
-use zenoh::{handlers::Callback, sample::Sample, session::Session, Wait};
+use zenoh::{
+    handlers::Callback, key_expr::KeyExpr, pubsub::Subscriber, query::Reply, sample::Sample,
+    session::Session, time::Timestamp, Wait,
+};
 use zenoh_ext::*;
 
 use crate::{
@@ -23,19 +30,65 @@ use crate::{
     result,
     transmute::{LoanedCTypeRef, RustTypeRef, RustTypeRefUninit, TakeRustType},
     z_closure_sample_call, z_closure_sample_loan, z_get_options_t, z_loaned_keyexpr_t,
-    z_loaned_session_t, z_moved_closure_sample_t, z_query_consolidation_none,
-    z_query_consolidation_t, z_query_target_default, z_query_target_t,
+    z_loaned_session_t, z_moved_closure_sample_t, z_owned_closure_sample_t,
+    z_query_consolidation_none, z_query_consolidation_t, z_query_target_default, z_query_target_t,
 };
 #[cfg(feature = "unstable")]
 use crate::{
     zc_locality_default, zc_locality_t, zc_reply_keyexpr_default, zc_reply_keyexpr_t,
     ze_moved_querying_subscriber_t,
 };
+
+/// Delivers the samples of a streaming querying subscriber, dropping those which are not newer than the last
+/// delivered one for the same key expression.
+struct StreamingMerge {
+    high_water: Mutex<HashMap<KeyExpr<'static>, Timestamp>>,
+    callback: z_owned_closure_sample_t,
+}
+
+impl StreamingMerge {
+    fn deliver(&self, sample: Sample) {
+        // the lock is held while calling the callback, so that samples of a key are delivered in timestamp order
+        let mut high_water = self.high_water.lock().unwrap_or_else(|e| e.into_inner());
+        if let Some(timestamp) = sample.timestamp() {
+            match high_water.get_mut(sample.key_expr()) {
+                Some(last) if *timestamp <= *last => return,
+                Some(last) => *last = *timestamp,
+                None => {
+                    high_water.insert(sample.key_expr().clone(), *timestamp);
+                }
+            }
+        }
+        let mut owned_sample = Some(sample);
+        z_closure_sample_call(z_closure_sample_loan(&self.callback), unsafe {
+            owned_sample
+                .as_mut()
+                .unwrap_unchecked()
+                .as_loaned_c_type_mut()
+        });
+    }
+
+    fn deliver_reply(&self, reply: Reply) {
+        if let Ok(sample) = reply.into_result() {
+            self.deliver(sample);
+        }
+    }
+}
+
+/// A querying subscriber delivering the query replies as they arrive, see
+/// `ze_querying_subscriber_options_t::streaming_merge`.
+pub struct StreamingQueryingSubscriber {
+    subscriber: Subscriber<()>,
+    merge: Arc<StreamingMerge>,
+}
+
+pub enum QueryingSubscriber {
+    Fetching(zenoh_ext::FetchingSubscriber<()>),
+    Streaming(Box<StreamingQueryingSubscriber>),
+}
+
 decl_c_type!(
-    owned(
-        ze_owned_querying_subscriber_t,
-        option(zenoh_ext::FetchingSubscriber<()>, &'static Session),
-    ),
+    owned(ze_owned_querying_subscriber_t, option(QueryingSubscriber, &'static Session)),
     loaned(ze_loaned_querying_subscriber_t),
 );
 
@@ -69,6 +122,12 @@ pub struct ze_querying_subscriber_options_t {
     query_accept_replies: zc_reply_keyexpr_t,
     /// The timeout to be used for queries.
     query_timeout_ms: u64,
+    /// If ``true``, query replies are delivered as they arrive, instead of being merged with the publications
+    /// buffered until the query completes. A sample is only delivered if its timestamp is newer than the last delivered
+    /// one for its key expression, so that superseded samples are dropped and the memory used only depends on the number
+    /// of key expressions. Samples without timestamp are always delivered.
+    #[cfg(feature = "unstable")]
+    streaming_merge: bool,
 }
 
 /// @warning This API is deprecated. Please use ze_advanced_subscriber.
@@ -86,6 +145,8 @@ pub extern "C" fn ze_querying_subscriber_options_default(
         #[cfg(feature = "unstable")]
         query_accept_replies: zc_reply_keyexpr_default(),
         query_timeout_ms: 0,
+        #[cfg(feature = "unstable")]
+        streaming_merge: false,
     });
 }
 
@@ -130,6 +191,50 @@ unsafe fn _declare_querying_subscriber_inner<'a, 'b>(
     });
     sub
 }
+
+/// Declares the subscriber of a streaming querying subscriber and sends its initial query.
+unsafe fn _declare_streaming_querying_subscriber(
+    session: &z_loaned_session_t,
+    key_expr: &z_loaned_keyexpr_t,
+    callback: &mut z_moved_closure_sample_t,
+    options: &ze_querying_subscriber_options_t,
+    background: bool,
+) -> zenoh::Result<Option<StreamingQueryingSubscriber>> {
+    let session = session.as_rust_type_ref();
+    let key_expr = key_expr.as_rust_type_ref().clone().into_owned();
+    let merge = Arc::new(StreamingMerge {
+        high_water: Mutex::new(HashMap::new()),
+        callback: callback.take_rust_type(),
+    });
+    let subscriber_merge = merge.clone();
+    let subscriber = session
+        .declare_subscriber(key_expr.clone())
+        .allowed_origin(options.allowed_origin.into())
+        .callback(move |sample| subscriber_merge.deliver(sample));
+    let subscriber = if background {
+        subscriber.background().wait()?;
+        None
+    } else {
+        Some(subscriber.wait()?)
+    };
+    let selector = match options.query_selector {
+        Some(query_selector) => query_selector.as_rust_type_ref().clone().into_owned(),
+        None => key_expr,
+    };
+    let mut get = session
+        .get(selector)
+        .target(options.query_target.into())
+        .consolidation(options.query_consolidation)
+        .accept_replies(options.query_accept_replies.into());
+    if options.query_timeout_ms != 0 {
+        get = get.timeout(std::time::Duration::from_millis(options.query_timeout_ms));
+    }
+    let query_merge = merge.clone();
+    get.callback(move |reply| query_merge.deliver_reply(reply))
+        .wait()?;
+    Ok(subscriber.map(|subscriber| StreamingQueryingSubscriber { subscriber, merge }))
+}
+
 /// @warning This API is deprecated. Please use ze_advanced_subscriber.
 /// @brief Constructs and declares a querying subscriber for a given key expression.
 ///
@@ -150,11 +255,30 @@ pub unsafe extern "C" fn ze_declare_querying_subscriber(
     options: Option<&mut ze_querying_subscriber_options_t>,
 ) -> result::z_result_t {
     let this = querying_subscriber.as_rust_type_mut_uninit();
+    #[cfg(feature = "unstable")]
+    {
+        if let Some(options) = options.as_deref().filter(|o| o.streaming_merge) {
+            return match _declare_streaming_querying_subscriber(
+                session, key_expr, callback, options, false,
+            ) {
+                Ok(sub) => {
+                    let sub = sub.map(|sub| QueryingSubscriber::Streaming(Box::new(sub)));
+                    this.write(sub.map(|sub| (sub, session.as_rust_type_ref())));
+                    result::Z_OK
+                }
+                Err(e) => {
+                    tracing::debug!("{}", e);
+                    this.write(None);
+                    result::Z_EGENERIC
+                }
+            };
+        }
+    }
     let sub = _declare_querying_subscriber_inner(session, key_expr, callback, options);
     match sub.wait() {
         Ok(sub) => {
             let session = session.as_rust_type_ref();
-            this.write(Some((sub, session)));
+            this.write(Some((QueryingSubscriber::Fetching(sub), session)));
             result::Z_OK
         }
         Err(e) => {
@@ -183,6 +307,20 @@ pub unsafe extern "C" fn ze_declare_background_querying_subscriber(
     callback: &mut z_moved_closure_sample_t,
     options: Option<&mut ze_querying_subscriber_options_t>,
 ) -> result::z_result_t {
+    #[cfg(feature = "unstable")]
+    {
+        if let Some(options) = options.as_deref().filter(|o| o.streaming_merge) {
+            return match _declare_streaming_querying_subscriber(
+                session, key_expr, callback, options, true,
+            ) {
+                Ok(_) => result::Z_OK,
+                Err(e) => {
+                    tracing::debug!("{}", e);
+                    result::Z_EGENERIC
+                }
+            };
+        }
+    }
     let sub = _declare_querying_subscriber_inner(session, key_expr, callback, options);
     match sub.background().wait() {
         Ok(_) => result::Z_OK,
@@ -208,50 +346,55 @@ pub unsafe extern "C" fn ze_querying_subscriber_get(
     let sub = this.as_rust_type_ref();
     let session = sub.1;
     let selector = selector.as_rust_type_ref().clone();
-    if let Err(e) = sub
-        .0
-        .fetch({
-            move |cb| {
-                let mut get = session.get(selector);
-
-                if let Some(options) = options {
-                    if let Some(payload) = options.payload.take() {
-                        get = get.payload(payload.take_rust_type());
-                    }
-                    if let Some(encoding) = options.encoding.take() {
-                        get = get.encoding(encoding.take_rust_type());
-                    }
-                    if let Some(attachment) = options.attachment.take() {
-                        get = get.attachment(attachment.take_rust_type());
-                    }
+    let make_get = move || {
+        let mut get = session.get(selector);
 
-                    get = get
-                        .consolidation(options.consolidation)
-                        .target(options.target.into())
-                        .congestion_control(options.congestion_control.into())
-                        .priority(options.priority.into())
-                        .express(options.is_express);
+        if let Some(options) = options {
+            if let Some(payload) = options.payload.take() {
+                get = get.payload(payload.take_rust_type());
+            }
+            if let Some(encoding) = options.encoding.take() {
+                get = get.encoding(encoding.take_rust_type());
+            }
+            if let Some(attachment) = options.attachment.take() {
+                get = get.attachment(attachment.take_rust_type());
+            }
 
-                    #[cfg(feature = "unstable")]
-                    {
-                        if let Some(source_info) = options.source_info.take() {
-                            get = get.source_info(source_info.take_rust_type());
-                        }
-                        get = get
-                            .allowed_destination(options.allowed_destination.into())
-                            .accept_replies(options.accept_replies.into());
-                    }
+            get = get
+                .consolidation(options.consolidation)
+                .target(options.target.into())
+                .congestion_control(options.congestion_control.into())
+                .priority(options.priority.into())
+                .express(options.is_express);
 
-                    if options.timeout_ms != 0 {
-                        get = get.timeout(std::time::Duration::from_millis(options.timeout_ms));
-                    }
+            #[cfg(feature = "unstable")]
+            {
+                if let Some(source_info) = options.source_info.take() {
+                    get = get.source_info(source_info.take_rust_type());
                 }
+                get = get
+                    .allowed_destination(options.allowed_destination.into())
+                    .accept_replies(options.accept_replies.into());
+            }
 
-                get.callback(cb).wait()
+            if options.timeout_ms != 0 {
+                get = get.timeout(std::time::Duration::from_millis(options.timeout_ms));
             }
-        })
-        .wait()
-    {
+        }
+        get
+    };
+    let res = match &sub.0 {
+        QueryingSubscriber::Fetching(fetching) => fetching
+            .fetch(move |cb| make_get().callback(cb).wait())
+            .wait(),
+        QueryingSubscriber::Streaming(streaming) => {
+            let merge = streaming.merge.clone();
+            make_get()
+                .callback(move |reply| merge.deliver_reply(reply))
+                .wait()
+        }
+    };
+    if let Err(e) = res {
         tracing::debug!("{}", e);
         return result::Z_EGENERIC;
     }
@@ -297,7 +440,11 @@ pub extern "C" fn ze_undeclare_querying_subscriber(
     this_: &mut ze_moved_querying_subscriber_t,
 ) -> result::z_result_t {
     if let Some(s) = this_.take_rust_type() {
-        if let Err(e) = s.0.undeclare().wait() {
+        let res = match s.0 {
+            QueryingSubscriber::Fetching(fetching) => fetching.undeclare().wait(),
+            QueryingSubscriber::Streaming(streaming) => streaming.subscriber.undeclare().wait(),
+        };
+        if let Err(e) = res {
             tracing::error!("{}", e);
             return result::Z_EGENERIC;
         }
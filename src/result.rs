@@ -32,4 +32,5 @@ pub const Z_EBUSY_MUTEX: z_result_t = -16;
 pub const Z_EINVAL_MUTEX: z_result_t = -22;
 pub const Z_EAGAIN_MUTEX: z_result_t = -11;
 pub const Z_EPOISON_MUTEX: z_result_t = -22; // same as Z_EINVAL_MUTEX
+pub const Z_ETIMEDOUT: z_result_t = -110;
 pub const Z_EGENERIC: z_result_t = i8::MIN;
@@ -0,0 +1,219 @@
+//
+// Copyright (c) 2024 ZettaScale Technology.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh team, <zenoh@zettascale.tech>
+//
+
+use std::{
+    fmt::Write,
+    mem::MaybeUninit,
+    sync::atomic::{AtomicBool, Ordering},
+};
+
+use tokio::runtime::Handle;
+use zenoh_runtime::ZRuntime;
+
+use crate::result;
+
+const ZENOH_RUNTIME_ENV: &str = "ZENOH_RUNTIME";
+
+// Set once the runtime is configured or used by a session, after which its pools can not be configured anymore.
+static RUNTIME_STARTED: AtomicBool = AtomicBool::new(false);
+
+/// Marks the runtime as used, called before opening a session.
+pub(crate) fn runtime_started() {
+    RUNTIME_STARTED.store(true, Ordering::Relaxed);
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief The settings of one of the thread pools of the zenoh runtime.
+#[repr(C)]
+#[derive(Default, Clone, Copy)]
+pub struct zc_runtime_pool_options_t {
+    /// The number of worker threads of the pool, 0 for the zenoh default.
+    pub worker_threads: usize,
+    /// The maximum number of threads running blocking operations of the pool, 0 for the zenoh default.
+    pub max_blocking_threads: usize,
+    /// The CPUs the threads of the pool may run on, bit `i` standing for CPU `i`, 0 to keep the affinity
+    /// of the thread calling `zc_init_runtime()`. Only supported on Linux.
+    pub cpu_affinity_mask: u64,
+    /// The nice value of the threads of the pool, 0 to keep the one of the thread calling `zc_init_runtime()`.
+    /// Only supported on Linux.
+    pub nice: i32,
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Options passed to the `zc_init_runtime()` function, one per thread pool of the zenoh runtime.
+#[repr(C)]
+#[derive(Default, Clone, Copy)]
+pub struct zc_runtime_options_t {
+    /// The pool running the application tasks, e.g. the callbacks of subscribers and queryables.
+    pub app: zc_runtime_pool_options_t,
+    /// The pool accepting incoming connections.
+    pub acc: zc_runtime_pool_options_t,
+    /// The pool transmitting messages.
+    pub tx: zc_runtime_pool_options_t,
+    /// The pool receiving messages.
+    pub rx: zc_runtime_pool_options_t,
+    /// The pool running the other network tasks.
+    pub net: zc_runtime_pool_options_t,
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs the default value for `zc_runtime_options_t`, which keeps the zenoh defaults for all pools.
+#[no_mangle]
+pub extern "C" fn zc_runtime_options_default(this_: &mut MaybeUninit<zc_runtime_options_t>) {
+    this_.write(zc_runtime_options_t::default());
+}
+
+impl zc_runtime_options_t {
+    fn pools(&self) -> [(&'static str, ZRuntime, &zc_runtime_pool_options_t); 5] {
+        [
+            ("app", ZRuntime::Application, &self.app),
+            ("acc", ZRuntime::Acceptor, &self.acc),
+            ("tx", ZRuntime::TX, &self.tx),
+            ("rx", ZRuntime::RX, &self.rx),
+            ("net", ZRuntime::Net, &self.net),
+        ]
+    }
+
+    /// The value of `ZENOH_RUNTIME` setting the thread counts, `None` if all of them are the defaults.
+    fn runtime_param(&self) -> Option<String> {
+        let mut param = String::new();
+        for (name, _, pool) in self.pools() {
+            let mut fields = Vec::new();
+            if pool.worker_threads != 0 {
+                fields.push(format!("worker_threads: {}", pool.worker_threads));
+            }
+            if pool.max_blocking_threads != 0 {
+                fields.push(format!(
+                    "max_blocking_threads: {}",
+                    pool.max_blocking_threads
+                ));
+            }
+            if !fields.is_empty() {
+                let sep = if param.is_empty() { "" } else { ", " };
+                let _ = write!(param, "{sep}{name}: ({})", fields.join(", "));
+            }
+        }
+        (!param.is_empty()).then(|| format!("({param})"))
+    }
+}
+
+#[cfg(target_os = "linux")]
+fn set_thread_scheduling(pool: &zc_runtime_pool_options_t) -> std::io::Result<()> {
+    if pool.cpu_affinity_mask != 0 {
+        unsafe {
+            let mut set: libc::cpu_set_t = std::mem::zeroed();
+            for cpu in 0..u64::BITS as usize {
+                if pool.cpu_affinity_mask & (1 << cpu) != 0 {
+                    libc::CPU_SET(cpu, &mut set);
+                }
+            }
+            if libc::sched_setaffinity(0, std::mem::size_of::<libc::cpu_set_t>(), &set) != 0 {
+                return Err(std::io::Error::last_os_error());
+            }
+        }
+    }
+    // On Linux, the nice value is a per-thread attribute.
+    if pool.nice != 0 && unsafe { libc::setpriority(libc::PRIO_PROCESS, 0, pool.nice) } != 0 {
+        return Err(std::io::Error::last_os_error());
+    }
+    Ok(())
+}
+
+#[cfg(not(target_os = "linux"))]
+fn set_thread_scheduling(_pool: &zc_runtime_pool_options_t) -> std::io::Result<()> {
+    Err(std::io::ErrorKind::Unsupported.into())
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Configures the thread pools of the zenoh runtime, which are shared by all sessions of the process.
+///
+/// This function must be called before opening the first session, and at most once.
+///
+/// The thread counts are passed to the runtime through the `ZENOH_RUNTIME` environment variable, which takes precedence
+/// over them if it is already set. The pools with a CPU affinity or a nice value are started immediately, from a thread
+/// with these settings which their threads inherit. Threads started later to run blocking operations inherit the
+/// settings of the thread starting them, which is most often a thread of the same pool.
+///
+/// @param options: The settings of the pools.
+/// @return 0 in case of success, `Z_EUNAVAILABLE` if the runtime is already configured or in use, or if the CPU affinity
+/// or nice value are not supported on this platform, `Z_EINVAL` if they could not be applied.
+#[no_mangle]
+pub extern "C" fn zc_init_runtime(options: &zc_runtime_options_t) -> result::z_result_t {
+    if RUNTIME_STARTED.swap(true, Ordering::Relaxed) {
+        tracing::error!("The zenoh runtime is already configured or in use");
+        return result::Z_EUNAVAILABLE;
+    }
+    if let Some(param) = options.runtime_param() {
+        if std::env::var_os(ZENOH_RUNTIME_ENV).is_some() {
+            tracing::warn!(
+                "{} is set, ignoring the thread counts of zc_init_runtime()",
+                ZENOH_RUNTIME_ENV
+            );
+        } else {
+            std::env::set_var(ZENOH_RUNTIME_ENV, param);
+        }
+    }
+    for (name, runtime, pool) in options.pools() {
+        if pool.cpu_affinity_mask == 0 && pool.nice == 0 {
+            continue;
+        }
+        let pool = *pool;
+        let started = std::thread::spawn(move || -> std::io::Result<()> {
+            set_thread_scheduling(&pool)?;
+            // Builds the pool, whose worker threads are spawned from this thread.
+            let _handle: &Handle = &runtime;
+            Ok(())
+        })
+        .join();
+        match started {
+            Ok(Ok(())) => {}
+            Ok(Err(e)) if e.kind() == std::io::ErrorKind::Unsupported => {
+                tracing::error!("Thread scheduling settings are not supported on this platform");
+                return result::Z_EUNAVAILABLE;
+            }
+            Ok(Err(e)) => {
+                tracing::error!("Failed to apply the settings of the {} pool: {}", name, e);
+                return result::Z_EINVAL;
+            }
+            Err(_) => {
+                tracing::error!("Failed to start the {} pool", name);
+                return result::Z_EGENERIC;
+            }
+        }
+    }
+    result::Z_OK
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Starts the thread pools of the zenoh runtime ahead of the first session.
+///
+/// The pools are otherwise started by the first call to `z_open()`, which then includes their startup. They are shared by
+/// all sessions of the process and kept once a session is closed, so a process opening a session per request only pays
+/// for them once, e.g. when calling this function during its initialization.
+///
+/// `zc_init_runtime()` must be called before this function to configure the pools.
+#[no_mangle]
+pub extern "C" fn zc_runtime_warm_up() {
+    runtime_started();
+    for runtime in [
+        ZRuntime::Application,
+        ZRuntime::Acceptor,
+        ZRuntime::TX,
+        ZRuntime::RX,
+        ZRuntime::Net,
+    ] {
+        // Builds the pool, spawning its worker threads.
+        let _handle: &Handle = &runtime;
+    }
+}
@@ -11,9 +11,20 @@
 // Contributors:
 //   ZettaScale Zenoh team, <zenoh@zettascale.tech>
 //
-use std::mem::MaybeUninit;
+#[cfg(feature = "unstable")]
+use std::{
+    ffi::CStr,
+    sync::{Arc, Mutex},
+};
+use std::{
+    mem::MaybeUninit,
+    sync::atomic::{AtomicUsize, Ordering},
+    time::{Duration, Instant},
+};
 
 use async_std::task;
+#[cfg(feature = "unstable")]
+use libc::c_char;
 use zenoh::{
     config::{WhatAmI, WhatAmIMatcher},
     scouting::Hello,
@@ -26,6 +37,8 @@ use crate::{
     z_closure_hello_call, z_closure_hello_loan, z_id_t, z_moved_closure_hello_t, z_moved_config_t,
     z_owned_string_array_t, z_view_string_t, CString, CStringView, ZVector,
 };
+#[cfg(feature = "unstable")]
+use crate::{z_loaned_config_t, zc_loaned_string_arena_t};
 decl_c_type!(
     owned(z_owned_hello_t, option Hello ),
     loaned(z_loaned_hello_t),
@@ -100,6 +113,29 @@ pub extern "C" fn z_hello_locators(
     locators_out.as_rust_type_mut_uninit().write(locators);
 }
 
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Appends copies of the locators of Zenoh entity that sent hello message to a string arena.
+///
+/// Unlike `z_hello_locators()`, no memory is allocated per locator, and the same arena can collect the locators of
+/// all hello messages received while scouting.
+///
+/// @return the new length of the arena.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+pub extern "C" fn zc_hello_locators_push(
+    this: &z_loaned_hello_t,
+    locators: &mut zc_loaned_string_arena_t,
+) -> usize {
+    let this = this.as_rust_type_ref();
+    let locators = locators.as_rust_type_mut();
+    let bytes = this.locators().iter().map(|l| l.as_str().len()).sum();
+    locators.reserve(this.locators().len(), bytes);
+    for l in this.locators().iter() {
+        locators.push(l.as_str().as_bytes());
+    }
+    locators.len()
+}
+
 /// Options to pass to `z_scout()`.
 #[derive(Clone)]
 #[repr(C)]
@@ -108,6 +144,24 @@ pub struct z_scout_options_t {
     pub timeout_ms: u64,
     /// Type of entities to scout for.
     pub what: z_what_t,
+    /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+    ///
+    /// The number of hello messages after which scouting stops before `timeout_ms`, 0 to scout for `timeout_ms`.
+    /// The callback is called at most `max_hellos` times.
+    #[cfg(feature = "unstable")]
+    pub max_hellos: usize,
+    /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+    ///
+    /// The duration in ms after the first hello message after which scouting stops before `timeout_ms`, 0 to scout
+    /// for `timeout_ms`.
+    #[cfg(feature = "unstable")]
+    pub grace_ms: u64,
+    /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+    ///
+    /// The path of a file where the locators of the routers found by scouting are saved, one per line, NULL to not save
+    /// them. The file is only replaced if a router was found. See `zc_config_insert_cached_locators()`.
+    #[cfg(feature = "unstable")]
+    pub locator_cache_path: *const c_char,
 }
 
 impl Default for z_scout_options_t {
@@ -115,6 +169,12 @@ impl Default for z_scout_options_t {
         z_scout_options_t {
             timeout_ms: DEFAULT_SCOUTING_TIMEOUT,
             what: DEFAULT_SCOUTING_WHAT,
+            #[cfg(feature = "unstable")]
+            max_hellos: 0,
+            #[cfg(feature = "unstable")]
+            grace_ms: 0,
+            #[cfg(feature = "unstable")]
+            locator_cache_path: std::ptr::null(),
         }
     }
 }
@@ -152,6 +212,9 @@ pub extern "C" fn z_scout_options_default(this_: &mut MaybeUninit<z_scout_option
 
 /// Scout for routers and/or peers.
 ///
+/// Scouting lasts for `options.timeout_ms`, unless it stops earlier after `options.max_hellos` hello messages or
+/// `options.grace_ms` after the first one.
+///
 /// @param config: A set of properties to configure scouting session.
 /// @param callback: A closure that will be called on each hello message received from discoverd Zenoh entities.
 /// @param options: A set of scouting options
@@ -174,23 +237,177 @@ pub extern "C" fn z_scout(
         tracing::error!("Config not provided");
         return result::Z_EINVAL;
     };
+    #[cfg(feature = "unstable")]
+    let (max_hellos, grace_ms) = (options.max_hellos, options.grace_ms);
+    #[cfg(not(feature = "unstable"))]
+    let (max_hellos, grace_ms) = (0, 0);
+    #[cfg(feature = "unstable")]
+    let cache_path = match unsafe { locator_cache_path(&options) } {
+        Ok(path) => path,
+        Err(e) => return e,
+    };
+    #[cfg(feature = "unstable")]
+    let routers = Arc::new(Mutex::new(Vec::<String>::new()));
+    #[cfg(feature = "unstable")]
+    let seen = routers.clone();
 
-    task::block_on(async move {
-        let scout = zenoh::scout(what, config)
+    // The hellos are counted on the calling thread, which stops scouting once enough of them were received.
+    let (tx, rx) = flume::unbounded::<()>();
+    let delivered = AtomicUsize::new(0);
+    let scout = task::block_on(async move {
+        zenoh::scout(what, config)
             .callback(move |h| {
+                // Hellos received after the last expected one, until the scout is dropped, are not delivered.
+                if max_hellos != 0 && delivered.fetch_add(1, Ordering::Relaxed) >= max_hellos {
+                    return;
+                }
+                #[cfg(feature = "unstable")]
+                if h.whatami() == WhatAmI::Router {
+                    let mut seen = seen.lock().unwrap_or_else(|e| e.into_inner());
+                    for l in h.locators() {
+                        let l = l.to_string();
+                        if !seen.contains(&l) {
+                            seen.push(l);
+                        }
+                    }
+                }
                 let mut owned_h = Some(h);
                 z_closure_hello_call(z_closure_hello_loan(&callback), unsafe {
                     owned_h.as_mut().unwrap_unchecked().as_loaned_c_type_mut()
-                })
+                });
+                let _ = tx.send(());
             })
             .await
-            .unwrap();
-        async_std::task::sleep(std::time::Duration::from_millis(timeout)).await;
-        std::mem::drop(scout);
+            .unwrap()
     });
+    let mut deadline = Instant::now() + Duration::from_millis(timeout);
+    let mut hellos = 0;
+    while rx.recv_deadline(deadline).is_ok() {
+        hellos += 1;
+        if max_hellos != 0 && hellos >= max_hellos {
+            break;
+        }
+        if hellos == 1 && grace_ms != 0 {
+            deadline = deadline.min(Instant::now() + Duration::from_millis(grace_ms));
+        }
+    }
+    std::mem::drop(scout);
+    #[cfg(feature = "unstable")]
+    if let Some(path) = cache_path {
+        let routers = routers.lock().unwrap_or_else(|e| e.into_inner());
+        if !routers.is_empty() {
+            if let Err(e) = save_locators(path, &routers) {
+                tracing::warn!(
+                    "Failed to save the locators of the routers to {}: {}",
+                    path,
+                    e
+                );
+            }
+        }
+    }
     Z_OK
 }
 
+#[cfg(feature = "unstable")]
+unsafe fn locator_cache_path(
+    options: &z_scout_options_t,
+) -> Result<Option<&str>, result::z_result_t> {
+    if options.locator_cache_path.is_null() {
+        return Ok(None);
+    }
+    match CStr::from_ptr(options.locator_cache_path).to_str() {
+        Ok(path) => Ok(Some(path)),
+        Err(e) => {
+            tracing::error!("Locator cache path is not a valid utf-8 string: {}", e);
+            Err(result::Z_EINVAL)
+        }
+    }
+}
+
+/// Replaces the content of the cache, through a temporary file so that it is never read partially written.
+#[cfg(feature = "unstable")]
+fn save_locators(path: &str, locators: &[String]) -> std::io::Result<()> {
+    let tmp = format!("{path}.tmp");
+    let mut content = locators.join("\n");
+    content.push('\n');
+    std::fs::write(&tmp, content)?;
+    std::fs::rename(&tmp, path)
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Adds the locators of the routers saved by `z_scout()` in `z_scout_options_t::locator_cache_path` to the
+/// endpoints the session connects to.
+///
+/// This allows a session to connect immediately to the last known routers, instead of waiting for scouting to find
+/// them. The cached locators are placed before the endpoints already configured.
+///
+/// @param this_: The configuration, whose `connect/endpoints` must be a list.
+/// @param path: The path of the cache.
+/// @return 0 in case of success, `Z_EUNAVAILABLE` if there is no cache or it is empty, negative error code otherwise.
+#[cfg(feature = "unstable")]
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn zc_config_insert_cached_locators(
+    this_: &mut z_loaned_config_t,
+    path: *const c_char,
+) -> result::z_result_t {
+    if path.is_null() {
+        return result::Z_EINVAL;
+    }
+    let path = match CStr::from_ptr(path).to_str() {
+        Ok(path) => path,
+        Err(e) => {
+            tracing::error!("Locator cache path is not a valid utf-8 string: {}", e);
+            return result::Z_EINVAL;
+        }
+    };
+    let content = match std::fs::read_to_string(path) {
+        Ok(content) => content,
+        Err(e) => {
+            tracing::debug!("No locator cache at {}: {}", path, e);
+            return result::Z_EUNAVAILABLE;
+        }
+    };
+    let mut endpoints: Vec<String> = content
+        .lines()
+        .map(str::trim)
+        .filter(|l| !l.is_empty())
+        .map(String::from)
+        .collect();
+    if endpoints.is_empty() {
+        return result::Z_EUNAVAILABLE;
+    }
+    let config = this_.as_rust_type_mut();
+    if let Ok(configured) = config.get_json("connect/endpoints") {
+        match json5::from_str::<Vec<String>>(&configured) {
+            Ok(configured) => {
+                endpoints.extend(configured.into_iter().filter(|e| !endpoints.contains(e)));
+            }
+            Err(e) => {
+                tracing::error!("Can not add cached locators to connect/endpoints: {}", e);
+                return result::Z_EINVAL;
+            }
+        }
+    }
+    let value = match json5::to_string(&endpoints) {
+        Ok(value) => value,
+        Err(e) => {
+            tracing::error!("Failed to serialize the cached locators: {}", e);
+            return result::Z_EGENERIC;
+        }
+    };
+    match config.insert_json5("connect/endpoints", &value) {
+        Ok(_) => result::Z_OK,
+        Err(e) => {
+            tracing::error!(
+                "Failed to insert the cached locators into the config: {}",
+                e
+            );
+            result::Z_EINVAL
+        }
+    }
+}
+
 /// Constructs a non-owned non-null-terminated string from the kind of zenoh entity.
 ///
 /// The string has static storage (i.e. valid until the end of the program).
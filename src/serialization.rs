@@ -13,7 +13,11 @@
 //
 
 use core::str;
-use std::{mem::MaybeUninit, slice::from_raw_parts};
+use std::{
+    ffi::c_void,
+    mem::{ManuallyDrop, MaybeUninit},
+    slice::{from_raw_parts, from_raw_parts_mut},
+};
 
 use libc::strlen;
 use zenoh::bytes::ZBytes;
@@ -30,6 +34,8 @@ use crate::{
     z_loaned_bytes_t, z_loaned_slice_t, z_loaned_string_t, z_owned_bytes_t, z_owned_slice_t,
     z_owned_string_t, CSliceOwned, CStringOwned,
 };
+#[cfg(feature = "unstable")]
+use crate::{z_view_slice_t, z_view_string_t, CSliceView, CStringView};
 
 decl_c_type! {
     owned(ze_owned_serializer_t, option ZSerializer),
@@ -448,6 +454,104 @@ pub unsafe extern "C" fn ze_deserialize_string(
     }
 }
 
+/// Locates the bytes of a slice serialized as the only element of `payload`, without copying them.
+#[cfg(feature = "unstable")]
+fn ze_deserialize_contiguous(payload: &'static ZBytes) -> Result<&'static [u8], z_result_t> {
+    let len = match ZDeserializer::new(payload).deserialize::<VarInt<usize>>() {
+        Ok(l) => l.0,
+        Err(e) => {
+            tracing::error!("Failed to deserialize the payload: {}", e);
+            return Err(result::Z_EDESERIALIZE);
+        }
+    };
+    // The length prefix is LEB128-encoded.
+    let mut header = 1;
+    while len.checked_shr(7 * header as u32).unwrap_or(0) != 0 {
+        header += 1;
+    }
+    if header + len != payload.len() {
+        tracing::error!("Failed to deserialize the payload: unexpected length");
+        return Err(result::Z_EDESERIALIZE);
+    }
+    if len == 0 {
+        return Ok(&[]);
+    }
+    let mut start = header;
+    for s in payload.slices() {
+        if start < s.len() {
+            return if start + len <= s.len() {
+                Ok(&s[start..start + len])
+            } else {
+                Err(result::Z_EUNAVAILABLE)
+            };
+        }
+        start -= s.len();
+    }
+    Err(result::Z_EDESERIALIZE)
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Deserializes into a slice view, without copy.
+///
+/// The view borrows the memory of `this_`, so it is only valid as long as `this_` is not modified or dropped.
+/// This is only possible if the serialized slice is not fragmented, otherwise the function fails with `Z_EUNAVAILABLE`,
+/// and `ze_deserialize_slice()` should be used to obtain a copy instead.
+/// @param this_: Data to deserialize.
+/// @param view: An uninitialized memory location where the view is to be constructed.
+/// @return 0 in case of success, negative error code otherwise.
+#[no_mangle]
+pub extern "C" fn ze_deserialize_slice_view(
+    this: &'static z_loaned_bytes_t,
+    view: &mut MaybeUninit<z_view_slice_t>,
+) -> z_result_t {
+    match ze_deserialize_contiguous(this.as_rust_type_ref()) {
+        Ok(s) => {
+            view.as_rust_type_mut_uninit()
+                .write(CSliceView::from_slice(s));
+            result::Z_OK
+        }
+        Err(e) => {
+            view.as_rust_type_mut_uninit().write(CSliceView::default());
+            e
+        }
+    }
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Deserializes into a UTF-8 string view, without copy.
+///
+/// The view borrows the memory of `this_`, so it is only valid as long as `this_` is not modified or dropped.
+/// This is only possible if the serialized string is not fragmented, otherwise the function fails with `Z_EUNAVAILABLE`,
+/// and `ze_deserialize_string()` should be used to obtain a copy instead.
+/// @param this_: Data to deserialize.
+/// @param view: An uninitialized memory location where the view is to be constructed.
+/// @return 0 in case of success, negative error code otherwise.
+#[no_mangle]
+pub extern "C" fn ze_deserialize_string_view(
+    this: &'static z_loaned_bytes_t,
+    view: &mut MaybeUninit<z_view_string_t>,
+) -> z_result_t {
+    let res = ze_deserialize_contiguous(this.as_rust_type_ref()).and_then(|s| {
+        str::from_utf8(s).map_err(|e| {
+            tracing::error!("{}", e);
+            result::Z_EUTF8
+        })
+    });
+    match res {
+        Ok(s) => {
+            view.as_rust_type_mut_uninit()
+                .write(CStringView::new_borrowed_from_slice(s.as_bytes()));
+            result::Z_OK
+        }
+        Err(e) => {
+            view.as_rust_type_mut_uninit().write(CStringView::default());
+            e
+        }
+    }
+}
+
 /// @brief Gets deserializer for`this_`.
 #[no_mangle]
 extern "C" fn ze_deserializer_from_bytes(this: &'static z_loaned_bytes_t) -> ze_deserializer_t {
@@ -861,3 +965,650 @@ pub extern "C" fn ze_deserializer_deserialize_sequence_length(
         }
     }
 }
+
+fn ze_serializer_serialize_array<T>(
+    this: &mut ze_loaned_serializer_t,
+    data: *const T,
+    n: usize,
+) -> z_result_t
+where
+    T: Serialize,
+{
+    if data.is_null() && n > 0 {
+        return result::Z_EINVAL;
+    }
+    // Slices of numbers are serialized by zenoh-ext as a length followed by a single bulk write
+    // of the elements on little-endian hosts.
+    let slice: &[T] = if n == 0 {
+        &[]
+    } else {
+        unsafe { from_raw_parts(data, n) }
+    };
+    this.as_rust_type_mut().serialize(slice);
+    result::Z_OK
+}
+
+fn ze_deserializer_deserialize_array<T>(
+    this: &mut ze_deserializer_t,
+    dst: *mut T,
+    cap: usize,
+    n: &mut usize,
+) -> z_result_t
+where
+    T: Deserialize + Copy,
+{
+    let deserializer = this.as_rust_type_mut();
+    // The deserializer is a cursor over borrowed bytes without drop glue, so its position can be restored
+    // from a bitwise copy if the sequence does not fit, letting the caller retry with a larger buffer.
+    let start = ManuallyDrop::new(unsafe { std::ptr::read(deserializer) });
+    let len = match deserializer.deserialize::<VarInt<usize>>() {
+        Ok(len) => len.0,
+        Err(e) => {
+            tracing::error!("Failed to read the sequence length: {}", e);
+            *n = 0;
+            return result::Z_EDESERIALIZE;
+        }
+    };
+    *n = len;
+    if len > cap {
+        tracing::error!(
+            "Failed to deserialize the payload: sequence of {} elements exceeds the capacity of {}",
+            len,
+            cap
+        );
+        unsafe { std::ptr::write(deserializer, ManuallyDrop::into_inner(start)) };
+        return result::Z_EDESERIALIZE;
+    }
+    if len == 0 {
+        return result::Z_OK;
+    }
+    if dst.is_null() {
+        *n = 0;
+        return result::Z_EINVAL;
+    }
+    // Numbers are read from the payload in a single bulk operation, straight into `dst`.
+    let dst = unsafe { from_raw_parts_mut(dst as *mut MaybeUninit<T>, len) };
+    match T::deserialize_n_uninit(dst, deserializer) {
+        Ok(_) => result::Z_OK,
+        Err(e) => {
+            tracing::error!("Failed to deserialize the payload: {}", e);
+            *n = 0;
+            result::Z_EDESERIALIZE
+        }
+    }
+}
+
+/// @brief Serializes an array of unsigned integers as a sequence.
+///
+/// The result is the same as calling `ze_serializer_serialize_sequence_length()` followed by `ze_serializer_serialize_uint8()`
+/// for each element, but elements are written in a single bulk operation.
+/// @param this_: A serializer instance.
+/// @param data: A pointer to the first element of the array.
+/// @param n: Number of elements in the array.
+/// @return 0 in case of success, negative error code otherwise.
+#[no_mangle]
+pub extern "C" fn ze_serializer_serialize_array_uint8(
+    this_: &mut ze_loaned_serializer_t,
+    data: *const u8,
+    n: usize,
+) -> z_result_t {
+    ze_serializer_serialize_array::<u8>(this_, data, n)
+}
+
+/// @brief Serializes an array of unsigned integers as a sequence.
+///
+/// The result is the same as calling `ze_serializer_serialize_sequence_length()` followed by `ze_serializer_serialize_uint16()`
+/// for each element, but elements are written in a single bulk operation.
+/// @param this_: A serializer instance.
+/// @param data: A pointer to the first element of the array.
+/// @param n: Number of elements in the array.
+/// @return 0 in case of success, negative error code otherwise.
+#[no_mangle]
+pub extern "C" fn ze_serializer_serialize_array_uint16(
+    this_: &mut ze_loaned_serializer_t,
+    data: *const u16,
+    n: usize,
+) -> z_result_t {
+    ze_serializer_serialize_array::<u16>(this_, data, n)
+}
+
+/// @brief Serializes an array of unsigned integers as a sequence.
+///
+/// The result is the same as calling `ze_serializer_serialize_sequence_length()` followed by `ze_serializer_serialize_uint32()`
+/// for each element, but elements are written in a single bulk operation.
+/// @param this_: A serializer instance.
+/// @param data: A pointer to the first element of the array.
+/// @param n: Number of elements in the array.
+/// @return 0 in case of success, negative error code otherwise.
+#[no_mangle]
+pub extern "C" fn ze_serializer_serialize_array_uint32(
+    this_: &mut ze_loaned_serializer_t,
+    data: *const u32,
+    n: usize,
+) -> z_result_t {
+    ze_serializer_serialize_array::<u32>(this_, data, n)
+}
+
+/// @brief Serializes an array of unsigned integers as a sequence.
+///
+/// The result is the same as calling `ze_serializer_serialize_sequence_length()` followed by `ze_serializer_serialize_uint64()`
+/// for each element, but elements are written in a single bulk operation.
+/// @param this_: A serializer instance.
+/// @param data: A pointer to the first element of the array.
+/// @param n: Number of elements in the array.
+/// @return 0 in case of success, negative error code otherwise.
+#[no_mangle]
+pub extern "C" fn ze_serializer_serialize_array_uint64(
+    this_: &mut ze_loaned_serializer_t,
+    data: *const u64,
+    n: usize,
+) -> z_result_t {
+    ze_serializer_serialize_array::<u64>(this_, data, n)
+}
+
+/// @brief Serializes an array of signed integers as a sequence.
+///
+/// The result is the same as calling `ze_serializer_serialize_sequence_length()` followed by `ze_serializer_serialize_int8()`
+/// for each element, but elements are written in a single bulk operation.
+/// @param this_: A serializer instance.
+/// @param data: A pointer to the first element of the array.
+/// @param n: Number of elements in the array.
+/// @return 0 in case of success, negative error code otherwise.
+#[no_mangle]
+pub extern "C" fn ze_serializer_serialize_array_int8(
+    this_: &mut ze_loaned_serializer_t,
+    data: *const i8,
+    n: usize,
+) -> z_result_t {
+    ze_serializer_serialize_array::<i8>(this_, data, n)
+}
+
+/// @brief Serializes an array of signed integers as a sequence.
+///
+/// The result is the same as calling `ze_serializer_serialize_sequence_length()` followed by `ze_serializer_serialize_int16()`
+/// for each element, but elements are written in a single bulk operation.
+/// @param this_: A serializer instance.
+/// @param data: A pointer to the first element of the array.
+/// @param n: Number of elements in the array.
+/// @return 0 in case of success, negative error code otherwise.
+#[no_mangle]
+pub extern "C" fn ze_serializer_serialize_array_int16(
+    this_: &mut ze_loaned_serializer_t,
+    data: *const i16,
+    n: usize,
+) -> z_result_t {
+    ze_serializer_serialize_array::<i16>(this_, data, n)
+}
+
+/// @brief Serializes an array of signed integers as a sequence.
+///
+/// The result is the same as calling `ze_serializer_serialize_sequence_length()` followed by `ze_serializer_serialize_int32()`
+/// for each element, but elements are written in a single bulk operation.
+/// @param this_: A serializer instance.
+/// @param data: A pointer to the first element of the array.
+/// @param n: Number of elements in the array.
+/// @return 0 in case of success, negative error code otherwise.
+#[no_mangle]
+pub extern "C" fn ze_serializer_serialize_array_int32(
+    this_: &mut ze_loaned_serializer_t,
+    data: *const i32,
+    n: usize,
+) -> z_result_t {
+    ze_serializer_serialize_array::<i32>(this_, data, n)
+}
+
+/// @brief Serializes an array of signed integers as a sequence.
+///
+/// The result is the same as calling `ze_serializer_serialize_sequence_length()` followed by `ze_serializer_serialize_int64()`
+/// for each element, but elements are written in a single bulk operation.
+/// @param this_: A serializer instance.
+/// @param data: A pointer to the first element of the array.
+/// @param n: Number of elements in the array.
+/// @return 0 in case of success, negative error code otherwise.
+#[no_mangle]
+pub extern "C" fn ze_serializer_serialize_array_int64(
+    this_: &mut ze_loaned_serializer_t,
+    data: *const i64,
+    n: usize,
+) -> z_result_t {
+    ze_serializer_serialize_array::<i64>(this_, data, n)
+}
+
+/// @brief Serializes an array of floats as a sequence.
+///
+/// The result is the same as calling `ze_serializer_serialize_sequence_length()` followed by `ze_serializer_serialize_float()`
+/// for each element, but elements are written in a single bulk operation.
+/// @param this_: A serializer instance.
+/// @param data: A pointer to the first element of the array.
+/// @param n: Number of elements in the array.
+/// @return 0 in case of success, negative error code otherwise.
+#[no_mangle]
+pub extern "C" fn ze_serializer_serialize_array_float(
+    this_: &mut ze_loaned_serializer_t,
+    data: *const f32,
+    n: usize,
+) -> z_result_t {
+    ze_serializer_serialize_array::<f32>(this_, data, n)
+}
+
+/// @brief Serializes an array of doubles as a sequence.
+///
+/// The result is the same as calling `ze_serializer_serialize_sequence_length()` followed by `ze_serializer_serialize_double()`
+/// for each element, but elements are written in a single bulk operation.
+/// @param this_: A serializer instance.
+/// @param data: A pointer to the first element of the array.
+/// @param n: Number of elements in the array.
+/// @return 0 in case of success, negative error code otherwise.
+#[no_mangle]
+pub extern "C" fn ze_serializer_serialize_array_double(
+    this_: &mut ze_loaned_serializer_t,
+    data: *const f64,
+    n: usize,
+) -> z_result_t {
+    ze_serializer_serialize_array::<f64>(this_, data, n)
+}
+
+/// @brief Deserializes a sequence of unsigned integers into an array.
+///
+/// Reads a sequence previously written by `ze_serializer_serialize_array_uint8()`, or by `ze_serializer_serialize_sequence_length()`
+/// followed by `ze_serializer_serialize_uint8()` for each element.
+/// @param this_: A deserializer instance.
+/// @param dst: A pointer to an array of `cap` elements, where the deserialized elements will be written.
+/// @param cap: Number of elements of `dst`.
+/// @param n: A memory location where the number of elements in the sequence will be written.
+/// @return 0 in case of success, negative error code otherwise (in particular if the sequence contains more than `cap` elements).
+#[no_mangle]
+pub extern "C" fn ze_deserializer_deserialize_array_uint8(
+    this_: &mut ze_deserializer_t,
+    dst: *mut u8,
+    cap: usize,
+    n: &mut usize,
+) -> z_result_t {
+    ze_deserializer_deserialize_array::<u8>(this_, dst, cap, n)
+}
+
+/// @brief Deserializes a sequence of unsigned integers into an array.
+///
+/// Reads a sequence previously written by `ze_serializer_serialize_array_uint16()`, or by `ze_serializer_serialize_sequence_length()`
+/// followed by `ze_serializer_serialize_uint16()` for each element.
+/// @param this_: A deserializer instance.
+/// @param dst: A pointer to an array of `cap` elements, where the deserialized elements will be written.
+/// @param cap: Number of elements of `dst`.
+/// @param n: A memory location where the number of elements in the sequence will be written.
+/// @return 0 in case of success, negative error code otherwise (in particular if the sequence contains more than `cap` elements).
+#[no_mangle]
+pub extern "C" fn ze_deserializer_deserialize_array_uint16(
+    this_: &mut ze_deserializer_t,
+    dst: *mut u16,
+    cap: usize,
+    n: &mut usize,
+) -> z_result_t {
+    ze_deserializer_deserialize_array::<u16>(this_, dst, cap, n)
+}
+
+/// @brief Deserializes a sequence of unsigned integers into an array.
+///
+/// Reads a sequence previously written by `ze_serializer_serialize_array_uint32()`, or by `ze_serializer_serialize_sequence_length()`
+/// followed by `ze_serializer_serialize_uint32()` for each element.
+/// @param this_: A deserializer instance.
+/// @param dst: A pointer to an array of `cap` elements, where the deserialized elements will be written.
+/// @param cap: Number of elements of `dst`.
+/// @param n: A memory location where the number of elements in the sequence will be written.
+/// @return 0 in case of success, negative error code otherwise (in particular if the sequence contains more than `cap` elements).
+#[no_mangle]
+pub extern "C" fn ze_deserializer_deserialize_array_uint32(
+    this_: &mut ze_deserializer_t,
+    dst: *mut u32,
+    cap: usize,
+    n: &mut usize,
+) -> z_result_t {
+    ze_deserializer_deserialize_array::<u32>(this_, dst, cap, n)
+}
+
+/// @brief Deserializes a sequence of unsigned integers into an array.
+///
+/// Reads a sequence previously written by `ze_serializer_serialize_array_uint64()`, or by `ze_serializer_serialize_sequence_length()`
+/// followed by `ze_serializer_serialize_uint64()` for each element.
+/// @param this_: A deserializer instance.
+/// @param dst: A pointer to an array of `cap` elements, where the deserialized elements will be written.
+/// @param cap: Number of elements of `dst`.
+/// @param n: A memory location where the number of elements in the sequence will be written.
+/// @return 0 in case of success, negative error code otherwise (in particular if the sequence contains more than `cap` elements).
+#[no_mangle]
+pub extern "C" fn ze_deserializer_deserialize_array_uint64(
+    this_: &mut ze_deserializer_t,
+    dst: *mut u64,
+    cap: usize,
+    n: &mut usize,
+) -> z_result_t {
+    ze_deserializer_deserialize_array::<u64>(this_, dst, cap, n)
+}
+
+/// @brief Deserializes a sequence of signed integers into an array.
+///
+/// Reads a sequence previously written by `ze_serializer_serialize_array_int8()`, or by `ze_serializer_serialize_sequence_length()`
+/// followed by `ze_serializer_serialize_int8()` for each element.
+/// @param this_: A deserializer instance.
+/// @param dst: A pointer to an array of `cap` elements, where the deserialized elements will be written.
+/// @param cap: Number of elements of `dst`.
+/// @param n: A memory location where the number of elements in the sequence will be written.
+/// @return 0 in case of success, negative error code otherwise (in particular if the sequence contains more than `cap` elements).
+#[no_mangle]
+pub extern "C" fn ze_deserializer_deserialize_array_int8(
+    this_: &mut ze_deserializer_t,
+    dst: *mut i8,
+    cap: usize,
+    n: &mut usize,
+) -> z_result_t {
+    ze_deserializer_deserialize_array::<i8>(this_, dst, cap, n)
+}
+
+/// @brief Deserializes a sequence of signed integers into an array.
+///
+/// Reads a sequence previously written by `ze_serializer_serialize_array_int16()`, or by `ze_serializer_serialize_sequence_length()`
+/// followed by `ze_serializer_serialize_int16()` for each element.
+/// @param this_: A deserializer instance.
+/// @param dst: A pointer to an array of `cap` elements, where the deserialized elements will be written.
+/// @param cap: Number of elements of `dst`.
+/// @param n: A memory location where the number of elements in the sequence will be written.
+/// @return 0 in case of success, negative error code otherwise (in particular if the sequence contains more than `cap` elements).
+#[no_mangle]
+pub extern "C" fn ze_deserializer_deserialize_array_int16(
+    this_: &mut ze_deserializer_t,
+    dst: *mut i16,
+    cap: usize,
+    n: &mut usize,
+) -> z_result_t {
+    ze_deserializer_deserialize_array::<i16>(this_, dst, cap, n)
+}
+
+/// @brief Deserializes a sequence of signed integers into an array.
+///
+/// Reads a sequence previously written by `ze_serializer_serialize_array_int32()`, or by `ze_serializer_serialize_sequence_length()`
+/// followed by `ze_serializer_serialize_int32()` for each element.
+/// @param this_: A deserializer instance.
+/// @param dst: A pointer to an array of `cap` elements, where the deserialized elements will be written.
+/// @param cap: Number of elements of `dst`.
+/// @param n: A memory location where the number of elements in the sequence will be written.
+/// @return 0 in case of success, negative error code otherwise (in particular if the sequence contains more than `cap` elements).
+#[no_mangle]
+pub extern "C" fn ze_deserializer_deserialize_array_int32(
+    this_: &mut ze_deserializer_t,
+    dst: *mut i32,
+    cap: usize,
+    n: &mut usize,
+) -> z_result_t {
+    ze_deserializer_deserialize_array::<i32>(this_, dst, cap, n)
+}
+
+/// @brief Deserializes a sequence of signed integers into an array.
+///
+/// Reads a sequence previously written by `ze_serializer_serialize_array_int64()`, or by `ze_serializer_serialize_sequence_length()`
+/// followed by `ze_serializer_serialize_int64()` for each element.
+/// @param this_: A deserializer instance.
+/// @param dst: A pointer to an array of `cap` elements, where the deserialized elements will be written.
+/// @param cap: Number of elements of `dst`.
+/// @param n: A memory location where the number of elements in the sequence will be written.
+/// @return 0 in case of success, negative error code otherwise (in particular if the sequence contains more than `cap` elements).
+#[no_mangle]
+pub extern "C" fn ze_deserializer_deserialize_array_int64(
+    this_: &mut ze_deserializer_t,
+    dst: *mut i64,
+    cap: usize,
+    n: &mut usize,
+) -> z_result_t {
+    ze_deserializer_deserialize_array::<i64>(this_, dst, cap, n)
+}
+
+/// @brief Deserializes a sequence of floats into an array.
+///
+/// Reads a sequence previously written by `ze_serializer_serialize_array_float()`, or by `ze_serializer_serialize_sequence_length()`
+/// followed by `ze_serializer_serialize_float()` for each element.
+/// @param this_: A deserializer instance.
+/// @param dst: A pointer to an array of `cap` elements, where the deserialized elements will be written.
+/// @param cap: Number of elements of `dst`.
+/// @param n: A memory location where the number of elements in the sequence will be written.
+/// @return 0 in case of success, negative error code otherwise (in particular if the sequence contains more than `cap` elements).
+#[no_mangle]
+pub extern "C" fn ze_deserializer_deserialize_array_float(
+    this_: &mut ze_deserializer_t,
+    dst: *mut f32,
+    cap: usize,
+    n: &mut usize,
+) -> z_result_t {
+    ze_deserializer_deserialize_array::<f32>(this_, dst, cap, n)
+}
+
+/// @brief Deserializes a sequence of doubles into an array.
+///
+/// Reads a sequence previously written by `ze_serializer_serialize_array_double()`, or by `ze_serializer_serialize_sequence_length()`
+/// followed by `ze_serializer_serialize_double()` for each element.
+/// @param this_: A deserializer instance.
+/// @param dst: A pointer to an array of `cap` elements, where the deserialized elements will be written.
+/// @param cap: Number of elements of `dst`.
+/// @param n: A memory location where the number of elements in the sequence will be written.
+/// @return 0 in case of success, negative error code otherwise (in particular if the sequence contains more than `cap` elements).
+#[no_mangle]
+pub extern "C" fn ze_deserializer_deserialize_array_double(
+    this_: &mut ze_deserializer_t,
+    dst: *mut f64,
+    cap: usize,
+    n: &mut usize,
+) -> z_result_t {
+    ze_deserializer_deserialize_array::<f64>(this_, dst, cap, n)
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief The type of a field of a fixed-layout struct, see `ze_field_t`.
+#[cfg(feature = "unstable")]
+#[repr(C)]
+#[derive(Clone, Copy, PartialEq, Eq)]
+pub enum ze_field_type_t {
+    UINT8 = 0,
+    UINT16 = 1,
+    UINT32 = 2,
+    UINT64 = 3,
+    INT8 = 4,
+    INT16 = 5,
+    INT32 = 6,
+    INT64 = 7,
+    FLOAT = 8,
+    DOUBLE = 9,
+    BOOL = 10,
+    /// An array of `len` bytes, serialized as a slice.
+    BYTES = 11,
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief The description of a field of a fixed-layout struct, for `ze_serialize_struct()` and `ze_deserialize_struct()`.
+///
+/// A struct is described by a constant array of fields, typically built once with `offsetof()`:
+/// @code{.c}
+/// typedef struct { uint8_t trace_id[16]; uint64_t seq; int32_t tenant; } metadata_t;
+/// static const ze_field_t METADATA[] = {
+///     {ZE_FIELD_TYPE_BYTES, offsetof(metadata_t, trace_id), 16},
+///     {ZE_FIELD_TYPE_UINT64, offsetof(metadata_t, seq), 0},
+///     {ZE_FIELD_TYPE_INT32, offsetof(metadata_t, tenant), 0},
+/// };
+/// @endcode
+#[cfg(feature = "unstable")]
+#[repr(C)]
+#[derive(Clone, Copy)]
+pub struct ze_field_t {
+    /// The type of the field.
+    pub kind: ze_field_type_t,
+    /// The offset of the field in the struct.
+    pub offset: usize,
+    /// The number of bytes of a `ZE_FIELD_TYPE_BYTES` field, ignored for the other types.
+    pub len: usize,
+}
+
+#[cfg(feature = "unstable")]
+impl ze_field_t {
+    /// The number of bytes of the field in the struct.
+    fn size(&self) -> usize {
+        match self.kind {
+            ze_field_type_t::UINT8 | ze_field_type_t::INT8 | ze_field_type_t::BOOL => 1,
+            ze_field_type_t::UINT16 | ze_field_type_t::INT16 => 2,
+            ze_field_type_t::UINT32 | ze_field_type_t::INT32 | ze_field_type_t::FLOAT => 4,
+            ze_field_type_t::UINT64 | ze_field_type_t::INT64 | ze_field_type_t::DOUBLE => 8,
+            ze_field_type_t::BYTES => self.len,
+        }
+    }
+
+    /// The number of bytes of the field once serialized.
+    fn serialized_size(&self) -> usize {
+        match self.kind {
+            ze_field_type_t::BYTES => varint_size(self.len) + self.len,
+            _ => self.size(),
+        }
+    }
+}
+
+#[cfg(feature = "unstable")]
+fn varint_size(mut v: usize) -> usize {
+    let mut n = 1;
+    while v >= 0x80 {
+        v >>= 7;
+        n += 1;
+    }
+    n
+}
+
+#[cfg(feature = "unstable")]
+fn write_varint(out: &mut Vec<u8>, mut v: usize) {
+    while v >= 0x80 {
+        out.push((v as u8) | 0x80);
+        v >>= 7;
+    }
+    out.push(v as u8);
+}
+
+#[cfg(feature = "unstable")]
+fn read_varint(data: &[u8]) -> Option<(usize, usize)> {
+    let mut v = 0usize;
+    for (i, b) in data.iter().enumerate().take(varint_size(usize::MAX)) {
+        v |= ((b & 0x7f) as usize) << (7 * i);
+        if b & 0x80 == 0 {
+            return Some((v, i + 1));
+        }
+    }
+    None
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Serializes a struct described by an array of fields, in a single contiguous buffer.
+///
+/// The fields are serialized in the order of `fields`, in the same format as the corresponding `ze_serializer_serialize_*()`
+/// calls, so that the result can also be read with a `ze_deserializer_t`. Numbers are written in little-endian order and
+/// `ZE_FIELD_TYPE_BYTES` fields as by `ze_serializer_serialize_buf()`.
+///
+/// @param this_: An uninitialized memory location where the serialized data is to be constructed.
+/// @param src: A pointer to the struct to serialize.
+/// @param fields: A pointer to an array of `len` field descriptions.
+/// @param len: The number of fields.
+/// @return 0 in case of success, negative error code otherwise.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn ze_serialize_struct(
+    this_: &mut MaybeUninit<z_owned_bytes_t>,
+    src: *const c_void,
+    fields: *const ze_field_t,
+    len: usize,
+) -> z_result_t {
+    if src.is_null() || (fields.is_null() && len > 0) {
+        this_.as_rust_type_mut_uninit().write(ZBytes::default());
+        return result::Z_EINVAL;
+    }
+    let fields: &[ze_field_t] = if len == 0 {
+        &[]
+    } else {
+        from_raw_parts(fields, len)
+    };
+    let mut out = Vec::with_capacity(fields.iter().map(ze_field_t::serialized_size).sum());
+    for field in fields {
+        let data = from_raw_parts((src as *const u8).add(field.offset), field.size());
+        match field.kind {
+            ze_field_type_t::BOOL => out.push((data[0] != 0) as u8),
+            ze_field_type_t::BYTES => {
+                write_varint(&mut out, field.len);
+                out.extend_from_slice(data);
+            }
+            // The in-memory representation of the numbers is converted to little-endian.
+            _ if cfg!(target_endian = "little") => out.extend_from_slice(data),
+            _ => out.extend(data.iter().rev()),
+        }
+    }
+    this_.as_rust_type_mut_uninit().write(ZBytes::from(out));
+    result::Z_OK
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Deserializes a struct described by an array of fields, serialized by `ze_serialize_struct()` or by the
+/// corresponding `ze_serializer_serialize_*()` calls.
+///
+/// @param this_: Data to deserialize.
+/// @param dst: A pointer to the struct to write the fields to.
+/// @param fields: A pointer to an array of `len` field descriptions.
+/// @param len: The number of fields.
+/// @return 0 in case of success, `Z_EDESERIALIZE` if the data does not match the fields, in which case `dst` may be
+/// partially written, negative error code otherwise.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn ze_deserialize_struct(
+    this_: &z_loaned_bytes_t,
+    dst: *mut c_void,
+    fields: *const ze_field_t,
+    len: usize,
+) -> z_result_t {
+    if dst.is_null() || (fields.is_null() && len > 0) {
+        return result::Z_EINVAL;
+    }
+    let fields: &[ze_field_t] = if len == 0 {
+        &[]
+    } else {
+        from_raw_parts(fields, len)
+    };
+    // Attachments are usually received in a single slice, in which case they are not copied.
+    let payload = this_.as_rust_type_ref().to_bytes();
+    let mut data: &[u8] = &payload;
+    for field in fields {
+        let size = field.size();
+        if field.kind == ze_field_type_t::BYTES {
+            match read_varint(data) {
+                Some((n, header)) if n == size => data = &data[header..],
+                _ => {
+                    tracing::error!("Failed to deserialize the payload: unexpected length");
+                    return result::Z_EDESERIALIZE;
+                }
+            }
+        }
+        if data.len() < size {
+            tracing::error!("Failed to deserialize the payload: unexpected end of data");
+            return result::Z_EDESERIALIZE;
+        }
+        let (value, rest) = data.split_at(size);
+        let out = std::slice::from_raw_parts_mut((dst as *mut u8).add(field.offset), size);
+        match field.kind {
+            ze_field_type_t::BOOL if value[0] > 1 => {
+                tracing::error!("Failed to deserialize the payload: invalid bool");
+                return result::Z_EDESERIALIZE;
+            }
+            ze_field_type_t::BOOL | ze_field_type_t::BYTES => out.copy_from_slice(value),
+            _ if cfg!(target_endian = "little") => out.copy_from_slice(value),
+            _ => {
+                for (o, v) in out.iter_mut().zip(value.iter().rev()) {
+                    *o = *v;
+                }
+            }
+        }
+        data = rest;
+    }
+    if !data.is_empty() {
+        tracing::error!("Failed to deserialize the payload: unexpected trailing data");
+        return result::Z_EDESERIALIZE;
+    }
+    result::Z_OK
+}
@@ -18,14 +18,14 @@ use zenoh::{Session, Wait};
 
 #[cfg(all(feature = "shared-memory", feature = "unstable"))]
 use crate::z_loaned_shm_client_storage_t;
-#[cfg(feature = "unstable")]
-use crate::zc_owned_concurrent_close_handle_t;
 use crate::{
     opaque_types::{z_loaned_session_t, z_owned_session_t},
     result,
     transmute::{LoanedCTypeRef, RustTypeRef, RustTypeRefUninit, TakeRustType},
     z_moved_config_t, z_moved_session_t,
 };
+#[cfg(feature = "unstable")]
+use crate::{runtime::runtime_started, zc_owned_concurrent_close_handle_t};
 decl_c_type!(
     owned(z_owned_session_t, option Session),
     loaned(z_loaned_session_t),
@@ -66,23 +66,32 @@ pub extern "C" fn z_internal_session_null(this_: &mut MaybeUninit<z_owned_sessio
 #[repr(C)]
 pub struct z_open_options_t {
     _dummy: u8,
+    #[cfg(feature = "unstable")]
+    /// If `true`, the callbacks of the subscribers and queryables declared through the session are not run by the
+    /// zenoh runtime threads, but queued until the application runs them with `zc_session_poll()`.
+    /// Queryables with worker threads are not affected.
+    pub deferred_callbacks: bool,
 }
 
 /// Constructs the default value for `z_open_options_t`.
 #[no_mangle]
 pub extern "C" fn z_open_options_default(this_: &mut MaybeUninit<z_open_options_t>) {
-    this_.write(z_open_options_t { _dummy: 0 });
+    this_.write(z_open_options_t {
+        _dummy: 0,
+        #[cfg(feature = "unstable")]
+        deferred_callbacks: false,
+    });
 }
 
 /// Constructs and opens a new Zenoh session.
 ///
 /// @return 0 in case of success, negative error code otherwise (in this case the session will be in its gravestone state).
-#[allow(clippy::missing_safety_doc)]
+#[allow(clippy::missing_safety_doc, unused_variables)]
 #[no_mangle]
 pub extern "C" fn z_open(
     this: &mut MaybeUninit<z_owned_session_t>,
     config: &mut z_moved_config_t,
-    _options: Option<&z_open_options_t>,
+    options: Option<&z_open_options_t>,
 ) -> result::z_result_t {
     let this = this.as_rust_type_mut_uninit();
     let Some(config) = config.take_rust_type().take() else {
@@ -90,8 +99,14 @@ pub extern "C" fn z_open(
         this.write(None);
         return result::Z_EINVAL;
     };
+    #[cfg(feature = "unstable")]
+    runtime_started();
     match zenoh::open(config).wait() {
         Ok(s) => {
+            #[cfg(feature = "unstable")]
+            if options.is_some_and(|o| o.deferred_callbacks) {
+                crate::deferred::defer_session_callbacks(s.zid());
+            }
             this.write(Some(s));
             result::Z_OK
         }
@@ -121,6 +136,8 @@ pub extern "C" fn z_open_with_custom_shm_clients(
         this.write(None);
         return result::Z_EINVAL;
     };
+    #[cfg(feature = "unstable")]
+    runtime_started();
     match zenoh::open(config)
         .with_shm_clients(shm_clients.as_rust_type_ref().clone())
         .wait()
@@ -185,6 +202,8 @@ pub extern "C" fn z_close(
     session: &mut z_loaned_session_t,
     #[allow(unused)] options: Option<&mut z_close_options_t>,
 ) -> result::z_result_t {
+    #[cfg(feature = "unstable")]
+    let counters = crate::entity_stats::session_counters(session.as_rust_type_ref().zid());
     #[allow(unused_mut)]
     let mut close_builder = session.as_rust_type_mut().close();
 
@@ -198,7 +217,9 @@ pub extern "C" fn z_close(
 
         if let Some(close_handle) = &mut options.internal_out_concurrent {
             let handle = close_builder.in_background().wait();
-            close_handle.as_rust_type_mut_uninit().write(Some(handle));
+            close_handle
+                .as_rust_type_mut_uninit()
+                .write(Some((handle, counters)));
             return result::Z_OK;
         }
     }
@@ -224,5 +245,11 @@ pub extern "C" fn z_session_is_closed(session: &z_loaned_session_t) -> bool {
 /// Closes and invalidates the session.
 #[no_mangle]
 pub extern "C" fn z_session_drop(this_: &mut z_moved_session_t) {
-    let _ = this_.take_rust_type();
+    let session = this_.take_rust_type();
+    #[cfg(feature = "unstable")]
+    if let Some(s) = &session {
+        crate::entity_stats::forget_session(s.zid());
+        crate::deferred::forget_session(s.zid());
+    }
+    std::mem::drop(session);
 }
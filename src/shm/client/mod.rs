@@ -12,5 +12,6 @@
 //   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
 //
 
+pub mod segment_cache;
 pub mod shm_client;
 pub mod shm_segment;
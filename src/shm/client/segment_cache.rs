@@ -0,0 +1,292 @@
+//
+// Copyright (c) 2024 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+use std::{
+    collections::HashMap,
+    mem::MaybeUninit,
+    sync::{
+        atomic::{AtomicU64, Ordering},
+        Arc, Mutex, MutexGuard,
+    },
+};
+
+use zenoh::{
+    shm::{SegmentID, ShmClient, ShmSegment},
+    Result,
+};
+
+pub use crate::opaque_types::{
+    zc_loaned_shm_client_cache_t, zc_moved_shm_client_cache_t, zc_owned_shm_client_cache_t,
+};
+use crate::{
+    result::{z_result_t, Z_EGENERIC, Z_EINVAL, Z_OK},
+    shm::common::types::z_segment_id_t,
+    transmute::{LoanedCTypeRef, RustTypeRef, RustTypeRefUninit, TakeRustType},
+    z_moved_shm_client_t, z_owned_shm_client_t,
+};
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief A snapshot of the statistics of an SHM Client cache, see `zc_shm_client_cache_get_stats()`.
+///
+/// Counters are cumulative since the creation of the cache.
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Default)]
+pub struct zc_shm_client_cache_stats_t {
+    /// Number of segments attached by zenoh which were already mapped, e.g. by `zc_shm_client_cache_prefetch()`.
+    pub hits: u64,
+    /// Number of segments attached by zenoh which had to be mapped by the client.
+    pub misses: u64,
+    /// Number of segments mapped ahead of time by `zc_shm_client_cache_prefetch()`.
+    pub prefetches: u64,
+    /// Number of segments released by the cache because it was full.
+    pub evictions: u64,
+    /// Number of segments currently held by the cache.
+    pub segments: usize,
+}
+
+#[derive(Debug)]
+struct CachedSegment {
+    segment: Arc<dyn ShmSegment>,
+    last_use: u64,
+}
+
+#[derive(Debug, Default)]
+struct SegmentCacheState {
+    segments: HashMap<SegmentID, CachedSegment>,
+    tick: u64,
+}
+
+/// The segments attached by an SHM client, released in least recently used order once there are more than
+/// `max_segments` of them.
+#[derive(Debug)]
+pub struct ShmSegmentCache {
+    client: Arc<dyn ShmClient>,
+    max_segments: usize,
+    state: Mutex<SegmentCacheState>,
+    hits: AtomicU64,
+    misses: AtomicU64,
+    prefetches: AtomicU64,
+    evictions: AtomicU64,
+}
+
+impl ShmSegmentCache {
+    fn new(client: Arc<dyn ShmClient>, max_segments: usize) -> Self {
+        Self {
+            client,
+            max_segments,
+            state: Mutex::new(SegmentCacheState::default()),
+            hits: AtomicU64::new(0),
+            misses: AtomicU64::new(0),
+            prefetches: AtomicU64::new(0),
+            evictions: AtomicU64::new(0),
+        }
+    }
+
+    fn lock(&self) -> MutexGuard<'_, SegmentCacheState> {
+        self.state.lock().unwrap_or_else(|e| e.into_inner())
+    }
+
+    fn lookup(&self, id: SegmentID) -> Option<Arc<dyn ShmSegment>> {
+        let mut state = self.lock();
+        state.tick += 1;
+        let tick = state.tick;
+        state.segments.get_mut(&id).map(|cached| {
+            cached.last_use = tick;
+            cached.segment.clone()
+        })
+    }
+
+    /// Returns the segment `id`, attaching it with the client if it is not cached, and whether it was cached.
+    fn get(&self, id: SegmentID) -> Result<(Arc<dyn ShmSegment>, bool)> {
+        if let Some(segment) = self.lookup(id) {
+            return Ok((segment, true));
+        }
+        // The segment is mapped without holding the lock, so that cached segments can be used meanwhile.
+        let segment = self.client.attach(id)?;
+        let mut state = self.lock();
+        state.tick += 1;
+        let tick = state.tick;
+        // The segment may have been attached by another thread in the meantime, in which case its mapping is kept.
+        let segment = state
+            .segments
+            .entry(id)
+            .or_insert(CachedSegment {
+                segment,
+                last_use: tick,
+            })
+            .segment
+            .clone();
+        if self.max_segments != 0 && state.segments.len() > self.max_segments {
+            let lru = state
+                .segments
+                .iter()
+                .filter(|(other, _)| **other != id)
+                .min_by_key(|(_, cached)| cached.last_use)
+                .map(|(other, _)| *other);
+            if let Some(lru) = lru {
+                let evicted = state.segments.remove(&lru);
+                drop(state);
+                // The segment is unmapped by the client outside of the lock, unless a buffer still refers to it.
+                drop(evicted);
+                self.evictions.fetch_add(1, Ordering::Relaxed);
+            }
+        }
+        Ok((segment, false))
+    }
+
+    fn stats(&self) -> zc_shm_client_cache_stats_t {
+        let load = |c: &AtomicU64| c.load(Ordering::Relaxed);
+        zc_shm_client_cache_stats_t {
+            hits: load(&self.hits),
+            misses: load(&self.misses),
+            prefetches: load(&self.prefetches),
+            evictions: load(&self.evictions),
+            segments: self.lock().segments.len(),
+        }
+    }
+}
+
+/// The client attaching segments through a cache, handed to a client storage.
+#[derive(Debug)]
+struct CachedShmClient(Arc<ShmSegmentCache>);
+
+impl ShmClient for CachedShmClient {
+    fn attach(&self, segment: SegmentID) -> Result<Arc<dyn ShmSegment>> {
+        let (segment, cached) = self.0.get(segment)?;
+        let counter = if cached { &self.0.hits } else { &self.0.misses };
+        counter.fetch_add(1, Ordering::Relaxed);
+        Ok(segment)
+    }
+}
+
+decl_c_type!(
+    owned(zc_owned_shm_client_cache_t, option Arc<ShmSegmentCache>),
+    loaned(zc_loaned_shm_client_cache_t),
+);
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Creates a cache of the segments attached by an SHM Client.
+///
+/// The client returned by `zc_shm_client_cache_client()` is meant to be added to a client list in place of `client`,
+/// e.g. with `zc_shm_client_list_add_client()`, so that its segments are attached through the cache. Segments can
+/// then be mapped ahead of the first buffer received from them with `zc_shm_client_cache_prefetch()`, e.g. once a
+/// peer advertised the segments of its provider out of band.
+///
+/// Once the cache holds more than `max_segments` segments, it releases the least recently attached one. A segment
+/// is unmapped once neither the cache nor a buffer refers to it, zenoh keeping the segments it attached for as long as
+/// the client storage they were attached from.
+///
+/// @param this_: An uninitialized memory location where the cache will be constructed.
+/// @param client: The client attaching the segments.
+/// @param max_segments: The maximum number of segments held by the cache, 0 for no limit.
+/// @return 0 in case of success, `Z_EINVAL` if `client` is in its gravestone state.
+#[no_mangle]
+pub extern "C" fn zc_shm_client_cache_new(
+    this_: &mut MaybeUninit<zc_owned_shm_client_cache_t>,
+    client: &mut z_moved_shm_client_t,
+    max_segments: usize,
+) -> z_result_t {
+    let this_ = this_.as_rust_type_mut_uninit();
+    let Some(client) = client.take_rust_type() else {
+        this_.write(None);
+        return Z_EINVAL;
+    };
+    this_.write(Some(Arc::new(ShmSegmentCache::new(client, max_segments))));
+    Z_OK
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs an SHM Client attaching segments through the cache.
+#[no_mangle]
+pub extern "C" fn zc_shm_client_cache_client(
+    this_: &zc_loaned_shm_client_cache_t,
+    client: &mut MaybeUninit<z_owned_shm_client_t>,
+) {
+    let cache = this_.as_rust_type_ref().clone();
+    client
+        .as_rust_type_mut_uninit()
+        .write(Some(Arc::new(CachedShmClient(cache)) as Arc<dyn ShmClient>));
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Maps a segment ahead of the first buffer received from it.
+///
+/// Does nothing if the segment is already cached.
+///
+/// @return 0 in case of success, negative error code if the client failed to attach the segment.
+#[no_mangle]
+pub extern "C" fn zc_shm_client_cache_prefetch(
+    this_: &zc_loaned_shm_client_cache_t,
+    segment_id: z_segment_id_t,
+) -> z_result_t {
+    let cache = this_.as_rust_type_ref();
+    match cache.get(segment_id) {
+        Ok((_, true)) => Z_OK,
+        Ok((_, false)) => {
+            cache.prefetches.fetch_add(1, Ordering::Relaxed);
+            Z_OK
+        }
+        Err(e) => {
+            tracing::error!("Failed to prefetch SHM segment {}: {}", segment_id, e);
+            Z_EGENERIC
+        }
+    }
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns the statistics of an SHM Client cache.
+#[no_mangle]
+pub extern "C" fn zc_shm_client_cache_get_stats(
+    this_: &zc_loaned_shm_client_cache_t,
+    stats: &mut MaybeUninit<zc_shm_client_cache_stats_t>,
+) {
+    stats.write(this_.as_rust_type_ref().stats());
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Borrows SHM Client cache.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn zc_shm_client_cache_loan(
+    this_: &zc_owned_shm_client_cache_t,
+) -> &zc_loaned_shm_client_cache_t {
+    this_
+        .as_rust_type_ref()
+        .as_ref()
+        .unwrap_unchecked()
+        .as_loaned_c_type_ref()
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs SHM Client cache in its gravestone value.
+#[no_mangle]
+pub extern "C" fn zc_internal_shm_client_cache_null(
+    this_: &mut MaybeUninit<zc_owned_shm_client_cache_t>,
+) {
+    this_.as_rust_type_mut_uninit().write(None);
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @return Returns ``true`` if `this` is valid.
+#[no_mangle]
+pub extern "C" fn zc_internal_shm_client_cache_check(this_: &zc_owned_shm_client_cache_t) -> bool {
+    this_.as_rust_type_ref().is_some()
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Deletes SHM Client cache. The segments are released once the clients attaching through it are dropped.
+#[no_mangle]
+pub extern "C" fn zc_shm_client_cache_drop(this_: &mut zc_moved_shm_client_cache_t) {
+    let _ = this_.take_rust_type();
+}
@@ -12,6 +12,7 @@
 //   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
 //
 
+pub mod posix_memory_policy;
 pub mod posix_shm_client;
 pub mod posix_shm_provider;
 pub mod protocol_id;
@@ -0,0 +1,166 @@
+//
+// Copyright (c) 2023 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+use std::{mem::MaybeUninit, sync::atomic::Ordering};
+
+use zenoh::shm::{AllocAlignment, ChunkDescriptor, MemoryLayout, ShmProviderBackend};
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Placement options of the memory of a POSIX SHM Provider segment.
+///
+/// The options are applied once, when the provider is created, to the pages of the segment: subscribers mapping
+/// the segment then share the same physical pages. They are best-effort: a policy which is not supported by the
+/// platform, or refused by the kernel, is ignored with a warning and the provider is created with default pages.
+#[repr(C)]
+#[derive(Clone, Copy, Debug)]
+pub struct zc_posix_shm_provider_options_t {
+    /// Advise the kernel to back the segment with transparent huge pages (Linux only). The segment must be
+    /// large enough to contain huge pages, and `/sys/kernel/mm/transparent_hugepage/shmem_enabled` must allow it.
+    pub huge_pages: bool,
+    /// Bind the memory of the segment to this NUMA node (Linux only), or -1 to keep the default placement.
+    pub numa_node: i32,
+    /// Touch all pages of the segment at creation, so that they are allocated (on the requested node) upfront
+    /// instead of on first access in the data path.
+    pub prefault: bool,
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs the default value for `zc_posix_shm_provider_options_t`.
+#[no_mangle]
+pub extern "C" fn zc_posix_shm_provider_options_default(
+    this: &mut MaybeUninit<zc_posix_shm_provider_options_t>,
+) {
+    this.write(zc_posix_shm_provider_options_t {
+        huge_pages: false,
+        numa_node: -1,
+        prefault: false,
+    });
+}
+
+fn page_size() -> usize {
+    match unsafe { libc::sysconf(libc::_SC_PAGESIZE) } {
+        n if n > 0 => n as usize,
+        _ => 4096,
+    }
+}
+
+/// Returns the page-aligned part of the `[start, end)` address range.
+fn page_range(start: usize, end: usize, page: usize) -> Option<(usize, usize)> {
+    let start = start.checked_add(page - 1)? & !(page - 1);
+    let end = end & !(page - 1);
+    (start < end).then_some((start, end - start))
+}
+
+#[cfg(target_os = "linux")]
+fn apply_huge_pages(addr: usize, len: usize) {
+    if unsafe { libc::madvise(addr as *mut libc::c_void, len, libc::MADV_HUGEPAGE) } != 0 {
+        tracing::warn!(
+            "Failed to enable huge pages on SHM segment: {}",
+            std::io::Error::last_os_error()
+        );
+    }
+}
+
+#[cfg(not(target_os = "linux"))]
+fn apply_huge_pages(_addr: usize, _len: usize) {
+    tracing::warn!("Huge pages for SHM segments are not supported on this platform");
+}
+
+#[cfg(target_os = "linux")]
+fn apply_numa_node(addr: usize, len: usize, node: i32) {
+    const MPOL_BIND: libc::c_long = 2;
+    const MPOL_MF_MOVE: libc::c_long = 1 << 1;
+    let bits = libc::c_ulong::BITS as usize;
+    let node = node as usize;
+    let mut mask = vec![0 as libc::c_ulong; node / bits + 1];
+    mask[node / bits] |= 1 << (node % bits);
+    let res = unsafe {
+        libc::syscall(
+            libc::SYS_mbind,
+            addr,
+            len,
+            MPOL_BIND,
+            mask.as_ptr(),
+            (mask.len() * bits) as libc::c_ulong,
+            MPOL_MF_MOVE,
+        )
+    };
+    if res != 0 {
+        tracing::warn!(
+            "Failed to bind SHM segment to NUMA node {}: {}",
+            node,
+            std::io::Error::last_os_error()
+        );
+    }
+}
+
+#[cfg(not(target_os = "linux"))]
+fn apply_numa_node(_addr: usize, _len: usize, node: i32) {
+    tracing::warn!(
+        "Binding SHM segments to NUMA node {} is not supported on this platform",
+        node
+    );
+}
+
+fn prefault(addr: usize, len: usize, page: usize) {
+    // The segment was just created, so nothing else uses its memory yet
+    for offset in (0..len).step_by(page) {
+        unsafe { std::ptr::write_volatile((addr + offset) as *mut u8, 0) };
+    }
+}
+
+/// Applies `options` to the memory of the freshly created `backend`.
+///
+/// The backend does not expose the address of its segment, so the whole segment is allocated,
+/// in as few chunks as possible, to find it; these chunks are then freed.
+pub(crate) fn apply_memory_policy<B: ShmProviderBackend>(
+    backend: &B,
+    options: &zc_posix_shm_provider_options_t,
+) {
+    if !options.huge_pages && options.numa_node < 0 && !options.prefault {
+        return;
+    }
+    let page = page_size();
+    let Ok(alignment) = AllocAlignment::new(0) else {
+        return;
+    };
+    let mut chunks: Vec<ChunkDescriptor> = Vec::new();
+    let (mut start, mut end) = (usize::MAX, 0usize);
+    let mut size = backend.available();
+    while size >= page {
+        match MemoryLayout::new(size, alignment).map(|layout| backend.alloc(&layout)) {
+            Ok(Ok(chunk)) => {
+                let data = chunk.data.load(Ordering::Relaxed) as usize;
+                start = start.min(data);
+                end = end.max(data + size);
+                chunks.push(chunk.descriptor);
+            }
+            _ => size /= 2,
+        }
+    }
+    if let Some((addr, len)) = page_range(start, end, page) {
+        if options.huge_pages {
+            apply_huge_pages(addr, len);
+        }
+        if options.numa_node >= 0 {
+            apply_numa_node(addr, len, options.numa_node);
+        }
+        if options.prefault {
+            prefault(addr, len, page);
+        }
+    }
+    for chunk in &chunks {
+        backend.free(chunk);
+    }
+}
@@ -12,19 +12,27 @@
 //   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
 //
 
-use std::mem::MaybeUninit;
+use std::{mem::MaybeUninit, sync::Arc};
 
 use zenoh::{
     shm::{
-        AllocLayout, PosixShmProviderBackend, ShmProvider, ShmProviderBuilder, StaticProtocolID,
-        POSIX_PROTOCOL_ID,
+        AllocLayout, MemoryLayout, PosixShmProviderBackend, ShmProvider, ShmProviderBuilder,
+        StaticProtocolID, POSIX_PROTOCOL_ID,
     },
     Wait,
 };
 
+use super::posix_memory_policy::{apply_memory_policy, zc_posix_shm_provider_options_t};
 use crate::{
+    context::zc_threadsafe_context_t,
     result::{z_result_t, Z_EINVAL, Z_OK},
-    shm::provider::shm_provider::CSHMProvider,
+    shm::provider::{
+        shm_provider::CSHMProvider,
+        shm_provider_backend::BoxedShmProviderBackend,
+        slab::{zc_shm_slab_callbacks_t, SlabBackend, SlabNotify},
+        stats::{ShmProviderStats, StatsBackend, StatsShmProvider},
+        thread_cache::{zc_shm_thread_cache_options_t, ThreadCacheBackend},
+    },
     transmute::{RustTypeRef, RustTypeRefUninit},
     z_loaned_memory_layout_t, z_owned_shm_provider_t,
 };
@@ -61,3 +69,223 @@ pub extern "C" fn z_posix_shm_provider_new(
         }
     }
 }
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Creates a new POSIX SHM Provider, placing the memory of its segment according to `options`.
+///
+/// See `zc_posix_shm_provider_options_t` for the available placement policies. Subscribers mapping the segment
+/// share its physical pages, so they benefit from the same placement.
+///
+/// @param this_: An uninitialized memory location where the provider is to be constructed.
+/// @param layout: The layout of the provider's segment.
+/// @param options: The placement options of the segment.
+/// @return 0 in case of success, negative error code otherwise.
+#[no_mangle]
+pub extern "C" fn zc_posix_shm_provider_with_options_new(
+    this: &mut MaybeUninit<z_owned_shm_provider_t>,
+    layout: &z_loaned_memory_layout_t,
+    options: &zc_posix_shm_provider_options_t,
+) -> z_result_t {
+    match PosixShmProviderBackend::builder()
+        .with_layout(layout.as_rust_type_ref())
+        .wait()
+    {
+        Ok(backend) => {
+            apply_memory_policy(&backend, options);
+            let provider = ShmProviderBuilder::builder()
+                .protocol_id::<POSIX_PROTOCOL_ID>()
+                .backend(backend)
+                .wait();
+            this.as_rust_type_mut_uninit()
+                .write(Some(CSHMProvider::Posix(provider)));
+            Z_OK
+        }
+        Err(e) => {
+            tracing::error!("{}", e);
+            this.as_rust_type_mut_uninit().write(None);
+            Z_EINVAL
+        }
+    }
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Creates a new POSIX SHM Provider with per-thread allocation caches.
+///
+/// See `zc_shm_provider_threadsafe_with_thread_cache_new()` for details on the caching.
+#[no_mangle]
+pub extern "C" fn zc_posix_shm_provider_with_thread_cache_new(
+    this: &mut MaybeUninit<z_owned_shm_provider_t>,
+    layout: &z_loaned_memory_layout_t,
+    options: &zc_shm_thread_cache_options_t,
+) -> z_result_t {
+    match PosixShmProviderBackend::builder()
+        .with_layout(layout.as_rust_type_ref())
+        .wait()
+    {
+        Ok(backend) => {
+            let provider = ShmProviderBuilder::builder()
+                .dynamic_protocol_id(POSIX_PROTOCOL_ID)
+                .backend(BoxedShmProviderBackend::new(ThreadCacheBackend::new(
+                    backend, options,
+                )))
+                .wait();
+            this.as_rust_type_mut_uninit()
+                .write(Some(CSHMProvider::Boxed(provider)));
+            Z_OK
+        }
+        Err(e) => {
+            tracing::error!("{}", e);
+            Z_EINVAL
+        }
+    }
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Creates a new POSIX SHM Provider collecting statistics, readable with `zc_shm_provider_stats()`.
+#[no_mangle]
+pub extern "C" fn zc_posix_shm_provider_with_stats_new(
+    this: &mut MaybeUninit<z_owned_shm_provider_t>,
+    layout: &z_loaned_memory_layout_t,
+) -> z_result_t {
+    match PosixShmProviderBackend::builder()
+        .with_layout(layout.as_rust_type_ref())
+        .wait()
+    {
+        Ok(backend) => {
+            let stats = Arc::new(ShmProviderStats::default());
+            let provider = ShmProviderBuilder::builder()
+                .dynamic_protocol_id(POSIX_PROTOCOL_ID)
+                .backend(BoxedShmProviderBackend::new(StatsBackend::new(
+                    backend,
+                    stats.clone(),
+                )))
+                .wait();
+            this.as_rust_type_mut_uninit()
+                .write(Some(CSHMProvider::Stats(StatsShmProvider {
+                    provider,
+                    stats,
+                })));
+            Z_OK
+        }
+        Err(e) => {
+            tracing::error!("{}", e);
+            this.as_rust_type_mut_uninit().write(None);
+            Z_EINVAL
+        }
+    }
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Creates a new POSIX SHM Provider handing out fixed-size chunks.
+///
+/// The provider's segment is carved at creation into `count` chunks of `layout`, kept in a free list: allocation and
+/// free are O(1), the provider never needs defragmentation and `z_shm_provider_available()` reports the exact
+/// number of bytes of the free chunks. Any allocation with a size and alignment not exceeding those of `layout` takes
+/// a whole chunk, bigger ones fail.
+///
+/// @param this_: An uninitialized memory location where the provider is to be constructed.
+/// @param layout: The layout of the chunks.
+/// @param count: The number of chunks.
+/// @return 0 in case of success, negative error code otherwise.
+#[no_mangle]
+pub extern "C" fn zc_posix_shm_slab_provider_new(
+    this: &mut MaybeUninit<z_owned_shm_provider_t>,
+    layout: &z_loaned_memory_layout_t,
+    count: usize,
+) -> z_result_t {
+    posix_shm_slab_provider_new(this, layout, count, None)
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Creates a new POSIX SHM Provider handing out fixed-size chunks, notifying when chunks come back.
+///
+/// Same as `zc_posix_shm_slab_provider_new()`, but `callbacks` are called each time a chunk released by all its
+/// consumers is returned to the free list, from which the next allocation takes it at once. Chunks released by
+/// consumers are detected when the provider collects garbage: either explicitly with `z_shm_provider_garbage_collect()`,
+/// or by the allocation functions with a GC policy when the slab is empty. A collection only checks the chunks in
+/// use, at most `count` of them.
+///
+/// @param this_: An uninitialized memory location where the provider is to be constructed.
+/// @param layout: The layout of the chunks.
+/// @param count: The number of chunks.
+/// @param context: A context passed to `callbacks`. It is dropped together with the provider.
+/// @param callbacks: The callbacks notified when chunks are returned.
+/// @return 0 in case of success, negative error code otherwise.
+#[no_mangle]
+pub extern "C" fn zc_posix_shm_slab_provider_with_notify_new(
+    this: &mut MaybeUninit<z_owned_shm_provider_t>,
+    layout: &z_loaned_memory_layout_t,
+    count: usize,
+    context: zc_threadsafe_context_t,
+    callbacks: zc_shm_slab_callbacks_t,
+) -> z_result_t {
+    posix_shm_slab_provider_new(
+        this,
+        layout,
+        count,
+        Some(SlabNotify::new(context, callbacks)),
+    )
+}
+
+fn posix_shm_slab_provider_new(
+    this: &mut MaybeUninit<z_owned_shm_provider_t>,
+    layout: &z_loaned_memory_layout_t,
+    count: usize,
+    mut notify: Option<SlabNotify>,
+) -> z_result_t {
+    let chunk_layout = layout.as_rust_type_ref();
+    let chunk_size: usize = chunk_layout.size().into();
+    let this = this.as_rust_type_mut_uninit();
+    if count == 0 {
+        tracing::error!("Slab SHM Provider should have at least one chunk");
+        this.write(None);
+        return Z_EINVAL;
+    }
+    // The segment allocator may need some room in addition to the chunks themselves,
+    // the segment is grown until all chunks fit in it.
+    let mut segment_size = chunk_size.saturating_mul(count);
+    for _ in 0..4 {
+        let segment_layout = match MemoryLayout::new(segment_size, chunk_layout.alignment()) {
+            Ok(l) => l,
+            Err(e) => {
+                tracing::error!("{:?}", e);
+                break;
+            }
+        };
+        let backend = match PosixShmProviderBackend::builder()
+            .with_layout(&segment_layout)
+            .wait()
+        {
+            Ok(backend) => backend,
+            Err(e) => {
+                tracing::error!("{}", e);
+                break;
+            }
+        };
+        match SlabBackend::new(backend, chunk_layout, count) {
+            Ok(mut slab) => {
+                if let Some(notify) = notify.take() {
+                    slab = slab.with_notify(notify);
+                }
+                let provider = ShmProviderBuilder::builder()
+                    .dynamic_protocol_id(POSIX_PROTOCOL_ID)
+                    .backend(BoxedShmProviderBackend::new(slab))
+                    .wait();
+                this.write(Some(CSHMProvider::Boxed(provider)));
+                return Z_OK;
+            }
+            Err((_, missing)) => {
+                segment_size = segment_size
+                    .saturating_add(chunk_size.saturating_mul(missing))
+                    .saturating_add(segment_size / 8);
+            }
+        }
+    }
+    tracing::error!(
+        "Failed to create a POSIX SHM segment holding {} chunks of {} bytes",
+        count,
+        chunk_size
+    );
+    this.write(None);
+    Z_EINVAL
+}
@@ -12,7 +12,7 @@
 //   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
 //
 
-use std::mem::MaybeUninit;
+use std::{mem::MaybeUninit, sync::Arc};
 
 use libc::c_void;
 use zenoh::shm::{
@@ -21,7 +21,8 @@ use zenoh::shm::{
 
 use super::{
     alloc_layout_impl::{alloc, alloc_async, alloc_layout_new},
-    shm_provider_backend::DynamicShmProviderBackend,
+    shm_provider_backend::{BoxedShmProviderBackend, DynamicShmProviderBackend},
+    stats::ShmProviderStats,
     types::{z_alloc_alignment_t, z_buf_alloc_result_t},
 };
 use crate::{
@@ -39,10 +40,14 @@ pub type DynamicAllocLayout =
 pub type DynamicAllocLayoutThreadsafe =
     AllocLayout<'static, DynamicProtocolID, DynamicShmProviderBackend<ThreadsafeContext>>;
 
+pub type BoxedAllocLayout = AllocLayout<'static, DynamicProtocolID, BoxedShmProviderBackend>;
+
 pub enum CSHMLayout {
     Posix(PosixAllocLayout),
     Dynamic(DynamicAllocLayout),
     DynamicThreadsafe(DynamicAllocLayoutThreadsafe),
+    Boxed(BoxedAllocLayout),
+    Stats(BoxedAllocLayout, Arc<ShmProviderStats>),
 }
 
 decl_c_type!(
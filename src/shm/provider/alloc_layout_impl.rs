@@ -24,7 +24,8 @@ use zenoh::{
 };
 
 use super::{
-    alloc_layout::CSHMLayout, shm_provider_backend::DynamicShmProviderBackend,
+    alloc_layout::CSHMLayout,
+    shm_provider_backend::{BoxedShmProviderBackend, DynamicShmProviderBackend},
     types::z_alloc_alignment_t,
 };
 use crate::{
@@ -81,12 +82,39 @@ pub(crate) fn alloc_layout_new(
                 }
             }
         }
+        super::shm_provider::CSHMProvider::Boxed(provider) => {
+            match provider
+                .alloc(size)
+                .with_alignment(alignment.into_rust_type())
+                .into_layout()
+            {
+                Ok(layout) => CSHMLayout::Boxed(layout),
+                Err(e) => {
+                    tracing::error!("{:?}", e);
+                    return Z_EINVAL;
+                }
+            }
+        }
+        super::shm_provider::CSHMProvider::Stats(provider) => {
+            match provider
+                .provider
+                .alloc(size)
+                .with_alignment(alignment.into_rust_type())
+                .into_layout()
+            {
+                Ok(layout) => CSHMLayout::Stats(layout, provider.stats.clone()),
+                Err(e) => {
+                    tracing::error!("{:?}", e);
+                    return Z_EINVAL;
+                }
+            }
+        }
     };
     this.as_rust_type_mut_uninit().write(Some(layout));
     Z_OK
 }
 
-pub(crate) fn alloc<Policy: AllocPolicy>(
+pub(crate) fn alloc<Policy: AllocPolicy + 'static>(
     out_result: &mut MaybeUninit<z_buf_alloc_result_t>,
     layout: &z_loaned_alloc_layout_t,
 ) {
@@ -100,6 +128,12 @@ pub(crate) fn alloc<Policy: AllocPolicy>(
         super::alloc_layout::CSHMLayout::DynamicThreadsafe(layout) => {
             layout.alloc().with_policy::<Policy>().wait()
         }
+        super::alloc_layout::CSHMLayout::Boxed(layout) => {
+            layout.alloc().with_policy::<Policy>().wait()
+        }
+        super::alloc_layout::CSHMLayout::Stats(layout, stats) => {
+            stats.alloc::<Policy, _>(|| layout.alloc().with_policy::<Policy>().wait())
+        }
     };
     out_result.write(result.into());
 }
@@ -129,6 +163,16 @@ pub(crate) fn alloc_async<Policy: AsyncAllocPolicy>(
             >(out_result, layout, result_context, result_callback);
             Z_OK
         }
+        super::alloc_layout::CSHMLayout::Boxed(layout)
+        | super::alloc_layout::CSHMLayout::Stats(layout, _) => {
+            alloc_async_impl::<Policy, DynamicProtocolID, BoxedShmProviderBackend>(
+                out_result,
+                layout,
+                result_context,
+                result_callback,
+            );
+            Z_OK
+        }
     }
 }
 
@@ -0,0 +1,384 @@
+//
+// Copyright (c) 2023 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+use std::{
+    collections::VecDeque,
+    mem::MaybeUninit,
+    sync::{Arc, Mutex},
+};
+
+use libc::{c_int, c_void};
+use zenoh::shm::{
+    AllocLayout, AsyncAllocPolicy, BlockOn, BufLayoutAllocResult, Defragment, DynamicProtocolID,
+    GarbageCollect, PosixShmProviderBackend, ProtocolIDSource, ShmProvider, ShmProviderBackend,
+    StaticProtocolID, ZLayoutAllocError, POSIX_PROTOCOL_ID,
+};
+
+use super::{
+    alloc_layout::CSHMLayout,
+    shm_provider::CSHMProvider,
+    shm_provider_backend::{BoxedShmProviderBackend, DynamicShmProviderBackend},
+    stats::StatsShmProvider,
+    types::{z_alloc_alignment_t, z_buf_layout_alloc_result_t},
+};
+pub use crate::opaque_types::{
+    zc_loaned_shm_completion_queue_t, zc_moved_shm_completion_queue_t,
+    zc_owned_shm_completion_queue_t,
+};
+use crate::{
+    context::ThreadsafeContext,
+    result::{z_result_t, Z_EGENERIC, Z_EINVAL, Z_OK},
+    transmute::{IntoRustType, LoanedCTypeRef, RustTypeRef, RustTypeRefUninit, TakeRustType},
+    z_loaned_alloc_layout_t, z_loaned_shm_provider_t,
+};
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief A completed SHM allocation, drained from a `zc_owned_shm_completion_queue_t`.
+#[repr(C)]
+pub struct zc_shm_completion_t {
+    /// The user data passed to the allocation function.
+    user_data: *mut c_void,
+    /// The result of the allocation.
+    result: z_buf_layout_alloc_result_t,
+}
+
+/// The file descriptor signaled when completions are posted, readable until the queue is drained.
+struct CompletionFd {
+    read: c_int,
+    write: c_int,
+}
+
+impl CompletionFd {
+    #[cfg(target_os = "linux")]
+    fn new() -> std::io::Result<Self> {
+        match unsafe { libc::eventfd(0, libc::EFD_NONBLOCK | libc::EFD_CLOEXEC) } {
+            -1 => Err(std::io::Error::last_os_error()),
+            fd => Ok(Self {
+                read: fd,
+                write: fd,
+            }),
+        }
+    }
+
+    #[cfg(all(unix, not(target_os = "linux")))]
+    fn new() -> std::io::Result<Self> {
+        let mut fds = [-1 as c_int; 2];
+        if unsafe { libc::pipe(fds.as_mut_ptr()) } == -1 {
+            return Err(std::io::Error::last_os_error());
+        }
+        let fd = Self {
+            read: fds[0],
+            write: fds[1],
+        };
+        for fd in fds {
+            unsafe {
+                libc::fcntl(fd, libc::F_SETFL, libc::O_NONBLOCK);
+                libc::fcntl(fd, libc::F_SETFD, libc::FD_CLOEXEC);
+            }
+        }
+        Ok(fd)
+    }
+
+    #[cfg(not(unix))]
+    fn new() -> std::io::Result<Self> {
+        Ok(Self {
+            read: -1,
+            write: -1,
+        })
+    }
+
+    fn signal(&self) {
+        #[cfg(unix)]
+        {
+            let one = 1u64;
+            // An eventfd expects a 8-bytes counter increment, a pipe is happy with any byte.
+            let len = if self.read == self.write { 8 } else { 1 };
+            unsafe { libc::write(self.write, &one as *const u64 as *const c_void, len) };
+        }
+    }
+
+    fn clear(&self) {
+        #[cfg(unix)]
+        {
+            let mut buf = [0u8; 64];
+            // An eventfd is reset by a single read, a pipe is read until empty.
+            while unsafe { libc::read(self.read, buf.as_mut_ptr() as *mut c_void, buf.len()) } > 0
+                && self.read != self.write
+            {}
+        }
+    }
+}
+
+impl Drop for CompletionFd {
+    fn drop(&mut self) {
+        #[cfg(unix)]
+        unsafe {
+            libc::close(self.read);
+            if self.write != self.read {
+                libc::close(self.write);
+            }
+        }
+    }
+}
+
+struct CompletionQueueInner {
+    // user data is stored as an address, it is only handed back to the user
+    completions: Mutex<VecDeque<(usize, BufLayoutAllocResult)>>,
+    fd: CompletionFd,
+}
+
+impl CompletionQueueInner {
+    fn post(&self, user_data: usize, result: BufLayoutAllocResult) {
+        if let Ok(mut completions) = self.completions.lock() {
+            completions.push_back((user_data, result));
+        }
+        self.fd.signal();
+    }
+}
+
+#[derive(Clone)]
+pub struct ShmCompletionQueue(Arc<CompletionQueueInner>);
+
+decl_c_type!(
+    owned(zc_owned_shm_completion_queue_t, option ShmCompletionQueue),
+    loaned(zc_loaned_shm_completion_queue_t),
+);
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs a queue receiving the results of asynchronous SHM allocations.
+///
+/// Results are posted to the queue from the runtime threads, and the queue's file descriptor (see
+/// `zc_shm_completion_queue_fd()`) becomes readable. An event loop polls this descriptor and drains all pending
+/// results in a batch with `zc_shm_completion_queue_drain()`, from its own thread.
+///
+/// @return 0 in case of success, negative error code if the file descriptor could not be created.
+#[no_mangle]
+pub extern "C" fn zc_shm_completion_queue_new(
+    this_: &mut MaybeUninit<zc_owned_shm_completion_queue_t>,
+) -> z_result_t {
+    let this_ = this_.as_rust_type_mut_uninit();
+    match CompletionFd::new() {
+        Ok(fd) => {
+            this_.write(Some(ShmCompletionQueue(Arc::new(CompletionQueueInner {
+                completions: Mutex::new(VecDeque::new()),
+                fd,
+            }))));
+            Z_OK
+        }
+        Err(e) => {
+            tracing::error!("Failed to create completion queue file descriptor: {}", e);
+            this_.write(None);
+            Z_EGENERIC
+        }
+    }
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs completion queue in its gravestone state.
+#[no_mangle]
+pub extern "C" fn zc_internal_shm_completion_queue_null(
+    this_: &mut MaybeUninit<zc_owned_shm_completion_queue_t>,
+) {
+    this_.as_rust_type_mut_uninit().write(None);
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns ``true`` if `this_` is in a valid state, ``false`` if it is in a gravestone state.
+#[no_mangle]
+pub extern "C" fn zc_internal_shm_completion_queue_check(
+    this_: &zc_owned_shm_completion_queue_t,
+) -> bool {
+    this_.as_rust_type_ref().is_some()
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Borrows completion queue.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn zc_shm_completion_queue_loan(
+    this_: &zc_owned_shm_completion_queue_t,
+) -> &zc_loaned_shm_completion_queue_t {
+    this_
+        .as_rust_type_ref()
+        .as_ref()
+        .unwrap_unchecked()
+        .as_loaned_c_type_ref()
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Drops completion queue and resets it to its gravestone state.
+///
+/// Allocations still in progress keep the queue alive until they complete, their results are then dropped.
+#[no_mangle]
+pub extern "C" fn zc_shm_completion_queue_drop(this_: &mut zc_moved_shm_completion_queue_t) {
+    let _ = this_.take_rust_type();
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Returns the file descriptor of the queue, readable while completions are pending, or -1 on platforms
+/// without file descriptors. It is owned by the queue and should not be read or closed by the user.
+#[no_mangle]
+pub extern "C" fn zc_shm_completion_queue_fd(this_: &zc_loaned_shm_completion_queue_t) -> c_int {
+    this_.as_rust_type_ref().0.fd.read
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Moves up to `max` pending completions, in completion order, to the `out` array, without blocking.
+///
+/// The file descriptor of the queue stays readable if more completions are pending afterwards.
+/// The buffers of the drained results are owned by the caller.
+/// @return The number of completions written to `out`.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn zc_shm_completion_queue_drain(
+    this_: &zc_loaned_shm_completion_queue_t,
+    out: *mut MaybeUninit<zc_shm_completion_t>,
+    max: usize,
+) -> usize {
+    let queue = &this_.as_rust_type_ref().0;
+    if out.is_null() || max == 0 {
+        return 0;
+    }
+    queue.fd.clear();
+    let Ok(mut completions) = queue.completions.lock() else {
+        return 0;
+    };
+    let n = completions.len().min(max);
+    for (i, (user_data, result)) in completions.drain(..n).enumerate() {
+        (*out.add(i)).write(zc_shm_completion_t {
+            user_data: user_data as *mut c_void,
+            result: result.into(),
+        });
+    }
+    if !completions.is_empty() {
+        queue.fd.signal();
+    }
+    n
+}
+
+fn provider_alloc_impl<
+    Policy: AsyncAllocPolicy,
+    TProtocolID: ProtocolIDSource,
+    TBackend: ShmProviderBackend + Send + Sync,
+>(
+    provider: &'static ShmProvider<TProtocolID, TBackend>,
+    size: usize,
+    alignment: z_alloc_alignment_t,
+    queue: Arc<CompletionQueueInner>,
+    user_data: usize,
+) {
+    zenoh_runtime::ZRuntime::Application.spawn(async move {
+        let result = provider
+            .alloc(size)
+            .with_alignment(alignment.into_rust_type())
+            .with_policy::<Policy>()
+            .await;
+        queue.post(user_data, result);
+    });
+}
+
+fn layout_alloc_impl<
+    Policy: AsyncAllocPolicy,
+    TProtocolID: ProtocolIDSource,
+    TBackend: ShmProviderBackend + Send + Sync,
+>(
+    layout: &'static AllocLayout<'static, TProtocolID, TBackend>,
+    queue: Arc<CompletionQueueInner>,
+    user_data: usize,
+) {
+    zenoh_runtime::ZRuntime::Application.spawn(async move {
+        let result = layout.alloc().with_policy::<Policy>().await;
+        queue.post(user_data, result.map_err(ZLayoutAllocError::Alloc));
+    });
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Make allocation performing garbage collection and/or defragmentation in async manner, posting the result
+/// to `queue`. Will return Z_EINVAL if used with non-threadsafe SHM Provider.
+///
+/// @param provider: The provider to allocate from.
+/// @param size: The size of the buffer.
+/// @param alignment: The alignment of the buffer.
+/// @param queue: The queue the result is posted to.
+/// @param user_data: An arbitrary pointer, returned together with the result.
+#[no_mangle]
+pub extern "C" fn zc_shm_provider_alloc_gc_defrag_async_to_queue(
+    provider: &'static z_loaned_shm_provider_t,
+    size: usize,
+    alignment: z_alloc_alignment_t,
+    queue: &zc_loaned_shm_completion_queue_t,
+    user_data: *mut c_void,
+) -> z_result_t {
+    type Policy = BlockOn<Defragment<GarbageCollect>>;
+    let queue = queue.as_rust_type_ref().0.clone();
+    let user_data = user_data as usize;
+    match provider.as_rust_type_ref() {
+        CSHMProvider::Posix(provider) => provider_alloc_impl::<
+            Policy,
+            StaticProtocolID<POSIX_PROTOCOL_ID>,
+            PosixShmProviderBackend,
+        >(provider, size, alignment, queue, user_data),
+        CSHMProvider::Dynamic(_) => return Z_EINVAL,
+        CSHMProvider::DynamicThreadsafe(provider) => {
+            provider_alloc_impl::<
+                Policy,
+                DynamicProtocolID,
+                DynamicShmProviderBackend<ThreadsafeContext>,
+            >(provider, size, alignment, queue, user_data)
+        }
+        CSHMProvider::Boxed(provider) | CSHMProvider::Stats(StatsShmProvider { provider, .. }) => {
+            provider_alloc_impl::<Policy, DynamicProtocolID, BoxedShmProviderBackend>(
+                provider, size, alignment, queue, user_data,
+            )
+        }
+    }
+    Z_OK
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Make allocation performing garbage collection and/or defragmentation in async manner, posting the result
+/// to `queue`. Will return Z_EINVAL if used with non-threadsafe SHM Provider.
+///
+/// @param layout: The layout to allocate with.
+/// @param queue: The queue the result is posted to.
+/// @param user_data: An arbitrary pointer, returned together with the result.
+#[no_mangle]
+pub extern "C" fn zc_alloc_layout_threadsafe_alloc_gc_defrag_async_to_queue(
+    layout: &'static z_loaned_alloc_layout_t,
+    queue: &zc_loaned_shm_completion_queue_t,
+    user_data: *mut c_void,
+) -> z_result_t {
+    type Policy = BlockOn<Defragment<GarbageCollect>>;
+    let queue = queue.as_rust_type_ref().0.clone();
+    let user_data = user_data as usize;
+    match layout.as_rust_type_ref() {
+        CSHMLayout::Posix(layout) => {
+            layout_alloc_impl::<Policy, StaticProtocolID<POSIX_PROTOCOL_ID>, PosixShmProviderBackend>(
+                layout, queue, user_data,
+            )
+        }
+        CSHMLayout::Dynamic(_) => return Z_EINVAL,
+        CSHMLayout::DynamicThreadsafe(layout) => layout_alloc_impl::<
+            Policy,
+            DynamicProtocolID,
+            DynamicShmProviderBackend<ThreadsafeContext>,
+        >(layout, queue, user_data),
+        CSHMLayout::Boxed(layout) | CSHMLayout::Stats(layout, _) => {
+            layout_alloc_impl::<Policy, DynamicProtocolID, BoxedShmProviderBackend>(
+                layout, queue, user_data,
+            )
+        }
+    }
+    Z_OK
+}
@@ -15,7 +15,11 @@
 pub mod alloc_layout;
 pub(crate) mod alloc_layout_impl;
 pub mod chunk;
+pub mod completion_queue;
 pub mod shm_provider;
 pub mod shm_provider_backend;
 pub(crate) mod shm_provider_impl;
+pub mod slab;
+pub mod stats;
+pub mod thread_cache;
 pub mod types;
@@ -25,8 +25,12 @@ use zenoh::{
 
 use super::{
     chunk::z_allocated_chunk_t,
-    shm_provider_backend::{zc_shm_provider_backend_callbacks_t, DynamicShmProviderBackend},
+    shm_provider_backend::{
+        zc_shm_provider_backend_callbacks_t, BoxedShmProviderBackend, DynamicShmProviderBackend,
+    },
     shm_provider_impl::{alloc, alloc_async, available, defragment, garbage_collect, map},
+    stats::StatsShmProvider,
+    thread_cache::{zc_shm_thread_cache_options_t, ThreadCacheBackend},
     types::z_alloc_alignment_t,
 };
 use crate::{
@@ -46,10 +50,14 @@ pub type DynamicShmProvider = ShmProvider<DynamicProtocolID, DynamicShmProviderB
 pub type DynamicShmProviderThreadsafe =
     ShmProvider<DynamicProtocolID, DynamicShmProviderBackend<ThreadsafeContext>>;
 
+pub type BoxedShmProvider = ShmProvider<DynamicProtocolID, BoxedShmProviderBackend>;
+
 pub enum CSHMProvider {
     Posix(PosixShmProvider),
     Dynamic(DynamicShmProvider),
     DynamicThreadsafe(DynamicShmProviderThreadsafe),
+    Boxed(BoxedShmProvider),
+    Stats(StatsShmProvider),
 }
 
 decl_c_type!(
@@ -95,6 +103,34 @@ pub extern "C" fn z_shm_provider_threadsafe_new(
         .write(Some(CSHMProvider::DynamicThreadsafe(provider)));
 }
 
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Creates a new threadsafe SHM Provider with per-thread allocation caches.
+///
+/// Allocations up to `options->max_size` are served from per-thread caches of chunks of the backend, so that
+/// threads allocating concurrently from the same provider do not contend on the backend allocator.
+/// The backend then allocates and frees chunks of the cached size classes much less often.
+/// Memory cached by the provider is not accounted as available by `z_shm_provider_available()`,
+/// `z_shm_provider_defragment()` returns it to the backend before defragmenting.
+#[no_mangle]
+pub extern "C" fn zc_shm_provider_threadsafe_with_thread_cache_new(
+    this: &mut MaybeUninit<z_owned_shm_provider_t>,
+    id: z_protocol_id_t,
+    context: zc_threadsafe_context_t,
+    callbacks: zc_shm_provider_backend_callbacks_t,
+    options: &zc_shm_thread_cache_options_t,
+) {
+    let backend = DynamicShmProviderBackend::<ThreadsafeContext>::new(context.into(), callbacks);
+    let provider = ShmProviderBuilder::builder()
+        .dynamic_protocol_id(id)
+        .backend(BoxedShmProviderBackend::new(ThreadCacheBackend::new(
+            backend, options,
+        )))
+        .wait();
+
+    this.as_rust_type_mut_uninit()
+        .write(Some(CSHMProvider::Boxed(provider)));
+}
+
 /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
 /// @brief Constructs SHM Provider in its gravestone value.
 #[no_mangle]
@@ -99,3 +99,41 @@ where
         layout.ok_or(ZLayoutError::ProviderIncompatibleLayout)
     }
 }
+
+/// A type-erased backend, used by the providers whose backend is built by stacking allocation
+/// strategies on top of a POSIX or of a callback-based backend.
+pub struct BoxedShmProviderBackend(Box<dyn ShmProviderBackend + Send + Sync>);
+
+impl BoxedShmProviderBackend {
+    pub fn new(backend: impl ShmProviderBackend + Send + Sync + 'static) -> Self {
+        Self(Box::new(backend))
+    }
+}
+
+impl Debug for BoxedShmProviderBackend {
+    fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+        f.debug_struct("BoxedShmProviderBackend").finish()
+    }
+}
+
+impl ShmProviderBackend for BoxedShmProviderBackend {
+    fn alloc(&self, layout: &MemoryLayout) -> ChunkAllocResult {
+        self.0.alloc(layout)
+    }
+
+    fn free(&self, chunk: &ChunkDescriptor) {
+        self.0.free(chunk)
+    }
+
+    fn defragment(&self) -> usize {
+        self.0.defragment()
+    }
+
+    fn available(&self) -> usize {
+        self.0.available()
+    }
+
+    fn layout_for(&self, layout: MemoryLayout) -> Result<MemoryLayout, ZLayoutError> {
+        self.0.layout_for(layout)
+    }
+}
@@ -18,13 +18,15 @@ use libc::c_void;
 use zenoh::{
     shm::{
         AllocPolicy, AsyncAllocPolicy, DynamicProtocolID, PosixShmProviderBackend,
-        ProtocolIDSource, ShmProvider, ShmProviderBackend, StaticProtocolID, POSIX_PROTOCOL_ID,
+        ProtocolIDSource, ShmProvider, ShmProviderBackend, StaticProtocolID, ZShmMut,
+        POSIX_PROTOCOL_ID,
     },
     Wait,
 };
 
 use super::{
-    chunk::z_allocated_chunk_t, shm_provider_backend::DynamicShmProviderBackend,
+    chunk::z_allocated_chunk_t,
+    shm_provider_backend::{BoxedShmProviderBackend, DynamicShmProviderBackend},
     types::z_alloc_alignment_t,
 };
 use crate::{
@@ -35,7 +37,7 @@ use crate::{
     z_loaned_shm_provider_t, z_owned_shm_mut_t,
 };
 
-pub(crate) fn alloc<Policy: AllocPolicy>(
+pub(crate) fn alloc<Policy: AllocPolicy + 'static>(
     out_result: &mut MaybeUninit<z_buf_layout_alloc_result_t>,
     provider: &z_loaned_shm_provider_t,
     size: usize,
@@ -57,6 +59,45 @@ pub(crate) fn alloc<Policy: AllocPolicy>(
                 out_result, provider, size, alignment,
             )
         }
+        super::shm_provider::CSHMProvider::Boxed(provider) => {
+            alloc_impl::<Policy, DynamicProtocolID, BoxedShmProviderBackend>(
+                out_result, provider, size, alignment,
+            )
+        }
+        super::shm_provider::CSHMProvider::Stats(provider) => {
+            provider.stats.alloc::<Policy, _>(|| {
+                alloc_impl::<Policy, DynamicProtocolID, BoxedShmProviderBackend>(
+                    out_result,
+                    &provider.provider,
+                    size,
+                    alignment,
+                )
+            })
+        }
+    }
+}
+
+/// Allocates a buffer with the default alignment, for the users of the provider within zenoh-c.
+pub(crate) fn alloc_buf<Policy: AllocPolicy + 'static>(
+    provider: &z_loaned_shm_provider_t,
+    size: usize,
+) -> Option<ZShmMut> {
+    match provider.as_rust_type_ref() {
+        super::shm_provider::CSHMProvider::Posix(provider) => {
+            alloc_buf_impl::<Policy, _, _>(provider, size)
+        }
+        super::shm_provider::CSHMProvider::Dynamic(provider) => {
+            alloc_buf_impl::<Policy, _, _>(provider, size)
+        }
+        super::shm_provider::CSHMProvider::DynamicThreadsafe(provider) => {
+            alloc_buf_impl::<Policy, _, _>(provider, size)
+        }
+        super::shm_provider::CSHMProvider::Boxed(provider) => {
+            alloc_buf_impl::<Policy, _, _>(provider, size)
+        }
+        super::shm_provider::CSHMProvider::Stats(provider) => provider
+            .stats
+            .alloc::<Policy, _>(|| alloc_buf_impl::<Policy, _, _>(&provider.provider, size)),
     }
 }
 
@@ -99,6 +140,28 @@ pub(crate) fn alloc_async<Policy: AsyncAllocPolicy>(
             );
             Z_OK
         }
+        super::shm_provider::CSHMProvider::Boxed(provider) => {
+            alloc_async_impl::<Policy, DynamicProtocolID, BoxedShmProviderBackend>(
+                out_result,
+                provider,
+                size,
+                alignment,
+                result_context,
+                result_callback,
+            );
+            Z_OK
+        }
+        super::shm_provider::CSHMProvider::Stats(provider) => {
+            alloc_async_impl::<Policy, DynamicProtocolID, BoxedShmProviderBackend>(
+                out_result,
+                &provider.provider,
+                size,
+                alignment,
+                result_context,
+                result_callback,
+            );
+            Z_OK
+        }
     }
 }
 
@@ -107,6 +170,8 @@ pub(crate) fn defragment(provider: &z_loaned_shm_provider_t) -> usize {
         super::shm_provider::CSHMProvider::Posix(provider) => provider.defragment(),
         super::shm_provider::CSHMProvider::Dynamic(provider) => provider.defragment(),
         super::shm_provider::CSHMProvider::DynamicThreadsafe(provider) => provider.defragment(),
+        super::shm_provider::CSHMProvider::Boxed(provider) => provider.defragment(),
+        super::shm_provider::CSHMProvider::Stats(provider) => provider.provider.defragment(),
     }
 }
 
@@ -117,6 +182,10 @@ pub(crate) fn garbage_collect(provider: &z_loaned_shm_provider_t) -> usize {
         super::shm_provider::CSHMProvider::DynamicThreadsafe(provider) => {
             provider.garbage_collect()
         }
+        super::shm_provider::CSHMProvider::Boxed(provider) => provider.garbage_collect(),
+        super::shm_provider::CSHMProvider::Stats(provider) => provider
+            .stats
+            .garbage_collect(|| provider.provider.garbage_collect()),
     }
 }
 
@@ -125,6 +194,8 @@ pub(crate) fn available(provider: &z_loaned_shm_provider_t) -> usize {
         super::shm_provider::CSHMProvider::Posix(provider) => provider.available(),
         super::shm_provider::CSHMProvider::Dynamic(provider) => provider.available(),
         super::shm_provider::CSHMProvider::DynamicThreadsafe(provider) => provider.available(),
+        super::shm_provider::CSHMProvider::Boxed(provider) => provider.available(),
+        super::shm_provider::CSHMProvider::Stats(provider) => provider.provider.available(),
     }
 }
 
@@ -144,6 +215,8 @@ pub(crate) fn map(
         super::shm_provider::CSHMProvider::Posix(provider) => provider.map(chunk, len),
         super::shm_provider::CSHMProvider::Dynamic(provider) => provider.map(chunk, len),
         super::shm_provider::CSHMProvider::DynamicThreadsafe(provider) => provider.map(chunk, len),
+        super::shm_provider::CSHMProvider::Boxed(provider) => provider.map(chunk, len),
+        super::shm_provider::CSHMProvider::Stats(provider) => provider.provider.map(chunk, len),
     };
 
     match mapping {
@@ -173,6 +246,17 @@ fn alloc_impl<Policy: AllocPolicy, TProtocolID: ProtocolIDSource, TBackend: ShmP
     out_result.write(result.into());
 }
 
+fn alloc_buf_impl<
+    Policy: AllocPolicy,
+    TProtocolID: ProtocolIDSource,
+    TBackend: ShmProviderBackend,
+>(
+    provider: &ShmProvider<TProtocolID, TBackend>,
+    size: usize,
+) -> Option<ZShmMut> {
+    provider.alloc(size).with_policy::<Policy>().wait().ok()
+}
+
 pub(crate) fn alloc_async_impl<
     Policy: AsyncAllocPolicy,
     TProtocolID: ProtocolIDSource,
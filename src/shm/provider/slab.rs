@@ -0,0 +1,183 @@
+//
+// Copyright (c) 2023 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+use std::{
+    collections::HashMap,
+    ffi::c_void,
+    sync::{
+        atomic::{AtomicPtr, Ordering},
+        Mutex,
+    },
+};
+
+use zenoh::shm::{
+    AllocatedChunk, ChunkAllocResult, ChunkDescriptor, MemoryLayout, ShmProviderBackend,
+    ZAllocError, ZLayoutError,
+};
+
+use crate::{
+    context::{zc_threadsafe_context_t, DroppableContext, ThreadsafeContext},
+    shm::common::types::{z_chunk_id_t, z_segment_id_t},
+};
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Callbacks of a slab SHM Provider.
+#[derive(Debug)]
+#[repr(C)]
+pub struct zc_shm_slab_callbacks_t {
+    /// Called each time a chunk released by all its consumers is returned to the free list of the slab, with
+    /// the number of free chunks. It is called from the thread collecting the provider's garbage, without any lock held.
+    returned_fn: unsafe extern "C" fn(free_chunks: usize, context: *mut c_void),
+}
+
+#[derive(Debug)]
+pub struct SlabNotify {
+    context: ThreadsafeContext,
+    callbacks: zc_shm_slab_callbacks_t,
+}
+
+impl SlabNotify {
+    pub fn new(context: zc_threadsafe_context_t, callbacks: zc_shm_slab_callbacks_t) -> Self {
+        Self {
+            context: context.into(),
+            callbacks,
+        }
+    }
+
+    fn returned(&self, free_chunks: usize) {
+        unsafe { (self.callbacks.returned_fn)(free_chunks, self.context.get()) }
+    }
+}
+
+/// A backend handing out fixed-size chunks carved once for all from the inner backend `B`.
+///
+/// Chunks are kept in a free list and never returned to `B`, so that allocation and free are O(1)
+/// and the memory never gets fragmented.
+pub struct SlabBackend<B: ShmProviderBackend> {
+    inner: B,
+    chunk_size: usize,
+    alignment: usize,
+    /// Data pointers of all chunks of the slab, the backend only receives the descriptor of the chunks to free.
+    pointers: HashMap<(z_segment_id_t, z_chunk_id_t), usize>,
+    free: Mutex<Vec<ChunkDescriptor>>,
+    notify: Option<SlabNotify>,
+}
+
+impl<B: ShmProviderBackend> SlabBackend<B> {
+    /// Carves `count` chunks of `layout` from `inner`. Returns the number of chunks that could not be allocated
+    /// as an error, together with the inner backend, if `inner` can not hold them all.
+    pub fn new(inner: B, layout: &MemoryLayout, count: usize) -> Result<Self, (B, usize)> {
+        let mut pointers = HashMap::with_capacity(count);
+        let mut free = Vec::with_capacity(count);
+        for _ in 0..count {
+            match inner.alloc(layout) {
+                Ok(chunk) => {
+                    let key = (chunk.descriptor.segment, chunk.descriptor.chunk);
+                    pointers.insert(key, chunk.data.load(Ordering::Relaxed) as usize);
+                    free.push(chunk.descriptor);
+                }
+                Err(_) => break,
+            }
+        }
+        if free.len() < count {
+            let missing = count - free.len();
+            for chunk in &free {
+                inner.free(chunk);
+            }
+            return Err((inner, missing));
+        }
+        Ok(Self {
+            inner,
+            chunk_size: layout.size().into(),
+            alignment: layout.alignment().get_alignment_value().get(),
+            pointers,
+            free: Mutex::new(free),
+            notify: None,
+        })
+    }
+
+    /// Sets the callbacks notified when chunks are returned to the slab.
+    pub fn with_notify(mut self, notify: SlabNotify) -> Self {
+        self.notify = Some(notify);
+        self
+    }
+
+    fn fits(&self, layout: &MemoryLayout) -> bool {
+        let size: usize = layout.size().into();
+        size <= self.chunk_size && layout.alignment().get_alignment_value().get() <= self.alignment
+    }
+}
+
+impl<B: ShmProviderBackend> Drop for SlabBackend<B> {
+    fn drop(&mut self) {
+        if let Ok(free) = self.free.get_mut() {
+            for chunk in free.drain(..) {
+                self.inner.free(&chunk);
+            }
+        }
+    }
+}
+
+impl<B: ShmProviderBackend> ShmProviderBackend for SlabBackend<B> {
+    fn alloc(&self, layout: &MemoryLayout) -> ChunkAllocResult {
+        if !self.fits(layout) {
+            return Err(ZAllocError::Other);
+        }
+        let descriptor = self
+            .free
+            .lock()
+            .map_err(|_| ZAllocError::Other)?
+            .pop()
+            .ok_or(ZAllocError::OutOfMemory)?;
+        let data = self.pointers[&(descriptor.segment, descriptor.chunk)] as *mut u8;
+        Ok(AllocatedChunk::new(descriptor, AtomicPtr::new(data)))
+    }
+
+    fn free(&self, chunk: &ChunkDescriptor) {
+        if !self.pointers.contains_key(&(chunk.segment, chunk.chunk)) {
+            tracing::error!(
+                "Freeing chunk {} of segment {} which does not belong to the slab",
+                chunk.chunk,
+                chunk.segment
+            );
+            return;
+        }
+        let free_chunks = match self.free.lock() {
+            Ok(mut free) => {
+                free.push(chunk.clone());
+                free.len()
+            }
+            Err(_) => return,
+        };
+        if let Some(notify) = &self.notify {
+            notify.returned(free_chunks);
+        }
+    }
+
+    fn defragment(&self) -> usize {
+        // All chunks have the same size, the slab never gets fragmented.
+        0
+    }
+
+    fn available(&self) -> usize {
+        self.free.lock().map_or(0, |free| free.len()) * self.chunk_size
+    }
+
+    fn layout_for(&self, layout: MemoryLayout) -> Result<MemoryLayout, ZLayoutError> {
+        match self.fits(&layout) {
+            true => Ok(layout),
+            false => Err(ZLayoutError::ProviderIncompatibleLayout),
+        }
+    }
+}
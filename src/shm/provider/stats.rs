@@ -0,0 +1,228 @@
+//
+// Copyright (c) 2023 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+use std::{
+    any::TypeId,
+    mem::MaybeUninit,
+    sync::{
+        atomic::{AtomicU64, AtomicUsize, Ordering},
+        Arc,
+    },
+    time::Instant,
+};
+
+use zenoh::shm::{
+    BlockOn, ChunkAllocResult, ChunkDescriptor, Defragment, GarbageCollect, MemoryLayout,
+    ShmProviderBackend, ZAllocError, ZLayoutError,
+};
+
+use super::{shm_provider::BoxedShmProvider, shm_provider_impl::available};
+use crate::{
+    result::{z_result_t, Z_EUNAVAILABLE, Z_OK},
+    transmute::RustTypeRef,
+    z_loaned_shm_provider_t,
+};
+
+/// Number of chunk size classes reported in `zc_shm_provider_stats_t`.
+pub const ZC_SHM_STATS_SIZE_CLASSES: usize = 32;
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief A snapshot of the statistics of an SHM Provider, see `zc_shm_provider_stats()`.
+///
+/// Counters are cumulative since the creation of the provider, durations are in nanoseconds.
+#[repr(C)]
+#[derive(Clone, Copy, Debug)]
+pub struct zc_shm_provider_stats_t {
+    /// Number of bytes of the chunks currently allocated, including those waiting for garbage collection.
+    pub bytes_in_use: usize,
+    /// Number of bytes available for allocation, as reported by `z_shm_provider_available()`.
+    pub bytes_available: usize,
+    /// Number of chunks currently allocated, by size class: class 0 counts chunks of 1 byte, and class `i > 0`
+    /// counts chunks of `2^(i-1) + 1` to `2^i` bytes. The last class also counts all bigger chunks.
+    pub chunks_by_size_class: [usize; ZC_SHM_STATS_SIZE_CLASSES],
+    /// Number of chunks allocated from the backend.
+    pub alloc_count: u64,
+    /// Number of chunk allocations refused by the backend because it is out of memory.
+    pub alloc_out_of_memory: u64,
+    /// Number of chunk allocations refused by the backend because its free memory is too fragmented.
+    /// A high value compared to `alloc_out_of_memory` means the provider's layout should be revised.
+    pub alloc_need_defragment: u64,
+    /// Number of chunk allocations refused by the backend for other reasons.
+    pub alloc_other_errors: u64,
+    /// Number of explicit garbage collections, with `z_shm_provider_garbage_collect()`.
+    pub gc_count: u64,
+    /// Total duration of the explicit garbage collections.
+    pub gc_ns: u64,
+    /// Number of defragmentations of the backend, either explicit or performed by allocation policies.
+    pub defrag_count: u64,
+    /// Total duration of the defragmentations of the backend.
+    pub defrag_ns: u64,
+    /// Number of blocking allocations, such as `z_shm_provider_alloc_gc_defrag_blocking()`.
+    pub blocking_alloc_count: u64,
+    /// Total duration of the blocking allocations, including their garbage collections, defragmentations
+    /// and waits for free memory.
+    pub blocking_alloc_ns: u64,
+}
+
+/// The counters of an SHM Provider, updated with relaxed atomic operations.
+#[derive(Default, Debug)]
+pub struct ShmProviderStats {
+    bytes_in_use: AtomicUsize,
+    chunks_by_size_class: [AtomicUsize; ZC_SHM_STATS_SIZE_CLASSES],
+    alloc_count: AtomicU64,
+    alloc_out_of_memory: AtomicU64,
+    alloc_need_defragment: AtomicU64,
+    alloc_other_errors: AtomicU64,
+    gc_count: AtomicU64,
+    gc_ns: AtomicU64,
+    defrag_count: AtomicU64,
+    defrag_ns: AtomicU64,
+    blocking_alloc_count: AtomicU64,
+    blocking_alloc_ns: AtomicU64,
+}
+
+fn size_class(len: usize) -> usize {
+    (len.next_power_of_two().trailing_zeros() as usize).min(ZC_SHM_STATS_SIZE_CLASSES - 1)
+}
+
+fn timed<R>(count: &AtomicU64, ns: &AtomicU64, f: impl FnOnce() -> R) -> R {
+    let start = Instant::now();
+    let result = f();
+    ns.fetch_add(start.elapsed().as_nanos() as u64, Ordering::Relaxed);
+    count.fetch_add(1, Ordering::Relaxed);
+    result
+}
+
+impl ShmProviderStats {
+    pub(crate) fn garbage_collect(&self, f: impl FnOnce() -> usize) -> usize {
+        timed(&self.gc_count, &self.gc_ns, f)
+    }
+
+    /// Runs the allocation `f` made with `Policy`, timing it if the policy blocks.
+    pub(crate) fn alloc<Policy: 'static, R>(&self, f: impl FnOnce() -> R) -> R {
+        if TypeId::of::<Policy>() == TypeId::of::<BlockOn<Defragment<GarbageCollect>>>() {
+            timed(&self.blocking_alloc_count, &self.blocking_alloc_ns, f)
+        } else {
+            f()
+        }
+    }
+
+    fn snapshot(&self, bytes_available: usize) -> zc_shm_provider_stats_t {
+        let load = |c: &AtomicU64| c.load(Ordering::Relaxed);
+        zc_shm_provider_stats_t {
+            bytes_in_use: self.bytes_in_use.load(Ordering::Relaxed),
+            bytes_available,
+            chunks_by_size_class: std::array::from_fn(|i| {
+                self.chunks_by_size_class[i].load(Ordering::Relaxed)
+            }),
+            alloc_count: load(&self.alloc_count),
+            alloc_out_of_memory: load(&self.alloc_out_of_memory),
+            alloc_need_defragment: load(&self.alloc_need_defragment),
+            alloc_other_errors: load(&self.alloc_other_errors),
+            gc_count: load(&self.gc_count),
+            gc_ns: load(&self.gc_ns),
+            defrag_count: load(&self.defrag_count),
+            defrag_ns: load(&self.defrag_ns),
+            blocking_alloc_count: load(&self.blocking_alloc_count),
+            blocking_alloc_ns: load(&self.blocking_alloc_ns),
+        }
+    }
+}
+
+/// A backend recording the allocations of `B` into `ShmProviderStats`.
+pub struct StatsBackend<B: ShmProviderBackend> {
+    inner: B,
+    stats: Arc<ShmProviderStats>,
+}
+
+impl<B: ShmProviderBackend> StatsBackend<B> {
+    pub fn new(inner: B, stats: Arc<ShmProviderStats>) -> Self {
+        Self { inner, stats }
+    }
+}
+
+impl<B: ShmProviderBackend> ShmProviderBackend for StatsBackend<B> {
+    fn alloc(&self, layout: &MemoryLayout) -> ChunkAllocResult {
+        let result = self.inner.alloc(layout);
+        let stats = &self.stats;
+        match &result {
+            Ok(chunk) => {
+                let len = chunk.descriptor.len.get();
+                stats.bytes_in_use.fetch_add(len, Ordering::Relaxed);
+                stats.chunks_by_size_class[size_class(len)].fetch_add(1, Ordering::Relaxed);
+                stats.alloc_count.fetch_add(1, Ordering::Relaxed);
+            }
+            Err(ZAllocError::OutOfMemory) => {
+                stats.alloc_out_of_memory.fetch_add(1, Ordering::Relaxed);
+            }
+            Err(ZAllocError::NeedDefragment) => {
+                stats.alloc_need_defragment.fetch_add(1, Ordering::Relaxed);
+            }
+            Err(_) => {
+                stats.alloc_other_errors.fetch_add(1, Ordering::Relaxed);
+            }
+        }
+        result
+    }
+
+    fn free(&self, chunk: &ChunkDescriptor) {
+        let len = chunk.len.get();
+        self.stats.bytes_in_use.fetch_sub(len, Ordering::Relaxed);
+        self.stats.chunks_by_size_class[size_class(len)].fetch_sub(1, Ordering::Relaxed);
+        self.inner.free(chunk);
+    }
+
+    fn defragment(&self) -> usize {
+        timed(&self.stats.defrag_count, &self.stats.defrag_ns, || {
+            self.inner.defragment()
+        })
+    }
+
+    fn available(&self) -> usize {
+        self.inner.available()
+    }
+
+    fn layout_for(&self, layout: MemoryLayout) -> Result<MemoryLayout, ZLayoutError> {
+        self.inner.layout_for(layout)
+    }
+}
+
+/// A provider whose backend is wrapped in a `StatsBackend` sharing `stats`.
+pub struct StatsShmProvider {
+    pub(crate) provider: BoxedShmProvider,
+    pub(crate) stats: Arc<ShmProviderStats>,
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Reads the statistics of an SHM Provider created with statistics, such as with
+/// `zc_posix_shm_provider_with_stats_new()`.
+///
+/// The statistics are read from atomic counters, without locking the allocator, so this is cheap enough to be
+/// called periodically. Counters are read one by one, so they may be slightly inconsistent with each other if
+/// allocations are made concurrently.
+///
+/// @return 0 in case of success, `Z_EUNAVAILABLE` if the provider does not collect statistics.
+#[no_mangle]
+pub extern "C" fn zc_shm_provider_stats(
+    provider: &z_loaned_shm_provider_t,
+    out_stats: &mut MaybeUninit<zc_shm_provider_stats_t>,
+) -> z_result_t {
+    match provider.as_rust_type_ref() {
+        super::shm_provider::CSHMProvider::Stats(p) => {
+            out_stats.write(p.stats.snapshot(available(provider)));
+            Z_OK
+        }
+        _ => Z_EUNAVAILABLE,
+    }
+}
@@ -0,0 +1,336 @@
+//
+// Copyright (c) 2023 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+use std::{
+    cell::RefCell,
+    collections::HashMap,
+    mem::MaybeUninit,
+    sync::{
+        atomic::{AtomicPtr, Ordering},
+        Arc, Mutex, Weak,
+    },
+};
+
+use zenoh::shm::{
+    AllocatedChunk, ChunkAllocResult, ChunkDescriptor, MemoryLayout, ShmProviderBackend,
+    ZLayoutError,
+};
+
+use crate::shm::common::types::{z_chunk_id_t, z_segment_id_t};
+
+/// Number of shards of the map from cached chunks to their data, so that concurrent frees rarely contend.
+const POINTER_SHARDS: usize = 64;
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Options of the per-thread allocation caches of an SHM provider.
+///
+/// Allocations are rounded up to power-of-two size classes between `min_size` and `max_size`. Each thread keeps
+/// a magazine of free chunks per size class, from which it allocates and to which it returns freed chunks without
+/// taking any lock. Magazines are exchanged with a shared depot, under a lock, only once every `magazine_size`
+/// operations, when a thread runs out of chunks or holds too many of them.
+/// Allocations bigger than `max_size` go directly to the provider backend.
+#[repr(C)]
+#[derive(Clone, Copy, Debug)]
+pub struct zc_shm_thread_cache_options_t {
+    /// Size in bytes of the smallest size class, rounded up to a power of two.
+    pub min_size: usize,
+    /// Size in bytes of the largest size class, rounded up to a power of two.
+    pub max_size: usize,
+    /// Number of chunks exchanged at once between a thread and the shared depot.
+    pub magazine_size: usize,
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs the default value for `zc_shm_thread_cache_options_t`.
+#[no_mangle]
+pub extern "C" fn zc_shm_thread_cache_options_default(
+    this: &mut MaybeUninit<zc_shm_thread_cache_options_t>,
+) {
+    this.write(zc_shm_thread_cache_options_t {
+        min_size: 64,
+        max_size: 64 * 1024,
+        magazine_size: 32,
+    });
+}
+
+struct CachedChunk {
+    descriptor: ChunkDescriptor,
+    data: *mut u8,
+}
+
+// The chunk memory is owned by the backend, the pointer is only handed out again by its allocations.
+unsafe impl Send for CachedChunk {}
+
+/// Full magazines shared by all threads, one list per size class.
+struct ThreadCacheDepot {
+    magazines: Vec<Mutex<Vec<Vec<CachedChunk>>>>,
+}
+
+type ChunkKey = (z_segment_id_t, z_chunk_id_t);
+
+/// The data pointers of the chunks allocated for a size class, since the backend only receives
+/// the descriptor of the chunks to free.
+struct ChunkPointers {
+    shards: Vec<Mutex<HashMap<ChunkKey, usize>>>,
+}
+
+impl ChunkPointers {
+    fn new() -> Self {
+        Self {
+            shards: (0..POINTER_SHARDS)
+                .map(|_| Mutex::new(HashMap::new()))
+                .collect(),
+        }
+    }
+
+    fn shard(&self, key: &ChunkKey) -> &Mutex<HashMap<ChunkKey, usize>> {
+        &self.shards[(key.0 as usize ^ key.1 as usize) % POINTER_SHARDS]
+    }
+
+    fn insert(&self, descriptor: &ChunkDescriptor, data: *mut u8) {
+        let key = (descriptor.segment, descriptor.chunk);
+        if let Ok(mut shard) = self.shard(&key).lock() {
+            shard.insert(key, data as usize);
+        }
+    }
+
+    fn get(&self, descriptor: &ChunkDescriptor) -> Option<*mut u8> {
+        let key = (descriptor.segment, descriptor.chunk);
+        let shard = self.shard(&key).lock().ok()?;
+        shard.get(&key).map(|data| *data as *mut u8)
+    }
+
+    fn remove(&self, descriptor: &ChunkDescriptor) {
+        let key = (descriptor.segment, descriptor.chunk);
+        if let Ok(mut shard) = self.shard(&key).lock() {
+            shard.remove(&key);
+        }
+    }
+}
+
+/// The magazines of one thread for one backend.
+struct ThreadCache {
+    depot: Weak<ThreadCacheDepot>,
+    classes: Vec<Vec<CachedChunk>>,
+}
+
+impl Drop for ThreadCache {
+    fn drop(&mut self) {
+        // Do not lose the chunks held by an exiting thread.
+        if let Some(depot) = self.depot.upgrade() {
+            for (class, chunks) in self.classes.drain(..).enumerate() {
+                if !chunks.is_empty() {
+                    if let Ok(mut magazines) = depot.magazines[class].lock() {
+                        magazines.push(chunks);
+                    }
+                }
+            }
+        }
+    }
+}
+
+thread_local! {
+    static THREAD_CACHES: RefCell<Vec<ThreadCache>> = const { RefCell::new(Vec::new()) };
+}
+
+/// A backend caching the chunks of `B` in per-thread magazines.
+pub struct ThreadCacheBackend<B: ShmProviderBackend> {
+    inner: B,
+    depot: Arc<ThreadCacheDepot>,
+    pointers: ChunkPointers,
+    min_class_log2: u32,
+    magazine_size: usize,
+}
+
+impl<B: ShmProviderBackend> ThreadCacheBackend<B> {
+    pub fn new(inner: B, options: &zc_shm_thread_cache_options_t) -> Self {
+        let min_class_log2 = options.min_size.max(1).next_power_of_two().trailing_zeros();
+        let max_class_log2 = options
+            .max_size
+            .max(1)
+            .next_power_of_two()
+            .trailing_zeros()
+            .max(min_class_log2);
+        let depot = ThreadCacheDepot {
+            magazines: (min_class_log2..=max_class_log2)
+                .map(|_| Mutex::new(Vec::new()))
+                .collect(),
+        };
+        Self {
+            inner,
+            depot: Arc::new(depot),
+            pointers: ChunkPointers::new(),
+            min_class_log2,
+            magazine_size: options.magazine_size.max(1),
+        }
+    }
+
+    fn class_of(&self, size: usize) -> Option<usize> {
+        let log2 = size
+            .next_power_of_two()
+            .trailing_zeros()
+            .max(self.min_class_log2);
+        let class = (log2 - self.min_class_log2) as usize;
+        (class < self.depot.magazines.len()).then_some(class)
+    }
+
+    fn class_size(&self, class: usize) -> usize {
+        1 << (class as u32 + self.min_class_log2)
+    }
+
+    fn with_thread_cache<R>(&self, f: impl FnOnce(&mut ThreadCache) -> R) -> Option<R> {
+        THREAD_CACHES
+            .try_with(|caches| {
+                let mut caches = caches.borrow_mut();
+                let pos = match caches
+                    .iter()
+                    .position(|c| std::ptr::eq(c.depot.as_ptr(), Arc::as_ptr(&self.depot)))
+                {
+                    Some(pos) => pos,
+                    None => {
+                        caches.retain(|c| c.depot.strong_count() > 0);
+                        caches.push(ThreadCache {
+                            depot: Arc::downgrade(&self.depot),
+                            classes: (0..self.depot.magazines.len())
+                                .map(|_| Vec::new())
+                                .collect(),
+                        });
+                        caches.len() - 1
+                    }
+                };
+                f(&mut caches[pos])
+            })
+            .ok()
+    }
+
+    fn pop(&self, class: usize, alignment: usize) -> Option<CachedChunk> {
+        self.with_thread_cache(|cache| {
+            let chunks = &mut cache.classes[class];
+            if chunks.is_empty() {
+                if let Some(magazine) = self.depot.magazines[class]
+                    .lock()
+                    .ok()
+                    .and_then(|mut m| m.pop())
+                {
+                    *chunks = magazine;
+                }
+            }
+            match chunks.last() {
+                Some(chunk) if chunk.data as usize % alignment == 0 => chunks.pop(),
+                _ => None,
+            }
+        })
+        .flatten()
+    }
+
+    fn push(&self, class: usize, chunk: CachedChunk) -> Result<(), CachedChunk> {
+        let mut chunk = Some(chunk);
+        self.with_thread_cache(|cache| {
+            let chunks = &mut cache.classes[class];
+            chunks.push(chunk.take().unwrap());
+            if chunks.len() >= 2 * self.magazine_size {
+                let magazine = chunks.split_off(self.magazine_size);
+                if let Ok(mut magazines) = self.depot.magazines[class].lock() {
+                    magazines.push(magazine);
+                }
+            }
+        });
+        chunk.map_or(Ok(()), Err)
+    }
+
+    fn free_inner(&self, descriptor: &ChunkDescriptor) {
+        self.pointers.remove(descriptor);
+        self.inner.free(descriptor);
+    }
+
+    /// Returns all chunks of the depot to the inner backend.
+    fn flush_depot(&self) {
+        for magazines in &self.depot.magazines {
+            let drained = match magazines.lock() {
+                Ok(mut m) => std::mem::take(&mut *m),
+                Err(_) => continue,
+            };
+            for chunk in drained.into_iter().flatten() {
+                self.free_inner(&chunk.descriptor);
+            }
+        }
+    }
+}
+
+impl<B: ShmProviderBackend> Drop for ThreadCacheBackend<B> {
+    fn drop(&mut self) {
+        let _ = self.with_thread_cache(|cache| {
+            for chunk in cache.classes.drain(..).flatten() {
+                self.free_inner(&chunk.descriptor);
+            }
+        });
+        self.flush_depot();
+    }
+}
+
+impl<B: ShmProviderBackend> ShmProviderBackend for ThreadCacheBackend<B> {
+    fn alloc(&self, layout: &MemoryLayout) -> ChunkAllocResult {
+        let size: usize = layout.size().into();
+        let alignment = layout.alignment();
+        let Some(class) = self.class_of(size) else {
+            return self.inner.alloc(layout);
+        };
+        if let Some(chunk) = self.pop(class, alignment.get_alignment_value().get()) {
+            return Ok(AllocatedChunk::new(
+                chunk.descriptor,
+                AtomicPtr::new(chunk.data),
+            ));
+        }
+        let chunk = match MemoryLayout::new(self.class_size(class), alignment) {
+            Ok(class_layout) => self.inner.alloc(&class_layout)?,
+            Err(_) => return self.inner.alloc(layout),
+        };
+        self.pointers
+            .insert(&chunk.descriptor, chunk.data.load(Ordering::Relaxed));
+        Ok(chunk)
+    }
+
+    fn free(&self, chunk: &ChunkDescriptor) {
+        // Only the chunks allocated for a size class are cached.
+        let cached = self
+            .class_of(chunk.len.get())
+            .filter(|class| self.class_size(*class) == chunk.len.get())
+            .and_then(|class| Some((class, self.pointers.get(chunk)?)));
+        match cached {
+            Some((class, data)) => {
+                let cached = CachedChunk {
+                    descriptor: chunk.clone(),
+                    data,
+                };
+                if let Err(chunk) = self.push(class, cached) {
+                    self.free_inner(&chunk.descriptor);
+                }
+            }
+            None => self.inner.free(chunk),
+        }
+    }
+
+    fn defragment(&self) -> usize {
+        self.flush_depot();
+        self.inner.defragment()
+    }
+
+    fn available(&self) -> usize {
+        self.inner.available()
+    }
+
+    fn layout_for(&self, layout: MemoryLayout) -> Result<MemoryLayout, ZLayoutError> {
+        self.inner.layout_for(layout)
+    }
+}
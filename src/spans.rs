@@ -0,0 +1,173 @@
+//
+// Copyright (c) 2024 ZettaScale Technology.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh team, <zenoh@zettascale.tech>
+//
+
+use std::{
+    cell::Cell,
+    sync::{
+        atomic::{AtomicU32, Ordering},
+        Arc, RwLock,
+    },
+    time::{Instant, SystemTime, UNIX_EPOCH},
+};
+
+use lazy_static::lazy_static;
+use zenoh::time::Timestamp;
+
+use crate::{
+    result, transmute::TakeRustType, zc_closure_span_call, zc_closure_span_loan,
+    zc_moved_closure_span_t, zc_owned_closure_span_t,
+};
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief The operation timed by a span.
+#[repr(C)]
+#[derive(Clone, Copy, PartialEq, Eq)]
+pub enum zc_span_kind_t {
+    /// A put or delete through a publisher, from the call until the message is enqueued for transmission.
+    PUT = 0,
+    /// A sample received by a subscriber, from the entry to the exit of its callback.
+    SAMPLE_CALLBACK = 1,
+    /// A query received by a queryable, from the entry to the exit of its callback. For queryables with worker
+    /// threads, the time to dispatch the query to a worker.
+    QUERY_CALLBACK = 2,
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief The timing of a sampled message.
+#[repr(C)]
+#[derive(Clone, Copy)]
+pub struct zc_span_t {
+    /// The timed operation.
+    pub kind: zc_span_kind_t,
+    /// The id of the publisher, subscriber or queryable in its session, see `z_entity_global_id_eid()`.
+    pub entity_id: u32,
+    /// The time the operation started, in nanoseconds since the UNIX epoch.
+    pub start_ns: u64,
+    /// The duration of the operation in nanoseconds.
+    pub duration_ns: u64,
+    /// The size of the payload of the message.
+    pub payload_len: u64,
+    /// The timestamp of a received sample, in nanoseconds since the UNIX epoch, 0 if it has none.
+    /// `start_ns - source_timestamp_ns` is the transit time of the sample when the clocks of both ends are synchronized.
+    pub source_timestamp_ns: u64,
+}
+
+// 0 when spans are disabled, so that the unsampled path costs a single relaxed load.
+static SAMPLE_INTERVAL: AtomicU32 = AtomicU32::new(0);
+
+lazy_static! {
+    static ref SPAN_CALLBACK: RwLock<Option<Arc<zc_owned_closure_span_t>>> = RwLock::new(None);
+}
+
+thread_local! {
+    static SAMPLE_COUNTDOWN: Cell<u32> = const { Cell::new(0) };
+}
+
+pub(crate) fn unix_ns(t: SystemTime) -> u64 {
+    t.duration_since(UNIX_EPOCH)
+        .map_or(0, |d| d.as_nanos() as u64)
+}
+
+/// A span being timed, only started for sampled messages.
+pub(crate) struct Span {
+    start: SystemTime,
+    instant: Instant,
+}
+
+impl Span {
+    /// Starts a span if the current message is sampled, i.e. once every `sample_interval` messages of the thread.
+    #[inline]
+    pub(crate) fn start() -> Option<Span> {
+        let interval = SAMPLE_INTERVAL.load(Ordering::Relaxed);
+        if interval == 0 {
+            return None;
+        }
+        let sampled = SAMPLE_COUNTDOWN.with(|c| match c.get() {
+            0 => {
+                c.set(interval - 1);
+                true
+            }
+            n => {
+                c.set(n - 1);
+                false
+            }
+        });
+        sampled.then(|| Span {
+            start: SystemTime::now(),
+            instant: Instant::now(),
+        })
+    }
+
+    pub(crate) fn end(
+        self,
+        kind: zc_span_kind_t,
+        entity_id: u32,
+        payload_len: usize,
+        source_timestamp: Option<&Timestamp>,
+    ) {
+        let span = zc_span_t {
+            kind,
+            entity_id,
+            start_ns: unix_ns(self.start),
+            duration_ns: self.instant.elapsed().as_nanos() as u64,
+            payload_len: payload_len as u64,
+            source_timestamp_ns: source_timestamp
+                .map_or(0, |t| unix_ns(t.get_time().to_system_time())),
+        };
+        let callback = SPAN_CALLBACK
+            .read()
+            .unwrap_or_else(|e| e.into_inner())
+            .clone();
+        if let Some(callback) = callback {
+            zc_closure_span_call(zc_closure_span_loan(&callback), &span);
+        }
+    }
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Starts delivering the timing spans of one in `sample_interval` messages to `callback`.
+///
+/// Spans are reported for the puts of publishers and the callbacks of subscribers and queryables, the messages being
+/// sampled independently on each thread. Their fields are numeric, so that no formatting takes place on the sampled
+/// path, and they are delivered synchronously from the thread which handled the message, so `callback` should return
+/// quickly. A previously set callback is replaced, and dropped once its last call has returned.
+///
+/// @param sample_interval: The number of messages per sampled message, 1 reports a span for every message.
+/// @param callback: The closure receiving the spans.
+/// @return 0 in case of success, `Z_EINVAL` if `sample_interval` is 0.
+#[no_mangle]
+pub extern "C" fn zc_init_spans_with_callback(
+    sample_interval: u32,
+    callback: &mut zc_moved_closure_span_t,
+) -> result::z_result_t {
+    let callback = callback.take_rust_type();
+    if sample_interval == 0 {
+        return result::Z_EINVAL;
+    }
+    *SPAN_CALLBACK.write().unwrap_or_else(|e| e.into_inner()) = Some(Arc::new(callback));
+    SAMPLE_INTERVAL.store(sample_interval, Ordering::Relaxed);
+    result::Z_OK
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Stops delivering timing spans, dropping the callback once its last call has returned.
+#[no_mangle]
+pub extern "C" fn zc_stop_spans() {
+    SAMPLE_INTERVAL.store(0, Ordering::Relaxed);
+    let callback = SPAN_CALLBACK
+        .write()
+        .unwrap_or_else(|e| e.into_inner())
+        .take();
+    std::mem::drop(callback);
+}
@@ -13,6 +13,15 @@
 //
 
 use std::mem::MaybeUninit;
+#[cfg(feature = "unstable")]
+use std::{
+    collections::hash_map::DefaultHasher,
+    hash::{Hash, Hasher},
+    sync::Arc,
+};
+
+#[cfg(feature = "unstable")]
+use libc::c_void;
 
 use zenoh::{
     handlers::Callback,
@@ -22,14 +31,24 @@ use zenoh::{
 };
 
 pub use crate::opaque_types::{z_loaned_subscriber_t, z_moved_subscriber_t, z_owned_subscriber_t};
+#[cfg(feature = "unstable")]
+use crate::{
+    deferred::Deferred,
+    delta::DeltaDecoder,
+    entity_stats::{EntityKind, EntityStats},
+    platform::ShardedWorkers,
+    transmute::IntoCType,
+    watchdog::Isolation,
+    z_entity_global_id_t, z_loaned_executor_t, z_loaned_sample_t, zc_locality_default,
+    zc_locality_t,
+};
 use crate::{
     keyexpr::*,
     result,
     transmute::{LoanedCTypeRef, RustTypeRef, RustTypeRefUninit, TakeRustType},
     z_closure_sample_call, z_closure_sample_loan, z_loaned_session_t, z_moved_closure_sample_t,
+    z_owned_closure_sample_t,
 };
-#[cfg(feature = "unstable")]
-use crate::{transmute::IntoCType, z_entity_global_id_t, zc_locality_default, zc_locality_t};
 
 decl_c_type!(
     owned(z_owned_subscriber_t, option Subscriber<()>),
@@ -64,6 +83,43 @@ pub struct z_subscriber_options_t {
     /// Restricts the matching publications that will be received by this Subscribers to the ones
     /// that have the compatible allowed_destination.
     pub allowed_origin: zc_locality_t,
+    /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+    /// @brief The number of dedicated worker threads running the subscriber callback. If 0 (default), the callback is
+    /// run inline on the zenoh runtime thread which received the sample.
+    ///
+    /// Samples on the same key expression are always dispatched to the same worker, so that they are delivered in
+    /// order, while samples on different key expressions are delivered in parallel. The callback must therefore
+    /// support being called concurrently. It is dropped by the last worker, once the samples queued before the
+    /// undeclaration of the subscriber are delivered.
+    ///
+    /// The workers replace the delivery through `zc_session_poll()` of sessions with deferred callbacks.
+    #[cfg(feature = "unstable")]
+    pub worker_threads: usize,
+    /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+    /// @brief The maximal number of samples waiting for each worker thread, ignored if `worker_threads` is 0.
+    /// A sample received while the queue of its worker is full is dropped, and counted as rejected in the statistics
+    /// of the subscriber.
+    #[cfg(feature = "unstable")]
+    pub worker_queue_size: usize,
+    /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+    /// @brief If ``true``, samples are dispatched to the workers by source id (see `z_source_info_id()`) rather than by
+    /// key expression, so that the samples of each publisher are delivered in order. Samples without a source id are
+    /// still dispatched by key expression.
+    #[cfg(feature = "unstable")]
+    pub worker_shard_by_source: bool,
+    /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+    /// @brief The executor running the workers, ignored if `worker_threads` is 0. If NULL (default), each worker is a
+    /// dedicated thread. Otherwise `worker_threads` is the number of workers run by the executor, each of them
+    /// delivering its samples in order, and the executor is kept until the subscriber is dropped.
+    #[cfg(feature = "unstable")]
+    pub worker_executor: Option<&'static z_loaned_executor_t>,
+    /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+    /// @brief If ``true``, the payloads of the publishers in delta mode (see `zc_publisher_delta_options_t`) are rebuilt
+    /// before the callback runs, the samples being delivered with their full payload and original encoding. The last
+    /// keyframe of each publisher is kept until the subscriber is dropped, and the deltas of a missed keyframe are
+    /// dropped. Other samples are delivered as they are.
+    #[cfg(feature = "unstable")]
+    pub delta_decoding: bool,
 }
 
 impl Default for z_subscriber_options_t {
@@ -73,6 +129,16 @@ impl Default for z_subscriber_options_t {
             _0: Default::default(),
             #[cfg(feature = "unstable")]
             allowed_origin: zc_locality_default(),
+            #[cfg(feature = "unstable")]
+            worker_threads: 0,
+            #[cfg(feature = "unstable")]
+            worker_queue_size: 256,
+            #[cfg(feature = "unstable")]
+            worker_shard_by_source: false,
+            #[cfg(feature = "unstable")]
+            worker_executor: None,
+            #[cfg(feature = "unstable")]
+            delta_decoding: false,
         }
     }
 }
@@ -83,28 +149,148 @@ pub extern "C" fn z_subscriber_options_default(this_: &mut MaybeUninit<z_subscri
     this_.write(z_subscriber_options_t::default());
 }
 
+#[cfg(feature = "unstable")]
+fn deliver_sample(stats: &EntityStats, callback: &z_owned_closure_sample_t, mut sample: Sample) {
+    let (len, timestamp) = (sample.payload().len(), sample.timestamp().copied());
+    stats.received(len, timestamp.as_ref(), || {
+        z_closure_sample_call(
+            z_closure_sample_loan(callback),
+            sample.as_loaned_c_type_mut(),
+        )
+    })
+}
+
+/// The hash selecting the worker delivering a sample.
+#[cfg(feature = "unstable")]
+fn _sample_worker_hash(sample: &Sample, by_source: bool) -> u64 {
+    let mut hasher = DefaultHasher::new();
+    match sample.source_info().source_id() {
+        Some(id) if by_source => id.hash(&mut hasher),
+        _ => sample.key_expr().as_str().hash(&mut hasher),
+    }
+    hasher.finish()
+}
+
+/// Starts `threads` workers delivering the samples to `callback`, returns the function dispatching the samples to them.
+///
+/// The workers exit once the returned function is dropped (i.e. when the subscriber is undeclared) and their queue
+/// is drained, the last one dropping `callback`.
+#[cfg(feature = "unstable")]
+fn _sample_worker_pool(
+    callback: Arc<z_owned_closure_sample_t>,
+    threads: usize,
+    queue_size: usize,
+    by_source: bool,
+    executor: Option<&z_loaned_executor_t>,
+    stats: Arc<EntityStats>,
+) -> std::io::Result<impl Fn(Sample) + Send + Sync + 'static> {
+    let workers = {
+        let stats = stats.clone();
+        ShardedWorkers::new(
+            "zc-subscriber-worker",
+            threads,
+            queue_size,
+            executor,
+            move |sample| deliver_sample(&stats, &callback, sample),
+        )?
+    };
+    Ok(move |sample: Sample| {
+        let hash = _sample_worker_hash(&sample, by_source);
+        if workers.try_send(hash, sample).is_err() {
+            stats.rejected();
+        }
+    })
+}
+
 #[allow(unused_variables, unused_mut)]
 pub(crate) fn _declare_subscriber_inner<'a, 'b>(
     session: &'a z_loaned_session_t,
     key_expr: &'b z_loaned_keyexpr_t,
-    callback: &mut z_moved_closure_sample_t,
+    callback: z_owned_closure_sample_t,
     options: Option<&mut z_subscriber_options_t>,
+    #[cfg(feature = "unstable")] stats: Arc<EntityStats>,
 ) -> SubscriberBuilder<'a, 'b, Callback<Sample>> {
     let session = session.as_rust_type_ref();
     let key_expr = key_expr.as_rust_type_ref();
-    let callback = callback.take_rust_type();
-    let mut subscriber = session
+    #[cfg(not(feature = "unstable"))]
+    let subscriber = session
         .declare_subscriber(key_expr)
-        .callback(move |sample| {
-            let mut owned_sample = Some(sample);
-            z_closure_sample_call(z_closure_sample_loan(&callback), unsafe {
-                owned_sample
-                    .as_mut()
-                    .unwrap_unchecked()
-                    .as_loaned_c_type_mut()
-            })
+        .callback(move |mut sample| {
+            z_closure_sample_call(
+                z_closure_sample_loan(&callback),
+                sample.as_loaned_c_type_mut(),
+            )
         });
     #[cfg(feature = "unstable")]
+    let mut subscriber = 'subscriber: {
+        let callback = Arc::new(callback);
+        // The samples are decoded as they are received, so that deltas are applied in order.
+        let decoder = options
+            .as_deref()
+            .filter(|o| o.delta_decoding)
+            .map(|_| DeltaDecoder::default());
+        let decode = move |sample: Sample| match &decoder {
+            Some(decoder) => decoder.decode(sample),
+            None => Some(sample),
+        };
+        if let Some(options) = options.as_deref().filter(|o| o.worker_threads > 0) {
+            match _sample_worker_pool(
+                callback.clone(),
+                options.worker_threads,
+                options.worker_queue_size,
+                options.worker_shard_by_source,
+                options.worker_executor,
+                stats.clone(),
+            ) {
+                Ok(dispatch) => {
+                    break 'subscriber session.declare_subscriber(key_expr).callback(
+                        move |sample| {
+                            if let Some(sample) = decode(sample) {
+                                dispatch(sample)
+                            }
+                        },
+                    )
+                }
+                Err(e) => tracing::error!(
+                    "Failed to spawn subscriber worker threads, delivering samples inline: {}",
+                    e
+                ),
+            }
+        }
+        let isolation = Isolation::default();
+        let deferred = Deferred::of_session(session.zid());
+        session
+            .declare_subscriber(key_expr)
+            .callback(move |sample| {
+                let Some(sample) = decode(sample) else {
+                    return;
+                };
+                if let Some(deferred) = &deferred {
+                    // The closure is dropped with the subscriber, even if some of its samples are still queued.
+                    let (stats, callback) = (stats.clone(), Arc::downgrade(&callback));
+                    deferred.defer(move || {
+                        if let Some(callback) = callback.upgrade() {
+                            deliver_sample(&stats, &callback, sample)
+                        }
+                    });
+                    return;
+                }
+                if let Some(queue) = isolation.sender() {
+                    if queue.try_send(sample).is_err() {
+                        stats.rejected();
+                    }
+                    return;
+                }
+                deliver_sample(&stats, &callback, sample);
+                if stats.callbacks().is_slow() {
+                    let (stats, callback) = (stats.clone(), callback.clone());
+                    isolation.isolate(format!("zc-sub-{}", stats.eid()), move |sample| {
+                        deliver_sample(&stats, &callback, sample)
+                    });
+                }
+            })
+    };
+    #[cfg(feature = "unstable")]
     if let Some(options) = options {
         subscriber = subscriber.allowed_origin(options.allowed_origin.into());
     }
@@ -129,9 +315,20 @@ pub extern "C" fn z_declare_subscriber(
     options: Option<&mut z_subscriber_options_t>,
 ) -> result::z_result_t {
     let this = subscriber.as_rust_type_mut_uninit();
-    let s = _declare_subscriber_inner(session, key_expr, callback, options);
+    #[cfg(feature = "unstable")]
+    let stats = EntityStats::new(session.as_rust_type_ref().zid(), EntityKind::Subscriber);
+    let s = _declare_subscriber_inner(
+        session,
+        key_expr,
+        callback.take_rust_type(),
+        options,
+        #[cfg(feature = "unstable")]
+        stats.clone(),
+    );
     match s.wait() {
         Ok(sub) => {
+            #[cfg(feature = "unstable")]
+            stats.register(sub.id());
             this.write(Some(sub));
             result::Z_OK
         }
@@ -159,7 +356,14 @@ pub extern "C" fn z_declare_background_subscriber(
     callback: &mut z_moved_closure_sample_t,
     options: Option<&mut z_subscriber_options_t>,
 ) -> result::z_result_t {
-    let subscriber = _declare_subscriber_inner(session, key_expr, callback, options);
+    let subscriber = _declare_subscriber_inner(
+        session,
+        key_expr,
+        callback.take_rust_type(),
+        options,
+        #[cfg(feature = "unstable")]
+        EntityStats::new(session.as_rust_type_ref().zid(), EntityKind::Subscriber),
+    );
     match subscriber.background().wait() {
         Ok(_) => result::Z_OK,
         Err(e) => {
@@ -169,6 +373,96 @@ pub extern "C" fn z_declare_background_subscriber(
     }
 }
 
+#[cfg(feature = "unstable")]
+extern "C" fn _shared_closure_sample_call(sample: &mut z_loaned_sample_t, context: *mut c_void) {
+    let callback = unsafe { &*(context as *const z_owned_closure_sample_t) };
+    z_closure_sample_call(z_closure_sample_loan(callback), sample);
+}
+
+#[cfg(feature = "unstable")]
+extern "C" fn _shared_closure_sample_drop(context: *mut c_void) {
+    std::mem::drop(unsafe { Arc::from_raw(context as *const z_owned_closure_sample_t) });
+}
+
+/// A closure forwarding to a closure shared by several subscribers, which is dropped with the last of them.
+#[cfg(feature = "unstable")]
+fn _shared_closure_sample(callback: &Arc<z_owned_closure_sample_t>) -> z_owned_closure_sample_t {
+    z_owned_closure_sample_t {
+        _context: Arc::into_raw(callback.clone()) as *mut c_void,
+        _call: Some(_shared_closure_sample_call),
+        _drop: Some(_shared_closure_sample_drop),
+    }
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs and declares several subscribers at once, delivering the samples of all of them to a single
+/// callback.
+///
+/// This is a convenience loop over `z_declare_subscriber()`: the subscribers are declared one by one, sending the same
+/// declaration messages, so neither the number of messages nor the number of round trips is reduced. The function
+/// returns once all subscribers are declared. The callback is dropped once all subscribers are undeclared. The key
+/// expression of a sample tells which subscriber received it.
+///
+/// @param session: The zenoh session.
+/// @param subscribers: An array of `len` uninitialized locations in memory, where the subscribers will be constructed.
+/// @param key_exprs: An array of `len` key expressions to subscribe.
+/// @param len: The number of subscribers.
+/// @param callback: The callback function that will be called each time a sample is received by any of the subscribers.
+/// @param options: The options applied to all subscribers.
+///
+/// @return 0 in case of success, negative error code otherwise. In this case, the subscribers which were already
+/// declared are undeclared, and all subscribers are in their gravestone state.
+#[cfg(feature = "unstable")]
+#[allow(clippy::missing_safety_doc)]
+#[no_mangle]
+pub unsafe extern "C" fn zc_declare_subscribers(
+    session: &z_loaned_session_t,
+    subscribers: *mut MaybeUninit<z_owned_subscriber_t>,
+    key_exprs: *const &z_loaned_keyexpr_t,
+    len: usize,
+    callback: &mut z_moved_closure_sample_t,
+    options: Option<&mut z_subscriber_options_t>,
+) -> result::z_result_t {
+    let callback = Arc::new(callback.take_rust_type());
+    if (subscribers.is_null() || key_exprs.is_null()) && len > 0 {
+        tracing::error!("Subscribers and key expressions arrays should not be null");
+        return result::Z_EINVAL;
+    }
+    let mut options = options;
+    let mut declared = Vec::with_capacity(len);
+    let mut res = result::Z_OK;
+    for i in 0..len {
+        let stats = EntityStats::new(session.as_rust_type_ref().zid(), EntityKind::Subscriber);
+        let subscriber = _declare_subscriber_inner(
+            session,
+            *key_exprs.add(i),
+            _shared_closure_sample(&callback),
+            options.as_deref_mut(),
+            stats.clone(),
+        );
+        match subscriber.wait() {
+            Ok(sub) => {
+                stats.register(sub.id());
+                declared.push(sub);
+            }
+            Err(e) => {
+                tracing::error!("Failed to declare subscriber {}: {}", i, e);
+                res = result::Z_EGENERIC;
+                break;
+            }
+        }
+    }
+    if res != result::Z_OK {
+        declared.clear();
+    }
+    let subscribers = std::slice::from_raw_parts_mut(subscribers, len);
+    let mut declared = declared.into_iter();
+    for s in subscribers {
+        s.as_rust_type_mut_uninit().write(declared.next());
+    }
+    res
+}
+
 /// Returns the key expression of the subscriber.
 #[no_mangle]
 #[allow(clippy::missing_safety_doc)]
@@ -0,0 +1,281 @@
+//
+// Copyright (c) 2024 ZettaScale Technology.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh team, <zenoh@zettascale.tech>
+//
+
+use std::{
+    mem::MaybeUninit,
+    sync::{
+        atomic::{AtomicBool, AtomicU64, AtomicUsize, Ordering},
+        mpsc::{sync_channel, SyncSender},
+        Arc, OnceLock, RwLock,
+    },
+    time::{Duration, Instant, SystemTime},
+};
+
+use lazy_static::lazy_static;
+use zenoh::{session::EntityGlobalId, time::Timestamp};
+
+use crate::{
+    entity_stats::find_entity_stats,
+    result,
+    spans::{unix_ns, zc_span_kind_t, zc_span_t},
+    transmute::{RustTypeRef, TakeRustType},
+    z_loaned_queryable_t, z_loaned_subscriber_t, zc_closure_span_call, zc_closure_span_loan,
+    zc_moved_closure_span_t, zc_owned_closure_span_t,
+};
+
+const HISTOGRAM_BUCKETS: usize = 32;
+// The upper bound of the first bucket is 2^HISTOGRAM_SHIFT ns.
+const HISTOGRAM_SHIFT: u32 = 10;
+
+// 0 when the watchdog is disabled, so that callbacks are not timed.
+static THRESHOLD_NS: AtomicU64 = AtomicU64::new(0);
+static ISOLATION_QUEUE_SIZE: AtomicUsize = AtomicUsize::new(0);
+
+lazy_static! {
+    static ref WATCHDOG_CALLBACK: RwLock<Option<Arc<zc_owned_closure_span_t>>> = RwLock::new(None);
+}
+
+/// The durations of the callbacks of an entity, timed while the watchdog is enabled.
+#[derive(Default)]
+pub(crate) struct CallbackHistogram {
+    buckets: [AtomicU64; HISTOGRAM_BUCKETS],
+    // Set once a callback exceeded the threshold.
+    slow: AtomicBool,
+}
+
+impl CallbackHistogram {
+    fn record(&self, ns: u64) {
+        let bucket = (u64::BITS - (ns >> HISTOGRAM_SHIFT).leading_zeros()) as usize;
+        self.buckets[bucket.min(HISTOGRAM_BUCKETS - 1)].fetch_add(1, Ordering::Relaxed);
+    }
+
+    pub(crate) fn snapshot(&self) -> zc_callback_histogram_t {
+        let mut histogram = zc_callback_histogram_t::default();
+        for (b, c) in histogram.buckets.iter_mut().zip(self.buckets.iter()) {
+            *b = c.load(Ordering::Relaxed);
+        }
+        histogram
+    }
+
+    /// Returns `true` if a callback of the entity exceeded the threshold of the watchdog.
+    pub(crate) fn is_slow(&self) -> bool {
+        self.slow.load(Ordering::Relaxed)
+    }
+}
+
+/// A callback being timed, only started while the watchdog is enabled.
+pub(crate) struct Watch {
+    start: Instant,
+    threshold: Duration,
+}
+
+impl Watch {
+    #[inline]
+    pub(crate) fn start() -> Option<Watch> {
+        match THRESHOLD_NS.load(Ordering::Relaxed) {
+            0 => None,
+            ns => Some(Watch {
+                start: Instant::now(),
+                threshold: Duration::from_nanos(ns),
+            }),
+        }
+    }
+
+    /// Records the duration of the callback, reporting it to the watchdog callback if it exceeded the threshold.
+    pub(crate) fn end(
+        self,
+        histogram: &CallbackHistogram,
+        kind: zc_span_kind_t,
+        entity_id: u32,
+        payload_len: usize,
+        source_timestamp: Option<&Timestamp>,
+    ) {
+        let duration = self.start.elapsed();
+        histogram.record(duration.as_nanos() as u64);
+        if duration < self.threshold {
+            return;
+        }
+        histogram.slow.store(true, Ordering::Relaxed);
+        let callback = WATCHDOG_CALLBACK
+            .read()
+            .unwrap_or_else(|e| e.into_inner())
+            .clone();
+        if let Some(callback) = callback {
+            let span = zc_span_t {
+                kind,
+                entity_id,
+                start_ns: unix_ns(SystemTime::now() - duration),
+                duration_ns: duration.as_nanos() as u64,
+                payload_len: payload_len as u64,
+                source_timestamp_ns: source_timestamp
+                    .map_or(0, |t| unix_ns(t.get_time().to_system_time())),
+            };
+            zc_closure_span_call(zc_closure_span_loan(&callback), &span);
+        }
+    }
+}
+
+/// The isolated delivery thread of a subscriber, started once one of its callbacks was too slow.
+pub(crate) struct Isolation<T> {
+    sender: OnceLock<Option<SyncSender<T>>>,
+}
+
+impl<T> Default for Isolation<T> {
+    fn default() -> Self {
+        Self {
+            sender: OnceLock::new(),
+        }
+    }
+}
+
+impl<T: Send + 'static> Isolation<T> {
+    /// The queue of the isolated thread, if it is started.
+    #[inline]
+    pub(crate) fn sender(&self) -> Option<&SyncSender<T>> {
+        self.sender.get().and_then(Option::as_ref)
+    }
+
+    /// Starts a thread delivering the messages pushed to `sender()` to `f`, if isolation is enabled.
+    /// The thread stops once the queue is dropped and the messages it holds are delivered.
+    pub(crate) fn isolate(&self, name: String, mut f: impl FnMut(T) + Send + 'static) {
+        let capacity = ISOLATION_QUEUE_SIZE.load(Ordering::Relaxed);
+        if capacity == 0 {
+            return;
+        }
+        self.sender.get_or_init(|| {
+            let (tx, rx) = sync_channel(capacity);
+            let thread = std::thread::Builder::new().name(name).spawn(move || {
+                while let Ok(t) = rx.recv() {
+                    f(t)
+                }
+            });
+            match thread {
+                Ok(_) => Some(tx),
+                Err(e) => {
+                    tracing::error!("Failed to start an isolated delivery thread: {}", e);
+                    None
+                }
+            }
+        });
+    }
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief The distribution of the durations of the callbacks of a subscriber or a queryable.
+#[repr(C)]
+#[derive(Default, Clone, Copy)]
+pub struct zc_callback_histogram_t {
+    /// The number of callbacks per duration: `buckets[0]` counts the callbacks which took less than 1024 ns,
+    /// `buckets[i]` the ones which took between `2^(9+i)` and `2^(10+i)` ns, and the last bucket all longer ones.
+    pub buckets: [u64; HISTOGRAM_BUCKETS],
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Starts timing the callbacks of all subscribers and queryables, reporting the ones taking `threshold_ns`
+/// or longer to `callback`.
+///
+/// Each slow callback is reported with a span of kind `ZC_SPAN_KIND_SAMPLE_CALLBACK` or `ZC_SPAN_KIND_QUERY_CALLBACK`,
+/// synchronously from the thread which called it, so `callback` should return quickly. While the watchdog is enabled,
+/// the durations of the callbacks of each entity are recorded, see `zc_subscriber_get_callback_histogram()`.
+///
+/// If `isolation_queue_size` is not 0, a subscriber whose callback was reported is switched to a dedicated delivery
+/// thread, so that it no longer stalls the zenoh runtime threads shared with the other entities of the session.
+/// Samples are passed to this thread through a queue of `isolation_queue_size` samples, and are dropped when the
+/// queue is full. The closure of an isolated subscriber is dropped by its delivery thread, once the samples queued
+/// before its undeclaration are delivered.
+///
+/// A previously set callback is replaced, and dropped once its last call has returned.
+///
+/// @param threshold_ns: The duration from which a callback is reported, in nanoseconds.
+/// @param isolation_queue_size: The capacity of the queue of isolated subscribers, 0 to never isolate subscribers.
+/// @param callback: The closure receiving the slow callbacks.
+/// @return 0 in case of success, `Z_EINVAL` if `threshold_ns` is 0.
+#[no_mangle]
+pub extern "C" fn zc_init_callback_watchdog(
+    threshold_ns: u64,
+    isolation_queue_size: usize,
+    callback: &mut zc_moved_closure_span_t,
+) -> result::z_result_t {
+    let callback = callback.take_rust_type();
+    if threshold_ns == 0 {
+        return result::Z_EINVAL;
+    }
+    *WATCHDOG_CALLBACK.write().unwrap_or_else(|e| e.into_inner()) = Some(Arc::new(callback));
+    ISOLATION_QUEUE_SIZE.store(isolation_queue_size, Ordering::Relaxed);
+    THRESHOLD_NS.store(threshold_ns, Ordering::Relaxed);
+    result::Z_OK
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Stops timing callbacks, dropping the watchdog callback once its last call has returned.
+///
+/// Subscribers already switched to a delivery thread stay isolated.
+#[no_mangle]
+pub extern "C" fn zc_stop_callback_watchdog() {
+    THRESHOLD_NS.store(0, Ordering::Relaxed);
+    ISOLATION_QUEUE_SIZE.store(0, Ordering::Relaxed);
+    let callback = WATCHDOG_CALLBACK
+        .write()
+        .unwrap_or_else(|e| e.into_inner())
+        .take();
+    std::mem::drop(callback);
+}
+
+fn get_callback_histogram(
+    id: EntityGlobalId,
+    histogram: &mut MaybeUninit<zc_callback_histogram_t>,
+) -> result::z_result_t {
+    match find_entity_stats(id) {
+        Some(entity) => {
+            histogram.write(entity.callbacks().snapshot());
+            result::Z_OK
+        }
+        None => {
+            histogram.write(zc_callback_histogram_t::default());
+            result::Z_EUNAVAILABLE
+        }
+    }
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Reads the distribution of the durations of the callbacks of a subscriber, timed while the watchdog is enabled.
+///
+/// For an isolated subscriber, the durations are measured on its delivery thread.
+///
+/// @param this_: The subscriber.
+/// @param histogram: An uninitialized location in memory where the histogram will be written.
+/// @return 0 in case of success, `Z_EUNAVAILABLE` if the subscriber has no counters, negative error code otherwise.
+#[no_mangle]
+pub extern "C" fn zc_subscriber_get_callback_histogram(
+    this_: &z_loaned_subscriber_t,
+    histogram: &mut MaybeUninit<zc_callback_histogram_t>,
+) -> result::z_result_t {
+    get_callback_histogram(this_.as_rust_type_ref().id(), histogram)
+}
+
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Reads the distribution of the durations of the callbacks of a queryable, timed while the watchdog is enabled.
+///
+/// For a queryable with worker threads, the durations are the times needed to dispatch the queries to the workers.
+///
+/// @param this_: The queryable.
+/// @param histogram: An uninitialized location in memory where the histogram will be written.
+/// @return 0 in case of success, `Z_EUNAVAILABLE` if the queryable has no counters, negative error code otherwise.
+#[no_mangle]
+pub extern "C" fn zc_queryable_get_callback_histogram(
+    this_: &z_loaned_queryable_t,
+    histogram: &mut MaybeUninit<zc_callback_histogram_t>,
+) -> result::z_result_t {
+    get_callback_histogram(this_.as_rust_type_ref().id(), histogram)
+}
@@ -22,6 +22,8 @@ use std::{
     slice::{from_raw_parts, from_raw_parts_mut},
 };
 
+#[cfg(all(feature = "shared-memory", feature = "unstable"))]
+use zenoh::shm::{GarbageCollect, ZShmMut};
 use zenoh::{
     bytes::{ZBytes, ZBytesReader, ZBytesSliceIterator, ZBytesWriter},
     internal::buffers::{ZBuf, ZSliceBuffer},
@@ -30,6 +32,11 @@ use zenoh::{
 pub use crate::opaque_types::{z_loaned_bytes_t, z_owned_bytes_t};
 #[cfg(all(feature = "shared-memory", feature = "unstable"))]
 use crate::result::Z_ENULL;
+#[cfg(feature = "unstable")]
+use crate::{
+    bytes_pool::{BytesPool, PooledBuf},
+    zc_loaned_bytes_pool_t,
+};
 use crate::{
     result::{self, z_result_t, Z_EINVAL, Z_EIO, Z_OK},
     transmute::{LoanedCTypeRef, RustTypeRef, RustTypeRefUninit, TakeRustType},
@@ -38,7 +45,10 @@ use crate::{
     CStringOwned,
 };
 #[cfg(all(feature = "shared-memory", feature = "unstable"))]
-use crate::{z_loaned_shm_t, z_moved_shm_mut_t, z_moved_shm_t, z_owned_shm_t};
+use crate::{
+    shm::provider::shm_provider_impl::alloc_buf, z_loaned_shm_provider_t, z_loaned_shm_t,
+    z_moved_shm_mut_t, z_moved_shm_t, z_owned_shm_t,
+};
 decl_c_type! {
     owned(z_owned_bytes_t, ZBytes),
     loaned(z_loaned_bytes_t),
@@ -443,6 +453,61 @@ pub unsafe extern "C" fn z_bytes_copy_from_str(
     }
 }
 
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief A view on a contiguous region of memory.
+#[repr(C)]
+#[derive(Clone, Copy)]
+pub struct z_iovec_t {
+    /// A pointer to the start of the region.
+    pub data: *const u8,
+    /// Length of the region in bytes.
+    pub len: usize,
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Converts a set of buffers into `z_owned_bytes_t` without copy.
+///
+/// Each buffer becomes a separate slice of the resulting data, so that `z_bytes_get_slice_iterator()` returns
+/// the same fragments, in the same order.
+/// @param this_: An uninitialized location in memory where `z_owned_bytes_t` is to be constructed.
+/// @param iov: A pointer to an array of buffers. `this_` will take ownership of each buffer.
+/// @param n: Number of buffers in `iov`.
+/// @param deleter: A thread-safe function, that will be called on the data of each buffer when `this_` is dropped. Can be `NULL` if buffers are located in static memory and do not require a drop.
+/// @param context: An optional context to be passed to each `deleter` invocation.
+/// @return 0 in case of success, negative error code otherwise. In case of failure, none of the buffers is owned by `this_`.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_bytes_from_iovec(
+    this: &mut MaybeUninit<z_owned_bytes_t>,
+    iov: *const z_iovec_t,
+    n: usize,
+    deleter: Option<extern "C" fn(data: *mut c_void, context: *mut c_void)>,
+    context: *mut c_void,
+) -> z_result_t {
+    this.as_rust_type_mut_uninit().write(ZBytes::default());
+    if n == 0 {
+        return Z_OK;
+    }
+    if iov.is_null() {
+        return Z_EINVAL;
+    }
+    let iov = from_raw_parts(iov, n);
+    if iov.iter().any(|v| v.data.is_null() && v.len > 0) {
+        return Z_EINVAL;
+    }
+    let mut writer = ZBytes::writer();
+    for v in iov {
+        match CSliceOwned::wrap(v.data as *mut u8, v.len, deleter, context) {
+            Ok(s) => writer.append(ZBytes::from(s)),
+            Err(_) => return Z_EINVAL,
+        }
+    }
+    this.as_rust_type_mut_uninit().write(writer.finish());
+    Z_OK
+}
+
 pub use crate::z_bytes_slice_iterator_t;
 decl_c_type!(loaned(z_bytes_slice_iterator_t, ZBytesSliceIterator<'static>));
 
@@ -504,6 +569,46 @@ pub extern "C" fn z_bytes_get_contiguous_view(
     }
 }
 
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Gets views on all slices of the data in a single call.
+///
+/// Slices are written in the order in which they appear in the data, exactly as they would be returned by
+/// `z_bytes_get_slice_iterator()`. Views remain valid as long as `this_` is not modified or dropped.
+///
+/// @param this_: An instance of Zenoh data.
+/// @param out: A pointer to an array of `cap` elements, where the views will be written.
+/// @param cap: Number of elements of `out`.
+/// @param n: A memory location where the total number of slices of the data will be written.
+/// @return 0 upon success, `Z_EINVAL` if the data consists of more than `cap` slices. In the latter case the first `cap` views are
+/// still written into `out`, and the total number of slices is still written into `n`, so that the call can be repeated with a
+/// large enough array.
+#[no_mangle]
+#[allow(clippy::missing_safety_doc)]
+pub unsafe extern "C" fn z_bytes_get_iovec(
+    this: &z_loaned_bytes_t,
+    out: *mut z_iovec_t,
+    cap: usize,
+    n: &mut usize,
+) -> z_result_t {
+    let mut total = 0;
+    for s in this.as_rust_type_ref().slices() {
+        if total < cap {
+            out.add(total).write(z_iovec_t {
+                data: s.as_ptr(),
+                len: s.len(),
+            });
+        }
+        total += 1;
+    }
+    *n = total;
+    if total > cap {
+        Z_EINVAL
+    } else {
+        Z_OK
+    }
+}
+
 #[cfg(all(feature = "shared-memory", feature = "unstable"))]
 /// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
 /// @brief Converts from an immutable SHM buffer consuming it.
@@ -620,8 +725,218 @@ pub use crate::opaque_types::{
     z_loaned_bytes_writer_t, z_moved_bytes_writer_t, z_owned_bytes_writer_t,
 };
 
+// The capacity of the first in-place chunk of a writer without size hint, doubled for each new chunk.
+const WRITER_CHUNK_CAPACITY: usize = 256;
+
+/// Views initialized bytes as possibly uninitialized ones, only initialized bytes are ever written through the view.
+#[cfg(feature = "unstable")]
+fn as_uninit_mut(bytes: &mut [u8]) -> &mut [MaybeUninit<u8>] {
+    unsafe { from_raw_parts_mut(bytes.as_mut_ptr() as *mut MaybeUninit<u8>, bytes.len()) }
+}
+
+/// The buffer the application writes into in place, see `z_bytes_writer_reserve()`.
+enum WriterChunk {
+    Heap(Vec<u8>),
+    #[cfg(feature = "unstable")]
+    Pooled(PooledBuf),
+    // An SHM buffer and the number of bytes committed to it.
+    #[cfg(all(feature = "shared-memory", feature = "unstable"))]
+    Shm(ZShmMut, usize),
+}
+
+impl WriterChunk {
+    fn len(&self) -> usize {
+        match self {
+            WriterChunk::Heap(v) => v.len(),
+            #[cfg(feature = "unstable")]
+            WriterChunk::Pooled(b) => b.len(),
+            #[cfg(all(feature = "shared-memory", feature = "unstable"))]
+            WriterChunk::Shm(_, len) => *len,
+        }
+    }
+
+    /// The part of the chunk past its committed length, which is uninitialized for heap chunks.
+    fn spare_mut(&mut self) -> &mut [MaybeUninit<u8>] {
+        match self {
+            WriterChunk::Heap(v) => v.spare_capacity_mut(),
+            #[cfg(feature = "unstable")]
+            WriterChunk::Pooled(b) => as_uninit_mut(b.spare_mut()),
+            #[cfg(all(feature = "shared-memory", feature = "unstable"))]
+            WriterChunk::Shm(shm, len) => as_uninit_mut(&mut shm.as_mut()[*len..]),
+        }
+    }
+
+    fn commit(&mut self, n: usize) {
+        match self {
+            WriterChunk::Heap(v) => unsafe { v.set_len(v.len() + n) },
+            #[cfg(feature = "unstable")]
+            WriterChunk::Pooled(b) => b.commit(n),
+            #[cfg(all(feature = "shared-memory", feature = "unstable"))]
+            WriterChunk::Shm(_, len) => *len += n,
+        }
+    }
+
+    fn into_zbytes(self) -> ZBytes {
+        match self {
+            WriterChunk::Heap(v) => ZBytes::from(v),
+            #[cfg(feature = "unstable")]
+            WriterChunk::Pooled(b) => b.into_zbytes(),
+            // Only filled SHM buffers are converted, see `CBytesWriter::fit_shm()`.
+            #[cfg(all(feature = "shared-memory", feature = "unstable"))]
+            WriterChunk::Shm(shm, _) => shm.into(),
+        }
+    }
+}
+
+pub struct CBytesWriter {
+    writer: ZBytesWriter,
+    // Appended to `writer` when a reservation does not fit into it, or when data is written or appended otherwise.
+    chunk: Option<WriterChunk>,
+    next_capacity: usize,
+    #[cfg(feature = "unstable")]
+    pool: Option<BytesPool>,
+    // The provider to allocate buffers from, and their minimum size.
+    #[cfg(all(feature = "shared-memory", feature = "unstable"))]
+    shm: Option<(&'static z_loaned_shm_provider_t, usize)>,
+}
+
+impl CBytesWriter {
+    fn new(capacity_hint: usize) -> Self {
+        CBytesWriter {
+            writer: ZBytes::writer(),
+            chunk: None,
+            next_capacity: if capacity_hint == 0 {
+                WRITER_CHUNK_CAPACITY
+            } else {
+                capacity_hint
+            },
+            #[cfg(feature = "unstable")]
+            pool: None,
+            #[cfg(all(feature = "shared-memory", feature = "unstable"))]
+            shm: None,
+        }
+    }
+
+    fn flush_chunk(&mut self) {
+        if let Some(chunk) = self.chunk.take() {
+            if chunk.len() > 0 {
+                #[cfg(all(feature = "shared-memory", feature = "unstable"))]
+                let chunk = self.fit_shm(chunk);
+                self.writer.append(chunk.into_zbytes());
+            }
+        }
+    }
+
+    /// SHM buffers can not be shrunk, so the committed part of a partially filled SHM buffer is copied
+    /// into a buffer of the exact size.
+    #[cfg(all(feature = "shared-memory", feature = "unstable"))]
+    fn fit_shm(&self, chunk: WriterChunk) -> WriterChunk {
+        match chunk {
+            WriterChunk::Shm(shm, len) if len < shm.len() => {
+                let data = &shm.as_ref()[..len];
+                let exact = self
+                    .shm
+                    .and_then(|(provider, _)| alloc_buf::<GarbageCollect>(provider, len));
+                match exact {
+                    Some(mut exact) if exact.len() == len => {
+                        exact.as_mut().copy_from_slice(data);
+                        WriterChunk::Shm(exact, len)
+                    }
+                    _ => WriterChunk::Heap(data.to_vec()),
+                }
+            }
+            chunk => chunk,
+        }
+    }
+
+    fn new_chunk(&mut self, len: usize) -> WriterChunk {
+        #[cfg(all(feature = "shared-memory", feature = "unstable"))]
+        if let Some((provider, chunk_size)) = self.shm {
+            match alloc_buf::<GarbageCollect>(provider, len.max(chunk_size)) {
+                Some(shm) => return WriterChunk::Shm(shm, 0),
+                None => tracing::debug!(
+                    "Failed to allocate {} bytes of SHM, writing to the heap instead",
+                    len.max(chunk_size)
+                ),
+            }
+        }
+        #[cfg(feature = "unstable")]
+        if let Some(pool) = &self.pool {
+            if len <= pool.size_class() {
+                return WriterChunk::Pooled(pool.acquire_empty());
+            }
+        }
+        let capacity = len.max(self.next_capacity);
+        self.next_capacity = capacity.saturating_mul(2);
+        WriterChunk::Heap(Vec::with_capacity(capacity))
+    }
+
+    fn reserve(&mut self, len: usize) -> &mut [MaybeUninit<u8>] {
+        let spare = self.chunk.as_mut().map_or(0, |c| c.spare_mut().len());
+        if spare < len || self.chunk.is_none() {
+            self.flush_chunk();
+            self.chunk = Some(self.new_chunk(len));
+        }
+        // The chunk was just set if there was none.
+        self.chunk.as_mut().unwrap().spare_mut()
+    }
+
+    fn commit(&mut self, written: usize) -> bool {
+        match &mut self.chunk {
+            Some(chunk) if written <= chunk.spare_mut().len() => {
+                chunk.commit(written);
+                true
+            }
+            None if written == 0 => true,
+            _ => false,
+        }
+    }
+
+    fn write_all(&mut self, src: &[u8]) -> std::io::Result<()> {
+        // Data written to a writer backed by an SHM provider goes to a new SHM buffer if the current one is full,
+        // `new_chunk()` falling back to the heap if the allocation fails.
+        #[cfg(all(feature = "shared-memory", feature = "unstable"))]
+        if self.shm.is_some()
+            && !src.is_empty()
+            && self
+                .chunk
+                .as_mut()
+                .map_or(true, |c| src.len() > c.spare_mut().len())
+        {
+            self.flush_chunk();
+            self.chunk = Some(self.new_chunk(src.len()));
+        }
+        if let Some(chunk) = &mut self.chunk {
+            let spare = chunk.spare_mut();
+            if src.len() <= spare.len() {
+                unsafe {
+                    std::ptr::copy_nonoverlapping(
+                        src.as_ptr(),
+                        spare.as_mut_ptr() as *mut u8,
+                        src.len(),
+                    )
+                };
+                chunk.commit(src.len());
+                return Ok(());
+            }
+        }
+        self.flush_chunk();
+        self.writer.write_all(src)
+    }
+
+    fn append(&mut self, bytes: ZBytes) {
+        self.flush_chunk();
+        self.writer.append(bytes);
+    }
+
+    fn finish(mut self) -> ZBytes {
+        self.flush_chunk();
+        self.writer.finish()
+    }
+}
+
 decl_c_type! {
-    owned(z_owned_bytes_writer_t, option ZBytesWriter),
+    owned(z_owned_bytes_writer_t, option CBytesWriter),
     loaned(z_loaned_bytes_writer_t),
 }
 
@@ -630,7 +945,85 @@ decl_c_type! {
 /// @return 0 in case of success, negative error code otherwise.
 #[no_mangle]
 extern "C" fn z_bytes_writer_empty(this: &mut MaybeUninit<z_owned_bytes_writer_t>) -> z_result_t {
-    this.as_rust_type_mut_uninit().write(Some(ZBytes::writer()));
+    this.as_rust_type_mut_uninit()
+        .write(Some(CBytesWriter::new(0)));
+    result::Z_OK
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs a data writer with empty payload, whose first buffer for in-place writes will hold at least
+/// `capacity` bytes.
+///
+/// Passing the expected size of the payload allows `z_bytes_writer_reserve()` to serialize it into a single buffer.
+/// Further buffers, if needed, are allocated with a doubling capacity.
+///
+/// @param this_: An uninitialized memory location where writer is to be constructed.
+/// @param capacity: The size hint, 0 for the default.
+/// @return 0 in case of success, negative error code otherwise.
+#[no_mangle]
+pub extern "C" fn z_bytes_writer_with_capacity(
+    this: &mut MaybeUninit<z_owned_bytes_writer_t>,
+    capacity: usize,
+) -> z_result_t {
+    this.as_rust_type_mut_uninit()
+        .write(Some(CBytesWriter::new(capacity)));
+    result::Z_OK
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs a data writer with empty payload, whose buffers for in-place writes are acquired from a pool.
+///
+/// Each call to `z_bytes_writer_reserve()` which does not fit into the current buffer acquires a new buffer from
+/// the pool, unless more than `zc_bytes_pool_size_class()` bytes are reserved. Buffers return to the pool once the
+/// last reference to the finished payload is dropped.
+///
+/// @param this_: An uninitialized memory location where writer is to be constructed.
+/// @param pool: The pool to acquire buffers from.
+/// @return 0 in case of success, negative error code otherwise.
+#[no_mangle]
+pub extern "C" fn zc_bytes_writer_from_pool(
+    this: &mut MaybeUninit<z_owned_bytes_writer_t>,
+    pool: &zc_loaned_bytes_pool_t,
+) -> z_result_t {
+    let mut writer = CBytesWriter::new(0);
+    writer.pool = Some(pool.as_rust_type_ref().clone());
+    this.as_rust_type_mut_uninit().write(Some(writer));
+    result::Z_OK
+}
+
+#[cfg(all(feature = "shared-memory", feature = "unstable"))]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Constructs a data writer with empty payload, whose buffers are allocated from an SHM provider.
+///
+/// Data written with `z_bytes_writer_reserve()` or `z_bytes_writer_write_all()` goes into SHM buffers of at least
+/// `chunk_size` bytes, a new buffer being allocated whenever the current one is full, so that the payload returned
+/// by `z_bytes_writer_finish()` is delivered without copy to the subscribers sharing the SHM segments. SHM buffers can
+/// not be shrunk: the data of a buffer which is not filled when the payload is finished, or when data is appended with
+/// `z_bytes_writer_append()`, is copied into a new SHM buffer of the exact size. Passing the expected size of the
+/// payload as `chunk_size` and reserving it at once thus avoids any copy if the reservation is filled.
+///
+/// Buffers are allocated with the garbage collection policy. If the provider has no memory left, the writer falls back
+/// to heap buffers, so that writing never fails.
+///
+/// @param this_: An uninitialized memory location where writer is to be constructed.
+/// @param provider: The SHM provider, which should outlive the writer.
+/// @param chunk_size: The minimum size of the allocated SHM buffers, ideally the expected size of the payload.
+/// @return 0 in case of success, `Z_EINVAL` if `chunk_size` is 0.
+#[no_mangle]
+pub extern "C" fn z_bytes_writer_from_shm_provider(
+    this: &mut MaybeUninit<z_owned_bytes_writer_t>,
+    provider: &'static z_loaned_shm_provider_t,
+    chunk_size: usize,
+) -> z_result_t {
+    if chunk_size == 0 {
+        this.as_rust_type_mut_uninit().write(None);
+        return Z_EINVAL;
+    }
+    let mut writer = CBytesWriter::new(0);
+    writer.shm = Some((provider, chunk_size));
+    this.as_rust_type_mut_uninit().write(Some(writer));
     result::Z_OK
 }
 
@@ -706,6 +1099,59 @@ unsafe extern "C" fn z_bytes_writer_write_all(
     }
 }
 
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Reserves a buffer of at least `len` bytes at the end of the data, to be written in place.
+///
+/// This allows serializers to write directly into the memory of the payload:
+/// @code{.c}
+/// uint8_t *buf;
+/// z_bytes_writer_reserve(z_loan_mut(writer), max_len, &buf);
+/// size_t written = encode_message(msg, buf, max_len);
+/// z_bytes_writer_commit(z_loan_mut(writer), written);
+/// @endcode
+/// The reserved bytes are uninitialized, and are not part of the data until they are committed. The buffer stays valid
+/// until the next call of any function on the writer. If the current buffer can not hold `len` more bytes, the
+/// committed bytes are kept and a new buffer is started, so that payloads built with several reservations may consist
+/// of several slices.
+///
+/// @param this_: The writer.
+/// @param len: The number of bytes to reserve.
+/// @param buf: A memory location where the pointer to the reserved buffer will be written.
+/// @return 0 in case of success, negative error code otherwise.
+#[no_mangle]
+pub extern "C" fn z_bytes_writer_reserve(
+    this: &mut z_loaned_bytes_writer_t,
+    len: usize,
+    buf: &mut *mut u8,
+) -> z_result_t {
+    *buf = this.as_rust_type_mut().reserve(len).as_mut_ptr() as *mut u8;
+    Z_OK
+}
+
+#[cfg(feature = "unstable")]
+/// @warning This API has been marked as unstable: it works as advertised, but it may be changed in a future release.
+/// @brief Appends the first `written` bytes of the buffer returned by the last call to `z_bytes_writer_reserve()` to
+/// the data.
+///
+/// Several commits may follow a single reservation, as long as their total does not exceed the reserved size.
+///
+/// @param this_: The writer.
+/// @param written: The number of bytes written into the reserved buffer.
+/// @return 0 in case of success, `Z_EINVAL` if `written` exceeds the remaining size of the reserved buffer.
+#[no_mangle]
+pub extern "C" fn z_bytes_writer_commit(
+    this: &mut z_loaned_bytes_writer_t,
+    written: usize,
+) -> z_result_t {
+    if this.as_rust_type_mut().commit(written) {
+        Z_OK
+    } else {
+        tracing::error!("Committed more bytes than reserved");
+        Z_EINVAL
+    }
+}
+
 /// Appends bytes.     
 /// This allows to compose a serialized data out of multiple `z_owned_bytes_t` that may point to different memory regions.
 /// Said in other terms, it allows to create a linear view on different memory regions without copy.
@@ -0,0 +1,51 @@
+#!/usr/bin/env bash
+set -e
+SCRIPT_DIR=$( cd -- "$( dirname -- "${BASH_SOURCE[0]}" )" &> /dev/null && pwd )
+
+# Runs the allocation counting test $1, which prints one "<operation> <allocations> <bytes>" line per operation,
+# and compares it with the baseline $2. An operation regresses if it performs over 10% and over 1 more allocations
+# than its baseline, or allocates over 10% and over 64 more bytes. Operations missing from the baseline, or from the
+# output of the test, fail the check too. With --update, the baseline is replaced.
+function check_allocs {
+  echo "Counting allocations per operation of $1"
+  $1 > "$1.allocs.log"
+  if [[ "$3" == "--update" ]]
+  then
+    { grep '^#' "$2" || true; cat "$1.allocs.log"; } > "$2.tmp"
+    mv "$2.tmp" "$2"
+    echo "Updated $2"
+    cat "$1.allocs.log"
+    return 0
+  fi
+  awk '
+    FNR == NR {
+      if ($0 !~ /^#/ && NF == 3) { allocs[$1] = $2; bytes[$1] = $3 }
+      next
+    }
+    NF == 3 {
+      if (!($1 in allocs)) {
+        printf "%s: %s allocations, %s bytes per operation NOT IN BASELINE\n", $1, $2, $3
+        failed++
+        next
+      }
+      seen[$1] = 1
+      regressed = ($2 > allocs[$1] * 1.1 && $2 > allocs[$1] + 1) || ($3 > bytes[$1] * 1.1 && $3 > bytes[$1] + 64)
+      printf "%s: %s allocations (baseline %s), %s bytes (baseline %s) per operation%s\n", $1, $2, allocs[$1], $3, bytes[$1], regressed ? " REGRESSED" : ""
+      failed += regressed
+    }
+    END {
+      for (op in allocs) {
+        if (!(op in seen)) {
+          printf "%s: NOT MEASURED (baseline %s allocations, %s bytes per operation)\n", op, allocs[op], bytes[op]
+          failed++
+        }
+      }
+      if (failed != 0) {
+        print "Run with --update to record a new baseline if these changes are expected"
+      }
+      exit failed != 0
+    }
+  ' "$2" "$1.allocs.log"
+}
+
+check_allocs $1 $2 $3
@@ -0,0 +1,191 @@
+//
+// Copyright (c) 2024 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+
+#include <stdio.h>
+#include <string.h>
+
+#include "zenoh.h"
+
+#undef NDEBUG
+#include <assert.h>
+
+// Each operation is run WARMUP times before being measured, so that lazily initialized state and the buffers reused
+// across operations are allocated before the counting starts.
+#define WARMUP 100
+#define ITERATIONS 1000
+#define PAYLOAD_SIZE 64
+#define CHANNEL_CAPACITY 16
+
+static uint8_t payload_data[PAYLOAD_SIZE];
+
+typedef struct {
+    const z_loaned_session_t *session;
+    const z_loaned_publisher_t *publisher;
+    const z_loaned_fifo_handler_sample_t *samples;
+    const z_loaned_keyexpr_t *query_keyexpr;
+#if defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API)
+    const z_loaned_shm_provider_t *provider;
+#endif
+    size_t received;
+} context_t;
+
+// Prints the allocations and bytes allocated per call of `op`, averaged over ITERATIONS calls.
+static void measure(const char *name, void (*op)(context_t *), context_t *ctx) {
+    for (size_t i = 0; i < WARMUP; i++) {
+        op(ctx);
+    }
+    zc_alloc_stats_t before, after;
+    zc_alloc_stats_get(&before);
+    for (size_t i = 0; i < ITERATIONS; i++) {
+        op(ctx);
+    }
+    zc_alloc_stats_get(&after);
+    printf("%s %.2f %.2f\n", name, (double)(after.allocations - before.allocations) / ITERATIONS,
+           (double)(after.allocated_bytes - before.allocated_bytes) / ITERATIONS);
+}
+
+static void put(context_t *ctx) {
+    z_owned_bytes_t payload;
+    z_bytes_from_static_buf(&payload, payload_data, PAYLOAD_SIZE);
+    assert(z_publisher_put(ctx->publisher, z_move(payload), NULL) == Z_OK);
+}
+
+void on_sample(z_loaned_sample_t *sample, void *arg) { ((context_t *)arg)->received++; }
+
+static void put_recv(context_t *ctx) {
+    put(ctx);
+    z_owned_sample_t sample;
+    assert(z_recv(ctx->samples, &sample) == Z_OK);
+    z_drop(z_move(sample));
+}
+
+void on_query(z_loaned_query_t *query, void *arg) {
+    z_owned_bytes_t payload;
+    z_bytes_from_static_buf(&payload, payload_data, PAYLOAD_SIZE);
+    z_query_reply(query, z_query_keyexpr(query), z_move(payload), NULL);
+}
+
+static void get(context_t *ctx) {
+    z_owned_fifo_handler_reply_t handler;
+    z_owned_closure_reply_t closure;
+    z_fifo_channel_reply_new(&closure, &handler, CHANNEL_CAPACITY);
+    assert(z_get(ctx->session, ctx->query_keyexpr, "", z_move(closure), NULL) == Z_OK);
+    size_t replies = 0;
+    z_owned_reply_t reply;
+    // the channel is closed once the query is finalized
+    while (z_recv(z_loan(handler), &reply) == Z_OK) {
+        assert(z_reply_is_ok(z_loan(reply)));
+        replies++;
+        z_drop(z_move(reply));
+    }
+    assert(replies == 1);
+    z_drop(z_move(handler));
+}
+
+#if defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API)
+static void shm_alloc(context_t *ctx) {
+    z_alloc_alignment_t alignment = {0};
+    z_buf_layout_alloc_result_t alloc;
+    z_shm_provider_alloc(&alloc, ctx->provider, PAYLOAD_SIZE, alignment);
+    assert(alloc.status == ZC_BUF_LAYOUT_ALLOC_STATUS_OK);
+    z_drop(z_move(alloc.buf));
+}
+#endif
+
+// The allocations of z_malloc() are counted along with those of the library.
+void count_z_malloc() {
+    zc_alloc_stats_t before, after;
+    zc_alloc_stats_get(&before);
+    void *p = z_malloc(100);
+    p = z_realloc(p, 200);
+    z_free(p);
+    zc_alloc_stats_get(&after);
+    assert(after.allocations >= before.allocations + 2);
+    assert(after.deallocations >= before.deallocations + 1);
+    assert(after.allocated_bytes >= before.allocated_bytes + 300);
+}
+
+int main(int argc, char **argv) {
+    count_z_malloc();
+
+    // a single session, so that samples and queries are delivered in the thread of the operation
+    z_owned_config_t config;
+    z_config_default(&config);
+    assert(zc_config_insert_json5(z_loan_mut(config), "scouting/multicast/enabled", "false") == Z_OK);
+    z_owned_session_t session;
+    assert(z_open(&session, z_move(config), NULL) == Z_OK);
+    context_t ctx = {.session = z_loan(session), .received = 0};
+
+    z_view_keyexpr_t put_keyexpr, sub_keyexpr, recv_keyexpr, query_keyexpr;
+    z_view_keyexpr_from_str(&put_keyexpr, "test/alloc/put");
+    z_view_keyexpr_from_str(&sub_keyexpr, "test/alloc/sub");
+    z_view_keyexpr_from_str(&recv_keyexpr, "test/alloc/recv");
+    z_view_keyexpr_from_str(&query_keyexpr, "test/alloc/query");
+
+    // publisher put without matching subscriber
+    z_owned_publisher_t publisher;
+    assert(z_declare_publisher(z_loan(session), &publisher, z_loan(put_keyexpr), NULL) == Z_OK);
+    ctx.publisher = z_loan(publisher);
+    measure("publisher_put", put, &ctx);
+    z_drop(z_move(publisher));
+
+    // publisher put delivered to a callback subscriber
+    z_owned_closure_sample_t callback;
+    z_closure(&callback, on_sample, NULL, &ctx);
+    z_owned_subscriber_t subscriber;
+    assert(z_declare_subscriber(z_loan(session), &subscriber, z_loan(sub_keyexpr), z_move(callback), NULL) == Z_OK);
+    assert(z_declare_publisher(z_loan(session), &publisher, z_loan(sub_keyexpr), NULL) == Z_OK);
+    ctx.publisher = z_loan(publisher);
+    measure("subscriber_delivery", put, &ctx);
+    assert(ctx.received == WARMUP + ITERATIONS);
+    z_drop(z_move(publisher));
+    z_drop(z_move(subscriber));
+
+    // publisher put received from a FIFO channel
+    z_owned_fifo_handler_sample_t samples;
+    z_fifo_channel_sample_new(&callback, &samples, CHANNEL_CAPACITY);
+    assert(z_declare_subscriber(z_loan(session), &subscriber, z_loan(recv_keyexpr), z_move(callback), NULL) == Z_OK);
+    assert(z_declare_publisher(z_loan(session), &publisher, z_loan(recv_keyexpr), NULL) == Z_OK);
+    ctx.publisher = z_loan(publisher);
+    ctx.samples = z_loan(samples);
+    measure("channel_recv", put_recv, &ctx);
+    z_drop(z_move(publisher));
+    z_drop(z_move(subscriber));
+    z_drop(z_move(samples));
+
+    // get answered by a queryable with a single reply
+    z_owned_closure_query_t on_query_closure;
+    z_closure(&on_query_closure, on_query, NULL, NULL);
+    z_owned_queryable_t queryable;
+    assert(z_declare_queryable(z_loan(session), &queryable, z_loan(query_keyexpr), z_move(on_query_closure), NULL) ==
+           Z_OK);
+    ctx.query_keyexpr = z_loan(query_keyexpr);
+    measure("query_reply", get, &ctx);
+    z_drop(z_move(queryable));
+
+#if defined(Z_FEATURE_SHARED_MEMORY) && defined(Z_FEATURE_UNSTABLE_API)
+    // allocation and release of a buffer from a provider with free chunks
+    z_alloc_alignment_t alignment = {0};
+    z_owned_memory_layout_t layout;
+    assert(z_memory_layout_new(&layout, PAYLOAD_SIZE, alignment) == Z_OK);
+    z_owned_shm_provider_t provider;
+    assert(zc_posix_shm_slab_provider_new(&provider, z_loan(layout), CHANNEL_CAPACITY) == Z_OK);
+    ctx.provider = z_loan(provider);
+    measure("shm_alloc", shm_alloc, &ctx);
+    z_drop(z_move(provider));
+    z_drop(z_move(layout));
+#endif
+
+    z_drop(z_move(session));
+    return 0;
+}
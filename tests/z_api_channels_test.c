@@ -0,0 +1,654 @@
+//
+// Copyright (c) 2024 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "zenoh.h"
+
+#undef NDEBUG
+#include <assert.h>
+
+#define N 8
+
+const char* expr = "zenoh/channels/test";
+
+void put_n(const z_loaned_session_t* s, size_t n) {
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, expr);
+    for (size_t i = 0; i < n; i++) {
+        z_owned_bytes_t payload;
+        z_bytes_copy_from_str(&payload, "data");
+        z_put(s, z_loan(ke), z_move(payload), NULL);
+    }
+}
+
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct {
+    const z_loaned_session_t* session;
+    z_owned_subscriber_t* subscriber;
+    uint32_t delay_ms;
+} delayed_t;
+
+void* put_later(void* arg) {
+    delayed_t* d = (delayed_t*)arg;
+    z_sleep_ms(d->delay_ms);
+    put_n(d->session, 1);
+    return NULL;
+}
+
+void* undeclare_later(void* arg) {
+    delayed_t* d = (delayed_t*)arg;
+    z_sleep_ms(d->delay_ms);
+    z_drop(z_move(*d->subscriber));
+    return NULL;
+}
+
+void test_recv_spin() {
+    z_owned_config_t c;
+    z_config_default(&c);
+    z_owned_session_t s;
+    assert(z_open(&s, z_move(c), NULL) == Z_OK);
+
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, expr);
+    z_owned_closure_sample_t closure;
+    z_owned_fifo_handler_sample_t fifo;
+    z_fifo_channel_sample_new(&closure, &fifo, 16);
+    z_owned_subscriber_t sub;
+    assert(z_declare_subscriber(z_loan(s), &sub, z_loan(ke), z_move(closure), NULL) == Z_OK);
+    z_sleep_s(1);
+
+    delayed_t d = {.session = z_loan(s), .subscriber = &sub, .delay_ms = 100};
+    z_owned_task_t task;
+    z_owned_sample_t sample;
+    z_clock_t start;
+
+    // a sample arriving within the spin window is returned without parking
+    zc_recv_spin_options_t spin;
+    zc_recv_spin_options_default(&spin);
+    spin.spin_count = 0;
+    spin.spin_duration_ns = 5000000000ull;
+    spin.yield_before_park = false;
+    assert(z_task_init(&task, NULL, put_later, &d) == Z_OK);
+    start = z_clock_now();
+    assert(z_fifo_handler_sample_recv_spin(z_loan(fifo), &sample, &spin) == Z_OK);
+    assert(z_clock_elapsed_ms(&start) < 5000);
+    assert(z_internal_check(sample));
+    z_drop(z_move(sample));
+    assert(z_task_join(z_move(task)) == Z_OK);
+
+    // once the spin budget is exhausted, the call falls back to a blocking receive
+    d.delay_ms = 500;
+    assert(z_task_init(&task, NULL, put_later, &d) == Z_OK);
+    start = z_clock_now();
+    assert(z_fifo_handler_sample_recv_spin(z_loan(fifo), &sample, NULL) == Z_OK);
+    assert(z_clock_elapsed_ms(&start) >= 400);
+    assert(z_internal_check(sample));
+    z_drop(z_move(sample));
+    assert(z_task_join(z_move(task)) == Z_OK);
+
+    // the call returns once the channel is disconnected, while spinning
+    d.delay_ms = 100;
+    assert(z_task_init(&task, NULL, undeclare_later, &d) == Z_OK);
+    assert(z_fifo_handler_sample_recv_spin(z_loan(fifo), &sample, &spin) == Z_CHANNEL_DISCONNECTED);
+    assert(!z_internal_check(sample));
+    assert(z_task_join(z_move(task)) == Z_OK);
+    z_drop(z_move(fifo));
+
+    // or while blocking
+    z_owned_ring_handler_sample_t ring;
+    z_ring_channel_sample_new(&closure, &ring, 4);
+    assert(z_declare_subscriber(z_loan(s), &sub, z_loan(ke), z_move(closure), NULL) == Z_OK);
+    d.delay_ms = 500;
+    assert(z_task_init(&task, NULL, undeclare_later, &d) == Z_OK);
+    assert(z_ring_handler_sample_recv_spin(z_loan(ring), &sample, NULL) == Z_CHANNEL_DISCONNECTED);
+    assert(!z_internal_check(sample));
+    assert(z_task_join(z_move(task)) == Z_OK);
+    z_drop(z_move(ring));
+
+    z_drop(z_move(s));
+}
+
+void test_fifo_recv_many() {
+    z_owned_config_t c;
+    z_config_default(&c);
+    z_owned_session_t s;
+    assert(z_open(&s, z_move(c), NULL) == Z_OK);
+
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, expr);
+    z_owned_closure_sample_t closure;
+    z_owned_fifo_handler_sample_t handler;
+    z_fifo_channel_sample_new(&closure, &handler, 16);
+    z_owned_subscriber_t sub;
+    assert(z_declare_subscriber(z_loan(s), &sub, z_loan(ke), z_move(closure), NULL) == Z_OK);
+    z_sleep_s(1);
+
+    z_owned_sample_t samples[N];
+    size_t n = 0;
+    assert(z_fifo_handler_sample_try_recv_many(z_loan(handler), samples, N, &n) == Z_CHANNEL_NODATA);
+    assert(n == 0);
+    assert(z_fifo_handler_sample_try_recv_many(z_loan(handler), samples, 0, &n) == Z_EINVAL);
+
+    put_n(z_loan(s), N + 2);
+    z_sleep_s(1);
+
+    assert(z_fifo_handler_sample_recv_many(z_loan(handler), samples, N, &n) == Z_OK);
+    assert(n == N);
+    for (size_t i = 0; i < n; i++) {
+        assert(z_internal_check(samples[i]));
+        z_drop(z_move(samples[i]));
+    }
+    assert(z_fifo_handler_sample_try_recv_many(z_loan(handler), samples, N, &n) == Z_OK);
+    assert(n == 2);
+    for (size_t i = 0; i < n; i++) {
+        z_drop(z_move(samples[i]));
+    }
+
+    z_drop(z_move(sub));
+    assert(z_fifo_handler_sample_recv_many(z_loan(handler), samples, N, &n) == Z_CHANNEL_DISCONNECTED);
+    assert(n == 0);
+    z_drop(z_move(handler));
+    z_drop(z_move(s));
+}
+
+void test_ring_recv_many() {
+    z_owned_config_t c;
+    z_config_default(&c);
+    z_owned_session_t s;
+    assert(z_open(&s, z_move(c), NULL) == Z_OK);
+
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, expr);
+    z_owned_closure_sample_t closure;
+    z_owned_ring_handler_sample_t handler;
+    z_ring_channel_sample_new(&closure, &handler, 4);
+    z_owned_subscriber_t sub;
+    assert(z_declare_subscriber(z_loan(s), &sub, z_loan(ke), z_move(closure), NULL) == Z_OK);
+    z_sleep_s(1);
+
+    z_owned_sample_t samples[N];
+    size_t n = 0;
+    assert(z_ring_handler_sample_try_recv_many(z_loan(handler), samples, N, &n) == Z_CHANNEL_NODATA);
+    assert(n == 0);
+    assert(z_ring_handler_sample_try_recv_many(z_loan(handler), samples, 0, &n) == Z_EINVAL);
+
+    // the ring buffer only keeps the latest samples
+    put_n(z_loan(s), N + 2);
+    z_sleep_s(1);
+    assert(z_ring_handler_sample_recv_many(z_loan(handler), samples, N, &n) == Z_OK);
+    assert(n == 4);
+    for (size_t i = 0; i < n; i++) {
+        assert(z_internal_check(samples[i]));
+        z_drop(z_move(samples[i]));
+    }
+    assert(z_ring_handler_sample_try_recv_many(z_loan(handler), samples, N, &n) == Z_CHANNEL_NODATA);
+
+    put_n(z_loan(s), 2);
+    z_sleep_s(1);
+    assert(z_ring_handler_sample_try_recv_many(z_loan(handler), samples, 1, &n) == Z_OK);
+    assert(n == 1);
+    z_drop(z_move(samples[0]));
+    assert(z_ring_handler_sample_try_recv_many(z_loan(handler), samples, N, &n) == Z_OK);
+    assert(n == 1);
+    z_drop(z_move(samples[0]));
+
+    z_drop(z_move(sub));
+    assert(z_ring_handler_sample_recv_many(z_loan(handler), samples, N, &n) == Z_CHANNEL_DISCONNECTED);
+    assert(n == 0);
+    z_drop(z_move(handler));
+    z_drop(z_move(s));
+}
+
+void reply_n_handler(z_loaned_query_t* query, void* context) {
+    for (size_t i = 0; i < N; i++) {
+        z_owned_bytes_t payload;
+        z_bytes_copy_from_str(&payload, "reply");
+        z_query_reply(query, z_query_keyexpr(query), z_move(payload), NULL);
+    }
+}
+
+void test_reply_recv_many() {
+    z_owned_config_t c;
+    z_config_default(&c);
+    z_owned_session_t s;
+    assert(z_open(&s, z_move(c), NULL) == Z_OK);
+
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, expr);
+    z_owned_closure_query_t qable_closure;
+    z_closure(&qable_closure, reply_n_handler, NULL, NULL);
+    z_owned_queryable_t qable;
+    assert(z_declare_queryable(z_loan(s), &qable, z_loan(ke), z_move(qable_closure), NULL) == Z_OK);
+    z_sleep_s(1);
+
+    z_owned_reply_t replies[2 * N];
+    size_t n = 0;
+
+    z_owned_closure_reply_t closure;
+    z_owned_fifo_handler_reply_t fifo;
+    z_fifo_channel_reply_new(&closure, &fifo, 2 * N);
+    assert(z_get(z_loan(s), z_loan(ke), "", z_move(closure), NULL) == Z_OK);
+    z_sleep_s(1);
+    assert(z_fifo_handler_reply_try_recv_many(z_loan(fifo), replies, 0, &n) == Z_EINVAL);
+    assert(z_fifo_handler_reply_try_recv_many(z_loan(fifo), replies, 2 * N, &n) == Z_OK);
+    assert(n == N);
+    for (size_t i = 0; i < n; i++) {
+        assert(z_reply_is_ok(z_loan(replies[i])));
+        z_drop(z_move(replies[i]));
+    }
+    // the channel is dropped once the query is finalized
+    assert(z_fifo_handler_reply_recv_many(z_loan(fifo), replies, 2 * N, &n) == Z_CHANNEL_DISCONNECTED);
+    assert(n == 0);
+    z_drop(z_move(fifo));
+
+    z_drop(z_move(qable));
+
+    // the query is kept alive by a fifo query channel, since the ring buffer is dropped along with its
+    // pending replies once the query is finalized
+    z_owned_closure_query_t query_closure;
+    z_owned_fifo_handler_query_t queries;
+    z_fifo_channel_query_new(&query_closure, &queries, 1);
+    assert(z_declare_queryable(z_loan(s), &qable, z_loan(ke), z_move(query_closure), NULL) == Z_OK);
+    z_sleep_s(1);
+    z_owned_ring_handler_reply_t ring;
+    z_ring_channel_reply_new(&closure, &ring, 4);
+    assert(z_get(z_loan(s), z_loan(ke), "", z_move(closure), NULL) == Z_OK);
+    z_owned_query_t query;
+    assert(z_recv(z_loan(queries), &query) == Z_OK);
+    reply_n_handler(z_loan_mut(query), NULL);
+    z_sleep_s(1);
+    assert(z_ring_handler_reply_recv_many(z_loan(ring), replies, 2 * N, &n) == Z_OK);
+    assert(n == 4);
+    for (size_t i = 0; i < n; i++) {
+        assert(z_reply_is_ok(z_loan(replies[i])));
+        z_drop(z_move(replies[i]));
+    }
+    assert(z_ring_handler_reply_try_recv_many(z_loan(ring), replies, 2 * N, &n) == Z_CHANNEL_NODATA);
+    z_drop(z_move(query));
+    z_sleep_s(1);
+    assert(z_ring_handler_reply_recv_many(z_loan(ring), replies, 2 * N, &n) == Z_CHANNEL_DISCONNECTED);
+    assert(n == 0);
+    z_drop(z_move(ring));
+    z_drop(z_move(queries));
+
+    z_drop(z_move(qable));
+    z_drop(z_move(s));
+}
+
+void get_n(const z_loaned_session_t* s, size_t n) {
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, expr);
+    for (size_t i = 0; i < n; i++) {
+        z_owned_closure_reply_t closure;
+        z_owned_fifo_handler_reply_t handler;
+        z_fifo_channel_reply_new(&closure, &handler, 1);
+        assert(z_get(s, z_loan(ke), "", z_move(closure), NULL) == Z_OK);
+        z_drop(z_move(handler));
+    }
+}
+
+void test_query_recv_many() {
+    z_owned_config_t c;
+    z_config_default(&c);
+    z_owned_session_t s;
+    assert(z_open(&s, z_move(c), NULL) == Z_OK);
+
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, expr);
+    z_owned_query_t queries[N];
+    size_t n = 0;
+
+    z_owned_closure_query_t closure;
+    z_owned_fifo_handler_query_t fifo;
+    z_fifo_channel_query_new(&closure, &fifo, 2 * N);
+    z_owned_queryable_t qable;
+    assert(z_declare_queryable(z_loan(s), &qable, z_loan(ke), z_move(closure), NULL) == Z_OK);
+    z_sleep_s(1);
+    assert(z_fifo_handler_query_try_recv_many(z_loan(fifo), queries, N, &n) == Z_CHANNEL_NODATA);
+    assert(n == 0);
+    assert(z_fifo_handler_query_try_recv_many(z_loan(fifo), queries, 0, &n) == Z_EINVAL);
+    get_n(z_loan(s), N + 2);
+    z_sleep_s(1);
+    assert(z_fifo_handler_query_recv_many(z_loan(fifo), queries, N, &n) == Z_OK);
+    assert(n == N);
+    for (size_t i = 0; i < n; i++) {
+        assert(z_internal_check(queries[i]));
+        z_drop(z_move(queries[i]));
+    }
+    assert(z_fifo_handler_query_try_recv_many(z_loan(fifo), queries, N, &n) == Z_OK);
+    assert(n == 2);
+    for (size_t i = 0; i < n; i++) {
+        z_drop(z_move(queries[i]));
+    }
+    z_drop(z_move(qable));
+    assert(z_fifo_handler_query_recv_many(z_loan(fifo), queries, N, &n) == Z_CHANNEL_DISCONNECTED);
+    z_drop(z_move(fifo));
+
+    z_owned_ring_handler_query_t ring;
+    z_ring_channel_query_new(&closure, &ring, 4);
+    assert(z_declare_queryable(z_loan(s), &qable, z_loan(ke), z_move(closure), NULL) == Z_OK);
+    z_sleep_s(1);
+    get_n(z_loan(s), N);
+    z_sleep_s(1);
+    assert(z_ring_handler_query_try_recv_many(z_loan(ring), queries, N, &n) == Z_OK);
+    assert(n == 4);
+    for (size_t i = 0; i < n; i++) {
+        assert(z_internal_check(queries[i]));
+        z_drop(z_move(queries[i]));
+    }
+    assert(z_ring_handler_query_try_recv_many(z_loan(ring), queries, N, &n) == Z_CHANNEL_NODATA);
+    z_drop(z_move(qable));
+    assert(z_ring_handler_query_recv_many(z_loan(ring), queries, N, &n) == Z_CHANNEL_DISCONNECTED);
+    z_drop(z_move(ring));
+
+    z_drop(z_move(s));
+}
+
+void test_spsc_channel() {
+    z_owned_config_t c;
+    z_config_default(&c);
+    z_owned_session_t s;
+    assert(z_open(&s, z_move(c), NULL) == Z_OK);
+
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, expr);
+    z_owned_closure_sample_t closure;
+    z_owned_spsc_handler_sample_t handler;
+    z_spsc_channel_sample_new(&closure, &handler, 4);
+    z_owned_subscriber_t sub;
+    assert(z_declare_subscriber(z_loan(s), &sub, z_loan(ke), z_move(closure), NULL) == Z_OK);
+    z_sleep_s(1);
+
+    z_owned_sample_t sample;
+    assert(z_try_recv(z_loan(handler), &sample) == Z_CHANNEL_NODATA);
+    assert(!z_internal_check(sample));
+
+    // samples exceeding the capacity are dropped
+    assert(z_spsc_handler_sample_dropped(z_loan(handler)) == 0);
+    put_n(z_loan(s), 6);
+    z_sleep_s(1);
+    assert(z_spsc_handler_sample_dropped(z_loan(handler)) == 2);
+    for (size_t i = 0; i < 4; i++) {
+        assert(z_recv(z_loan(handler), &sample) == Z_OK);
+        assert(z_internal_check(sample));
+        z_drop(z_move(sample));
+    }
+    assert(z_try_recv(z_loan(handler), &sample) == Z_CHANNEL_NODATA);
+
+    put_n(z_loan(s), 1);
+    z_sleep_s(1);
+    z_drop(z_move(sub));
+    assert(z_recv(z_loan(handler), &sample) == Z_OK);
+    z_drop(z_move(sample));
+    assert(z_recv(z_loan(handler), &sample) == Z_CHANNEL_DISCONNECTED);
+
+    z_drop(z_move(handler));
+    z_drop(z_move(s));
+}
+
+void credit_query_handler(z_loaned_query_t* query, void* context) {
+    size_t n = *(size_t*)context;
+    for (size_t i = 0; i < n; i++) {
+        z_owned_bytes_t payload;
+        z_bytes_copy_from_str(&payload, "reply");
+        z_query_reply(query, z_query_keyexpr(query), z_move(payload), NULL);
+    }
+}
+
+typedef struct {
+    const z_loaned_session_t* session;
+    const z_loaned_keyexpr_t* keyexpr;
+    z_owned_closure_reply_t* closure;
+} credit_get_t;
+
+void* credit_get(void* arg) {
+    credit_get_t* get = (credit_get_t*)arg;
+    assert(z_get(get->session, get->keyexpr, "", z_move(*get->closure), NULL) == Z_OK);
+    return NULL;
+}
+
+void test_credit_channel() {
+    z_owned_config_t c;
+    z_config_default(&c);
+    z_owned_session_t s;
+    assert(z_open(&s, z_move(c), NULL) == Z_OK);
+
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, expr);
+    z_owned_closure_query_t qable_closure;
+    size_t n_replies = 2;
+    z_closure(&qable_closure, credit_query_handler, NULL, &n_replies);
+    z_owned_queryable_t qable;
+    assert(z_declare_queryable(z_loan(s), &qable, z_loan(ke), z_move(qable_closure), NULL) == Z_OK);
+    z_sleep_s(1);
+
+    z_owned_closure_reply_t closure;
+    z_owned_credit_handler_reply_t handler;
+    z_credit_channel_reply_new(&closure, &handler, 2);
+    assert(z_credit_handler_reply_credit(z_loan(handler)) == 2);
+    assert(z_get(z_loan(s), z_loan(ke), "", z_move(closure), NULL) == Z_OK);
+
+    z_owned_reply_t reply;
+    for (size_t i = 0; i < 2; i++) {
+        assert(z_recv(z_loan(handler), &reply) == Z_OK);
+        assert(z_reply_is_ok(z_loan(reply)));
+        z_drop(z_move(reply));
+    }
+    // receiving replies does not give the credit back
+    assert(z_credit_handler_reply_credit(z_loan(handler)) == 0);
+    z_credit_handler_reply_grant(z_loan(handler), 3);
+    assert(z_credit_handler_reply_credit(z_loan(handler)) == 3);
+    assert(z_recv(z_loan(handler), &reply) == Z_CHANNEL_DISCONNECTED);
+    assert(!z_internal_check(reply));
+    z_drop(z_move(handler));
+
+    // the local queryable replies from the thread issuing the query, which blocks until the consumer grants credit
+    n_replies = 2 * N;
+    z_credit_channel_reply_new(&closure, &handler, 1);
+    credit_get_t get = {.session = z_loan(s), .keyexpr = z_loan(ke), .closure = &closure};
+    z_owned_task_t task;
+    assert(z_task_init(&task, NULL, credit_get, &get) == Z_OK);
+    for (size_t i = 0; i < n_replies; i++) {
+        assert(z_recv(z_loan(handler), &reply) == Z_OK);
+        assert(z_reply_is_ok(z_loan(reply)));
+        z_drop(z_move(reply));
+        assert(z_credit_handler_reply_credit(z_loan(handler)) == 0);
+        z_credit_handler_reply_grant(z_loan(handler), 1);
+    }
+    assert(z_task_join(z_move(task)) == Z_OK);
+    assert(z_recv(z_loan(handler), &reply) == Z_CHANNEL_DISCONNECTED);
+    z_drop(z_move(handler));
+
+    z_drop(z_move(qable));
+    z_drop(z_move(s));
+}
+
+void put_str(const z_loaned_session_t* s, const char* key, const char* value) {
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, key);
+    z_owned_bytes_t payload;
+    z_bytes_copy_from_str(&payload, value);
+    z_put(s, z_loan(ke), z_move(payload), NULL);
+}
+
+void recv_str(const z_loaned_conflating_handler_sample_t* handler, const char* key, const char* value) {
+    z_owned_sample_t sample;
+    assert(z_try_recv(handler, &sample) == Z_OK);
+    z_view_string_t k;
+    z_keyexpr_as_view_string(z_sample_keyexpr(z_loan(sample)), &k);
+    assert(z_string_len(z_loan(k)) == strlen(key));
+    assert(strncmp(z_string_data(z_loan(k)), key, strlen(key)) == 0);
+    z_owned_string_t v;
+    z_bytes_to_string(z_sample_payload(z_loan(sample)), &v);
+    assert(z_string_len(z_loan(v)) == strlen(value));
+    assert(strncmp(z_string_data(z_loan(v)), value, strlen(value)) == 0);
+    z_drop(z_move(v));
+    z_drop(z_move(sample));
+}
+
+void test_conflating_channel() {
+    z_owned_config_t c;
+    z_config_default(&c);
+    z_owned_session_t s;
+    assert(z_open(&s, z_move(c), NULL) == Z_OK);
+
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, "zenoh/channels/conflating/*");
+    z_owned_closure_sample_t closure;
+    z_owned_conflating_handler_sample_t handler;
+    z_conflating_channel_sample_new(&closure, &handler, false);
+    z_owned_subscriber_t sub;
+    assert(z_declare_subscriber(z_loan(s), &sub, z_loan(ke), z_move(closure), NULL) == Z_OK);
+    z_sleep_s(1);
+
+    z_owned_sample_t sample;
+    assert(z_try_recv(z_loan(handler), &sample) == Z_CHANNEL_NODATA);
+    assert(!z_internal_check(sample));
+
+    // a burst on a hot key replaces its pending sample, and does not push out the quiet key
+    put_str(z_loan(s), "zenoh/channels/conflating/hot", "1");
+    put_str(z_loan(s), "zenoh/channels/conflating/quiet", "a");
+    for (size_t i = 2; i <= 100; i++) {
+        char value[4];
+        snprintf(value, sizeof(value), "%zu", i);
+        put_str(z_loan(s), "zenoh/channels/conflating/hot", value);
+    }
+    z_sleep_s(1);
+    recv_str(z_loan(handler), "zenoh/channels/conflating/hot", "100");
+    recv_str(z_loan(handler), "zenoh/channels/conflating/quiet", "a");
+    assert(z_try_recv(z_loan(handler), &sample) == Z_CHANNEL_NODATA);
+
+    // once received, a key is queued again behind the pending keys
+    put_str(z_loan(s), "zenoh/channels/conflating/quiet", "b");
+    put_str(z_loan(s), "zenoh/channels/conflating/hot", "101");
+    z_sleep_s(1);
+    z_drop(z_move(sub));
+    recv_str(z_loan(handler), "zenoh/channels/conflating/quiet", "b");
+    recv_str(z_loan(handler), "zenoh/channels/conflating/hot", "101");
+    assert(z_recv(z_loan(handler), &sample) == Z_CHANNEL_DISCONNECTED);
+
+    z_drop(z_move(handler));
+    z_drop(z_move(s));
+}
+
+void put_with_priority(const z_loaned_session_t* s, const char* key, const char* value, z_priority_t priority) {
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, key);
+    z_owned_bytes_t payload;
+    z_bytes_copy_from_str(&payload, value);
+    z_put_options_t opts;
+    z_put_options_default(&opts);
+    opts.priority = priority;
+    z_put(s, z_loan(ke), z_move(payload), &opts);
+}
+
+void recv_priority(const z_loaned_priority_handler_sample_t* handler, z_priority_t priority, const char* value) {
+    z_owned_sample_t sample;
+    assert(z_try_recv(handler, &sample) == Z_OK);
+    assert(z_sample_priority(z_loan(sample)) == priority);
+    z_owned_string_t v;
+    z_bytes_to_string(z_sample_payload(z_loan(sample)), &v);
+    assert(z_string_len(z_loan(v)) == strlen(value));
+    assert(strncmp(z_string_data(z_loan(v)), value, strlen(value)) == 0);
+    z_drop(z_move(v));
+    z_drop(z_move(sample));
+}
+
+void test_priority_channel() {
+    z_owned_config_t c;
+    z_config_default(&c);
+    z_owned_session_t s;
+    assert(z_open(&s, z_move(c), NULL) == Z_OK);
+
+    const char* key = "zenoh/channels/priority";
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, key);
+    zc_priority_channel_options_t opts;
+    zc_priority_channel_options_default(&opts);
+    opts.levels[Z_PRIORITY_BACKGROUND - Z_PRIORITY_REAL_TIME].capacity = 2;
+    opts.levels[Z_PRIORITY_DATA - Z_PRIORITY_REAL_TIME].capacity = 1;
+    opts.levels[Z_PRIORITY_DATA - Z_PRIORITY_REAL_TIME].overflow = ZC_PRIORITY_OVERFLOW_DROP_NEWEST;
+    z_owned_closure_sample_t closure;
+    z_owned_priority_handler_sample_t handler;
+    z_priority_channel_sample_new(&closure, &handler, &opts);
+    z_owned_subscriber_t sub;
+    assert(z_declare_subscriber(z_loan(s), &sub, z_loan(ke), z_move(closure), NULL) == Z_OK);
+    z_sleep_s(1);
+
+    z_owned_sample_t sample;
+    assert(z_try_recv(z_loan(handler), &sample) == Z_CHANNEL_NODATA);
+    assert(!z_internal_check(sample));
+
+    // real-time samples overtake the pending background ones, full levels apply their own overflow policy
+    put_with_priority(z_loan(s), key, "b1", Z_PRIORITY_BACKGROUND);
+    put_with_priority(z_loan(s), key, "b2", Z_PRIORITY_BACKGROUND);
+    put_with_priority(z_loan(s), key, "b3", Z_PRIORITY_BACKGROUND);
+    put_with_priority(z_loan(s), key, "d1", Z_PRIORITY_DATA);
+    put_with_priority(z_loan(s), key, "d2", Z_PRIORITY_DATA);
+    put_with_priority(z_loan(s), key, "r1", Z_PRIORITY_REAL_TIME);
+    z_sleep_s(1);
+    z_drop(z_move(sub));
+    recv_priority(z_loan(handler), Z_PRIORITY_REAL_TIME, "r1");
+    recv_priority(z_loan(handler), Z_PRIORITY_DATA, "d1");
+    recv_priority(z_loan(handler), Z_PRIORITY_BACKGROUND, "b2");
+    recv_priority(z_loan(handler), Z_PRIORITY_BACKGROUND, "b3");
+    assert(z_recv(z_loan(handler), &sample) == Z_CHANNEL_DISCONNECTED);
+    z_drop(z_move(handler));
+
+    // weighted mode serves the lower levels in turn
+    zc_priority_channel_options_default(&opts);
+    opts.weighted = true;
+    opts.levels[Z_PRIORITY_REAL_TIME - Z_PRIORITY_REAL_TIME].weight = 2;
+    opts.levels[Z_PRIORITY_BACKGROUND - Z_PRIORITY_REAL_TIME].weight = 1;
+    z_priority_channel_sample_new(&closure, &handler, &opts);
+    assert(z_declare_subscriber(z_loan(s), &sub, z_loan(ke), z_move(closure), NULL) == Z_OK);
+    z_sleep_s(1);
+    put_with_priority(z_loan(s), key, "b1", Z_PRIORITY_BACKGROUND);
+    put_with_priority(z_loan(s), key, "b2", Z_PRIORITY_BACKGROUND);
+    for (size_t i = 1; i <= 4; i++) {
+        char value[4];
+        snprintf(value, sizeof(value), "r%zu", i);
+        put_with_priority(z_loan(s), key, value, Z_PRIORITY_REAL_TIME);
+    }
+    z_sleep_s(1);
+    z_drop(z_move(sub));
+    recv_priority(z_loan(handler), Z_PRIORITY_REAL_TIME, "r1");
+    recv_priority(z_loan(handler), Z_PRIORITY_REAL_TIME, "r2");
+    recv_priority(z_loan(handler), Z_PRIORITY_BACKGROUND, "b1");
+    recv_priority(z_loan(handler), Z_PRIORITY_REAL_TIME, "r3");
+    recv_priority(z_loan(handler), Z_PRIORITY_REAL_TIME, "r4");
+    recv_priority(z_loan(handler), Z_PRIORITY_BACKGROUND, "b2");
+    assert(z_recv(z_loan(handler), &sample) == Z_CHANNEL_DISCONNECTED);
+
+    z_drop(z_move(handler));
+    z_drop(z_move(s));
+}
+#endif
+
+int main(int argc, char** argv) {
+#if defined(Z_FEATURE_UNSTABLE_API)
+    test_recv_spin();
+    test_fifo_recv_many();
+    test_ring_recv_many();
+    test_reply_recv_many();
+    test_query_recv_many();
+    test_spsc_channel();
+    test_credit_channel();
+    test_conflating_channel();
+    test_priority_channel();
+#endif
+    return 0;
+}
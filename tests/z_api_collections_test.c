@@ -0,0 +1,85 @@
+//
+// Copyright (c) 2024 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "zenoh.h"
+
+#undef NDEBUG
+#include <assert.h>
+
+#if defined(Z_FEATURE_UNSTABLE_API)
+void assert_arena_get(const zc_loaned_string_arena_t *arena, size_t index, const char *expected) {
+    z_view_string_t s;
+    assert(zc_string_arena_get(arena, index, &s) == Z_OK);
+    assert(z_string_len(z_loan(s)) == strlen(expected));
+    // the views are null-terminated
+    assert(strcmp(z_string_data(z_loan(s)), expected) == 0);
+}
+
+size_t arena_push_str(zc_loaned_string_arena_t *arena, const char *value) {
+    z_view_string_t s;
+    z_view_string_from_str(&s, value);
+    return zc_string_arena_push(arena, z_loan(s));
+}
+#endif
+
+void test_string_arena(void) {
+#if defined(Z_FEATURE_UNSTABLE_API)
+    zc_owned_string_arena_t arena;
+    zc_string_arena_new(&arena);
+    assert(zc_string_arena_is_empty(z_loan(arena)));
+    assert(zc_string_arena_len(z_loan(arena)) == 0);
+
+    z_view_string_t s;
+    assert(zc_string_arena_get(z_loan(arena), 0, &s) == Z_EINVAL);
+    assert(z_string_len(z_loan(s)) == 0);
+
+    zc_string_arena_reserve(z_loan_mut(arena), 3, 16);
+    assert(zc_string_arena_is_empty(z_loan(arena)));
+    assert(arena_push_str(z_loan_mut(arena), "tcp/127.0.0.1:7447") == 1);
+    assert(arena_push_str(z_loan_mut(arena), "") == 2);
+    assert(arena_push_str(z_loan_mut(arena), "udp/[::1]:7447") == 3);
+    assert(!zc_string_arena_is_empty(z_loan(arena)));
+    assert(zc_string_arena_len(z_loan(arena)) == 3);
+    assert_arena_get(z_loan(arena), 0, "tcp/127.0.0.1:7447");
+    assert_arena_get(z_loan(arena), 1, "");
+    assert_arena_get(z_loan(arena), 2, "udp/[::1]:7447");
+    assert(zc_string_arena_get(z_loan(arena), 3, &s) == Z_EINVAL);
+    assert(z_string_len(z_loan(s)) == 0);
+
+    // the clone owns a copy of the strings
+    zc_owned_string_arena_t clone;
+    zc_string_arena_clone(&clone, z_loan(arena));
+    zc_string_arena_clear(z_loan_mut(arena));
+    assert(zc_string_arena_is_empty(z_loan(arena)));
+    assert(zc_string_arena_get(z_loan(arena), 0, &s) == Z_EINVAL);
+    assert(arena_push_str(z_loan_mut(arena), "other") == 1);
+    assert_arena_get(z_loan(arena), 0, "other");
+    assert(zc_string_arena_len(z_loan(clone)) == 3);
+    assert_arena_get(z_loan(clone), 0, "tcp/127.0.0.1:7447");
+    assert_arena_get(z_loan(clone), 2, "udp/[::1]:7447");
+
+    z_drop(z_move(arena));
+    assert(!z_internal_check(arena));
+    assert_arena_get(z_loan(clone), 1, "");
+    z_drop(z_move(clone));
+    assert(!z_internal_check(clone));
+    // dropping a dropped arena is a no-op
+    z_drop(z_move(clone));
+#endif
+}
+
+int main(int argc, char **argv) { test_string_arena(); }
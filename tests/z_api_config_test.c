@@ -36,7 +36,65 @@ void insert_get() {
     z_drop(z_move(config));
 }
 
+#if defined(Z_FEATURE_UNSTABLE_API)
+void cached_locators() {
+    const char *path = "z_api_config_test_locators.txt";
+    FILE *f = fopen(path, "w");
+    assert(f != NULL);
+    fputs("tcp/127.0.0.1:7447\ntcp/10.0.0.1:7447\n", f);
+    fclose(f);
+
+    z_owned_config_t config;
+    z_config_default(&config);
+    zc_config_insert_json5(z_loan_mut(config), "connect/endpoints", "[\"tcp/10.0.0.1:7447\", \"tcp/10.0.0.2:7447\"]");
+    assert(zc_config_insert_cached_locators(z_loan_mut(config), path) == Z_OK);
+    // cached locators come first, without duplicates
+    z_owned_string_t endpoints;
+    zc_config_get_from_str(z_loan(config), "connect/endpoints", &endpoints);
+    const char *expected = "[\"tcp/127.0.0.1:7447\",\"tcp/10.0.0.1:7447\",\"tcp/10.0.0.2:7447\"]";
+    assert(z_string_len(z_loan(endpoints)) == strlen(expected));
+    assert(strncmp(z_string_data(z_loan(endpoints)), expected, z_string_len(z_loan(endpoints))) == 0);
+    z_drop(z_move(endpoints));
+
+    remove(path);
+    assert(zc_config_insert_cached_locators(z_loan_mut(config), path) == Z_EUNAVAILABLE);
+    z_drop(z_move(config));
+}
+
+void blob() {
+    z_owned_config_t config;
+    assert(zc_config_from_str(&config, "{mode:'client',connect:{endpoints:['tcp/127.0.0.1:7447']}}") == Z_OK);
+    z_owned_slice_t b;
+    assert(zc_config_to_blob(z_loan(config), &b) == Z_OK);
+    z_owned_string_t expected;
+    zc_config_to_string(z_loan(config), &expected);
+    z_drop(z_move(config));
+
+    assert(zc_config_from_blob(&config, z_slice_data(z_loan(b)), z_slice_len(z_loan(b))) == Z_OK);
+    z_owned_string_t loaded;
+    zc_config_to_string(z_loan(config), &loaded);
+    assert(z_string_len(z_loan(loaded)) == z_string_len(z_loan(expected)));
+    assert(strncmp(z_string_data(z_loan(loaded)), z_string_data(z_loan(expected)), z_string_len(z_loan(loaded))) == 0);
+    z_drop(z_move(loaded));
+    z_drop(z_move(expected));
+    z_drop(z_move(config));
+
+    // blobs are rejected if they were not produced by zc_config_to_blob
+    const char *json = "{\"mode\":\"client\"}";
+    assert(zc_config_from_blob(&config, (const uint8_t *)json, strlen(json)) == Z_EINVAL);
+    assert(!z_internal_check(config));
+    // or if they are truncated
+    assert(zc_config_from_blob(&config, z_slice_data(z_loan(b)), z_slice_len(z_loan(b)) - 1) == Z_EPARSE);
+    assert(!z_internal_check(config));
+    z_drop(z_move(b));
+}
+#endif
+
 int main(int argc, char **argv) {
     zc_try_init_log_from_env();
     insert_get();
+#if defined(Z_FEATURE_UNSTABLE_API)
+    cached_locators();
+    blob();
+#endif
 }
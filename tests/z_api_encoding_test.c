@@ -114,6 +114,30 @@ void test_equals() {
     z_drop(z_move(e));
 }
 
+void test_interned() {
+#if defined(Z_FEATURE_UNSTABLE_API)
+    const zc_interned_encoding_t *e1, *e2, *e3, *found;
+    assert(zc_encoding_intern_from_str("application/protobuf;test.Message", &e1) == Z_OK);
+    assert(zc_encoding_intern(z_encoding_zenoh_string(), &e2) == Z_OK);
+    assert(e1->id != e2->id);
+    assert(e1->schema_hash != 0);
+    assert(e2->schema_hash == 0);
+
+    // interning the same encoding again returns the same handle
+    z_owned_encoding_t e;
+    z_encoding_from_str(&e, "application/protobuf;test.Message");
+    assert(zc_encoding_intern(z_loan(e), &e3) == Z_OK);
+    assert(e3 == e1);
+    assert(zc_encoding_find_interned(z_loan(e), &found) == Z_OK);
+    assert(found == e1);
+    assert(z_encoding_equals(found->encoding, z_loan(e)));
+    z_drop(z_move(e));
+
+    assert(zc_encoding_find_interned(z_encoding_text_plain(), &found) == Z_EUNAVAILABLE);
+    assert(found == NULL);
+#endif
+}
+
 int main(int argc, char **argv) {
     test_null_encoding();
     test_encoding_without_id();
@@ -121,4 +145,5 @@ int main(int argc, char **argv) {
     test_constants();
     test_with_schema();
     test_equals();
+    test_interned();
 }
@@ -63,6 +63,33 @@ void canonize() {
     assert(strncmp(z_string_data(z_loan(key_exp_canonized_bytes)), "a/**/c", len_new) == 0);
 }
 
+void is_canon_long() {
+    char keyexpr[64];
+    const char *base = "fleet/device-0123456789/sensors/temperature/raw";
+    size_t len = strlen(base);
+    assert(z_keyexpr_is_canon(base, len) == Z_OK);
+    // Invalid characters and empty chunks are detected at any position, including across 8-byte words
+    const char specials[] = {'*', '$', '#', '?'};
+    for (size_t i = 0; i < len; i++) {
+        for (size_t j = 0; j < sizeof(specials); j++) {
+            strcpy(keyexpr, base);
+            keyexpr[i] = specials[j];
+            assert(z_keyexpr_is_canon(keyexpr, len) != Z_OK || specials[j] == '*');
+        }
+        strcpy(keyexpr, base);
+        if (keyexpr[i] != '/' && (i == 0 || keyexpr[i - 1] == '/' || keyexpr[i + 1] == '/')) {
+            keyexpr[i] = '/';
+            assert(z_keyexpr_is_canon(keyexpr, len) != Z_OK);
+        }
+    }
+    strcpy(keyexpr, "fleet/device-0123456789/**/**/raw");
+    len = strlen(keyexpr);
+    assert(z_keyexpr_is_canon(keyexpr, len) != Z_OK);
+    assert(z_keyexpr_canonize(keyexpr, &len) == Z_OK);
+    assert(len == strlen("fleet/device-0123456789/**/raw"));
+    assert(strncmp(keyexpr, "fleet/device-0123456789/**/raw", len) == 0);
+}
+
 void includes() {
     z_view_keyexpr_t foobar, foostar;
     z_view_keyexpr_from_str(&foobar, "foo/bar");
@@ -109,14 +136,131 @@ void relation_to() {
     assert(z_keyexpr_relation_to(z_loan(foostar), z_loan(foostar)) == Z_KEYEXPR_INTERSECTION_LEVEL_EQUALS);
     assert(z_keyexpr_relation_to(z_loan(barstar), z_loan(foobar)) == Z_KEYEXPR_INTERSECTION_LEVEL_DISJOINT);
 }
+
+void set_bit(size_t index, void *context) { *(uint32_t *)context |= 1u << index; }
+
+void matcher() {
+    const char *exprs[] = {"a/b/c", "a/*/c", "a/**", "a/b/c", "x/y", "**"};
+    z_view_keyexpr_t kes[6];
+    const z_loaned_keyexpr_t *loaned[6];
+    for (size_t i = 0; i < 6; i++) {
+        z_view_keyexpr_from_str(&kes[i], exprs[i]);
+        loaned[i] = z_loan(kes[i]);
+    }
+    zc_owned_keyexpr_matcher_t m;
+    assert(zc_keyexpr_matcher_new(&m, loaned, 6) == Z_OK);
+    assert(zc_keyexpr_matcher_len(z_loan(m)) == 6);
+
+    z_view_keyexpr_t abc, astar, ab, xystar;
+    z_view_keyexpr_from_str(&abc, "a/b/c");
+    z_view_keyexpr_from_str(&astar, "a/*");
+    z_view_keyexpr_from_str(&ab, "a/b");
+    z_view_keyexpr_from_str(&xystar, "x/y/*");
+
+    uint32_t mask = 0;
+    assert(zc_keyexpr_matcher_intersects(z_loan(m), z_loan(abc), set_bit, &mask) == 5);
+    assert(mask == 0x2f);
+    mask = 0;
+    assert(zc_keyexpr_matcher_intersects(z_loan(m), z_loan(astar), set_bit, &mask) == 2);
+    assert(mask == 0x24);
+    mask = 0;
+    assert(zc_keyexpr_matcher_intersects(z_loan(m), z_loan(xystar), set_bit, &mask) == 1);
+    assert(mask == 0x20);
+    assert(zc_keyexpr_matcher_intersects(z_loan(m), z_loan(ab), NULL, NULL) == 2);
+
+    mask = 0;
+    assert(zc_keyexpr_matcher_includes(z_loan(m), z_loan(abc), set_bit, &mask) == 5);
+    assert(mask == 0x2f);
+    mask = 0;
+    assert(zc_keyexpr_matcher_includes(z_loan(m), z_loan(astar), set_bit, &mask) == 2);
+    assert(mask == 0x24);
+
+    z_drop(z_move(m));
+    assert(!zc_internal_keyexpr_matcher_check(&m));
+}
+
+void hash() {
+    z_view_keyexpr_t foobar, foobar2, foostar;
+    z_view_keyexpr_from_str(&foobar, "foo/bar");
+    z_view_keyexpr_from_str(&foobar2, "foo/bar");
+    z_view_keyexpr_from_str(&foostar, "foo/*");
+
+    assert(z_keyexpr_hash(z_loan(foobar)) == 0x571d17d6ef2def0dULL);
+    assert(z_keyexpr_hash(z_loan(foobar)) == z_keyexpr_hash(z_loan(foobar2)));
+    assert(z_keyexpr_hash(z_loan(foobar)) != z_keyexpr_hash(z_loan(foostar)));
+}
+
+void interner() {
+    z_view_keyexpr_t foobar, foostar;
+    z_view_keyexpr_from_str(&foobar, "foo/bar");
+    z_view_keyexpr_from_str(&foostar, "foo/*");
+
+    zc_owned_keyexpr_interner_t interner;
+    assert(zc_keyexpr_interner_new(&interner) == Z_OK);
+    uint32_t id = 42;
+    assert(zc_keyexpr_interner_find(z_loan(interner), z_loan(foobar), &id) == Z_EUNAVAILABLE);
+    assert(zc_keyexpr_interner_intern(z_loan(interner), z_loan(foobar), &id) == Z_OK);
+    assert(id == 0);
+    assert(zc_keyexpr_interner_intern(z_loan(interner), z_loan(foostar), &id) == Z_OK);
+    assert(id == 1);
+    assert(zc_keyexpr_interner_intern(z_loan(interner), z_loan(foobar), &id) == Z_OK);
+    assert(id == 0);
+    assert(zc_keyexpr_interner_find(z_loan(interner), z_loan(foostar), &id) == Z_OK);
+    assert(id == 1);
+    assert(zc_keyexpr_interner_len(z_loan(interner)) == 2);
+
+    z_owned_keyexpr_t ke;
+    assert(zc_keyexpr_interner_get(z_loan(interner), 1, &ke) == Z_OK);
+    assert(z_keyexpr_equals(z_loan(ke), z_loan(foostar)));
+    z_drop(z_move(ke));
+    assert(zc_keyexpr_interner_get(z_loan(interner), 2, &ke) == Z_EINVAL);
+    assert(!z_internal_check(ke));
+
+    z_drop(z_move(interner));
+    assert(!zc_internal_keyexpr_interner_check(&interner));
+}
+
+void concat_join_view() {
+    char buf[64];
+    z_view_keyexpr_t foo, bar, dstar, ke;
+    z_view_keyexpr_from_str(&foo, "foo");
+    z_view_keyexpr_from_str(&bar, "bar/*");
+    z_view_keyexpr_from_str(&dstar, "**");
+    z_view_string_t s;
+
+    assert(z_view_keyexpr_concat(&ke, buf, sizeof(buf), z_loan(foo), "/12", 3) == Z_OK);
+    z_keyexpr_as_view_string(z_loan(ke), &s);
+    assert(z_string_len(z_loan(s)) == 6);
+    assert(strncmp(z_string_data(z_loan(s)), "foo/12", 6) == 0);
+    assert(z_view_keyexpr_concat(&ke, buf, 5, z_loan(foo), "/12", 3) == Z_EINVAL);
+    assert(z_view_keyexpr_is_empty(&ke));
+
+    assert(z_view_keyexpr_join(&ke, buf, sizeof(buf), z_loan(foo), z_loan(bar)) == Z_OK);
+    z_keyexpr_as_view_string(z_loan(ke), &s);
+    assert(z_string_len(z_loan(s)) == 9);
+    assert(strncmp(z_string_data(z_loan(s)), "foo/bar/*", 9) == 0);
+    assert(z_view_keyexpr_join(&ke, buf, 8, z_loan(foo), z_loan(bar)) == Z_EINVAL);
+
+    // joining ** with ** requires canonization
+    z_view_keyexpr_t dd;
+    assert(z_view_keyexpr_join(&dd, buf, sizeof(buf), z_loan(dstar), z_loan(dstar)) == Z_OK);
+    z_keyexpr_as_view_string(z_loan(dd), &s);
+    assert(z_string_len(z_loan(s)) == 2);
+    assert(strncmp(z_string_data(z_loan(s)), "**", 2) == 0);
+}
 #endif
 
 int main(int argc, char **argv) {
     canonize();
+    is_canon_long();
     includes();
     intersects();
     undeclare();
 #if defined(Z_FEATURE_UNSTABLE_API)
     relation_to();
+    matcher();
+    hash();
+    interner();
+    concat_join_view();
 #endif
 }
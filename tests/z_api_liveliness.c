@@ -142,7 +142,96 @@ void test_liveliness_get() {
     z_drop(z_move(s2));
 }
 
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct snapshot_context_t {
+    int snapshots;
+    size_t snapshot_len;
+    bool token1_alive;
+    bool token2_alive;
+} snapshot_context_t;
+
+static bool tokens_contain(const zc_liveliness_tokens_t* tokens, const char* expr) {
+    for (size_t i = 0; i < tokens->len; i++) {
+        z_view_keyexpr_t k;
+        assert(zc_liveliness_tokens_get(tokens, i, &k) == Z_OK);
+        z_view_string_t ks;
+        z_keyexpr_as_view_string(z_loan(k), &ks);
+        if (strlen(expr) == z_string_len(z_loan(ks)) &&
+            strncmp(expr, z_string_data(z_loan(ks)), z_string_len(z_loan(ks))) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void on_changes(const zc_liveliness_changes_t* changes, void* context) {
+    snapshot_context_t* c = (snapshot_context_t*)context;
+    if (changes->is_snapshot) {
+        c->snapshots++;
+        c->snapshot_len = changes->joined.len;
+        assert(changes->left.len == 0);
+    }
+    if (tokens_contain(&changes->joined, token1_expr)) c->token1_alive = true;
+    if (tokens_contain(&changes->joined, token2_expr)) c->token2_alive = true;
+    if (tokens_contain(&changes->left, token1_expr)) c->token1_alive = false;
+    if (tokens_contain(&changes->left, token2_expr)) c->token2_alive = false;
+}
+
+void test_liveliness_snapshot_sub() {
+    const char* expr = "zenoh/liveliness/test/*";
+
+    z_owned_session_t s1, s2;
+    z_owned_config_t c1, c2;
+    z_config_default(&c1);
+    z_config_default(&c2);
+    z_view_keyexpr_t k, k1, k2;
+    z_view_keyexpr_from_str(&k, expr);
+    z_view_keyexpr_from_str(&k1, token1_expr);
+    z_view_keyexpr_from_str(&k2, token2_expr);
+
+    z_open(&s1, z_move(c1), NULL);
+    z_open(&s2, z_move(c2), NULL);
+
+    z_sleep_s(1);
+    z_owned_liveliness_token_t t1, t2;
+    z_liveliness_declare_token(z_loan(s1), &t1, z_loan(k1), NULL);
+    z_sleep_s(1);
+
+    zc_owned_closure_liveliness_changes_t closure;
+    snapshot_context_t context = {0, 0, false, false};
+    z_closure(&closure, on_changes, NULL, (void*)(&context));
+
+    z_owned_subscriber_t sub;
+    assert(zc_liveliness_declare_snapshot_subscriber(z_loan(s2), &sub, z_loan(k), z_move(closure), NULL) == Z_OK);
+    z_sleep_s(1);
+
+    // the token declared before the subscriber is delivered in the snapshot
+    assert(context.snapshots == 1);
+    assert(context.snapshot_len == 1);
+    assert(context.token1_alive);
+    assert(!context.token2_alive);
+
+    z_liveliness_declare_token(z_loan(s1), &t2, z_loan(k2), NULL);
+    z_sleep_s(1);
+    assert(context.token2_alive);
+
+    z_liveliness_undeclare_token(z_move(t1));
+    z_sleep_s(1);
+    assert(!context.token1_alive);
+    assert(context.token2_alive);
+    assert(context.snapshots == 1);
+
+    z_drop(z_move(sub));
+    z_drop(z_move(t2));
+    z_drop(z_move(s1));
+    z_drop(z_move(s2));
+}
+#endif
+
 int main(int argc, char** argv) {
     test_liveliness_sub();
     test_liveliness_get();
+#if defined(Z_FEATURE_UNSTABLE_API)
+    test_liveliness_snapshot_sub();
+#endif
 }
@@ -59,6 +59,9 @@ int main(void) {
 #endif
     TEST(z_owned_string_t)
     TEST(z_owned_string_array_t)
+#if defined(Z_FEATURE_UNSTABLE_API)
+    TEST(zc_owned_string_arena_t)
+#endif
     TEST(z_owned_sample_t)
     TEST(z_owned_query_t)
     TEST(z_owned_slice_t)
@@ -14,6 +14,7 @@
 #include <assert.h>
 #include <stddef.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "zenoh.h"
@@ -315,6 +316,358 @@ void test_serialize_sequence(void) {
     z_drop(z_move(b));
 }
 
+void test_serialize_array(void) {
+    float input[] = {0.0f, 1.5f, -2.25f, 3.0f, 1e10f, -1e-10f};
+    z_owned_bytes_t b;
+    ze_owned_serializer_t serializer;
+    ze_serializer_empty(&serializer);
+    assert(ze_serializer_serialize_array_float(z_loan_mut(serializer), input, 6) == 0);
+    assert(ze_serializer_serialize_sequence_length(z_loan_mut(serializer), 3) == 0);
+    for (size_t i = 0; i < 3; ++i) {
+        ze_serializer_serialize_uint64(z_loan_mut(serializer), (uint64_t)i);
+    }
+    ze_serializer_finish(z_move(serializer), &b);
+
+    ze_deserializer_t deserializer = ze_deserializer_from_bytes(z_loan(b));
+    size_t len = 0;
+    assert(ze_deserializer_deserialize_sequence_length(&deserializer, &len) == 0);
+    assert(len == 6);
+    for (size_t i = 0; i < 6; i++) {
+        float f = 0;
+        assert(ze_deserializer_deserialize_float(&deserializer, &f) == 0);
+        assert(f == input[i]);
+    }
+    uint64_t output[3] = {0};
+    assert(ze_deserializer_deserialize_array_uint64(&deserializer, output, 3, &len) == 0);
+    assert(len == 3);
+    for (size_t i = 0; i < 3; i++) {
+        assert(output[i] == i);
+    }
+    assert(ze_deserializer_is_done(&deserializer));
+
+    float output_f[6] = {0};
+    deserializer = ze_deserializer_from_bytes(z_loan(b));
+    assert(ze_deserializer_deserialize_array_float(&deserializer, output_f, 6, &len) == 0);
+    assert(len == 6);
+    assert(memcmp(input, output_f, sizeof(input)) == 0);
+
+    deserializer = ze_deserializer_from_bytes(z_loan(b));
+    assert(ze_deserializer_deserialize_array_float(&deserializer, output_f, 5, &len) != 0);
+    assert(len == 6);
+    z_drop(z_move(b));
+}
+
+#if defined(Z_FEATURE_UNSTABLE_API)
+void test_iovec(void) {
+    uint8_t header[] = {0, 1, 2};
+    uint8_t body[] = {3, 4, 5, 6, 7};
+    uint8_t trailer[] = {8, 9};
+    z_iovec_t iov[3] = {{header, sizeof(header)}, {body, sizeof(body)}, {trailer, sizeof(trailer)}};
+    size_t cnt = 0;
+
+    z_owned_bytes_t payload;
+    assert(z_bytes_from_iovec(&payload, iov, 3, custom_deleter, &cnt) == 0);
+    assert(z_bytes_len(z_loan(payload)) == 10);
+
+    z_bytes_slice_iterator_t it = z_bytes_get_slice_iterator(z_loan(payload));
+    z_view_slice_t s;
+    for (size_t i = 0; i < 3; i++) {
+        assert(z_bytes_slice_iterator_next(&it, &s));
+        assert(z_slice_data(z_loan(s)) == iov[i].data);
+        assert(z_slice_len(z_loan(s)) == iov[i].len);
+    }
+    assert(!z_bytes_slice_iterator_next(&it, &s));
+    assert(cnt == 0);
+    z_drop(z_move(payload));
+    assert(cnt == 3);
+
+    z_iovec_t invalid[1] = {{NULL, 1}};
+    assert(z_bytes_from_iovec(&payload, invalid, 1, custom_deleter, &cnt) != 0);
+    assert(cnt == 3);
+}
+
+void test_get_iovec(void) {
+    uint8_t data[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    z_iovec_t iov[3] = {{data, 3}, {data + 3, 5}, {data + 8, 2}};
+
+    z_owned_bytes_t payload;
+    assert(z_bytes_from_iovec(&payload, iov, 3, NULL, NULL) == 0);
+
+    z_iovec_t out[3];
+    size_t n = 0;
+    assert(z_bytes_get_iovec(z_loan(payload), out, 3, &n) == 0);
+    assert(n == 3);
+    for (size_t i = 0; i < 3; i++) {
+        assert(out[i].data == iov[i].data);
+        assert(out[i].len == iov[i].len);
+    }
+
+    n = 0;
+    assert(z_bytes_get_iovec(z_loan(payload), out, 2, &n) != 0);
+    assert(n == 3);
+    assert(out[1].data == iov[1].data);
+
+    n = 0;
+    assert(z_bytes_get_iovec(z_loan(payload), NULL, 0, &n) != 0);
+    assert(n == 3);
+    z_drop(z_move(payload));
+
+    z_bytes_empty(&payload);
+    assert(z_bytes_get_iovec(z_loan(payload), out, 3, &n) == 0);
+    assert(n == 0);
+    z_drop(z_move(payload));
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+#define FILE_LEN 200000
+#define FILE_OFFSET 5000
+
+void test_from_file(void) {
+    const char *path = "z_api_payload_test_file.bin";
+    uint8_t *data = (uint8_t *)malloc(FILE_LEN);
+    for (size_t i = 0; i < FILE_LEN; i++) {
+        data[i] = (uint8_t)(i * 7);
+    }
+    FILE *f = fopen(path, "wb");
+    assert(f != NULL);
+    assert(fwrite(data, 1, FILE_LEN, f) == FILE_LEN);
+    fclose(f);
+
+    // the region does not need to start at a page boundary
+    z_owned_bytes_t payload;
+    assert(z_bytes_from_file(&payload, path, FILE_OFFSET, 0) == Z_OK);
+    assert(z_bytes_len(z_loan(payload)) == FILE_LEN - FILE_OFFSET);
+    z_bytes_slice_iterator_t it = z_bytes_get_slice_iterator(z_loan(payload));
+    z_view_slice_t s;
+    size_t n = 0, len = 0;
+    while (z_bytes_slice_iterator_next(&it, &s)) {
+        assert(z_slice_len(z_loan(s)) <= 65535);
+        assert(memcmp(z_slice_data(z_loan(s)), data + FILE_OFFSET + len, z_slice_len(z_loan(s))) == 0);
+        len += z_slice_len(z_loan(s));
+        n++;
+    }
+    assert(len == FILE_LEN - FILE_OFFSET);
+    assert(n == 3);
+
+    // the mapping outlives the file
+    remove(path);
+    z_owned_bytes_t clone;
+    z_bytes_clone(&clone, z_loan(payload));
+    z_drop(z_move(payload));
+    z_owned_slice_t out;
+    assert(z_bytes_to_slice(z_loan(clone), &out) == Z_OK);
+    assert(memcmp(z_slice_data(z_loan(out)), data + FILE_OFFSET, FILE_LEN - FILE_OFFSET) == 0);
+    z_drop(z_move(out));
+    z_drop(z_move(clone));
+
+    f = fopen(path, "wb");
+    assert(fwrite(data, 1, FILE_LEN, f) == FILE_LEN);
+    fclose(f);
+    assert(z_bytes_from_file(&payload, path, 10, 100) == Z_OK);
+    assert(z_bytes_len(z_loan(payload)) == 100);
+    z_drop(z_move(payload));
+    assert(z_bytes_from_file(&payload, path, FILE_LEN, 0) == Z_OK);
+    assert(z_bytes_len(z_loan(payload)) == 0);
+    z_drop(z_move(payload));
+    assert(z_bytes_from_file(&payload, path, FILE_LEN - 10, 11) == Z_EINVAL);
+    assert(z_bytes_from_file(&payload, path, FILE_LEN + 1, 0) == Z_EINVAL);
+    remove(path);
+    assert(z_bytes_from_file(&payload, path, 0, 0) == Z_EIO);
+    assert(z_bytes_len(z_loan(payload)) == 0);
+    z_drop(z_move(payload));
+    free(data);
+}
+#endif
+
+void test_deserialize_view(void) {
+    z_owned_bytes_t b;
+    ze_serialize_str(&b, "hello world");
+    z_view_string_t vs;
+    assert(ze_deserialize_string_view(z_loan(b), &vs) == 0);
+    assert(z_string_len(z_loan(vs)) == 11);
+    assert(strncmp(z_string_data(z_loan(vs)), "hello world", 11) == 0);
+
+    z_view_slice_t serialized;
+    assert(z_bytes_get_contiguous_view(z_loan(b), &serialized) == 0);
+    const uint8_t *data = z_slice_data(z_loan(serialized));
+    assert(z_string_data(z_loan(vs)) == (const char *)data + 1);
+
+    // the string crosses fragments
+    z_iovec_t iov[2] = {{data, 4}, {data + 4, z_slice_len(z_loan(serialized)) - 4}};
+    z_owned_bytes_t fragmented;
+    assert(z_bytes_from_iovec(&fragmented, iov, 2, NULL, NULL) == 0);
+    assert(ze_deserialize_string_view(z_loan(fragmented), &vs) == Z_EUNAVAILABLE);
+    z_owned_string_t s;
+    assert(ze_deserialize_string(z_loan(fragmented), &s) == 0);
+    assert(z_string_len(z_loan(s)) == 11);
+    z_drop(z_move(s));
+    z_drop(z_move(fragmented));
+
+    // only the length header is in a separate fragment
+    iov[0].len = 1;
+    iov[1].data = data + 1;
+    iov[1].len = 11;
+    assert(z_bytes_from_iovec(&fragmented, iov, 2, NULL, NULL) == 0);
+    z_view_slice_t view;
+    assert(ze_deserialize_slice_view(z_loan(fragmented), &view) == 0);
+    assert(z_slice_data(z_loan(view)) == data + 1);
+    assert(z_slice_len(z_loan(view)) == 11);
+    z_drop(z_move(fragmented));
+
+    z_drop(z_move(b));
+    ze_serialize_uint32(&b, 0xFFFFFFFF);
+    assert(ze_deserialize_slice_view(z_loan(b), &view) != 0);
+    z_drop(z_move(b));
+}
+
+void test_bytes_pool(void) {
+    uint8_t data[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    uint8_t data_out[10] = {0};
+
+    zc_owned_bytes_pool_t pool;
+    assert(zc_bytes_pool_new(&pool, 16, 2) == 0);
+    assert(zc_bytes_pool_size_class(z_loan(pool)) == 16);
+
+    z_owned_bytes_t payload;
+    assert(zc_bytes_pool_acquire(z_loan(pool), &payload, data, 5) == 0);
+    z_owned_bytes_writer_t writer;
+    z_bytes_writer_empty(&writer);
+    z_bytes_writer_append(z_loan_mut(writer), z_move(payload));
+
+    uint8_t *buf = NULL;
+    void *context = NULL;
+    assert(zc_bytes_pool_acquire_buf(z_loan(pool), &buf, &context) == 0);
+    memcpy(buf, data + 5, 5);
+    assert(z_bytes_from_buf(&payload, buf, 5, zc_bytes_pool_release_buf, context) == 0);
+    z_bytes_writer_append(z_loan_mut(writer), z_move(payload));
+    z_bytes_writer_finish(z_move(writer), &payload);
+
+    z_bytes_reader_t reader = z_bytes_get_reader(z_loan(payload));
+    assert(z_bytes_reader_read(&reader, data_out, 10) == 10);
+    assert(!memcmp(data, data_out, 10));
+    z_drop(z_move(payload));
+
+    // released buffers are handed out again
+    assert(zc_bytes_pool_acquire_buf(z_loan(pool), &buf, &context) == 0);
+    uint8_t *released = buf;
+    zc_bytes_pool_release_buf(buf, context);
+    assert(zc_bytes_pool_acquire_buf(z_loan(pool), &buf, &context) == 0);
+    assert(buf == released);
+    zc_bytes_pool_release_buf(buf, context);
+
+    uint8_t too_large[17] = {0};
+    assert(zc_bytes_pool_acquire(z_loan(pool), &payload, too_large, sizeof(too_large)) != 0);
+    assert(!z_internal_check(payload));
+
+    // payloads outlive the pool
+    assert(zc_bytes_pool_acquire(z_loan(pool), &payload, data, 10) == 0);
+    z_drop(z_move(pool));
+    assert(z_check_and_drop_payload(&payload, data, 10));
+}
+
+void test_writer_reserve(void) {
+    uint8_t data[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    z_owned_bytes_writer_t writer;
+    assert(z_bytes_writer_with_capacity(&writer, 16) == 0);
+    uint8_t *buf = NULL;
+    assert(z_bytes_writer_reserve(z_loan_mut(writer), 4, &buf) == 0);
+    memcpy(buf, data, 4);
+    assert(z_bytes_writer_commit(z_loan_mut(writer), 4) == 0);
+    // small writes go into the reserved buffer
+    assert(z_bytes_writer_write_all(z_loan_mut(writer), data + 4, 2) == 0);
+    // a reservation which does not fit starts a new buffer
+    assert(z_bytes_writer_reserve(z_loan_mut(writer), 100, &buf) == 0);
+    memcpy(buf, data + 6, 4);
+    assert(z_bytes_writer_commit(z_loan_mut(writer), 4) == 0);
+    assert(z_bytes_writer_commit(z_loan_mut(writer), 1000) == Z_EINVAL);
+    z_owned_bytes_t payload;
+    z_bytes_writer_finish(z_move(writer), &payload);
+    assert(z_bytes_len(z_loan(payload)) == 10);
+
+    size_t slices = 0;
+    z_bytes_slice_iterator_t it = z_bytes_get_slice_iterator(z_loan(payload));
+    z_view_slice_t s;
+    while (z_bytes_slice_iterator_next(&it, &s)) {
+        slices++;
+    }
+    assert(slices == 2);
+    assert(z_check_and_drop_payload(&payload, data, 10));
+
+    // buffers are acquired from the pool as long as reservations fit into them
+    zc_owned_bytes_pool_t pool;
+    assert(zc_bytes_pool_new(&pool, 8, 2) == 0);
+    assert(zc_bytes_writer_from_pool(&writer, z_loan(pool)) == 0);
+    assert(z_bytes_writer_reserve(z_loan_mut(writer), 8, &buf) == 0);
+    memcpy(buf, data, 8);
+    assert(z_bytes_writer_commit(z_loan_mut(writer), 8) == 0);
+    assert(z_bytes_writer_reserve(z_loan_mut(writer), 2, &buf) == 0);
+    memcpy(buf, data + 8, 2);
+    assert(z_bytes_writer_commit(z_loan_mut(writer), 2) == 0);
+    z_bytes_writer_finish(z_move(writer), &payload);
+    z_drop(z_move(pool));
+    assert(z_bytes_len(z_loan(payload)) == 10);
+    assert(z_check_and_drop_payload(&payload, data, 10));
+}
+
+typedef struct {
+    uint8_t trace_id[16];
+    uint64_t seq;
+    int32_t tenant;
+    bool sampled;
+} metadata_t;
+
+static const ze_field_t METADATA_FIELDS[] = {
+    {ZE_FIELD_TYPE_BYTES, offsetof(metadata_t, trace_id), 16},
+    {ZE_FIELD_TYPE_UINT64, offsetof(metadata_t, seq), 0},
+    {ZE_FIELD_TYPE_INT32, offsetof(metadata_t, tenant), 0},
+    {ZE_FIELD_TYPE_BOOL, offsetof(metadata_t, sampled), 0},
+};
+#define METADATA_FIELDS_LEN (sizeof(METADATA_FIELDS) / sizeof(METADATA_FIELDS[0]))
+
+void test_serialize_struct(void) {
+    metadata_t in = {.seq = 1234567890123ull, .tenant = -42, .sampled = true};
+    for (uint8_t i = 0; i < 16; i++) {
+        in.trace_id[i] = i;
+    }
+    z_owned_bytes_t payload;
+    assert(ze_serialize_struct(&payload, &in, METADATA_FIELDS, METADATA_FIELDS_LEN) == 0);
+
+    metadata_t out;
+    memset(&out, 0, sizeof(out));
+    assert(ze_deserialize_struct(z_loan(payload), &out, METADATA_FIELDS, METADATA_FIELDS_LEN) == 0);
+    assert(memcmp(out.trace_id, in.trace_id, 16) == 0);
+    assert(out.seq == in.seq);
+    assert(out.tenant == in.tenant);
+    assert(out.sampled == in.sampled);
+
+    // the data is the same as the one produced by the serializer
+    ze_owned_serializer_t serializer;
+    ze_serializer_empty(&serializer);
+    ze_serializer_serialize_buf(z_loan_mut(serializer), in.trace_id, 16);
+    ze_serializer_serialize_uint64(z_loan_mut(serializer), in.seq);
+    ze_serializer_serialize_int32(z_loan_mut(serializer), in.tenant);
+    ze_serializer_serialize_bool(z_loan_mut(serializer), in.sampled);
+    z_owned_bytes_t expected;
+    ze_serializer_finish(z_move(serializer), &expected);
+    z_owned_slice_t a, b;
+    z_bytes_to_slice(z_loan(payload), &a);
+    z_bytes_to_slice(z_loan(expected), &b);
+    assert(z_slice_len(z_loan(a)) == z_slice_len(z_loan(b)));
+    assert(memcmp(z_slice_data(z_loan(a)), z_slice_data(z_loan(b)), z_slice_len(z_loan(a))) == 0);
+    z_drop(z_move(a));
+    z_drop(z_move(b));
+    z_drop(z_move(expected));
+
+    // truncated data is rejected
+    z_owned_bytes_t truncated;
+    z_bytes_copy_from_buf(&truncated, (const uint8_t *)"\x10\x00\x01", 3);
+    assert(ze_deserialize_struct(z_loan(truncated), &out, METADATA_FIELDS, METADATA_FIELDS_LEN) == Z_EDESERIALIZE);
+    z_drop(z_move(truncated));
+    z_drop(z_move(payload));
+}
+#endif
+
 int main(void) {
     test_reader_seek();
     test_reader_read();
@@ -325,4 +678,16 @@ int main(void) {
     test_slices();
     test_serialize_simple();
     test_serialize_sequence();
+    test_serialize_array();
+#if defined(Z_FEATURE_UNSTABLE_API)
+    test_iovec();
+    test_get_iovec();
+#if defined(__unix__) || defined(__APPLE__)
+    test_from_file();
+#endif
+    test_deserialize_view();
+    test_bytes_pool();
+    test_writer_reserve();
+    test_serialize_struct();
+#endif
 }
@@ -0,0 +1,470 @@
+//
+// Copyright (c) 2024 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "zenoh.h"
+
+#undef NDEBUG
+#include <assert.h>
+
+const char* expr = "zenoh/publisher/test";
+
+#if defined(Z_FEATURE_UNSTABLE_API)
+void put_n(const z_loaned_publisher_t* pub, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        z_owned_bytes_t payload;
+        z_bytes_copy_from_str(&payload, "data");
+        assert(z_publisher_put(pub, z_move(payload), NULL) == Z_OK);
+    }
+}
+
+size_t drain(const z_loaned_fifo_handler_sample_t* handler) {
+    size_t n = 0;
+    z_owned_sample_t sample;
+    while (z_fifo_handler_sample_try_recv(handler, &sample) == Z_OK) {
+        z_drop(z_move(sample));
+        n++;
+    }
+    return n;
+}
+
+void test_coalesce() {
+    z_owned_config_t c;
+    z_config_default(&c);
+    z_owned_session_t s;
+    assert(z_open(&s, z_move(c), NULL) == Z_OK);
+
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, expr);
+    z_owned_closure_sample_t closure;
+    z_owned_fifo_handler_sample_t handler;
+    z_fifo_channel_sample_new(&closure, &handler, 16);
+    z_owned_subscriber_t sub;
+    assert(z_declare_subscriber(z_loan(s), &sub, z_loan(ke), z_move(closure), NULL) == Z_OK);
+    z_sleep_s(1);
+
+    z_publisher_options_t opts;
+    z_publisher_options_default(&opts);
+    assert(!opts.coalesce.is_enabled);
+    opts.coalesce.is_enabled = true;
+    opts.coalesce.max_bytes = 0;
+    opts.coalesce.max_messages = 4;
+    opts.coalesce.deadline_us = 0;
+    z_owned_publisher_t pub;
+    assert(z_declare_publisher(z_loan(s), &pub, z_loan(ke), &opts) == Z_OK);
+
+    put_n(z_loan(pub), 3);
+    z_sleep_ms(500);
+    assert(drain(z_loan(handler)) == 0);
+    put_n(z_loan(pub), 1);
+    z_sleep_ms(500);
+    assert(drain(z_loan(handler)) == 4);
+
+    put_n(z_loan(pub), 2);
+    assert(z_publisher_flush(z_loan(pub)) == Z_OK);
+    z_sleep_ms(500);
+    assert(drain(z_loan(handler)) == 2);
+
+    // pending messages are sent when the publisher is dropped
+    put_n(z_loan(pub), 1);
+    z_drop(z_move(pub));
+    z_sleep_ms(500);
+    assert(drain(z_loan(handler)) == 1);
+
+    opts.coalesce.max_messages = 0;
+    opts.coalesce.deadline_us = 100000;
+    assert(z_declare_publisher(z_loan(s), &pub, z_loan(ke), &opts) == Z_OK);
+    put_n(z_loan(pub), 2);
+    z_sleep_s(1);
+    assert(drain(z_loan(handler)) == 2);
+    z_drop(z_move(pub));
+
+    z_drop(z_move(sub));
+    z_drop(z_move(handler));
+    z_drop(z_move(s));
+}
+
+static z_result_t produce(z_owned_bytes_t* payload, void* context) {
+    (*(size_t*)context)++;
+    return z_bytes_copy_from_str(payload, "data");
+}
+
+static z_result_t produce_fail(z_owned_bytes_t* payload, void* context) {
+    (void)payload;
+    (*(size_t*)context)++;
+    return Z_EGENERIC;
+}
+
+void test_put_lazy() {
+    z_owned_config_t c;
+    z_config_default(&c);
+    z_owned_session_t s;
+    assert(z_open(&s, z_move(c), NULL) == Z_OK);
+
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, expr);
+    z_owned_publisher_t pub;
+    assert(z_declare_publisher(z_loan(s), &pub, z_loan(ke), NULL) == Z_OK);
+
+    // payloads are not produced while there are no subscribers
+    size_t produced = 0;
+    assert(z_publisher_put_lazy(z_loan(pub), produce, &produced, NULL) == Z_OK);
+    z_sleep_ms(500);
+    assert(z_publisher_put_lazy(z_loan(pub), produce, &produced, NULL) == Z_OK);
+    assert(produced == 0);
+
+    z_owned_closure_sample_t closure;
+    z_owned_fifo_handler_sample_t handler;
+    z_fifo_channel_sample_new(&closure, &handler, 16);
+    z_owned_subscriber_t sub;
+    assert(z_declare_subscriber(z_loan(s), &sub, z_loan(ke), z_move(closure), NULL) == Z_OK);
+    z_sleep_s(1);
+
+    assert(z_publisher_put_lazy(z_loan(pub), produce, &produced, NULL) == Z_OK);
+    assert(produced == 1);
+    assert(z_publisher_put_lazy(z_loan(pub), produce_fail, &produced, NULL) == Z_EGENERIC);
+    assert(produced == 2);
+    z_sleep_ms(500);
+    assert(drain(z_loan(handler)) == 1);
+
+    z_drop(z_move(sub));
+    z_sleep_s(1);
+    assert(z_publisher_put_lazy(z_loan(pub), produce, &produced, NULL) == Z_OK);
+    assert(produced == 2);
+
+    z_drop(z_move(pub));
+    z_drop(z_move(handler));
+    z_drop(z_move(s));
+}
+
+#define COMPRESSIBLE_LEN 4096
+
+void test_compression() {
+    z_owned_config_t c;
+    z_config_default(&c);
+    z_owned_session_t s;
+    assert(z_open(&s, z_move(c), NULL) == Z_OK);
+
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, expr);
+    z_owned_closure_sample_t closure;
+    z_owned_fifo_handler_sample_t handler;
+    z_fifo_channel_sample_new(&closure, &handler, 16);
+    z_owned_subscriber_t sub;
+    assert(z_declare_subscriber(z_loan(s), &sub, z_loan(ke), z_move(closure), NULL) == Z_OK);
+    z_sleep_s(1);
+
+    z_publisher_options_t opts;
+    z_publisher_options_default(&opts);
+    assert(opts.compression.algorithm == ZC_COMPRESSION_NONE);
+    opts.compression.algorithm = ZC_COMPRESSION_LZ4;
+    opts.compression.min_size = 64;
+    z_owned_encoding_t encoding;
+    z_encoding_clone(&encoding, z_encoding_application_json());
+    opts.encoding = z_move(encoding);
+    z_owned_publisher_t pub;
+    assert(z_declare_publisher(z_loan(s), &pub, z_loan(ke), &opts) == Z_OK);
+
+    uint8_t data[COMPRESSIBLE_LEN];
+    for (size_t i = 0; i < COMPRESSIBLE_LEN; i++) {
+        data[i] = (uint8_t)(i % 16);
+    }
+    z_owned_bytes_t payload;
+    z_bytes_copy_from_buf(&payload, data, COMPRESSIBLE_LEN);
+    assert(z_publisher_put(z_loan(pub), z_move(payload), NULL) == Z_OK);
+    // payloads smaller than the threshold are sent as they are
+    z_bytes_copy_from_buf(&payload, data, 16);
+    assert(z_publisher_put(z_loan(pub), z_move(payload), NULL) == Z_OK);
+    z_sleep_ms(500);
+
+    z_owned_sample_t sample;
+    z_view_slice_t view;
+    z_owned_string_t e;
+    assert(z_fifo_handler_sample_try_recv(z_loan(handler), &sample) == Z_OK);
+    assert(zc_sample_compression(z_loan(sample)) == ZC_COMPRESSION_LZ4);
+    assert(z_bytes_len(z_sample_payload(z_loan(sample))) < COMPRESSIBLE_LEN);
+    z_encoding_to_string(z_sample_encoding(z_loan(sample)), &e);
+    const char* marked = "application/json;zc-lz4";
+    assert(z_string_len(z_loan(e)) == strlen(marked));
+    assert(memcmp(z_string_data(z_loan(e)), marked, strlen(marked)) == 0);
+    z_drop(z_move(e));
+    assert(zc_sample_payload_decompressed(z_loan(sample), &view) == Z_OK);
+    assert(z_slice_len(z_loan(view)) == COMPRESSIBLE_LEN);
+    assert(memcmp(z_slice_data(z_loan(view)), data, COMPRESSIBLE_LEN) == 0);
+    z_drop(z_move(sample));
+
+    assert(z_fifo_handler_sample_try_recv(z_loan(handler), &sample) == Z_OK);
+    assert(zc_sample_compression(z_loan(sample)) == ZC_COMPRESSION_NONE);
+    assert(zc_sample_payload_decompressed(z_loan(sample), &view) == Z_OK);
+    assert(z_slice_len(z_loan(view)) == 16);
+    assert(memcmp(z_slice_data(z_loan(view)), data, 16) == 0);
+    z_drop(z_move(sample));
+
+    z_drop(z_move(pub));
+    z_drop(z_move(sub));
+    z_drop(z_move(handler));
+    z_drop(z_move(s));
+}
+
+#define DELTA_LEN 1024
+#define DELTA_PUTS 6
+
+void test_delta() {
+    z_owned_config_t c;
+    z_config_default(&c);
+    z_owned_session_t s;
+    assert(z_open(&s, z_move(c), NULL) == Z_OK);
+
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, expr);
+    z_owned_closure_sample_t closure;
+    z_owned_fifo_handler_sample_t handler;
+    z_fifo_channel_sample_new(&closure, &handler, 16);
+    z_subscriber_options_t sub_opts;
+    z_subscriber_options_default(&sub_opts);
+    assert(!sub_opts.delta_decoding);
+    sub_opts.delta_decoding = true;
+    z_owned_subscriber_t sub;
+    assert(z_declare_subscriber(z_loan(s), &sub, z_loan(ke), z_move(closure), &sub_opts) == Z_OK);
+    z_sleep_s(1);
+
+    z_publisher_options_t opts;
+    z_publisher_options_default(&opts);
+    assert(!opts.delta.is_enabled);
+    opts.delta.is_enabled = true;
+    opts.delta.keyframe_interval = 4;
+    z_owned_encoding_t encoding;
+    z_encoding_clone(&encoding, z_encoding_application_json());
+    opts.encoding = z_move(encoding);
+    z_owned_publisher_t pub;
+    assert(z_declare_publisher(z_loan(s), &pub, z_loan(ke), &opts) == Z_OK);
+
+    // each payload differs from the previous one by a few bytes
+    uint8_t data[DELTA_PUTS][DELTA_LEN];
+    for (size_t n = 0; n < DELTA_PUTS; n++) {
+        for (size_t i = 0; i < DELTA_LEN; i++) {
+            data[n][i] = (uint8_t)(i * 7);
+        }
+        data[n][n * 100] = (uint8_t)(n + 1);
+        z_owned_bytes_t payload;
+        z_bytes_copy_from_buf(&payload, data[n], DELTA_LEN);
+        assert(z_publisher_put(z_loan(pub), z_move(payload), NULL) == Z_OK);
+    }
+    z_sleep_ms(500);
+
+    for (size_t n = 0; n < DELTA_PUTS; n++) {
+        z_owned_sample_t sample;
+        assert(z_fifo_handler_sample_try_recv(z_loan(handler), &sample) == Z_OK);
+        z_owned_slice_t slice;
+        assert(z_bytes_to_slice(z_sample_payload(z_loan(sample)), &slice) == Z_OK);
+        assert(z_slice_len(z_loan(slice)) == DELTA_LEN);
+        assert(memcmp(z_slice_data(z_loan(slice)), data[n], DELTA_LEN) == 0);
+        z_drop(z_move(slice));
+        // the encoding is restored on decoding
+        z_owned_string_t e;
+        z_encoding_to_string(z_sample_encoding(z_loan(sample)), &e);
+        const char* json = "application/json";
+        assert(z_string_len(z_loan(e)) == strlen(json));
+        assert(memcmp(z_string_data(z_loan(e)), json, strlen(json)) == 0);
+        z_drop(z_move(e));
+        z_drop(z_move(sample));
+    }
+
+    z_drop(z_move(pub));
+    z_drop(z_move(sub));
+    z_drop(z_move(handler));
+    z_drop(z_move(s));
+}
+#define DELTA_CONCURRENT_PUTS 50
+
+typedef struct delta_putter_t {
+    const z_loaned_publisher_t* pub;
+    uint8_t id;
+} delta_putter_t;
+
+void* put_deltas(void* arg) {
+    delta_putter_t* putter = (delta_putter_t*)arg;
+    for (size_t n = 0; n < DELTA_CONCURRENT_PUTS; n++) {
+        uint8_t data[DELTA_LEN] = {0};
+        data[0] = putter->id;
+        data[1] = (uint8_t)n;
+        z_owned_bytes_t payload;
+        z_bytes_copy_from_buf(&payload, data, DELTA_LEN);
+        assert(z_publisher_put(putter->pub, z_move(payload), NULL) == Z_OK);
+    }
+    return NULL;
+}
+
+void test_delta_concurrent() {
+    z_owned_config_t c;
+    z_config_default(&c);
+    z_owned_session_t s;
+    assert(z_open(&s, z_move(c), NULL) == Z_OK);
+
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, expr);
+    z_owned_closure_sample_t closure;
+    z_owned_fifo_handler_sample_t handler;
+    z_fifo_channel_sample_new(&closure, &handler, 2 * DELTA_CONCURRENT_PUTS);
+    z_subscriber_options_t sub_opts;
+    z_subscriber_options_default(&sub_opts);
+    sub_opts.delta_decoding = true;
+    z_owned_subscriber_t sub;
+    assert(z_declare_subscriber(z_loan(s), &sub, z_loan(ke), z_move(closure), &sub_opts) == Z_OK);
+    z_sleep_s(1);
+
+    z_publisher_options_t opts;
+    z_publisher_options_default(&opts);
+    opts.delta.is_enabled = true;
+    opts.delta.keyframe_interval = 4;
+    z_owned_publisher_t pub;
+    assert(z_declare_publisher(z_loan(s), &pub, z_loan(ke), &opts) == Z_OK);
+
+    // deltas put concurrently are never sent before their keyframe, so none of them is dropped by the subscriber
+    delta_putter_t putters[2] = {{z_loan(pub), 0}, {z_loan(pub), 1}};
+    z_owned_task_t tasks[2];
+    for (size_t i = 0; i < 2; i++) {
+        assert(z_task_init(&tasks[i], NULL, put_deltas, &putters[i]) == Z_OK);
+    }
+    for (size_t i = 0; i < 2; i++) {
+        assert(z_task_join(z_move(tasks[i])) == Z_OK);
+    }
+    z_sleep_ms(500);
+
+    size_t next[2] = {0, 0};
+    for (size_t n = 0; n < 2 * DELTA_CONCURRENT_PUTS; n++) {
+        z_owned_sample_t sample;
+        assert(z_fifo_handler_sample_try_recv(z_loan(handler), &sample) == Z_OK);
+        z_owned_slice_t slice;
+        assert(z_bytes_to_slice(z_sample_payload(z_loan(sample)), &slice) == Z_OK);
+        assert(z_slice_len(z_loan(slice)) == DELTA_LEN);
+        const uint8_t* data = z_slice_data(z_loan(slice));
+        assert(data[0] < 2);
+        assert(data[1] == next[data[0]]);
+        next[data[0]]++;
+        for (size_t i = 2; i < DELTA_LEN; i++) {
+            assert(data[i] == 0);
+        }
+        z_drop(z_move(slice));
+        z_drop(z_move(sample));
+    }
+    assert(next[0] == DELTA_CONCURRENT_PUTS && next[1] == DELTA_CONCURRENT_PUTS);
+
+    z_drop(z_move(pub));
+    z_drop(z_move(sub));
+    z_drop(z_move(handler));
+    z_drop(z_move(s));
+}
+
+void recv_str(const z_loaned_fifo_handler_sample_t* handler, const char* expected) {
+    z_owned_sample_t sample;
+    assert(z_fifo_handler_sample_try_recv(handler, &sample) == Z_OK);
+    z_owned_string_t str;
+    z_bytes_to_string(z_sample_payload(z_loan(sample)), &str);
+    assert(z_string_len(z_loan(str)) == strlen(expected));
+    assert(strncmp(z_string_data(z_loan(str)), expected, strlen(expected)) == 0);
+    z_drop(z_move(str));
+    z_drop(z_move(sample));
+}
+
+void test_put_batch() {
+    z_owned_config_t c;
+    z_config_default(&c);
+    z_owned_session_t s;
+    assert(z_open(&s, z_move(c), NULL) == Z_OK);
+
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, expr);
+    z_owned_closure_sample_t closure;
+    z_owned_fifo_handler_sample_t handler;
+    z_fifo_channel_sample_new(&closure, &handler, 16);
+    z_owned_subscriber_t sub;
+    assert(z_declare_subscriber(z_loan(s), &sub, z_loan(ke), z_move(closure), NULL) == Z_OK);
+    z_sleep_s(1);
+
+    // messages kept pending by the coalescing mode are sent before the batch
+    z_publisher_options_t opts;
+    z_publisher_options_default(&opts);
+    opts.coalesce.is_enabled = true;
+    opts.coalesce.max_bytes = 0;
+    opts.coalesce.max_messages = 16;
+    opts.coalesce.deadline_us = 0;
+    z_owned_publisher_t pub;
+    assert(z_declare_publisher(z_loan(s), &pub, z_loan(ke), &opts) == Z_OK);
+    const char* values[] = {"a", "b", "c", "d", "e"};
+    for (size_t i = 0; i < 2; i++) {
+        z_owned_bytes_t payload;
+        z_bytes_copy_from_str(&payload, values[i]);
+        assert(z_publisher_put(z_loan(pub), z_move(payload), NULL) == Z_OK);
+    }
+    z_moved_bytes_t payloads[3];
+    z_result_t results[3] = {-100, -100, -100};
+    for (size_t i = 0; i < 3; i++) {
+        z_bytes_copy_from_str(&payloads[i]._this, values[2 + i]);
+    }
+    assert(z_publisher_put_batch(z_loan(pub), payloads, 3, NULL, results) == Z_OK);
+    for (size_t i = 0; i < 3; i++) {
+        assert(results[i] == Z_OK);
+        assert(!z_internal_check(payloads[i]._this));
+    }
+    z_sleep_ms(500);
+    for (size_t i = 0; i < 5; i++) {
+        recv_str(z_loan(handler), values[i]);
+    }
+    assert(drain(z_loan(handler)) == 0);
+
+    // empty batches are accepted, the owned options are consumed
+    z_publisher_put_options_t put_opts;
+    z_publisher_put_options_default(&put_opts);
+    z_owned_bytes_t attachment;
+    z_bytes_copy_from_str(&attachment, "attachment");
+    put_opts.attachment = z_move(attachment);
+    assert(z_publisher_put_batch(z_loan(pub), NULL, 0, &put_opts, NULL) == Z_OK);
+    assert(!z_internal_check(attachment));
+    assert(z_publisher_put_batch(z_loan(pub), NULL, 2, NULL, NULL) == Z_EINVAL);
+
+    // every payload is consumed even if the puts fail
+    assert(z_close(z_loan_mut(s), NULL) == Z_OK);
+    for (size_t i = 0; i < 3; i++) {
+        z_bytes_copy_from_str(&payloads[i]._this, values[i]);
+        results[i] = Z_OK;
+    }
+    assert(z_publisher_put_batch(z_loan(pub), payloads, 3, NULL, results) != Z_OK);
+    for (size_t i = 0; i < 3; i++) {
+        assert(results[i] != Z_OK);
+        assert(!z_internal_check(payloads[i]._this));
+    }
+
+    z_drop(z_move(pub));
+    z_drop(z_move(sub));
+    z_drop(z_move(handler));
+    z_drop(z_move(s));
+}
+#endif
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+#if defined(Z_FEATURE_UNSTABLE_API)
+    test_coalesce();
+    test_put_lazy();
+    test_compression();
+    test_delta();
+    test_delta_concurrent();
+    test_put_batch();
+#endif
+    return 0;
+}
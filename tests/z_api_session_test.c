@@ -83,9 +83,1379 @@ void close_concurrent() {
 #endif
 }
 
+#if defined(Z_FEATURE_UNSTABLE_API)
+void ignore_sample(z_loaned_sample_t *sample, void *context) {}
+
+typedef struct close_poll_context_t {
+    volatile bool entered;
+    volatile bool released;
+} close_poll_context_t;
+
+// keeps the subscriber's callback alive until released
+void blocking_sample(z_loaned_sample_t *sample, void *context) {
+    close_poll_context_t *ctx = (close_poll_context_t *)context;
+    ctx->entered = true;
+    while (!ctx->released) {
+        z_sleep_ms(1);
+    }
+}
+
+void close_concurrent_poll_with(bool drop_session) {
+    z_owned_config_t config;
+    z_config_default(&config);
+    z_owned_session_t s;
+    if (z_open(&s, z_move(config), NULL) < 0) {
+        perror("Unable to open session!");
+        exit(-1);
+    }
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, "test/close/poll");
+    for (size_t i = 0; i < 3; i++) {
+        z_owned_closure_sample_t callback;
+        z_closure(&callback, ignore_sample, NULL, NULL);
+        assert(z_declare_background_subscriber(z_loan(s), z_loan(ke), z_move(callback), NULL) == Z_OK);
+    }
+    close_poll_context_t ctx = {.entered = false, .released = false};
+    z_owned_closure_sample_t callback;
+    z_closure(&callback, blocking_sample, NULL, &ctx);
+    assert(z_declare_background_subscriber(z_loan(s), z_loan(ke), z_move(callback), NULL) == Z_OK);
+
+    // the sample is received from another session, so that the callback runs on a thread of the closed session
+    z_owned_config_t config2;
+    z_config_default(&config2);
+    z_owned_session_t s2;
+    assert(z_open(&s2, z_move(config2), NULL) == Z_OK);
+    z_sleep_s(1);
+    z_owned_bytes_t payload;
+    z_bytes_copy_from_str(&payload, "data");
+    assert(z_put(z_loan(s2), z_loan(ke), z_move(payload), NULL) == Z_OK);
+    while (!ctx.entered) {
+        z_sleep_ms(1);
+    }
+
+    zc_owned_concurrent_close_handle_t close_handle;
+    z_close_options_t options;
+    z_close_options_default(&options);
+    options.internal_out_concurrent = &close_handle;
+    assert(z_close(z_loan_mut(s), &options) == Z_OK);
+    if (drop_session) {
+        z_drop(z_move(s));
+    }
+
+    // the callback being executed is kept alive
+    z_sleep_ms(100);
+    assert(z_internal_check(close_handle));
+    size_t pending = zc_concurrent_close_handle_pending_entities(&close_handle);
+    assert(pending >= 1 && pending <= 4);
+
+    ctx.released = true;
+    for (size_t i = 0; i < 1000 && zc_concurrent_close_handle_pending_entities(&close_handle) != 0; i++) {
+        z_sleep_ms(1);
+    }
+    assert(z_internal_check(close_handle));
+    assert(zc_concurrent_close_handle_pending_entities(&close_handle) == 0);
+
+    z_result_t res;
+    while ((res = zc_concurrent_close_handle_try_wait(&close_handle)) == Z_CHANNEL_NODATA) {
+        z_sleep_ms(1);
+    }
+    assert(res == Z_OK);
+    assert(!z_internal_check(close_handle));
+    assert(zc_concurrent_close_handle_pending_entities(&close_handle) == 0);
+    assert(zc_concurrent_close_handle_try_wait(&close_handle) == Z_EINVAL);
+
+    if (!drop_session) {
+        z_drop(z_move(s));
+    }
+    z_drop(z_move(s2));
+}
+#endif
+
+void close_concurrent_poll() {
+#if defined(Z_FEATURE_UNSTABLE_API)
+    close_concurrent_poll_with(false);
+    close_concurrent_poll_with(true);
+#endif
+}
+
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct get_many_context_t {
+    size_t replies[3];
+    volatile bool done;
+} get_many_context_t;
+
+void get_many_query_handler(z_loaned_query_t *query, void *context) {
+    z_owned_bytes_t payload;
+    z_bytes_copy_from_str(&payload, "reply");
+    z_query_reply(query, z_query_keyexpr(query), z_move(payload), NULL);
+}
+
+void get_many_reply_handler(size_t index, z_loaned_reply_t *reply, void *context) {
+    get_many_context_t *ctx = (get_many_context_t *)context;
+    assert(index < 3);
+    assert(z_reply_is_ok(reply));
+    ctx->replies[index]++;
+}
+
+void get_many_drop(void *context) { ((get_many_context_t *)context)->done = true; }
+#endif
+
+void get_many() {
+#if defined(Z_FEATURE_UNSTABLE_API)
+    z_owned_config_t config;
+    z_config_default(&config);
+
+    z_owned_session_t s;
+    if (z_open(&s, z_move(config), NULL) < 0) {
+        perror("Unable to open session!");
+        exit(-1);
+    }
+
+    z_view_keyexpr_t qable_ke;
+    z_view_keyexpr_from_str(&qable_ke, "test/get_many/**");
+    z_owned_closure_query_t qable_callback;
+    z_closure(&qable_callback, get_many_query_handler, NULL, NULL);
+    z_owned_queryable_t qable;
+    assert(z_declare_queryable(z_loan(s), &qable, z_loan(qable_ke), z_move(qable_callback), NULL) == Z_OK);
+
+    z_view_keyexpr_t kes[3];
+    z_view_keyexpr_from_str(&kes[0], "test/get_many/a");
+    z_view_keyexpr_from_str(&kes[1], "test/get_many/b");
+    z_view_keyexpr_from_str(&kes[2], "test/get_many/c");
+    const z_loaned_keyexpr_t *key_exprs[3] = {z_loan(kes[0]), z_loan(kes[1]), z_loan(kes[2])};
+    const char *parameters[3] = {NULL, "p=1", NULL};
+
+    get_many_context_t ctx = {{0, 0, 0}, false};
+    zc_owned_closure_indexed_reply_t callback;
+    zc_closure_indexed_reply(&callback, get_many_reply_handler, get_many_drop, &ctx);
+    assert(zc_get_many(z_loan(s), key_exprs, parameters, 3, z_move(callback), NULL) == Z_OK);
+
+    for (int i = 0; i < 100 && !ctx.done; i++) {
+        z_sleep_ms(100);
+    }
+    assert(ctx.done);
+    for (size_t i = 0; i < 3; i++) {
+        assert(ctx.replies[i] == 1);
+    }
+
+    z_drop(z_move(qable));
+    z_drop(z_move(s));
+#endif
+}
+
+void queryable_workers() {
+#if defined(Z_FEATURE_UNSTABLE_API)
+    z_owned_config_t config;
+    z_config_default(&config);
+
+    z_owned_session_t s;
+    if (z_open(&s, z_move(config), NULL) < 0) {
+        perror("Unable to open session!");
+        exit(-1);
+    }
+
+    z_view_keyexpr_t qable_ke;
+    z_view_keyexpr_from_str(&qable_ke, "test/queryable_workers/**");
+    z_owned_closure_query_t qable_callback;
+    z_closure(&qable_callback, get_many_query_handler, NULL, NULL);
+    z_queryable_options_t qable_options;
+    z_queryable_options_default(&qable_options);
+    assert(qable_options.worker_threads == 0);
+    qable_options.worker_threads = 2;
+    qable_options.worker_queue_size = 4;
+    z_owned_queryable_t qable;
+    assert(z_declare_queryable(z_loan(s), &qable, z_loan(qable_ke), z_move(qable_callback), &qable_options) ==
+           Z_OK);
+
+    const char *keys[] = {"test/queryable_workers/a", "test/queryable_workers/b", "test/queryable_workers/c"};
+    for (size_t i = 0; i < 3; i++) {
+        z_view_keyexpr_t ke;
+        z_view_keyexpr_from_str(&ke, keys[i]);
+        z_owned_closure_reply_t closure;
+        z_owned_fifo_handler_reply_t handler;
+        z_fifo_channel_reply_new(&closure, &handler, 4);
+        assert(z_get(z_loan(s), z_loan(ke), "", z_move(closure), NULL) == Z_OK);
+        z_owned_reply_t reply;
+        assert(z_recv(z_loan(handler), &reply) == Z_OK);
+        assert(z_reply_is_ok(z_loan(reply)));
+        z_drop(z_move(reply));
+        assert(z_recv(z_loan(handler), &reply) == Z_CHANNEL_DISCONNECTED);
+        z_drop(z_move(handler));
+    }
+
+    z_drop(z_move(qable));
+    z_drop(z_move(s));
+#endif
+}
+
+void subscriber_workers() {
+#if defined(Z_FEATURE_UNSTABLE_API)
+    z_owned_config_t config;
+    z_config_default(&config);
+
+    z_owned_session_t s;
+    if (z_open(&s, z_move(config), NULL) < 0) {
+        perror("Unable to open session!");
+        exit(-1);
+    }
+
+    z_view_keyexpr_t sub_ke;
+    z_view_keyexpr_from_str(&sub_ke, "test/subscriber_workers/*");
+    z_owned_closure_sample_t closure;
+    z_owned_fifo_handler_sample_t handler;
+    z_fifo_channel_sample_new(&closure, &handler, 64);
+    z_subscriber_options_t sub_options;
+    z_subscriber_options_default(&sub_options);
+    assert(sub_options.worker_threads == 0);
+    sub_options.worker_threads = 3;
+    sub_options.worker_queue_size = 64;
+    z_owned_subscriber_t sub;
+    assert(z_declare_subscriber(z_loan(s), &sub, z_loan(sub_ke), z_move(closure), &sub_options) == Z_OK);
+
+    // the workers run in parallel, but the samples of each key expression are delivered in order
+    const char *keys[] = {"test/subscriber_workers/a", "test/subscriber_workers/b", "test/subscriber_workers/c"};
+    for (uint8_t i = 0; i < 10; i++) {
+        for (size_t k = 0; k < 3; k++) {
+            z_view_keyexpr_t ke;
+            z_view_keyexpr_from_str(&ke, keys[k]);
+            z_owned_bytes_t payload;
+            z_bytes_copy_from_buf(&payload, &i, 1);
+            assert(z_put(z_loan(s), z_loan(ke), z_move(payload), NULL) == Z_OK);
+        }
+    }
+    // the closure is dropped by the workers once the queued samples are delivered
+    z_drop(z_move(sub));
+
+    uint8_t next[3] = {0, 0, 0};
+    z_owned_sample_t sample;
+    while (z_recv(z_loan(handler), &sample) == Z_OK) {
+        z_view_string_t k;
+        z_keyexpr_as_view_string(z_sample_keyexpr(z_loan(sample)), &k);
+        size_t key = (size_t)(z_string_data(z_loan(k))[z_string_len(z_loan(k)) - 1] - 'a');
+        assert(key < 3);
+        uint8_t value;
+        z_bytes_reader_t reader = z_bytes_get_reader(z_sample_payload(z_loan(sample)));
+        assert(z_bytes_reader_read(&reader, &value, 1) == 1);
+        assert(value == next[key]);
+        next[key]++;
+        z_drop(z_move(sample));
+    }
+    for (size_t k = 0; k < 3; k++) {
+        assert(next[k] == 10);
+    }
+
+    z_drop(z_move(handler));
+    z_drop(z_move(s));
+#endif
+}
+
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct executor_workers_context_t {
+    z_owned_mutex_t mutex;
+    size_t calls;
+    size_t calls_at_drop;
+    volatile bool entered;
+    volatile bool released;
+    volatile bool dropped;
+} executor_workers_context_t;
+
+// the first call blocks until released, so that a job is in flight when the entity is dropped
+void executor_workers_call(executor_workers_context_t *ctx) {
+    ctx->entered = true;
+    while (!ctx->released) {
+        z_sleep_ms(1);
+    }
+    z_mutex_lock(z_loan_mut(ctx->mutex));
+    ctx->calls++;
+    z_mutex_unlock(z_loan_mut(ctx->mutex));
+}
+
+void executor_workers_sample(z_loaned_sample_t *sample, void *context) {
+    executor_workers_call((executor_workers_context_t *)context);
+}
+
+void executor_workers_query(z_loaned_query_t *query, void *context) {
+    executor_workers_call((executor_workers_context_t *)context);
+    z_owned_bytes_t payload;
+    z_bytes_copy_from_str(&payload, "reply");
+    z_query_reply(query, z_query_keyexpr(query), z_move(payload), NULL);
+}
+
+void executor_workers_drop(void *context) {
+    executor_workers_context_t *ctx = (executor_workers_context_t *)context;
+    z_mutex_lock(z_loan_mut(ctx->mutex));
+    ctx->calls_at_drop = ctx->calls;
+    z_mutex_unlock(z_loan_mut(ctx->mutex));
+    ctx->dropped = true;
+}
+
+void executor_workers_init(executor_workers_context_t *ctx) {
+    z_mutex_init(&ctx->mutex);
+    ctx->calls = 0;
+    ctx->calls_at_drop = 0;
+    ctx->entered = false;
+    ctx->released = false;
+    ctx->dropped = false;
+}
+
+// checks that the callback is only dropped once the jobs in flight when the entity was dropped have run
+void executor_workers_wait(executor_workers_context_t *ctx, size_t calls) {
+    z_sleep_ms(100);
+    assert(!ctx->dropped);
+    ctx->released = true;
+    for (int i = 0; i < 500 && !ctx->dropped; i++) {
+        z_sleep_ms(10);
+    }
+    assert(ctx->dropped);
+    assert(ctx->calls_at_drop == calls);
+    z_drop(z_move(ctx->mutex));
+}
+#endif
+
+void executor_workers() {
+#if defined(Z_FEATURE_UNSTABLE_API)
+    z_owned_config_t config;
+    z_config_default(&config);
+
+    z_owned_session_t s;
+    if (z_open(&s, z_move(config), NULL) < 0) {
+        perror("Unable to open session!");
+        exit(-1);
+    }
+
+    z_owned_executor_t executor;
+    z_executor_options_t executor_options;
+    z_executor_options_default(&executor_options);
+    executor_options.worker_threads = 2;
+    assert(z_executor_new(&executor, &executor_options) == Z_OK);
+
+    // subscriber
+    executor_workers_context_t ctx;
+    executor_workers_init(&ctx);
+    z_view_keyexpr_t sub_ke;
+    z_view_keyexpr_from_str(&sub_ke, "test/executor_workers/sub/*");
+    z_owned_closure_sample_t sub_callback;
+    z_closure(&sub_callback, executor_workers_sample, executor_workers_drop, &ctx);
+    z_subscriber_options_t sub_options;
+    z_subscriber_options_default(&sub_options);
+    assert(sub_options.worker_executor == NULL);
+    sub_options.worker_threads = 2;
+    sub_options.worker_queue_size = 16;
+    sub_options.worker_executor = z_loan(executor);
+    z_owned_subscriber_t sub;
+    assert(z_declare_subscriber(z_loan(s), &sub, z_loan(sub_ke), z_move(sub_callback), &sub_options) == Z_OK);
+
+    const char *sub_keys[] = {"test/executor_workers/sub/a", "test/executor_workers/sub/b"};
+    for (size_t i = 0; i < 10; i++) {
+        z_view_keyexpr_t ke;
+        z_view_keyexpr_from_str(&ke, sub_keys[i % 2]);
+        z_owned_bytes_t payload;
+        z_bytes_copy_from_str(&payload, "data");
+        assert(z_put(z_loan(s), z_loan(ke), z_move(payload), NULL) == Z_OK);
+    }
+    while (!ctx.entered) {
+        z_sleep_ms(1);
+    }
+    z_drop(z_move(sub));
+    executor_workers_wait(&ctx, 10);
+
+    // queryable
+    executor_workers_init(&ctx);
+    z_view_keyexpr_t qable_ke;
+    z_view_keyexpr_from_str(&qable_ke, "test/executor_workers/qable/*");
+    z_owned_closure_query_t qable_callback;
+    z_closure(&qable_callback, executor_workers_query, executor_workers_drop, &ctx);
+    z_queryable_options_t qable_options;
+    z_queryable_options_default(&qable_options);
+    assert(qable_options.worker_executor == NULL);
+    qable_options.worker_threads = 2;
+    qable_options.worker_queue_size = 4;
+    qable_options.worker_executor = z_loan(executor);
+    z_owned_queryable_t qable;
+    assert(z_declare_queryable(z_loan(s), &qable, z_loan(qable_ke), z_move(qable_callback), &qable_options) ==
+           Z_OK);
+
+    const char *qable_keys[] = {"test/executor_workers/qable/a", "test/executor_workers/qable/b",
+                                "test/executor_workers/qable/c"};
+    z_owned_fifo_handler_reply_t handlers[3];
+    for (size_t i = 0; i < 3; i++) {
+        z_view_keyexpr_t ke;
+        z_view_keyexpr_from_str(&ke, qable_keys[i]);
+        z_owned_closure_reply_t closure;
+        z_fifo_channel_reply_new(&closure, &handlers[i], 4);
+        assert(z_get(z_loan(s), z_loan(ke), "", z_move(closure), NULL) == Z_OK);
+    }
+    while (!ctx.entered) {
+        z_sleep_ms(1);
+    }
+    z_drop(z_move(qable));
+    executor_workers_wait(&ctx, 3);
+    // the queries in flight are still replied to
+    for (size_t i = 0; i < 3; i++) {
+        z_owned_reply_t reply;
+        assert(z_recv(z_loan(handlers[i]), &reply) == Z_OK);
+        assert(z_reply_is_ok(z_loan(reply)));
+        z_drop(z_move(reply));
+        assert(z_recv(z_loan(handlers[i]), &reply) == Z_CHANNEL_DISCONNECTED);
+        z_drop(z_move(handlers[i]));
+    }
+
+    z_drop(z_move(executor));
+    z_drop(z_move(s));
+#endif
+}
+
+#if defined(Z_FEATURE_UNSTABLE_API)
+void reply_batch_query_handler(z_loaned_query_t *query, void *context) {
+    z_view_keyexpr_t kes[3];
+    z_view_keyexpr_from_str(&kes[0], "test/reply_batch/a");
+    z_view_keyexpr_from_str(&kes[1], "test/reply_batch/b");
+    z_view_keyexpr_from_str(&kes[2], "test/reply_batch/c");
+    const z_loaned_keyexpr_t *key_exprs[3] = {z_loan(kes[0]), z_loan(kes[1]), z_loan(kes[2])};
+    z_owned_bytes_t payloads[3];
+    for (size_t i = 0; i < 3; i++) {
+        z_bytes_copy_from_str(&payloads[i], "reply");
+    }
+    z_result_t results[3];
+    assert(z_query_reply_batch(query, key_exprs, (z_moved_bytes_t *)payloads, 3, NULL, results) == Z_OK);
+    for (size_t i = 0; i < 3; i++) {
+        assert(results[i] == Z_OK);
+        assert(!z_internal_check(payloads[i]));
+    }
+}
+#endif
+
+void reply_batch() {
+#if defined(Z_FEATURE_UNSTABLE_API)
+    z_owned_config_t config;
+    z_config_default(&config);
+
+    z_owned_session_t s;
+    if (z_open(&s, z_move(config), NULL) < 0) {
+        perror("Unable to open session!");
+        exit(-1);
+    }
+
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, "test/reply_batch/**");
+    z_owned_closure_query_t qable_callback;
+    z_closure(&qable_callback, reply_batch_query_handler, NULL, NULL);
+    z_owned_queryable_t qable;
+    assert(z_declare_queryable(z_loan(s), &qable, z_loan(ke), z_move(qable_callback), NULL) == Z_OK);
+
+    z_owned_closure_reply_t closure;
+    z_owned_fifo_handler_reply_t handler;
+    z_fifo_channel_reply_new(&closure, &handler, 4);
+    z_get_options_t options;
+    z_get_options_default(&options);
+    options.consolidation = z_query_consolidation_none();
+    assert(z_get(z_loan(s), z_loan(ke), "", z_move(closure), &options) == Z_OK);
+    size_t n = 0;
+    z_owned_reply_t reply;
+    while (z_recv(z_loan(handler), &reply) == Z_OK) {
+        assert(z_reply_is_ok(z_loan(reply)));
+        n++;
+        z_drop(z_move(reply));
+    }
+    assert(n == 3);
+    z_drop(z_move(handler));
+
+    z_drop(z_move(qable));
+    z_drop(z_move(s));
+#endif
+}
+
+#if defined(Z_FEATURE_UNSTABLE_API)
+void duplicate_query_handler(z_loaned_query_t *query, void *context) {
+    for (size_t i = 0; i < 2; i++) {
+        z_owned_bytes_t payload;
+        z_bytes_copy_from_str(&payload, "reply");
+        z_query_reply(query, z_query_keyexpr(query), z_move(payload), NULL);
+    }
+}
+#endif
+
+void local_consolidation() {
+#if defined(Z_FEATURE_UNSTABLE_API)
+    z_owned_config_t config;
+    z_config_default(&config);
+
+    z_owned_session_t s;
+    if (z_open(&s, z_move(config), NULL) < 0) {
+        perror("Unable to open session!");
+        exit(-1);
+    }
+
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, "test/local_consolidation");
+    z_owned_closure_query_t qable_callback;
+    z_closure(&qable_callback, duplicate_query_handler, NULL, NULL);
+    z_owned_queryable_t qable;
+    assert(z_declare_queryable(z_loan(s), &qable, z_loan(ke), z_move(qable_callback), NULL) == Z_OK);
+
+    zc_reply_consolidation_stats_t stats;
+    z_owned_closure_reply_t closure;
+    z_owned_fifo_handler_reply_t handler;
+    z_fifo_channel_reply_new(&closure, &handler, 4);
+    z_get_options_t options;
+    z_get_options_default(&options);
+    options.consolidation = z_query_consolidation_latest();
+    options.consolidation_capacity = 16;
+    options.consolidation_stats = &stats;
+    assert(z_get(z_loan(s), z_loan(ke), "", z_move(closure), &options) == Z_OK);
+    size_t n = 0;
+    z_owned_reply_t reply;
+    while (z_recv(z_loan(handler), &reply) == Z_OK) {
+        assert(z_reply_is_ok(z_loan(reply)));
+        n++;
+        z_drop(z_move(reply));
+    }
+    assert(n == 1);
+    // the stats are written before the callback is dropped, that is before the channel is disconnected
+    assert(stats.replies_received == 2);
+    assert(stats.replies_dropped == 1);
+    assert(stats.keys == 1);
+    z_drop(z_move(handler));
+
+    z_drop(z_move(qable));
+    z_drop(z_move(s));
+#endif
+}
+
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct cancel_context_t {
+    const z_loaned_cancellation_token_t *token;
+    size_t replies;
+    volatile bool dropped;
+} cancel_context_t;
+
+void hold_query_handler(z_loaned_query_t *query, void *context) { z_query_clone((z_owned_query_t *)context, query); }
+
+void cancel_on_reply(z_loaned_reply_t *reply, void *context) {
+    cancel_context_t *ctx = (cancel_context_t *)context;
+    ctx->replies++;
+    assert(z_cancellation_token_cancel(ctx->token) == Z_OK);
+    // the callback is only dropped once it returns
+    assert(!ctx->dropped);
+}
+
+void cancel_drop(void *context) { ((cancel_context_t *)context)->dropped = true; }
+
+void get_with_token(const z_loaned_session_t *s, const z_loaned_keyexpr_t *ke, cancel_context_t *ctx) {
+    z_owned_closure_reply_t closure;
+    z_closure(&closure, cancel_on_reply, cancel_drop, ctx);
+    z_owned_cancellation_token_t token;
+    z_cancellation_token_clone(&token, ctx->token);
+    z_get_options_t options;
+    z_get_options_default(&options);
+    options.cancellation_token = z_move(token);
+    assert(z_get(s, ke, "", z_move(closure), &options) == Z_OK);
+}
+#endif
+
+void cancellable_get() {
+#if defined(Z_FEATURE_UNSTABLE_API)
+    z_owned_config_t config;
+    z_config_default(&config);
+
+    z_owned_session_t s;
+    if (z_open(&s, z_move(config), NULL) < 0) {
+        perror("Unable to open session!");
+        exit(-1);
+    }
+
+    // the query held by the queryable is not finalized until it is dropped
+    z_view_keyexpr_t held_ke;
+    z_view_keyexpr_from_str(&held_ke, "test/cancellable_get/held");
+    z_owned_query_t held;
+    z_internal_null(&held);
+    z_owned_closure_query_t qable_callback;
+    z_closure(&qable_callback, hold_query_handler, NULL, &held);
+    z_owned_queryable_t qable;
+    assert(z_declare_queryable(z_loan(s), &qable, z_loan(held_ke), z_move(qable_callback), NULL) == Z_OK);
+
+    z_owned_cancellation_token_t token;
+    z_cancellation_token_new(&token);
+    assert(z_internal_check(token));
+    assert(!z_cancellation_token_is_cancelled(z_loan(token)));
+    cancel_context_t ctx = {z_loan(token), 0, false};
+    get_with_token(z_loan(s), z_loan(held_ke), &ctx);
+    for (int i = 0; i < 100 && !z_internal_check(held); i++) {
+        z_sleep_ms(10);
+    }
+    assert(z_internal_check(held));
+    assert(!ctx.dropped);
+
+    // cancelling drops the callback without waiting for the query to be finalized
+    assert(z_cancellation_token_cancel(z_loan(token)) == Z_OK);
+    assert(z_cancellation_token_is_cancelled(z_loan(token)));
+    assert(ctx.dropped);
+    z_owned_bytes_t payload;
+    z_bytes_copy_from_str(&payload, "late");
+    z_query_reply(z_loan(held), z_query_keyexpr(z_loan(held)), z_move(payload), NULL);
+    z_drop(z_move(held));
+    assert(ctx.replies == 0);
+
+    // a cancelled token drops the callback of the next queries without sending them
+    ctx.dropped = false;
+    get_with_token(z_loan(s), z_loan(held_ke), &ctx);
+    assert(ctx.dropped);
+    assert(ctx.replies == 0);
+    z_drop(z_move(token));
+    z_drop(z_move(qable));
+
+    // a reply callback cancels its own query, the second reply being discarded
+    z_view_keyexpr_t dup_ke;
+    z_view_keyexpr_from_str(&dup_ke, "test/cancellable_get/duplicate");
+    z_closure(&qable_callback, duplicate_query_handler, NULL, NULL);
+    assert(z_declare_queryable(z_loan(s), &qable, z_loan(dup_ke), z_move(qable_callback), NULL) == Z_OK);
+    z_cancellation_token_new(&token);
+    ctx = (cancel_context_t){z_loan(token), 0, false};
+    get_with_token(z_loan(s), z_loan(dup_ke), &ctx);
+    for (int i = 0; i < 100 && !ctx.dropped; i++) {
+        z_sleep_ms(10);
+    }
+    assert(ctx.dropped);
+    assert(ctx.replies == 1);
+    z_drop(z_move(token));
+
+    z_drop(z_move(qable));
+    z_drop(z_move(s));
+#endif
+}
+
+void budgeted_publication_cache() {
+#if defined(Z_FEATURE_UNSTABLE_API)
+    z_owned_config_t config;
+    z_config_default(&config);
+
+    z_owned_session_t s;
+    if (z_open(&s, z_move(config), NULL) < 0) {
+        perror("Unable to open session!");
+        exit(-1);
+    }
+
+    // each sample accounts for 15 bytes of key expression and 20 bytes of payload, so only one fits the budget
+    ze_owned_cache_budget_t budget;
+    assert(ze_cache_budget_new(&budget, 64) == Z_OK);
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, "test/budget/**");
+    ze_publication_cache_options_t cache_options;
+    ze_publication_cache_options_default(&cache_options);
+    cache_options.budget = z_loan(budget);
+    ze_owned_publication_cache_t cache;
+    assert(ze_declare_publication_cache(z_loan(s), &cache, z_loan(ke), &cache_options) == Z_OK);
+    z_drop(z_move(budget));
+
+    const char *keys[] = {"test/budget/k_a", "test/budget/k_b", "test/budget/k_c"};
+    for (size_t i = 0; i < 3; i++) {
+        z_view_keyexpr_t put_ke;
+        z_view_keyexpr_from_str(&put_ke, keys[i]);
+        z_owned_bytes_t payload;
+        z_bytes_copy_from_str(&payload, "01234567890123456789");
+        assert(z_put(z_loan(s), z_loan(put_ke), z_move(payload), NULL) == Z_OK);
+    }
+    size_t resident = 0;
+    assert(ze_publication_cache_resident_bytes(z_loan(cache), &resident) == Z_OK);
+    assert(resident == 35);
+
+    z_owned_closure_reply_t closure;
+    z_owned_fifo_handler_reply_t handler;
+    z_fifo_channel_reply_new(&closure, &handler, 4);
+    z_get_options_t options;
+    z_get_options_default(&options);
+    options.consolidation = z_query_consolidation_none();
+    assert(z_get(z_loan(s), z_loan(ke), "", z_move(closure), &options) == Z_OK);
+    size_t n = 0;
+    z_owned_reply_t reply;
+    while (z_recv(z_loan(handler), &reply) == Z_OK) {
+        assert(z_reply_is_ok(z_loan(reply)));
+        z_view_string_t key;
+        z_keyexpr_as_view_string(z_sample_keyexpr(z_reply_ok(z_loan(reply))), &key);
+        assert(strncmp(z_string_data(z_loan(key)), keys[2], z_string_len(z_loan(key))) == 0);
+        n++;
+        z_drop(z_move(reply));
+    }
+    assert(n == 1);
+    z_drop(z_move(handler));
+
+    z_drop(z_move(cache));
+    z_drop(z_move(s));
+#endif
+}
+
+void log_publication_cache() {
+#if defined(Z_FEATURE_UNSTABLE_API) && !defined(_WIN32)
+    z_owned_config_t config;
+    z_config_default(&config);
+
+    z_owned_session_t s;
+    if (z_open(&s, z_move(config), NULL) < 0) {
+        perror("Unable to open session!");
+        exit(-1);
+    }
+
+    // a segment holds 3 payloads of 20 bytes, so the first segment is removed when the 4th sample starts a new one
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, "test/log_cache");
+    ze_publication_cache_options_t cache_options;
+    ze_publication_cache_options_default(&cache_options);
+    cache_options.history = 0;
+    cache_options.log_directory = "zc_test_publication_cache_log";
+    cache_options.log_segment_size = 64;
+    cache_options.log_max_segments = 1;
+    ze_owned_publication_cache_t cache;
+    assert(ze_declare_publication_cache(z_loan(s), &cache, z_loan(ke), &cache_options) == Z_OK);
+
+    for (size_t i = 0; i < 5; i++) {
+        char value[21];
+        snprintf(value, sizeof(value), "%020zu", i);
+        z_owned_bytes_t payload;
+        z_bytes_copy_from_str(&payload, value);
+        assert(z_put(z_loan(s), z_loan(ke), z_move(payload), NULL) == Z_OK);
+    }
+    size_t resident = 0;
+    assert(ze_publication_cache_resident_bytes(z_loan(cache), &resident) == Z_OK);
+    assert(resident == 40);
+
+    z_owned_closure_reply_t closure;
+    z_owned_fifo_handler_reply_t handler;
+    z_fifo_channel_reply_new(&closure, &handler, 4);
+    z_get_options_t options;
+    z_get_options_default(&options);
+    options.consolidation = z_query_consolidation_none();
+    assert(z_get(z_loan(s), z_loan(ke), "", z_move(closure), &options) == Z_OK);
+    size_t n = 0;
+    z_owned_reply_t reply;
+    while (z_recv(z_loan(handler), &reply) == Z_OK) {
+        assert(z_reply_is_ok(z_loan(reply)));
+        z_owned_string_t value;
+        z_bytes_to_string(z_sample_payload(z_reply_ok(z_loan(reply))), &value);
+        char expected[21];
+        snprintf(expected, sizeof(expected), "%020zu", n + 3);
+        assert(z_string_len(z_loan(value)) == 20);
+        assert(strncmp(z_string_data(z_loan(value)), expected, 20) == 0);
+        z_drop(z_move(value));
+        n++;
+        z_drop(z_move(reply));
+    }
+    assert(n == 2);
+    z_drop(z_move(handler));
+
+    z_drop(z_move(cache));
+    z_drop(z_move(s));
+#endif
+}
+
+#if defined(Z_FEATURE_UNSTABLE_API)
+void count_samples(z_loaned_sample_t *sample, void *context) { (*(size_t *)context)++; }
+#endif
+
+void streaming_querying_subscriber() {
+#if defined(Z_FEATURE_UNSTABLE_API)
+    z_owned_config_t config;
+    z_config_default(&config);
+    assert(zc_config_insert_json5(z_loan_mut(config), Z_CONFIG_ADD_TIMESTAMP_KEY, "true") == Z_OK);
+
+    z_owned_session_t s;
+    if (z_open(&s, z_move(config), NULL) < 0) {
+        perror("Unable to open session!");
+        exit(-1);
+    }
+
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, "test/streaming_merge");
+    ze_publication_cache_options_t cache_options;
+    ze_publication_cache_options_default(&cache_options);
+    cache_options.history = 3;
+    ze_owned_publication_cache_t cache;
+    assert(ze_declare_publication_cache(z_loan(s), &cache, z_loan(ke), &cache_options) == Z_OK);
+    for (size_t i = 0; i < 3; i++) {
+        z_owned_bytes_t payload;
+        z_bytes_copy_from_str(&payload, "cached");
+        assert(z_put(z_loan(s), z_loan(ke), z_move(payload), NULL) == Z_OK);
+    }
+
+    size_t received = 0;
+    z_owned_closure_sample_t callback;
+    z_closure(&callback, count_samples, NULL, &received);
+    ze_querying_subscriber_options_t sub_options;
+    ze_querying_subscriber_options_default(&sub_options);
+    sub_options.streaming_merge = true;
+    ze_owned_querying_subscriber_t sub;
+    assert(ze_declare_querying_subscriber(z_loan(s), &sub, z_loan(ke), z_move(callback), &sub_options) == Z_OK);
+    z_sleep_ms(100);
+    assert(received == 3);
+
+    z_owned_bytes_t payload;
+    z_bytes_copy_from_str(&payload, "live");
+    assert(z_put(z_loan(s), z_loan(ke), z_move(payload), NULL) == Z_OK);
+    assert(received == 4);
+
+    // the cached samples are all superseded by the live one
+    assert(ze_querying_subscriber_get(z_loan(sub), z_loan(ke), NULL) == Z_OK);
+    z_sleep_ms(100);
+    assert(received == 4);
+
+    z_drop(z_move(sub));
+    z_drop(z_move(cache));
+    z_drop(z_move(s));
+#endif
+}
+
+void entity_stats() {
+#if defined(Z_FEATURE_UNSTABLE_API)
+    z_owned_config_t config;
+    z_config_default(&config);
+
+    z_owned_session_t s;
+    if (z_open(&s, z_move(config), NULL) < 0) {
+        perror("Unable to open session!");
+        exit(-1);
+    }
+
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, "test/entity_stats");
+    size_t received = 0;
+    z_owned_closure_sample_t callback;
+    z_closure(&callback, count_samples, NULL, &received);
+    z_owned_subscriber_t sub;
+    assert(z_declare_subscriber(z_loan(s), &sub, z_loan(ke), z_move(callback), NULL) == Z_OK);
+    z_owned_closure_query_t qable_callback;
+    z_closure(&qable_callback, get_many_query_handler, NULL, NULL);
+    z_owned_queryable_t qable;
+    assert(z_declare_queryable(z_loan(s), &qable, z_loan(ke), z_move(qable_callback), NULL) == Z_OK);
+    z_publisher_options_t pub_options;
+    z_publisher_options_default(&pub_options);
+    pub_options.congestion_control = Z_CONGESTION_CONTROL_BLOCK;
+    z_owned_publisher_t pub;
+    assert(z_declare_publisher(z_loan(s), &pub, z_loan(ke), &pub_options) == Z_OK);
+    z_sleep_ms(100);
+
+    for (size_t i = 0; i < 3; i++) {
+        z_owned_bytes_t payload;
+        z_bytes_copy_from_str(&payload, "stats");
+        assert(z_publisher_put(z_loan(pub), z_move(payload), NULL) == Z_OK);
+    }
+    assert(received == 3);
+    z_owned_closure_reply_t closure;
+    z_owned_fifo_handler_reply_t handler;
+    z_fifo_channel_reply_new(&closure, &handler, 4);
+    assert(z_get(z_loan(s), z_loan(ke), "", z_move(closure), NULL) == Z_OK);
+    z_owned_reply_t reply;
+    assert(z_recv(z_loan(handler), &reply) == Z_OK);
+    z_drop(z_move(reply));
+    z_drop(z_move(handler));
+
+    zc_entity_stats_t stats;
+    assert(zc_publisher_get_stats(z_loan(pub), &stats) == Z_OK);
+    assert(stats.messages == 3);
+    assert(stats.bytes == 15);
+    assert(stats.dropped == 0);
+    assert(stats.blocked_time_ns > 0);
+    assert(zc_subscriber_get_stats(z_loan(sub), &stats) == Z_OK);
+    assert(stats.messages == 3);
+    assert(stats.bytes == 15);
+    assert(stats.blocked_time_ns == 0);
+    assert(zc_queryable_get_stats(z_loan(qable), &stats) == Z_OK);
+    assert(stats.messages == 1);
+    assert(stats.bytes == 0);
+
+    // the session counters outlive the undeclared entities
+    z_drop(z_move(pub));
+    z_drop(z_move(sub));
+    zc_session_stats_t session_stats;
+    assert(zc_session_get_stats(z_loan(s), &session_stats) == Z_OK);
+    assert(session_stats.publishers.messages == 3);
+    assert(session_stats.subscribers.bytes == 15);
+    assert(session_stats.queryables.messages == 1);
+
+    z_drop(z_move(qable));
+    z_drop(z_move(s));
+#endif
+}
+
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct spans_context_t {
+    size_t spans[3];
+    uint64_t payload_len;
+    bool dropped;
+} spans_context_t;
+
+void on_span(const zc_span_t *span, void *context) {
+    spans_context_t *ctx = (spans_context_t *)context;
+    assert(span->kind <= ZC_SPAN_KIND_QUERY_CALLBACK);
+    assert(span->start_ns > 0);
+    ctx->spans[span->kind]++;
+    ctx->payload_len = span->payload_len;
+}
+
+void on_spans_drop(void *context) { ((spans_context_t *)context)->dropped = true; }
+#endif
+
+void spans() {
+#if defined(Z_FEATURE_UNSTABLE_API)
+    spans_context_t ctx = {.spans = {0, 0, 0}, .payload_len = 0, .dropped = false};
+    zc_owned_closure_span_t callback;
+    z_closure(&callback, on_span, on_spans_drop, &ctx);
+    assert(zc_init_spans_with_callback(0, z_move(callback)) == Z_EINVAL);
+    assert(ctx.dropped);
+    ctx.dropped = false;
+
+    z_owned_config_t config;
+    z_config_default(&config);
+    z_owned_session_t s;
+    if (z_open(&s, z_move(config), NULL) < 0) {
+        perror("Unable to open session!");
+        exit(-1);
+    }
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, "test/spans");
+    size_t received = 0;
+    z_owned_closure_sample_t sample_callback;
+    z_closure(&sample_callback, count_samples, NULL, &received);
+    z_owned_subscriber_t sub;
+    assert(z_declare_subscriber(z_loan(s), &sub, z_loan(ke), z_move(sample_callback), NULL) == Z_OK);
+    z_owned_publisher_t pub;
+    assert(z_declare_publisher(z_loan(s), &pub, z_loan(ke), NULL) == Z_OK);
+    z_sleep_ms(100);
+
+    // every message of the thread is sampled, the matching sample is delivered from the put
+    z_closure(&callback, on_span, on_spans_drop, &ctx);
+    assert(zc_init_spans_with_callback(1, z_move(callback)) == Z_OK);
+    for (size_t i = 0; i < 4; i++) {
+        z_owned_bytes_t payload;
+        z_bytes_copy_from_str(&payload, "spans");
+        assert(z_publisher_put(z_loan(pub), z_move(payload), NULL) == Z_OK);
+    }
+    zc_stop_spans();
+    assert(ctx.dropped);
+    assert(received == 4);
+    assert(ctx.spans[ZC_SPAN_KIND_PUT] == 4);
+    assert(ctx.spans[ZC_SPAN_KIND_SAMPLE_CALLBACK] == 4);
+    assert(ctx.payload_len == 5);
+
+    z_owned_bytes_t payload;
+    z_bytes_copy_from_str(&payload, "spans");
+    assert(z_publisher_put(z_loan(pub), z_move(payload), NULL) == Z_OK);
+    assert(ctx.spans[ZC_SPAN_KIND_PUT] == 4);
+
+    z_drop(z_move(pub));
+    z_drop(z_move(sub));
+    z_drop(z_move(s));
+#endif
+}
+
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct slow_subscriber_t {
+    z_owned_mutex_t mutex;
+    size_t received;
+} slow_subscriber_t;
+
+void slow_callback(z_loaned_sample_t *sample, void *context) {
+    slow_subscriber_t *sub = (slow_subscriber_t *)context;
+    z_mutex_lock(z_loan_mut(sub->mutex));
+    if (sub->received++ == 0) {
+        z_sleep_ms(20);
+    }
+    z_mutex_unlock(z_loan_mut(sub->mutex));
+}
+#endif
+
+void callback_watchdog() {
+#if defined(Z_FEATURE_UNSTABLE_API)
+    spans_context_t ctx = {.spans = {0, 0, 0}, .payload_len = 0, .dropped = false};
+    zc_owned_closure_span_t callback;
+    z_closure(&callback, on_span, on_spans_drop, &ctx);
+    assert(zc_init_callback_watchdog(0, 0, z_move(callback)) == Z_EINVAL);
+    assert(ctx.dropped);
+    ctx.dropped = false;
+
+    z_owned_config_t config;
+    z_config_default(&config);
+    z_owned_session_t s;
+    if (z_open(&s, z_move(config), NULL) < 0) {
+        perror("Unable to open session!");
+        exit(-1);
+    }
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, "test/watchdog");
+    slow_subscriber_t slow = {.received = 0};
+    z_mutex_init(&slow.mutex);
+    z_owned_closure_sample_t sample_callback;
+    z_closure(&sample_callback, slow_callback, NULL, &slow);
+    z_owned_subscriber_t sub;
+    assert(z_declare_subscriber(z_loan(s), &sub, z_loan(ke), z_move(sample_callback), NULL) == Z_OK);
+    z_owned_publisher_t pub;
+    assert(z_declare_publisher(z_loan(s), &pub, z_loan(ke), NULL) == Z_OK);
+    z_sleep_ms(100);
+
+    // the first sample exceeds the threshold, the next ones are delivered by the isolated thread
+    z_closure(&callback, on_span, on_spans_drop, &ctx);
+    assert(zc_init_callback_watchdog(10000000, 16, z_move(callback)) == Z_OK);
+    for (size_t i = 0; i < 4; i++) {
+        z_owned_bytes_t payload;
+        z_bytes_copy_from_str(&payload, "watchdog");
+        assert(z_publisher_put(z_loan(pub), z_move(payload), NULL) == Z_OK);
+    }
+    assert(ctx.spans[ZC_SPAN_KIND_SAMPLE_CALLBACK] == 1);
+    assert(ctx.payload_len == 8);
+    z_sleep_ms(100);
+    z_mutex_lock(z_loan_mut(slow.mutex));
+    assert(slow.received == 4);
+    z_mutex_unlock(z_loan_mut(slow.mutex));
+
+    zc_callback_histogram_t histogram;
+    assert(zc_subscriber_get_callback_histogram(z_loan(sub), &histogram) == Z_OK);
+    uint64_t timed = 0;
+    for (size_t i = 0; i < 32; i++) {
+        timed += histogram.buckets[i];
+    }
+    assert(timed == 4);
+    assert(histogram.buckets[0] < 4);
+
+    zc_stop_callback_watchdog();
+    assert(ctx.dropped);
+    z_drop(z_move(pub));
+    z_drop(z_move(sub));
+    z_drop(z_move(s));
+    z_drop(z_move(slow.mutex));
+#endif
+}
+
+void deferred_callbacks() {
+#if defined(Z_FEATURE_UNSTABLE_API)
+    z_owned_config_t config;
+    z_config_default(&config);
+    z_open_options_t opts;
+    z_open_options_default(&opts);
+    assert(!opts.deferred_callbacks);
+    opts.deferred_callbacks = true;
+    z_owned_session_t s;
+    if (z_open(&s, z_move(config), &opts) < 0) {
+        perror("Unable to open session!");
+        exit(-1);
+    }
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, "test/deferred");
+    size_t received = 0;
+    z_owned_closure_sample_t sample_callback;
+    z_closure(&sample_callback, count_samples, NULL, &received);
+    z_owned_subscriber_t sub;
+    assert(z_declare_subscriber(z_loan(s), &sub, z_loan(ke), z_move(sample_callback), NULL) == Z_OK);
+    z_sleep_ms(100);
+    assert(zc_session_poll(z_loan(s), 0) == Z_CHANNEL_NODATA);
+
+    // the samples are only delivered when the session is polled
+    for (size_t i = 0; i < 3; i++) {
+        z_owned_bytes_t payload;
+        z_bytes_copy_from_str(&payload, "deferred");
+        assert(z_put(z_loan(s), z_loan(ke), z_move(payload), NULL) == Z_OK);
+    }
+    assert(received == 0);
+    assert(zc_session_poll(z_loan(s), 1000) == Z_OK);
+    assert(received == 3);
+    assert(zc_session_poll(z_loan(s), 10) == Z_CHANNEL_NODATA);
+
+    z_owned_config_t config2;
+    z_config_default(&config2);
+    z_owned_session_t s2;
+    if (z_open(&s2, z_move(config2), NULL) < 0) {
+        perror("Unable to open session!");
+        exit(-1);
+    }
+    assert(zc_session_poll(z_loan(s2), 0) == Z_EUNAVAILABLE);
+
+    z_drop(z_move(sub));
+    z_drop(z_move(s2));
+    z_drop(z_move(s));
+#endif
+}
+
+void bulk_declarations() {
+#if defined(Z_FEATURE_UNSTABLE_API)
+    z_owned_config_t config;
+    z_config_default(&config);
+    z_owned_session_t s;
+    if (z_open(&s, z_move(config), NULL) < 0) {
+        perror("Unable to open session!");
+        exit(-1);
+    }
+    z_view_keyexpr_t ke[3];
+    const z_loaned_keyexpr_t *kes[3];
+    z_view_keyexpr_from_str(&ke[0], "test/bulk/0");
+    z_view_keyexpr_from_str(&ke[1], "test/bulk/1");
+    z_view_keyexpr_from_str(&ke[2], "test/bulk/2");
+    for (size_t i = 0; i < 3; i++) {
+        kes[i] = z_loan(ke[i]);
+    }
+
+    size_t received = 0;
+    z_owned_closure_sample_t callback;
+    z_closure(&callback, count_samples, NULL, &received);
+    z_owned_subscriber_t subs[3];
+    assert(zc_declare_subscribers(z_loan(s), subs, kes, 3, z_move(callback), NULL) == Z_OK);
+    z_owned_publisher_t pubs[3];
+    assert(zc_declare_publishers(z_loan(s), pubs, kes, 3, NULL) == Z_OK);
+    z_owned_liveliness_token_t tokens[3];
+    assert(zc_liveliness_declare_tokens(z_loan(s), tokens, kes, 3, NULL) == Z_OK);
+    for (size_t i = 0; i < 3; i++) {
+        assert(z_internal_check(subs[i]));
+        assert(z_internal_check(pubs[i]));
+        assert(z_internal_check(tokens[i]));
+    }
+    z_sleep_ms(100);
+
+    // the samples of all subscribers are delivered to the shared callback
+    for (size_t i = 0; i < 3; i++) {
+        z_owned_bytes_t payload;
+        z_bytes_copy_from_str(&payload, "bulk");
+        assert(z_publisher_put(z_loan(pubs[i]), z_move(payload), NULL) == Z_OK);
+    }
+    z_sleep_ms(100);
+    assert(received == 3);
+
+    for (size_t i = 0; i < 3; i++) {
+        z_drop(z_move(tokens[i]));
+        z_drop(z_move(pubs[i]));
+        z_drop(z_move(subs[i]));
+    }
+    z_drop(z_move(s));
+#endif
+}
+
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct interned_encoding_context_t {
+    uint32_t id;
+    size_t matched;
+} interned_encoding_context_t;
+
+void match_encoding(z_loaned_sample_t *sample, void *context) {
+    interned_encoding_context_t *c = (interned_encoding_context_t *)context;
+    const zc_interned_encoding_t *e;
+    if (zc_encoding_find_interned(z_sample_encoding(sample), &e) == Z_OK && e->id == c->id) {
+        c->matched++;
+    }
+}
+#endif
+
+void interned_encoding() {
+#if defined(Z_FEATURE_UNSTABLE_API)
+    z_owned_config_t config;
+    z_config_default(&config);
+    z_owned_session_t s;
+    if (z_open(&s, z_move(config), NULL) < 0) {
+        perror("Unable to open session!");
+        exit(-1);
+    }
+    const zc_interned_encoding_t *encoding;
+    assert(zc_encoding_intern_from_str("application/protobuf;test.Interned", &encoding) == Z_OK);
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, "test/interned_encoding");
+
+    interned_encoding_context_t context = {.id = encoding->id, .matched = 0};
+    z_owned_closure_sample_t callback;
+    z_closure(&callback, match_encoding, NULL, &context);
+    z_owned_subscriber_t sub;
+    assert(z_declare_subscriber(z_loan(s), &sub, z_loan(ke), z_move(callback), NULL) == Z_OK);
+    z_owned_publisher_t pub;
+    assert(z_declare_publisher(z_loan(s), &pub, z_loan(ke), NULL) == Z_OK);
+    z_sleep_ms(100);
+
+    // the interned encoding is not consumed, so the same options can be reused for every put
+    z_publisher_put_options_t opts;
+    z_publisher_put_options_default(&opts);
+    opts.interned_encoding = encoding;
+    for (size_t i = 0; i < 3; i++) {
+        z_owned_bytes_t payload;
+        z_bytes_copy_from_str(&payload, "interned");
+        assert(z_publisher_put(z_loan(pub), z_move(payload), &opts) == Z_OK);
+    }
+    z_sleep_ms(100);
+    assert(context.matched == 3);
+
+    z_drop(z_move(pub));
+    z_drop(z_move(sub));
+    z_drop(z_move(s));
+#endif
+}
+
+void fast_timestamps() {
+    z_clock_t start = z_clock_now();
+    z_sleep_us(10);
+    assert(z_clock_elapsed_ns(&start) >= 10000);
+#if defined(Z_FEATURE_UNSTABLE_API)
+    z_owned_config_t config;
+    z_config_default(&config);
+    z_owned_session_t s;
+    assert(z_open(&s, z_move(config), NULL) == Z_OK);
+    z_id_t zid = z_info_zid(z_loan(s));
+
+    // timestamps are extrapolated from the monotonic clock until the counter is calibrated
+    uint64_t last = 0;
+    for (int calibrated = 0; calibrated < 2; calibrated++) {
+        if (calibrated) {
+            zc_clock_tsc_calibration_t calibration;
+            if (zc_clock_tsc_calibrate(&calibration, 0) != Z_OK) {
+                break;
+            }
+            assert(calibration.ns_per_tick > 0);
+            uint64_t ticks = zc_clock_tsc_read();
+            z_sleep_ms(1);
+            assert(zc_clock_tsc_elapsed_ns(&calibration, ticks, zc_clock_tsc_read()) >= 1000000);
+        }
+        for (int i = 0; i < 100; i++) {
+            z_timestamp_t ts;
+            assert(zc_timestamp_new_fast(&ts, z_loan(s)) == Z_OK);
+            assert(z_timestamp_ntp64_time(&ts) > last);
+            last = z_timestamp_ntp64_time(&ts);
+            z_id_t id = z_timestamp_id(&ts);
+            assert(memcmp(id.id, zid.id, sizeof(zid.id)) == 0);
+        }
+    }
+
+    // the fast timestamps stay close to the ones of the session clock
+    z_timestamp_t ts;
+    assert(z_timestamp_new(&ts, z_loan(s)) == Z_OK);
+    uint64_t delta = z_timestamp_ntp64_time(&ts) > last ? z_timestamp_ntp64_time(&ts) - last
+                                                        : last - z_timestamp_ntp64_time(&ts);
+    assert(delta < ((uint64_t)1 << 32));
+
+    z_drop(z_move(s));
+#endif
+}
+
+void runtime_options() {
+#if defined(Z_FEATURE_UNSTABLE_API)
+    // must run before any session is opened by the other tests
+    zc_runtime_options_t opts;
+    zc_runtime_options_default(&opts);
+    assert(opts.app.worker_threads == 0);
+    assert(opts.rx.cpu_affinity_mask == 0);
+    opts.app.worker_threads = 2;
+    opts.tx.max_blocking_threads = 4;
+    assert(zc_init_runtime(&opts) == Z_OK);
+    assert(zc_init_runtime(&opts) == Z_EUNAVAILABLE);
+#endif
+}
+
+void runtime_warm_up() {
+#if defined(Z_FEATURE_UNSTABLE_API)
+    // must run after `runtime_options()` and before any session is opened by the other tests; warming up is idempotent
+    zc_runtime_warm_up();
+    zc_runtime_warm_up();
+
+    z_owned_config_t config;
+    z_config_default(&config);
+    z_owned_session_t s;
+    if (z_open(&s, z_move(config), NULL) < 0) {
+        perror("Unable to open session!");
+        exit(-1);
+    }
+    zc_runtime_warm_up();
+    z_drop(z_move(s));
+
+    // the pools are kept once the session is closed
+    zc_runtime_warm_up();
+    z_config_default(&config);
+    if (z_open(&s, z_move(config), NULL) < 0) {
+        perror("Unable to open session!");
+        exit(-1);
+    }
+    z_drop(z_move(s));
+#endif
+}
+
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct scouting_context_t {
+    size_t hellos;
+    zc_owned_string_arena_t locators;
+} scouting_context_t;
+
+// collects the locators of the hellos to the arena, checking them against `z_hello_locators()`
+void collect_hello(z_loaned_hello_t *hello, void *context) {
+    scouting_context_t *ctx = (scouting_context_t *)context;
+    ctx->hellos++;
+    size_t start = zc_string_arena_len(z_loan(ctx->locators));
+    z_owned_string_array_t expected;
+    z_hello_locators(hello, &expected);
+    size_t len = zc_hello_locators_push(hello, z_loan_mut(ctx->locators));
+    assert(len == start + z_string_array_len(z_loan(expected)));
+    assert(len == zc_string_arena_len(z_loan(ctx->locators)));
+    for (size_t i = 0; i < z_string_array_len(z_loan(expected)); i++) {
+        const z_loaned_string_t *e = z_string_array_get(z_loan(expected), i);
+        z_view_string_t l;
+        assert(zc_string_arena_get(z_loan(ctx->locators), start + i, &l) == Z_OK);
+        assert(z_string_len(z_loan(l)) == z_string_len(e));
+        assert(strncmp(z_string_data(z_loan(l)), z_string_data(e), z_string_len(e)) == 0);
+    }
+    z_drop(z_move(expected));
+}
+#endif
+
+void scouting_max_hellos() {
+#if defined(Z_FEATURE_UNSTABLE_API)
+    z_owned_config_t config;
+    z_config_default(&config);
+
+    z_owned_session_t s;
+    if (z_open(&s, z_move(config), NULL) < 0) {
+        perror("Unable to open session!");
+        exit(-1);
+    }
+    z_sleep_s(1);
+
+    z_scout_options_t opts;
+    z_scout_options_default(&opts);
+    assert(opts.max_hellos == 0);
+    assert(opts.grace_ms == 0);
+    opts.what = Z_WHAT_PEER;
+    opts.timeout_ms = 10000;
+    opts.max_hellos = 1;
+
+    scouting_context_t ctx = {.hellos = 0};
+    zc_string_arena_new(&ctx.locators);
+    z_owned_closure_hello_t callback;
+    z_closure(&callback, collect_hello, NULL, &ctx);
+    z_owned_config_t scout_config;
+    z_config_default(&scout_config);
+    z_clock_t start = z_clock_now();
+    assert(z_scout(z_move(scout_config), z_move(callback), &opts) == Z_OK);
+    // scouting stops on the hello of the local peer, well before the timeout
+    assert(z_clock_elapsed_ms(&start) < opts.timeout_ms / 2);
+    assert(ctx.hellos == 1);
+    // a peer listens on at least one locator
+    assert(!zc_string_arena_is_empty(z_loan(ctx.locators)));
+    z_drop(z_move(ctx.locators));
+
+    z_drop(z_move(s));
+#endif
+}
+
 int main(int argc, char **argv) {
     zc_try_init_log_from_env();
+    runtime_options();
+    runtime_warm_up();
     close_drop();
     close_sync();
     close_concurrent();
+    close_concurrent_poll();
+    get_many();
+    queryable_workers();
+    subscriber_workers();
+    executor_workers();
+    reply_batch();
+    local_consolidation();
+    cancellable_get();
+    budgeted_publication_cache();
+    log_publication_cache();
+    streaming_querying_subscriber();
+    entity_stats();
+    spans();
+    callback_watchdog();
+    deferred_callbacks();
+    bulk_declarations();
+    interned_encoding();
+    fast_timestamps();
+    scouting_max_hellos();
 }
@@ -321,6 +321,266 @@ int run_posix_provider() {
     return Z_OK;
 }
 
+int run_posix_provider_with_stats() {
+    const size_t total_size = 4096;
+    const size_t buf_ok_size = total_size / 4;
+    const size_t buf_err_size = total_size * 2;
+
+    z_alloc_alignment_t alignment = {4};
+
+    z_owned_memory_layout_t layout;
+    ASSERT_OK(z_memory_layout_new(&layout, total_size, alignment));
+    ASSERT_CHECK(layout);
+
+    z_owned_shm_provider_t provider;
+    ASSERT_OK(z_posix_shm_provider_new(&provider, z_loan(layout)));
+    zc_shm_provider_stats_t stats;
+    ASSERT_TRUE(zc_shm_provider_stats(z_loan(provider), &stats) == Z_EUNAVAILABLE);
+    z_drop(z_move(provider));
+
+    ASSERT_OK(zc_posix_shm_provider_with_stats_new(&provider, z_loan(layout)));
+    ASSERT_CHECK(provider);
+    ASSERT_OK(zc_shm_provider_stats(z_loan(provider), &stats));
+    ASSERT_TRUE(stats.alloc_count == 0 && stats.bytes_in_use == 0);
+
+    ASSERT_OK(test_provider(&provider, alignment, buf_ok_size, buf_err_size));
+
+    ASSERT_OK(zc_shm_provider_stats(z_loan(provider), &stats));
+    ASSERT_TRUE(stats.alloc_count >= 200);
+    ASSERT_TRUE(stats.gc_count == 1);
+    ASSERT_TRUE(stats.defrag_count >= 1);
+    // all buffers are dropped and garbage collected
+    ASSERT_TRUE(stats.bytes_in_use == 0);
+    for (size_t i = 0; i < ZC_SHM_STATS_SIZE_CLASSES; ++i) {
+        ASSERT_TRUE(stats.chunks_by_size_class[i] == 0);
+    }
+    ASSERT_TRUE(stats.bytes_available == z_shm_provider_available(z_loan(provider)));
+
+    z_buf_layout_alloc_result_t alloc;
+    z_shm_provider_alloc_gc_defrag_blocking(&alloc, z_loan(provider), buf_ok_size, alignment);
+    ASSERT_TRUE(alloc.status == ZC_BUF_LAYOUT_ALLOC_STATUS_OK);
+    ASSERT_OK(zc_shm_provider_stats(z_loan(provider), &stats));
+    ASSERT_TRUE(stats.blocking_alloc_count == 1);
+    ASSERT_TRUE(stats.bytes_in_use >= buf_ok_size);
+    z_drop(z_move(alloc.buf));
+
+    z_drop(z_move(provider));
+    ASSERT_CHECK_ERR(provider);
+
+    z_drop(z_move(layout));
+    ASSERT_CHECK_ERR(layout);
+
+    return Z_OK;
+}
+
+int run_completion_queue() {
+    const size_t total_size = 4096;
+    const size_t buf_size = total_size / 4;
+
+    z_alloc_alignment_t alignment = {4};
+
+    z_owned_memory_layout_t layout;
+    ASSERT_OK(z_memory_layout_new(&layout, total_size, alignment));
+    ASSERT_CHECK(layout);
+
+    z_owned_shm_provider_t provider;
+    ASSERT_OK(z_posix_shm_provider_new(&provider, z_loan(layout)));
+    ASSERT_CHECK(provider);
+
+    zc_owned_shm_completion_queue_t queue;
+    ASSERT_OK(zc_shm_completion_queue_new(&queue));
+    ASSERT_CHECK(queue);
+
+    int tags[2];
+    for (int i = 0; i < 2; ++i) {
+        ASSERT_OK(zc_shm_provider_alloc_gc_defrag_async_to_queue(z_loan(provider), buf_size, alignment, z_loan(queue),
+                                                                 &tags[i]));
+    }
+
+    zc_shm_completion_t completions[2];
+    size_t n = 0;
+    for (int i = 0; i < 100 && n < 2; ++i) {
+        n += zc_shm_completion_queue_drain(z_loan(queue), completions + n, 2 - n);
+        if (n < 2) {
+            z_sleep_ms(10);
+        }
+    }
+    ASSERT_TRUE(n == 2);
+    for (size_t i = 0; i < n; ++i) {
+        ASSERT_TRUE(completions[i].user_data == &tags[0] || completions[i].user_data == &tags[1]);
+        ASSERT_TRUE(completions[i].result.status == ZC_BUF_LAYOUT_ALLOC_STATUS_OK);
+        z_drop(z_move(completions[i].result.buf));
+    }
+    ASSERT_TRUE(completions[0].user_data != completions[1].user_data);
+    ASSERT_TRUE(zc_shm_completion_queue_drain(z_loan(queue), completions, 2) == 0);
+
+    z_drop(z_move(queue));
+    ASSERT_CHECK_ERR(queue);
+
+    z_drop(z_move(provider));
+    ASSERT_CHECK_ERR(provider);
+
+    z_drop(z_move(layout));
+    ASSERT_CHECK_ERR(layout);
+
+    return Z_OK;
+}
+
+int run_posix_provider_with_options() {
+    const size_t total_size = 4 * 1024 * 1024;
+    const size_t buf_ok_size = total_size / 4;
+    const size_t buf_err_size = total_size * 2;
+
+    z_alloc_alignment_t alignment = {4};
+
+    z_owned_memory_layout_t layout;
+    ASSERT_OK(z_memory_layout_new(&layout, total_size, alignment));
+    ASSERT_CHECK(layout);
+
+    zc_posix_shm_provider_options_t options;
+    zc_posix_shm_provider_options_default(&options);
+    ASSERT_TRUE(!options.huge_pages && options.numa_node == -1 && !options.prefault);
+    // placement policies are best-effort, the provider is usable even if they are refused
+    options.huge_pages = true;
+    options.numa_node = 0;
+    options.prefault = true;
+
+    z_owned_shm_provider_t provider;
+    ASSERT_OK(zc_posix_shm_provider_with_options_new(&provider, z_loan(layout), &options));
+    ASSERT_CHECK(provider);
+
+    ASSERT_OK(test_provider(&provider, alignment, buf_ok_size, buf_err_size));
+
+    z_drop(z_move(provider));
+    ASSERT_CHECK_ERR(provider);
+
+    z_drop(z_move(layout));
+    ASSERT_CHECK_ERR(layout);
+
+    return Z_OK;
+}
+
+int run_posix_provider_with_thread_cache() {
+    const size_t total_size = 4096;
+    const size_t buf_ok_size = total_size / 4;
+    const size_t buf_err_size = total_size * 2;
+
+    z_alloc_alignment_t alignment = {4};
+
+    z_owned_memory_layout_t layout;
+    ASSERT_OK(z_memory_layout_new(&layout, total_size, alignment));
+    ASSERT_CHECK(layout);
+
+    zc_shm_thread_cache_options_t options;
+    zc_shm_thread_cache_options_default(&options);
+    options.magazine_size = 2;
+
+    z_owned_shm_provider_t provider;
+    ASSERT_OK(zc_posix_shm_provider_with_thread_cache_new(&provider, z_loan(layout), &options));
+    ASSERT_CHECK(provider);
+
+    ASSERT_OK(test_provider(&provider, alignment, buf_ok_size, buf_err_size));
+
+    z_drop(z_move(provider));
+    ASSERT_CHECK_ERR(provider);
+
+    z_drop(z_move(layout));
+    ASSERT_CHECK_ERR(layout);
+
+    return Z_OK;
+}
+
+int run_posix_slab_provider() {
+    const size_t chunk_size = 1024;
+    const size_t count = 4;
+
+    z_alloc_alignment_t alignment = {4};
+
+    z_owned_memory_layout_t layout;
+    ASSERT_OK(z_memory_layout_new(&layout, chunk_size, alignment));
+    ASSERT_CHECK(layout);
+
+    z_owned_shm_provider_t provider;
+    ASSERT_OK(zc_posix_shm_slab_provider_new(&provider, z_loan(layout), count));
+    ASSERT_CHECK(provider);
+    ASSERT_TRUE(z_shm_provider_available(z_loan(provider)) == chunk_size * count);
+
+    ASSERT_OK(test_provider(&provider, alignment, chunk_size, chunk_size * 2));
+
+    // smaller allocations take a whole chunk
+    z_buf_layout_alloc_result_t alloc;
+    z_shm_provider_alloc(&alloc, z_loan(provider), 10, alignment);
+    ASSERT_TRUE(alloc.status == ZC_BUF_LAYOUT_ALLOC_STATUS_OK);
+    ASSERT_TRUE(z_shm_provider_available(z_loan(provider)) == chunk_size * (count - 1));
+    z_drop(z_move(alloc.buf));
+    ASSERT_TRUE(z_shm_provider_defragment(z_loan(provider)) == 0);
+
+    z_drop(z_move(provider));
+    ASSERT_CHECK_ERR(provider);
+
+    z_drop(z_move(layout));
+    ASSERT_CHECK_ERR(layout);
+
+    return Z_OK;
+}
+
+typedef struct {
+    size_t returned;
+    size_t free_chunks;
+    bool deleted;
+} test_slab_context;
+
+void slab_returned_fn(size_t free_chunks, void* context) {
+    test_slab_context* c = (test_slab_context*)context;
+    c->returned++;
+    c->free_chunks = free_chunks;
+}
+
+void delete_slab_fn(void* context) { ((test_slab_context*)context)->deleted = true; }
+
+int run_posix_slab_provider_with_notify() {
+    const size_t chunk_size = 1024;
+    const size_t count = 2;
+
+    z_alloc_alignment_t alignment = {4};
+
+    z_owned_memory_layout_t layout;
+    ASSERT_OK(z_memory_layout_new(&layout, chunk_size, alignment));
+    ASSERT_CHECK(layout);
+
+    test_slab_context test_context = {0, 0, false};
+    zc_threadsafe_context_t context = {{&test_context}, &delete_slab_fn};
+    zc_shm_slab_callbacks_t callbacks = {&slab_returned_fn};
+    z_owned_shm_provider_t provider;
+    ASSERT_OK(zc_posix_shm_slab_provider_with_notify_new(&provider, z_loan(layout), count, context, callbacks));
+    ASSERT_CHECK(provider);
+
+    z_buf_layout_alloc_result_t alloc1, alloc2;
+    z_shm_provider_alloc(&alloc1, z_loan(provider), chunk_size, alignment);
+    ASSERT_TRUE(alloc1.status == ZC_BUF_LAYOUT_ALLOC_STATUS_OK);
+    z_shm_provider_alloc(&alloc2, z_loan(provider), chunk_size, alignment);
+    ASSERT_TRUE(alloc2.status == ZC_BUF_LAYOUT_ALLOC_STATUS_OK);
+    ASSERT_TRUE(z_shm_provider_available(z_loan(provider)) == 0);
+
+    // released chunks are returned to the slab by the next garbage collection
+    z_drop(z_move(alloc1.buf));
+    z_drop(z_move(alloc2.buf));
+    ASSERT_TRUE(test_context.returned == 0);
+    z_shm_provider_garbage_collect(z_loan(provider));
+    ASSERT_TRUE(test_context.returned == count);
+    ASSERT_TRUE(test_context.free_chunks == count);
+    ASSERT_TRUE(z_shm_provider_available(z_loan(provider)) == chunk_size * count);
+
+    z_drop(z_move(provider));
+    ASSERT_CHECK_ERR(provider);
+    ASSERT_TRUE(test_context.deleted);
+
+    z_drop(z_move(layout));
+    ASSERT_CHECK_ERR(layout);
+
+    return Z_OK;
+}
+
 int test_client_storage(z_owned_shm_client_storage_t* storage) {
     ASSERT_CHECK(*storage);
 
@@ -449,6 +709,138 @@ int run_c_client() {
     return Z_OK;
 }
 
+void delete_counting_client_fn(void* context) {}
+
+bool counting_attach_fn(struct z_shm_segment_t* out_segment, z_segment_id_t id, void* context) {
+    (*(size_t*)context)++;
+    out_segment->context.context.ptr = (void*)(uint64_t)id;
+    out_segment->context.delete_fn = &delete_segment_fn;
+    out_segment->callbacks.map_fn = &map_fn;
+    return true;
+}
+
+int run_c_client_cache() {
+    size_t attached = 0;
+    zc_threadsafe_context_t context = {{&attached}, &delete_counting_client_fn};
+    zc_shm_client_callbacks_t callbacks = {&counting_attach_fn};
+    z_owned_shm_client_t client;
+    z_shm_client_new(&client, context, callbacks);
+
+    // create a cache holding up to 2 segments
+    zc_owned_shm_client_cache_t cache;
+    ASSERT_OK(zc_shm_client_cache_new(&cache, z_move(client), 2));
+    ASSERT_CHECK(cache);
+    ASSERT_CHECK_ERR(client);
+
+    // prefetched segments are attached once
+    ASSERT_OK(zc_shm_client_cache_prefetch(z_loan(cache), 1));
+    ASSERT_OK(zc_shm_client_cache_prefetch(z_loan(cache), 1));
+    ASSERT_OK(zc_shm_client_cache_prefetch(z_loan(cache), 2));
+    ASSERT_TRUE(attached == 2);
+    // the least recently used segment is released
+    ASSERT_OK(zc_shm_client_cache_prefetch(z_loan(cache), 1));
+    ASSERT_OK(zc_shm_client_cache_prefetch(z_loan(cache), 3));
+    ASSERT_TRUE(attached == 3);
+    ASSERT_OK(zc_shm_client_cache_prefetch(z_loan(cache), 1));
+    ASSERT_TRUE(attached == 3);
+    ASSERT_OK(zc_shm_client_cache_prefetch(z_loan(cache), 2));
+    ASSERT_TRUE(attached == 4);
+
+    zc_shm_client_cache_stats_t stats;
+    zc_shm_client_cache_get_stats(z_loan(cache), &stats);
+    ASSERT_TRUE(stats.prefetches == 4);
+    ASSERT_TRUE(stats.evictions == 2);
+    ASSERT_TRUE(stats.segments == 2);
+    ASSERT_TRUE(stats.hits == 0 && stats.misses == 0);
+
+    // the client attaching through the cache is used by a client storage
+    z_owned_shm_client_t cached;
+    zc_shm_client_cache_client(z_loan(cache), &cached);
+    zc_owned_shm_client_list_t list;
+    zc_shm_client_list_new(&list);
+    ASSERT_OK(zc_shm_client_list_add_client(z_loan_mut(list), 100500, z_move(cached)));
+    z_owned_shm_client_storage_t storage;
+    ASSERT_OK(z_shm_client_storage_new(&storage, z_loan(list), true));
+    ASSERT_OK(test_client_storage(&storage));
+    z_drop(z_move(storage));
+    z_drop(z_move(list));
+
+    z_drop(z_move(cache));
+    ASSERT_CHECK_ERR(cache);
+    return Z_OK;
+}
+
+int run_shm_bytes_writer() {
+    const size_t total_size = 4096;
+    const size_t chunk_size = 256;
+    uint8_t data[300];
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)i;
+    }
+
+    z_owned_memory_layout_t layout;
+    z_alloc_alignment_t alignment = {0};
+    ASSERT_OK(z_memory_layout_new(&layout, total_size, alignment));
+    z_owned_shm_provider_t provider;
+    ASSERT_OK(z_posix_shm_provider_new(&provider, z_loan(layout)));
+
+    z_owned_bytes_writer_t writer;
+    ASSERT_ERR(z_bytes_writer_from_shm_provider(&writer, z_loan(provider), 0));
+    ASSERT_CHECK_ERR(writer);
+
+    // a payload filling its reservation is a single SHM buffer
+    ASSERT_OK(z_bytes_writer_from_shm_provider(&writer, z_loan(provider), chunk_size));
+    uint8_t* buf = NULL;
+    ASSERT_OK(z_bytes_writer_reserve(z_loan_mut(writer), chunk_size, &buf));
+    memcpy(buf, data, chunk_size);
+    ASSERT_OK(z_bytes_writer_commit(z_loan_mut(writer), chunk_size));
+    z_owned_bytes_t payload;
+    z_bytes_writer_finish(z_move(writer), &payload);
+    const z_loaned_shm_t* shm = NULL;
+    ASSERT_OK(z_bytes_as_loaned_shm(z_loan(payload), &shm));
+    ASSERT_TRUE(z_shm_len(shm) == chunk_size);
+    ASSERT_TRUE(memcmp(z_shm_data(shm), data, chunk_size) == 0);
+    z_drop(z_move(payload));
+
+    // larger payloads span several SHM buffers
+    ASSERT_OK(z_bytes_writer_from_shm_provider(&writer, z_loan(provider), chunk_size));
+    for (size_t i = 0; i < 3; i++) {
+        ASSERT_OK(z_bytes_writer_reserve(z_loan_mut(writer), 100, &buf));
+        memcpy(buf, data + i * 100, 100);
+        ASSERT_OK(z_bytes_writer_commit(z_loan_mut(writer), 100));
+    }
+    z_bytes_writer_finish(z_move(writer), &payload);
+    ASSERT_TRUE(z_bytes_len(z_loan(payload)) == sizeof(data));
+    z_owned_slice_t out;
+    z_bytes_to_slice(z_loan(payload), &out);
+    ASSERT_TRUE(memcmp(z_slice_data(z_loan(out)), data, sizeof(data)) == 0);
+    z_drop(z_move(out));
+    z_drop(z_move(payload));
+
+    // data written with write_all goes to SHM buffers as well
+    ASSERT_OK(z_bytes_writer_from_shm_provider(&writer, z_loan(provider), sizeof(data)));
+    for (size_t i = 0; i < 3; i++) {
+        ASSERT_OK(z_bytes_writer_write_all(z_loan_mut(writer), data + i * 100, 100));
+    }
+    z_bytes_writer_finish(z_move(writer), &payload);
+    ASSERT_OK(z_bytes_as_loaned_shm(z_loan(payload), &shm));
+    ASSERT_TRUE(z_shm_len(shm) == sizeof(data));
+    ASSERT_TRUE(memcmp(z_shm_data(shm), data, sizeof(data)) == 0);
+    z_drop(z_move(payload));
+
+    // the writer falls back to the heap once the provider is out of memory
+    ASSERT_OK(z_bytes_writer_from_shm_provider(&writer, z_loan(provider), total_size * 2));
+    ASSERT_OK(z_bytes_writer_write_all(z_loan_mut(writer), data, 10));
+    z_bytes_writer_finish(z_move(writer), &payload);
+    ASSERT_TRUE(z_bytes_len(z_loan(payload)) == 10);
+    ASSERT_ERR(z_bytes_as_loaned_shm(z_loan(payload), &shm));
+    z_drop(z_move(payload));
+
+    z_drop(z_move(provider));
+    z_drop(z_move(layout));
+    return Z_OK;
+}
+
 int run_cleanup() {
     zc_cleanup_orphaned_shm_segments();
     return Z_OK;
@@ -456,11 +848,19 @@ int run_cleanup() {
 
 int main() {
     ASSERT_OK(run_posix_provider());
+    ASSERT_OK(run_posix_provider_with_options());
+    ASSERT_OK(run_completion_queue());
+    ASSERT_OK(run_posix_provider_with_stats());
+    ASSERT_OK(run_posix_provider_with_thread_cache());
+    ASSERT_OK(run_posix_slab_provider());
+    ASSERT_OK(run_posix_slab_provider_with_notify());
     ASSERT_OK(run_c_provider());
     ASSERT_OK(run_default_client_storage());
     ASSERT_OK(run_global_client_storage());
     ASSERT_OK(run_client_storage());
     ASSERT_OK(run_c_client());
+    ASSERT_OK(run_c_client_cache());
+    ASSERT_OK(run_shm_bytes_writer());
     ASSERT_OK(run_cleanup());
     return Z_OK;
 }
@@ -0,0 +1,204 @@
+//
+// Copyright (c) 2024 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+
+#include <stdio.h>
+#include <string.h>
+
+#include "zenoh.h"
+
+#undef NDEBUG
+#include <assert.h>
+
+#define THREADS 4
+#define ITERATIONS 10000
+
+void condvar_wait_until() {
+    z_owned_mutex_t m;
+    z_owned_condvar_t cv;
+    assert(z_mutex_init(&m) == Z_OK);
+    z_condvar_init(&cv);
+
+    z_clock_t deadline = z_clock_now();
+    z_clock_advance_ms(&deadline, 100);
+    z_clock_t start = z_clock_now();
+    assert(z_mutex_lock(z_loan_mut(m)) == Z_OK);
+    z_result_t res;
+    // retried on spurious wakeups, nobody signals the condvar
+    while ((res = z_condvar_wait_until(z_loan(cv), z_loan_mut(m), &deadline)) == Z_OK) {
+    }
+    assert(res == Z_ETIMEDOUT);
+    assert(z_clock_elapsed_ms(&start) >= 100);
+    // the mutex is locked again after a timeout
+    assert(z_mutex_unlock(z_loan_mut(m)) == Z_OK);
+
+    // a deadline in the past times out immediately
+    assert(z_mutex_lock(z_loan_mut(m)) == Z_OK);
+    assert(z_condvar_wait_until(z_loan(cv), z_loan_mut(m), &start) == Z_ETIMEDOUT);
+    assert(z_mutex_unlock(z_loan_mut(m)) == Z_OK);
+
+    z_drop(z_move(cv));
+    z_drop(z_move(m));
+}
+
+#if defined(Z_FEATURE_UNSTABLE_API)
+typedef struct {
+    const z_loaned_adaptive_mutex_t *mutex;
+    size_t counter;
+} counter_t;
+
+void *increment(void *arg) {
+    counter_t *c = (counter_t *)arg;
+    for (size_t i = 0; i < ITERATIONS; i++) {
+        z_adaptive_mutex_lock(c->mutex);
+        c->counter++;
+        z_adaptive_mutex_unlock(c->mutex);
+    }
+    return NULL;
+}
+
+void adaptive_mutex() {
+    z_owned_adaptive_mutex_t m;
+    assert(z_adaptive_mutex_init(&m) == Z_OK);
+    assert(z_internal_check(m));
+    assert(z_adaptive_mutex_unlock(z_loan(m)) == Z_EINVAL_MUTEX);
+    assert(z_adaptive_mutex_try_lock(z_loan(m)) == Z_OK);
+    assert(z_adaptive_mutex_try_lock(z_loan(m)) == Z_EBUSY_MUTEX);
+    assert(z_adaptive_mutex_unlock(z_loan(m)) == Z_OK);
+
+    counter_t c = {.mutex = z_loan(m), .counter = 0};
+    z_owned_task_t tasks[THREADS];
+    for (size_t i = 0; i < THREADS; i++) {
+        assert(z_task_init(&tasks[i], NULL, increment, &c) == Z_OK);
+    }
+    for (size_t i = 0; i < THREADS; i++) {
+        assert(z_task_join(z_move(tasks[i])) == Z_OK);
+    }
+    assert(c.counter == THREADS * ITERATIONS);
+
+    z_drop(z_move(m));
+    assert(!z_internal_check(m));
+}
+
+void rwlock() {
+    z_owned_rwlock_t l;
+    assert(z_rwlock_init(&l) == Z_OK);
+    assert(z_rwlock_read_unlock(z_loan(l)) == Z_EINVAL_MUTEX);
+    assert(z_rwlock_write_unlock(z_loan(l)) == Z_EINVAL_MUTEX);
+
+    // readers share the lock and exclude writers
+    assert(z_rwlock_read_lock(z_loan(l)) == Z_OK);
+    assert(z_rwlock_try_read_lock(z_loan(l)) == Z_OK);
+    assert(z_rwlock_try_write_lock(z_loan(l)) == Z_EBUSY_MUTEX);
+    assert(z_rwlock_write_unlock(z_loan(l)) == Z_EINVAL_MUTEX);
+    assert(z_rwlock_read_unlock(z_loan(l)) == Z_OK);
+    assert(z_rwlock_read_unlock(z_loan(l)) == Z_OK);
+
+    // a writer excludes everybody
+    assert(z_rwlock_write_lock(z_loan(l)) == Z_OK);
+    assert(z_rwlock_try_read_lock(z_loan(l)) == Z_EBUSY_MUTEX);
+    assert(z_rwlock_try_write_lock(z_loan(l)) == Z_EBUSY_MUTEX);
+    assert(z_rwlock_read_unlock(z_loan(l)) == Z_EINVAL_MUTEX);
+    assert(z_rwlock_write_unlock(z_loan(l)) == Z_OK);
+    assert(z_rwlock_try_write_lock(z_loan(l)) == Z_OK);
+    assert(z_rwlock_write_unlock(z_loan(l)) == Z_OK);
+
+    z_drop(z_move(l));
+}
+
+void *post_later(void *arg) {
+    z_sleep_ms(50);
+    z_semaphore_post((const z_loaned_semaphore_t *)arg);
+    return NULL;
+}
+
+void semaphore() {
+    z_owned_semaphore_t s;
+    assert(z_semaphore_init(&s, 2) == Z_OK);
+    assert(z_semaphore_try_wait(z_loan(s)) == Z_OK);
+    assert(z_semaphore_wait(z_loan(s)) == Z_OK);
+    assert(z_semaphore_try_wait(z_loan(s)) == Z_EBUSY_MUTEX);
+
+    z_clock_t deadline = z_clock_now();
+    z_clock_advance_ms(&deadline, 50);
+    assert(z_semaphore_wait_until(z_loan(s), &deadline) == Z_ETIMEDOUT);
+
+    z_owned_task_t task;
+    assert(z_task_init(&task, NULL, post_later, (void *)z_loan(s)) == Z_OK);
+    deadline = z_clock_now();
+    z_clock_advance_s(&deadline, 10);
+    assert(z_semaphore_wait_until(z_loan(s), &deadline) == Z_OK);
+    assert(z_task_join(z_move(task)) == Z_OK);
+
+    assert(z_semaphore_post(z_loan(s)) == Z_OK);
+    assert(z_semaphore_try_wait(z_loan(s)) == Z_OK);
+    assert(z_semaphore_try_wait(z_loan(s)) == Z_EBUSY_MUTEX);
+
+    z_drop(z_move(s));
+}
+
+#define TASKS 100
+
+typedef struct {
+    const z_loaned_adaptive_mutex_t *mutex;
+    size_t counter;
+} spawn_context_t;
+
+void *count_task(void *arg) {
+    spawn_context_t *c = (spawn_context_t *)arg;
+    z_adaptive_mutex_lock(c->mutex);
+    c->counter++;
+    z_adaptive_mutex_unlock(c->mutex);
+    return NULL;
+}
+
+void executor() {
+    z_owned_executor_t e;
+    z_executor_options_t opts;
+    z_executor_options_default(&opts);
+    opts.worker_threads = THREADS;
+    assert(z_executor_new(&e, &opts) == Z_OK);
+    assert(z_internal_check(e));
+
+    z_owned_adaptive_mutex_t m;
+    assert(z_adaptive_mutex_init(&m) == Z_OK);
+    spawn_context_t c = {.mutex = z_loan(m), .counter = 0};
+    z_owned_task_t tasks[TASKS];
+    for (size_t i = 0; i < TASKS; i++) {
+        assert(z_executor_spawn(z_loan(e), &tasks[i], count_task, &c) == Z_OK);
+    }
+    for (size_t i = 0; i < TASKS; i++) {
+        assert(z_task_join(z_move(tasks[i])) == Z_OK);
+    }
+    assert(c.counter == TASKS);
+
+    // dropping the executor runs the detached tasks
+    for (size_t i = 0; i < TASKS; i++) {
+        assert(z_executor_spawn(z_loan(e), NULL, count_task, &c) == Z_OK);
+    }
+    z_drop(z_move(e));
+    assert(!z_internal_check(e));
+    assert(c.counter == 2 * TASKS);
+
+    z_drop(z_move(m));
+}
+#endif
+
+int main(int argc, char **argv) {
+    condvar_wait_until();
+#if defined(Z_FEATURE_UNSTABLE_API)
+    adaptive_mutex();
+    rwlock();
+    semaphore();
+    executor();
+#endif
+}
@@ -0,0 +1,164 @@
+//
+// Copyright (c) 2024 ZettaScale Technology
+//
+// This program and the accompanying materials are made available under the
+// terms of the Eclipse Public License 2.0 which is available at
+// http://www.eclipse.org/legal/epl-2.0, or the Apache License, Version 2.0
+// which is available at https://www.apache.org/licenses/LICENSE-2.0.
+//
+// SPDX-License-Identifier: EPL-2.0 OR Apache-2.0
+//
+// Contributors:
+//   ZettaScale Zenoh Team, <zenoh@zettascale.tech>
+//
+
+#include "z_int_helpers.h"
+
+#ifdef VALID_PLATFORM
+
+#include <string.h>
+
+#include "zenoh.h"
+
+const char *const SEM_NAME_PUB = "/z_int_test_paged_history_sem_pub";
+sem_t *sem_pub;
+const char *const SEM_NAME_SUB = "/z_int_test_paged_history_sem_sub";
+sem_t *sem_sub;
+
+const char *const keyexpr = "test/paged_history";
+const char *const values[] = {"test_value_1", "test_value_2", "test_value_3",
+                              "test_value_4", "test_value_5", "test_value_6"};
+const size_t values_count = sizeof(values) / sizeof(values[0]);
+
+int run_publisher() {
+    z_owned_config_t config;
+    z_config_default(&config);
+    if (zc_config_insert_json5(z_loan_mut(config), Z_CONFIG_ADD_TIMESTAMP_KEY, "true") < 0) {
+        perror("Unable to configure timestamps!");
+        return -1;
+    }
+
+    z_owned_session_t s;
+    if (z_open(&s, z_move(config), NULL) < 0) {
+        perror("Unable to open session!");
+        return -1;
+    }
+
+    printf("Declaring AdvancedPublisher on '%s'...\n", keyexpr);
+    ze_owned_advanced_publisher_t pub;
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, keyexpr);
+
+    ze_advanced_publisher_options_t pub_opts;
+    ze_advanced_publisher_options_default(&pub_opts);
+    ze_advanced_publisher_cache_options_default(&pub_opts.cache);
+    pub_opts.cache.max_samples = values_count;
+
+    if (ze_declare_advanced_publisher(z_loan(s), &pub, z_loan(ke), &pub_opts) < 0) {
+        printf("Unable to declare AdvancedPublisher for key expression!\n");
+        exit(-1);
+    }
+
+    // values for cache, spread over several history pages
+    for (size_t i = 0; i < values_count; ++i) {
+        z_owned_bytes_t payload;
+        z_bytes_from_static_str(&payload, values[i]);
+        ze_advanced_publisher_put(z_loan(pub), z_move(payload), NULL);
+        z_sleep_ms(150);
+    }
+
+    SEM_POST(sem_pub);
+    printf("wait: sem_sub\n");
+    SEM_WAIT(sem_sub);
+
+    z_drop(z_move(pub));
+    z_drop(z_move(s));
+
+    return 0;
+}
+
+static size_t val_num = 0;
+static volatile int history_done = 0;
+
+void data_handler(z_loaned_sample_t *sample, void *arg) {
+    z_owned_string_t payload_str;
+    z_bytes_to_string(z_sample_payload(sample), &payload_str);
+    printf("Received: '%.*s'\n", (int)z_string_len(z_loan(payload_str)), z_string_data(z_loan(payload_str)));
+    if (val_num >= values_count) {
+        fprintf(stderr, "Unexpected sample received\n");
+        exit(-1);
+    }
+    ASSERT_STR_STRING_EQUAL(values[val_num], z_loan(payload_str));
+    z_drop(z_move(payload_str));
+    ++val_num;
+}
+
+void history_dropper(void *arg) { history_done = 1; }
+
+int run_subscriber() {
+    printf("wait: sem_pub\n");
+    SEM_WAIT(sem_pub);
+
+    z_owned_config_t config;
+    z_config_default(&config);
+
+    z_owned_session_t s;
+    if (z_open(&s, z_move(config), NULL) < 0) {
+        perror("Unable to open session!");
+        return -1;
+    }
+    z_sleep_s(1);
+
+    z_view_keyexpr_t ke;
+    z_view_keyexpr_from_str(&ke, keyexpr);
+
+    ze_history_pages_options_t opts;
+    ze_history_pages_options_default(&opts);
+    opts.max_age_ms = 5000;
+    opts.page_ms = 250;
+    opts.max_inflight_pages = 2;
+
+    z_owned_closure_sample_t callback;
+    z_closure(&callback, data_handler, history_dropper, NULL);
+    printf("Retrieving the history of '%s'...\n", keyexpr);
+    if (ze_get_history_paged(z_loan(s), z_loan(ke), z_move(callback), &opts) < 0) {
+        printf("Unable to retrieve history.\n");
+        exit(-1);
+    }
+
+    // the callback is dropped once all the pages are delivered
+    for (int i = 0; i < 50 && !history_done; ++i) {
+        z_sleep_ms(100);
+    }
+    if (!history_done) {
+        fprintf(stderr, "History retrieval did not complete\n");
+        exit(-1);
+    }
+    printf("Received %zu historical samples\n", val_num);
+    if (val_num != values_count) {
+        fprintf(stderr, "Expected %zu historical samples\n", values_count);
+        exit(-1);
+    }
+
+    SEM_POST(sem_sub);
+    z_drop(z_move(s));
+
+    return 0;
+}
+
+int main() {
+    SEM_INIT(sem_pub, SEM_NAME_PUB);
+    SEM_INIT(sem_sub, SEM_NAME_SUB);
+
+    func_ptr_t funcs[] = {run_publisher, run_subscriber};
+    assert(run_timeouted_test(funcs, 2, 20) == 0);
+
+    SEM_DROP(sem_pub, SEM_NAME_PUB);
+    SEM_DROP(sem_sub, SEM_NAME_SUB);
+
+    return 0;
+}
+
+#else
+int main() { return 0; }
+#endif  // VALID_PLATFORM
@@ -109,6 +109,18 @@ void data_handler(z_loaned_sample_t *sample, void *arg) {
         perror("Unexpected null source_info");
         exit(-1);
     }
+
+    zc_sample_fields_t fields;
+    zc_sample_get_fields(sample, &fields);
+    if (fields.keyexpr != z_sample_keyexpr(sample) || fields.payload != z_sample_payload(sample) ||
+        fields.encoding != z_sample_encoding(sample) || fields.timestamp != z_sample_timestamp(sample) ||
+        fields.attachment != z_sample_attachment(sample) || fields.kind != z_sample_kind(sample) ||
+        fields.priority != z_sample_priority(sample) ||
+        fields.congestion_control != z_sample_congestion_control(sample) ||
+        fields.express != z_sample_express(sample) || fields.reliability != z_sample_reliability(sample)) {
+        perror("Unexpected sample fields");
+        exit(-1);
+    }
 #endif
     // See https://github.com/eclipse-zenoh/zenoh/issues/1203
     // const uint64_t sn = z_source_info_sn(source_info);